@@ -74,46 +74,35 @@ class ViewController: UIViewController, MTKViewDelegate {
             return
         }
         
-        
-        print("decompressing spz now")
-        
-        var strm = z_stream()
-        
-        var ret = inflateInit2_(&strm, 16 + MAX_WBITS, ZLIB_VERSION, Int32(MemoryLayout<z_stream>.size))
-        guard ret == Z_OK else {
-            print("ERROR: Failed to init zlib inflate")
-            return
-        }
-        
-        let inputPointer = (compressedData as NSData).bytes.bindMemory(to: Bytef.self, capacity: fileSize)
-        
-        strm.avail_in = uInt(fileSize)
-        strm.next_in = UnsafeMutablePointer<Bytef>(mutating: inputPointer)
-        
-        var outSize = fileSize * 10
-        let outBuffer = UnsafeMutablePointer<UInt8>.allocate(capacity: outSize)
-        strm.avail_out = uInt(outSize)
-        strm.next_out = outBuffer
-        ret = inflate(&strm, Z_FINISH)
-        if ret != Z_STREAM_END {
-            print("ERROR: zlib decompression failed: \(ret)")
-            outBuffer.deallocate()
-            inflateEnd(&strm)
-            return
+        // Most visible splats first, the rest streams in one batch per frame, 8 MB per frame at most
+        set_scene_progressive_load(true)
+        set_scene_upload_budget(8 * 1024 * 1024)
+        // The splats stay on the CPU (SCENE_SPLAT_RESIDENCY_KEEP) so render_scene_cpu, the render_to_image
+        // fallback and CPU batches keep working; drop them only where nothing renders on the CPU
+        set_scene_splat_residency(SCENE_SPLAT_RESIDENCY_KEEP)
+        
+        // Inflate and decode on a load thread; render_frame_ios picks the result up, launch is not blocked
+        let started = compressedData.withUnsafeBytes { (bytes: UnsafeRawBufferPointer) -> Bool in
+            var source = scene_load_source_t()
+            source.data = bytes.bindMemory(to: UInt8.self).baseAddress
+            source.size = fileSize
+            return scene_load_async(source, { progress, _ in
+                switch progress.state {
+                case SCENE_LOAD_UPLOADING:
+                    print("SPZ decoded, uploading \(progress.total_splats) splats")
+                case SCENE_LOAD_DONE:
+                    print("SPZ file processing completed!")
+                case SCENE_LOAD_FAILED:
+                    print("ERROR: Failed to load SPZ data")
+                default:
+                    break
+                }
+            }, nil)
         }
-        
-        let decompressedSize = outSize - Int(strm.avail_out)
-        inflateEnd(&strm)
-        print("Decompression success: \(decompressedSize) bytes")
-        
-        let result = parse_spz_data(outBuffer, decompressedSize)
-        if result != 0 {
-            print("ERROR: Failed to parse SPZ data")
+        if !started {
+            print("ERROR: Failed to start loading SPZ data")
         }
         
-        outBuffer.deallocate()
-        print("SPZ file processing completed!")
-        
     }
     
     func initializeSokol(){
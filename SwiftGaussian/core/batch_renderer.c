@@ -0,0 +1,161 @@
+#include "batch_renderer.h"
+#include "offscreen.h"
+#include "scene.h"
+#include "utils/core_memory.h"
+#include "utils/logger.h"
+#include "utils/timer.h"
+#include <math.h>
+#include <stdlib.h>
+
+static int render_batch_cpu(const batch_render_desc_t *desc)
+{
+    uint8_t *pixels = (uint8_t *)core_malloc(MEMORY_TAG_RENDER, (size_t)desc->width * desc->height * 4);
+    if (!pixels)
+    {
+        print("ERROR: Failed to allocate batch image\n");
+        return -1;
+    }
+
+    for (uint32_t i = 0; i < desc->view_count; i++)
+    {
+        Camera camera = desc->cameras[i];
+        if (render_scene_cpu(&camera, desc->width, desc->height, pixels, NULL) != 0)
+        {
+            core_free(pixels);
+            return -1;
+        }
+        desc->on_view(i, pixels, desc->width, desc->height, desc->user_data);
+    }
+
+    core_free(pixels);
+    return 0;
+}
+
+static int finish_view(const batch_render_desc_t *desc, uint32_t view, uint32_t ticket, const uint8_t *pixels)
+{
+    if (render_image_wait(ticket) != RENDER_IMAGE_READY)
+    {
+        print("ERROR: Readback of batch view %u failed\n", view);
+        return -1;
+    }
+    desc->on_view(view, pixels, desc->width, desc->height, desc->user_data);
+    return 0;
+}
+
+static int render_batch_gpu(const batch_render_desc_t *desc)
+{
+    // One host buffer per offscreen target, the ring keeps up to OFFSCREEN_RING_SIZE views in flight
+    size_t image_size = (size_t)desc->width * desc->height * 4;
+    uint8_t *pixels = (uint8_t *)core_malloc(MEMORY_TAG_RENDER, image_size * OFFSCREEN_RING_SIZE);
+    if (!pixels)
+    {
+        print("ERROR: Failed to allocate batch images\n");
+        return -1;
+    }
+
+    uint32_t tickets[OFFSCREEN_RING_SIZE] = {0};
+    int result = 0;
+
+    for (uint32_t i = 0; i < desc->view_count && result == 0; i++)
+    {
+        uint32_t slot = i % OFFSCREEN_RING_SIZE;
+        uint8_t *slot_pixels = pixels + slot * image_size;
+
+        // Deliver the oldest view before its buffer is reused, callbacks stay in view order
+        if (i >= OFFSCREEN_RING_SIZE)
+        {
+            result = finish_view(desc, i - OFFSCREEN_RING_SIZE, tickets[slot], slot_pixels);
+            if (result != 0)
+            {
+                break;
+            }
+        }
+
+        Camera camera = desc->cameras[i];
+        tickets[slot] = render_to_image(&camera, desc->width, desc->height, slot_pixels);
+        if (tickets[slot] == 0)
+        {
+            result = -1;
+        }
+    }
+
+    // Drain the views still in flight
+    uint32_t first = desc->view_count > OFFSCREEN_RING_SIZE ? desc->view_count - OFFSCREEN_RING_SIZE : 0;
+    for (uint32_t i = first; i < desc->view_count && result == 0; i++)
+    {
+        uint32_t slot = i % OFFSCREEN_RING_SIZE;
+        result = finish_view(desc, i, tickets[slot], pixels + slot * image_size);
+    }
+
+    core_free(pixels);
+    return result;
+}
+
+int render_batch(const batch_render_desc_t *desc, batch_render_stats_t *out_stats)
+{
+    if (!desc || !desc->cameras || !desc->on_view || desc->width <= 0 || desc->height <= 0)
+    {
+        return -1;
+    }
+    if (!is_scene_initialized())
+    {
+        print("ERROR: Scene must be initialized before rendering a batch\n");
+        return -1;
+    }
+
+    bool use_cpu = desc->cpu_only || !is_scene_gpu_backed();
+    scene_sort_stats_t sort_before = get_scene_sort_stats();
+    double start = time_now_ms();
+
+    int result;
+    if (use_cpu)
+    {
+        result = render_batch_cpu(desc);
+    }
+    else
+    {
+        set_scene_sort_reuse_tolerance(desc->sort_reuse_tolerance);
+        result = render_batch_gpu(desc);
+        // Interactive frames sort every time
+        set_scene_sort_reuse_tolerance(0.0f);
+    }
+
+    double elapsed = time_now_ms() - start;
+    scene_sort_stats_t sort_after = get_scene_sort_stats();
+
+    batch_render_stats_t stats = {
+        .views_rendered = result == 0 ? desc->view_count : 0,
+        .sorts_dispatched = sort_after.sorts_dispatched - sort_before.sorts_dispatched,
+        .sorts_reused = sort_after.sorts_reused - sort_before.sorts_reused,
+        .used_cpu = use_cpu,
+        .total_ms = elapsed};
+    stats.views_per_second = elapsed > 0.0 ? stats.views_rendered * 1000.0 / elapsed : 0.0;
+
+    if (result == 0)
+    {
+        print("Batch rendered %u views (%dx%d) on the %s in %.1f ms, %.1f views/s, %u sorts reused\n",
+              stats.views_rendered, desc->width, desc->height, use_cpu ? "CPU" : "GPU",
+              elapsed, stats.views_per_second, stats.sorts_reused);
+    }
+
+    if (out_stats)
+    {
+        *out_stats = stats;
+    }
+    return result;
+}
+
+void make_orbit_cameras(const Camera *base, uint32_t count, Camera *out_cameras)
+{
+    if (!base || !out_cameras)
+    {
+        return;
+    }
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        out_cameras[i] = *base;
+        out_cameras[i].yaw = base->yaw + 2.0f * (float)M_PI * (float)i / (float)count;
+        out_cameras[i].firstTouch = true;
+    }
+}
@@ -0,0 +1,63 @@
+#ifndef BATCH_RENDERER_H
+#define BATCH_RENDERER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "camera.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    // Receives each finished view in order; rgba is only valid during the call
+    typedef void (*batch_view_callback_t)(uint32_t view_index, const uint8_t *rgba, int width, int height, void *user_data);
+
+    typedef struct
+    {
+        const Camera *cameras; // view_count poses (yaw/pitch/radius/target/fov as used by the scene camera)
+        uint32_t view_count;
+        int width;
+        int height;
+
+        batch_view_callback_t on_view;
+        void *user_data;
+
+        // Reuse the depth sort between consecutive poses that moved less than this fraction of
+        // the scene extent (see set_scene_sort_reuse_tolerance), 0 sorts every view
+        float sort_reuse_tolerance;
+
+        // Render on the CPU even when a GPU backend is available (servers)
+        bool cpu_only;
+    } batch_render_desc_t;
+
+    typedef struct
+    {
+        uint32_t views_rendered;
+        uint32_t sorts_dispatched;
+        uint32_t sorts_reused;
+        bool used_cpu;
+        double total_ms;
+        double views_per_second;
+    } batch_render_stats_t;
+
+    /**
+     * Render many views of the loaded scene in one session
+     * The splat texture, sort buffers and offscreen targets are shared by all views. On the GPU
+     * views go through the render_to_image ring, so view N is drawn while the readbacks of the
+     * previous views are still in flight. The CPU mode reuses the decoded texels for every view.
+     *
+     * @param desc Poses, output size and callback
+     * @param out_stats Optional throughput and sort reuse counters, may be NULL
+     * @return 0 on success, -1 on failure
+     */
+    int render_batch(const batch_render_desc_t *desc, batch_render_stats_t *out_stats);
+
+    // Fill out_cameras with count copies of base spread evenly around a full turn of yaw (turntables)
+    void make_orbit_cameras(const Camera *base, uint32_t count, Camera *out_cameras);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // BATCH_RENDERER_H
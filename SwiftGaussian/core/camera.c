@@ -1,4 +1,5 @@
 #include "camera.h"
+#include "utils/core_memory.h"
 #include "utils/logger.h"
 #include <math.h>
 #include <stdlib.h>
@@ -6,7 +7,7 @@
 
 Camera *camera_create(void)
 {
-    Camera *camera = (Camera *)malloc(sizeof(Camera));
+    Camera *camera = (Camera *)core_malloc(MEMORY_TAG_OTHER, sizeof(Camera));
     if (!camera)
     {
         printf("ERROR: Failed to allocate memory for camera");
@@ -40,7 +41,7 @@ void camera_destroy(Camera *camera)
 {
     if (camera)
     {
-        free(camera);
+        core_free(camera);
         printf("Camera destroyed");
     }
 }
@@ -71,10 +72,10 @@ void camera_handle_input(Camera *camera, float x, float y)
     camera->pitch -= dy * camera->sensitivity;
 
     // Clamp pitch to prevent over-rotation
-    if (camera->pitch > 1.5f)
-        camera->pitch = 1.5f;
-    if (camera->pitch < -1.5f)
-        camera->pitch = -1.5f;
+    if (camera->pitch > CAMERA_MAX_PITCH)
+        camera->pitch = CAMERA_MAX_PITCH;
+    if (camera->pitch < -CAMERA_MAX_PITCH)
+        camera->pitch = -CAMERA_MAX_PITCH;
 }
 
 void camera_update_position(Camera *camera)
@@ -114,15 +115,33 @@ HMM_Mat4 camera_get_projection_matrix(Camera *camera, float aspect_ratio)
     return HMM_Perspective_RH_NO(camera->fov, aspect_ratio, camera->nearPlane, camera->farPlane);
 }
 
+void camera_get_frustum_planes(Camera *camera, float aspect_ratio, HMM_Vec4 out_planes[5])
+{
+    HMM_Mat4 m = HMM_MulM4(camera_get_projection_matrix(camera, aspect_ratio), camera_get_view_matrix(camera));
+
+    // Rows of the view-projection matrix (Elements[column][row])
+    for (int p = 0; p < 5; p++)
+    {
+        int row = p / 2;
+        float sign = (p & 1) ? -1.0f : 1.0f;
+        HMM_Vec4 plane = HMM_V4(m.Elements[0][3] + sign * m.Elements[0][row],
+                                m.Elements[1][3] + sign * m.Elements[1][row],
+                                m.Elements[2][3] + sign * m.Elements[2][row],
+                                m.Elements[3][3] + sign * m.Elements[3][row]);
+        float len = HMM_LenV3(plane.XYZ);
+        out_planes[p] = len > 0.0f ? HMM_DivV4F(plane, len) : plane;
+    }
+}
+
 void camera_set_radius(Camera *camera, float radius)
 {
     if (camera)
     {
         camera->radius = radius;
-        if (camera->radius < 0.1f)
-            camera->radius = 0.1f;
-        if (camera->radius > 300.0f)
-            camera->radius = 300.0f;
+        if (camera->radius < CAMERA_MIN_RADIUS)
+            camera->radius = CAMERA_MIN_RADIUS;
+        if (camera->radius > CAMERA_MAX_RADIUS)
+            camera->radius = CAMERA_MAX_RADIUS;
     }
 }
 
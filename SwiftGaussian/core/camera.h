@@ -4,6 +4,11 @@
 #include <stdbool.h>
 #include "utils/handmademath.h"
 
+// Orbit limits enforced by the touch and pinch handlers
+#define CAMERA_MAX_PITCH 1.5f
+#define CAMERA_MIN_RADIUS 0.1f
+#define CAMERA_MAX_RADIUS 300.0f
+
 typedef struct
 {
     // Camera position and orientation
@@ -37,6 +42,9 @@ void camera_update_position(Camera *camera);
 HMM_Mat4 camera_get_view_matrix(Camera *camera);
 HMM_Mat4 camera_get_projection_matrix(Camera *camera, float aspect_ratio);
 
+// Left, right, bottom, top and near planes of the view frustum, normalized with the inside positive
+void camera_get_frustum_planes(Camera *camera, float aspect_ratio, HMM_Vec4 out_planes[5]);
+
 // Camera property getters/setters
 void camera_set_radius(Camera *camera, float radius);
 void camera_set_fov(Camera *camera, float fov);
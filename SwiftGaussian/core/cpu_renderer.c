@@ -0,0 +1,547 @@
+#include "cpu_renderer.h"
+#include "utils/core_memory.h"
+#include "utils/jobs.h"
+#include "utils/logger.h"
+#include "utils/quaternion.h"
+#include "utils/timer.h"
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#define CPU_TILE_PIXELS (CPU_TILE_SIZE * CPU_TILE_SIZE)
+
+// Fragments below this alpha would not change an 8-bit output
+#define CPU_MIN_ALPHA (1.0f / 255.0f)
+
+// Once transmittance drops below half an 8-bit step nothing behind can show through
+#define CPU_MIN_TRANSMITTANCE (0.5f / 255.0f)
+
+// Splats with a quad corner this close to (or behind) the camera plane are skipped
+#define CPU_MIN_CLIP_W 1e-4f
+
+// Same thresholds as splat.glsl
+#define SPLAT_MIN_ALPHA_BYTE 3u
+#define SPLAT_RADIUS_SQ 0.25f
+#define SPLAT_GAUSSIAN_SCALE 8.0f
+
+typedef struct
+{
+    // Maps a pixel center (x, y, 1) to homogeneous quad coordinates, row-major
+    float hinv[9];
+    float color[4];
+    float depth;
+    int x0, y0, x1, y1; // pixel bounds, x1/y1 exclusive; x0 >= x1 means culled
+} cpu_prepared_splat_t;
+
+static inline uint32_t float_to_sortable(float f)
+{
+    uint32_t bits;
+    memcpy(&bits, &f, sizeof(bits));
+    return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+}
+
+static int compare_u64(const void *a, const void *b)
+{
+    uint64_t ka = *(const uint64_t *)a;
+    uint64_t kb = *(const uint64_t *)b;
+    return (ka > kb) - (ka < kb);
+}
+
+// Decode one texel the same way splat.glsl does and project its quad to the screen
+static void prepare_splat(const uint32_t *texel, const splat_chunk_t *chunk, splat_layout_t layout,
+                          const HMM_Mat4 *view_proj, HMM_Vec3 camera_pos, HMM_Vec3 camera_forward,
+                          int width, int height, cpu_prepared_splat_t *out)
+{
+    out->x0 = out->x1 = 0;
+
+    uint32_t alpha = texel[3] & 0xFFu;
+    if (alpha < SPLAT_MIN_ALPHA_BYTE)
+    {
+        return;
+    }
+
+    // Position, relative to the splat's chunk
+    HMM_Vec3 pos = splat_chunk_position(chunk, (texel[0] >> 16) & 0xFFFFu, texel[0] & 0xFFFFu, (texel[1] >> 16) & 0xFFFFu);
+
+    // Rotation - smallest-three quaternion or octahedral encoded axis + angle
+    const float inv_255 = 1.0f / 255.0f;
+    HMM_Quat q;
+    if (layout == SPLAT_LAYOUT_QUATERNION)
+    {
+        q = quat_decode_smallest_three(splat_texel_quaternion(texel));
+    }
+    else
+    {
+        HMM_Vec2 oct = HMM_V2((float)((texel[1] >> 8) & 0xFFu) * inv_255, (float)(texel[1] & 0xFFu) * inv_255);
+        float angle = (float)((texel[2] >> 24) & 0xFFu) * inv_255 * HMM_PI32;
+        q = axis_angle_to_quat(octahedral_decode(oct), angle);
+    }
+
+    // Scale - only x and y span the quad
+    float scale_x = expf((float)((texel[2] >> 16) & 0xFFu) * (1.0f / 25.5f) - 5.0f);
+    float scale_y = expf((float)((texel[2] >> 8) & 0xFFu) * (1.0f / 25.5f) - 5.0f);
+
+    // First two columns of quat_to_mat3 in splat.glsl
+    HMM_Vec3 axis_u = HMM_V3(1.0f - 2.0f * (q.Y * q.Y + q.Z * q.Z),
+                             2.0f * (q.X * q.Y - q.W * q.Z),
+                             2.0f * (q.X * q.Z + q.W * q.Y));
+    HMM_Vec3 axis_v = HMM_V3(2.0f * (q.X * q.Y + q.W * q.Z),
+                             1.0f - 2.0f * (q.X * q.X + q.Z * q.Z),
+                             2.0f * (q.Y * q.Z - q.W * q.X));
+    axis_u = HMM_MulV3F(axis_u, scale_x);
+    axis_v = HMM_MulV3F(axis_v, scale_y);
+
+    // clip(u, v) = c0 + u * c1 + v * c2
+    HMM_Vec4 c0 = HMM_MulM4V4(*view_proj, HMM_V4(pos.X, pos.Y, pos.Z, 1.0f));
+    HMM_Vec4 c1 = HMM_MulM4V4(*view_proj, HMM_V4(axis_u.X, axis_u.Y, axis_u.Z, 0.0f));
+    HMM_Vec4 c2 = HMM_MulM4V4(*view_proj, HMM_V4(axis_v.X, axis_v.Y, axis_v.Z, 0.0f));
+
+    // Only the inner disc (radius 0.5 in quad coordinates) produces fragments
+    float min_x = (float)width, min_y = (float)height, max_x = 0.0f, max_y = 0.0f;
+    for (int corner = 0; corner < 4; corner++)
+    {
+        float u = (corner & 1) ? 0.5f : -0.5f;
+        float v = (corner & 2) ? 0.5f : -0.5f;
+        float cx = c0.X + u * c1.X + v * c2.X;
+        float cy = c0.Y + u * c1.Y + v * c2.Y;
+        float cw = c0.W + u * c1.W + v * c2.W;
+        if (cw < CPU_MIN_CLIP_W)
+        {
+            return;
+        }
+
+        float px = (cx / cw * 0.5f + 0.5f) * (float)width;
+        float py = (0.5f - cy / cw * 0.5f) * (float)height;
+        min_x = fminf(min_x, px);
+        min_y = fminf(min_y, py);
+        max_x = fmaxf(max_x, px);
+        max_y = fmaxf(max_y, py);
+    }
+
+    int x0 = (int)fmaxf(floorf(min_x), 0.0f);
+    int y0 = (int)fmaxf(floorf(min_y), 0.0f);
+    int x1 = (int)fminf(ceilf(max_x), (float)width);
+    int y1 = (int)fminf(ceilf(max_y), (float)height);
+    if (x0 >= x1 || y0 >= y1)
+    {
+        return;
+    }
+
+    // Homography from quad coordinates to homogeneous pixel coordinates
+    float half_w = 0.5f * (float)width;
+    float half_h = 0.5f * (float)height;
+    HMM_Mat3 h;
+    h.Columns[0] = HMM_V3(half_w * (c1.X + c1.W), half_h * (c1.W - c1.Y), c1.W);
+    h.Columns[1] = HMM_V3(half_w * (c2.X + c2.W), half_h * (c2.W - c2.Y), c2.W);
+    h.Columns[2] = HMM_V3(half_w * (c0.X + c0.W), half_h * (c0.W - c0.Y), c0.W);
+
+    // Edge-on splats have no area
+    float det = HMM_DeterminantM3(h);
+    if (!(fabsf(det) > 1e-20f))
+    {
+        return;
+    }
+
+    HMM_Mat3 inv = HMM_InvGeneralM3(h);
+    for (int r = 0; r < 3; r++)
+    {
+        for (int c = 0; c < 3; c++)
+        {
+            out->hinv[r * 3 + c] = inv.Elements[c][r];
+        }
+    }
+
+    out->color[0] = (float)((texel[3] >> 24) & 0xFFu) * inv_255;
+    out->color[1] = (float)((texel[3] >> 16) & 0xFFu) * inv_255;
+    out->color[2] = (float)((texel[3] >> 8) & 0xFFu) * inv_255;
+    out->color[3] = (float)alpha * inv_255;
+    out->depth = HMM_DotV3(HMM_SubV3(pos, camera_pos), camera_forward);
+    out->x0 = x0;
+    out->y0 = y0;
+    out->x1 = x1;
+    out->y1 = y1;
+}
+
+// Tiles blend in parallel, so a splat's maximum is raised with a CAS loop.
+// Non-negative floats order the same way as their bit patterns.
+static inline void atomic_max_contribution(float *target, float value)
+{
+    uint32_t *target_bits = (uint32_t *)target;
+    uint32_t value_bits;
+    memcpy(&value_bits, &value, sizeof(value_bits));
+
+    uint32_t current = __atomic_load_n(target_bits, __ATOMIC_RELAXED);
+    while (value_bits > current &&
+           !__atomic_compare_exchange_n(target_bits, &current, value_bits, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+    {
+    }
+}
+
+// Blend one tile front to back; returns once every pixel is saturated
+static void blend_tile(const cpu_prepared_splat_t *prepared, const uint64_t *keys, uint32_t key_count,
+                       const cpu_splat_source_t *source, int tile_x, int tile_y, int width, int height,
+                       uint8_t *out_rgba)
+{
+    float accum[CPU_TILE_PIXELS * 3];
+    float transmittance[CPU_TILE_PIXELS];
+    float alpha_row[CPU_TILE_SIZE];
+
+    int px0 = tile_x * CPU_TILE_SIZE;
+    int py0 = tile_y * CPU_TILE_SIZE;
+    int tile_w = width - px0 < CPU_TILE_SIZE ? width - px0 : CPU_TILE_SIZE;
+    int tile_h = height - py0 < CPU_TILE_SIZE ? height - py0 : CPU_TILE_SIZE;
+
+    for (int p = 0; p < CPU_TILE_PIXELS; p++)
+    {
+        accum[p * 3 + 0] = 0.0f;
+        accum[p * 3 + 1] = 0.0f;
+        accum[p * 3 + 2] = 0.0f;
+        transmittance[p] = 1.0f;
+    }
+
+    int active_pixels = tile_w * tile_h;
+
+    for (uint32_t e = 0; e < key_count && active_pixels > 0; e++)
+    {
+        uint32_t prepared_index = (uint32_t)keys[e];
+        const cpu_prepared_splat_t *s = &prepared[prepared_index];
+        const float *h = s->hinv;
+        float max_weight = 0.0f;
+
+        int rx0 = s->x0 > px0 ? s->x0 : px0;
+        int ry0 = s->y0 > py0 ? s->y0 : py0;
+        int rx1 = s->x1 < px0 + tile_w ? s->x1 : px0 + tile_w;
+        int ry1 = s->y1 < py0 + tile_h ? s->y1 : py0 + tile_h;
+        int n = rx1 - rx0;
+
+        for (int y = ry0; y < ry1; y++)
+        {
+            float fy = (float)y + 0.5f;
+            float row_u = h[1] * fy + h[2];
+            float row_v = h[4] * fy + h[5];
+            float row_w = h[7] * fy + h[8];
+
+            // Fixed-width, branch-free loop so the compiler can vectorize it
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+            for (int k = 0; k < n; k++)
+            {
+                float fx = (float)(rx0 + k) + 0.5f;
+                float inv_w = 1.0f / (h[6] * fx + row_w);
+                float u = (h[0] * fx + row_u) * inv_w;
+                float v = (h[3] * fx + row_v) * inv_w;
+                float dist_sq = u * u + v * v;
+
+                // Same falloff as the fragment shader
+                float t = fminf(dist_sq * (1.0f / SPLAT_RADIUS_SQ), 1.0f);
+                float falloff = 1.0f - (t * t * (3.0f - 2.0f * t));
+                float alpha = s->color[3] * expf(-dist_sq * SPLAT_GAUSSIAN_SCALE) * falloff;
+                alpha_row[k] = dist_sq <= SPLAT_RADIUS_SQ ? alpha : 0.0f;
+            }
+
+            int row_base = (y - py0) * CPU_TILE_SIZE - px0;
+            for (int k = 0; k < n; k++)
+            {
+                float alpha = alpha_row[k];
+                int p = row_base + rx0 + k;
+                float t = transmittance[p];
+                if (alpha < CPU_MIN_ALPHA || t < CPU_MIN_TRANSMITTANCE)
+                {
+                    continue;
+                }
+
+                float weight = t * alpha;
+                max_weight = fmaxf(max_weight, weight);
+                accum[p * 3 + 0] += weight * s->color[0];
+                accum[p * 3 + 1] += weight * s->color[1];
+                accum[p * 3 + 2] += weight * s->color[2];
+
+                t *= 1.0f - alpha;
+                transmittance[p] = t;
+                if (t < CPU_MIN_TRANSMITTANCE)
+                {
+                    active_pixels--;
+                }
+            }
+        }
+
+        if (source->max_contribution && max_weight > 0.0f)
+        {
+            uint32_t splat = source->indices ? source->indices[prepared_index] : prepared_index;
+            atomic_max_contribution(&source->max_contribution[splat], max_weight);
+        }
+    }
+
+    // Background is opaque black, so the remaining transmittance adds nothing
+    for (int y = 0; y < tile_h; y++)
+    {
+        uint8_t *dst = out_rgba + ((size_t)(py0 + y) * width + px0) * 4;
+        for (int x = 0; x < tile_w; x++)
+        {
+            const float *c = &accum[(y * CPU_TILE_SIZE + x) * 3];
+            dst[x * 4 + 0] = (uint8_t)(fminf(c[0], 1.0f) * 255.0f + 0.5f);
+            dst[x * 4 + 1] = (uint8_t)(fminf(c[1], 1.0f) * 255.0f + 0.5f);
+            dst[x * 4 + 2] = (uint8_t)(fminf(c[2], 1.0f) * 255.0f + 0.5f);
+            dst[x * 4 + 3] = 255;
+        }
+    }
+}
+
+// State shared by the parallel steps of one cpu_render_splats call
+typedef struct
+{
+    const cpu_splat_source_t *source;
+    const HMM_Mat4 *view_proj;
+    HMM_Vec3 camera_pos;
+    HMM_Vec3 camera_forward;
+    int width, height;
+    int tiles_x;
+    const HMM_Vec4 *planes;
+    uint8_t *chunk_visible;
+    cpu_prepared_splat_t *prepared;
+    uint32_t *tile_offsets;
+    uint32_t *tile_cursors;
+    uint64_t *keys;
+    uint8_t *out_rgba;
+    uint32_t chunks_culled[JOB_MAX_THREADS];
+    uint32_t visible[JOB_MAX_THREADS];
+} cpu_render_job_t;
+
+static void cull_chunks(uint32_t begin, uint32_t end, uint32_t slot, void *context)
+{
+    cpu_render_job_t *job = (cpu_render_job_t *)context;
+    for (uint32_t c = begin; c < end; c++)
+    {
+        job->chunk_visible[c] = splat_chunk_visible(&job->source->chunks[c], job->planes, 5) ? 1 : 0;
+        job->chunks_culled[slot] += job->chunk_visible[c] ? 0 : 1;
+    }
+}
+
+static void prepare_splats(uint32_t begin, uint32_t end, uint32_t slot, void *context)
+{
+    (void)slot;
+    cpu_render_job_t *job = (cpu_render_job_t *)context;
+    const cpu_splat_source_t *source = job->source;
+    for (uint32_t i = begin; i < end; i++)
+    {
+        uint32_t splat = source->indices ? source->indices[i] : i;
+        uint32_t chunk = splat / SPLAT_CHUNK_SIZE;
+        if (!job->chunk_visible[chunk])
+        {
+            job->prepared[i].x0 = job->prepared[i].x1 = 0;
+            continue;
+        }
+        prepare_splat(&source->texels[(size_t)splat * 4], &source->chunks[chunk], source->layout, job->view_proj,
+                      job->camera_pos, job->camera_forward, job->width, job->height, &job->prepared[i]);
+    }
+}
+
+static void count_tile_entries(uint32_t begin, uint32_t end, uint32_t slot, void *context)
+{
+    cpu_render_job_t *job = (cpu_render_job_t *)context;
+    for (uint32_t i = begin; i < end; i++)
+    {
+        const cpu_prepared_splat_t *s = &job->prepared[i];
+        if (s->x0 >= s->x1)
+        {
+            continue;
+        }
+        job->visible[slot]++;
+        for (int ty = s->y0 / CPU_TILE_SIZE; ty <= (s->y1 - 1) / CPU_TILE_SIZE; ty++)
+        {
+            for (int tx = s->x0 / CPU_TILE_SIZE; tx <= (s->x1 - 1) / CPU_TILE_SIZE; tx++)
+            {
+                __atomic_fetch_add(&job->tile_offsets[ty * job->tiles_x + tx + 1], 1u, __ATOMIC_RELAXED);
+            }
+        }
+    }
+}
+
+// Sort key: depth in the high word, splat index in the low word (deterministic ties)
+static void fill_tile_entries(uint32_t begin, uint32_t end, uint32_t slot, void *context)
+{
+    (void)slot;
+    cpu_render_job_t *job = (cpu_render_job_t *)context;
+    for (uint32_t i = begin; i < end; i++)
+    {
+        const cpu_prepared_splat_t *s = &job->prepared[i];
+        if (s->x0 >= s->x1)
+        {
+            continue;
+        }
+        uint64_t key = ((uint64_t)float_to_sortable(s->depth) << 32) | i;
+        for (int ty = s->y0 / CPU_TILE_SIZE; ty <= (s->y1 - 1) / CPU_TILE_SIZE; ty++)
+        {
+            for (int tx = s->x0 / CPU_TILE_SIZE; tx <= (s->x1 - 1) / CPU_TILE_SIZE; tx++)
+            {
+                uint32_t entry = __atomic_fetch_add(&job->tile_cursors[ty * job->tiles_x + tx], 1u, __ATOMIC_RELAXED);
+                job->keys[entry] = key;
+            }
+        }
+    }
+}
+
+// Front to back (ascending view depth)
+static void sort_tiles(uint32_t begin, uint32_t end, uint32_t slot, void *context)
+{
+    (void)slot;
+    cpu_render_job_t *job = (cpu_render_job_t *)context;
+    for (uint32_t t = begin; t < end; t++)
+    {
+        uint32_t count = job->tile_offsets[t + 1] - job->tile_offsets[t];
+        if (count > 1)
+        {
+            qsort(&job->keys[job->tile_offsets[t]], count, sizeof(uint64_t), compare_u64);
+        }
+    }
+}
+
+static void blend_tiles(uint32_t begin, uint32_t end, uint32_t slot, void *context)
+{
+    (void)slot;
+    cpu_render_job_t *job = (cpu_render_job_t *)context;
+    for (uint32_t t = begin; t < end; t++)
+    {
+        blend_tile(job->prepared, &job->keys[job->tile_offsets[t]], job->tile_offsets[t + 1] - job->tile_offsets[t],
+                   job->source, (int)t % job->tiles_x, (int)t / job->tiles_x, job->width, job->height, job->out_rgba);
+    }
+}
+
+int cpu_render_splats(const cpu_splat_source_t *source, Camera *camera, int width, int height,
+                      uint8_t *out_rgba, cpu_render_stats_t *out_stats)
+{
+    if (!source || !source->texels || !camera || !out_rgba || width <= 0 || height <= 0)
+    {
+        return -1;
+    }
+
+    double start_time = time_now_ms();
+    uint32_t splat_count = source->indices ? source->index_count : source->splat_count;
+
+    // Matrices - same as render_scene and dispatch_compute_sort
+    HMM_Mat4 view = camera_get_view_matrix(camera);
+    HMM_Mat4 projection = camera_get_projection_matrix(camera, (float)width / (float)height);
+    HMM_Mat4 view_proj = HMM_MulM4(projection, view);
+    HMM_Vec3 camera_pos = camera->position;
+    HMM_Vec3 camera_forward = HMM_NormV3(HMM_V3(-view.Elements[0][2], -view.Elements[1][2], -view.Elements[2][2]));
+
+    int tiles_x = (width + CPU_TILE_SIZE - 1) / CPU_TILE_SIZE;
+    int tiles_y = (height + CPU_TILE_SIZE - 1) / CPU_TILE_SIZE;
+    int num_tiles = tiles_x * tiles_y;
+
+    uint32_t chunk_count = splat_chunk_count(source->splat_count);
+    cpu_prepared_splat_t *prepared = (cpu_prepared_splat_t *)core_malloc(MEMORY_TAG_RENDER, (size_t)splat_count * sizeof(cpu_prepared_splat_t) + 1);
+    uint32_t *tile_offsets = (uint32_t *)core_calloc(MEMORY_TAG_RENDER, (size_t)num_tiles + 1, sizeof(uint32_t));
+    uint32_t *tile_cursors = (uint32_t *)core_malloc(MEMORY_TAG_RENDER, (size_t)num_tiles * sizeof(uint32_t));
+    uint8_t *chunk_visible = (uint8_t *)core_malloc(MEMORY_TAG_RENDER, (size_t)chunk_count + 1);
+    if (!prepared || !tile_offsets || !tile_cursors || !chunk_visible)
+    {
+        print("ERROR: Failed to allocate CPU renderer buffers for %u splats\n", splat_count);
+        core_free(prepared);
+        core_free(tile_offsets);
+        core_free(tile_cursors);
+        core_free(chunk_visible);
+        return -1;
+    }
+
+    // STEP 0: Cull whole chunks against the view frustum
+    HMM_Vec4 planes[5];
+    camera_get_frustum_planes(camera, (float)width / (float)height, planes);
+    cpu_render_job_t job = {
+        .source = source,
+        .view_proj = &view_proj,
+        .camera_pos = camera_pos,
+        .camera_forward = camera_forward,
+        .width = width,
+        .height = height,
+        .tiles_x = tiles_x,
+        .planes = planes,
+        .chunk_visible = chunk_visible,
+        .prepared = prepared,
+        .tile_offsets = tile_offsets,
+        .tile_cursors = tile_cursors,
+        .out_rgba = out_rgba};
+    job_parallel_for(chunk_count, 256, cull_chunks, &job);
+
+    // STEP 1: Decode and project every splat
+    job_parallel_for(splat_count, 1024, prepare_splats, &job);
+    core_free(chunk_visible);
+
+    double setup_time = time_now_ms();
+
+    // STEP 2: Bin splats into tiles (count, prefix sum, fill)
+    job_parallel_for(splat_count, 1024, count_tile_entries, &job);
+    uint32_t chunks_culled = 0;
+    uint32_t visible = 0;
+    for (uint32_t s = 0; s < JOB_MAX_THREADS; s++)
+    {
+        chunks_culled += job.chunks_culled[s];
+        visible += job.visible[s];
+    }
+
+    uint64_t total_entries = 0;
+    for (int t = 0; t < num_tiles; t++)
+    {
+        total_entries += tile_offsets[t + 1];
+        if (total_entries > UINT32_MAX)
+        {
+            print("ERROR: CPU renderer tile lists overflow (%llu entries)\n", (unsigned long long)total_entries);
+            core_free(prepared);
+            core_free(tile_offsets);
+            core_free(tile_cursors);
+            return -1;
+        }
+        tile_offsets[t + 1] = (uint32_t)total_entries;
+    }
+    memcpy(tile_cursors, tile_offsets, (size_t)num_tiles * sizeof(uint32_t));
+
+    uint64_t *keys = (uint64_t *)core_malloc(MEMORY_TAG_RENDER, (size_t)total_entries * sizeof(uint64_t) + 1);
+    if (!keys)
+    {
+        print("ERROR: Failed to allocate %llu tile entries\n", (unsigned long long)total_entries);
+        core_free(prepared);
+        core_free(tile_offsets);
+        core_free(tile_cursors);
+        return -1;
+    }
+
+    job.keys = keys;
+    job_parallel_for(splat_count, 1024, fill_tile_entries, &job);
+
+    double bin_time = time_now_ms();
+
+    // STEP 3: Sort each tile; tiles differ a lot in size, so the ranges are small
+    job_parallel_for((uint32_t)num_tiles, 4, sort_tiles, &job);
+
+    double sort_time = time_now_ms();
+
+    // STEP 4: Blend tiles
+    job_parallel_for((uint32_t)num_tiles, 1, blend_tiles, &job);
+
+    double end_time = time_now_ms();
+
+    if (out_stats)
+    {
+        double total_seconds = (end_time - start_time) / 1000.0;
+        out_stats->splats_in = splat_count;
+        out_stats->splats_visible = visible;
+        out_stats->chunks_culled = chunks_culled;
+        out_stats->tile_entries = total_entries;
+        out_stats->tiles_x = tiles_x;
+        out_stats->tiles_y = tiles_y;
+        out_stats->setup_ms = setup_time - start_time;
+        out_stats->bin_ms = bin_time - setup_time;
+        out_stats->sort_ms = sort_time - bin_time;
+        out_stats->blend_ms = end_time - sort_time;
+        out_stats->total_ms = end_time - start_time;
+        out_stats->splats_per_second = total_seconds > 0.0 ? splat_count / total_seconds : 0.0;
+        out_stats->megapixels_per_second = total_seconds > 0.0 ? ((double)width * height / 1e6) / total_seconds : 0.0;
+    }
+
+    core_free(keys);
+    core_free(prepared);
+    core_free(tile_offsets);
+    core_free(tile_cursors);
+    return 0;
+}
@@ -0,0 +1,76 @@
+#ifndef CPU_RENDERER_H
+#define CPU_RENDERER_H
+
+#include <stdint.h>
+#include "camera.h"
+#include "splat_texture.h"
+#include "utils/handmademath.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// Screen tiles are CPU_TILE_SIZE x CPU_TILE_SIZE pixels
+#define CPU_TILE_SIZE 16
+
+    // Packed splat data in the same RGBA32UI layout that is uploaded to splat_texture_t
+    typedef struct
+    {
+        const uint32_t *texels; // 4 words per splat, see convert_splats_to_texture_data
+        uint32_t splat_count;
+        splat_layout_t layout;  // rotation encoding the texels were packed with
+
+        // Optional subset of splats to draw (e.g. a LOD cut), NULL draws all splat_count splats
+        const uint32_t *indices;
+        uint32_t index_count;
+
+        // Bounds that dequantize positions, splat_chunk_count(splat_count) entries
+        const splat_chunk_t *chunks;
+
+        // Optional per-splat output indexed by splat id: raised to the largest blend weight
+        // (transmittance * alpha) the splat adds to any pixel, so it accumulates across renders
+        float *max_contribution;
+    } cpu_splat_source_t;
+
+    typedef struct
+    {
+        uint32_t splats_in;      // splats submitted
+        uint32_t splats_visible; // splats that touched at least one tile
+        uint32_t chunks_culled;  // chunks skipped as a whole by the frustum test
+        uint64_t tile_entries;   // splat/tile pairs after binning
+        int tiles_x, tiles_y;
+
+        // Stage timings
+        double setup_ms;
+        double bin_ms;
+        double sort_ms;
+        double blend_ms;
+        double total_ms;
+
+        // Throughput for the whole frame
+        double splats_per_second;
+        double megapixels_per_second;
+    } cpu_render_stats_t;
+
+    /**
+     * Render splats on the CPU into an RGBA8 buffer
+     * Mirrors the GPU path (splat.glsl + alpha blending) so the output can be used as a reference image.
+     * Splats are binned into screen tiles, sorted per tile and blended front to back.
+     *
+     * @param source Packed splat texels and the chunk bounds used to dequantize positions
+     * @param camera Camera to render from
+     * @param width Output width in pixels
+     * @param height Output height in pixels
+     * @param out_rgba Output buffer of width * height * 4 bytes, top row first
+     * @param out_stats Optional stage timings and throughput, may be NULL
+     * @return 0 on success, -1 on failure
+     */
+    int cpu_render_splats(const cpu_splat_source_t *source, Camera *camera, int width, int height,
+                          uint8_t *out_rgba, cpu_render_stats_t *out_stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CPU_RENDERER_H
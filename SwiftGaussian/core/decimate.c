@@ -0,0 +1,388 @@
+#include "decimate.h"
+#include "utils/core_memory.h"
+#include "utils/jobs.h"
+#include "utils/logger.h"
+#include "utils/morton.h"
+#include "utils/timer.h"
+#include <float.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Items per parallel range
+#define DECIMATE_GRAIN 4096
+
+// What the cost function needs from a group, derived from its moments once per round
+typedef struct
+{
+    float position[3];
+    float radius;
+    float color[3];
+    float weight;
+} decimate_summary_t;
+
+typedef struct
+{
+    uint32_t a, b;
+    float cost;
+} decimate_pair_t;
+
+typedef struct
+{
+    gaussian_moments_t *groups; // live groups, compacted after every round
+    uint32_t *sources;          // an input splat of each group, passed through while the group is a single splat
+    decimate_summary_t *summaries;
+    uint64_t *keys;
+    uint32_t *order;  // group index at each Morton position
+    uint32_t *best;   // Morton position of each position's cheapest partner
+    float *best_cost;
+    uint8_t *merged_away;
+    decimate_pair_t *pairs;
+} decimate_scratch_t;
+
+static void free_scratch(decimate_scratch_t *scratch)
+{
+    core_free(scratch->groups);
+    core_free(scratch->sources);
+    core_free(scratch->summaries);
+    core_free(scratch->keys);
+    core_free(scratch->order);
+    core_free(scratch->best);
+    core_free(scratch->best_cost);
+    core_free(scratch->merged_away);
+    core_free(scratch->pairs);
+}
+
+static int compare_pair_cost(const void *a, const void *b)
+{
+    float ca = ((const decimate_pair_t *)a)->cost;
+    float cb = ((const decimate_pair_t *)b)->cost;
+    return (ca > cb) - (ca < cb);
+}
+
+static void summarize(const gaussian_moments_t *moments, decimate_summary_t *out)
+{
+    double inv_w = 1.0 / moments->weight;
+    double m[3] = {moments->mean[0] * inv_w, moments->mean[1] * inv_w, moments->mean[2] * inv_w};
+    double trace = (moments->second[0] + moments->second[3] + moments->second[5]) * inv_w -
+                   (m[0] * m[0] + m[1] * m[1] + m[2] * m[2]);
+
+    // An isotropic disc of radius s has trace 2 * s^2
+    out->position[0] = (float)m[0];
+    out->position[1] = (float)m[1];
+    out->position[2] = (float)m[2];
+    out->radius = (float)sqrt(fmax(trace, 0.0) * 0.5);
+    out->color[0] = (float)(moments->color[0] * inv_w);
+    out->color[1] = (float)(moments->color[1] * inv_w);
+    out->color[2] = (float)(moments->color[2] * inv_w);
+    out->weight = (float)moments->weight;
+}
+
+static inline float merge_cost(const decimate_summary_t *a, const decimate_summary_t *b, float color_weight)
+{
+    float dx = a->position[0] - b->position[0];
+    float dy = a->position[1] - b->position[1];
+    float dz = a->position[2] - b->position[2];
+    float dr = a->color[0] - b->color[0];
+    float dg = a->color[1] - b->color[1];
+    float db = a->color[2] - b->color[2];
+
+    float distance = sqrtf(dx * dx + dy * dy + dz * dz) / (a->radius + b->radius + 1e-12f);
+    float color = sqrtf(dr * dr + dg * dg + db * db);
+    float balance = sqrtf(a->weight * b->weight) / (a->weight + b->weight + 1e-30f);
+    return balance * (distance + color_weight * color);
+}
+
+// What the parallel steps of a round (and the setup and resolve around the rounds) share
+typedef struct
+{
+    decimate_scratch_t *scratch;
+    const decimate_params_t *params;
+    uint32_t n;
+    uint32_t window;
+    float lo[3];
+    float shift[3];
+    float to_grid;
+    uint32_t pair_count;
+    float max_cost[JOB_MAX_THREADS];
+    const gaussian_t *gaussians;
+    gaussian_t *merged;
+} decimate_job_t;
+
+static void summarize_groups(uint32_t begin, uint32_t end, uint32_t slot, void *context)
+{
+    (void)slot;
+    decimate_job_t *job = (decimate_job_t *)context;
+    for (uint32_t i = begin; i < end; i++)
+    {
+        summarize(&job->scratch->groups[i], &job->scratch->summaries[i]);
+    }
+}
+
+static void compute_group_keys(uint32_t begin, uint32_t end, uint32_t slot, void *context)
+{
+    (void)slot;
+    decimate_job_t *job = (decimate_job_t *)context;
+    const decimate_summary_t *summaries = job->scratch->summaries;
+    for (uint32_t i = begin; i < end; i++)
+    {
+        uint64_t cell[3];
+        for (int k = 0; k < 3; k++)
+        {
+            cell[k] = (uint64_t)((summaries[i].position[k] - job->lo[k] + job->shift[k]) * job->to_grid);
+        }
+        job->scratch->keys[i] = morton_encode3((uint32_t)cell[0], (uint32_t)cell[1], (uint32_t)cell[2]);
+        job->scratch->order[i] = i;
+    }
+}
+
+// Cheapest partner of each splat within the window (positions in Morton order)
+static void find_best_partners(uint32_t begin, uint32_t end, uint32_t slot, void *context)
+{
+    (void)slot;
+    decimate_job_t *job = (decimate_job_t *)context;
+    const decimate_summary_t *summaries = job->scratch->summaries;
+    const uint32_t *order = job->scratch->order;
+    uint32_t *best = job->scratch->best;
+    float *best_cost = job->scratch->best_cost;
+    uint32_t n = job->n;
+    uint32_t window = job->window;
+    for (uint32_t k = begin; k < end; k++)
+    {
+        uint32_t first = k > window ? k - window : 0;
+        uint32_t last = k + window < n ? k + window : n - 1;
+        const decimate_summary_t *self = &summaries[order[k]];
+        best[k] = k;
+        best_cost[k] = FLT_MAX;
+        for (uint32_t m = first; m <= last; m++)
+        {
+            if (m == k)
+            {
+                continue;
+            }
+            float cost = merge_cost(self, &summaries[order[m]], job->params->color_weight);
+            if (cost < best_cost[k])
+            {
+                best_cost[k] = cost;
+                best[k] = m;
+            }
+        }
+    }
+}
+
+static void merge_pairs(uint32_t begin, uint32_t end, uint32_t slot, void *context)
+{
+    decimate_job_t *job = (decimate_job_t *)context;
+    const decimate_pair_t *pairs = job->scratch->pairs;
+    for (uint32_t p = begin; p < end; p++)
+    {
+        gaussian_moments_merge(&job->scratch->groups[pairs[p].a], &job->scratch->groups[pairs[p].b]);
+        job->scratch->merged_away[pairs[p].b] = 1;
+        job->max_cost[slot] = fmaxf(job->max_cost[slot], pairs[p].cost);
+    }
+}
+
+// One matching round; returns the number of merges applied (0 when nothing qualifies)
+static uint32_t decimate_round(decimate_scratch_t *scratch, uint32_t *count, uint32_t round,
+                               const decimate_params_t *params, float *out_max_cost)
+{
+    gaussian_moments_t *groups = scratch->groups;
+    decimate_summary_t *summaries = scratch->summaries;
+    uint64_t *keys = scratch->keys;
+    uint32_t *order = scratch->order;
+    uint32_t *best = scratch->best;
+    float *best_cost = scratch->best_cost;
+    uint8_t *merged_away = scratch->merged_away;
+    decimate_pair_t *pairs = scratch->pairs;
+    uint32_t n = *count;
+
+    decimate_job_t job = {
+        .scratch = scratch,
+        .params = params,
+        .n = n,
+        .window = params->window > 0 ? params->window : DECIMATE_DEFAULT_WINDOW};
+    job_parallel_for(n, DECIMATE_GRAIN, summarize_groups, &job);
+
+    float lo[3] = {FLT_MAX, FLT_MAX, FLT_MAX};
+    float hi[3] = {-FLT_MAX, -FLT_MAX, -FLT_MAX};
+    for (uint32_t i = 0; i < n; i++)
+    {
+        for (int k = 0; k < 3; k++)
+        {
+            lo[k] = fminf(lo[k], summaries[i].position[k]);
+            hi[k] = fmaxf(hi[k], summaries[i].position[k]);
+        }
+    }
+
+    // The grid spans twice the extent so a per-round shift moves cell boundaries without
+    // wrapping; neighbours split by a boundary in one round share a cell in a later one
+    float extent = fmaxf(fmaxf(hi[0] - lo[0], hi[1] - lo[1]), fmaxf(hi[2] - lo[2], 1e-6f));
+    float cells = (float)((1u << MORTON_BITS) - 1);
+    job.to_grid = cells / (2.0f * extent);
+    for (int k = 0; k < 3; k++)
+    {
+        float phase = (float)round * (0.6180340f + 0.1f * (float)k);
+        job.lo[k] = lo[k];
+        job.shift[k] = (phase - floorf(phase)) * extent;
+    }
+
+    job_parallel_for(n, DECIMATE_GRAIN, compute_group_keys, &job);
+    if (morton_sort(keys, order, n) != 0)
+    {
+        return 0;
+    }
+    job_parallel_for(n, DECIMATE_GRAIN, find_best_partners, &job);
+
+    // Mutually-best pairs are disjoint, so they can all merge in the same round
+    uint32_t pair_count = 0;
+    for (uint32_t k = 0; k < n; k++)
+    {
+        uint32_t m = best[k];
+        if (m > k && best[m] == k && (params->max_error <= 0.0f || best_cost[k] <= params->max_error))
+        {
+            pairs[pair_count++] = (decimate_pair_t){order[k], order[m], best_cost[k]};
+        }
+    }
+
+    uint32_t needed = params->target_count > 0 ? n - params->target_count : UINT32_MAX;
+    if (pair_count > needed)
+    {
+        qsort(pairs, pair_count, sizeof(decimate_pair_t), compare_pair_cost);
+        pair_count = needed;
+    }
+    if (pair_count == 0)
+    {
+        return 0;
+    }
+
+    memset(merged_away, 0, n);
+    job_parallel_for(pair_count, DECIMATE_GRAIN, merge_pairs, &job);
+    float max_cost = 0.0f;
+    for (uint32_t s = 0; s < JOB_MAX_THREADS; s++)
+    {
+        max_cost = fmaxf(max_cost, job.max_cost[s]);
+    }
+
+    uint32_t write = 0;
+    for (uint32_t i = 0; i < n; i++)
+    {
+        if (!merged_away[i])
+        {
+            groups[write] = groups[i];
+            scratch->sources[write] = scratch->sources[i];
+            write++;
+        }
+    }
+
+    *count = write;
+    *out_max_cost = fmaxf(*out_max_cost, max_cost);
+    return pair_count;
+}
+
+static void add_gaussians(uint32_t begin, uint32_t end, uint32_t slot, void *context)
+{
+    (void)slot;
+    decimate_job_t *job = (decimate_job_t *)context;
+    for (uint32_t i = begin; i < end; i++)
+    {
+        gaussian_moments_add(&job->scratch->groups[i], &job->gaussians[i]);
+        job->scratch->sources[i] = i;
+    }
+}
+
+static void resolve_groups(uint32_t begin, uint32_t end, uint32_t slot, void *context)
+{
+    (void)slot;
+    decimate_job_t *job = (decimate_job_t *)context;
+    for (uint32_t i = begin; i < end; i++)
+    {
+        // Resolving a lone splat would re-derive its axes from the covariance, copy it instead
+        if (job->scratch->groups[i].count == 1)
+        {
+            job->merged[i] = job->gaussians[job->scratch->sources[i]];
+        }
+        else
+        {
+            gaussian_moments_resolve(&job->scratch->groups[i], &job->merged[i]);
+        }
+    }
+}
+
+int decimate_gaussians(const gaussian_t *gaussians, uint32_t count, const decimate_params_t *params,
+                       gaussian_t **out_gaussians, uint32_t *out_count, decimate_stats_t *out_stats)
+{
+    if (!gaussians || count == 0 || !params || !out_gaussians || !out_count)
+    {
+        return -1;
+    }
+    if (params->target_count == 0 && params->max_error <= 0.0f)
+    {
+        print("ERROR: Decimation needs a target count or an error bound\n");
+        return -1;
+    }
+
+    double start_time = time_now_ms();
+
+    decimate_scratch_t scratch = {
+        .groups = (gaussian_moments_t *)core_calloc(MEMORY_TAG_OTHER, count, sizeof(gaussian_moments_t)),
+        .sources = (uint32_t *)core_malloc(MEMORY_TAG_OTHER, (size_t)count * sizeof(uint32_t)),
+        .summaries = (decimate_summary_t *)core_malloc(MEMORY_TAG_OTHER, (size_t)count * sizeof(decimate_summary_t)),
+        .keys = (uint64_t *)core_malloc(MEMORY_TAG_OTHER, (size_t)count * sizeof(uint64_t)),
+        .order = (uint32_t *)core_malloc(MEMORY_TAG_OTHER, (size_t)count * sizeof(uint32_t)),
+        .best = (uint32_t *)core_malloc(MEMORY_TAG_OTHER, (size_t)count * sizeof(uint32_t)),
+        .best_cost = (float *)core_malloc(MEMORY_TAG_OTHER, (size_t)count * sizeof(float)),
+        .merged_away = (uint8_t *)core_malloc(MEMORY_TAG_OTHER, count),
+        .pairs = (decimate_pair_t *)core_malloc(MEMORY_TAG_OTHER, (size_t)(count / 2 + 1) * sizeof(decimate_pair_t))};
+
+    if (!scratch.groups || !scratch.sources || !scratch.summaries || !scratch.keys || !scratch.order || !scratch.best ||
+        !scratch.best_cost || !scratch.merged_away || !scratch.pairs)
+    {
+        print("ERROR: Failed to allocate decimation buffers for %u splats\n", count);
+        free_scratch(&scratch);
+        return -1;
+    }
+
+    decimate_job_t job = {.scratch = &scratch, .gaussians = gaussians};
+    job_parallel_for(count, DECIMATE_GRAIN, add_gaussians, &job);
+
+    uint32_t remaining = count;
+    uint32_t rounds = 0;
+    float max_merge_error = 0.0f;
+    while (params->target_count == 0 || remaining > params->target_count)
+    {
+        uint32_t merges = decimate_round(&scratch, &remaining, rounds, params, &max_merge_error);
+        rounds++;
+        if (merges == 0)
+        {
+            break;
+        }
+    }
+
+    gaussian_t *merged = (gaussian_t *)core_malloc(MEMORY_TAG_OTHER, (size_t)remaining * sizeof(gaussian_t));
+    if (!merged)
+    {
+        print("ERROR: Failed to allocate %u merged splats\n", remaining);
+        free_scratch(&scratch);
+        return -1;
+    }
+
+    job.merged = merged;
+    job_parallel_for(remaining, DECIMATE_GRAIN, resolve_groups, &job);
+    free_scratch(&scratch);
+
+    double total_ms = time_now_ms() - start_time;
+    print("Decimated %u -> %u splats in %u rounds (max merge error %.3f, %.1f ms)\n",
+          count, remaining, rounds, max_merge_error, total_ms);
+
+    *out_gaussians = merged;
+    *out_count = remaining;
+    if (out_stats)
+    {
+        out_stats->input_count = count;
+        out_stats->output_count = remaining;
+        out_stats->rounds = rounds;
+        out_stats->max_merge_error = max_merge_error;
+        out_stats->total_ms = total_ms;
+    }
+    return 0;
+}
@@ -0,0 +1,60 @@
+#ifndef DECIMATE_H
+#define DECIMATE_H
+
+#include <stdint.h>
+#include "gaussian.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// Candidates examined on each side of a splat along the Morton order
+#define DECIMATE_DEFAULT_WINDOW 8
+
+// Merge cost of a unit RGB distance, relative to displacing a splat by its own footprint
+#define DECIMATE_DEFAULT_COLOR_WEIGHT 2.0f
+
+    typedef struct
+    {
+        uint32_t target_count; // stop once this many splats remain, 0 for no count target
+        float max_error;       // never apply a merge costing more than this, <= 0 for no bound
+        float color_weight;
+        uint32_t window;
+    } decimate_params_t;
+
+    typedef struct
+    {
+        uint32_t input_count;
+        uint32_t output_count;
+        uint32_t rounds;
+        float max_merge_error; // most expensive merge that was applied
+        double total_ms;
+    } decimate_stats_t;
+
+    /**
+     * Reduce a splat set by repeatedly merging the cheapest pairs of nearby splats
+     * Each round sorts the current splats along a Morton curve (jittered per round), gives every
+     * splat its cheapest partner within the window, and merges mutually-best pairs in cost order
+     * with moment matching (gaussian_moments_t), until the target count or error bound is hit.
+     *
+     * A merge costs sqrt(wa * wb) / (wa + wb) * (|pa - pb| / (ra + rb) + color_weight * |ca - cb|)
+     * where w is opacity * area and r the footprint radius: faint splats fold into strong
+     * neighbours cheaply, and 1.0 is roughly two equal splats one footprint apart.
+     *
+     * @param gaussians Input splats
+     * @param count Number of input splats
+     * @param params Target count, error bound and search settings
+     * @param out_gaussians Merged splats, core_free() when done
+     * @param out_count Number of merged splats
+     * @param out_stats Optional statistics, may be NULL
+     * @return 0 on success, -1 on failure
+     */
+    int decimate_gaussians(const gaussian_t *gaussians, uint32_t count, const decimate_params_t *params,
+                           gaussian_t **out_gaussians, uint32_t *out_count, decimate_stats_t *out_stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DECIMATE_H
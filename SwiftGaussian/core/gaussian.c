@@ -0,0 +1,344 @@
+#include "gaussian.h"
+#include "utils/quaternion.h"
+#include <float.h>
+#include <math.h>
+#include <string.h>
+
+// Keeps fully transparent groups resolvable without biasing visible ones
+#define GAUSSIAN_MIN_WEIGHT 1e-12
+
+static inline uint8_t quantize_unorm8(float value)
+{
+    return (uint8_t)(fminf(fmaxf(value, 0.0f), 1.0f) * 255.0f + 0.5f);
+}
+
+static inline uint16_t quantize_unorm16(float value)
+{
+    return (uint16_t)(fminf(fmaxf(value, 0.0f), 1.0f) * 65535.0f + 0.5f);
+}
+
+// Inverse of the exp(b / 25.5 - 5) scale decode in splat.glsl
+static inline uint8_t quantize_log_scale(float scale)
+{
+    float encoded = (logf(fmaxf(scale, 1e-30f)) + 5.0f) * 25.5f;
+    return (uint8_t)(fminf(fmaxf(encoded, 0.0f), 255.0f) + 0.5f);
+}
+
+void unpack_gaussian(const PackedSplat *splat, const splat_chunk_t *chunk, splat_layout_t layout,
+                     gaussian_t *out)
+{
+    const float inv_255 = 1.0f / 255.0f;
+
+    out->position = splat_chunk_position(chunk, splat->pos_x, splat->pos_y, splat->pos_z);
+
+    uint8_t scale_z = 0;
+    if (layout == SPLAT_LAYOUT_QUATERNION)
+    {
+        out->rotation = quat_decode_smallest_three(splat->rot_quat);
+    }
+    else
+    {
+        HMM_Vec3 axis = octahedral_decode(HMM_V2(splat->rot_axis_u * inv_255, splat->rot_axis_v * inv_255));
+        out->rotation = axis_angle_to_quat(axis, splat->rot_angle * inv_255 * HMM_PI32);
+        scale_z = splat->scale_z;
+    }
+
+    out->scale = HMM_V3(expf(splat->scale_x / 25.5f - 5.0f),
+                        expf(splat->scale_y / 25.5f - 5.0f),
+                        expf(scale_z / 25.5f - 5.0f));
+
+    out->color = HMM_V4(splat->r * inv_255, splat->g * inv_255, splat->b * inv_255, splat->a * inv_255);
+}
+
+void pack_gaussian(const gaussian_t *gaussian, const splat_chunk_t *chunk, splat_layout_t layout,
+                   PackedSplat *out)
+{
+    HMM_Vec3 size = HMM_Sub(chunk->max, chunk->min);
+    HMM_Vec3 rel = HMM_Sub(gaussian->position, chunk->min);
+    out->pos_x = quantize_unorm16(size.X > 0.0f ? rel.X / size.X : 0.0f);
+    out->pos_y = quantize_unorm16(size.Y > 0.0f ? rel.Y / size.Y : 0.0f);
+    out->pos_z = quantize_unorm16(size.Z > 0.0f ? rel.Z / size.Z : 0.0f);
+
+    if (layout == SPLAT_LAYOUT_QUATERNION)
+    {
+        out->rot_quat = quat_encode_smallest_three(gaussian->rotation);
+    }
+    else
+    {
+        // q and -q are the same rotation, keep w >= 0 so the angle fits [0, pi]
+        HMM_Quat q = gaussian->rotation;
+        if (q.W < 0.0f)
+        {
+            q = HMM_Q(-q.X, -q.Y, -q.Z, -q.W);
+        }
+        HMM_Vec3 axis;
+        float angle;
+        quat_to_axis_angle(q, &axis, &angle);
+        HMM_Vec2 oct = octahedral_encode(axis);
+        out->rot_axis_u = quantize_unorm8(oct.X);
+        out->rot_axis_v = quantize_unorm8(oct.Y);
+        out->rot_angle = quantize_unorm8(angle / HMM_PI32);
+        out->scale_z = quantize_log_scale(gaussian->scale.Z);
+    }
+
+    out->scale_x = quantize_log_scale(gaussian->scale.X);
+    out->scale_y = quantize_log_scale(gaussian->scale.Y);
+
+    out->r = quantize_unorm8(gaussian->color.X);
+    out->g = quantize_unorm8(gaussian->color.Y);
+    out->b = quantize_unorm8(gaussian->color.Z);
+    out->a = quantize_unorm8(gaussian->color.W);
+}
+
+void pack_gaussians_chunked(const gaussian_t *gaussians, uint32_t count, splat_layout_t layout,
+                            PackedSplat *out_splats, splat_chunk_t *out_chunks)
+{
+    for (uint32_t begin = 0; begin < count; begin += SPLAT_CHUNK_SIZE)
+    {
+        uint32_t end = begin + SPLAT_CHUNK_SIZE < count ? begin + SPLAT_CHUNK_SIZE : count;
+        splat_chunk_t *chunk = &out_chunks[begin / SPLAT_CHUNK_SIZE];
+        chunk->min = HMM_V3(FLT_MAX, FLT_MAX, FLT_MAX);
+        chunk->max = HMM_V3(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+        chunk->extent = 0.0f;
+        chunk->_pad = 0.0f;
+        for (uint32_t i = begin; i < end; i++)
+        {
+            HMM_Vec3 p = gaussians[i].position;
+            chunk->min = HMM_V3(fminf(chunk->min.X, p.X), fminf(chunk->min.Y, p.Y), fminf(chunk->min.Z, p.Z));
+            chunk->max = HMM_V3(fmaxf(chunk->max.X, p.X), fmaxf(chunk->max.Y, p.Y), fmaxf(chunk->max.Z, p.Z));
+        }
+        // Extent from the quantized scales, which is what gets drawn
+        uint8_t max_scale = 0;
+        for (uint32_t i = begin; i < end; i++)
+        {
+            PackedSplat *splat = &out_splats[i];
+            pack_gaussian(&gaussians[i], chunk, layout, splat);
+            max_scale = splat->scale_x > max_scale ? splat->scale_x : max_scale;
+            max_scale = splat->scale_y > max_scale ? splat->scale_y : max_scale;
+        }
+        chunk->extent = 0.5f * expf(max_scale / 25.5f - 5.0f);
+    }
+}
+
+void gaussian_axes(const gaussian_t *gaussian, HMM_Vec3 out_axes[3])
+{
+    HMM_Quat q = gaussian->rotation;
+    out_axes[0] = HMM_V3(1.0f - 2.0f * (q.Y * q.Y + q.Z * q.Z), 2.0f * (q.X * q.Y - q.W * q.Z), 2.0f * (q.X * q.Z + q.W * q.Y));
+    out_axes[1] = HMM_V3(2.0f * (q.X * q.Y + q.W * q.Z), 1.0f - 2.0f * (q.X * q.X + q.Z * q.Z), 2.0f * (q.Y * q.Z - q.W * q.X));
+    out_axes[2] = HMM_V3(2.0f * (q.X * q.Z - q.W * q.Y), 2.0f * (q.Y * q.Z + q.W * q.X), 1.0f - 2.0f * (q.X * q.X + q.Y * q.Y));
+}
+
+void gaussian_covariance(const gaussian_t *gaussian, double out_cov[6])
+{
+    HMM_Vec3 axes[3];
+    gaussian_axes(gaussian, axes);
+    double s2[3] = {(double)gaussian->scale.X * gaussian->scale.X,
+                    (double)gaussian->scale.Y * gaussian->scale.Y,
+                    (double)gaussian->scale.Z * gaussian->scale.Z};
+
+    memset(out_cov, 0, 6 * sizeof(double));
+    for (int k = 0; k < 3; k++)
+    {
+        HMM_Vec3 a = axes[k];
+        out_cov[0] += s2[k] * a.X * a.X;
+        out_cov[1] += s2[k] * a.X * a.Y;
+        out_cov[2] += s2[k] * a.X * a.Z;
+        out_cov[3] += s2[k] * a.Y * a.Y;
+        out_cov[4] += s2[k] * a.Y * a.Z;
+        out_cov[5] += s2[k] * a.Z * a.Z;
+    }
+}
+
+// Cyclic Jacobi rotations on a symmetric 3x3 matrix; eigenvectors end up in the columns of v
+static void symmetric_eigen3(const double cov[6], double out_values[3], double v[3][3])
+{
+    double a[3][3] = {{cov[0], cov[1], cov[2]}, {cov[1], cov[3], cov[4]}, {cov[2], cov[4], cov[5]}};
+    for (int i = 0; i < 3; i++)
+    {
+        for (int j = 0; j < 3; j++)
+        {
+            v[i][j] = i == j ? 1.0 : 0.0;
+        }
+    }
+
+    for (int sweep = 0; sweep < 32; sweep++)
+    {
+        double off = a[0][1] * a[0][1] + a[0][2] * a[0][2] + a[1][2] * a[1][2];
+        double diag = a[0][0] * a[0][0] + a[1][1] * a[1][1] + a[2][2] * a[2][2];
+        if (off <= 1e-30 * diag || off == 0.0)
+        {
+            break;
+        }
+
+        for (int p = 0; p < 2; p++)
+        {
+            for (int q = p + 1; q < 3; q++)
+            {
+                if (a[p][q] == 0.0)
+                {
+                    continue;
+                }
+                double theta = (a[q][q] - a[p][p]) / (2.0 * a[p][q]);
+                double t = (theta >= 0.0 ? 1.0 : -1.0) / (fabs(theta) + sqrt(theta * theta + 1.0));
+                double c = 1.0 / sqrt(t * t + 1.0);
+                double s = t * c;
+
+                for (int k = 0; k < 3; k++)
+                {
+                    double akp = a[k][p], akq = a[k][q];
+                    a[k][p] = c * akp - s * akq;
+                    a[k][q] = s * akp + c * akq;
+                }
+                for (int k = 0; k < 3; k++)
+                {
+                    double apk = a[p][k], aqk = a[q][k];
+                    a[p][k] = c * apk - s * aqk;
+                    a[q][k] = s * apk + c * aqk;
+                }
+                for (int k = 0; k < 3; k++)
+                {
+                    double vkp = v[k][p], vkq = v[k][q];
+                    v[k][p] = c * vkp - s * vkq;
+                    v[k][q] = s * vkp + c * vkq;
+                }
+            }
+        }
+    }
+
+    for (int i = 0; i < 3; i++)
+    {
+        out_values[i] = a[i][i];
+    }
+}
+
+void gaussian_set_covariance(gaussian_t *gaussian, const double cov[6])
+{
+    double values[3];
+    double v[3][3];
+    symmetric_eigen3(cov, values, v);
+
+    // Largest principal axes first: x and y span the quad, the smallest becomes the normal
+    int order[3] = {0, 1, 2};
+    for (int i = 0; i < 2; i++)
+    {
+        for (int j = i + 1; j < 3; j++)
+        {
+            if (values[order[j]] > values[order[i]])
+            {
+                int tmp = order[i];
+                order[i] = order[j];
+                order[j] = tmp;
+            }
+        }
+    }
+
+    HMM_Vec3 x = HMM_NormV3(HMM_V3((float)v[0][order[0]], (float)v[1][order[0]], (float)v[2][order[0]]));
+    HMM_Vec3 y = HMM_NormV3(HMM_V3((float)v[0][order[1]], (float)v[1][order[1]], (float)v[2][order[1]]));
+    y = HMM_NormV3(HMM_Sub(y, HMM_MulV3F(x, HMM_DotV3(x, y))));
+    HMM_Vec3 z = HMM_Cross(x, y);
+
+    // Standard matrix-to-quaternion on M = [x y z]; quat_to_mat3 builds the transpose, hence the conjugate
+    float m00 = x.X, m01 = y.X, m02 = z.X;
+    float m10 = x.Y, m11 = y.Y, m12 = z.Y;
+    float m20 = x.Z, m21 = y.Z, m22 = z.Z;
+    float trace = m00 + m11 + m22;
+    HMM_Quat q;
+    if (trace > 0.0f)
+    {
+        float s = sqrtf(trace + 1.0f) * 2.0f;
+        q = HMM_Q((m21 - m12) / s, (m02 - m20) / s, (m10 - m01) / s, 0.25f * s);
+    }
+    else if (m00 > m11 && m00 > m22)
+    {
+        float s = sqrtf(1.0f + m00 - m11 - m22) * 2.0f;
+        q = HMM_Q(0.25f * s, (m01 + m10) / s, (m02 + m20) / s, (m21 - m12) / s);
+    }
+    else if (m11 > m22)
+    {
+        float s = sqrtf(1.0f + m11 - m00 - m22) * 2.0f;
+        q = HMM_Q((m01 + m10) / s, 0.25f * s, (m12 + m21) / s, (m02 - m20) / s);
+    }
+    else
+    {
+        float s = sqrtf(1.0f + m22 - m00 - m11) * 2.0f;
+        q = HMM_Q((m02 + m20) / s, (m12 + m21) / s, 0.25f * s, (m10 - m01) / s);
+    }
+    q = HMM_NormQ(q);
+    gaussian->rotation = HMM_Q(-q.X, -q.Y, -q.Z, q.W);
+
+    gaussian->scale = HMM_V3((float)sqrt(fmax(values[order[0]], 0.0)),
+                             (float)sqrt(fmax(values[order[1]], 0.0)),
+                             (float)sqrt(fmax(values[order[2]], 0.0)));
+}
+
+void gaussian_moments_add(gaussian_moments_t *moments, const gaussian_t *gaussian)
+{
+    double coverage = (double)gaussian->color.W * gaussian->scale.X * gaussian->scale.Y;
+    double w = coverage + GAUSSIAN_MIN_WEIGHT;
+    double p[3] = {gaussian->position.X, gaussian->position.Y, gaussian->position.Z};
+    double cov[6];
+    gaussian_covariance(gaussian, cov);
+
+    moments->weight += w;
+    moments->coverage += coverage;
+    moments->count++;
+    for (int i = 0; i < 3; i++)
+    {
+        moments->mean[i] += w * p[i];
+    }
+    moments->second[0] += w * (cov[0] + p[0] * p[0]);
+    moments->second[1] += w * (cov[1] + p[0] * p[1]);
+    moments->second[2] += w * (cov[2] + p[0] * p[2]);
+    moments->second[3] += w * (cov[3] + p[1] * p[1]);
+    moments->second[4] += w * (cov[4] + p[1] * p[2]);
+    moments->second[5] += w * (cov[5] + p[2] * p[2]);
+    moments->color[0] += w * gaussian->color.X;
+    moments->color[1] += w * gaussian->color.Y;
+    moments->color[2] += w * gaussian->color.Z;
+}
+
+void gaussian_moments_merge(gaussian_moments_t *moments, const gaussian_moments_t *other)
+{
+    moments->weight += other->weight;
+    moments->coverage += other->coverage;
+    moments->count += other->count;
+    for (int i = 0; i < 3; i++)
+    {
+        moments->mean[i] += other->mean[i];
+        moments->color[i] += other->color[i];
+    }
+    for (int i = 0; i < 6; i++)
+    {
+        moments->second[i] += other->second[i];
+    }
+}
+
+int gaussian_moments_resolve(const gaussian_moments_t *moments, gaussian_t *out)
+{
+    if (moments->count == 0 || moments->weight <= 0.0)
+    {
+        return -1;
+    }
+
+    double inv_w = 1.0 / moments->weight;
+    double m[3] = {moments->mean[0] * inv_w, moments->mean[1] * inv_w, moments->mean[2] * inv_w};
+    double cov[6] = {
+        moments->second[0] * inv_w - m[0] * m[0],
+        moments->second[1] * inv_w - m[0] * m[1],
+        moments->second[2] * inv_w - m[0] * m[2],
+        moments->second[3] * inv_w - m[1] * m[1],
+        moments->second[4] * inv_w - m[1] * m[2],
+        moments->second[5] * inv_w - m[2] * m[2]};
+
+    out->position = HMM_V3((float)m[0], (float)m[1], (float)m[2]);
+    gaussian_set_covariance(out, cov);
+
+    // Spread the group's total opacity * area over the merged footprint
+    double area = (double)out->scale.X * out->scale.Y;
+    double opacity = area > 0.0 ? moments->coverage / area : 1.0;
+    out->color = HMM_V4((float)(moments->color[0] * inv_w),
+                        (float)(moments->color[1] * inv_w),
+                        (float)(moments->color[2] * inv_w),
+                        (float)fmin(opacity, 1.0));
+    return 0;
+}
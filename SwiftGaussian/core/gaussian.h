@@ -0,0 +1,80 @@
+#ifndef GAUSSIAN_H
+#define GAUSSIAN_H
+
+#include <stdint.h>
+#include "scene.h"
+#include "splat_texture.h"
+#include "utils/handmademath.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    // Unpacked splat in world space, used by the LOD builder and offline tools
+    typedef struct
+    {
+        HMM_Vec3 position;
+        HMM_Quat rotation; // as consumed by quat_to_mat3 in splat.glsl
+        HMM_Vec3 scale;    // linear, x and y span the drawn quad
+        HMM_Vec4 color;    // rgb and opacity in [0, 1]
+    } gaussian_t;
+
+    // Weighted moments of a group of splats; merging groups is exact, resolving gives the moment-matched splat
+    typedef struct
+    {
+        double weight;    // sum of opacity * area
+        double mean[3];   // weighted sum of positions
+        double second[6]; // weighted sum of covariance + outer(position), packed xx, xy, xz, yy, yz, zz
+        double color[3];  // weighted sum of colors
+        double coverage;  // sum of opacity * area, before the zero-weight guard
+        uint32_t count;
+    } gaussian_moments_t;
+
+    // Positions are dequantized with the bounds of the splat's chunk; the quaternion layout has no z scale
+    void unpack_gaussian(const PackedSplat *splat, const splat_chunk_t *chunk, splat_layout_t layout,
+                         gaussian_t *out);
+
+    // Quantizes to the PackedSplat layout; positions are clamped to the chunk bounds
+    void pack_gaussian(const gaussian_t *gaussian, const splat_chunk_t *chunk, splat_layout_t layout,
+                       PackedSplat *out);
+
+    /**
+     * Pack splats in chunks of SPLAT_CHUNK_SIZE, each quantized to its own bounds
+     *
+     * @param gaussians Splats to pack
+     * @param count Number of splats
+     * @param layout Rotation encoding of the packed splats
+     * @param out_splats Packed splats, count entries
+     * @param out_chunks Chunk bounds, splat_chunk_count(count) entries
+     */
+    void pack_gaussians_chunked(const gaussian_t *gaussians, uint32_t count, splat_layout_t layout,
+                                PackedSplat *out_splats, splat_chunk_t *out_chunks);
+
+    // Columns of quat_to_mat3: x and y span the drawn quad, z is its normal
+    void gaussian_axes(const gaussian_t *gaussian, HMM_Vec3 out_axes[3]);
+
+    // R * S^2 * R^T packed as xx, xy, xz, yy, yz, zz
+    void gaussian_covariance(const gaussian_t *gaussian, double out_cov[6]);
+
+    // Rotation and scale from a covariance, the two largest principal axes span the quad
+    void gaussian_set_covariance(gaussian_t *gaussian, const double cov[6]);
+
+    void gaussian_moments_add(gaussian_moments_t *moments, const gaussian_t *gaussian);
+    void gaussian_moments_merge(gaussian_moments_t *moments, const gaussian_moments_t *other);
+
+    /**
+     * Moment-matched splat of a group: weighted mean and covariance (children spread + own shape),
+     * weighted color, and the opacity that keeps the group's total opacity * area
+     *
+     * @param moments Accumulated group
+     * @param out Merged splat
+     * @return 0 on success, -1 if the group is empty
+     */
+    int gaussian_moments_resolve(const gaussian_moments_t *moments, gaussian_t *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GAUSSIAN_H
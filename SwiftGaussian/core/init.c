@@ -16,6 +16,11 @@
 
 #endif // EMSCRIPTEN
 
+#if defined(__linux__) && !defined(ANDROID)
+#define SOKOL_DUMMY_BACKEND
+#include <stdio.h>
+#endif // LINUX
+
 #ifdef USE_SOKOL
 #include "sokol/sokol_gfx.h"
 #include "sokol/sokol_log.h"
@@ -206,6 +211,45 @@ void cleanup_rendering(void)
 #endif // MACOS
 
 
+#if defined(__linux__) && !defined(ANDROID)
+// Headless Linux (CI, thumbnail servers): there is no window or GPU context,
+// sokol runs on its dummy backend and offscreen renders fall back to the CPU renderer
+void initGpu(void)
+{
+#ifdef USE_SOKOL
+    sg_setup(&(sg_desc){
+        .environment = {
+            .defaults = {
+                .color_format = SG_PIXELFORMAT_RGBA8,
+                .depth_format = SG_PIXELFORMAT_NONE,
+                .sample_count = 1}},
+        .logger.func = slog_func,
+    });
+
+    if (!sg_isvalid())
+    {
+        printf("Failed to initialize Sokol dummy backend\n");
+    }
+#endif // USE_SOKOL
+}
+
+void cleanup_rendering(void)
+{
+#ifdef USE_SOKOL
+    sg_shutdown();
+#endif
+}
+
+bool is_rendering_initialized(void)
+{
+#ifdef USE_SOKOL
+    return sg_isvalid();
+#else
+    return false;
+#endif
+}
+#endif // LINUX
+
 #if defined(__APPLE__) && TARGET_OS_IOS
 #define SOKOL_METAL
 #include "sokol/sokol_gfx.h"
@@ -0,0 +1,382 @@
+#include "spzfile.h"
+#include "utils/core_memory.h"
+#include "utils/logger.h"
+#include "utils/quaternion.h"
+#include "utils/trace.h"
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <zlib.h>
+
+#define SPZ_READ_CHUNK (1u << 20)
+
+// Bytes per point for each attribute section, in file order
+typedef struct
+{
+    size_t stride[6];
+    int section_count;
+} spz_layout_t;
+
+static int spz_get_layout(const uint8_t *data, size_t size, spz_layout_t *layout)
+{
+    if (size < sizeof(PackedGaussiansHeader))
+    {
+        print("ERROR: SPZ data too small for header\n");
+        return -1;
+    }
+
+    const PackedGaussiansHeader *header = (const PackedGaussiansHeader *)data;
+    if (header->magic != 0x5053474e || (header->version != 2 && header->version != 3) || header->shDegree > 3)
+    {
+        print("ERROR: Unsupported SPZ stream (magic 0x%08x, version %u, SH degree %u)\n",
+              header->magic, header->version, header->shDegree);
+        return -1;
+    }
+
+    // positions, alphas, colors, scales, rotations, SH coefficients
+    static const size_t sh_dims[4] = {0, 3, 8, 15};
+    layout->stride[0] = 9;
+    layout->stride[1] = 1;
+    layout->stride[2] = 3;
+    layout->stride[3] = 3;
+    layout->stride[4] = header->version == 3 ? 4 : 3;
+    layout->stride[5] = sh_dims[header->shDegree] * 3;
+    layout->section_count = 6;
+
+    size_t expected = sizeof(PackedGaussiansHeader);
+    for (int s = 0; s < layout->section_count; s++)
+    {
+        expected += layout->stride[s] * header->numPoints;
+    }
+    if (expected > size)
+    {
+        print("ERROR: SPZ data size mismatch. Expected %zu bytes, got %zu\n", expected, size);
+        return -1;
+    }
+    return 0;
+}
+
+int spz_read_file(const char *path, uint8_t **out_data, size_t *out_size)
+{
+    // gzread passes uncompressed files through unchanged
+    gzFile file = gzopen(path, "rb");
+    if (!file)
+    {
+        print("ERROR: Failed to open %s\n", path);
+        return -1;
+    }
+
+    size_t capacity = SPZ_READ_CHUNK;
+    size_t size = 0;
+    uint8_t *data = (uint8_t *)core_malloc(MEMORY_TAG_LOAD, capacity);
+    TRACE_BEGIN("inflate");
+    while (data)
+    {
+        if (capacity - size < SPZ_READ_CHUNK)
+        {
+            uint8_t *grown = (uint8_t *)core_realloc(MEMORY_TAG_LOAD, data, capacity * 2);
+            if (!grown)
+            {
+                core_free(data);
+                data = NULL;
+                break;
+            }
+            data = grown;
+            capacity *= 2;
+        }
+
+        int read = gzread(file, data + size, SPZ_READ_CHUNK);
+        if (read < 0)
+        {
+            print("ERROR: Failed to decompress %s\n", path);
+            TRACE_END();
+            core_free(data);
+            gzclose(file);
+            return -1;
+        }
+        if (read == 0)
+        {
+            break;
+        }
+        size += (size_t)read;
+    }
+    TRACE_END();
+    gzclose(file);
+
+    if (!data)
+    {
+        print("ERROR: Failed to allocate memory for %s\n", path);
+        return -1;
+    }
+
+    *out_data = data;
+    *out_size = size;
+    return 0;
+}
+
+// zlib's window and state, counted with the rest of the load
+static voidpf alloc_inflate_state(voidpf opaque, uInt items, uInt size)
+{
+    (void)opaque;
+    return core_calloc(MEMORY_TAG_LOAD, items, size);
+}
+
+static void free_inflate_state(voidpf opaque, voidpf address)
+{
+    (void)opaque;
+    core_free(address);
+}
+
+int spz_inflate(const uint8_t *data, size_t size, uint8_t **out_data, size_t *out_size,
+                spz_progress_fn progress, void *user_data)
+{
+    if (size < 18 || data[0] != 0x1f || data[1] != 0x8b)
+    {
+        // Not gzip: an uncompressed stream passes through, like spz_read_file
+        uint8_t *copy = (uint8_t *)core_malloc(MEMORY_TAG_LOAD, size ? size : 1);
+        if (!copy)
+        {
+            print("ERROR: Failed to allocate %zu bytes for SPZ data\n", size);
+            return -1;
+        }
+        memcpy(copy, data, size);
+        *out_data = copy;
+        *out_size = size;
+        return 0;
+    }
+
+    // The gzip trailer holds the inflated size modulo 2^32, exact below 4 GB; one spare byte tells the
+    // stream end from a full buffer
+    size_t capacity = (size_t)data[size - 4] | ((size_t)data[size - 3] << 8) | ((size_t)data[size - 2] << 16) |
+                      ((size_t)data[size - 1] << 24);
+    capacity = capacity + 1 > SPZ_READ_CHUNK ? capacity + 1 : SPZ_READ_CHUNK;
+    uint8_t *out = (uint8_t *)core_malloc(MEMORY_TAG_LOAD, capacity);
+    z_stream stream = {.zalloc = alloc_inflate_state, .zfree = free_inflate_state};
+    if (!out || inflateInit2(&stream, 16 + MAX_WBITS) != Z_OK)
+    {
+        print("ERROR: Failed to set up inflating %zu bytes of SPZ data\n", size);
+        core_free(out);
+        return -1;
+    }
+
+    TRACE_BEGIN("inflate");
+    stream.next_in = (Bytef *)data;
+    stream.avail_in = 0;
+    size_t consumed = 0;
+    int ret = Z_OK;
+    bool cancelled = false;
+    while (ret == Z_OK && !cancelled)
+    {
+        if (stream.total_out == capacity)
+        {
+            uint8_t *grown = (uint8_t *)core_realloc(MEMORY_TAG_LOAD, out, capacity * 2);
+            if (!grown)
+            {
+                break;
+            }
+            out = grown;
+            capacity *= 2;
+        }
+        // Bounded steps in and out, so progress is reported and a cancel is noticed every few MB
+        if (stream.avail_in == 0)
+        {
+            size_t step = size - consumed < SPZ_READ_CHUNK ? size - consumed : SPZ_READ_CHUNK;
+            stream.avail_in = (uInt)step;
+            consumed += step;
+        }
+        size_t room = capacity - stream.total_out;
+        stream.next_out = out + stream.total_out;
+        stream.avail_out = (uInt)(room < 4 * SPZ_READ_CHUNK ? room : 4 * SPZ_READ_CHUNK);
+        ret = inflate(&stream, Z_NO_FLUSH);
+        if (ret == Z_BUF_ERROR && stream.avail_in == 0 && consumed < size)
+        {
+            ret = Z_OK; // only needed more input
+        }
+        cancelled = ret == Z_OK && progress && !progress((double)consumed / (double)size, user_data);
+    }
+    size_t inflated = stream.total_out;
+    inflateEnd(&stream);
+    TRACE_END();
+
+    if (ret != Z_STREAM_END)
+    {
+        if (!cancelled)
+        {
+            print("ERROR: Failed to inflate SPZ data (zlib %d)\n", ret);
+        }
+        core_free(out);
+        return -1;
+    }
+    *out_data = out;
+    *out_size = inflated;
+    return 0;
+}
+
+int spz_write_file(const char *path, const uint8_t *data, size_t size)
+{
+    gzFile file = gzopen(path, "wb9");
+    if (!file)
+    {
+        print("ERROR: Failed to create %s\n", path);
+        return -1;
+    }
+
+    size_t written = 0;
+    while (written < size)
+    {
+        unsigned chunk = size - written < SPZ_READ_CHUNK ? (unsigned)(size - written) : SPZ_READ_CHUNK;
+        if (gzwrite(file, data + written, chunk) != (int)chunk)
+        {
+            print("ERROR: Failed to write %s\n", path);
+            gzclose(file);
+            return -1;
+        }
+        written += chunk;
+    }
+
+    return gzclose(file) == Z_OK ? 0 : -1;
+}
+
+int spz_select_points(const uint8_t *data, size_t size, const uint8_t *keep,
+                      uint8_t **out_data, size_t *out_size, uint32_t *out_count)
+{
+    spz_layout_t layout;
+    if (!data || !keep || spz_get_layout(data, size, &layout) != 0)
+    {
+        return -1;
+    }
+
+    const PackedGaussiansHeader *header = (const PackedGaussiansHeader *)data;
+    uint32_t kept = 0;
+    for (uint32_t i = 0; i < header->numPoints; i++)
+    {
+        kept += keep[i] ? 1 : 0;
+    }
+
+    size_t selected_size = sizeof(PackedGaussiansHeader);
+    for (int s = 0; s < layout.section_count; s++)
+    {
+        selected_size += layout.stride[s] * kept;
+    }
+
+    uint8_t *selected = (uint8_t *)core_malloc(MEMORY_TAG_LOAD, selected_size);
+    if (!selected)
+    {
+        print("ERROR: Failed to allocate %zu bytes for selected SPZ points\n", selected_size);
+        return -1;
+    }
+
+    PackedGaussiansHeader selected_header = *header;
+    selected_header.numPoints = kept;
+    memcpy(selected, &selected_header, sizeof(selected_header));
+
+    // Attributes are stored section by section, so compact each section on its own
+    const uint8_t *src = data + sizeof(PackedGaussiansHeader);
+    uint8_t *dst = selected + sizeof(PackedGaussiansHeader);
+    for (int s = 0; s < layout.section_count; s++)
+    {
+        size_t stride = layout.stride[s];
+        for (uint32_t i = 0; i < header->numPoints && stride > 0; i++)
+        {
+            if (keep[i])
+            {
+                memcpy(dst, src + (size_t)i * stride, stride);
+                dst += stride;
+            }
+        }
+        src += stride * header->numPoints;
+    }
+
+    *out_data = selected;
+    *out_size = selected_size;
+    if (out_count)
+    {
+        *out_count = kept;
+    }
+    return 0;
+}
+
+static inline uint8_t encode_unorm8(float value)
+{
+    return (uint8_t)(fminf(fmaxf(value, 0.0f), 1.0f) * 255.0f + 0.5f);
+}
+
+int spz_encode_gaussians(const gaussian_t *gaussians, uint32_t count, uint8_t fractional_bits,
+                         uint8_t **out_data, size_t *out_size)
+{
+    const size_t stride = 9 + 1 + 3 + 3 + 4;
+    size_t size = sizeof(PackedGaussiansHeader) + stride * count;
+    uint8_t *data = (uint8_t *)core_malloc(MEMORY_TAG_LOAD, size);
+    if (!data)
+    {
+        print("ERROR: Failed to allocate %zu bytes for SPZ encoding\n", size);
+        return -1;
+    }
+
+    PackedGaussiansHeader header = {
+        .magic = 0x5053474e,
+        .version = 3,
+        .numPoints = count,
+        .shDegree = 0,
+        .fractionalBits = fractional_bits};
+    memcpy(data, &header, sizeof(header));
+
+    uint8_t *positions = data + sizeof(PackedGaussiansHeader);
+    uint8_t *alphas = positions + (size_t)count * 9;
+    uint8_t *colors = alphas + count;
+    uint8_t *scales = colors + (size_t)count * 3;
+    uint8_t *rotations = scales + (size_t)count * 3;
+
+    const float fixed_scale = (float)(1 << fractional_bits);
+    const float fixed_limit = (float)(1 << 23) - 1.0f;
+    int overflow = 0;
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        const gaussian_t *g = &gaussians[i];
+
+        float position[3] = {g->position.X, -g->position.Y, g->position.Z};
+        for (int k = 0; k < 3; k++)
+        {
+            float fixed = position[k] * fixed_scale;
+            if (fabsf(fixed) > fixed_limit)
+            {
+                overflow = 1;
+            }
+            int32_t value = (int32_t)lrintf(fminf(fmaxf(fixed, -fixed_limit), fixed_limit));
+            positions[(size_t)i * 9 + k * 3 + 0] = (uint8_t)(value & 0xFF);
+            positions[(size_t)i * 9 + k * 3 + 1] = (uint8_t)((value >> 8) & 0xFF);
+            positions[(size_t)i * 9 + k * 3 + 2] = (uint8_t)((value >> 16) & 0xFF);
+        }
+
+        alphas[i] = encode_unorm8(g->color.W);
+        colors[(size_t)i * 3 + 0] = encode_unorm8(g->color.X);
+        colors[(size_t)i * 3 + 1] = encode_unorm8(g->color.Y);
+        colors[(size_t)i * 3 + 2] = encode_unorm8(g->color.Z);
+
+        // Inverse of the exp(b / 25.5 - 5) decode
+        float scale[3] = {g->scale.X, g->scale.Y, g->scale.Z};
+        for (int k = 0; k < 3; k++)
+        {
+            float encoded = (logf(fmaxf(scale[k], 1e-30f)) + 5.0f) * 25.5f;
+            scales[(size_t)i * 3 + k] = (uint8_t)(fminf(fmaxf(encoded, 0.0f), 255.0f) + 0.5f);
+        }
+
+        uint32_t rotation = quat_encode_smallest_three(g->rotation);
+        for (int k = 0; k < 4; k++)
+        {
+            rotations[(size_t)i * 4 + k] = (uint8_t)((rotation >> (8 * k)) & 0xFF);
+        }
+    }
+
+    if (overflow)
+    {
+        print("ERROR: Positions exceed the 24-bit range at %u fractional bits\n", fractional_bits);
+        core_free(data);
+        return -1;
+    }
+
+    *out_data = data;
+    *out_size = size;
+    return 0;
+}
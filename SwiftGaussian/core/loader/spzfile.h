@@ -0,0 +1,85 @@
+#ifndef SPZFILE_H
+#define SPZFILE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "spzloader.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * Read an SPZ file into memory, inflating it if it is gzip-compressed
+     *
+     * @param path Input file path
+     * @param out_data Decompressed SPZ stream (header + attributes), core_free() when done
+     * @param out_size Size of out_data in bytes
+     * @return 0 on success, -1 on failure
+     */
+    int spz_read_file(const char *path, uint8_t **out_data, size_t *out_size);
+
+    // Called between steps of a long operation with its completed fraction (0-1); false cancels it
+    typedef bool (*spz_progress_fn)(double fraction, void *user_data);
+
+    /**
+     * Inflate an SPZ file held in memory; data that is not gzip-compressed is copied unchanged
+     *
+     * @param data File contents
+     * @param size Size of data in bytes
+     * @param out_data Decompressed SPZ stream (header + attributes), core_free() when done
+     * @param out_size Size of out_data in bytes
+     * @param progress Reports the fraction of data consumed every few MB and can cancel, may be NULL
+     * @param user_data Passed to progress
+     * @return 0 on success, -1 on failure or when progress cancelled
+     */
+    int spz_inflate(const uint8_t *data, size_t size, uint8_t **out_data, size_t *out_size,
+                    spz_progress_fn progress, void *user_data);
+
+    /**
+     * Write a decompressed SPZ stream as a gzip-compressed .spz file
+     *
+     * @param path Output file path
+     * @param data Decompressed SPZ stream
+     * @param size Size of data in bytes
+     * @return 0 on success, -1 on failure
+     */
+    int spz_write_file(const char *path, const uint8_t *data, size_t size);
+
+    /**
+     * Copy the points with a non-zero keep flag into a new SPZ stream
+     * Every attribute (including spherical harmonics) is copied byte for byte, so the kept
+     * splats decode exactly as they did in the source.
+     *
+     * @param data Decompressed SPZ stream
+     * @param size Size of data in bytes
+     * @param keep One flag per point
+     * @param out_data New SPZ stream, core_free() when done
+     * @param out_size Size of out_data in bytes
+     * @param out_count Number of points kept, may be NULL
+     * @return 0 on success, -1 on failure
+     */
+    int spz_select_points(const uint8_t *data, size_t size, const uint8_t *keep,
+                          uint8_t **out_data, size_t *out_size, uint32_t *out_count);
+
+    /**
+     * Encode gaussians as a version 3 SPZ stream without spherical harmonics
+     * Inverse of parse_spz_data_to_gaussians (Y is flipped back, scales use the same log encoding).
+     *
+     * @param gaussians Splats in world space
+     * @param count Number of splats
+     * @param fractional_bits Fixed-point precision for positions (12 is common)
+     * @param out_data New SPZ stream, core_free() when done
+     * @param out_size Size of out_data in bytes
+     * @return 0 on success, -1 if a position does not fit 24 bits or allocation fails
+     */
+    int spz_encode_gaussians(const gaussian_t *gaussians, uint32_t count, uint8_t fractional_bits,
+                             uint8_t **out_data, size_t *out_size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SPZFILE_H
@@ -1,21 +1,37 @@
 #include "spzloader.h"
+#include "utils/core_memory.h"
+#include "utils/morton.h"
 #include "utils/quaternion.h"
+#include "splat_texture.h"
+#include "utils/jobs.h"
+#include "utils/trace.h"
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <math.h>
 #include <float.h>
 
-#ifdef _OPENMP
-#include <omp.h>
-#endif
+// Splats per range of the parallel loops; chunk loops take 16 chunks (4096 splats) per range
+#define LOADER_GRAIN 4096
+#define LOADER_CHUNK_GRAIN 16
 
 static inline float clamp_fast(float x, float min_val, float max_val)
 {
     return fminf(fmaxf(x, min_val), max_val);
 }
 
-int parse_spz_data_to_splats(const uint8_t *decompressed_data, size_t decompressed_size,
-                             PackedSplat **out_splats, uint32_t *out_count, BoundingBox *out_bounds)
+typedef struct
+{
+    const PackedGaussiansHeader *header;
+    const uint8_t *positions; // 3 * 24-bit fixed point
+    const uint8_t *alphas;
+    const uint8_t *colors;
+    const uint8_t *scales; // log scale
+    const uint8_t *rotations;
+} spz_sections_t;
+
+// Validate the header and find each attribute section of a decompressed SPZ stream
+static int locate_spz_sections(const uint8_t *decompressed_data, size_t decompressed_size, spz_sections_t *out)
 {
     if (decompressed_size < sizeof(PackedGaussiansHeader))
     {
@@ -40,19 +56,9 @@ int parse_spz_data_to_splats(const uint8_t *decompressed_data, size_t decompress
         return -1;
     }
 
-    *out_count = header->numPoints;
-
     print("Parsing SPZ data: %u points, version %u, SH degree %u, fractional bits %u\n",
           header->numPoints, header->version, header->shDegree, header->fractionalBits);
 
-    // Allocate output splats
-    PackedSplat *splats = (PackedSplat *)malloc(header->numPoints * sizeof(PackedSplat));
-    if (!splats)
-    {
-        print("ERROR: Failed to allocate memory for splats\n");
-        return -1;
-    }
-
     size_t offset = sizeof(PackedGaussiansHeader);
 
     // Positions: 3 * 24 bits = 9 bytes per point
@@ -87,186 +93,1113 @@ int parse_spz_data_to_splats(const uint8_t *decompressed_data, size_t decompress
     {
         print("ERROR: SPZ data size mismatch. Expected at least %zu bytes, got %zu\n",
               offset, decompressed_size);
-        free(splats);
         return -1;
     }
 
-    // Pre-calculate scale factor for fixed-point conversion
-    const float scale_factor = 1.0f / (float)(1 << header->fractionalBits);
+    out->header = header;
+    out->positions = positions;
+    out->alphas = alphas;
+    out->colors = colors;
+    out->scales = scales;
+    out->rotations = rotations;
+    return 0;
+}
 
-    // PASS 1: Calculate bounding box (must be serial, but optimized)
-    HMM_Vec3 min_pos = {FLT_MAX, FLT_MAX, FLT_MAX};
-    HMM_Vec3 max_pos = {-FLT_MAX, -FLT_MAX, -FLT_MAX};
+// SPZ rotations as stored: version 3 packs the smallest three components, version 2 x, y, z
+static inline HMM_Quat decode_spz_rotation(const uint8_t *rotations, uint32_t i, int is_version_3)
+{
+    const float inv_128 = 1.0f / 128.0f;
+    HMM_Quat rotation;
 
-    // Use branchless min/max for better performance
-    for (uint32_t i = 0; i < header->numPoints; i++)
+    if (is_version_3)
     {
-        const uint8_t *pos_ptr = positions + (i * 9);
+        // Version 3: 3 components * 10 bits + 2 bits for largest component index
+        const uint8_t *rot_ptr = rotations + (i * 4);
+        uint32_t rot_data = rot_ptr[0] | (rot_ptr[1] << 8) |
+                            (rot_ptr[2] << 16) | ((uint32_t)rot_ptr[3] << 24);
+        rotation = quat_decode_smallest_three(rot_data);
+    }
+    else // Version 2
+    {
+        // Version 2: x, y, z components as 8-bit signed integers
+        const uint8_t *rot_ptr = rotations + (i * 3);
+        rotation.X = (float)((int8_t)rot_ptr[0]) * inv_128;
+        rotation.Y = (float)((int8_t)rot_ptr[1]) * inv_128;
+        rotation.Z = (float)((int8_t)rot_ptr[2]) * inv_128;
 
-        // Extract 24-bit little-endian values
-        uint32_t pos_x_raw = pos_ptr[0] | (pos_ptr[1] << 8) | (pos_ptr[2] << 16);
-        uint32_t pos_y_raw = pos_ptr[3] | (pos_ptr[4] << 8) | (pos_ptr[5] << 16);
-        uint32_t pos_z_raw = pos_ptr[6] | (pos_ptr[7] << 8) | (pos_ptr[8] << 16);
+        // Calculate W component to maintain unit quaternion (branchless)
+        float w_sq = 1.0f - (rotation.X * rotation.X +
+                             rotation.Y * rotation.Y +
+                             rotation.Z * rotation.Z);
+        rotation.W = sqrtf(fmaxf(0.0f, w_sq));
+    }
 
-        // Sign extend 24-bit to 32-bit and convert to float
-        float pos_x = ((int32_t)(pos_x_raw << 8) >> 8) * scale_factor;
-        float pos_y = ((int32_t)(pos_y_raw << 8) >> 8) * scale_factor;
-        float pos_z = ((int32_t)(pos_z_raw << 8) >> 8) * scale_factor;
+    return rotation;
+}
 
-        // Branchless min/max (compiles to MINSS/MAXSS on x86, optimal on ARM)
-        min_pos.X = fminf(min_pos.X, pos_x);
-        min_pos.Y = fminf(min_pos.Y, pos_y);
-        min_pos.Z = fminf(min_pos.Z, pos_z);
-        max_pos.X = fmaxf(max_pos.X, pos_x);
-        max_pos.Y = fmaxf(max_pos.Y, pos_y);
-        max_pos.Z = fmaxf(max_pos.Z, pos_z);
+// Nearest integer to sqrt(n); the float estimate is corrected, so the result never depends on sqrt rounding
+static inline uint32_t isqrt_round(uint32_t n)
+{
+    uint32_t r = (uint32_t)sqrtf((float)n);
+    while (r * r > n)
+    {
+        r--;
+    }
+    while ((r + 1) * (r + 1) <= n)
+    {
+        r++;
     }
+    return n > r * r + r ? r + 1 : r;
+}
 
-    print("Position bounds: min(%.3f, %.3f, %.3f) max(%.3f, %.3f, %.3f)\n",
-          min_pos.X, min_pos.Y, min_pos.Z, max_pos.X, max_pos.Y, max_pos.Z);
+// 2^20 * c_sq >= m * s in 32-bit words: m < 2^21 and s < 2^16 are split into 16-bit halves
+static inline bool scaled_square_le(uint32_t m, uint32_t s, uint32_t c_sq)
+{
+    uint32_t low = (m & 0xFFFFu) * s;
+    uint32_t high = (m >> 16) * s + (low >> 16);
+    return high < (c_sq << 4) || (high == (c_sq << 4) && (low & 0xFFFFu) == 0);
+}
 
-    // Handle Y-coordinate flip at bounds level (more efficient than per-splat)
-    float temp_y = min_pos.Y;
-    min_pos.Y = -max_pos.Y;
-    max_pos.Y = -temp_y;
+// round(512 * |c| / sqrt(s)) for |c|^2 <= s: the largest k with (2k - 1)^2 * s <= 2^20 * c^2
+static inline uint32_t renormalized_component(uint32_t c_sq, uint32_t s)
+{
+    uint32_t k = (uint32_t)(512.0f * sqrtf((float)c_sq / (float)s) + 0.5f);
+    while (k > 0 && !scaled_square_le((2 * k - 1) * (2 * k - 1), s, c_sq))
+    {
+        k--;
+    }
+    while (scaled_square_le((2 * k + 1) * (2 * k + 1), s, c_sq))
+    {
+        k++;
+    }
+    return k;
+}
 
-    print("After Y-flip: min(%.3f, %.3f, %.3f) max(%.3f, %.3f, %.3f)\n",
-          min_pos.X, min_pos.Y, min_pos.Z, max_pos.X, max_pos.Y, max_pos.Z);
+// Version 2 rotation (x, y, z as int8 / 128, w implied) to smallest-three in integers. Components are
+// in units of 1/512: 4 * c for x, y, z and round(4 * sqrt(16384 - |c|^2)) for w. When |c| > 128 the
+// implied w clamps to zero and x, y, z are renormalized, as decode_spz_rotation + quat_encode_smallest_three
+// would, but rounded exactly so decode.glsl gives the same word.
+static inline uint32_t spz_v2_rotation_to_smallest_three(const uint8_t *rot_ptr)
+{
+    int32_t c[3] = {(int8_t)rot_ptr[0], (int8_t)rot_ptr[1], (int8_t)rot_ptr[2]};
+    int32_t length_sq = c[0] * c[0] + c[1] * c[1] + c[2] * c[2];
+    int32_t w_sq = 16384 - length_sq;
+    w_sq = w_sq > 0 ? w_sq : 0;
 
-    // Pre-calculate inverse range for normalization (hoist division out of loop)
-    const float inv_range_x = 1.0f / (max_pos.X - min_pos.X);
-    const float inv_range_y = 1.0f / (max_pos.Y - min_pos.Y);
-    const float inv_range_z = 1.0f / (max_pos.Z - min_pos.Z);
+    int32_t squares[4] = {c[0] * c[0], c[1] * c[1], c[2] * c[2], w_sq};
+    int32_t components[4] = {4 * c[0], 4 * c[1], 4 * c[2], (int32_t)isqrt_round(16u * (uint32_t)w_sq)};
+    if (length_sq > 16384)
+    {
+        for (int k = 0; k < 3; k++)
+        {
+            int32_t magnitude = (int32_t)renormalized_component((uint32_t)squares[k], (uint32_t)length_sq);
+            components[k] = c[k] < 0 ? -magnitude : magnitude;
+        }
+    }
 
-    // Pre-calculate constants (avoid recomputation in loop)
-    const float inv_512 = 1.0f / 512.0f;
-    const float inv_128 = 1.0f / 128.0f;
-    const float inv_pi = 1.0f / HMM_PI;
-    const int is_version_3 = (header->version == 3);
+    uint32_t largest = 0;
+    for (uint32_t j = 1; j < 4; j++)
+    {
+        if (squares[j] > squares[largest])
+        {
+            largest = j;
+        }
+    }
+
+    int32_t sign = components[largest] < 0 ? -1 : 1;
+    uint32_t packed = largest;
+    int shift = 2;
+    for (uint32_t j = 0; j < 4; j++)
+    {
+        if (j != largest)
+        {
+            int32_t value = sign * components[j] + 512;
+            value = value < 0 ? 0 : (value > 1023 ? 1023 : value);
+            packed |= (uint32_t)value << shift;
+            shift += 10;
+        }
+    }
+    return packed;
+}
+
+int parse_spz_data_to_splats(const uint8_t *decompressed_data, size_t decompressed_size,
+                             PackedSplat **out_splats, uint32_t *out_count, BoundingBox *out_bounds,
+                             splat_chunk_t **out_chunks)
+{
+    return parse_spz_data_to_splats_with_options(decompressed_data, decompressed_size, NULL,
+                                                 out_splats, out_count, out_bounds, out_chunks, NULL);
+}
+
+static inline int32_t decode_spz_position(const uint8_t *pos_ptr)
+{
+    uint32_t raw = pos_ptr[0] | (pos_ptr[1] << 8) | (pos_ptr[2] << 16);
+    return (int32_t)(raw << 8) >> 8;
+}
+
+typedef struct
+{
+    const uint8_t *positions;
+    const uint32_t *order;
+    const int32_t *lo;
+    const double *to_grid;
+    uint64_t *codes;
+} morton_code_job_t;
+
+static void compute_morton_codes(uint32_t begin, uint32_t end, uint32_t slot, void *context)
+{
+    (void)slot;
+    const morton_code_job_t *job = (const morton_code_job_t *)context;
+    for (uint32_t j = begin; j < end; j++)
+    {
+        const uint8_t *pos_ptr = job->positions + ((size_t)job->order[j] * 9);
+        uint32_t cell[3];
+        for (int k = 0; k < 3; k++)
+        {
+            cell[k] = (uint32_t)(((double)decode_spz_position(pos_ptr + 3 * k) - job->lo[k]) * job->to_grid[k]);
+        }
+        job->codes[j] = morton_encode3(cell[0], cell[1], cell[2]);
+    }
+}
+
+// Scratch of order_splats_spatially: the codes, then the radix sort's
+static size_t spatial_sort_scratch_size(uint32_t count)
+{
+    return (size_t)count * sizeof(uint64_t) + morton_sort_scratch_size(count);
+}
 
-#ifdef _OPENMP
-    int num_threads = omp_get_max_threads();
-    print("Using OpenMP with %d threads for parallel processing\n", num_threads);
-#endif
+// Sort the splat list along a Morton curve of the fixed-point positions, so consecutive splats
+// (and therefore each quantization chunk) are spatially close
+static void order_splats_spatially(const uint8_t *positions, uint32_t *order, uint32_t count, void *scratch)
+{
+    uint64_t *codes = (uint64_t *)scratch;
 
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static, 512) if (header->numPoints > 10000)
-#endif
-    for (uint32_t i = 0; i < header->numPoints; i++)
+    int32_t lo[3] = {INT32_MAX, INT32_MAX, INT32_MAX};
+    int32_t hi[3] = {INT32_MIN, INT32_MIN, INT32_MIN};
+    for (uint32_t j = 0; j < count; j++)
     {
-        PackedSplat *splat = &splats[i];
+        const uint8_t *pos_ptr = positions + ((size_t)order[j] * 9);
+        for (int k = 0; k < 3; k++)
+        {
+            int32_t v = decode_spz_position(pos_ptr + 3 * k);
+            lo[k] = v < lo[k] ? v : lo[k];
+            hi[k] = v > hi[k] ? v : hi[k];
+        }
+    }
 
-        // === POSITION ===
-        // Re-parse position (eliminates temp buffer allocation)
-        const uint8_t *pos_ptr = positions + (i * 9);
-        uint32_t pos_x_raw = pos_ptr[0] | (pos_ptr[1] << 8) | (pos_ptr[2] << 16);
-        uint32_t pos_y_raw = pos_ptr[3] | (pos_ptr[4] << 8) | (pos_ptr[5] << 16);
-        uint32_t pos_z_raw = pos_ptr[6] | (pos_ptr[7] << 8) | (pos_ptr[8] << 16);
+    double to_grid[3];
+    for (int k = 0; k < 3; k++)
+    {
+        to_grid[k] = hi[k] > lo[k] ? ((1 << MORTON_BITS) - 1) / ((double)hi[k] - lo[k]) : 0.0;
+    }
+
+    morton_code_job_t job = {.positions = positions, .order = order, .lo = lo, .to_grid = to_grid, .codes = codes};
+    job_parallel_for(count, LOADER_GRAIN, compute_morton_codes, &job);
+
+    morton_sort_with_scratch(codes, order, count, codes + count);
+}
+
+typedef struct
+{
+    const uint8_t *alphas;
+    const uint8_t *scales;
+    float min_alpha;
+    float min_log_scale;
+    uint32_t *range_offsets; // splats kept per range of LOADER_GRAIN, then where each range writes
+    uint32_t *kept;
+    uint32_t removed_opacity[JOB_MAX_THREADS];
+    uint32_t removed_scale[JOB_MAX_THREADS];
+} prune_job_t;
+
+// 0 keeps splat i, 1 removes it for opacity, 2 for scale
+static inline int prune_test(const prune_job_t *job, uint32_t i)
+{
+    if ((float)job->alphas[i] < job->min_alpha)
+    {
+        return 1;
+    }
+    const uint8_t *scale_ptr = job->scales + ((size_t)i * 3);
+    return (float)(scale_ptr[0] > scale_ptr[1] ? scale_ptr[0] : scale_ptr[1]) < job->min_log_scale ? 2 : 0;
+}
+
+static void count_unpruned_splats(uint32_t begin, uint32_t end, uint32_t slot, void *context)
+{
+    prune_job_t *job = (prune_job_t *)context;
+    uint32_t kept = 0;
+    for (uint32_t i = begin; i < end; i++)
+    {
+        int test = prune_test(job, i);
+        job->removed_opacity[slot] += test == 1;
+        job->removed_scale[slot] += test == 2;
+        kept += test == 0;
+    }
+    job->range_offsets[begin / LOADER_GRAIN] = kept;
+}
+
+static void write_unpruned_splats(uint32_t begin, uint32_t end, uint32_t slot, void *context)
+{
+    (void)slot;
+    prune_job_t *job = (prune_job_t *)context;
+    uint32_t out = job->range_offsets[begin / LOADER_GRAIN];
+    for (uint32_t i = begin; i < end; i++)
+    {
+        if (prune_test(job, i) == 0)
+        {
+            job->kept[out++] = i;
+        }
+    }
+}
+
+// Indices of the splats that pass the prune thresholds, NULL when nothing is pruned
+static uint32_t *select_unpruned_splats(const PackedGaussiansHeader *header, const uint8_t *alphas,
+                                        const uint8_t *scales, const spz_prune_options_t *prune,
+                                        spz_prune_stats_t *stats)
+{
+    uint32_t count = header->numPoints;
+    stats->total = count;
+    stats->kept = count;
+    stats->removed_opacity = 0;
+    stats->removed_scale = 0;
+
+    if (!prune || (prune->min_opacity <= 0.0f && prune->min_scale <= 0.0f))
+    {
+        return NULL;
+    }
+
+    uint32_t range_count = (count + LOADER_GRAIN - 1) / LOADER_GRAIN;
+    uint32_t *kept = (uint32_t *)core_malloc(MEMORY_TAG_LOAD, (size_t)count * sizeof(uint32_t));
+    uint32_t *range_offsets = (uint32_t *)core_malloc(MEMORY_TAG_LOAD, (size_t)range_count * sizeof(uint32_t) + 1);
+    if (!kept || !range_offsets)
+    {
+        print("ERROR: Failed to allocate prune list, loading all splats\n");
+        core_free(kept);
+        core_free(range_offsets);
+        return NULL;
+    }
+
+    // Same scale decode as splat.glsl, only x and y span the drawn quad
+    prune_job_t job = {
+        .alphas = alphas,
+        .scales = scales,
+        .min_alpha = prune->min_opacity * 255.0f,
+        .min_log_scale = prune->min_scale > 0.0f ? (logf(prune->min_scale) + 5.0f) * 25.5f : -FLT_MAX,
+        .range_offsets = range_offsets,
+        .kept = kept};
+
+    // Count per range, then each range compacts its survivors into place, keeping stream order
+    job_parallel_for(count, LOADER_GRAIN, count_unpruned_splats, &job);
+    uint32_t kept_count = 0;
+    for (uint32_t r = 0; r < range_count; r++)
+    {
+        uint32_t n = range_offsets[r];
+        range_offsets[r] = kept_count;
+        kept_count += n;
+    }
+    job_parallel_for(count, LOADER_GRAIN, write_unpruned_splats, &job);
+    core_free(range_offsets);
+
+    for (uint32_t s = 0; s < JOB_MAX_THREADS; s++)
+    {
+        stats->removed_opacity += job.removed_opacity[s];
+        stats->removed_scale += job.removed_scale[s];
+    }
+    stats->kept = kept_count;
+    return kept;
+}
+
+typedef struct
+{
+    const uint8_t *alphas;
+    const uint8_t *scales;
+    const uint32_t *order;
+    const float *log_alpha;
+    float to_key;
+    uint16_t *keys;
+} importance_key_job_t;
+
+static void compute_importance_keys(uint32_t begin, uint32_t end, uint32_t slot, void *context)
+{
+    (void)slot;
+    enum { BUCKETS = 65536 };
+    const importance_key_job_t *job = (const importance_key_job_t *)context;
+    for (uint32_t j = begin; j < end; j++)
+    {
+        uint32_t i = job->order[j];
+        const uint8_t *scale_ptr = job->scales + ((size_t)i * 3);
+        float importance = job->log_alpha[job->alphas[i]] + (scale_ptr[0] + scale_ptr[1]) / 25.5f;
+        job->keys[j] = job->alphas[i] == 0 ? BUCKETS - 1 : (uint16_t)(BUCKETS - 2 - (uint32_t)(importance * job->to_key));
+    }
+}
+
+// Most visible first: opacity times quad area, alpha * exp((scale_x + scale_y) / 25.5), compared in log
+// space and bucketed to 16 bits. The counting sort is stable, so equal splats keep their stream order.
+// Keys and the sorted copy come from scratch and are dead once order is written.
+static int order_splats_by_importance(const uint8_t *alphas, const uint8_t *scales, uint32_t *order, uint32_t count,
+                                      arena_t *scratch)
+{
+    enum { BUCKETS = 65536 };
+    uint32_t *offsets = (uint32_t *)arena_alloc(scratch, BUCKETS * sizeof(uint32_t));
+    uint16_t *keys = (uint16_t *)arena_alloc(scratch, (size_t)count * sizeof(uint16_t));
+    uint32_t *sorted = (uint32_t *)arena_alloc(scratch, (size_t)count * sizeof(uint32_t));
+    if (!offsets || !keys || !sorted)
+    {
+        return -1;
+    }
+    memset(offsets, 0, BUCKETS * sizeof(uint32_t));
+
+    // log(alpha) + (scale_x + scale_y) / 25.5 lies in [0, log(255) + 20], 0 is the most important key
+    float log_alpha[256];
+    for (int a = 1; a < 256; a++)
+    {
+        log_alpha[a] = logf((float)a);
+    }
+    importance_key_job_t job = {
+        .alphas = alphas,
+        .scales = scales,
+        .order = order,
+        .log_alpha = log_alpha,
+        .to_key = (BUCKETS - 2) / (logf(255.0f) + 20.0f),
+        .keys = keys};
+    job_parallel_for(count, LOADER_GRAIN, compute_importance_keys, &job);
+
+    for (uint32_t j = 0; j < count; j++)
+    {
+        offsets[keys[j]]++;
+    }
+    uint32_t sum = 0;
+    for (uint32_t k = 0; k < BUCKETS; k++)
+    {
+        uint32_t n = offsets[k];
+        offsets[k] = sum;
+        sum += n;
+    }
+    for (uint32_t j = 0; j < count; j++)
+    {
+        sorted[offsets[keys[j]]++] = order[j];
+    }
+    memcpy(order, sorted, (size_t)count * sizeof(uint32_t));
+    return 0;
+}
 
-        float pos_x = ((int32_t)(pos_x_raw << 8) >> 8) * scale_factor;
-        float pos_y = -((int32_t)(pos_y_raw << 8) >> 8) * scale_factor; // Y-flip inline
-        float pos_z = ((int32_t)(pos_z_raw << 8) >> 8) * scale_factor;
+// Batch ends for importance order: the first batch is 1/SPZ_FIRST_BATCH_FRACTION of the splats rounded up
+// to whole chunks, each next one doubles, so no chunk straddles two batches
+static uint32_t plan_importance_batches(uint32_t count, uint32_t *batch_ends)
+{
+    uint64_t size = ((uint64_t)count / SPZ_FIRST_BATCH_FRACTION + SPLAT_CHUNK_SIZE - 1) / SPLAT_CHUNK_SIZE * SPLAT_CHUNK_SIZE;
+    size = size > SPLAT_CHUNK_SIZE ? size : SPLAT_CHUNK_SIZE;
 
-        // Normalize to [0, 1] range with branchless clamp
-        float normalized_x = clamp_fast((pos_x - min_pos.X) * inv_range_x, 0.0f, 1.0f);
-        float normalized_y = clamp_fast((pos_y - min_pos.Y) * inv_range_y, 0.0f, 1.0f);
-        float normalized_z = clamp_fast((pos_z - min_pos.Z) * inv_range_z, 0.0f, 1.0f);
+    uint32_t batch_count = 0;
+    uint64_t end = 0;
+    while (end < count)
+    {
+        // A remainder under half a batch joins the batch before it
+        end = batch_count + 1 < SPZ_MAX_LOAD_BATCHES && end + size + size / 2 < count ? end + size : count;
+        batch_ends[batch_count++] = (uint32_t)end;
+        size *= 2;
+    }
+    return batch_count;
+}
 
-        // Pack to 16-bit
-        splat->pos_x = (uint16_t)(normalized_x * 65535.0f);
-        splat->pos_y = (uint16_t)(normalized_y * 65535.0f);
-        splat->pos_z = (uint16_t)(normalized_z * 65535.0f);
+typedef struct
+{
+    const uint8_t *positions;
+    uint32_t *order;
+    uint32_t count;
+    void *scratch;
+} spatial_sort_task_t;
 
-        // === ROTATION ===
-        HMM_Quat rotation;
+static void run_spatial_sort(void *context)
+{
+    spatial_sort_task_t *task = (spatial_sort_task_t *)context;
+    order_splats_spatially(task->positions, task->order, task->count, task->scratch);
+}
 
-        if (is_version_3)
+// Importance and spatial order of the kept splats; every buffer besides kept comes from scratch
+static int order_selected_splats(const spz_sections_t *sections, const spz_load_options_t *options, uint32_t *kept,
+                                 uint32_t splat_count, uint32_t *batch_ends, uint32_t *batch_count, arena_t *scratch)
+{
+    // PASS 0b: Importance order, so any batch prefix is a coarse version of the whole scene
+    if (options->importance_order)
+    {
+        arena_mark_t mark = arena_mark(scratch);
+        if (order_splats_by_importance(sections->alphas, sections->scales, kept, splat_count, scratch) != 0)
+        {
+            print("ERROR: Failed to order splats by importance\n");
+            return -1;
+        }
+        *batch_count = plan_importance_batches(splat_count, batch_ends);
+
+        // The spatial sort recycles the importance keys' pages
+        arena_reset(scratch, mark);
+    }
+
+    // PASS 0c: Spatial order within each batch, so each chunk's bounds are tight; the batches are
+    // independent, so they sort side by side, each in its own part of the scratch
+    if (options->spatial_order)
+    {
+        spatial_sort_task_t tasks[SPZ_MAX_LOAD_BATCHES];
+        job_graph_t graph;
+        job_graph_init(&graph);
+        for (uint32_t b = 0; b < *batch_count; b++)
         {
-            // Version 3: 3 components * 10 bits + 2 bits for largest component index
-            const uint8_t *rot_ptr = rotations + (i * 4);
-            uint32_t rot_data = rot_ptr[0] | (rot_ptr[1] << 8) |
-                                (rot_ptr[2] << 16) | (rot_ptr[3] << 24);
-
-            // Extract largest component index (lowest 2 bits)
-            uint8_t largest_idx = rot_data & 0x3;
-            uint32_t comp_data = rot_data >> 2;
-
-            // Decode quaternion components (unrolled for better optimization)
-            float q[4] = {0, 0, 0, 0};
-            int shift = 0;
-            for (int j = 0; j < 4; j++)
+            uint32_t begin = b > 0 ? batch_ends[b - 1] : 0;
+            tasks[b] = (spatial_sort_task_t){
+                .positions = sections->positions,
+                .order = kept + begin,
+                .count = batch_ends[b] - begin,
+                .scratch = arena_alloc(scratch, spatial_sort_scratch_size(batch_ends[b] - begin))};
+            if (!tasks[b].scratch)
             {
-                if (j != largest_idx)
-                {
-                    // Extract 10-bit signed value (range: -512 to 511)
-                    int16_t val = (int16_t)((comp_data >> shift) & 0x3FF) - 512;
-                    q[j] = (float)val * inv_512;
-                    shift += 10;
-                }
+                print("ERROR: Failed to allocate scratch to order splats spatially\n");
+                return -1;
             }
+            job_graph_add(&graph, run_spatial_sort, &tasks[b], NULL, 0);
+        }
+        job_graph_run(&graph);
+    }
+    return 0;
+}
+
+// Prune, then optionally order by importance and spatially; *out_kept is the source point of each splat,
+// NULL for all points in stream order. out_batch_ends (SPZ_MAX_LOAD_BATCHES entries) may be NULL.
+// The sort keys and scratch come from options->scratch, or an arena of this call without one.
+static int select_splats(const spz_sections_t *sections, const spz_load_options_t *options,
+                         uint32_t **out_kept, uint32_t *out_count, uint32_t *out_batch_ends,
+                         uint32_t *out_batch_count, spz_prune_stats_t *out_stats)
+{
+    // PASS 0: Prune before packing so texture, sort and instance counts all shrink
+    spz_prune_stats_t prune_stats;
+    uint32_t *kept = select_unpruned_splats(sections->header, sections->alphas, sections->scales,
+                                            options ? &options->prune : NULL, &prune_stats);
+    uint32_t splat_count = prune_stats.kept;
+    if (kept)
+    {
+        print("Pruned %u of %u splats (%u below opacity, %u below scale)\n",
+              prune_stats.total - splat_count, prune_stats.total,
+              prune_stats.removed_opacity, prune_stats.removed_scale);
+    }
+    if (out_stats)
+    {
+        *out_stats = prune_stats;
+    }
+    if (splat_count == 0)
+    {
+        print("ERROR: No splats left after pruning\n");
+        core_free(kept);
+        return -1;
+    }
+
+    bool importance = options && options->importance_order;
+    bool spatial = options && options->spatial_order;
+    if ((importance || spatial) && !kept)
+    {
+        kept = (uint32_t *)core_malloc(MEMORY_TAG_LOAD, (size_t)splat_count * sizeof(uint32_t));
+        for (uint32_t j = 0; kept && j < splat_count; j++)
+        {
+            kept[j] = j;
+        }
+        if (!kept)
+        {
+            print("ERROR: Failed to allocate splat order\n");
+            return -1;
+        }
+    }
+
+    uint32_t batch_ends[SPZ_MAX_LOAD_BATCHES] = {splat_count};
+    uint32_t batch_count = 1;
+    if (importance || spatial)
+    {
+        arena_t local;
+        arena_init(&local, 0, MEMORY_TAG_LOAD);
+        arena_t *scratch = options->scratch ? options->scratch : &local;
+        arena_mark_t mark = arena_mark(scratch);
+        int result = order_selected_splats(sections, options, kept, splat_count, batch_ends, &batch_count, scratch);
+
+        // Packing allocates the splats next, the sort's pages are not held through it
+        arena_reset(scratch, mark);
+        arena_trim(scratch);
+        arena_free(&local);
+        if (result != 0)
+        {
+            core_free(kept);
+            return -1;
+        }
+    }
+
+    *out_kept = kept;
+    *out_count = splat_count;
+    if (out_batch_ends)
+    {
+        memcpy(out_batch_ends, batch_ends, sizeof(batch_ends));
+        *out_batch_count = batch_count;
+    }
+    return 0;
+}
+
+typedef struct
+{
+    const spz_sections_t *sections;
+    const uint32_t *kept; // NULL for all points in stream order
+    uint32_t splat_count;
+    bool quaternion_layout;
+    PackedSplat *splats;
+    splat_chunk_t *chunks;
+} pack_chunks_job_t;
+
+// Chunks [chunk_begin, chunk_end), each quantized to its own bounds
+static void pack_splat_chunks(uint32_t chunk_begin, uint32_t chunk_end, uint32_t slot, void *context)
+{
+    (void)slot;
+    TRACE_BEGIN("decode");
+    const pack_chunks_job_t *job = (const pack_chunks_job_t *)context;
+    const uint8_t *positions = job->sections->positions;
+    const uint8_t *alphas = job->sections->alphas;
+    const uint8_t *colors = job->sections->colors;
+    const uint8_t *scales = job->sections->scales;
+    const uint8_t *rotations = job->sections->rotations;
+    const uint32_t *kept = job->kept;
+    const uint32_t splat_count = job->splat_count;
+    const bool quaternion_layout = job->quaternion_layout;
+    PackedSplat *splats = job->splats;
+    splat_chunk_t *chunks = job->chunks;
+
+    // Pre-calculate scale factor for fixed-point conversion
+    const float scale_factor = 1.0f / (float)(1 << job->sections->header->fractionalBits);
+
+    // Pre-calculate constants (avoid recomputation in loop)
+    const float inv_pi = 1.0f / HMM_PI;
+    const int is_version_3 = (job->sections->header->version == 3);
+
+    for (uint32_t c = chunk_begin; c < chunk_end; c++)
+    {
+        uint32_t begin = c * SPLAT_CHUNK_SIZE;
+        uint32_t end = begin + SPLAT_CHUNK_SIZE < splat_count ? begin + SPLAT_CHUNK_SIZE : splat_count;
+        HMM_Vec3 chunk_positions[SPLAT_CHUNK_SIZE];
+
+        // PASS 1: Decode positions and the chunk's bounds
+        HMM_Vec3 min_pos = {FLT_MAX, FLT_MAX, FLT_MAX};
+        HMM_Vec3 max_pos = {-FLT_MAX, -FLT_MAX, -FLT_MAX};
+        uint8_t max_scale = 0;
+        for (uint32_t j = begin; j < end; j++)
+        {
+            uint32_t i = kept ? kept[j] : j;
+            const uint8_t *pos_ptr = positions + (i * 9);
 
-            // Calculate largest component to ensure unit quaternion (branchless clamp)
-            float sum_sq = q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3];
-            q[largest_idx] = sqrtf(fmaxf(0.0f, 1.0f - sum_sq));
+            // Extract 24-bit little-endian values
+            uint32_t pos_x_raw = pos_ptr[0] | (pos_ptr[1] << 8) | (pos_ptr[2] << 16);
+            uint32_t pos_y_raw = pos_ptr[3] | (pos_ptr[4] << 8) | (pos_ptr[5] << 16);
+            uint32_t pos_z_raw = pos_ptr[6] | (pos_ptr[7] << 8) | (pos_ptr[8] << 16);
 
-            rotation.X = q[0];
-            rotation.Y = q[1];
-            rotation.Z = q[2];
-            rotation.W = q[3];
+            // Sign extend 24-bit to 32-bit and convert to float
+            HMM_Vec3 pos = HMM_V3(((int32_t)(pos_x_raw << 8) >> 8) * scale_factor,
+                                  -((int32_t)(pos_y_raw << 8) >> 8) * scale_factor, // Y-flip inline
+                                  ((int32_t)(pos_z_raw << 8) >> 8) * scale_factor);
+            chunk_positions[j - begin] = pos;
+
+            // Branchless min/max (compiles to MINSS/MAXSS on x86, optimal on ARM)
+            min_pos.X = fminf(min_pos.X, pos.X);
+            min_pos.Y = fminf(min_pos.Y, pos.Y);
+            min_pos.Z = fminf(min_pos.Z, pos.Z);
+            max_pos.X = fmaxf(max_pos.X, pos.X);
+            max_pos.Y = fmaxf(max_pos.Y, pos.Y);
+            max_pos.Z = fmaxf(max_pos.Z, pos.Z);
+
+            // Only x and y span the drawn quad
+            const uint8_t *scale_ptr = scales + (i * 3);
+            uint8_t quad_scale = scale_ptr[0] > scale_ptr[1] ? scale_ptr[0] : scale_ptr[1];
+            max_scale = quad_scale > max_scale ? quad_scale : max_scale;
         }
-        else // Version 2
+
+        chunks[c].min = min_pos;
+        chunks[c].max = max_pos;
+        chunks[c].extent = 0.5f * expf(max_scale / 25.5f - 5.0f);
+
+        // Pre-calculate inverse range for normalization (hoist division out of loop), flat axes pack to 0
+        HMM_Vec3 range = HMM_Sub(max_pos, min_pos);
+        const float inv_range_x = range.X > 0.0f ? 1.0f / range.X : 0.0f;
+        const float inv_range_y = range.Y > 0.0f ? 1.0f / range.Y : 0.0f;
+        const float inv_range_z = range.Z > 0.0f ? 1.0f / range.Z : 0.0f;
+
+        // PASS 2: Pack
+        for (uint32_t j = begin; j < end; j++)
         {
-            // Version 2: x, y, z components as 8-bit signed integers
-            const uint8_t *rot_ptr = rotations + (i * 3);
-            rotation.X = (float)((int8_t)rot_ptr[0]) * inv_128;
-            rotation.Y = (float)((int8_t)rot_ptr[1]) * inv_128;
-            rotation.Z = (float)((int8_t)rot_ptr[2]) * inv_128;
-
-            // Calculate W component to maintain unit quaternion (branchless)
-            float w_sq = 1.0f - (rotation.X * rotation.X +
-                                 rotation.Y * rotation.Y +
-                                 rotation.Z * rotation.Z);
-            rotation.W = sqrtf(fmaxf(0.0f, w_sq));
+            uint32_t i = kept ? kept[j] : j;
+            PackedSplat *splat = &splats[j];
+
+            // === POSITION ===
+            // Normalize to [0, 1] within the chunk with branchless clamp, round to 16-bit
+            HMM_Vec3 pos = chunk_positions[j - begin];
+            float normalized_x = clamp_fast((pos.X - min_pos.X) * inv_range_x, 0.0f, 1.0f);
+            float normalized_y = clamp_fast((pos.Y - min_pos.Y) * inv_range_y, 0.0f, 1.0f);
+            float normalized_z = clamp_fast((pos.Z - min_pos.Z) * inv_range_z, 0.0f, 1.0f);
+            splat->pos_x = (uint16_t)(normalized_x * 65535.0f + 0.5f);
+            splat->pos_y = (uint16_t)(normalized_y * 65535.0f + 0.5f);
+            splat->pos_z = (uint16_t)(normalized_z * 65535.0f + 0.5f);
+
+            // === SCALE ===
+            // SPZ stores scales in log space, we keep them as-is (direct copy, fastest)
+            const uint8_t *scale_ptr = scales + (i * 3);
+            splat->scale_x = scale_ptr[0];
+            splat->scale_y = scale_ptr[1];
+
+            // === ROTATION ===
+            if (quaternion_layout && is_version_3)
+            {
+                // Already smallest-three, copy the word
+                const uint8_t *rot_ptr = rotations + (i * 4);
+                splat->rot_quat = rot_ptr[0] | (rot_ptr[1] << 8) | (rot_ptr[2] << 16) | ((uint32_t)rot_ptr[3] << 24);
+            }
+            else if (quaternion_layout)
+            {
+                // Integer conversion shared with the decode kernel
+                splat->rot_quat = spz_v2_rotation_to_smallest_three(rotations + (i * 3));
+            }
+            else
+            {
+                HMM_Quat rotation = decode_spz_rotation(rotations, i, is_version_3);
+
+                // q and -q are the same rotation, keep w >= 0 so the angle fits [0, pi]
+                if (rotation.W < 0.0f)
+                {
+                    rotation = HMM_Q(-rotation.X, -rotation.Y, -rotation.Z, -rotation.W);
+                }
+
+                // Convert quaternion to axis-angle representation
+                HMM_Vec3 rot_axis;
+                float rot_angle;
+                quat_to_axis_angle(rotation, &rot_axis, &rot_angle);
+
+                // Encode axis using octahedral mapping
+                HMM_Vec2 oct = octahedral_encode(rot_axis);
+
+                // Branchless clamp and pack rotation data
+                splat->rot_axis_u = (uint8_t)(clamp_fast(oct.X, 0.0f, 1.0f) * 255.0f);
+                splat->rot_axis_v = (uint8_t)(clamp_fast(oct.Y, 0.0f, 1.0f) * 255.0f);
+                splat->rot_angle = (uint8_t)(clamp_fast(rot_angle, 0.0f, HMM_PI) * inv_pi * 255.0f);
+                splat->scale_z = scale_ptr[2];
+            }
+
+            // === COLOR & ALPHA ===
+            const uint8_t *color_ptr = colors + (i * 3);
+            splat->r = color_ptr[0];
+            splat->g = color_ptr[1];
+            splat->b = color_ptr[2];
+            splat->a = alphas[i];
         }
+    }
+    TRACE_END();
+}
 
-        // Convert quaternion to axis-angle representation
-        HMM_Vec3 rot_axis;
-        float rot_angle;
-        quat_to_axis_angle(rotation, &rot_axis, &rot_angle);
+int parse_spz_data_to_splats_with_options(const uint8_t *decompressed_data, size_t decompressed_size,
+                                          const spz_load_options_t *options,
+                                          PackedSplat **out_splats, uint32_t *out_count, BoundingBox *out_bounds,
+                                          splat_chunk_t **out_chunks, spz_prune_stats_t *out_stats)
+{
+    spz_sections_t sections;
+    if (locate_spz_sections(decompressed_data, decompressed_size, &sections) != 0)
+    {
+        return -1;
+    }
+    uint32_t *kept = NULL;
+    uint32_t splat_count = 0;
+    if (select_splats(&sections, options, &kept, &splat_count, NULL, NULL, out_stats) != 0)
+    {
+        return -1;
+    }
 
-        // Encode axis using octahedral mapping
-        HMM_Vec2 oct = octahedral_encode(rot_axis);
+    // Allocate output splats
+    PackedSplat *splats = (PackedSplat *)core_malloc(MEMORY_TAG_SPLATS, splat_count * sizeof(PackedSplat));
+    if (!splats)
+    {
+        print("ERROR: Failed to allocate memory for splats\n");
+        core_free(kept);
+        return -1;
+    }
 
-        // Branchless clamp and pack rotation data
-        splat->rot_axis_u = (uint8_t)(clamp_fast(oct.X, 0.0f, 1.0f) * 255.0f);
-        splat->rot_axis_v = (uint8_t)(clamp_fast(oct.Y, 0.0f, 1.0f) * 255.0f);
-        splat->rot_angle = (uint8_t)(clamp_fast(rot_angle, 0.0f, HMM_PI) * inv_pi * 255.0f);
+    uint32_t chunk_count = splat_chunk_count(splat_count);
+    splat_chunk_t *chunks = (splat_chunk_t *)core_calloc(MEMORY_TAG_SPLATS, chunk_count, sizeof(splat_chunk_t));
+    if (!chunks)
+    {
+        print("ERROR: Failed to allocate memory for %u splat chunks\n", chunk_count);
+        core_free(splats);
+        core_free(kept);
+        return -1;
+    }
 
-        // === SCALE ===
-        // SPZ stores scales in log space, we keep them as-is (direct copy, fastest)
-        const uint8_t *scale_ptr = scales + (i * 3);
-        splat->scale_x = scale_ptr[0];
-        splat->scale_y = scale_ptr[1];
-        splat->scale_z = scale_ptr[2];
+    // Each chunk of SPLAT_CHUNK_SIZE consecutive splats is quantized to its own bounds
+    pack_chunks_job_t job = {
+        .sections = &sections,
+        .kept = kept,
+        .splat_count = splat_count,
+        .quaternion_layout = options && options->layout == SPLAT_LAYOUT_QUATERNION,
+        .splats = splats,
+        .chunks = chunks};
+    job_parallel_for(chunk_count, LOADER_CHUNK_GRAIN, pack_splat_chunks, &job);
 
-        // === COLOR & ALPHA ===
-        const uint8_t *color_ptr = colors + (i * 3);
-        splat->r = color_ptr[0];
-        splat->g = color_ptr[1];
-        splat->b = color_ptr[2];
-        splat->a = alphas[i];
+    // Scene bounds are the union of the chunks
+    HMM_Vec3 min_pos = {FLT_MAX, FLT_MAX, FLT_MAX};
+    HMM_Vec3 max_pos = {-FLT_MAX, -FLT_MAX, -FLT_MAX};
+    for (uint32_t c = 0; c < chunk_count; c++)
+    {
+        min_pos.X = fminf(min_pos.X, chunks[c].min.X);
+        min_pos.Y = fminf(min_pos.Y, chunks[c].min.Y);
+        min_pos.Z = fminf(min_pos.Z, chunks[c].min.Z);
+        max_pos.X = fmaxf(max_pos.X, chunks[c].max.X);
+        max_pos.Y = fmaxf(max_pos.Y, chunks[c].max.Y);
+        max_pos.Z = fmaxf(max_pos.Z, chunks[c].max.Z);
     }
 
+    print("Position bounds (Y flipped): min(%.3f, %.3f, %.3f) max(%.3f, %.3f, %.3f), %u chunks\n",
+          min_pos.X, min_pos.Y, min_pos.Z, max_pos.X, max_pos.Y, max_pos.Z, chunk_count);
+
+    core_free(kept);
+
     // Set output values
     *out_splats = splats;
-    *out_count = header->numPoints;
+    *out_count = splat_count;
+    *out_chunks = chunks;
     out_bounds->min = min_pos;
     out_bounds->max = max_pos;
 
-    print("Successfully parsed %u SPZ splats (parallel optimized)\n", header->numPoints);
+    print("Successfully parsed %u SPZ splats on %u threads\n", splat_count, job_thread_count());
     print("Memory: %.2f MB (SPZ) -> %.2f MB (PackedSplat)\n",
           decompressed_size / (1024.0f * 1024.0f),
-          (header->numPoints * sizeof(PackedSplat)) / (1024.0f * 1024.0f));
+          (splat_count * sizeof(PackedSplat)) / (1024.0f * 1024.0f));
+
+    return 0;
+}
+
+typedef struct
+{
+    const spz_sections_t *sections;
+    spz_decode_plan_t *plan;
+    float scale_factor;
+} plan_bounds_job_t;
+
+// Fixed-point and float bounds of chunks [chunk_begin, chunk_end) of a decode plan
+static void compute_plan_chunk_bounds(uint32_t chunk_begin, uint32_t chunk_end, uint32_t slot, void *context)
+{
+    (void)slot;
+    TRACE_BEGIN("bounds");
+    const plan_bounds_job_t *job = (const plan_bounds_job_t *)context;
+    spz_decode_plan_t *plan = job->plan;
+    for (uint32_t c = chunk_begin; c < chunk_end; c++)
+    {
+        uint32_t begin = c * SPLAT_CHUNK_SIZE;
+        uint32_t end = begin + SPLAT_CHUNK_SIZE < plan->splat_count ? begin + SPLAT_CHUNK_SIZE : plan->splat_count;
+        int32_t lo[3] = {INT32_MAX, INT32_MAX, INT32_MAX};
+        int32_t hi[3] = {INT32_MIN, INT32_MIN, INT32_MIN};
+        uint8_t max_scale = 0;
+        for (uint32_t j = begin; j < end; j++)
+        {
+            uint32_t i = plan->order ? plan->order[j] : j;
+            const uint8_t *pos_ptr = job->sections->positions + ((size_t)i * 9);
+            int32_t v[3] = {decode_spz_position(pos_ptr), -decode_spz_position(pos_ptr + 3),
+                            decode_spz_position(pos_ptr + 6)}; // Y-flip
+            for (int k = 0; k < 3; k++)
+            {
+                lo[k] = v[k] < lo[k] ? v[k] : lo[k];
+                hi[k] = v[k] > hi[k] ? v[k] : hi[k];
+            }
+
+            const uint8_t *scale_ptr = job->sections->scales + ((size_t)i * 3);
+            uint8_t quad_scale = scale_ptr[0] > scale_ptr[1] ? scale_ptr[0] : scale_ptr[1];
+            max_scale = quad_scale > max_scale ? quad_scale : max_scale;
+        }
+
+        int32_t *fixed = &plan->chunk_fixed[(size_t)c * SPZ_DECODE_CHUNK_WORDS];
+        for (int k = 0; k < 3; k++)
+        {
+            fixed[k] = lo[k];
+            fixed[4 + k] = hi[k] - lo[k];
+        }
+        plan->chunks[c].min = HMM_V3(lo[0] * job->scale_factor, lo[1] * job->scale_factor, lo[2] * job->scale_factor);
+        plan->chunks[c].max = HMM_V3(hi[0] * job->scale_factor, hi[1] * job->scale_factor, hi[2] * job->scale_factor);
+        plan->chunks[c].extent = 0.5f * expf(max_scale / 25.5f - 5.0f);
+    }
+    TRACE_END();
+}
+
+int spz_prepare_decode(const uint8_t *decompressed_data, size_t decompressed_size,
+                       const spz_load_options_t *options, spz_decode_plan_t *out_plan,
+                       spz_prune_stats_t *out_stats)
+{
+    spz_sections_t sections;
+    if (locate_spz_sections(decompressed_data, decompressed_size, &sections) != 0)
+    {
+        return -1;
+    }
+
+    spz_decode_plan_t plan = {0};
+    if (select_splats(&sections, options, &plan.order, &plan.splat_count, plan.batch_ends, &plan.batch_count,
+                      out_stats) != 0)
+    {
+        return -1;
+    }
+
+    uint32_t source_count = sections.header->numPoints;
+    size_t rotation_bytes = sections.header->version == 3 ? 4 : 3;
+    plan.planes = sections.positions;
+    plan.planes_size = (size_t)(sections.rotations - sections.positions) + (size_t)source_count * rotation_bytes;
+    plan.positions_offset = 0;
+    plan.alphas_offset = (uint32_t)(sections.alphas - sections.positions);
+    plan.colors_offset = (uint32_t)(sections.colors - sections.positions);
+    plan.scales_offset = (uint32_t)(sections.scales - sections.positions);
+    plan.rotations_offset = (uint32_t)(sections.rotations - sections.positions);
+    plan.version = sections.header->version;
+
+    uint32_t chunk_count = splat_chunk_count(plan.splat_count);
+    plan.chunks = (splat_chunk_t *)core_calloc(MEMORY_TAG_SPLATS, chunk_count, sizeof(splat_chunk_t));
+    plan.chunk_fixed = (int32_t *)core_calloc(MEMORY_TAG_LOAD, (size_t)chunk_count * SPZ_DECODE_CHUNK_WORDS, sizeof(int32_t));
+    if (!plan.chunks || !plan.chunk_fixed)
+    {
+        print("ERROR: Failed to allocate memory for %u splat chunks\n", chunk_count);
+        spz_free_decode_plan(&plan);
+        return -1;
+    }
+
+    // Bounds of the fixed-point positions; scaling by a power of two keeps the float bounds
+    // identical to the ones parse_spz_data_to_splats_with_options computes from decoded floats
+    const float scale_factor = 1.0f / (float)(1 << sections.header->fractionalBits);
+    plan_bounds_job_t bounds_job = {.sections = &sections, .plan = &plan, .scale_factor = scale_factor};
+    job_parallel_for(chunk_count, LOADER_CHUNK_GRAIN, compute_plan_chunk_bounds, &bounds_job);
+
+    plan.bounds.min = HMM_V3(FLT_MAX, FLT_MAX, FLT_MAX);
+    plan.bounds.max = HMM_V3(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+    for (uint32_t c = 0; c < chunk_count; c++)
+    {
+        plan.bounds.min.X = fminf(plan.bounds.min.X, plan.chunks[c].min.X);
+        plan.bounds.min.Y = fminf(plan.bounds.min.Y, plan.chunks[c].min.Y);
+        plan.bounds.min.Z = fminf(plan.bounds.min.Z, plan.chunks[c].min.Z);
+        plan.bounds.max.X = fmaxf(plan.bounds.max.X, plan.chunks[c].max.X);
+        plan.bounds.max.Y = fmaxf(plan.bounds.max.Y, plan.chunks[c].max.Y);
+        plan.bounds.max.Z = fmaxf(plan.bounds.max.Z, plan.chunks[c].max.Z);
+    }
+
+    *out_plan = plan;
+    return 0;
+}
+
+void spz_free_decode_plan(spz_decode_plan_t *plan)
+{
+    core_free(plan->order);
+    core_free(plan->chunk_fixed);
+    core_free(plan->chunks);
+    plan->order = NULL;
+    plan->chunk_fixed = NULL;
+    plan->chunks = NULL;
+}
+
+// round(d * 65535 / range) for 0 <= d <= range <= 2^24 without 64-bit products, as decode.glsl computes it
+static inline uint32_t quantize_chunk_offset(uint32_t d, uint32_t range)
+{
+    if (range == 0)
+    {
+        return 0;
+    }
+
+    // floor(d * 65536 / range) by long division
+    uint32_t q = d >= range ? 1u : 0u;
+    uint32_t r = d - q * range;
+    for (int bit = 0; bit < 16; bit++)
+    {
+        r <<= 1;
+        q <<= 1;
+        if (r >= range)
+        {
+            r -= range;
+            q |= 1u;
+        }
+    }
+
+    // d * 65535 + range / 2 = q * range + (r + range / 2 - d)
+    int32_t t = (int32_t)(r + (range >> 1)) - (int32_t)d;
+    q = t >= 0 ? q + (uint32_t)t / range : q - ((uint32_t)(-t) + range - 1) / range;
+    return q > 65535u ? 65535u : q;
+}
+
+// Splat j of a plan as a SPLAT_LAYOUT_QUATERNION texel and its quantized position
+static inline void decode_plan_splat(const spz_decode_plan_t *plan, uint32_t j, uint32_t *texel, uint32_t *position)
+{
+    uint32_t i = plan->order ? plan->order[j] : j;
+    const int32_t *fixed = &plan->chunk_fixed[(size_t)(j / SPLAT_CHUNK_SIZE) * SPZ_DECODE_CHUNK_WORDS];
+
+    const uint8_t *pos_ptr = plan->planes + plan->positions_offset + (size_t)i * 9;
+    int32_t v[3] = {decode_spz_position(pos_ptr), -decode_spz_position(pos_ptr + 3), decode_spz_position(pos_ptr + 6)};
+    for (int k = 0; k < 3; k++)
+    {
+        position[k] = quantize_chunk_offset((uint32_t)(v[k] - fixed[k]), (uint32_t)fixed[4 + k]);
+    }
+
+    const uint8_t *rot_ptr;
+    uint32_t rotation;
+    if (plan->version == 3)
+    {
+        rot_ptr = plan->planes + plan->rotations_offset + (size_t)i * 4;
+        rotation = rot_ptr[0] | (rot_ptr[1] << 8) | (rot_ptr[2] << 16) | ((uint32_t)rot_ptr[3] << 24);
+    }
+    else
+    {
+        rot_ptr = plan->planes + plan->rotations_offset + (size_t)i * 3;
+        rotation = spz_v2_rotation_to_smallest_three(rot_ptr);
+    }
+
+    const uint8_t *scale_ptr = plan->planes + plan->scales_offset + (size_t)i * 3;
+    const uint8_t *color_ptr = plan->planes + plan->colors_offset + (size_t)i * 3;
+    uint8_t alpha = plan->planes[plan->alphas_offset + i];
+
+    // Same words as convert_splats_to_texture_data
+    texel[0] = (position[0] << 16) | position[1];
+    texel[1] = (position[2] << 16) | (rotation & 0xFFFFu);
+    texel[2] = (((rotation >> 16) & 0xFFu) << 24) | ((uint32_t)scale_ptr[0] << 16) | ((uint32_t)scale_ptr[1] << 8) |
+               (rotation >> 24);
+    texel[3] = ((uint32_t)color_ptr[0] << 24) | ((uint32_t)color_ptr[1] << 16) | ((uint32_t)color_ptr[2] << 8) | alpha;
+}
+
+typedef struct
+{
+    const spz_decode_plan_t *plan;
+    uint32_t *texels;
+    uint32_t *position_words;
+} decode_pairs_job_t;
+
+// One pair per iteration like one decode.glsl thread: two splats fill three position words
+static void decode_splat_pairs(uint32_t pair_begin, uint32_t pair_end, uint32_t slot, void *context)
+{
+    (void)slot;
+    TRACE_BEGIN("decode");
+    const decode_pairs_job_t *job = (const decode_pairs_job_t *)context;
+    const spz_decode_plan_t *plan = job->plan;
+    for (uint32_t pair = pair_begin; pair < pair_end; pair++)
+    {
+        uint32_t a[3];
+        uint32_t b[3] = {0, 0, 0};
+        uint32_t j = pair * 2;
+        decode_plan_splat(plan, j, &job->texels[(size_t)j * 4], a);
+        bool has_b = j + 1 < plan->splat_count;
+        if (has_b)
+        {
+            decode_plan_splat(plan, j + 1, &job->texels[(size_t)(j + 1) * 4], b);
+        }
+
+        uint32_t *words = &job->position_words[(size_t)pair * 3];
+        words[0] = a[0] | (a[1] << 16);
+        words[1] = a[2] | (b[0] << 16);
+        if (has_b)
+        {
+            words[2] = b[1] | (b[2] << 16);
+        }
+    }
+    TRACE_END();
+}
+
+void spz_decode_splats(const spz_decode_plan_t *plan, uint32_t *out_texels, uint32_t *out_position_words)
+{
+    decode_pairs_job_t job = {.plan = plan, .texels = out_texels, .position_words = out_position_words};
+    job_parallel_for((plan->splat_count + 1) / 2, LOADER_GRAIN / 2, decode_splat_pairs, &job);
+}
+
+typedef struct
+{
+    const spz_decode_plan_t *plan;
+    uint32_t first;
+    PackedSplat *splats;
+} decode_range_job_t;
+
+static void decode_splat_range(uint32_t begin, uint32_t end, uint32_t slot, void *context)
+{
+    (void)slot;
+    TRACE_BEGIN("decode");
+    const decode_range_job_t *job = (const decode_range_job_t *)context;
+    for (uint32_t k = begin; k < end; k++)
+    {
+        uint32_t texel[4];
+        uint32_t position[3];
+        decode_plan_splat(job->plan, job->first + k, texel, position);
+
+        PackedSplat *splat = &job->splats[k];
+        splat->pos_x = (uint16_t)position[0];
+        splat->pos_y = (uint16_t)position[1];
+        splat->pos_z = (uint16_t)position[2];
+        splat->scale_x = (uint8_t)(texel[2] >> 16);
+        splat->scale_y = (uint8_t)(texel[2] >> 8);
+        splat->rot_quat = splat_texel_quaternion(texel);
+        splat->r = (uint8_t)(texel[3] >> 24);
+        splat->g = (uint8_t)(texel[3] >> 16);
+        splat->b = (uint8_t)(texel[3] >> 8);
+        splat->a = (uint8_t)texel[3];
+    }
+    TRACE_END();
+}
+
+void spz_decode_splat_range(const spz_decode_plan_t *plan, uint32_t first, uint32_t count, PackedSplat *out_splats)
+{
+    decode_range_job_t job = {.plan = plan, .first = first, .splats = out_splats};
+    job_parallel_for(count, LOADER_GRAIN, decode_splat_range, &job);
+}
+
+typedef struct
+{
+    const spz_sections_t *sections;
+    gaussian_t *gaussians;
+} gaussians_job_t;
+
+// Same conventions as the packed path (Y flipped, scales decoded like splat.glsl), without the 16/8-bit quantization
+static void decode_gaussians(uint32_t begin, uint32_t end, uint32_t slot, void *context)
+{
+    (void)slot;
+    TRACE_BEGIN("decode");
+    const gaussians_job_t *job = (const gaussians_job_t *)context;
+    const spz_sections_t *sections = job->sections;
+    const float scale_factor = 1.0f / (float)(1 << sections->header->fractionalBits);
+    const float inv_255 = 1.0f / 255.0f;
+    const int is_version_3 = (sections->header->version == 3);
+
+    for (uint32_t i = begin; i < end; i++)
+    {
+        const uint8_t *pos_ptr = sections->positions + ((size_t)i * 9);
+        uint32_t pos_x_raw = pos_ptr[0] | (pos_ptr[1] << 8) | (pos_ptr[2] << 16);
+        uint32_t pos_y_raw = pos_ptr[3] | (pos_ptr[4] << 8) | (pos_ptr[5] << 16);
+        uint32_t pos_z_raw = pos_ptr[6] | (pos_ptr[7] << 8) | (pos_ptr[8] << 16);
+
+        gaussian_t *g = &job->gaussians[i];
+        g->position = HMM_V3(((int32_t)(pos_x_raw << 8) >> 8) * scale_factor,
+                             -((int32_t)(pos_y_raw << 8) >> 8) * scale_factor,
+                             ((int32_t)(pos_z_raw << 8) >> 8) * scale_factor);
+        g->rotation = HMM_NormQ(decode_spz_rotation(sections->rotations, i, is_version_3));
+
+        const uint8_t *scale_ptr = sections->scales + ((size_t)i * 3);
+        g->scale = HMM_V3(expf(scale_ptr[0] / 25.5f - 5.0f),
+                          expf(scale_ptr[1] / 25.5f - 5.0f),
+                          expf(scale_ptr[2] / 25.5f - 5.0f));
+
+        const uint8_t *color_ptr = sections->colors + ((size_t)i * 3);
+        g->color = HMM_V4(color_ptr[0] * inv_255, color_ptr[1] * inv_255, color_ptr[2] * inv_255,
+                          sections->alphas[i] * inv_255);
+    }
+    TRACE_END();
+}
+
+int parse_spz_data_to_gaussians(const uint8_t *decompressed_data, size_t decompressed_size,
+                                gaussian_t **out_gaussians, uint32_t *out_count)
+{
+    spz_sections_t sections;
+    if (locate_spz_sections(decompressed_data, decompressed_size, &sections) != 0)
+    {
+        return -1;
+    }
+
+    uint32_t count = sections.header->numPoints;
+    gaussian_t *gaussians = (gaussian_t *)core_malloc(MEMORY_TAG_LOAD, (size_t)count * sizeof(gaussian_t) + 1);
+    if (!gaussians)
+    {
+        print("ERROR: Failed to allocate memory for %u gaussians\n", count);
+        return -1;
+    }
+
+    gaussians_job_t job = {.sections = &sections, .gaussians = gaussians};
+    job_parallel_for(count, LOADER_GRAIN, decode_gaussians, &job);
 
+    *out_gaussians = gaussians;
+    *out_count = count;
     return 0;
 }
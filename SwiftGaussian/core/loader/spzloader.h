@@ -5,6 +5,7 @@
 #include <stddef.h>
 #include "utils/handmademath.h"
 #include "scene.h"
+#include "gaussian.h"
 #include "utils/logger.h"
 
 #ifdef __cplusplus
@@ -33,8 +34,96 @@ extern "C"
         bool success;
     } SPZParseResult;
 
+    // Positions are quantized per chunk of SPLAT_CHUNK_SIZE splats; out_chunks receives the
+    // splat_chunk_count(count) chunk bounds (core_free() when done) and out_bounds their union
     int parse_spz_data_to_splats(const uint8_t *decompressed_data, size_t decompressed_size,
-                                 PackedSplat **out_splats, uint32_t *out_count, BoundingBox *out_bounds);
+                                 PackedSplat **out_splats, uint32_t *out_count, BoundingBox *out_bounds,
+                                 splat_chunk_t **out_chunks);
+
+    // Same as parse_spz_data_to_splats, dropping splats below the prune thresholds before packing
+    // (bounds are computed from the kept splats only) and optionally reordering the kept splats
+    // spatially. Without spatial order splat i keeps the stream order. options and out_stats may be NULL.
+    int parse_spz_data_to_splats_with_options(const uint8_t *decompressed_data, size_t decompressed_size,
+                                              const spz_load_options_t *options,
+                                              PackedSplat **out_splats, uint32_t *out_count, BoundingBox *out_bounds,
+                                              splat_chunk_t **out_chunks, spz_prune_stats_t *out_stats);
+
+    // Decode every point to world-space floats (no bounds quantization), for offline processing
+    int parse_spz_data_to_gaussians(const uint8_t *decompressed_data, size_t decompressed_size,
+                                    gaussian_t **out_gaussians, uint32_t *out_count);
+
+    // Most importance batches of a plan: the first holds 1/SPZ_FIRST_BATCH_FRACTION of the splats, each next one doubles
+#define SPZ_MAX_LOAD_BATCHES 16
+#define SPZ_FIRST_BATCH_FRACTION 32
+
+    // Integer chunk bounds of a decode plan: min x, min -y, min z, 0, then the range of each axis, 0
+#define SPZ_DECODE_CHUNK_WORDS 8
+
+    // Everything a per-splat SPZ decode needs besides the splat itself: the raw attribute planes as
+    // stored, the prune and spatial order result as a source index per splat, and the chunk bounds in
+    // fixed point. Decoding splat j then only reads its own bytes, which is what the GPU decode does.
+    typedef struct
+    {
+        const uint8_t *planes; // positions through rotations of the SPZ stream, points into the caller's data
+        size_t planes_size;
+        uint32_t positions_offset; // byte offset of each section within planes
+        uint32_t alphas_offset;
+        uint32_t colors_offset;
+        uint32_t scales_offset;
+        uint32_t rotations_offset;
+        uint32_t version;
+        uint32_t splat_count;
+        uint32_t *order;            // source point of each splat, NULL for stream order
+        int32_t *chunk_fixed;       // SPZ_DECODE_CHUNK_WORDS per chunk, in the stream's fixed point
+        splat_chunk_t *chunks;      // the same bounds as floats, identical to the CPU parse
+        BoundingBox bounds;
+
+        // End of each importance batch, a multiple of SPLAT_CHUNK_SIZE except the last (splat_count);
+        // a single batch without importance_order
+        uint32_t batch_ends[SPZ_MAX_LOAD_BATCHES];
+        uint32_t batch_count;
+    } spz_decode_plan_t;
+
+    /**
+     * Prune, spatially order and bound the splats of an SPZ stream without decoding them
+     * Only alphas, scales and positions are read, as integers. The plan keeps pointers into
+     * decompressed_data, which must outlive it.
+     *
+     * @param decompressed_data Decompressed SPZ stream
+     * @param decompressed_size Size of the stream in bytes
+     * @param options Prune and order options, may be NULL (the layout is ignored, decoding produces SPLAT_LAYOUT_QUATERNION)
+     * @param out_plan Filled plan, release with spz_free_decode_plan
+     * @param out_stats Optional prune statistics, may be NULL
+     * @return 0 on success, -1 on failure
+     */
+    int spz_prepare_decode(const uint8_t *decompressed_data, size_t decompressed_size,
+                           const spz_load_options_t *options, spz_decode_plan_t *out_plan,
+                           spz_prune_stats_t *out_stats);
+
+    /**
+     * CPU version of the decode.glsl kernel, bit-exact with it: integer math only
+     * Writes SPLAT_LAYOUT_QUATERNION texels and the position stream of every splat. Positions are
+     * rounded to the nearest of 65536 steps across the chunk; version 2 rotations are converted to
+     * smallest-three without renormalizing. Both can differ from the float parse by one step.
+     *
+     * @param plan Plan from spz_prepare_decode
+     * @param out_texels 4 words per splat
+     * @param out_position_words splat_position_words(splat_count) words, see convert_splats_to_position_data
+     */
+    void spz_decode_splats(const spz_decode_plan_t *plan, uint32_t *out_texels, uint32_t *out_position_words);
+
+    /**
+     * Decode splats [first, first + count) of a plan into PackedSplats, the texels spz_decode_splats writes
+     *
+     * @param plan Plan from spz_prepare_decode
+     * @param first First splat to decode
+     * @param count Number of splats, first + count <= splat_count
+     * @param out_splats count SPLAT_LAYOUT_QUATERNION splats
+     */
+    void spz_decode_splat_range(const spz_decode_plan_t *plan, uint32_t first, uint32_t count, PackedSplat *out_splats);
+
+    // Frees order, chunk_fixed and chunks; chunks may be taken over first and set to NULL
+    void spz_free_decode_plan(spz_decode_plan_t *plan);
 
     // Optimized: Parse SPZ data directly to texture format (eliminates intermediate PackedSplat array)
     int parse_spz_data_to_texture(const uint8_t *decompressed_data, size_t decompressed_size,
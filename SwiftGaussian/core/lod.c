@@ -0,0 +1,559 @@
+#include "lod.h"
+#include "gaussian.h"
+#include "utils/core_memory.h"
+#include "utils/jobs.h"
+#include "utils/logger.h"
+#include "utils/morton.h"
+#include "utils/timer.h"
+#include <float.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Morton codes have 16 bits per axis, so the octree is at most 16 levels deep
+#define LOD_MAX_LEVEL MORTON_BITS
+
+typedef struct
+{
+    float size; // projected radius in pixels
+    uint32_t node;
+} lod_heap_entry_t;
+
+typedef struct
+{
+    lod_node_t *nodes;
+    uint32_t node_count;
+    uint32_t node_capacity;
+    const uint64_t *codes;
+} lod_builder_t;
+
+// Positions are only chunk-relative, so codes come from world positions on a grid over the scene bounds
+static inline uint64_t morton_code(HMM_Vec3 position, HMM_Vec3 grid_min, HMM_Vec3 grid_scale)
+{
+    uint32_t x = (uint32_t)fminf(fmaxf((position.X - grid_min.X) * grid_scale.X, 0.0f), 65535.0f);
+    uint32_t y = (uint32_t)fminf(fmaxf((position.Y - grid_min.Y) * grid_scale.Y, 0.0f), 65535.0f);
+    uint32_t z = (uint32_t)fminf(fmaxf((position.Z - grid_min.Z) * grid_scale.Z, 0.0f), 65535.0f);
+    return morton_encode3(x, y, z);
+}
+
+static inline float grid_axis_scale(float size)
+{
+    return size > 0.0f ? 65535.0f / size : 0.0f;
+}
+
+static uint32_t alloc_nodes(lod_builder_t *builder, uint32_t count)
+{
+    if (builder->node_count + count > builder->node_capacity)
+    {
+        uint32_t capacity = builder->node_capacity * 2;
+        while (capacity < builder->node_count + count)
+        {
+            capacity *= 2;
+        }
+        lod_node_t *nodes = (lod_node_t *)core_realloc(MEMORY_TAG_LOD, builder->nodes, (size_t)capacity * sizeof(lod_node_t));
+        if (!nodes)
+        {
+            return LOD_INVALID_INDEX;
+        }
+        builder->nodes = nodes;
+        builder->node_capacity = capacity;
+    }
+
+    uint32_t first = builder->node_count;
+    memset(&builder->nodes[first], 0, (size_t)count * sizeof(lod_node_t));
+    builder->node_count += count;
+    return first;
+}
+
+// Split [begin, end) of the Morton-sorted splats into octants; single-octant levels are skipped
+static int build_node(lod_builder_t *builder, uint32_t node, uint32_t begin, uint32_t end, int level)
+{
+    builder->nodes[node].splat_count = end - begin;
+    builder->nodes[node].merged_splat = LOD_INVALID_INDEX;
+
+    uint32_t bounds[9];
+    int child_count = 0;
+    while (end - begin > LOD_LEAF_SIZE && level < LOD_MAX_LEVEL)
+    {
+        int shift = 3 * (LOD_MAX_LEVEL - 1 - level);
+        child_count = 0;
+        uint32_t i = begin;
+        while (i < end)
+        {
+            uint64_t digit = (builder->codes[i] >> shift) & 7;
+            bounds[child_count++] = i;
+            while (i < end && ((builder->codes[i] >> shift) & 7) == digit)
+            {
+                i++;
+            }
+        }
+        bounds[child_count] = end;
+        level++;
+
+        if (child_count > 1)
+        {
+            break;
+        }
+    }
+
+    // Small enough, or all splats share one quantized position
+    if (child_count <= 1)
+    {
+        builder->nodes[node].first_splat = begin;
+        return 0;
+    }
+
+    uint32_t first_child = alloc_nodes(builder, (uint32_t)child_count);
+    if (first_child == LOD_INVALID_INDEX)
+    {
+        return -1;
+    }
+    builder->nodes[node].first_child = first_child;
+    builder->nodes[node].child_count = (uint32_t)child_count;
+
+    for (int c = 0; c < child_count; c++)
+    {
+        if (build_node(builder, first_child + c, bounds[c], bounds[c + 1], level) != 0)
+        {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+typedef struct
+{
+    const PackedSplat *splats;
+    const splat_chunk_t *chunks;
+    splat_layout_t layout;
+    HMM_Vec3 grid_min;
+    HMM_Vec3 grid_scale;
+    uint64_t *codes;
+    uint32_t *order;
+    const lod_node_t *nodes;
+    gaussian_moments_t *moments;
+    HMM_Vec3 *box_min;
+    HMM_Vec3 *box_max;
+    float *extent;
+} lod_build_job_t;
+
+static void compute_lod_codes(uint32_t begin, uint32_t end, uint32_t slot, void *context)
+{
+    (void)slot;
+    const lod_build_job_t *job = (const lod_build_job_t *)context;
+    for (uint32_t i = begin; i < end; i++)
+    {
+        const PackedSplat *splat = &job->splats[i];
+        HMM_Vec3 position = splat_chunk_position(&job->chunks[i / SPLAT_CHUNK_SIZE], splat->pos_x, splat->pos_y, splat->pos_z);
+        job->codes[i] = morton_code(position, job->grid_min, job->grid_scale);
+        job->order[i] = i;
+    }
+}
+
+// Moments and bounds of the leaves among nodes [begin, end); leaves vary in size, so the ranges are small
+static void summarize_lod_leaves(uint32_t begin, uint32_t end, uint32_t slot, void *context)
+{
+    (void)slot;
+    const lod_build_job_t *job = (const lod_build_job_t *)context;
+    const lod_node_t *nodes = job->nodes;
+    for (uint32_t n = begin; n < end; n++)
+    {
+        if (nodes[n].child_count > 0)
+        {
+            continue;
+        }
+        HMM_Vec3 lo = HMM_V3(FLT_MAX, FLT_MAX, FLT_MAX);
+        HMM_Vec3 hi = HMM_V3(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+        for (uint32_t i = 0; i < nodes[n].splat_count; i++)
+        {
+            uint32_t splat = job->order[nodes[n].first_splat + i];
+            gaussian_t g;
+            unpack_gaussian(&job->splats[splat], &job->chunks[splat / SPLAT_CHUNK_SIZE], job->layout, &g);
+            gaussian_moments_add(&job->moments[n], &g);
+            lo = HMM_V3(fminf(lo.X, g.position.X), fminf(lo.Y, g.position.Y), fminf(lo.Z, g.position.Z));
+            hi = HMM_V3(fmaxf(hi.X, g.position.X), fmaxf(hi.Y, g.position.Y), fmaxf(hi.Z, g.position.Z));
+            // The drawn disc reaches half the quad, see splat.glsl
+            job->extent[n] = fmaxf(job->extent[n], 0.5f * fmaxf(g.scale.X, g.scale.Y));
+        }
+        job->box_min[n] = lo;
+        job->box_max[n] = hi;
+    }
+}
+
+int lod_build(const PackedSplat *splats, uint32_t count, const splat_chunk_t *chunks, splat_layout_t layout,
+              lod_tree_t *out_tree)
+{
+    memset(out_tree, 0, sizeof(*out_tree));
+    if (!splats || count == 0 || !chunks)
+    {
+        return -1;
+    }
+
+    double start_time = time_now_ms();
+
+    uint64_t *codes = (uint64_t *)core_malloc(MEMORY_TAG_LOD, (size_t)count * sizeof(uint64_t));
+    uint32_t *order = (uint32_t *)core_malloc(MEMORY_TAG_LOD, (size_t)count * sizeof(uint32_t));
+    if (!codes || !order)
+    {
+        print("ERROR: Failed to allocate LOD build buffers for %u splats\n", count);
+        core_free(codes);
+        core_free(order);
+        return -1;
+    }
+
+    HMM_Vec3 grid_min = HMM_V3(FLT_MAX, FLT_MAX, FLT_MAX);
+    HMM_Vec3 grid_max = HMM_V3(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+    for (uint32_t c = 0; c < splat_chunk_count(count); c++)
+    {
+        grid_min = HMM_V3(fminf(grid_min.X, chunks[c].min.X), fminf(grid_min.Y, chunks[c].min.Y), fminf(grid_min.Z, chunks[c].min.Z));
+        grid_max = HMM_V3(fmaxf(grid_max.X, chunks[c].max.X), fmaxf(grid_max.Y, chunks[c].max.Y), fmaxf(grid_max.Z, chunks[c].max.Z));
+    }
+    HMM_Vec3 grid_size = HMM_Sub(grid_max, grid_min);
+    HMM_Vec3 grid_scale = HMM_V3(grid_axis_scale(grid_size.X), grid_axis_scale(grid_size.Y), grid_axis_scale(grid_size.Z));
+
+    lod_build_job_t job = {
+        .splats = splats,
+        .chunks = chunks,
+        .layout = layout,
+        .grid_min = grid_min,
+        .grid_scale = grid_scale,
+        .codes = codes,
+        .order = order};
+    job_parallel_for(count, 4096, compute_lod_codes, &job);
+
+    if (morton_sort(codes, order, count) != 0)
+    {
+        print("ERROR: Failed to sort splats for LOD build\n");
+        core_free(codes);
+        core_free(order);
+        return -1;
+    }
+
+    // STEP 1: Topology
+    lod_builder_t builder = {.node_capacity = 1024, .codes = codes};
+    builder.nodes = (lod_node_t *)core_malloc(MEMORY_TAG_LOD, builder.node_capacity * sizeof(lod_node_t));
+    if (!builder.nodes || alloc_nodes(&builder, 1) == LOD_INVALID_INDEX ||
+        build_node(&builder, 0, 0, count, 0) != 0)
+    {
+        print("ERROR: Failed to build LOD octree\n");
+        core_free(builder.nodes);
+        core_free(codes);
+        core_free(order);
+        return -1;
+    }
+    core_free(codes);
+
+    uint32_t node_count = builder.node_count;
+    lod_node_t *nodes = builder.nodes;
+
+    // STEP 2: Moments and bounds, leaves first, then inner nodes bottom-up (children follow parents)
+    gaussian_moments_t *moments = (gaussian_moments_t *)core_calloc(MEMORY_TAG_LOD, node_count, sizeof(gaussian_moments_t));
+    HMM_Vec3 *box_min = (HMM_Vec3 *)core_malloc(MEMORY_TAG_LOD, (size_t)node_count * sizeof(HMM_Vec3));
+    HMM_Vec3 *box_max = (HMM_Vec3 *)core_malloc(MEMORY_TAG_LOD, (size_t)node_count * sizeof(HMM_Vec3));
+    float *extent = (float *)core_calloc(MEMORY_TAG_LOD, node_count, sizeof(float));
+    uint32_t *merged_slot = (uint32_t *)core_malloc(MEMORY_TAG_LOD, (size_t)node_count * sizeof(uint32_t));
+    if (!moments || !box_min || !box_max || !extent || !merged_slot)
+    {
+        print("ERROR: Failed to allocate LOD node data\n");
+        core_free(moments);
+        core_free(box_min);
+        core_free(box_max);
+        core_free(extent);
+        core_free(merged_slot);
+        core_free(nodes);
+        core_free(order);
+        return -1;
+    }
+
+    uint32_t merged_count = 0;
+    for (uint32_t n = 0; n < node_count; n++)
+    {
+        merged_slot[n] = nodes[n].child_count > 0 ? merged_count++ : LOD_INVALID_INDEX;
+    }
+
+    job.nodes = nodes;
+    job.moments = moments;
+    job.box_min = box_min;
+    job.box_max = box_max;
+    job.extent = extent;
+    job_parallel_for(node_count, 64, summarize_lod_leaves, &job);
+
+    // Merged splats start on a chunk boundary so they get chunks of their own
+    uint32_t merged_base = splat_chunk_count(count) * SPLAT_CHUNK_SIZE;
+    uint32_t merged_alloc = merged_count > 0 ? merged_count : 1;
+    gaussian_t *parents = (gaussian_t *)core_malloc(MEMORY_TAG_LOD, (size_t)merged_alloc * sizeof(gaussian_t));
+    PackedSplat *merged = (PackedSplat *)core_malloc(MEMORY_TAG_LOD, (size_t)merged_alloc * sizeof(PackedSplat));
+    splat_chunk_t *merged_chunks = (splat_chunk_t *)core_malloc(MEMORY_TAG_LOD, (size_t)splat_chunk_count(merged_alloc) * sizeof(splat_chunk_t));
+    if (!parents || !merged || !merged_chunks)
+    {
+        print("ERROR: Failed to allocate %u merged splats\n", merged_count);
+        core_free(parents);
+        core_free(merged);
+        core_free(merged_chunks);
+        core_free(moments);
+        core_free(box_min);
+        core_free(box_max);
+        core_free(extent);
+        core_free(merged_slot);
+        core_free(nodes);
+        core_free(order);
+        return -1;
+    }
+
+    for (uint32_t n = node_count; n-- > 0;)
+    {
+        lod_node_t *node = &nodes[n];
+        if (node->child_count > 0)
+        {
+            box_min[n] = HMM_V3(FLT_MAX, FLT_MAX, FLT_MAX);
+            box_max[n] = HMM_V3(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+            for (uint32_t c = node->first_child; c < node->first_child + node->child_count; c++)
+            {
+                gaussian_moments_merge(&moments[n], &moments[c]);
+                box_min[n] = HMM_V3(fminf(box_min[n].X, box_min[c].X), fminf(box_min[n].Y, box_min[c].Y), fminf(box_min[n].Z, box_min[c].Z));
+                box_max[n] = HMM_V3(fmaxf(box_max[n].X, box_max[c].X), fmaxf(box_max[n].Y, box_max[c].Y), fmaxf(box_max[n].Z, box_max[c].Z));
+                extent[n] = fmaxf(extent[n], extent[c]);
+            }
+
+            gaussian_t *parent = &parents[merged_slot[n]];
+            gaussian_moments_resolve(&moments[n], parent);
+            node->merged_splat = merged_base + merged_slot[n];
+            extent[n] = fmaxf(extent[n], 0.5f * fmaxf(parent->scale.X, parent->scale.Y));
+        }
+
+        node->center = HMM_MulV3F(HMM_Add(box_min[n], box_max[n]), 0.5f);
+        node->radius = 0.5f * HMM_LenV3(HMM_Sub(box_max[n], box_min[n])) + extent[n];
+    }
+
+    pack_gaussians_chunked(parents, merged_count, layout, merged, merged_chunks);
+    core_free(parents);
+
+    core_free(moments);
+    core_free(box_min);
+    core_free(box_max);
+    core_free(extent);
+    core_free(merged_slot);
+
+    out_tree->nodes = nodes;
+    out_tree->node_count = node_count;
+    out_tree->leaf_splats = order;
+    out_tree->source_count = count;
+    out_tree->merged_splats = merged;
+    out_tree->merged_chunks = merged_chunks;
+    out_tree->merged_base = merged_base;
+    out_tree->merged_count = merged_count;
+    out_tree->scratch = core_malloc(MEMORY_TAG_LOD, (size_t)node_count * sizeof(lod_heap_entry_t));
+    if (!out_tree->scratch)
+    {
+        lod_free(out_tree);
+        return -1;
+    }
+
+    print("LOD: %u nodes, %u merged splats for %u splats in %.1f ms\n",
+          node_count, merged_count, count, time_now_ms() - start_time);
+    return 0;
+}
+
+static void heap_push(lod_heap_entry_t *heap, uint32_t *size, lod_heap_entry_t entry)
+{
+    uint32_t i = (*size)++;
+    while (i > 0)
+    {
+        uint32_t parent = (i - 1) / 2;
+        if (heap[parent].size >= entry.size)
+        {
+            break;
+        }
+        heap[i] = heap[parent];
+        i = parent;
+    }
+    heap[i] = entry;
+}
+
+static lod_heap_entry_t heap_pop(lod_heap_entry_t *heap, uint32_t *size)
+{
+    lod_heap_entry_t top = heap[0];
+    lod_heap_entry_t last = heap[--(*size)];
+    uint32_t i = 0;
+    for (;;)
+    {
+        uint32_t child = 2 * i + 1;
+        if (child >= *size)
+        {
+            break;
+        }
+        if (child + 1 < *size && heap[child + 1].size > heap[child].size)
+        {
+            child++;
+        }
+        if (last.size >= heap[child].size)
+        {
+            break;
+        }
+        heap[i] = heap[child];
+        i = child;
+    }
+    if (*size > 0)
+    {
+        heap[i] = last;
+    }
+    return top;
+}
+
+typedef struct
+{
+    HMM_Vec4 planes[5]; // left, right, bottom, top, near
+    HMM_Vec3 camera_pos;
+    float focal_px;
+} lod_view_t;
+
+// Projected radius in pixels, FLT_MAX when the camera is inside the node; negative when culled
+static float node_screen_size(const lod_view_t *view, const lod_node_t *node)
+{
+    for (int p = 0; p < 5; p++)
+    {
+        HMM_Vec4 plane = view->planes[p];
+        float d = plane.X * node->center.X + plane.Y * node->center.Y + plane.Z * node->center.Z + plane.W;
+        if (d < -node->radius)
+        {
+            return -1.0f;
+        }
+    }
+
+    float distance = HMM_LenV3(HMM_Sub(node->center, view->camera_pos));
+    if (distance <= node->radius)
+    {
+        return FLT_MAX;
+    }
+    return node->radius * view->focal_px / distance;
+}
+
+static inline uint32_t node_cost(const lod_node_t *node)
+{
+    return node->child_count > 0 ? 1 : node->splat_count;
+}
+
+static uint32_t emit_node(const lod_tree_t *tree, const lod_node_t *node, uint32_t *out, uint32_t written,
+                          lod_select_stats_t *stats)
+{
+    if (node->child_count > 0)
+    {
+        out[written] = node->merged_splat;
+        stats->merged_selected++;
+        return written + 1;
+    }
+    memcpy(&out[written], &tree->leaf_splats[node->first_splat], node->splat_count * sizeof(uint32_t));
+    return written + node->splat_count;
+}
+
+uint32_t lod_select(lod_tree_t *tree, Camera *camera, int width, int height,
+                    const lod_select_params_t *params, uint32_t *out_indices, lod_select_stats_t *out_stats)
+{
+    lod_select_stats_t stats = {0};
+    if (!tree || !tree->nodes || !camera || !params || !out_indices || width <= 0 || height <= 0)
+    {
+        if (out_stats)
+        {
+            *out_stats = stats;
+        }
+        return 0;
+    }
+
+    double start_time = time_now_ms();
+
+    // Same matrices as the depth pass
+    float aspect_ratio = (float)width / (float)height;
+    HMM_Mat4 projection = camera_get_projection_matrix(camera, aspect_ratio);
+    lod_view_t view = {.camera_pos = camera->position, .focal_px = 0.5f * (float)height * fabsf(projection.Elements[1][1])};
+    camera_get_frustum_planes(camera, aspect_ratio, view.planes);
+
+    lod_heap_entry_t *heap = (lod_heap_entry_t *)tree->scratch;
+    uint32_t heap_size = 0;
+    uint32_t written = 0;
+    uint32_t budget = params->splat_budget > 0 ? params->splat_budget : UINT32_MAX;
+
+    float root_size = node_screen_size(&view, &tree->nodes[0]);
+    stats.nodes_visited = 1;
+    uint64_t cost = 0;
+    if (root_size >= 0.0f)
+    {
+        heap_push(heap, &heap_size, (lod_heap_entry_t){root_size, 0});
+        cost = node_cost(&tree->nodes[0]);
+    }
+    else
+    {
+        stats.nodes_culled = 1;
+    }
+
+    while (heap_size > 0)
+    {
+        lod_heap_entry_t entry = heap_pop(heap, &heap_size);
+        const lod_node_t *node = &tree->nodes[entry.node];
+
+        if (node->child_count == 0 || entry.size <= params->pixel_threshold)
+        {
+            written = emit_node(tree, node, out_indices, written, &stats);
+            continue;
+        }
+
+        // Cost of replacing this node by its visible children
+        uint64_t children_cost = 0;
+        float sizes[8];
+        for (uint32_t c = 0; c < node->child_count; c++)
+        {
+            const lod_node_t *child = &tree->nodes[node->first_child + c];
+            sizes[c] = node_screen_size(&view, child);
+            if (sizes[c] >= 0.0f)
+            {
+                children_cost += node_cost(child);
+            }
+        }
+
+        if (cost - 1 + children_cost > budget)
+        {
+            written = emit_node(tree, node, out_indices, written, &stats);
+            continue;
+        }
+
+        cost = cost - 1 + children_cost;
+        stats.nodes_visited += node->child_count;
+        for (uint32_t c = 0; c < node->child_count; c++)
+        {
+            if (sizes[c] >= 0.0f)
+            {
+                heap_push(heap, &heap_size, (lod_heap_entry_t){sizes[c], node->first_child + c});
+            }
+            else
+            {
+                stats.nodes_culled++;
+            }
+        }
+    }
+
+    stats.selected = written;
+    stats.select_ms = time_now_ms() - start_time;
+    if (out_stats)
+    {
+        *out_stats = stats;
+    }
+    return written;
+}
+
+uint32_t lod_max_selection(const lod_tree_t *tree)
+{
+    return tree ? tree->source_count + tree->merged_count : 0;
+}
+
+void lod_free(lod_tree_t *tree)
+{
+    if (!tree)
+    {
+        return;
+    }
+    core_free(tree->nodes);
+    core_free(tree->leaf_splats);
+    core_free(tree->merged_splats);
+    core_free(tree->merged_chunks);
+    core_free(tree->scratch);
+    memset(tree, 0, sizeof(*tree));
+}
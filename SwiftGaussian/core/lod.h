@@ -0,0 +1,107 @@
+#ifndef LOD_H
+#define LOD_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "camera.h"
+#include "scene.h"
+#include "splat_texture.h"
+#include "utils/handmademath.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// Nodes with at most this many splats become leaves
+#define LOD_LEAF_SIZE 64
+#define LOD_INVALID_INDEX UINT32_MAX
+
+// Nodes smaller than this on screen (radius in pixels) are drawn as their merged parent
+#define LOD_DEFAULT_PIXEL_THRESHOLD 2.0f
+
+    typedef struct
+    {
+        HMM_Vec3 center;
+        float radius;          // bounding sphere of the node's splats, including their extent
+        uint32_t first_child;  // children are stored contiguously
+        uint32_t child_count;  // 0 for leaves
+        uint32_t first_splat;  // leaves: start of their range in lod_tree_t.leaf_splats
+        uint32_t splat_count;  // source splats below this node
+        uint32_t merged_splat; // splat index of the merged parent, LOD_INVALID_INDEX for leaves
+    } lod_node_t;
+
+    typedef struct
+    {
+        lod_node_t *nodes; // nodes[0] is the root, children always follow their parent
+        uint32_t node_count;
+
+        uint32_t *leaf_splats; // source splat indices grouped by leaf
+        uint32_t source_count;
+
+        // One moment-matched splat per inner node, addressed as merged_base + i; merged_base is
+        // source_count rounded up to SPLAT_CHUNK_SIZE so the merged splats have chunks of their own
+        PackedSplat *merged_splats;
+        splat_chunk_t *merged_chunks; // splat_chunk_count(merged_count) entries
+        uint32_t merged_base;
+        uint32_t merged_count;
+
+        void *scratch; // traversal heap, one entry per node
+    } lod_tree_t;
+
+    typedef struct
+    {
+        float pixel_threshold; // nodes whose projected radius is above this many pixels are refined
+        uint32_t splat_budget; // upper bound on selected splats, 0 for none
+    } lod_select_params_t;
+
+    typedef struct
+    {
+        uint32_t selected;        // splats in the cut
+        uint32_t merged_selected; // of which merged parents
+        uint32_t nodes_visited;
+        uint32_t nodes_culled; // outside the view frustum
+        double select_ms;
+    } lod_select_stats_t;
+
+    /**
+     * Build the LOD octree over the splats (Morton order of their world positions)
+     * Inner nodes get a merged parent Gaussian: moment-matched mean and covariance,
+     * weighted color, and the opacity that preserves the children's opacity * area.
+     *
+     * @param splats Source splats
+     * @param count Number of source splats
+     * @param chunks Chunk bounds used to quantize the positions
+     * @param layout Rotation encoding of the source splats, the merged ones are packed the same way
+     * @param out_tree Tree to fill, release with lod_free
+     * @return 0 on success, -1 on failure
+     */
+    int lod_build(const PackedSplat *splats, uint32_t count, const splat_chunk_t *chunks, splat_layout_t layout,
+                  lod_tree_t *out_tree);
+
+    /**
+     * Pick the cut for one view: nodes are refined largest projected size first until they
+     * fall below the pixel threshold or refining would exceed the splat budget
+     *
+     * @param tree Tree from lod_build
+     * @param camera View to select for
+     * @param width Viewport width in pixels
+     * @param height Viewport height in pixels
+     * @param params Threshold and budget
+     * @param out_indices Splat indices of the cut, needs lod_max_selection(tree) entries
+     * @param out_stats Optional, may be NULL
+     * @return Number of indices written
+     */
+    uint32_t lod_select(lod_tree_t *tree, Camera *camera, int width, int height,
+                        const lod_select_params_t *params, uint32_t *out_indices, lod_select_stats_t *out_stats);
+
+    // Source plus merged splats, the most lod_select can return
+    uint32_t lod_max_selection(const lod_tree_t *tree);
+
+    void lod_free(lod_tree_t *tree);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LOD_H
@@ -0,0 +1,606 @@
+#include "offscreen.h"
+#include "scene.h"
+#include "utils/core_memory.h"
+#include "utils/logger.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+
+#if defined(SOKOL_METAL)
+#import <Metal/Metal.h>
+#elif defined(SOKOL_GLES3)
+#include <GLES3/gl3.h>
+#endif
+
+typedef struct
+{
+    int width;
+    int height;
+    int sample_count;
+    sg_pixel_format color_format;
+    sg_pixel_format depth_format;
+
+    // Formats and sample count follow the environment defaults so the splat pipeline can draw into them
+    sg_image color_image;   // multisampled when sample_count > 1
+    sg_image resolve_image; // only with MSAA
+    sg_image depth_image;   // only when the environment has a depth format
+    sg_view color_view;
+    sg_view resolve_view;
+    sg_view depth_view;
+
+    // Request currently owning the target
+    uint32_t ticket;
+    render_image_status_t status;
+    uint8_t *out_rgba;
+    uint64_t submit_commit;
+    size_t readback_bytes; // native readback buffer, counted under MEMORY_TAG_RENDER
+
+#if defined(SOKOL_METAL)
+    const void *staging_buffer;  // id<MTLBuffer>, shared storage, retained
+    const void *blit_cmd_buffer; // id<MTLCommandBuffer>, retained while in flight
+    atomic_bool blit_done;
+    bool blit_issued;
+#elif defined(SOKOL_GLES3)
+    GLuint framebuffer;
+    GLuint pixel_buffer;
+    GLsync fence;
+#endif
+} offscreen_target_t;
+
+static struct
+{
+    // Requests rotate through the ring so several readbacks can be in flight
+    offscreen_target_t targets[OFFSCREEN_RING_SIZE];
+    uint32_t next_slot;
+    uint32_t next_ticket;
+    uint64_t commit_count;
+    bool commit_listener_installed;
+#if defined(SOKOL_METAL)
+    const void *cmd_queue; // id<MTLCommandQueue>, retained
+#endif
+} g_offscreen_state = {0};
+
+static void on_commit(void *user_data)
+{
+    (void)user_data;
+    g_offscreen_state.commit_count++;
+}
+
+static bool gpu_readback_supported(void)
+{
+#if defined(SOKOL_METAL) || defined(SOKOL_GLES3)
+    return is_scene_gpu_backed();
+#else
+    return false;
+#endif
+}
+
+static void destroy_target_images(offscreen_target_t *target)
+{
+    sg_view views[3] = {target->color_view, target->resolve_view, target->depth_view};
+    sg_image images[3] = {target->color_image, target->resolve_image, target->depth_image};
+    for (int i = 0; i < 3; i++)
+    {
+        if (views[i].id != SG_INVALID_ID)
+        {
+            sg_destroy_view(views[i]);
+        }
+        if (images[i].id != SG_INVALID_ID)
+        {
+            core_destroy_image(MEMORY_TAG_RENDER, images[i]);
+        }
+    }
+    target->color_view.id = target->resolve_view.id = target->depth_view.id = SG_INVALID_ID;
+    target->color_image.id = target->resolve_image.id = target->depth_image.id = SG_INVALID_ID;
+
+#if defined(SOKOL_METAL)
+    if (target->staging_buffer)
+    {
+        CFBridgingRelease(target->staging_buffer);
+        target->staging_buffer = NULL;
+        core_memory_track_gpu(MEMORY_TAG_RENDER, -(int64_t)target->readback_bytes);
+        target->readback_bytes = 0;
+    }
+#endif
+
+    target->width = 0;
+    target->height = 0;
+}
+
+static bool ensure_target(offscreen_target_t *target, int width, int height)
+{
+    if (target->width == width && target->height == height && target->color_image.id != SG_INVALID_ID)
+    {
+        return true;
+    }
+
+    destroy_target_images(target);
+
+    sg_environment_defaults defaults = sg_query_desc().environment.defaults;
+    target->color_format = defaults.color_format;
+    target->depth_format = defaults.depth_format;
+    target->sample_count = defaults.sample_count > 0 ? defaults.sample_count : 1;
+
+    target->color_image = core_make_image(MEMORY_TAG_RENDER, &(sg_image_desc){
+        .usage = {.color_attachment = true},
+        .width = width,
+        .height = height,
+        .pixel_format = target->color_format,
+        .sample_count = target->sample_count,
+        .label = "offscreen-color"});
+    target->color_view = sg_make_view(&(sg_view_desc){
+        .color_attachment = {.image = target->color_image},
+        .label = "offscreen-color-view"});
+
+    if (target->sample_count > 1)
+    {
+        target->resolve_image = core_make_image(MEMORY_TAG_RENDER, &(sg_image_desc){
+            .usage = {.resolve_attachment = true},
+            .width = width,
+            .height = height,
+            .pixel_format = target->color_format,
+            .sample_count = 1,
+            .label = "offscreen-resolve"});
+        target->resolve_view = sg_make_view(&(sg_view_desc){
+            .resolve_attachment = {.image = target->resolve_image},
+            .label = "offscreen-resolve-view"});
+    }
+
+    if (target->depth_format != SG_PIXELFORMAT_NONE)
+    {
+        target->depth_image = core_make_image(MEMORY_TAG_RENDER, &(sg_image_desc){
+            .usage = {.depth_stencil_attachment = true},
+            .width = width,
+            .height = height,
+            .pixel_format = target->depth_format,
+            .sample_count = target->sample_count,
+            .label = "offscreen-depth"});
+        target->depth_view = sg_make_view(&(sg_view_desc){
+            .depth_stencil_attachment = {.image = target->depth_image},
+            .label = "offscreen-depth-view"});
+    }
+
+    size_t size = (size_t)width * height * 4;
+
+#if defined(SOKOL_METAL)
+    id<MTLDevice> device = (__bridge id<MTLDevice>)sg_mtl_device();
+    if (!g_offscreen_state.cmd_queue)
+    {
+        // Readback blits go on their own queue, they are only issued once sokol's frame has completed
+        g_offscreen_state.cmd_queue = CFBridgingRetain([device newCommandQueue]);
+    }
+    target->staging_buffer = CFBridgingRetain([device newBufferWithLength:size options:MTLResourceStorageModeShared]);
+    if (target->staging_buffer)
+    {
+        target->readback_bytes = size;
+        core_memory_track_gpu(MEMORY_TAG_RENDER, (int64_t)size);
+    }
+#elif defined(SOKOL_GLES3)
+    if (target->framebuffer == 0)
+    {
+        glGenFramebuffers(1, &target->framebuffer);
+        glGenBuffers(1, &target->pixel_buffer);
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, target->pixel_buffer);
+    glBufferData(GL_PIXEL_PACK_BUFFER, (GLsizeiptr)size, NULL, GL_STREAM_READ);
+    core_memory_track_gpu(MEMORY_TAG_RENDER, (int64_t)size - (int64_t)target->readback_bytes);
+    target->readback_bytes = size;
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    sg_reset_state_cache();
+#else
+    (void)size;
+#endif
+
+    if (sg_query_image_state(target->color_image) != SG_RESOURCESTATE_VALID)
+    {
+        print("ERROR: Failed to create %dx%d offscreen target\n", width, height);
+        destroy_target_images(target);
+        return false;
+    }
+
+    target->width = width;
+    target->height = height;
+    return true;
+}
+
+static sg_attachments target_attachments(const offscreen_target_t *target)
+{
+    return (sg_attachments){
+        .colors[0] = target->color_view,
+        .resolves[0] = target->resolve_view,
+        .depth_stencil = target->depth_view};
+}
+
+#if defined(SOKOL_METAL) || defined(SOKOL_GLES3)
+static sg_image readback_source(const offscreen_target_t *target)
+{
+    return target->sample_count > 1 ? target->resolve_image : target->color_image;
+}
+
+// Submit an empty frame so sokol retires the frames still in flight
+static void flush_frame(const offscreen_target_t *target)
+{
+    sg_begin_pass(&(sg_pass){
+        .action = {
+            .colors[0] = {.load_action = SG_LOADACTION_LOAD},
+            .depth = {.load_action = SG_LOADACTION_DONTCARE}},
+        .attachments = target_attachments(target),
+        .label = "offscreen-flush-pass"});
+    sg_end_pass();
+    sg_commit();
+}
+
+static void copy_pixels(offscreen_target_t *target, const uint8_t *src, bool flip_rows)
+{
+    size_t row_bytes = (size_t)target->width * 4;
+    bool swap_rb = target->color_format == SG_PIXELFORMAT_BGRA8;
+
+    for (int y = 0; y < target->height; y++)
+    {
+        const uint8_t *src_row = src + (size_t)(flip_rows ? target->height - 1 - y : y) * row_bytes;
+        uint8_t *dst_row = target->out_rgba + (size_t)y * row_bytes;
+        if (!swap_rb)
+        {
+            memcpy(dst_row, src_row, row_bytes);
+            continue;
+        }
+        for (int x = 0; x < target->width; x++)
+        {
+            dst_row[x * 4 + 0] = src_row[x * 4 + 2];
+            dst_row[x * 4 + 1] = src_row[x * 4 + 1];
+            dst_row[x * 4 + 2] = src_row[x * 4 + 0];
+            dst_row[x * 4 + 3] = src_row[x * 4 + 3];
+        }
+    }
+}
+
+#endif
+
+#if defined(SOKOL_METAL)
+static void readback_begin(offscreen_target_t *target)
+{
+    target->blit_issued = false;
+    atomic_store(&target->blit_done, false);
+}
+
+static void issue_blit(offscreen_target_t *target)
+{
+    sg_mtl_image_info info = sg_mtl_query_image_info(readback_source(target));
+    id<MTLTexture> texture = (__bridge id<MTLTexture>)info.tex[info.active_slot];
+    id<MTLBuffer> staging = (__bridge id<MTLBuffer>)target->staging_buffer;
+    id<MTLCommandQueue> queue = (__bridge id<MTLCommandQueue>)g_offscreen_state.cmd_queue;
+
+    id<MTLCommandBuffer> cmd_buffer = [queue commandBuffer];
+    id<MTLBlitCommandEncoder> blit = [cmd_buffer blitCommandEncoder];
+    [blit copyFromTexture:texture
+                     sourceSlice:0
+                     sourceLevel:0
+                    sourceOrigin:MTLOriginMake(0, 0, 0)
+                      sourceSize:MTLSizeMake(target->width, target->height, 1)
+                        toBuffer:staging
+               destinationOffset:0
+          destinationBytesPerRow:(NSUInteger)target->width * 4
+        destinationBytesPerImage:(NSUInteger)target->width * target->height * 4];
+    [blit endEncoding];
+
+    atomic_bool *done = &target->blit_done;
+    [cmd_buffer addCompletedHandler:^(id<MTLCommandBuffer> buffer) {
+        (void)buffer;
+        atomic_store(done, true);
+    }];
+    [cmd_buffer commit];
+
+    target->blit_cmd_buffer = CFBridgingRetain(cmd_buffer);
+    target->blit_issued = true;
+}
+
+static void readback_finish(offscreen_target_t *target)
+{
+    id<MTLBuffer> staging = (__bridge id<MTLBuffer>)target->staging_buffer;
+    copy_pixels(target, (const uint8_t *)[staging contents], false);
+    CFBridgingRelease(target->blit_cmd_buffer);
+    target->blit_cmd_buffer = NULL;
+    target->status = RENDER_IMAGE_READY;
+}
+
+static void readback_poll(offscreen_target_t *target, bool block)
+{
+    // sokol has no completion callback; like its own resource release it treats a
+    // frame as finished once SG_NUM_INFLIGHT_FRAMES + 1 further frames were committed
+    while (!target->blit_issued)
+    {
+        if (g_offscreen_state.commit_count >= target->submit_commit + SG_NUM_INFLIGHT_FRAMES + 1)
+        {
+            issue_blit(target);
+        }
+        else if (block)
+        {
+            flush_frame(target);
+        }
+        else
+        {
+            return;
+        }
+    }
+
+    if (block && !atomic_load(&target->blit_done))
+    {
+        [(__bridge id<MTLCommandBuffer>)target->blit_cmd_buffer waitUntilCompleted];
+    }
+
+    if (atomic_load(&target->blit_done))
+    {
+        readback_finish(target);
+    }
+}
+
+static void release_readback_objects(offscreen_target_t *target)
+{
+    if (target->blit_cmd_buffer)
+    {
+        [(__bridge id<MTLCommandBuffer>)target->blit_cmd_buffer waitUntilCompleted];
+        CFBridgingRelease(target->blit_cmd_buffer);
+        target->blit_cmd_buffer = NULL;
+    }
+}
+
+#elif defined(SOKOL_GLES3)
+static void readback_begin(offscreen_target_t *target)
+{
+    sg_gl_image_info info = sg_gl_query_image_info(readback_source(target));
+
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, target->framebuffer);
+    glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, info.tex[info.active_slot], 0);
+
+#if defined(EMSCRIPTEN)
+    // WebGL2 cannot map pixel buffers, read straight into the caller's buffer
+    glReadPixels(0, 0, target->width, target->height, GL_RGBA, GL_UNSIGNED_BYTE, target->out_rgba);
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+    sg_reset_state_cache();
+
+    // Rows come back bottom-up
+    size_t row_bytes = (size_t)target->width * 4;
+    uint8_t *tmp = (uint8_t *)core_malloc(MEMORY_TAG_RENDER, row_bytes);
+    if (tmp)
+    {
+        for (int y = 0; y < target->height / 2; y++)
+        {
+            uint8_t *top = target->out_rgba + (size_t)y * row_bytes;
+            uint8_t *bottom = target->out_rgba + (size_t)(target->height - 1 - y) * row_bytes;
+            memcpy(tmp, top, row_bytes);
+            memcpy(top, bottom, row_bytes);
+            memcpy(bottom, tmp, row_bytes);
+        }
+        core_free(tmp);
+    }
+    target->fence = 0;
+    target->status = RENDER_IMAGE_READY;
+#else
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, target->pixel_buffer);
+    glReadPixels(0, 0, target->width, target->height, GL_RGBA, GL_UNSIGNED_BYTE, 0);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+
+    target->fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    glFlush();
+    sg_reset_state_cache();
+#endif
+}
+
+static void readback_poll(offscreen_target_t *target, bool block)
+{
+    if (!target->fence)
+    {
+        return;
+    }
+
+    GLuint64 timeout = block ? 1000000000ull : 0;
+    GLenum result;
+    do
+    {
+        result = glClientWaitSync(target->fence, GL_SYNC_FLUSH_COMMANDS_BIT, timeout);
+    } while (block && result == GL_TIMEOUT_EXPIRED);
+
+    if (result == GL_WAIT_FAILED)
+    {
+        glDeleteSync(target->fence);
+        target->fence = 0;
+        target->status = RENDER_IMAGE_FAILED;
+        return;
+    }
+    if (result == GL_TIMEOUT_EXPIRED)
+    {
+        return;
+    }
+
+    glDeleteSync(target->fence);
+    target->fence = 0;
+
+    size_t size = (size_t)target->width * target->height * 4;
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, target->pixel_buffer);
+    const uint8_t *pixels = (const uint8_t *)glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, (GLsizeiptr)size, GL_MAP_READ_BIT);
+    if (pixels)
+    {
+        // GL rows come back bottom-up
+        copy_pixels(target, pixels, true);
+        glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+        target->status = RENDER_IMAGE_READY;
+    }
+    else
+    {
+        target->status = RENDER_IMAGE_FAILED;
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    sg_reset_state_cache();
+}
+
+static void release_readback_objects(offscreen_target_t *target)
+{
+    if (target->fence)
+    {
+        glDeleteSync(target->fence);
+        target->fence = 0;
+    }
+    if (target->framebuffer)
+    {
+        glDeleteFramebuffers(1, &target->framebuffer);
+        glDeleteBuffers(1, &target->pixel_buffer);
+        target->framebuffer = 0;
+        target->pixel_buffer = 0;
+        core_memory_track_gpu(MEMORY_TAG_RENDER, -(int64_t)target->readback_bytes);
+        target->readback_bytes = 0;
+    }
+    sg_reset_state_cache();
+}
+
+#else
+// No native readback on this backend, requests are served by the CPU renderer
+static void readback_begin(offscreen_target_t *target)
+{
+    target->status = RENDER_IMAGE_FAILED;
+}
+
+static void readback_poll(offscreen_target_t *target, bool block)
+{
+    (void)target;
+    (void)block;
+}
+
+static void release_readback_objects(offscreen_target_t *target)
+{
+    (void)target;
+}
+#endif
+
+static offscreen_target_t *find_target(uint32_t ticket)
+{
+    if (ticket == 0)
+    {
+        return NULL;
+    }
+    for (int i = 0; i < OFFSCREEN_RING_SIZE; i++)
+    {
+        if (g_offscreen_state.targets[i].ticket == ticket)
+        {
+            return &g_offscreen_state.targets[i];
+        }
+    }
+    return NULL;
+}
+
+uint32_t render_to_image(Camera *camera, int width, int height, uint8_t *out_rgba)
+{
+    if (!is_scene_initialized() || !out_rgba || width <= 0 || height <= 0)
+    {
+        return 0;
+    }
+
+    offscreen_target_t *target = &g_offscreen_state.targets[g_offscreen_state.next_slot];
+    g_offscreen_state.next_slot = (g_offscreen_state.next_slot + 1) % OFFSCREEN_RING_SIZE;
+
+    // The ring wrapped around, the oldest request has to finish before its target is reused
+    if (target->status == RENDER_IMAGE_PENDING)
+    {
+        render_image_wait(target->ticket);
+    }
+
+    if (++g_offscreen_state.next_ticket == 0)
+    {
+        g_offscreen_state.next_ticket = 1;
+    }
+    target->ticket = g_offscreen_state.next_ticket;
+    target->out_rgba = out_rgba;
+
+    if (!gpu_readback_supported())
+    {
+        int result = render_scene_cpu(camera, width, height, out_rgba, NULL);
+        target->status = result == 0 ? RENDER_IMAGE_READY : RENDER_IMAGE_FAILED;
+        return target->ticket;
+    }
+
+    if (!g_offscreen_state.commit_listener_installed)
+    {
+        g_offscreen_state.commit_listener_installed = sg_add_commit_listener((sg_commit_listener){.func = on_commit});
+    }
+
+    if (!ensure_target(target, width, height) ||
+        !render_scene_offscreen(camera, target_attachments(target), width, height))
+    {
+        target->status = RENDER_IMAGE_FAILED;
+        return target->ticket;
+    }
+
+    target->submit_commit = g_offscreen_state.commit_count;
+    target->status = RENDER_IMAGE_PENDING;
+    readback_begin(target);
+
+    return target->ticket;
+}
+
+render_image_status_t render_image_status(uint32_t ticket)
+{
+    offscreen_target_t *target = find_target(ticket);
+    if (!target)
+    {
+        return RENDER_IMAGE_INVALID;
+    }
+
+    if (target->status == RENDER_IMAGE_PENDING)
+    {
+        readback_poll(target, false);
+    }
+    return target->status;
+}
+
+render_image_status_t render_image_wait(uint32_t ticket)
+{
+    offscreen_target_t *target = find_target(ticket);
+    if (!target)
+    {
+        return RENDER_IMAGE_INVALID;
+    }
+
+    if (target->status == RENDER_IMAGE_PENDING)
+    {
+        readback_poll(target, true);
+    }
+    return target->status;
+}
+
+void cleanup_offscreen(void)
+{
+    if (!sg_isvalid())
+    {
+        memset(g_offscreen_state.targets, 0, sizeof(g_offscreen_state.targets));
+        return;
+    }
+
+    for (int i = 0; i < OFFSCREEN_RING_SIZE; i++)
+    {
+        offscreen_target_t *target = &g_offscreen_state.targets[i];
+        if (target->status == RENDER_IMAGE_PENDING)
+        {
+            render_image_wait(target->ticket);
+        }
+
+        release_readback_objects(target);
+        destroy_target_images(target);
+        target->status = RENDER_IMAGE_INVALID;
+        target->ticket = 0;
+    }
+    g_offscreen_state.next_slot = 0;
+
+#if defined(SOKOL_METAL)
+    if (g_offscreen_state.cmd_queue)
+    {
+        CFBridgingRelease(g_offscreen_state.cmd_queue);
+        g_offscreen_state.cmd_queue = NULL;
+    }
+#endif
+
+    if (g_offscreen_state.commit_listener_installed)
+    {
+        sg_remove_commit_listener((sg_commit_listener){.func = on_commit});
+        g_offscreen_state.commit_listener_installed = false;
+    }
+}
@@ -0,0 +1,54 @@
+#ifndef OFFSCREEN_H
+#define OFFSCREEN_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "camera.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// Offscreen targets (and staging buffers) cycled by render_to_image; this many readbacks can be pending at once
+#define OFFSCREEN_RING_SIZE 3
+
+    typedef enum
+    {
+        RENDER_IMAGE_INVALID = 0, // unknown or superseded ticket
+        RENDER_IMAGE_PENDING,     // rendered, readback still in flight
+        RENDER_IMAGE_READY,       // pixels are in the caller's buffer
+        RENDER_IMAGE_FAILED,
+    } render_image_status_t;
+
+    /**
+     * Render the scene into an offscreen image and read it back asynchronously
+     * Uses an offscreen sg_image attachment on Metal and GLES3; headless builds
+     * (no sokol setup or the dummy backend) render on the CPU and complete immediately.
+     *
+     * Consecutive requests rotate through OFFSCREEN_RING_SIZE targets, so a new view can be
+     * drawn while earlier readbacks are still in flight; the oldest request is waited on
+     * when the ring wraps around.
+     *
+     * @param camera Camera to render from, NULL for the interactive scene camera
+     * @param width Image width in pixels
+     * @param height Image height in pixels
+     * @param out_rgba Destination of width * height * 4 bytes (RGBA8, top row first),
+     *                 must stay valid until the request is READY or FAILED
+     * @return Ticket for render_image_status / render_image_wait, 0 on failure
+     */
+    uint32_t render_to_image(Camera *camera, int width, int height, uint8_t *out_rgba);
+
+    // Non-blocking: advances the readback and reports its state
+    render_image_status_t render_image_status(uint32_t ticket);
+
+    // Blocks until the readback completes, submitting empty frames if the GPU needs them
+    render_image_status_t render_image_wait(uint32_t ticket);
+
+    void cleanup_offscreen(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // OFFSCREEN_H
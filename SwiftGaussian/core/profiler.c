@@ -0,0 +1,243 @@
+#include "profiler.h"
+#include "sokol/sokol_gfx.h"
+#include "utils/timer.h"
+#include <math.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+
+// Ring of the last PROFILER_HISTORY samples
+typedef struct
+{
+    double values[PROFILER_HISTORY];
+    uint32_t next;
+    uint32_t count;
+} profile_history_t;
+
+static struct
+{
+    pthread_mutex_t mutex; // the histories and the last frame; load stages end on the loading thread
+    atomic_bool disabled;
+
+    // Render stages of the frame in progress, render thread only
+    double pending_ms[PROFILE_STAGE_COUNT];
+    bool pending[PROFILE_STAGE_COUNT];
+
+    profile_history_t stages[PROFILE_STAGE_COUNT];
+    profile_history_t counters[PROFILE_COUNTER_COUNT];
+    profile_frame_t last_frame;
+} g_profiler_state = {.mutex = PTHREAD_MUTEX_INITIALIZER};
+
+static bool is_render_stage(profile_stage_t stage)
+{
+    return stage < PROFILE_STAGE_INFLATE;
+}
+
+static void push_sample(profile_history_t *history, double value)
+{
+    history->values[history->next] = value;
+    history->next = (history->next + 1) % PROFILER_HISTORY;
+    if (history->count < PROFILER_HISTORY)
+    {
+        history->count++;
+    }
+}
+
+void profiler_set_enabled(bool enabled)
+{
+    atomic_store(&g_profiler_state.disabled, !enabled);
+    if (sg_isvalid())
+    {
+        if (enabled)
+        {
+            sg_enable_frame_stats();
+        }
+        else
+        {
+            sg_disable_frame_stats();
+        }
+    }
+}
+
+bool profiler_enabled(void)
+{
+    return !atomic_load(&g_profiler_state.disabled);
+}
+
+profile_scope_t profile_begin(profile_stage_t stage)
+{
+    return (profile_scope_t){
+        .stage = stage,
+        .start_ms = profiler_enabled() ? time_now_ms() : 0.0};
+}
+
+void profile_end(profile_scope_t scope)
+{
+    if (scope.start_ms > 0.0)
+    {
+        profile_record(scope.stage, time_now_ms() - scope.start_ms);
+    }
+}
+
+void profile_record(profile_stage_t stage, double ms)
+{
+    if (!profiler_enabled())
+    {
+        return;
+    }
+    if (is_render_stage(stage))
+    {
+        g_profiler_state.pending_ms[stage] += ms;
+        g_profiler_state.pending[stage] = true;
+        return;
+    }
+    pthread_mutex_lock(&g_profiler_state.mutex);
+    push_sample(&g_profiler_state.stages[stage], ms);
+    pthread_mutex_unlock(&g_profiler_state.mutex);
+}
+
+void profiler_end_frame(bool gpu)
+{
+    if (!profiler_enabled())
+    {
+        return;
+    }
+
+    // sg_commit moved the counters of the frame it submitted to sg_query_frame_stats
+    profile_frame_t frame = {.gpu = gpu && sg_isvalid() && sg_frame_stats_enabled()};
+    if (frame.gpu)
+    {
+        sg_frame_stats stats = sg_query_frame_stats();
+        frame.counters[PROFILE_COUNTER_PASSES] = stats.num_passes;
+        frame.counters[PROFILE_COUNTER_DISPATCHES] = stats.num_dispatch;
+        frame.counters[PROFILE_COUNTER_DRAWS] = stats.num_draw;
+        frame.counters[PROFILE_COUNTER_PIPELINES] = stats.num_apply_pipeline;
+        frame.counters[PROFILE_COUNTER_BINDINGS] = stats.num_apply_bindings;
+        frame.counters[PROFILE_COUNTER_UNIFORM_UPDATES] = stats.num_apply_uniforms;
+        frame.counters[PROFILE_COUNTER_UNIFORM_BYTES] = stats.size_apply_uniforms;
+        frame.counters[PROFILE_COUNTER_BUFFER_UPDATES] = stats.num_update_buffer + stats.num_append_buffer;
+        frame.counters[PROFILE_COUNTER_BUFFER_BYTES] = stats.size_update_buffer + stats.size_append_buffer;
+    }
+
+    pthread_mutex_lock(&g_profiler_state.mutex);
+    for (int stage = 0; stage < PROFILE_STAGE_COUNT; stage++)
+    {
+        if (g_profiler_state.pending[stage])
+        {
+            frame.stage_ms[stage] = g_profiler_state.pending_ms[stage];
+            push_sample(&g_profiler_state.stages[stage], frame.stage_ms[stage]);
+        }
+    }
+    if (frame.gpu)
+    {
+        for (int counter = 0; counter < PROFILE_COUNTER_COUNT; counter++)
+        {
+            push_sample(&g_profiler_state.counters[counter], frame.counters[counter]);
+        }
+    }
+    frame.frame = g_profiler_state.last_frame.frame + 1;
+    g_profiler_state.last_frame = frame;
+    pthread_mutex_unlock(&g_profiler_state.mutex);
+
+    for (int stage = 0; stage < PROFILE_STAGE_COUNT; stage++)
+    {
+        g_profiler_state.pending_ms[stage] = 0.0;
+        g_profiler_state.pending[stage] = false;
+    }
+}
+
+static int compare_doubles(const void *a, const void *b)
+{
+    double x = *(const double *)a;
+    double y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+// Nearest rank of sorted values
+static double percentile(const double *sorted, uint32_t count, double fraction)
+{
+    uint32_t rank = (uint32_t)ceil(fraction * count);
+    return sorted[rank > 0 ? rank - 1 : 0];
+}
+
+static profile_summary_t summarize(const profile_history_t *history)
+{
+    double sorted[PROFILER_HISTORY];
+    pthread_mutex_lock(&g_profiler_state.mutex);
+    uint32_t count = history->count;
+    double last = history->values[(history->next + PROFILER_HISTORY - 1) % PROFILER_HISTORY];
+    for (uint32_t i = 0; i < count; i++)
+    {
+        sorted[i] = history->values[i];
+    }
+    pthread_mutex_unlock(&g_profiler_state.mutex);
+
+    if (count == 0)
+    {
+        return (profile_summary_t){0};
+    }
+    qsort(sorted, count, sizeof(double), compare_doubles);
+    double sum = 0.0;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        sum += sorted[i];
+    }
+    return (profile_summary_t){
+        .samples = count,
+        .last = last,
+        .mean = sum / count,
+        .min = sorted[0],
+        .p50 = percentile(sorted, count, 0.50),
+        .p90 = percentile(sorted, count, 0.90),
+        .p99 = percentile(sorted, count, 0.99),
+        .max = sorted[count - 1]};
+}
+
+profile_summary_t profiler_stage_summary(profile_stage_t stage)
+{
+    return stage < PROFILE_STAGE_COUNT ? summarize(&g_profiler_state.stages[stage]) : (profile_summary_t){0};
+}
+
+profile_summary_t profiler_counter_summary(profile_counter_t counter)
+{
+    return counter < PROFILE_COUNTER_COUNT ? summarize(&g_profiler_state.counters[counter])
+                                           : (profile_summary_t){0};
+}
+
+profile_frame_t profiler_last_frame(void)
+{
+    pthread_mutex_lock(&g_profiler_state.mutex);
+    profile_frame_t frame = g_profiler_state.last_frame;
+    pthread_mutex_unlock(&g_profiler_state.mutex);
+    return frame;
+}
+
+void profiler_reset(void)
+{
+    pthread_mutex_lock(&g_profiler_state.mutex);
+    for (int stage = 0; stage < PROFILE_STAGE_COUNT; stage++)
+    {
+        g_profiler_state.stages[stage] = (profile_history_t){0};
+    }
+    for (int counter = 0; counter < PROFILE_COUNTER_COUNT; counter++)
+    {
+        g_profiler_state.counters[counter] = (profile_history_t){0};
+    }
+    g_profiler_state.last_frame = (profile_frame_t){0};
+    pthread_mutex_unlock(&g_profiler_state.mutex);
+}
+
+const char *profile_stage_name(profile_stage_t stage)
+{
+    static const char *names[PROFILE_STAGE_COUNT] = {"frame", "uploads", "uniforms", "sort", "draw",
+                                                     "cpu render", "inflate", "prepare", "lod", "apply"};
+    return stage < PROFILE_STAGE_COUNT ? names[stage] : "unknown";
+}
+
+const char *profile_counter_name(profile_counter_t counter)
+{
+    static const char *names[PROFILE_COUNTER_COUNT] = {"passes", "dispatches", "draws", "pipelines", "bindings",
+                                                       "uniform updates", "uniform bytes", "buffer updates",
+                                                       "buffer bytes"};
+    return counter < PROFILE_COUNTER_COUNT ? names[counter] : "unknown";
+}
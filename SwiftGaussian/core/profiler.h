@@ -0,0 +1,110 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// Frames and loads kept per stage for the summaries, about four seconds at 60 fps
+#define PROFILER_HISTORY 240
+
+    // CPU time of the render and load stages; render stages add up over a frame, load stages are one sample each
+    typedef enum
+    {
+        PROFILE_STAGE_FRAME,      // render_scene, render_scene_offscreen or render_scene_cpu as a whole
+        PROFILE_STAGE_UPLOADS,    // budgeted upload drain and the next progressive batch
+        PROFILE_STAGE_UNIFORMS,   // matrices, uniform block and bindings of the draw
+        PROFILE_STAGE_SORT,       // dispatch_compute_sort: selection, depth pass and bitonic dispatches
+        PROFILE_STAGE_DRAW,       // render pass and commit
+        PROFILE_STAGE_CPU_RENDER, // cpu_render_splats
+        PROFILE_STAGE_INFLATE,    // background load: reading or inflating the stream
+        PROFILE_STAGE_PREPARE,    // parse, or plan a GPU or progressive decode
+        PROFILE_STAGE_LOD,        // LOD tree build
+        PROFILE_STAGE_APPLY,      // render thread half of a load: storage creation and the first upload
+        PROFILE_STAGE_COUNT
+    } profile_stage_t;
+
+    // Per frame sokol counters, see sg_query_frame_stats
+    typedef enum
+    {
+        PROFILE_COUNTER_PASSES,
+        PROFILE_COUNTER_DISPATCHES,
+        PROFILE_COUNTER_DRAWS,
+        PROFILE_COUNTER_PIPELINES,       // sg_apply_pipeline
+        PROFILE_COUNTER_BINDINGS,        // sg_apply_bindings
+        PROFILE_COUNTER_UNIFORM_UPDATES, // sg_apply_uniforms
+        PROFILE_COUNTER_UNIFORM_BYTES,
+        PROFILE_COUNTER_BUFFER_UPDATES,  // sg_update_buffer and sg_append_buffer
+        PROFILE_COUNTER_BUFFER_BYTES,
+        PROFILE_COUNTER_COUNT
+    } profile_counter_t;
+
+    typedef struct
+    {
+        uint32_t samples; // in the history, up to PROFILER_HISTORY
+        double last;
+        double mean;
+        double min;
+        double p50;
+        double p90;
+        double p99;
+        double max;
+    } profile_summary_t;
+
+    // The last finished frame
+    typedef struct
+    {
+        uint64_t frame;    // frames finished since the profiler was last reset
+        bool gpu;          // drawn through sokol, the counters are valid
+        double stage_ms[PROFILE_STAGE_COUNT]; // 0 for stages the frame did not run
+        uint32_t counters[PROFILE_COUNTER_COUNT];
+    } profile_frame_t;
+
+    typedef struct
+    {
+        profile_stage_t stage;
+        double start_ms; // 0 while the profiler is disabled
+    } profile_scope_t;
+
+    // Enabled by default; also turns sokol's frame statistics on or off once sokol is set up
+    void profiler_set_enabled(bool enabled);
+    bool profiler_enabled(void);
+
+    /**
+     * Time a stage: profile_end(profile_begin(stage)) around the work, nested scopes are fine.
+     * Render stages belong to the render thread, load stages may end on any thread.
+     */
+    profile_scope_t profile_begin(profile_stage_t stage);
+    void profile_end(profile_scope_t scope);
+
+    // Record a stage measured elsewhere, in milliseconds
+    void profile_record(profile_stage_t stage, double ms);
+
+    /**
+     * Close the frame on the render thread: push the render stages it ran and, for a GPU frame, the
+     * counters of the frame just committed into the history
+     *
+     * @param gpu The frame was submitted with sg_commit
+     */
+    void profiler_end_frame(bool gpu);
+
+    // Summaries over the history; safe on any thread
+    profile_summary_t profiler_stage_summary(profile_stage_t stage);
+    profile_summary_t profiler_counter_summary(profile_counter_t counter);
+    profile_frame_t profiler_last_frame(void);
+
+    // Clear the history, e.g. before measuring the next scene
+    void profiler_reset(void);
+
+    const char *profile_stage_name(profile_stage_t stage);
+    const char *profile_counter_name(profile_counter_t counter);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // PROFILER_H
@@ -1,5 +1,6 @@
 #include "renderer.h"
 #include "scene.h"
+#include "offscreen.h"
 #include "utils/logger.h"
 #include <assert.h>
 
@@ -118,6 +119,9 @@ void cleanup_renderer(void)
         return;
     }
 
+    // Offscreen targets draw with scene resources, release them first
+    cleanup_offscreen();
+
     // Clean up scene resources
     cleanup_scene();
 
@@ -0,0 +1,209 @@
+// SPZ decode compute shader: raw attribute planes in, final splat storage out
+// One thread per pair of splats writes their SPLAT_LAYOUT_QUATERNION texels and three position stream words.
+// Integer math only, so spz_decode_splats (spzloader.c) reproduces the output bit for bit.
+
+@cs spz_decode
+layout(local_size_x = 256, local_size_y = 1, local_size_z = 1) in;
+
+layout(binding=0) uniform decode_params {
+    int positions_offset; // byte offsets into spz_planes
+    int alphas_offset;
+    int colors_offset;
+    int scales_offset;
+    int rotations_offset;
+    int first_splat;      // even, a progressive load decodes one batch per dispatch
+    int end_splat;
+    int version;          // 2 or 3
+    int use_order;        // 0: splat j is point j of the stream
+    int _pad0;
+    int _pad1;
+    int _pad2;
+};
+
+struct DecodeWord {
+    uint value;
+};
+
+struct DecodeTexel {
+    uvec4 value;
+};
+
+// Positions through rotations of the decompressed stream as stored, padded to whole words
+layout(binding=11) readonly buffer spz_planes {
+    DecodeWord planes[];
+};
+
+// Source point of each splat (prune and spatial order)
+layout(binding=12) readonly buffer spz_order {
+    DecodeWord order[];
+};
+
+// Per chunk: min x, min -y, min z, 0, range x, range y, range z, 0 (SPZ_DECODE_CHUNK_WORDS)
+layout(binding=13) readonly buffer spz_chunks {
+    DecodeWord chunk_fixed[];
+};
+
+layout(binding=8) buffer splat_buffer {
+    DecodeTexel splats[];
+};
+
+layout(binding=10) buffer position_buffer {
+    DecodeWord position_words[];
+};
+
+const uint CHUNK_SIZE = 256u;
+
+uint plane_byte(uint offset) {
+    return (planes[offset >> 2u].value >> ((offset & 3u) * 8u)) & 0xFFu;
+}
+
+// 24-bit little-endian two's complement
+int plane_fixed24(uint offset) {
+    uint raw = plane_byte(offset) | (plane_byte(offset + 1u) << 8u) | (plane_byte(offset + 2u) << 16u);
+    return int(raw << 8u) >> 8;
+}
+
+// round(d * 65535 / range) for 0 <= d <= range <= 2^24 without 64-bit products
+uint quantize_chunk_offset(uint d, uint range) {
+    if (range == 0u) {
+        return 0u;
+    }
+    uint q = d >= range ? 1u : 0u;
+    uint r = d - q * range;
+    for (int bit = 0; bit < 16; bit++) {
+        r <<= 1u;
+        q <<= 1u;
+        if (r >= range) {
+            r -= range;
+            q |= 1u;
+        }
+    }
+    int t = int(r + (range >> 1u)) - int(d);
+    q = t >= 0 ? q + uint(t) / range : q - (uint(-t) + range - 1u) / range;
+    return min(q, 65535u);
+}
+
+uint isqrt_round(uint n) {
+    uint r = uint(sqrt(float(n)));
+    while (r * r > n) {
+        r--;
+    }
+    while ((r + 1u) * (r + 1u) <= n) {
+        r++;
+    }
+    return n > r * r + r ? r + 1u : r;
+}
+
+// 2^20 * c_sq >= m * s in 32-bit words: m < 2^21 and s < 2^16 are split into 16-bit halves
+bool scaled_square_le(uint m, uint s, uint c_sq) {
+    uint low = (m & 0xFFFFu) * s;
+    uint high = (m >> 16u) * s + (low >> 16u);
+    return high < (c_sq << 4u) || (high == (c_sq << 4u) && (low & 0xFFFFu) == 0u);
+}
+
+// round(512 * |c| / sqrt(s)) for |c|^2 <= s: the largest k with (2k - 1)^2 * s <= 2^20 * c^2
+uint renormalized_component(uint c_sq, uint s) {
+    uint k = uint(512.0 * sqrt(float(c_sq) / float(s)) + 0.5);
+    while (k > 0u && !scaled_square_le((2u * k - 1u) * (2u * k - 1u), s, c_sq)) {
+        k--;
+    }
+    while (scaled_square_le((2u * k + 1u) * (2u * k + 1u), s, c_sq)) {
+        k++;
+    }
+    return k;
+}
+
+// Version 2 x, y, z bytes to smallest-three, components in units of 1/512.
+// Past |c| = 128 w clamps to zero and x, y, z are renormalized like the CPU loader does.
+uint v2_rotation_to_smallest_three(uint offset) {
+    ivec3 c = ivec3(int(plane_byte(offset) << 24u) >> 24,
+                    int(plane_byte(offset + 1u) << 24u) >> 24,
+                    int(plane_byte(offset + 2u) << 24u) >> 24);
+    int length_sq = c.x * c.x + c.y * c.y + c.z * c.z;
+    int w_sq = max(16384 - length_sq, 0);
+
+    int squares[4] = int[4](c.x * c.x, c.y * c.y, c.z * c.z, w_sq);
+    int components[4] = int[4](4 * c.x, 4 * c.y, 4 * c.z, int(isqrt_round(16u * uint(w_sq))));
+    if (length_sq > 16384) {
+        for (int k = 0; k < 3; k++) {
+            int magnitude = int(renormalized_component(uint(squares[k]), uint(length_sq)));
+            components[k] = c[k] < 0 ? -magnitude : magnitude;
+        }
+    }
+
+    uint largest = 0u;
+    for (uint j = 1u; j < 4u; j++) {
+        if (squares[j] > squares[largest]) {
+            largest = j;
+        }
+    }
+
+    int sign_factor = components[largest] < 0 ? -1 : 1;
+    uint packed = largest;
+    uint shift = 2u;
+    for (uint j = 0u; j < 4u; j++) {
+        if (j != largest) {
+            packed |= uint(clamp(sign_factor * components[j] + 512, 0, 1023)) << shift;
+            shift += 10u;
+        }
+    }
+    return packed;
+}
+
+// Texel of splat j (same words as convert_splats_to_texture_data), its quantized position in position
+uvec4 decode_splat(uint j, out uvec3 position) {
+    uint i = use_order != 0 ? order[j].value : j;
+    uint chunk = (j / CHUNK_SIZE) * 8u;
+
+    uint pos_offset = uint(positions_offset) + i * 9u;
+    ivec3 v = ivec3(plane_fixed24(pos_offset), -plane_fixed24(pos_offset + 3u), plane_fixed24(pos_offset + 6u));
+    for (uint k = 0u; k < 3u; k++) {
+        uint d = uint(v[k] - int(chunk_fixed[chunk + k].value));
+        position[k] = quantize_chunk_offset(d, chunk_fixed[chunk + 4u + k].value);
+    }
+
+    uint rotation;
+    if (version == 3) {
+        uint rot_offset = uint(rotations_offset) + i * 4u;
+        rotation = plane_byte(rot_offset) | (plane_byte(rot_offset + 1u) << 8u) |
+                   (plane_byte(rot_offset + 2u) << 16u) | (plane_byte(rot_offset + 3u) << 24u);
+    } else {
+        rotation = v2_rotation_to_smallest_three(uint(rotations_offset) + i * 3u);
+    }
+
+    uint scale_offset = uint(scales_offset) + i * 3u;
+    uint color_offset = uint(colors_offset) + i * 3u;
+    return uvec4(
+        (position.x << 16u) | position.y,
+        (position.z << 16u) | (rotation & 0xFFFFu),
+        (((rotation >> 16u) & 0xFFu) << 24u) | (plane_byte(scale_offset) << 16u) |
+            (plane_byte(scale_offset + 1u) << 8u) | (rotation >> 24u),
+        (plane_byte(color_offset) << 24u) | (plane_byte(color_offset + 1u) << 16u) |
+            (plane_byte(color_offset + 2u) << 8u) | plane_byte(uint(alphas_offset) + i));
+}
+
+void main() {
+    uint pair = uint(first_splat) / 2u + gl_GlobalInvocationID.x;
+    uint j = pair * 2u;
+    if (j >= uint(end_splat)) {
+        return;
+    }
+
+    uvec3 a;
+    uvec3 b = uvec3(0u);
+    splats[j].value = decode_splat(j, a);
+    bool has_b = j + 1u < uint(end_splat);
+    if (has_b) {
+        splats[j + 1u].value = decode_splat(j + 1u, b);
+    }
+
+    uint word = pair * 3u;
+    position_words[word].value = a.x | (a.y << 16u);
+    position_words[word + 1u].value = a.z | (b.x << 16u);
+    if (has_b) {
+        position_words[word + 2u].value = b.y | (b.z << 16u);
+    }
+}
+@end
+
+@program spz_decode spz_decode
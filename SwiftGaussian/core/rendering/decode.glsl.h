@@ -0,0 +1,4006 @@
+#pragma once
+/*
+    #version:1# (machine generated, don't edit!)
+
+    Generated by sokol-shdc (https://github.com/floooh/sokol-tools)
+
+    Cmdline:
+        sokol-shdc -i ./ios-splats/ios-splats/core/rendering/decode.glsl -o ./ios-splats/ios-splats/core/rendering/decode.glsl.h -l metal_ios:metal_sim:metal_macos:hlsl5:glsl310es:glsl410
+
+    Overview:
+    =========
+    Shader program: 'spz_decode':
+        Get shader desc: spz_decode_shader_desc(sg_query_backend());
+        Compute Shader: spz_decode
+    Bindings:
+        Uniform block 'decode_params':
+            C struct: decode_params_t
+            Bind slot: UB_decode_params => 0
+        Storage buffer 'spz_planes':
+            C struct: DecodeWord_t
+            Bind slot: VIEW_spz_planes => 11
+            Readonly: true
+        Storage buffer 'spz_order':
+            C struct: DecodeWord_t
+            Bind slot: VIEW_spz_order => 12
+            Readonly: true
+        Storage buffer 'spz_chunks':
+            C struct: DecodeWord_t
+            Bind slot: VIEW_spz_chunks => 13
+            Readonly: true
+        Storage buffer 'splat_buffer':
+            C struct: DecodeTexel_t
+            Bind slot: VIEW_splat_buffer => 8
+            Readonly: false
+        Storage buffer 'position_buffer':
+            C struct: DecodeWord_t
+            Bind slot: VIEW_position_buffer => 10
+            Readonly: false
+*/
+#if !defined(SOKOL_GFX_INCLUDED)
+#error "Please include sokol_gfx.h before decode.glsl.h"
+#endif
+#if !defined(SOKOL_SHDC_ALIGN)
+#if defined(_MSC_VER)
+#define SOKOL_SHDC_ALIGN(a) __declspec(align(a))
+#else
+#define SOKOL_SHDC_ALIGN(a) __attribute__((aligned(a)))
+#endif
+#endif
+#define UB_decode_params (0)
+#define VIEW_spz_planes (11)
+#define VIEW_spz_order (12)
+#define VIEW_spz_chunks (13)
+#define VIEW_splat_buffer (8)
+#define VIEW_position_buffer (10)
+#pragma pack(push,1)
+SOKOL_SHDC_ALIGN(16) typedef struct decode_params_t {
+    int positions_offset;
+    int alphas_offset;
+    int colors_offset;
+    int scales_offset;
+    int rotations_offset;
+    int first_splat;
+    int end_splat;
+    int version;
+    int use_order;
+    int _pad0;
+    int _pad1;
+    int _pad2;
+} decode_params_t;
+#pragma pack(pop)
+#pragma pack(push,1)
+SOKOL_SHDC_ALIGN(4) typedef struct DecodeWord_t {
+    uint32_t value;
+} DecodeWord_t;
+#pragma pack(pop)
+#pragma pack(push,1)
+SOKOL_SHDC_ALIGN(16) typedef struct DecodeTexel_t {
+    uint32_t value[4];
+} DecodeTexel_t;
+#pragma pack(pop)
+/*
+    #version 410
+    #extension GL_ARB_compute_shader : require
+    #extension GL_ARB_shader_storage_buffer_object : require
+    layout(local_size_x = 256, local_size_y = 1, local_size_z = 1) in;
+
+    struct DecodeWord
+    {
+        uint value;
+    };
+
+    struct DecodeTexel
+    {
+        uvec4 value;
+    };
+
+    uniform ivec4 decode_params[3];
+    layout(std430) readonly buffer spz_planes
+    {
+        DecodeWord planes[];
+    } _61;
+
+    layout(std430) readonly buffer spz_order
+    {
+        DecodeWord order[];
+    } _66;
+
+    layout(std430) readonly buffer spz_chunks
+    {
+        DecodeWord chunk_fixed[];
+    } _80;
+
+    layout(std430) buffer splat_buffer
+    {
+        DecodeTexel splats[];
+    } _98;
+
+    layout(std430) buffer position_buffer
+    {
+        DecodeWord position_words[];
+    } _110;
+
+    uint plane_byte(uint offset)
+    {
+        return (_61.planes[offset >> 2u].value >> ((offset & 3u) * 8u)) & 255u;
+    }
+
+    int plane_fixed24(uint offset)
+    {
+        uint raw = (plane_byte(offset) | (plane_byte(offset + 1u) << 8u)) | (plane_byte(offset + 2u) << 16u);
+        return int(raw << 8u) >> 8;
+    }
+
+    uint quantize_chunk_offset(uint d, uint range)
+    {
+        if (range == 0u)
+        {
+            return 0u;
+        }
+        uint q = (d >= range) ? 1u : 0u;
+        uint r = d - (q * range);
+        for (int bit = 0; bit < 16; bit++)
+        {
+            r = r << 1u;
+            q = q << 1u;
+            if (r >= range)
+            {
+                r -= range;
+                q |= 1u;
+            }
+        }
+        int t = int(r + (range >> 1u)) - int(d);
+        uint _150;
+        if (t >= 0)
+        {
+            _150 = q + (uint(t) / range);
+        }
+        else
+        {
+            _150 = q - (((uint(-t) + range) - 1u) / range);
+        }
+        return min(_150, 65535u);
+    }
+
+    uint isqrt_round(uint n)
+    {
+        uint r = uint(sqrt(float(n)));
+        while ((r * r) > n)
+        {
+            r--;
+        }
+        while (((r + 1u) * (r + 1u)) <= n)
+        {
+            r++;
+        }
+        return (n > ((r * r) + r)) ? (r + 1u) : r;
+    }
+
+    bool scaled_square_le(uint m, uint s, uint c_sq)
+    {
+        uint low = (m & 65535u) * s;
+        uint high = ((m >> 16u) * s) + (low >> 16u);
+        return (high < (c_sq << 4u)) || ((high == (c_sq << 4u)) && ((low & 65535u) == 0u));
+    }
+
+    uint renormalized_component(uint c_sq, uint s)
+    {
+        uint k = uint((512.0 * sqrt(float(c_sq) / float(s))) + 0.5);
+        while ((k > 0u) && (!scaled_square_le(((2u * k) - 1u) * ((2u * k) - 1u), s, c_sq)))
+        {
+            k--;
+        }
+        while (scaled_square_le(((2u * k) + 1u) * ((2u * k) + 1u), s, c_sq))
+        {
+            k++;
+        }
+        return k;
+    }
+
+    uint v2_rotation_to_smallest_three(uint offset)
+    {
+        ivec3 c = ivec3(int(plane_byte(offset) << 24u) >> 24, int(plane_byte(offset + 1u) << 24u) >> 24, int(plane_byte(offset + 2u) << 24u) >> 24);
+        int length_sq = ((c.x * c.x) + (c.y * c.y)) + (c.z * c.z);
+        int w_sq = max(16384 - length_sq, 0);
+        int squares[4] = int[](c.x * c.x, c.y * c.y, c.z * c.z, w_sq);
+        int components[4] = int[](4 * c.x, 4 * c.y, 4 * c.z, int(isqrt_round(16u * uint(w_sq))));
+        if (length_sq > 16384)
+        {
+            for (int k = 0; k < 3; k++)
+            {
+                int magnitude = int(renormalized_component(uint(squares[k]), uint(length_sq)));
+                components[k] = (c[k] < 0) ? (-magnitude) : magnitude;
+            }
+        }
+        uint largest = 0u;
+        for (uint j = 1u; j < 4u; j++)
+        {
+            if (squares[j] > squares[largest])
+            {
+                largest = j;
+            }
+        }
+        int sign_factor = (components[largest] < 0) ? (-1) : 1;
+        uint result = largest;
+        uint shift = 2u;
+        for (uint j_1 = 0u; j_1 < 4u; j_1++)
+        {
+            if (j_1 != largest)
+            {
+                result |= (uint(clamp((sign_factor * components[j_1]) + 512, 0, 1023)) << shift);
+                shift += 10u;
+            }
+        }
+        return result;
+    }
+
+    uvec4 decode_splat(uint j, out uvec3 position)
+    {
+        uint i = (decode_params[2].x != 0) ? _66.order[j].value : j;
+        uint chunk = (j / 256u) * 8u;
+        uint pos_offset = uint(decode_params[0].x) + (i * 9u);
+        ivec3 v = ivec3(plane_fixed24(pos_offset), -plane_fixed24(pos_offset + 3u), plane_fixed24(pos_offset + 6u));
+        for (uint k = 0u; k < 3u; k++)
+        {
+            position[k] = quantize_chunk_offset(uint(v[k] - int(_80.chunk_fixed[chunk + k].value)), _80.chunk_fixed[(chunk + 4u) + k].value);
+        }
+        uint rotation;
+        if (decode_params[1].w == 3)
+        {
+            uint rot_offset = uint(decode_params[1].x) + (i * 4u);
+            rotation = ((plane_byte(rot_offset) | (plane_byte(rot_offset + 1u) << 8u)) | (plane_byte(rot_offset + 2u) << 16u)) | (plane_byte(rot_offset + 3u) << 24u);
+        }
+        else
+        {
+            rotation = v2_rotation_to_smallest_three(uint(decode_params[1].x) + (i * 3u));
+        }
+        uint scale_offset = uint(decode_params[0].w) + (i * 3u);
+        uint color_offset = uint(decode_params[0].z) + (i * 3u);
+        return uvec4((position.x << 16u) | position.y, (position.z << 16u) | (rotation & 65535u), (((((rotation >> 16u) & 255u) << 24u) | (plane_byte(scale_offset) << 16u)) | (plane_byte(scale_offset + 1u) << 8u)) | (rotation >> 24u), (((plane_byte(color_offset) << 24u) | (plane_byte(color_offset + 1u) << 16u)) | (plane_byte(color_offset + 2u) << 8u)) | plane_byte(uint(decode_params[0].y) + i));
+    }
+
+    void main()
+    {
+        uint pair = (uint(decode_params[1].y) / 2u) + gl_GlobalInvocationID.x;
+        uint j = pair * 2u;
+        if (j >= uint(decode_params[1].z))
+        {
+            return;
+        }
+        uvec3 b = uvec3(0u);
+        uvec3 a;
+        uvec4 _610 = decode_splat(j, a);
+        _98.splats[j].value = _610;
+        bool has_b = (j + 1u) < uint(decode_params[1].z);
+        if (has_b)
+        {
+            uvec4 _630 = decode_splat(j + 1u, b);
+            _98.splats[j + 1u].value = _630;
+        }
+        uint word = pair * 3u;
+        _110.position_words[word].value = a.x | (a.y << 16u);
+        _110.position_words[word + 1u].value = a.z | (b.x << 16u);
+        if (has_b)
+        {
+            _110.position_words[word + 2u].value = b.y | (b.z << 16u);
+        }
+    }
+
+*/
+static const uint8_t spz_decode_source_glsl410[5691] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x31,0x30,0x0a,0x23,0x65,0x78,
+    0x74,0x65,0x6e,0x73,0x69,0x6f,0x6e,0x20,0x47,0x4c,0x5f,0x41,0x52,0x42,0x5f,0x63,
+    0x6f,0x6d,0x70,0x75,0x74,0x65,0x5f,0x73,0x68,0x61,0x64,0x65,0x72,0x20,0x3a,0x20,
+    0x72,0x65,0x71,0x75,0x69,0x72,0x65,0x0a,0x23,0x65,0x78,0x74,0x65,0x6e,0x73,0x69,
+    0x6f,0x6e,0x20,0x47,0x4c,0x5f,0x41,0x52,0x42,0x5f,0x73,0x68,0x61,0x64,0x65,0x72,
+    0x5f,0x73,0x74,0x6f,0x72,0x61,0x67,0x65,0x5f,0x62,0x75,0x66,0x66,0x65,0x72,0x5f,
+    0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x3a,0x20,0x72,0x65,0x71,0x75,0x69,0x72,0x65,
+    0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x6c,0x5f,0x73,0x69,
+    0x7a,0x65,0x5f,0x78,0x20,0x3d,0x20,0x32,0x35,0x36,0x2c,0x20,0x6c,0x6f,0x63,0x61,
+    0x6c,0x5f,0x73,0x69,0x7a,0x65,0x5f,0x79,0x20,0x3d,0x20,0x31,0x2c,0x20,0x6c,0x6f,
+    0x63,0x61,0x6c,0x5f,0x73,0x69,0x7a,0x65,0x5f,0x7a,0x20,0x3d,0x20,0x31,0x29,0x20,
+    0x69,0x6e,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x44,0x65,0x63,0x6f,
+    0x64,0x65,0x57,0x6f,0x72,0x64,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,
+    0x74,0x20,0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,
+    0x75,0x63,0x74,0x20,0x44,0x65,0x63,0x6f,0x64,0x65,0x54,0x65,0x78,0x65,0x6c,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x76,0x65,0x63,0x34,0x20,0x76,0x61,0x6c,0x75,
+    0x65,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x69,
+    0x76,0x65,0x63,0x34,0x20,0x64,0x65,0x63,0x6f,0x64,0x65,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x73,0x5b,0x33,0x5d,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x73,0x74,
+    0x64,0x34,0x33,0x30,0x29,0x20,0x72,0x65,0x61,0x64,0x6f,0x6e,0x6c,0x79,0x20,0x62,
+    0x75,0x66,0x66,0x65,0x72,0x20,0x73,0x70,0x7a,0x5f,0x70,0x6c,0x61,0x6e,0x65,0x73,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x44,0x65,0x63,0x6f,0x64,0x65,0x57,0x6f,0x72,
+    0x64,0x20,0x70,0x6c,0x61,0x6e,0x65,0x73,0x5b,0x5d,0x3b,0x0a,0x7d,0x20,0x5f,0x36,
+    0x31,0x3b,0x0a,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x73,0x74,0x64,0x34,0x33,
+    0x30,0x29,0x20,0x72,0x65,0x61,0x64,0x6f,0x6e,0x6c,0x79,0x20,0x62,0x75,0x66,0x66,
+    0x65,0x72,0x20,0x73,0x70,0x7a,0x5f,0x6f,0x72,0x64,0x65,0x72,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x44,0x65,0x63,0x6f,0x64,0x65,0x57,0x6f,0x72,0x64,0x20,0x6f,0x72,
+    0x64,0x65,0x72,0x5b,0x5d,0x3b,0x0a,0x7d,0x20,0x5f,0x36,0x36,0x3b,0x0a,0x0a,0x6c,
+    0x61,0x79,0x6f,0x75,0x74,0x28,0x73,0x74,0x64,0x34,0x33,0x30,0x29,0x20,0x72,0x65,
+    0x61,0x64,0x6f,0x6e,0x6c,0x79,0x20,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x73,0x70,
+    0x7a,0x5f,0x63,0x68,0x75,0x6e,0x6b,0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x44,
+    0x65,0x63,0x6f,0x64,0x65,0x57,0x6f,0x72,0x64,0x20,0x63,0x68,0x75,0x6e,0x6b,0x5f,
+    0x66,0x69,0x78,0x65,0x64,0x5b,0x5d,0x3b,0x0a,0x7d,0x20,0x5f,0x38,0x30,0x3b,0x0a,
+    0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x73,0x74,0x64,0x34,0x33,0x30,0x29,0x20,
+    0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x62,0x75,0x66,
+    0x66,0x65,0x72,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x44,0x65,0x63,0x6f,0x64,0x65,
+    0x54,0x65,0x78,0x65,0x6c,0x20,0x73,0x70,0x6c,0x61,0x74,0x73,0x5b,0x5d,0x3b,0x0a,
+    0x7d,0x20,0x5f,0x39,0x38,0x3b,0x0a,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x73,
+    0x74,0x64,0x34,0x33,0x30,0x29,0x20,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x70,0x6f,
+    0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x62,0x75,0x66,0x66,0x65,0x72,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x44,0x65,0x63,0x6f,0x64,0x65,0x57,0x6f,0x72,0x64,0x20,0x70,
+    0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x77,0x6f,0x72,0x64,0x73,0x5b,0x5d,0x3b,
+    0x0a,0x7d,0x20,0x5f,0x31,0x31,0x30,0x3b,0x0a,0x0a,0x75,0x69,0x6e,0x74,0x20,0x70,
+    0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,0x74,0x65,0x28,0x75,0x69,0x6e,0x74,0x20,0x6f,
+    0x66,0x66,0x73,0x65,0x74,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,
+    0x75,0x72,0x6e,0x20,0x28,0x5f,0x36,0x31,0x2e,0x70,0x6c,0x61,0x6e,0x65,0x73,0x5b,
+    0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x3e,0x3e,0x20,0x32,0x75,0x5d,0x2e,0x76,0x61,
+    0x6c,0x75,0x65,0x20,0x3e,0x3e,0x20,0x28,0x28,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,
+    0x26,0x20,0x33,0x75,0x29,0x20,0x2a,0x20,0x38,0x75,0x29,0x29,0x20,0x26,0x20,0x32,
+    0x35,0x35,0x75,0x3b,0x0a,0x7d,0x0a,0x0a,0x69,0x6e,0x74,0x20,0x70,0x6c,0x61,0x6e,
+    0x65,0x5f,0x66,0x69,0x78,0x65,0x64,0x32,0x34,0x28,0x75,0x69,0x6e,0x74,0x20,0x6f,
+    0x66,0x66,0x73,0x65,0x74,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,
+    0x74,0x20,0x72,0x61,0x77,0x20,0x3d,0x20,0x28,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,
+    0x79,0x74,0x65,0x28,0x6f,0x66,0x66,0x73,0x65,0x74,0x29,0x20,0x7c,0x20,0x28,0x70,
+    0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,0x74,0x65,0x28,0x6f,0x66,0x66,0x73,0x65,0x74,
+    0x20,0x2b,0x20,0x31,0x75,0x29,0x20,0x3c,0x3c,0x20,0x38,0x75,0x29,0x29,0x20,0x7c,
+    0x20,0x28,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,0x74,0x65,0x28,0x6f,0x66,0x66,
+    0x73,0x65,0x74,0x20,0x2b,0x20,0x32,0x75,0x29,0x20,0x3c,0x3c,0x20,0x31,0x36,0x75,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x69,0x6e,
+    0x74,0x28,0x72,0x61,0x77,0x20,0x3c,0x3c,0x20,0x38,0x75,0x29,0x20,0x3e,0x3e,0x20,
+    0x38,0x3b,0x0a,0x7d,0x0a,0x0a,0x75,0x69,0x6e,0x74,0x20,0x71,0x75,0x61,0x6e,0x74,
+    0x69,0x7a,0x65,0x5f,0x63,0x68,0x75,0x6e,0x6b,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,
+    0x28,0x75,0x69,0x6e,0x74,0x20,0x64,0x2c,0x20,0x75,0x69,0x6e,0x74,0x20,0x72,0x61,
+    0x6e,0x67,0x65,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x72,
+    0x61,0x6e,0x67,0x65,0x20,0x3d,0x3d,0x20,0x30,0x75,0x29,0x0a,0x20,0x20,0x20,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x20,0x30,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x75,
+    0x69,0x6e,0x74,0x20,0x71,0x20,0x3d,0x20,0x28,0x64,0x20,0x3e,0x3d,0x20,0x72,0x61,
+    0x6e,0x67,0x65,0x29,0x20,0x3f,0x20,0x31,0x75,0x20,0x3a,0x20,0x30,0x75,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x72,0x20,0x3d,0x20,0x64,0x20,0x2d,
+    0x20,0x28,0x71,0x20,0x2a,0x20,0x72,0x61,0x6e,0x67,0x65,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x62,0x69,0x74,0x20,0x3d,
+    0x20,0x30,0x3b,0x20,0x62,0x69,0x74,0x20,0x3c,0x20,0x31,0x36,0x3b,0x20,0x62,0x69,
+    0x74,0x2b,0x2b,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x72,0x20,0x3d,0x20,0x72,0x20,0x3c,0x3c,0x20,0x31,0x75,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x71,0x20,0x3d,0x20,0x71,0x20,0x3c,0x3c,
+    0x20,0x31,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
+    0x28,0x72,0x20,0x3e,0x3d,0x20,0x72,0x61,0x6e,0x67,0x65,0x29,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x72,0x20,0x2d,0x3d,0x20,0x72,0x61,0x6e,0x67,0x65,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x71,0x20,0x7c,0x3d,0x20,
+    0x31,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
+    0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x74,0x20,0x3d,0x20,
+    0x69,0x6e,0x74,0x28,0x72,0x20,0x2b,0x20,0x28,0x72,0x61,0x6e,0x67,0x65,0x20,0x3e,
+    0x3e,0x20,0x31,0x75,0x29,0x29,0x20,0x2d,0x20,0x69,0x6e,0x74,0x28,0x64,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,0x31,0x35,0x30,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x20,0x3e,0x3d,0x20,0x30,0x29,0x0a,
+    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x31,
+    0x35,0x30,0x20,0x3d,0x20,0x71,0x20,0x2b,0x20,0x28,0x75,0x69,0x6e,0x74,0x28,0x74,
+    0x29,0x20,0x2f,0x20,0x72,0x61,0x6e,0x67,0x65,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x31,0x35,0x30,0x20,0x3d,0x20,
+    0x71,0x20,0x2d,0x20,0x28,0x28,0x28,0x75,0x69,0x6e,0x74,0x28,0x2d,0x74,0x29,0x20,
+    0x2b,0x20,0x72,0x61,0x6e,0x67,0x65,0x29,0x20,0x2d,0x20,0x31,0x75,0x29,0x20,0x2f,
+    0x20,0x72,0x61,0x6e,0x67,0x65,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,
+    0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6d,0x69,0x6e,0x28,0x5f,0x31,
+    0x35,0x30,0x2c,0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,
+    0x75,0x69,0x6e,0x74,0x20,0x69,0x73,0x71,0x72,0x74,0x5f,0x72,0x6f,0x75,0x6e,0x64,
+    0x28,0x75,0x69,0x6e,0x74,0x20,0x6e,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,
+    0x69,0x6e,0x74,0x20,0x72,0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,0x28,0x73,0x71,0x72,
+    0x74,0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x6e,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x28,0x72,0x20,0x2a,0x20,0x72,0x29,
+    0x20,0x3e,0x20,0x6e,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x72,0x2d,0x2d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,
+    0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x28,0x28,0x72,0x20,0x2b,0x20,
+    0x31,0x75,0x29,0x20,0x2a,0x20,0x28,0x72,0x20,0x2b,0x20,0x31,0x75,0x29,0x29,0x20,
+    0x3c,0x3d,0x20,0x6e,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x72,0x2b,0x2b,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,
+    0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x28,0x6e,0x20,0x3e,0x20,0x28,
+    0x28,0x72,0x20,0x2a,0x20,0x72,0x29,0x20,0x2b,0x20,0x72,0x29,0x29,0x20,0x3f,0x20,
+    0x28,0x72,0x20,0x2b,0x20,0x31,0x75,0x29,0x20,0x3a,0x20,0x72,0x3b,0x0a,0x7d,0x0a,
+    0x0a,0x62,0x6f,0x6f,0x6c,0x20,0x73,0x63,0x61,0x6c,0x65,0x64,0x5f,0x73,0x71,0x75,
+    0x61,0x72,0x65,0x5f,0x6c,0x65,0x28,0x75,0x69,0x6e,0x74,0x20,0x6d,0x2c,0x20,0x75,
+    0x69,0x6e,0x74,0x20,0x73,0x2c,0x20,0x75,0x69,0x6e,0x74,0x20,0x63,0x5f,0x73,0x71,
+    0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x6c,0x6f,0x77,
+    0x20,0x3d,0x20,0x28,0x6d,0x20,0x26,0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x20,
+    0x2a,0x20,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x68,0x69,
+    0x67,0x68,0x20,0x3d,0x20,0x28,0x28,0x6d,0x20,0x3e,0x3e,0x20,0x31,0x36,0x75,0x29,
+    0x20,0x2a,0x20,0x73,0x29,0x20,0x2b,0x20,0x28,0x6c,0x6f,0x77,0x20,0x3e,0x3e,0x20,
+    0x31,0x36,0x75,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x20,0x28,0x68,0x69,0x67,0x68,0x20,0x3c,0x20,0x28,0x63,0x5f,0x73,0x71,0x20,0x3c,
+    0x3c,0x20,0x34,0x75,0x29,0x29,0x20,0x7c,0x7c,0x20,0x28,0x28,0x68,0x69,0x67,0x68,
+    0x20,0x3d,0x3d,0x20,0x28,0x63,0x5f,0x73,0x71,0x20,0x3c,0x3c,0x20,0x34,0x75,0x29,
+    0x29,0x20,0x26,0x26,0x20,0x28,0x28,0x6c,0x6f,0x77,0x20,0x26,0x20,0x36,0x35,0x35,
+    0x33,0x35,0x75,0x29,0x20,0x3d,0x3d,0x20,0x30,0x75,0x29,0x29,0x3b,0x0a,0x7d,0x0a,
+    0x0a,0x75,0x69,0x6e,0x74,0x20,0x72,0x65,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,
+    0x65,0x64,0x5f,0x63,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,0x74,0x28,0x75,0x69,0x6e,
+    0x74,0x20,0x63,0x5f,0x73,0x71,0x2c,0x20,0x75,0x69,0x6e,0x74,0x20,0x73,0x29,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x6b,0x20,0x3d,0x20,0x75,
+    0x69,0x6e,0x74,0x28,0x28,0x35,0x31,0x32,0x2e,0x30,0x20,0x2a,0x20,0x73,0x71,0x72,
+    0x74,0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x63,0x5f,0x73,0x71,0x29,0x20,0x2f,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x28,0x73,0x29,0x29,0x29,0x20,0x2b,0x20,0x30,0x2e,0x35,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x28,0x6b,
+    0x20,0x3e,0x20,0x30,0x75,0x29,0x20,0x26,0x26,0x20,0x28,0x21,0x73,0x63,0x61,0x6c,
+    0x65,0x64,0x5f,0x73,0x71,0x75,0x61,0x72,0x65,0x5f,0x6c,0x65,0x28,0x28,0x28,0x32,
+    0x75,0x20,0x2a,0x20,0x6b,0x29,0x20,0x2d,0x20,0x31,0x75,0x29,0x20,0x2a,0x20,0x28,
+    0x28,0x32,0x75,0x20,0x2a,0x20,0x6b,0x29,0x20,0x2d,0x20,0x31,0x75,0x29,0x2c,0x20,
+    0x73,0x2c,0x20,0x63,0x5f,0x73,0x71,0x29,0x29,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6b,0x2d,0x2d,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x73,
+    0x63,0x61,0x6c,0x65,0x64,0x5f,0x73,0x71,0x75,0x61,0x72,0x65,0x5f,0x6c,0x65,0x28,
+    0x28,0x28,0x32,0x75,0x20,0x2a,0x20,0x6b,0x29,0x20,0x2b,0x20,0x31,0x75,0x29,0x20,
+    0x2a,0x20,0x28,0x28,0x32,0x75,0x20,0x2a,0x20,0x6b,0x29,0x20,0x2b,0x20,0x31,0x75,
+    0x29,0x2c,0x20,0x73,0x2c,0x20,0x63,0x5f,0x73,0x71,0x29,0x29,0x0a,0x20,0x20,0x20,
+    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6b,0x2b,0x2b,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x20,0x6b,0x3b,0x0a,0x7d,0x0a,0x0a,0x75,0x69,0x6e,0x74,0x20,0x76,0x32,0x5f,0x72,
+    0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x5f,0x74,0x6f,0x5f,0x73,0x6d,0x61,0x6c,0x6c,
+    0x65,0x73,0x74,0x5f,0x74,0x68,0x72,0x65,0x65,0x28,0x75,0x69,0x6e,0x74,0x20,0x6f,
+    0x66,0x66,0x73,0x65,0x74,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x76,0x65,
+    0x63,0x33,0x20,0x63,0x20,0x3d,0x20,0x69,0x76,0x65,0x63,0x33,0x28,0x69,0x6e,0x74,
+    0x28,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,0x74,0x65,0x28,0x6f,0x66,0x66,0x73,
+    0x65,0x74,0x29,0x20,0x3c,0x3c,0x20,0x32,0x34,0x75,0x29,0x20,0x3e,0x3e,0x20,0x32,
+    0x34,0x2c,0x20,0x69,0x6e,0x74,0x28,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,0x74,
+    0x65,0x28,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x2b,0x20,0x31,0x75,0x29,0x20,0x3c,
+    0x3c,0x20,0x32,0x34,0x75,0x29,0x20,0x3e,0x3e,0x20,0x32,0x34,0x2c,0x20,0x69,0x6e,
+    0x74,0x28,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,0x74,0x65,0x28,0x6f,0x66,0x66,
+    0x73,0x65,0x74,0x20,0x2b,0x20,0x32,0x75,0x29,0x20,0x3c,0x3c,0x20,0x32,0x34,0x75,
+    0x29,0x20,0x3e,0x3e,0x20,0x32,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,
+    0x74,0x20,0x6c,0x65,0x6e,0x67,0x74,0x68,0x5f,0x73,0x71,0x20,0x3d,0x20,0x28,0x28,
+    0x63,0x2e,0x78,0x20,0x2a,0x20,0x63,0x2e,0x78,0x29,0x20,0x2b,0x20,0x28,0x63,0x2e,
+    0x79,0x20,0x2a,0x20,0x63,0x2e,0x79,0x29,0x29,0x20,0x2b,0x20,0x28,0x63,0x2e,0x7a,
+    0x20,0x2a,0x20,0x63,0x2e,0x7a,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,
+    0x20,0x77,0x5f,0x73,0x71,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x31,0x36,0x33,0x38,
+    0x34,0x20,0x2d,0x20,0x6c,0x65,0x6e,0x67,0x74,0x68,0x5f,0x73,0x71,0x2c,0x20,0x30,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x73,0x71,0x75,0x61,0x72,
+    0x65,0x73,0x5b,0x34,0x5d,0x20,0x3d,0x20,0x69,0x6e,0x74,0x5b,0x5d,0x28,0x63,0x2e,
+    0x78,0x20,0x2a,0x20,0x63,0x2e,0x78,0x2c,0x20,0x63,0x2e,0x79,0x20,0x2a,0x20,0x63,
+    0x2e,0x79,0x2c,0x20,0x63,0x2e,0x7a,0x20,0x2a,0x20,0x63,0x2e,0x7a,0x2c,0x20,0x77,
+    0x5f,0x73,0x71,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x63,0x6f,
+    0x6d,0x70,0x6f,0x6e,0x65,0x6e,0x74,0x73,0x5b,0x34,0x5d,0x20,0x3d,0x20,0x69,0x6e,
+    0x74,0x5b,0x5d,0x28,0x34,0x20,0x2a,0x20,0x63,0x2e,0x78,0x2c,0x20,0x34,0x20,0x2a,
+    0x20,0x63,0x2e,0x79,0x2c,0x20,0x34,0x20,0x2a,0x20,0x63,0x2e,0x7a,0x2c,0x20,0x69,
+    0x6e,0x74,0x28,0x69,0x73,0x71,0x72,0x74,0x5f,0x72,0x6f,0x75,0x6e,0x64,0x28,0x31,
+    0x36,0x75,0x20,0x2a,0x20,0x75,0x69,0x6e,0x74,0x28,0x77,0x5f,0x73,0x71,0x29,0x29,
+    0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x6c,0x65,0x6e,0x67,
+    0x74,0x68,0x5f,0x73,0x71,0x20,0x3e,0x20,0x31,0x36,0x33,0x38,0x34,0x29,0x0a,0x20,
+    0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,
+    0x20,0x28,0x69,0x6e,0x74,0x20,0x6b,0x20,0x3d,0x20,0x30,0x3b,0x20,0x6b,0x20,0x3c,
+    0x20,0x33,0x3b,0x20,0x6b,0x2b,0x2b,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,
+    0x6e,0x74,0x20,0x6d,0x61,0x67,0x6e,0x69,0x74,0x75,0x64,0x65,0x20,0x3d,0x20,0x69,
+    0x6e,0x74,0x28,0x72,0x65,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x64,0x5f,
+    0x63,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,0x74,0x28,0x75,0x69,0x6e,0x74,0x28,0x73,
+    0x71,0x75,0x61,0x72,0x65,0x73,0x5b,0x6b,0x5d,0x29,0x2c,0x20,0x75,0x69,0x6e,0x74,
+    0x28,0x6c,0x65,0x6e,0x67,0x74,0x68,0x5f,0x73,0x71,0x29,0x29,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6f,0x6d,0x70,0x6f,
+    0x6e,0x65,0x6e,0x74,0x73,0x5b,0x6b,0x5d,0x20,0x3d,0x20,0x28,0x63,0x5b,0x6b,0x5d,
+    0x20,0x3c,0x20,0x30,0x29,0x20,0x3f,0x20,0x28,0x2d,0x6d,0x61,0x67,0x6e,0x69,0x74,
+    0x75,0x64,0x65,0x29,0x20,0x3a,0x20,0x6d,0x61,0x67,0x6e,0x69,0x74,0x75,0x64,0x65,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
+    0x7d,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x6c,0x61,0x72,0x67,0x65,
+    0x73,0x74,0x20,0x3d,0x20,0x30,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,
+    0x20,0x28,0x75,0x69,0x6e,0x74,0x20,0x6a,0x20,0x3d,0x20,0x31,0x75,0x3b,0x20,0x6a,
+    0x20,0x3c,0x20,0x34,0x75,0x3b,0x20,0x6a,0x2b,0x2b,0x29,0x0a,0x20,0x20,0x20,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x73,0x71,
+    0x75,0x61,0x72,0x65,0x73,0x5b,0x6a,0x5d,0x20,0x3e,0x20,0x73,0x71,0x75,0x61,0x72,
+    0x65,0x73,0x5b,0x6c,0x61,0x72,0x67,0x65,0x73,0x74,0x5d,0x29,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x6c,0x61,0x72,0x67,0x65,0x73,0x74,0x20,0x3d,0x20,0x6a,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,
+    0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x73,0x69,0x67,0x6e,0x5f,0x66,0x61,0x63,
+    0x74,0x6f,0x72,0x20,0x3d,0x20,0x28,0x63,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,0x74,
+    0x73,0x5b,0x6c,0x61,0x72,0x67,0x65,0x73,0x74,0x5d,0x20,0x3c,0x20,0x30,0x29,0x20,
+    0x3f,0x20,0x28,0x2d,0x31,0x29,0x20,0x3a,0x20,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x75,0x69,0x6e,0x74,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x3d,0x20,0x6c,0x61,
+    0x72,0x67,0x65,0x73,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,
+    0x73,0x68,0x69,0x66,0x74,0x20,0x3d,0x20,0x32,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6f,0x72,0x20,0x28,0x75,0x69,0x6e,0x74,0x20,0x6a,0x5f,0x31,0x20,0x3d,0x20,
+    0x30,0x75,0x3b,0x20,0x6a,0x5f,0x31,0x20,0x3c,0x20,0x34,0x75,0x3b,0x20,0x6a,0x5f,
+    0x31,0x2b,0x2b,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x6a,0x5f,0x31,0x20,0x21,0x3d,0x20,0x6c,0x61,
+    0x72,0x67,0x65,0x73,0x74,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x73,
+    0x75,0x6c,0x74,0x20,0x7c,0x3d,0x20,0x28,0x75,0x69,0x6e,0x74,0x28,0x63,0x6c,0x61,
+    0x6d,0x70,0x28,0x28,0x73,0x69,0x67,0x6e,0x5f,0x66,0x61,0x63,0x74,0x6f,0x72,0x20,
+    0x2a,0x20,0x63,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,0x74,0x73,0x5b,0x6a,0x5f,0x31,
+    0x5d,0x29,0x20,0x2b,0x20,0x35,0x31,0x32,0x2c,0x20,0x30,0x2c,0x20,0x31,0x30,0x32,
+    0x33,0x29,0x29,0x20,0x3c,0x3c,0x20,0x73,0x68,0x69,0x66,0x74,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x68,0x69,0x66,0x74,
+    0x20,0x2b,0x3d,0x20,0x31,0x30,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,
+    0x75,0x72,0x6e,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x75,
+    0x76,0x65,0x63,0x34,0x20,0x64,0x65,0x63,0x6f,0x64,0x65,0x5f,0x73,0x70,0x6c,0x61,
+    0x74,0x28,0x75,0x69,0x6e,0x74,0x20,0x6a,0x2c,0x20,0x6f,0x75,0x74,0x20,0x75,0x76,
+    0x65,0x63,0x33,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x29,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x69,0x20,0x3d,0x20,0x28,0x64,0x65,
+    0x63,0x6f,0x64,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x32,0x5d,0x2e,0x78,
+    0x20,0x21,0x3d,0x20,0x30,0x29,0x20,0x3f,0x20,0x5f,0x36,0x36,0x2e,0x6f,0x72,0x64,
+    0x65,0x72,0x5b,0x6a,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3a,0x20,0x6a,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x63,0x68,0x75,0x6e,0x6b,0x20,
+    0x3d,0x20,0x28,0x6a,0x20,0x2f,0x20,0x32,0x35,0x36,0x75,0x29,0x20,0x2a,0x20,0x38,
+    0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x70,0x6f,0x73,0x5f,
+    0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,0x28,0x64,0x65,
+    0x63,0x6f,0x64,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x78,
+    0x29,0x20,0x2b,0x20,0x28,0x69,0x20,0x2a,0x20,0x39,0x75,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x76,0x65,0x63,0x33,0x20,0x76,0x20,0x3d,0x20,0x69,0x76,0x65,0x63,
+    0x33,0x28,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x66,0x69,0x78,0x65,0x64,0x32,0x34,0x28,
+    0x70,0x6f,0x73,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x29,0x2c,0x20,0x2d,0x70,0x6c,
+    0x61,0x6e,0x65,0x5f,0x66,0x69,0x78,0x65,0x64,0x32,0x34,0x28,0x70,0x6f,0x73,0x5f,
+    0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x2b,0x20,0x33,0x75,0x29,0x2c,0x20,0x70,0x6c,
+    0x61,0x6e,0x65,0x5f,0x66,0x69,0x78,0x65,0x64,0x32,0x34,0x28,0x70,0x6f,0x73,0x5f,
+    0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x2b,0x20,0x36,0x75,0x29,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x75,0x69,0x6e,0x74,0x20,0x6b,0x20,0x3d,
+    0x20,0x30,0x75,0x3b,0x20,0x6b,0x20,0x3c,0x20,0x33,0x75,0x3b,0x20,0x6b,0x2b,0x2b,
+    0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5b,0x6b,0x5d,0x20,0x3d,0x20,0x71,0x75,
+    0x61,0x6e,0x74,0x69,0x7a,0x65,0x5f,0x63,0x68,0x75,0x6e,0x6b,0x5f,0x6f,0x66,0x66,
+    0x73,0x65,0x74,0x28,0x75,0x69,0x6e,0x74,0x28,0x76,0x5b,0x6b,0x5d,0x20,0x2d,0x20,
+    0x69,0x6e,0x74,0x28,0x5f,0x38,0x30,0x2e,0x63,0x68,0x75,0x6e,0x6b,0x5f,0x66,0x69,
+    0x78,0x65,0x64,0x5b,0x63,0x68,0x75,0x6e,0x6b,0x20,0x2b,0x20,0x6b,0x5d,0x2e,0x76,
+    0x61,0x6c,0x75,0x65,0x29,0x29,0x2c,0x20,0x5f,0x38,0x30,0x2e,0x63,0x68,0x75,0x6e,
+    0x6b,0x5f,0x66,0x69,0x78,0x65,0x64,0x5b,0x28,0x63,0x68,0x75,0x6e,0x6b,0x20,0x2b,
+    0x20,0x34,0x75,0x29,0x20,0x2b,0x20,0x6b,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,
+    0x20,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,
+    0x66,0x20,0x28,0x64,0x65,0x63,0x6f,0x64,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
+    0x5b,0x31,0x5d,0x2e,0x77,0x20,0x3d,0x3d,0x20,0x33,0x29,0x0a,0x20,0x20,0x20,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x72,
+    0x6f,0x74,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,
+    0x28,0x64,0x65,0x63,0x6f,0x64,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,
+    0x5d,0x2e,0x78,0x29,0x20,0x2b,0x20,0x28,0x69,0x20,0x2a,0x20,0x34,0x75,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,
+    0x6e,0x20,0x3d,0x20,0x28,0x28,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,0x74,0x65,
+    0x28,0x72,0x6f,0x74,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x29,0x20,0x7c,0x20,0x28,
+    0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,0x74,0x65,0x28,0x72,0x6f,0x74,0x5f,0x6f,
+    0x66,0x66,0x73,0x65,0x74,0x20,0x2b,0x20,0x31,0x75,0x29,0x20,0x3c,0x3c,0x20,0x38,
+    0x75,0x29,0x29,0x20,0x7c,0x20,0x28,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,0x74,
+    0x65,0x28,0x72,0x6f,0x74,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x2b,0x20,0x32,
+    0x75,0x29,0x20,0x3c,0x3c,0x20,0x31,0x36,0x75,0x29,0x29,0x20,0x7c,0x20,0x28,0x70,
+    0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,0x74,0x65,0x28,0x72,0x6f,0x74,0x5f,0x6f,0x66,
+    0x66,0x73,0x65,0x74,0x20,0x2b,0x20,0x33,0x75,0x29,0x20,0x3c,0x3c,0x20,0x32,0x34,
+    0x75,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,
+    0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x76,0x32,0x5f,0x72,
+    0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x5f,0x74,0x6f,0x5f,0x73,0x6d,0x61,0x6c,0x6c,
+    0x65,0x73,0x74,0x5f,0x74,0x68,0x72,0x65,0x65,0x28,0x75,0x69,0x6e,0x74,0x28,0x64,
+    0x65,0x63,0x6f,0x64,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2e,
+    0x78,0x29,0x20,0x2b,0x20,0x28,0x69,0x20,0x2a,0x20,0x33,0x75,0x29,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x73,
+    0x63,0x61,0x6c,0x65,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x3d,0x20,0x75,0x69,
+    0x6e,0x74,0x28,0x64,0x65,0x63,0x6f,0x64,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
+    0x5b,0x30,0x5d,0x2e,0x77,0x29,0x20,0x2b,0x20,0x28,0x69,0x20,0x2a,0x20,0x33,0x75,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x63,0x6f,0x6c,0x6f,
+    0x72,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,0x28,
+    0x64,0x65,0x63,0x6f,0x64,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,
+    0x2e,0x7a,0x29,0x20,0x2b,0x20,0x28,0x69,0x20,0x2a,0x20,0x33,0x75,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x75,0x76,0x65,0x63,0x34,
+    0x28,0x28,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2e,0x78,0x20,0x3c,0x3c,0x20,
+    0x31,0x36,0x75,0x29,0x20,0x7c,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2e,
+    0x79,0x2c,0x20,0x28,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2e,0x7a,0x20,0x3c,
+    0x3c,0x20,0x31,0x36,0x75,0x29,0x20,0x7c,0x20,0x28,0x72,0x6f,0x74,0x61,0x74,0x69,
+    0x6f,0x6e,0x20,0x26,0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x2c,0x20,0x28,0x28,
+    0x28,0x28,0x28,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3e,0x3e,0x20,0x31,
+    0x36,0x75,0x29,0x20,0x26,0x20,0x32,0x35,0x35,0x75,0x29,0x20,0x3c,0x3c,0x20,0x32,
+    0x34,0x75,0x29,0x20,0x7c,0x20,0x28,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,0x74,
+    0x65,0x28,0x73,0x63,0x61,0x6c,0x65,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x29,0x20,
+    0x3c,0x3c,0x20,0x31,0x36,0x75,0x29,0x29,0x20,0x7c,0x20,0x28,0x70,0x6c,0x61,0x6e,
+    0x65,0x5f,0x62,0x79,0x74,0x65,0x28,0x73,0x63,0x61,0x6c,0x65,0x5f,0x6f,0x66,0x66,
+    0x73,0x65,0x74,0x20,0x2b,0x20,0x31,0x75,0x29,0x20,0x3c,0x3c,0x20,0x38,0x75,0x29,
+    0x29,0x20,0x7c,0x20,0x28,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3e,0x3e,
+    0x20,0x32,0x34,0x75,0x29,0x2c,0x20,0x28,0x28,0x28,0x70,0x6c,0x61,0x6e,0x65,0x5f,
+    0x62,0x79,0x74,0x65,0x28,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,0x66,0x66,0x73,0x65,
+    0x74,0x29,0x20,0x3c,0x3c,0x20,0x32,0x34,0x75,0x29,0x20,0x7c,0x20,0x28,0x70,0x6c,
+    0x61,0x6e,0x65,0x5f,0x62,0x79,0x74,0x65,0x28,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,
+    0x66,0x66,0x73,0x65,0x74,0x20,0x2b,0x20,0x31,0x75,0x29,0x20,0x3c,0x3c,0x20,0x31,
+    0x36,0x75,0x29,0x29,0x20,0x7c,0x20,0x28,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,
+    0x74,0x65,0x28,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,
+    0x2b,0x20,0x32,0x75,0x29,0x20,0x3c,0x3c,0x20,0x38,0x75,0x29,0x29,0x20,0x7c,0x20,
+    0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,0x74,0x65,0x28,0x75,0x69,0x6e,0x74,0x28,
+    0x64,0x65,0x63,0x6f,0x64,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,
+    0x2e,0x79,0x29,0x20,0x2b,0x20,0x69,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x6f,
+    0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x75,0x69,0x6e,0x74,0x20,0x70,0x61,0x69,0x72,0x20,0x3d,0x20,0x28,0x75,0x69,0x6e,
+    0x74,0x28,0x64,0x65,0x63,0x6f,0x64,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,
+    0x31,0x5d,0x2e,0x79,0x29,0x20,0x2f,0x20,0x32,0x75,0x29,0x20,0x2b,0x20,0x67,0x6c,
+    0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,
+    0x6e,0x49,0x44,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,
+    0x6a,0x20,0x3d,0x20,0x70,0x61,0x69,0x72,0x20,0x2a,0x20,0x32,0x75,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x6a,0x20,0x3e,0x3d,0x20,0x75,0x69,0x6e,0x74,
+    0x28,0x64,0x65,0x63,0x6f,0x64,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,
+    0x5d,0x2e,0x7a,0x29,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x7d,0x0a,0x20,0x20,0x20,0x20,0x75,0x76,0x65,0x63,0x33,0x20,0x62,0x20,0x3d,0x20,
+    0x75,0x76,0x65,0x63,0x33,0x28,0x30,0x75,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,
+    0x76,0x65,0x63,0x33,0x20,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x76,0x65,0x63,
+    0x34,0x20,0x5f,0x36,0x31,0x30,0x20,0x3d,0x20,0x64,0x65,0x63,0x6f,0x64,0x65,0x5f,
+    0x73,0x70,0x6c,0x61,0x74,0x28,0x6a,0x2c,0x20,0x61,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x5f,0x39,0x38,0x2e,0x73,0x70,0x6c,0x61,0x74,0x73,0x5b,0x6a,0x5d,0x2e,0x76,
+    0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x5f,0x36,0x31,0x30,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x62,0x6f,0x6f,0x6c,0x20,0x68,0x61,0x73,0x5f,0x62,0x20,0x3d,0x20,0x28,0x6a,
+    0x20,0x2b,0x20,0x31,0x75,0x29,0x20,0x3c,0x20,0x75,0x69,0x6e,0x74,0x28,0x64,0x65,
+    0x63,0x6f,0x64,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2e,0x7a,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x68,0x61,0x73,0x5f,0x62,
+    0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x75,0x76,0x65,0x63,0x34,0x20,0x5f,0x36,0x33,0x30,0x20,0x3d,0x20,0x64,0x65,0x63,
+    0x6f,0x64,0x65,0x5f,0x73,0x70,0x6c,0x61,0x74,0x28,0x6a,0x20,0x2b,0x20,0x31,0x75,
+    0x2c,0x20,0x62,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x39,
+    0x38,0x2e,0x73,0x70,0x6c,0x61,0x74,0x73,0x5b,0x6a,0x20,0x2b,0x20,0x31,0x75,0x5d,
+    0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x5f,0x36,0x33,0x30,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x77,0x6f,
+    0x72,0x64,0x20,0x3d,0x20,0x70,0x61,0x69,0x72,0x20,0x2a,0x20,0x33,0x75,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x5f,0x31,0x31,0x30,0x2e,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,
+    0x6e,0x5f,0x77,0x6f,0x72,0x64,0x73,0x5b,0x77,0x6f,0x72,0x64,0x5d,0x2e,0x76,0x61,
+    0x6c,0x75,0x65,0x20,0x3d,0x20,0x61,0x2e,0x78,0x20,0x7c,0x20,0x28,0x61,0x2e,0x79,
+    0x20,0x3c,0x3c,0x20,0x31,0x36,0x75,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x5f,0x31,
+    0x31,0x30,0x2e,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x77,0x6f,0x72,0x64,
+    0x73,0x5b,0x77,0x6f,0x72,0x64,0x20,0x2b,0x20,0x31,0x75,0x5d,0x2e,0x76,0x61,0x6c,
+    0x75,0x65,0x20,0x3d,0x20,0x61,0x2e,0x7a,0x20,0x7c,0x20,0x28,0x62,0x2e,0x78,0x20,
+    0x3c,0x3c,0x20,0x31,0x36,0x75,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
+    0x28,0x68,0x61,0x73,0x5f,0x62,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x31,0x31,0x30,0x2e,0x70,0x6f,0x73,0x69,0x74,
+    0x69,0x6f,0x6e,0x5f,0x77,0x6f,0x72,0x64,0x73,0x5b,0x77,0x6f,0x72,0x64,0x20,0x2b,
+    0x20,0x32,0x75,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x62,0x2e,0x79,
+    0x20,0x7c,0x20,0x28,0x62,0x2e,0x7a,0x20,0x3c,0x3c,0x20,0x31,0x36,0x75,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 310 es
+    layout(local_size_x = 256, local_size_y = 1, local_size_z = 1) in;
+
+    struct DecodeWord
+    {
+        uint value;
+    };
+
+    struct DecodeTexel
+    {
+        uvec4 value;
+    };
+
+    uniform ivec4 decode_params[3];
+    layout(binding = 2, std430) readonly buffer spz_planes
+    {
+        DecodeWord planes[];
+    } _61;
+
+    layout(binding = 3, std430) readonly buffer spz_order
+    {
+        DecodeWord order[];
+    } _66;
+
+    layout(binding = 4, std430) readonly buffer spz_chunks
+    {
+        DecodeWord chunk_fixed[];
+    } _80;
+
+    layout(binding = 0, std430) buffer splat_buffer
+    {
+        DecodeTexel splats[];
+    } _98;
+
+    layout(binding = 1, std430) buffer position_buffer
+    {
+        DecodeWord position_words[];
+    } _110;
+
+    uint plane_byte(uint offset)
+    {
+        return (_61.planes[offset >> 2u].value >> ((offset & 3u) * 8u)) & 255u;
+    }
+
+    int plane_fixed24(uint offset)
+    {
+        uint raw = (plane_byte(offset) | (plane_byte(offset + 1u) << 8u)) | (plane_byte(offset + 2u) << 16u);
+        return int(raw << 8u) >> 8;
+    }
+
+    uint quantize_chunk_offset(uint d, uint range)
+    {
+        if (range == 0u)
+        {
+            return 0u;
+        }
+        uint q = (d >= range) ? 1u : 0u;
+        uint r = d - (q * range);
+        for (int bit = 0; bit < 16; bit++)
+        {
+            r = r << 1u;
+            q = q << 1u;
+            if (r >= range)
+            {
+                r -= range;
+                q |= 1u;
+            }
+        }
+        int t = int(r + (range >> 1u)) - int(d);
+        uint _150;
+        if (t >= 0)
+        {
+            _150 = q + (uint(t) / range);
+        }
+        else
+        {
+            _150 = q - (((uint(-t) + range) - 1u) / range);
+        }
+        return min(_150, 65535u);
+    }
+
+    uint isqrt_round(uint n)
+    {
+        uint r = uint(sqrt(float(n)));
+        while ((r * r) > n)
+        {
+            r--;
+        }
+        while (((r + 1u) * (r + 1u)) <= n)
+        {
+            r++;
+        }
+        return (n > ((r * r) + r)) ? (r + 1u) : r;
+    }
+
+    bool scaled_square_le(uint m, uint s, uint c_sq)
+    {
+        uint low = (m & 65535u) * s;
+        uint high = ((m >> 16u) * s) + (low >> 16u);
+        return (high < (c_sq << 4u)) || ((high == (c_sq << 4u)) && ((low & 65535u) == 0u));
+    }
+
+    uint renormalized_component(uint c_sq, uint s)
+    {
+        uint k = uint((512.0 * sqrt(float(c_sq) / float(s))) + 0.5);
+        while ((k > 0u) && (!scaled_square_le(((2u * k) - 1u) * ((2u * k) - 1u), s, c_sq)))
+        {
+            k--;
+        }
+        while (scaled_square_le(((2u * k) + 1u) * ((2u * k) + 1u), s, c_sq))
+        {
+            k++;
+        }
+        return k;
+    }
+
+    uint v2_rotation_to_smallest_three(uint offset)
+    {
+        ivec3 c = ivec3(int(plane_byte(offset) << 24u) >> 24, int(plane_byte(offset + 1u) << 24u) >> 24, int(plane_byte(offset + 2u) << 24u) >> 24);
+        int length_sq = ((c.x * c.x) + (c.y * c.y)) + (c.z * c.z);
+        int w_sq = max(16384 - length_sq, 0);
+        int squares[4] = int[](c.x * c.x, c.y * c.y, c.z * c.z, w_sq);
+        int components[4] = int[](4 * c.x, 4 * c.y, 4 * c.z, int(isqrt_round(16u * uint(w_sq))));
+        if (length_sq > 16384)
+        {
+            for (int k = 0; k < 3; k++)
+            {
+                int magnitude = int(renormalized_component(uint(squares[k]), uint(length_sq)));
+                components[k] = (c[k] < 0) ? (-magnitude) : magnitude;
+            }
+        }
+        uint largest = 0u;
+        for (uint j = 1u; j < 4u; j++)
+        {
+            if (squares[j] > squares[largest])
+            {
+                largest = j;
+            }
+        }
+        int sign_factor = (components[largest] < 0) ? (-1) : 1;
+        uint result = largest;
+        uint shift = 2u;
+        for (uint j_1 = 0u; j_1 < 4u; j_1++)
+        {
+            if (j_1 != largest)
+            {
+                result |= (uint(clamp((sign_factor * components[j_1]) + 512, 0, 1023)) << shift);
+                shift += 10u;
+            }
+        }
+        return result;
+    }
+
+    uvec4 decode_splat(uint j, out uvec3 position)
+    {
+        uint i = (decode_params[2].x != 0) ? _66.order[j].value : j;
+        uint chunk = (j / 256u) * 8u;
+        uint pos_offset = uint(decode_params[0].x) + (i * 9u);
+        ivec3 v = ivec3(plane_fixed24(pos_offset), -plane_fixed24(pos_offset + 3u), plane_fixed24(pos_offset + 6u));
+        for (uint k = 0u; k < 3u; k++)
+        {
+            position[k] = quantize_chunk_offset(uint(v[k] - int(_80.chunk_fixed[chunk + k].value)), _80.chunk_fixed[(chunk + 4u) + k].value);
+        }
+        uint rotation;
+        if (decode_params[1].w == 3)
+        {
+            uint rot_offset = uint(decode_params[1].x) + (i * 4u);
+            rotation = ((plane_byte(rot_offset) | (plane_byte(rot_offset + 1u) << 8u)) | (plane_byte(rot_offset + 2u) << 16u)) | (plane_byte(rot_offset + 3u) << 24u);
+        }
+        else
+        {
+            rotation = v2_rotation_to_smallest_three(uint(decode_params[1].x) + (i * 3u));
+        }
+        uint scale_offset = uint(decode_params[0].w) + (i * 3u);
+        uint color_offset = uint(decode_params[0].z) + (i * 3u);
+        return uvec4((position.x << 16u) | position.y, (position.z << 16u) | (rotation & 65535u), (((((rotation >> 16u) & 255u) << 24u) | (plane_byte(scale_offset) << 16u)) | (plane_byte(scale_offset + 1u) << 8u)) | (rotation >> 24u), (((plane_byte(color_offset) << 24u) | (plane_byte(color_offset + 1u) << 16u)) | (plane_byte(color_offset + 2u) << 8u)) | plane_byte(uint(decode_params[0].y) + i));
+    }
+
+    void main()
+    {
+        uint pair = (uint(decode_params[1].y) / 2u) + gl_GlobalInvocationID.x;
+        uint j = pair * 2u;
+        if (j >= uint(decode_params[1].z))
+        {
+            return;
+        }
+        uvec3 b = uvec3(0u);
+        uvec3 a;
+        uvec4 _610 = decode_splat(j, a);
+        _98.splats[j].value = _610;
+        bool has_b = (j + 1u) < uint(decode_params[1].z);
+        if (has_b)
+        {
+            uvec4 _630 = decode_splat(j + 1u, b);
+            _98.splats[j + 1u].value = _630;
+        }
+        uint word = pair * 3u;
+        _110.position_words[word].value = a.x | (a.y << 16u);
+        _110.position_words[word + 1u].value = a.z | (b.x << 16u);
+        if (has_b)
+        {
+            _110.position_words[word + 2u].value = b.y | (b.z << 16u);
+        }
+    }
+
+*/
+static const uint8_t spz_decode_source_glsl310es[5659] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x31,0x30,0x20,0x65,0x73,0x0a,
+    0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x6c,0x5f,0x73,0x69,0x7a,
+    0x65,0x5f,0x78,0x20,0x3d,0x20,0x32,0x35,0x36,0x2c,0x20,0x6c,0x6f,0x63,0x61,0x6c,
+    0x5f,0x73,0x69,0x7a,0x65,0x5f,0x79,0x20,0x3d,0x20,0x31,0x2c,0x20,0x6c,0x6f,0x63,
+    0x61,0x6c,0x5f,0x73,0x69,0x7a,0x65,0x5f,0x7a,0x20,0x3d,0x20,0x31,0x29,0x20,0x69,
+    0x6e,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x44,0x65,0x63,0x6f,0x64,
+    0x65,0x57,0x6f,0x72,0x64,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,
+    0x20,0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,
+    0x63,0x74,0x20,0x44,0x65,0x63,0x6f,0x64,0x65,0x54,0x65,0x78,0x65,0x6c,0x0a,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x75,0x76,0x65,0x63,0x34,0x20,0x76,0x61,0x6c,0x75,0x65,
+    0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x69,0x76,
+    0x65,0x63,0x34,0x20,0x64,0x65,0x63,0x6f,0x64,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x5b,0x33,0x5d,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x62,0x69,0x6e,
+    0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x32,0x2c,0x20,0x73,0x74,0x64,0x34,0x33,0x30,
+    0x29,0x20,0x72,0x65,0x61,0x64,0x6f,0x6e,0x6c,0x79,0x20,0x62,0x75,0x66,0x66,0x65,
+    0x72,0x20,0x73,0x70,0x7a,0x5f,0x70,0x6c,0x61,0x6e,0x65,0x73,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x44,0x65,0x63,0x6f,0x64,0x65,0x57,0x6f,0x72,0x64,0x20,0x70,0x6c,
+    0x61,0x6e,0x65,0x73,0x5b,0x5d,0x3b,0x0a,0x7d,0x20,0x5f,0x36,0x31,0x3b,0x0a,0x0a,
+    0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,
+    0x20,0x33,0x2c,0x20,0x73,0x74,0x64,0x34,0x33,0x30,0x29,0x20,0x72,0x65,0x61,0x64,
+    0x6f,0x6e,0x6c,0x79,0x20,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x73,0x70,0x7a,0x5f,
+    0x6f,0x72,0x64,0x65,0x72,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x44,0x65,0x63,0x6f,
+    0x64,0x65,0x57,0x6f,0x72,0x64,0x20,0x6f,0x72,0x64,0x65,0x72,0x5b,0x5d,0x3b,0x0a,
+    0x7d,0x20,0x5f,0x36,0x36,0x3b,0x0a,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x62,
+    0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x34,0x2c,0x20,0x73,0x74,0x64,0x34,
+    0x33,0x30,0x29,0x20,0x72,0x65,0x61,0x64,0x6f,0x6e,0x6c,0x79,0x20,0x62,0x75,0x66,
+    0x66,0x65,0x72,0x20,0x73,0x70,0x7a,0x5f,0x63,0x68,0x75,0x6e,0x6b,0x73,0x0a,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x44,0x65,0x63,0x6f,0x64,0x65,0x57,0x6f,0x72,0x64,0x20,
+    0x63,0x68,0x75,0x6e,0x6b,0x5f,0x66,0x69,0x78,0x65,0x64,0x5b,0x5d,0x3b,0x0a,0x7d,
+    0x20,0x5f,0x38,0x30,0x3b,0x0a,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x62,0x69,
+    0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x30,0x2c,0x20,0x73,0x74,0x64,0x34,0x33,
+    0x30,0x29,0x20,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,
+    0x62,0x75,0x66,0x66,0x65,0x72,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x44,0x65,0x63,
+    0x6f,0x64,0x65,0x54,0x65,0x78,0x65,0x6c,0x20,0x73,0x70,0x6c,0x61,0x74,0x73,0x5b,
+    0x5d,0x3b,0x0a,0x7d,0x20,0x5f,0x39,0x38,0x3b,0x0a,0x0a,0x6c,0x61,0x79,0x6f,0x75,
+    0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x31,0x2c,0x20,0x73,
+    0x74,0x64,0x34,0x33,0x30,0x29,0x20,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x70,0x6f,
+    0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x62,0x75,0x66,0x66,0x65,0x72,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x44,0x65,0x63,0x6f,0x64,0x65,0x57,0x6f,0x72,0x64,0x20,0x70,
+    0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x77,0x6f,0x72,0x64,0x73,0x5b,0x5d,0x3b,
+    0x0a,0x7d,0x20,0x5f,0x31,0x31,0x30,0x3b,0x0a,0x0a,0x75,0x69,0x6e,0x74,0x20,0x70,
+    0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,0x74,0x65,0x28,0x75,0x69,0x6e,0x74,0x20,0x6f,
+    0x66,0x66,0x73,0x65,0x74,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,
+    0x75,0x72,0x6e,0x20,0x28,0x5f,0x36,0x31,0x2e,0x70,0x6c,0x61,0x6e,0x65,0x73,0x5b,
+    0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x3e,0x3e,0x20,0x32,0x75,0x5d,0x2e,0x76,0x61,
+    0x6c,0x75,0x65,0x20,0x3e,0x3e,0x20,0x28,0x28,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,
+    0x26,0x20,0x33,0x75,0x29,0x20,0x2a,0x20,0x38,0x75,0x29,0x29,0x20,0x26,0x20,0x32,
+    0x35,0x35,0x75,0x3b,0x0a,0x7d,0x0a,0x0a,0x69,0x6e,0x74,0x20,0x70,0x6c,0x61,0x6e,
+    0x65,0x5f,0x66,0x69,0x78,0x65,0x64,0x32,0x34,0x28,0x75,0x69,0x6e,0x74,0x20,0x6f,
+    0x66,0x66,0x73,0x65,0x74,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,
+    0x74,0x20,0x72,0x61,0x77,0x20,0x3d,0x20,0x28,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,
+    0x79,0x74,0x65,0x28,0x6f,0x66,0x66,0x73,0x65,0x74,0x29,0x20,0x7c,0x20,0x28,0x70,
+    0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,0x74,0x65,0x28,0x6f,0x66,0x66,0x73,0x65,0x74,
+    0x20,0x2b,0x20,0x31,0x75,0x29,0x20,0x3c,0x3c,0x20,0x38,0x75,0x29,0x29,0x20,0x7c,
+    0x20,0x28,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,0x74,0x65,0x28,0x6f,0x66,0x66,
+    0x73,0x65,0x74,0x20,0x2b,0x20,0x32,0x75,0x29,0x20,0x3c,0x3c,0x20,0x31,0x36,0x75,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x69,0x6e,
+    0x74,0x28,0x72,0x61,0x77,0x20,0x3c,0x3c,0x20,0x38,0x75,0x29,0x20,0x3e,0x3e,0x20,
+    0x38,0x3b,0x0a,0x7d,0x0a,0x0a,0x75,0x69,0x6e,0x74,0x20,0x71,0x75,0x61,0x6e,0x74,
+    0x69,0x7a,0x65,0x5f,0x63,0x68,0x75,0x6e,0x6b,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,
+    0x28,0x75,0x69,0x6e,0x74,0x20,0x64,0x2c,0x20,0x75,0x69,0x6e,0x74,0x20,0x72,0x61,
+    0x6e,0x67,0x65,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x72,
+    0x61,0x6e,0x67,0x65,0x20,0x3d,0x3d,0x20,0x30,0x75,0x29,0x0a,0x20,0x20,0x20,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x20,0x30,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x75,
+    0x69,0x6e,0x74,0x20,0x71,0x20,0x3d,0x20,0x28,0x64,0x20,0x3e,0x3d,0x20,0x72,0x61,
+    0x6e,0x67,0x65,0x29,0x20,0x3f,0x20,0x31,0x75,0x20,0x3a,0x20,0x30,0x75,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x72,0x20,0x3d,0x20,0x64,0x20,0x2d,
+    0x20,0x28,0x71,0x20,0x2a,0x20,0x72,0x61,0x6e,0x67,0x65,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x62,0x69,0x74,0x20,0x3d,
+    0x20,0x30,0x3b,0x20,0x62,0x69,0x74,0x20,0x3c,0x20,0x31,0x36,0x3b,0x20,0x62,0x69,
+    0x74,0x2b,0x2b,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x72,0x20,0x3d,0x20,0x72,0x20,0x3c,0x3c,0x20,0x31,0x75,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x71,0x20,0x3d,0x20,0x71,0x20,0x3c,0x3c,
+    0x20,0x31,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
+    0x28,0x72,0x20,0x3e,0x3d,0x20,0x72,0x61,0x6e,0x67,0x65,0x29,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x72,0x20,0x2d,0x3d,0x20,0x72,0x61,0x6e,0x67,0x65,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x71,0x20,0x7c,0x3d,0x20,
+    0x31,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
+    0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x74,0x20,0x3d,0x20,
+    0x69,0x6e,0x74,0x28,0x72,0x20,0x2b,0x20,0x28,0x72,0x61,0x6e,0x67,0x65,0x20,0x3e,
+    0x3e,0x20,0x31,0x75,0x29,0x29,0x20,0x2d,0x20,0x69,0x6e,0x74,0x28,0x64,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,0x31,0x35,0x30,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x20,0x3e,0x3d,0x20,0x30,0x29,0x0a,
+    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x31,
+    0x35,0x30,0x20,0x3d,0x20,0x71,0x20,0x2b,0x20,0x28,0x75,0x69,0x6e,0x74,0x28,0x74,
+    0x29,0x20,0x2f,0x20,0x72,0x61,0x6e,0x67,0x65,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x31,0x35,0x30,0x20,0x3d,0x20,
+    0x71,0x20,0x2d,0x20,0x28,0x28,0x28,0x75,0x69,0x6e,0x74,0x28,0x2d,0x74,0x29,0x20,
+    0x2b,0x20,0x72,0x61,0x6e,0x67,0x65,0x29,0x20,0x2d,0x20,0x31,0x75,0x29,0x20,0x2f,
+    0x20,0x72,0x61,0x6e,0x67,0x65,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,
+    0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6d,0x69,0x6e,0x28,0x5f,0x31,
+    0x35,0x30,0x2c,0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,
+    0x75,0x69,0x6e,0x74,0x20,0x69,0x73,0x71,0x72,0x74,0x5f,0x72,0x6f,0x75,0x6e,0x64,
+    0x28,0x75,0x69,0x6e,0x74,0x20,0x6e,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,
+    0x69,0x6e,0x74,0x20,0x72,0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,0x28,0x73,0x71,0x72,
+    0x74,0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x6e,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x28,0x72,0x20,0x2a,0x20,0x72,0x29,
+    0x20,0x3e,0x20,0x6e,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x72,0x2d,0x2d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,
+    0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x28,0x28,0x72,0x20,0x2b,0x20,
+    0x31,0x75,0x29,0x20,0x2a,0x20,0x28,0x72,0x20,0x2b,0x20,0x31,0x75,0x29,0x29,0x20,
+    0x3c,0x3d,0x20,0x6e,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x72,0x2b,0x2b,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,
+    0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x28,0x6e,0x20,0x3e,0x20,0x28,
+    0x28,0x72,0x20,0x2a,0x20,0x72,0x29,0x20,0x2b,0x20,0x72,0x29,0x29,0x20,0x3f,0x20,
+    0x28,0x72,0x20,0x2b,0x20,0x31,0x75,0x29,0x20,0x3a,0x20,0x72,0x3b,0x0a,0x7d,0x0a,
+    0x0a,0x62,0x6f,0x6f,0x6c,0x20,0x73,0x63,0x61,0x6c,0x65,0x64,0x5f,0x73,0x71,0x75,
+    0x61,0x72,0x65,0x5f,0x6c,0x65,0x28,0x75,0x69,0x6e,0x74,0x20,0x6d,0x2c,0x20,0x75,
+    0x69,0x6e,0x74,0x20,0x73,0x2c,0x20,0x75,0x69,0x6e,0x74,0x20,0x63,0x5f,0x73,0x71,
+    0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x6c,0x6f,0x77,
+    0x20,0x3d,0x20,0x28,0x6d,0x20,0x26,0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x20,
+    0x2a,0x20,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x68,0x69,
+    0x67,0x68,0x20,0x3d,0x20,0x28,0x28,0x6d,0x20,0x3e,0x3e,0x20,0x31,0x36,0x75,0x29,
+    0x20,0x2a,0x20,0x73,0x29,0x20,0x2b,0x20,0x28,0x6c,0x6f,0x77,0x20,0x3e,0x3e,0x20,
+    0x31,0x36,0x75,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x20,0x28,0x68,0x69,0x67,0x68,0x20,0x3c,0x20,0x28,0x63,0x5f,0x73,0x71,0x20,0x3c,
+    0x3c,0x20,0x34,0x75,0x29,0x29,0x20,0x7c,0x7c,0x20,0x28,0x28,0x68,0x69,0x67,0x68,
+    0x20,0x3d,0x3d,0x20,0x28,0x63,0x5f,0x73,0x71,0x20,0x3c,0x3c,0x20,0x34,0x75,0x29,
+    0x29,0x20,0x26,0x26,0x20,0x28,0x28,0x6c,0x6f,0x77,0x20,0x26,0x20,0x36,0x35,0x35,
+    0x33,0x35,0x75,0x29,0x20,0x3d,0x3d,0x20,0x30,0x75,0x29,0x29,0x3b,0x0a,0x7d,0x0a,
+    0x0a,0x75,0x69,0x6e,0x74,0x20,0x72,0x65,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,
+    0x65,0x64,0x5f,0x63,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,0x74,0x28,0x75,0x69,0x6e,
+    0x74,0x20,0x63,0x5f,0x73,0x71,0x2c,0x20,0x75,0x69,0x6e,0x74,0x20,0x73,0x29,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x6b,0x20,0x3d,0x20,0x75,
+    0x69,0x6e,0x74,0x28,0x28,0x35,0x31,0x32,0x2e,0x30,0x20,0x2a,0x20,0x73,0x71,0x72,
+    0x74,0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x63,0x5f,0x73,0x71,0x29,0x20,0x2f,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x28,0x73,0x29,0x29,0x29,0x20,0x2b,0x20,0x30,0x2e,0x35,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x28,0x6b,
+    0x20,0x3e,0x20,0x30,0x75,0x29,0x20,0x26,0x26,0x20,0x28,0x21,0x73,0x63,0x61,0x6c,
+    0x65,0x64,0x5f,0x73,0x71,0x75,0x61,0x72,0x65,0x5f,0x6c,0x65,0x28,0x28,0x28,0x32,
+    0x75,0x20,0x2a,0x20,0x6b,0x29,0x20,0x2d,0x20,0x31,0x75,0x29,0x20,0x2a,0x20,0x28,
+    0x28,0x32,0x75,0x20,0x2a,0x20,0x6b,0x29,0x20,0x2d,0x20,0x31,0x75,0x29,0x2c,0x20,
+    0x73,0x2c,0x20,0x63,0x5f,0x73,0x71,0x29,0x29,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6b,0x2d,0x2d,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x73,
+    0x63,0x61,0x6c,0x65,0x64,0x5f,0x73,0x71,0x75,0x61,0x72,0x65,0x5f,0x6c,0x65,0x28,
+    0x28,0x28,0x32,0x75,0x20,0x2a,0x20,0x6b,0x29,0x20,0x2b,0x20,0x31,0x75,0x29,0x20,
+    0x2a,0x20,0x28,0x28,0x32,0x75,0x20,0x2a,0x20,0x6b,0x29,0x20,0x2b,0x20,0x31,0x75,
+    0x29,0x2c,0x20,0x73,0x2c,0x20,0x63,0x5f,0x73,0x71,0x29,0x29,0x0a,0x20,0x20,0x20,
+    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6b,0x2b,0x2b,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x20,0x6b,0x3b,0x0a,0x7d,0x0a,0x0a,0x75,0x69,0x6e,0x74,0x20,0x76,0x32,0x5f,0x72,
+    0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x5f,0x74,0x6f,0x5f,0x73,0x6d,0x61,0x6c,0x6c,
+    0x65,0x73,0x74,0x5f,0x74,0x68,0x72,0x65,0x65,0x28,0x75,0x69,0x6e,0x74,0x20,0x6f,
+    0x66,0x66,0x73,0x65,0x74,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x76,0x65,
+    0x63,0x33,0x20,0x63,0x20,0x3d,0x20,0x69,0x76,0x65,0x63,0x33,0x28,0x69,0x6e,0x74,
+    0x28,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,0x74,0x65,0x28,0x6f,0x66,0x66,0x73,
+    0x65,0x74,0x29,0x20,0x3c,0x3c,0x20,0x32,0x34,0x75,0x29,0x20,0x3e,0x3e,0x20,0x32,
+    0x34,0x2c,0x20,0x69,0x6e,0x74,0x28,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,0x74,
+    0x65,0x28,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x2b,0x20,0x31,0x75,0x29,0x20,0x3c,
+    0x3c,0x20,0x32,0x34,0x75,0x29,0x20,0x3e,0x3e,0x20,0x32,0x34,0x2c,0x20,0x69,0x6e,
+    0x74,0x28,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,0x74,0x65,0x28,0x6f,0x66,0x66,
+    0x73,0x65,0x74,0x20,0x2b,0x20,0x32,0x75,0x29,0x20,0x3c,0x3c,0x20,0x32,0x34,0x75,
+    0x29,0x20,0x3e,0x3e,0x20,0x32,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,
+    0x74,0x20,0x6c,0x65,0x6e,0x67,0x74,0x68,0x5f,0x73,0x71,0x20,0x3d,0x20,0x28,0x28,
+    0x63,0x2e,0x78,0x20,0x2a,0x20,0x63,0x2e,0x78,0x29,0x20,0x2b,0x20,0x28,0x63,0x2e,
+    0x79,0x20,0x2a,0x20,0x63,0x2e,0x79,0x29,0x29,0x20,0x2b,0x20,0x28,0x63,0x2e,0x7a,
+    0x20,0x2a,0x20,0x63,0x2e,0x7a,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,
+    0x20,0x77,0x5f,0x73,0x71,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x31,0x36,0x33,0x38,
+    0x34,0x20,0x2d,0x20,0x6c,0x65,0x6e,0x67,0x74,0x68,0x5f,0x73,0x71,0x2c,0x20,0x30,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x73,0x71,0x75,0x61,0x72,
+    0x65,0x73,0x5b,0x34,0x5d,0x20,0x3d,0x20,0x69,0x6e,0x74,0x5b,0x5d,0x28,0x63,0x2e,
+    0x78,0x20,0x2a,0x20,0x63,0x2e,0x78,0x2c,0x20,0x63,0x2e,0x79,0x20,0x2a,0x20,0x63,
+    0x2e,0x79,0x2c,0x20,0x63,0x2e,0x7a,0x20,0x2a,0x20,0x63,0x2e,0x7a,0x2c,0x20,0x77,
+    0x5f,0x73,0x71,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x63,0x6f,
+    0x6d,0x70,0x6f,0x6e,0x65,0x6e,0x74,0x73,0x5b,0x34,0x5d,0x20,0x3d,0x20,0x69,0x6e,
+    0x74,0x5b,0x5d,0x28,0x34,0x20,0x2a,0x20,0x63,0x2e,0x78,0x2c,0x20,0x34,0x20,0x2a,
+    0x20,0x63,0x2e,0x79,0x2c,0x20,0x34,0x20,0x2a,0x20,0x63,0x2e,0x7a,0x2c,0x20,0x69,
+    0x6e,0x74,0x28,0x69,0x73,0x71,0x72,0x74,0x5f,0x72,0x6f,0x75,0x6e,0x64,0x28,0x31,
+    0x36,0x75,0x20,0x2a,0x20,0x75,0x69,0x6e,0x74,0x28,0x77,0x5f,0x73,0x71,0x29,0x29,
+    0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x6c,0x65,0x6e,0x67,
+    0x74,0x68,0x5f,0x73,0x71,0x20,0x3e,0x20,0x31,0x36,0x33,0x38,0x34,0x29,0x0a,0x20,
+    0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,
+    0x20,0x28,0x69,0x6e,0x74,0x20,0x6b,0x20,0x3d,0x20,0x30,0x3b,0x20,0x6b,0x20,0x3c,
+    0x20,0x33,0x3b,0x20,0x6b,0x2b,0x2b,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,
+    0x6e,0x74,0x20,0x6d,0x61,0x67,0x6e,0x69,0x74,0x75,0x64,0x65,0x20,0x3d,0x20,0x69,
+    0x6e,0x74,0x28,0x72,0x65,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x64,0x5f,
+    0x63,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,0x74,0x28,0x75,0x69,0x6e,0x74,0x28,0x73,
+    0x71,0x75,0x61,0x72,0x65,0x73,0x5b,0x6b,0x5d,0x29,0x2c,0x20,0x75,0x69,0x6e,0x74,
+    0x28,0x6c,0x65,0x6e,0x67,0x74,0x68,0x5f,0x73,0x71,0x29,0x29,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6f,0x6d,0x70,0x6f,
+    0x6e,0x65,0x6e,0x74,0x73,0x5b,0x6b,0x5d,0x20,0x3d,0x20,0x28,0x63,0x5b,0x6b,0x5d,
+    0x20,0x3c,0x20,0x30,0x29,0x20,0x3f,0x20,0x28,0x2d,0x6d,0x61,0x67,0x6e,0x69,0x74,
+    0x75,0x64,0x65,0x29,0x20,0x3a,0x20,0x6d,0x61,0x67,0x6e,0x69,0x74,0x75,0x64,0x65,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
+    0x7d,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x6c,0x61,0x72,0x67,0x65,
+    0x73,0x74,0x20,0x3d,0x20,0x30,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,
+    0x20,0x28,0x75,0x69,0x6e,0x74,0x20,0x6a,0x20,0x3d,0x20,0x31,0x75,0x3b,0x20,0x6a,
+    0x20,0x3c,0x20,0x34,0x75,0x3b,0x20,0x6a,0x2b,0x2b,0x29,0x0a,0x20,0x20,0x20,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x73,0x71,
+    0x75,0x61,0x72,0x65,0x73,0x5b,0x6a,0x5d,0x20,0x3e,0x20,0x73,0x71,0x75,0x61,0x72,
+    0x65,0x73,0x5b,0x6c,0x61,0x72,0x67,0x65,0x73,0x74,0x5d,0x29,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x6c,0x61,0x72,0x67,0x65,0x73,0x74,0x20,0x3d,0x20,0x6a,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,
+    0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x73,0x69,0x67,0x6e,0x5f,0x66,0x61,0x63,
+    0x74,0x6f,0x72,0x20,0x3d,0x20,0x28,0x63,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,0x74,
+    0x73,0x5b,0x6c,0x61,0x72,0x67,0x65,0x73,0x74,0x5d,0x20,0x3c,0x20,0x30,0x29,0x20,
+    0x3f,0x20,0x28,0x2d,0x31,0x29,0x20,0x3a,0x20,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x75,0x69,0x6e,0x74,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x3d,0x20,0x6c,0x61,
+    0x72,0x67,0x65,0x73,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,
+    0x73,0x68,0x69,0x66,0x74,0x20,0x3d,0x20,0x32,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6f,0x72,0x20,0x28,0x75,0x69,0x6e,0x74,0x20,0x6a,0x5f,0x31,0x20,0x3d,0x20,
+    0x30,0x75,0x3b,0x20,0x6a,0x5f,0x31,0x20,0x3c,0x20,0x34,0x75,0x3b,0x20,0x6a,0x5f,
+    0x31,0x2b,0x2b,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x6a,0x5f,0x31,0x20,0x21,0x3d,0x20,0x6c,0x61,
+    0x72,0x67,0x65,0x73,0x74,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x73,
+    0x75,0x6c,0x74,0x20,0x7c,0x3d,0x20,0x28,0x75,0x69,0x6e,0x74,0x28,0x63,0x6c,0x61,
+    0x6d,0x70,0x28,0x28,0x73,0x69,0x67,0x6e,0x5f,0x66,0x61,0x63,0x74,0x6f,0x72,0x20,
+    0x2a,0x20,0x63,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,0x74,0x73,0x5b,0x6a,0x5f,0x31,
+    0x5d,0x29,0x20,0x2b,0x20,0x35,0x31,0x32,0x2c,0x20,0x30,0x2c,0x20,0x31,0x30,0x32,
+    0x33,0x29,0x29,0x20,0x3c,0x3c,0x20,0x73,0x68,0x69,0x66,0x74,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x68,0x69,0x66,0x74,
+    0x20,0x2b,0x3d,0x20,0x31,0x30,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,
+    0x75,0x72,0x6e,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x75,
+    0x76,0x65,0x63,0x34,0x20,0x64,0x65,0x63,0x6f,0x64,0x65,0x5f,0x73,0x70,0x6c,0x61,
+    0x74,0x28,0x75,0x69,0x6e,0x74,0x20,0x6a,0x2c,0x20,0x6f,0x75,0x74,0x20,0x75,0x76,
+    0x65,0x63,0x33,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x29,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x69,0x20,0x3d,0x20,0x28,0x64,0x65,
+    0x63,0x6f,0x64,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x32,0x5d,0x2e,0x78,
+    0x20,0x21,0x3d,0x20,0x30,0x29,0x20,0x3f,0x20,0x5f,0x36,0x36,0x2e,0x6f,0x72,0x64,
+    0x65,0x72,0x5b,0x6a,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3a,0x20,0x6a,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x63,0x68,0x75,0x6e,0x6b,0x20,
+    0x3d,0x20,0x28,0x6a,0x20,0x2f,0x20,0x32,0x35,0x36,0x75,0x29,0x20,0x2a,0x20,0x38,
+    0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x70,0x6f,0x73,0x5f,
+    0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,0x28,0x64,0x65,
+    0x63,0x6f,0x64,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x78,
+    0x29,0x20,0x2b,0x20,0x28,0x69,0x20,0x2a,0x20,0x39,0x75,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x76,0x65,0x63,0x33,0x20,0x76,0x20,0x3d,0x20,0x69,0x76,0x65,0x63,
+    0x33,0x28,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x66,0x69,0x78,0x65,0x64,0x32,0x34,0x28,
+    0x70,0x6f,0x73,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x29,0x2c,0x20,0x2d,0x70,0x6c,
+    0x61,0x6e,0x65,0x5f,0x66,0x69,0x78,0x65,0x64,0x32,0x34,0x28,0x70,0x6f,0x73,0x5f,
+    0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x2b,0x20,0x33,0x75,0x29,0x2c,0x20,0x70,0x6c,
+    0x61,0x6e,0x65,0x5f,0x66,0x69,0x78,0x65,0x64,0x32,0x34,0x28,0x70,0x6f,0x73,0x5f,
+    0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x2b,0x20,0x36,0x75,0x29,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x75,0x69,0x6e,0x74,0x20,0x6b,0x20,0x3d,
+    0x20,0x30,0x75,0x3b,0x20,0x6b,0x20,0x3c,0x20,0x33,0x75,0x3b,0x20,0x6b,0x2b,0x2b,
+    0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5b,0x6b,0x5d,0x20,0x3d,0x20,0x71,0x75,
+    0x61,0x6e,0x74,0x69,0x7a,0x65,0x5f,0x63,0x68,0x75,0x6e,0x6b,0x5f,0x6f,0x66,0x66,
+    0x73,0x65,0x74,0x28,0x75,0x69,0x6e,0x74,0x28,0x76,0x5b,0x6b,0x5d,0x20,0x2d,0x20,
+    0x69,0x6e,0x74,0x28,0x5f,0x38,0x30,0x2e,0x63,0x68,0x75,0x6e,0x6b,0x5f,0x66,0x69,
+    0x78,0x65,0x64,0x5b,0x63,0x68,0x75,0x6e,0x6b,0x20,0x2b,0x20,0x6b,0x5d,0x2e,0x76,
+    0x61,0x6c,0x75,0x65,0x29,0x29,0x2c,0x20,0x5f,0x38,0x30,0x2e,0x63,0x68,0x75,0x6e,
+    0x6b,0x5f,0x66,0x69,0x78,0x65,0x64,0x5b,0x28,0x63,0x68,0x75,0x6e,0x6b,0x20,0x2b,
+    0x20,0x34,0x75,0x29,0x20,0x2b,0x20,0x6b,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,
+    0x20,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,
+    0x66,0x20,0x28,0x64,0x65,0x63,0x6f,0x64,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
+    0x5b,0x31,0x5d,0x2e,0x77,0x20,0x3d,0x3d,0x20,0x33,0x29,0x0a,0x20,0x20,0x20,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x72,
+    0x6f,0x74,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,
+    0x28,0x64,0x65,0x63,0x6f,0x64,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,
+    0x5d,0x2e,0x78,0x29,0x20,0x2b,0x20,0x28,0x69,0x20,0x2a,0x20,0x34,0x75,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,
+    0x6e,0x20,0x3d,0x20,0x28,0x28,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,0x74,0x65,
+    0x28,0x72,0x6f,0x74,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x29,0x20,0x7c,0x20,0x28,
+    0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,0x74,0x65,0x28,0x72,0x6f,0x74,0x5f,0x6f,
+    0x66,0x66,0x73,0x65,0x74,0x20,0x2b,0x20,0x31,0x75,0x29,0x20,0x3c,0x3c,0x20,0x38,
+    0x75,0x29,0x29,0x20,0x7c,0x20,0x28,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,0x74,
+    0x65,0x28,0x72,0x6f,0x74,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x2b,0x20,0x32,
+    0x75,0x29,0x20,0x3c,0x3c,0x20,0x31,0x36,0x75,0x29,0x29,0x20,0x7c,0x20,0x28,0x70,
+    0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,0x74,0x65,0x28,0x72,0x6f,0x74,0x5f,0x6f,0x66,
+    0x66,0x73,0x65,0x74,0x20,0x2b,0x20,0x33,0x75,0x29,0x20,0x3c,0x3c,0x20,0x32,0x34,
+    0x75,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,
+    0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x76,0x32,0x5f,0x72,
+    0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x5f,0x74,0x6f,0x5f,0x73,0x6d,0x61,0x6c,0x6c,
+    0x65,0x73,0x74,0x5f,0x74,0x68,0x72,0x65,0x65,0x28,0x75,0x69,0x6e,0x74,0x28,0x64,
+    0x65,0x63,0x6f,0x64,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2e,
+    0x78,0x29,0x20,0x2b,0x20,0x28,0x69,0x20,0x2a,0x20,0x33,0x75,0x29,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x73,
+    0x63,0x61,0x6c,0x65,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x3d,0x20,0x75,0x69,
+    0x6e,0x74,0x28,0x64,0x65,0x63,0x6f,0x64,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
+    0x5b,0x30,0x5d,0x2e,0x77,0x29,0x20,0x2b,0x20,0x28,0x69,0x20,0x2a,0x20,0x33,0x75,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x63,0x6f,0x6c,0x6f,
+    0x72,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,0x28,
+    0x64,0x65,0x63,0x6f,0x64,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,
+    0x2e,0x7a,0x29,0x20,0x2b,0x20,0x28,0x69,0x20,0x2a,0x20,0x33,0x75,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x75,0x76,0x65,0x63,0x34,
+    0x28,0x28,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2e,0x78,0x20,0x3c,0x3c,0x20,
+    0x31,0x36,0x75,0x29,0x20,0x7c,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2e,
+    0x79,0x2c,0x20,0x28,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2e,0x7a,0x20,0x3c,
+    0x3c,0x20,0x31,0x36,0x75,0x29,0x20,0x7c,0x20,0x28,0x72,0x6f,0x74,0x61,0x74,0x69,
+    0x6f,0x6e,0x20,0x26,0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x2c,0x20,0x28,0x28,
+    0x28,0x28,0x28,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3e,0x3e,0x20,0x31,
+    0x36,0x75,0x29,0x20,0x26,0x20,0x32,0x35,0x35,0x75,0x29,0x20,0x3c,0x3c,0x20,0x32,
+    0x34,0x75,0x29,0x20,0x7c,0x20,0x28,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,0x74,
+    0x65,0x28,0x73,0x63,0x61,0x6c,0x65,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x29,0x20,
+    0x3c,0x3c,0x20,0x31,0x36,0x75,0x29,0x29,0x20,0x7c,0x20,0x28,0x70,0x6c,0x61,0x6e,
+    0x65,0x5f,0x62,0x79,0x74,0x65,0x28,0x73,0x63,0x61,0x6c,0x65,0x5f,0x6f,0x66,0x66,
+    0x73,0x65,0x74,0x20,0x2b,0x20,0x31,0x75,0x29,0x20,0x3c,0x3c,0x20,0x38,0x75,0x29,
+    0x29,0x20,0x7c,0x20,0x28,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3e,0x3e,
+    0x20,0x32,0x34,0x75,0x29,0x2c,0x20,0x28,0x28,0x28,0x70,0x6c,0x61,0x6e,0x65,0x5f,
+    0x62,0x79,0x74,0x65,0x28,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,0x66,0x66,0x73,0x65,
+    0x74,0x29,0x20,0x3c,0x3c,0x20,0x32,0x34,0x75,0x29,0x20,0x7c,0x20,0x28,0x70,0x6c,
+    0x61,0x6e,0x65,0x5f,0x62,0x79,0x74,0x65,0x28,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,
+    0x66,0x66,0x73,0x65,0x74,0x20,0x2b,0x20,0x31,0x75,0x29,0x20,0x3c,0x3c,0x20,0x31,
+    0x36,0x75,0x29,0x29,0x20,0x7c,0x20,0x28,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,
+    0x74,0x65,0x28,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,
+    0x2b,0x20,0x32,0x75,0x29,0x20,0x3c,0x3c,0x20,0x38,0x75,0x29,0x29,0x20,0x7c,0x20,
+    0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,0x74,0x65,0x28,0x75,0x69,0x6e,0x74,0x28,
+    0x64,0x65,0x63,0x6f,0x64,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,
+    0x2e,0x79,0x29,0x20,0x2b,0x20,0x69,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x6f,
+    0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x75,0x69,0x6e,0x74,0x20,0x70,0x61,0x69,0x72,0x20,0x3d,0x20,0x28,0x75,0x69,0x6e,
+    0x74,0x28,0x64,0x65,0x63,0x6f,0x64,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,
+    0x31,0x5d,0x2e,0x79,0x29,0x20,0x2f,0x20,0x32,0x75,0x29,0x20,0x2b,0x20,0x67,0x6c,
+    0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,
+    0x6e,0x49,0x44,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,
+    0x6a,0x20,0x3d,0x20,0x70,0x61,0x69,0x72,0x20,0x2a,0x20,0x32,0x75,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x6a,0x20,0x3e,0x3d,0x20,0x75,0x69,0x6e,0x74,
+    0x28,0x64,0x65,0x63,0x6f,0x64,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,
+    0x5d,0x2e,0x7a,0x29,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x7d,0x0a,0x20,0x20,0x20,0x20,0x75,0x76,0x65,0x63,0x33,0x20,0x62,0x20,0x3d,0x20,
+    0x75,0x76,0x65,0x63,0x33,0x28,0x30,0x75,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,
+    0x76,0x65,0x63,0x33,0x20,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x76,0x65,0x63,
+    0x34,0x20,0x5f,0x36,0x31,0x30,0x20,0x3d,0x20,0x64,0x65,0x63,0x6f,0x64,0x65,0x5f,
+    0x73,0x70,0x6c,0x61,0x74,0x28,0x6a,0x2c,0x20,0x61,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x5f,0x39,0x38,0x2e,0x73,0x70,0x6c,0x61,0x74,0x73,0x5b,0x6a,0x5d,0x2e,0x76,
+    0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x5f,0x36,0x31,0x30,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x62,0x6f,0x6f,0x6c,0x20,0x68,0x61,0x73,0x5f,0x62,0x20,0x3d,0x20,0x28,0x6a,
+    0x20,0x2b,0x20,0x31,0x75,0x29,0x20,0x3c,0x20,0x75,0x69,0x6e,0x74,0x28,0x64,0x65,
+    0x63,0x6f,0x64,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2e,0x7a,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x68,0x61,0x73,0x5f,0x62,
+    0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x75,0x76,0x65,0x63,0x34,0x20,0x5f,0x36,0x33,0x30,0x20,0x3d,0x20,0x64,0x65,0x63,
+    0x6f,0x64,0x65,0x5f,0x73,0x70,0x6c,0x61,0x74,0x28,0x6a,0x20,0x2b,0x20,0x31,0x75,
+    0x2c,0x20,0x62,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x39,
+    0x38,0x2e,0x73,0x70,0x6c,0x61,0x74,0x73,0x5b,0x6a,0x20,0x2b,0x20,0x31,0x75,0x5d,
+    0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x5f,0x36,0x33,0x30,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x77,0x6f,
+    0x72,0x64,0x20,0x3d,0x20,0x70,0x61,0x69,0x72,0x20,0x2a,0x20,0x33,0x75,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x5f,0x31,0x31,0x30,0x2e,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,
+    0x6e,0x5f,0x77,0x6f,0x72,0x64,0x73,0x5b,0x77,0x6f,0x72,0x64,0x5d,0x2e,0x76,0x61,
+    0x6c,0x75,0x65,0x20,0x3d,0x20,0x61,0x2e,0x78,0x20,0x7c,0x20,0x28,0x61,0x2e,0x79,
+    0x20,0x3c,0x3c,0x20,0x31,0x36,0x75,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x5f,0x31,
+    0x31,0x30,0x2e,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x77,0x6f,0x72,0x64,
+    0x73,0x5b,0x77,0x6f,0x72,0x64,0x20,0x2b,0x20,0x31,0x75,0x5d,0x2e,0x76,0x61,0x6c,
+    0x75,0x65,0x20,0x3d,0x20,0x61,0x2e,0x7a,0x20,0x7c,0x20,0x28,0x62,0x2e,0x78,0x20,
+    0x3c,0x3c,0x20,0x31,0x36,0x75,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
+    0x28,0x68,0x61,0x73,0x5f,0x62,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x31,0x31,0x30,0x2e,0x70,0x6f,0x73,0x69,0x74,
+    0x69,0x6f,0x6e,0x5f,0x77,0x6f,0x72,0x64,0x73,0x5b,0x77,0x6f,0x72,0x64,0x20,0x2b,
+    0x20,0x32,0x75,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x62,0x2e,0x79,
+    0x20,0x7c,0x20,0x28,0x62,0x2e,0x7a,0x20,0x3c,0x3c,0x20,0x31,0x36,0x75,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    struct DecodeWord
+    {
+        uint value;
+    };
+
+    struct DecodeTexel
+    {
+        uint4 value;
+    };
+
+    static const uint3 gl_WorkGroupSize = uint3(256u, 1u, 1u);
+
+    cbuffer decode_params : register(b0)
+    {
+        int _40_positions_offset : packoffset(c0);
+        int _40_alphas_offset : packoffset(c0.y);
+        int _40_colors_offset : packoffset(c0.z);
+        int _40_scales_offset : packoffset(c0.w);
+        int _40_rotations_offset : packoffset(c1);
+        int _40_first_splat : packoffset(c1.y);
+        int _40_end_splat : packoffset(c1.z);
+        int _40_version : packoffset(c1.w);
+        int _40_use_order : packoffset(c2);
+        int _40_pad0 : packoffset(c2.y);
+        int _40_pad1 : packoffset(c2.z);
+        int _40_pad2 : packoffset(c2.w);
+    };
+
+    ByteAddressBuffer _61 : register(t0);
+    ByteAddressBuffer _66 : register(t1);
+    ByteAddressBuffer _80 : register(t2);
+    RWByteAddressBuffer _98 : register(u0);
+    RWByteAddressBuffer _110 : register(u1);
+
+    static uint3 gl_GlobalInvocationID;
+    struct SPIRV_Cross_Input
+    {
+        uint3 gl_GlobalInvocationID : SV_DispatchThreadID;
+    };
+
+    uint plane_byte(uint offset)
+    {
+        return (_61.Load((offset >> 2u) * 4 + 0) >> ((offset & 3u) * 8u)) & 255u;
+    }
+
+    int plane_fixed24(uint offset)
+    {
+        uint raw = (plane_byte(offset) | (plane_byte(offset + 1u) << 8u)) | (plane_byte(offset + 2u) << 16u);
+        return int(raw << 8u) >> 8;
+    }
+
+    uint quantize_chunk_offset(uint d, uint range)
+    {
+        if (range == 0u)
+        {
+            return 0u;
+        }
+        uint q = (d >= range) ? 1u : 0u;
+        uint r = d - (q * range);
+        for (int bit = 0; bit < 16; bit++)
+        {
+            r = r << 1u;
+            q = q << 1u;
+            if (r >= range)
+            {
+                r -= range;
+                q |= 1u;
+            }
+        }
+        int t = int(r + (range >> 1u)) - int(d);
+        uint _150;
+        if (t >= 0)
+        {
+            _150 = q + (uint(t) / range);
+        }
+        else
+        {
+            _150 = q - (((uint(-t) + range) - 1u) / range);
+        }
+        return min(_150, 65535u);
+    }
+
+    uint isqrt_round(uint n)
+    {
+        uint r = uint(sqrt(float(n)));
+        while ((r * r) > n)
+        {
+            r--;
+        }
+        while (((r + 1u) * (r + 1u)) <= n)
+        {
+            r++;
+        }
+        return (n > ((r * r) + r)) ? (r + 1u) : r;
+    }
+
+    bool scaled_square_le(uint m, uint s, uint c_sq)
+    {
+        uint low = (m & 65535u) * s;
+        uint high = ((m >> 16u) * s) + (low >> 16u);
+        return (high < (c_sq << 4u)) || ((high == (c_sq << 4u)) && ((low & 65535u) == 0u));
+    }
+
+    uint renormalized_component(uint c_sq, uint s)
+    {
+        uint k = uint((512.0f * sqrt(float(c_sq) / float(s))) + 0.5f);
+        while ((k > 0u) && (!scaled_square_le(((2u * k) - 1u) * ((2u * k) - 1u), s, c_sq)))
+        {
+            k--;
+        }
+        while (scaled_square_le(((2u * k) + 1u) * ((2u * k) + 1u), s, c_sq))
+        {
+            k++;
+        }
+        return k;
+    }
+
+    uint v2_rotation_to_smallest_three(uint offset)
+    {
+        int3 c = int3(int(plane_byte(offset) << 24u) >> 24, int(plane_byte(offset + 1u) << 24u) >> 24, int(plane_byte(offset + 2u) << 24u) >> 24);
+        int length_sq = ((c.x * c.x) + (c.y * c.y)) + (c.z * c.z);
+        int w_sq = max(16384 - length_sq, 0);
+        int squares[4] = { c.x * c.x, c.y * c.y, c.z * c.z, w_sq };
+        int components[4] = { 4 * c.x, 4 * c.y, 4 * c.z, int(isqrt_round(16u * uint(w_sq))) };
+        if (length_sq > 16384)
+        {
+            for (int k = 0; k < 3; k++)
+            {
+                int magnitude = int(renormalized_component(uint(squares[k]), uint(length_sq)));
+                components[k] = (c[k] < 0) ? (-magnitude) : magnitude;
+            }
+        }
+        uint largest = 0u;
+        for (uint j = 1u; j < 4u; j++)
+        {
+            if (squares[j] > squares[largest])
+            {
+                largest = j;
+            }
+        }
+        int sign_factor = (components[largest] < 0) ? (-1) : 1;
+        uint result = largest;
+        uint shift = 2u;
+        for (uint j_1 = 0u; j_1 < 4u; j_1++)
+        {
+            if (j_1 != largest)
+            {
+                result |= (uint(clamp((sign_factor * components[j_1]) + 512, 0, 1023)) << shift);
+                shift += 10u;
+            }
+        }
+        return result;
+    }
+
+    uint4 decode_splat(uint j, out uint3 position)
+    {
+        uint i = (_40_use_order != 0) ? _66.Load((j) * 4 + 0) : j;
+        uint chunk = (j / 256u) * 8u;
+        uint pos_offset = uint(_40_positions_offset) + (i * 9u);
+        int3 v = int3(plane_fixed24(pos_offset), -plane_fixed24(pos_offset + 3u), plane_fixed24(pos_offset + 6u));
+        for (uint k = 0u; k < 3u; k++)
+        {
+            position[k] = quantize_chunk_offset(uint(v[k] - int(_80.Load((chunk + k) * 4 + 0))), _80.Load(((chunk + 4u) + k) * 4 + 0));
+        }
+        uint rotation;
+        if (_40_version == 3)
+        {
+            uint rot_offset = uint(_40_rotations_offset) + (i * 4u);
+            rotation = ((plane_byte(rot_offset) | (plane_byte(rot_offset + 1u) << 8u)) | (plane_byte(rot_offset + 2u) << 16u)) | (plane_byte(rot_offset + 3u) << 24u);
+        }
+        else
+        {
+            rotation = v2_rotation_to_smallest_three(uint(_40_rotations_offset) + (i * 3u));
+        }
+        uint scale_offset = uint(_40_scales_offset) + (i * 3u);
+        uint color_offset = uint(_40_colors_offset) + (i * 3u);
+        return uint4((position.x << 16u) | position.y, (position.z << 16u) | (rotation & 65535u), (((((rotation >> 16u) & 255u) << 24u) | (plane_byte(scale_offset) << 16u)) | (plane_byte(scale_offset + 1u) << 8u)) | (rotation >> 24u), (((plane_byte(color_offset) << 24u) | (plane_byte(color_offset + 1u) << 16u)) | (plane_byte(color_offset + 2u) << 8u)) | plane_byte(uint(_40_alphas_offset) + i));
+    }
+
+    void comp_main()
+    {
+        uint pair = (uint(_40_first_splat) / 2u) + gl_GlobalInvocationID.x;
+        uint j = pair * 2u;
+        if (j >= uint(_40_end_splat))
+        {
+            return;
+        }
+        uint3 b = uint3(0u);
+        uint3 a;
+        uint4 _610 = decode_splat(j, a);
+        _98.Store4((j) * 16 + 0, _610);
+        bool has_b = (j + 1u) < uint(_40_end_splat);
+        if (has_b)
+        {
+            uint4 _630 = decode_splat(j + 1u, b);
+            _98.Store4((j + 1u) * 16 + 0, _630);
+        }
+        uint word = pair * 3u;
+        _110.Store((word) * 4 + 0, a.x | (a.y << 16u));
+        _110.Store((word + 1u) * 4 + 0, a.z | (b.x << 16u));
+        if (has_b)
+        {
+            _110.Store((word + 2u) * 4 + 0, b.y | (b.z << 16u));
+        }
+    }
+
+    [numthreads(256, 1, 1)]
+    void main(SPIRV_Cross_Input stage_input)
+    {
+        gl_GlobalInvocationID = stage_input.gl_GlobalInvocationID;
+        comp_main();
+    }
+*/
+static const uint8_t spz_decode_source_hlsl5[6134] = {
+    0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x44,0x65,0x63,0x6f,0x64,0x65,0x57,0x6f,0x72,
+    0x64,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x76,0x61,0x6c,
+    0x75,0x65,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x44,
+    0x65,0x63,0x6f,0x64,0x65,0x54,0x65,0x78,0x65,0x6c,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x75,0x69,0x6e,0x74,0x34,0x20,0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,0x7d,0x3b,
+    0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x75,
+    0x69,0x6e,0x74,0x33,0x20,0x67,0x6c,0x5f,0x57,0x6f,0x72,0x6b,0x47,0x72,0x6f,0x75,
+    0x70,0x53,0x69,0x7a,0x65,0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,0x33,0x28,0x32,0x35,
+    0x36,0x75,0x2c,0x20,0x31,0x75,0x2c,0x20,0x31,0x75,0x29,0x3b,0x0a,0x0a,0x63,0x62,
+    0x75,0x66,0x66,0x65,0x72,0x20,0x64,0x65,0x63,0x6f,0x64,0x65,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x73,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x62,
+    0x30,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x5f,0x34,0x30,
+    0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x73,0x5f,0x6f,0x66,0x66,0x73,0x65,
+    0x74,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,
+    0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x5f,0x34,0x30,0x5f,
+    0x61,0x6c,0x70,0x68,0x61,0x73,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x3a,0x20,
+    0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x30,0x2e,0x79,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x5f,0x34,0x30,0x5f,0x63,0x6f,
+    0x6c,0x6f,0x72,0x73,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x3a,0x20,0x70,0x61,
+    0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x30,0x2e,0x7a,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x5f,0x34,0x30,0x5f,0x73,0x63,0x61,0x6c,
+    0x65,0x73,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,
+    0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x30,0x2e,0x77,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x6e,0x74,0x20,0x5f,0x34,0x30,0x5f,0x72,0x6f,0x74,0x61,0x74,0x69,
+    0x6f,0x6e,0x73,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x3a,0x20,0x70,0x61,0x63,
+    0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x31,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x69,0x6e,0x74,0x20,0x5f,0x34,0x30,0x5f,0x66,0x69,0x72,0x73,0x74,0x5f,0x73,
+    0x70,0x6c,0x61,0x74,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,
+    0x74,0x28,0x63,0x31,0x2e,0x79,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,
+    0x20,0x5f,0x34,0x30,0x5f,0x65,0x6e,0x64,0x5f,0x73,0x70,0x6c,0x61,0x74,0x20,0x3a,
+    0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x31,0x2e,0x7a,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x5f,0x34,0x30,0x5f,0x76,
+    0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,
+    0x73,0x65,0x74,0x28,0x63,0x31,0x2e,0x77,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,
+    0x6e,0x74,0x20,0x5f,0x34,0x30,0x5f,0x75,0x73,0x65,0x5f,0x6f,0x72,0x64,0x65,0x72,
+    0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x32,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x5f,0x34,0x30,0x5f,0x70,
+    0x61,0x64,0x30,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,
+    0x28,0x63,0x32,0x2e,0x79,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,
+    0x5f,0x34,0x30,0x5f,0x70,0x61,0x64,0x31,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,
+    0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x32,0x2e,0x7a,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x69,0x6e,0x74,0x20,0x5f,0x34,0x30,0x5f,0x70,0x61,0x64,0x32,0x20,0x3a,0x20,
+    0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x32,0x2e,0x77,0x29,
+    0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x42,0x79,0x74,0x65,0x41,0x64,0x64,0x72,0x65,0x73,
+    0x73,0x42,0x75,0x66,0x66,0x65,0x72,0x20,0x5f,0x36,0x31,0x20,0x3a,0x20,0x72,0x65,
+    0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x74,0x30,0x29,0x3b,0x0a,0x42,0x79,0x74,0x65,
+    0x41,0x64,0x64,0x72,0x65,0x73,0x73,0x42,0x75,0x66,0x66,0x65,0x72,0x20,0x5f,0x36,
+    0x36,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x74,0x31,0x29,
+    0x3b,0x0a,0x42,0x79,0x74,0x65,0x41,0x64,0x64,0x72,0x65,0x73,0x73,0x42,0x75,0x66,
+    0x66,0x65,0x72,0x20,0x5f,0x38,0x30,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,
+    0x65,0x72,0x28,0x74,0x32,0x29,0x3b,0x0a,0x52,0x57,0x42,0x79,0x74,0x65,0x41,0x64,
+    0x64,0x72,0x65,0x73,0x73,0x42,0x75,0x66,0x66,0x65,0x72,0x20,0x5f,0x39,0x38,0x20,
+    0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x75,0x30,0x29,0x3b,0x0a,
+    0x52,0x57,0x42,0x79,0x74,0x65,0x41,0x64,0x64,0x72,0x65,0x73,0x73,0x42,0x75,0x66,
+    0x66,0x65,0x72,0x20,0x5f,0x31,0x31,0x30,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,
+    0x74,0x65,0x72,0x28,0x75,0x31,0x29,0x3b,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,
+    0x20,0x75,0x69,0x6e,0x74,0x33,0x20,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,
+    0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x3b,0x0a,0x73,0x74,
+    0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,
+    0x5f,0x49,0x6e,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,
+    0x74,0x33,0x20,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,
+    0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x20,0x3a,0x20,0x53,0x56,0x5f,0x44,0x69,
+    0x73,0x70,0x61,0x74,0x63,0x68,0x54,0x68,0x72,0x65,0x61,0x64,0x49,0x44,0x3b,0x0a,
+    0x7d,0x3b,0x0a,0x0a,0x75,0x69,0x6e,0x74,0x20,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,
+    0x79,0x74,0x65,0x28,0x75,0x69,0x6e,0x74,0x20,0x6f,0x66,0x66,0x73,0x65,0x74,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x28,0x5f,
+    0x36,0x31,0x2e,0x4c,0x6f,0x61,0x64,0x28,0x28,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,
+    0x3e,0x3e,0x20,0x32,0x75,0x29,0x20,0x2a,0x20,0x34,0x20,0x2b,0x20,0x30,0x29,0x20,
+    0x3e,0x3e,0x20,0x28,0x28,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x26,0x20,0x33,0x75,
+    0x29,0x20,0x2a,0x20,0x38,0x75,0x29,0x29,0x20,0x26,0x20,0x32,0x35,0x35,0x75,0x3b,
+    0x0a,0x7d,0x0a,0x0a,0x69,0x6e,0x74,0x20,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x66,0x69,
+    0x78,0x65,0x64,0x32,0x34,0x28,0x75,0x69,0x6e,0x74,0x20,0x6f,0x66,0x66,0x73,0x65,
+    0x74,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x72,0x61,
+    0x77,0x20,0x3d,0x20,0x28,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,0x74,0x65,0x28,
+    0x6f,0x66,0x66,0x73,0x65,0x74,0x29,0x20,0x7c,0x20,0x28,0x70,0x6c,0x61,0x6e,0x65,
+    0x5f,0x62,0x79,0x74,0x65,0x28,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x2b,0x20,0x31,
+    0x75,0x29,0x20,0x3c,0x3c,0x20,0x38,0x75,0x29,0x29,0x20,0x7c,0x20,0x28,0x70,0x6c,
+    0x61,0x6e,0x65,0x5f,0x62,0x79,0x74,0x65,0x28,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,
+    0x2b,0x20,0x32,0x75,0x29,0x20,0x3c,0x3c,0x20,0x31,0x36,0x75,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x69,0x6e,0x74,0x28,0x72,0x61,
+    0x77,0x20,0x3c,0x3c,0x20,0x38,0x75,0x29,0x20,0x3e,0x3e,0x20,0x38,0x3b,0x0a,0x7d,
+    0x0a,0x0a,0x75,0x69,0x6e,0x74,0x20,0x71,0x75,0x61,0x6e,0x74,0x69,0x7a,0x65,0x5f,
+    0x63,0x68,0x75,0x6e,0x6b,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x75,0x69,0x6e,
+    0x74,0x20,0x64,0x2c,0x20,0x75,0x69,0x6e,0x74,0x20,0x72,0x61,0x6e,0x67,0x65,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x72,0x61,0x6e,0x67,0x65,
+    0x20,0x3d,0x3d,0x20,0x30,0x75,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x30,0x75,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,
+    0x71,0x20,0x3d,0x20,0x28,0x64,0x20,0x3e,0x3d,0x20,0x72,0x61,0x6e,0x67,0x65,0x29,
+    0x20,0x3f,0x20,0x31,0x75,0x20,0x3a,0x20,0x30,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x75,0x69,0x6e,0x74,0x20,0x72,0x20,0x3d,0x20,0x64,0x20,0x2d,0x20,0x28,0x71,0x20,
+    0x2a,0x20,0x72,0x61,0x6e,0x67,0x65,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,
+    0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x62,0x69,0x74,0x20,0x3d,0x20,0x30,0x3b,0x20,
+    0x62,0x69,0x74,0x20,0x3c,0x20,0x31,0x36,0x3b,0x20,0x62,0x69,0x74,0x2b,0x2b,0x29,
+    0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,
+    0x20,0x3d,0x20,0x72,0x20,0x3c,0x3c,0x20,0x31,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x71,0x20,0x3d,0x20,0x71,0x20,0x3c,0x3c,0x20,0x31,0x75,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x72,0x20,0x3e,
+    0x3d,0x20,0x72,0x61,0x6e,0x67,0x65,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,
+    0x20,0x2d,0x3d,0x20,0x72,0x61,0x6e,0x67,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x71,0x20,0x7c,0x3d,0x20,0x31,0x75,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,
+    0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x74,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,
+    0x72,0x20,0x2b,0x20,0x28,0x72,0x61,0x6e,0x67,0x65,0x20,0x3e,0x3e,0x20,0x31,0x75,
+    0x29,0x29,0x20,0x2d,0x20,0x69,0x6e,0x74,0x28,0x64,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,0x31,0x35,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x69,0x66,0x20,0x28,0x74,0x20,0x3e,0x3d,0x20,0x30,0x29,0x0a,0x20,0x20,0x20,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x31,0x35,0x30,0x20,0x3d,
+    0x20,0x71,0x20,0x2b,0x20,0x28,0x75,0x69,0x6e,0x74,0x28,0x74,0x29,0x20,0x2f,0x20,
+    0x72,0x61,0x6e,0x67,0x65,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
+    0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x5f,0x31,0x35,0x30,0x20,0x3d,0x20,0x71,0x20,0x2d,0x20,
+    0x28,0x28,0x28,0x75,0x69,0x6e,0x74,0x28,0x2d,0x74,0x29,0x20,0x2b,0x20,0x72,0x61,
+    0x6e,0x67,0x65,0x29,0x20,0x2d,0x20,0x31,0x75,0x29,0x20,0x2f,0x20,0x72,0x61,0x6e,
+    0x67,0x65,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,
+    0x65,0x74,0x75,0x72,0x6e,0x20,0x6d,0x69,0x6e,0x28,0x5f,0x31,0x35,0x30,0x2c,0x20,
+    0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x75,0x69,0x6e,0x74,
+    0x20,0x69,0x73,0x71,0x72,0x74,0x5f,0x72,0x6f,0x75,0x6e,0x64,0x28,0x75,0x69,0x6e,
+    0x74,0x20,0x6e,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,
+    0x72,0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,0x28,0x73,0x71,0x72,0x74,0x28,0x66,0x6c,
+    0x6f,0x61,0x74,0x28,0x6e,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x77,0x68,
+    0x69,0x6c,0x65,0x20,0x28,0x28,0x72,0x20,0x2a,0x20,0x72,0x29,0x20,0x3e,0x20,0x6e,
+    0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x72,0x2d,0x2d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x77,
+    0x68,0x69,0x6c,0x65,0x20,0x28,0x28,0x28,0x72,0x20,0x2b,0x20,0x31,0x75,0x29,0x20,
+    0x2a,0x20,0x28,0x72,0x20,0x2b,0x20,0x31,0x75,0x29,0x29,0x20,0x3c,0x3d,0x20,0x6e,
+    0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x72,0x2b,0x2b,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,
+    0x65,0x74,0x75,0x72,0x6e,0x20,0x28,0x6e,0x20,0x3e,0x20,0x28,0x28,0x72,0x20,0x2a,
+    0x20,0x72,0x29,0x20,0x2b,0x20,0x72,0x29,0x29,0x20,0x3f,0x20,0x28,0x72,0x20,0x2b,
+    0x20,0x31,0x75,0x29,0x20,0x3a,0x20,0x72,0x3b,0x0a,0x7d,0x0a,0x0a,0x62,0x6f,0x6f,
+    0x6c,0x20,0x73,0x63,0x61,0x6c,0x65,0x64,0x5f,0x73,0x71,0x75,0x61,0x72,0x65,0x5f,
+    0x6c,0x65,0x28,0x75,0x69,0x6e,0x74,0x20,0x6d,0x2c,0x20,0x75,0x69,0x6e,0x74,0x20,
+    0x73,0x2c,0x20,0x75,0x69,0x6e,0x74,0x20,0x63,0x5f,0x73,0x71,0x29,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x6c,0x6f,0x77,0x20,0x3d,0x20,0x28,
+    0x6d,0x20,0x26,0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x20,0x2a,0x20,0x73,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x68,0x69,0x67,0x68,0x20,0x3d,
+    0x20,0x28,0x28,0x6d,0x20,0x3e,0x3e,0x20,0x31,0x36,0x75,0x29,0x20,0x2a,0x20,0x73,
+    0x29,0x20,0x2b,0x20,0x28,0x6c,0x6f,0x77,0x20,0x3e,0x3e,0x20,0x31,0x36,0x75,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x28,0x68,0x69,
+    0x67,0x68,0x20,0x3c,0x20,0x28,0x63,0x5f,0x73,0x71,0x20,0x3c,0x3c,0x20,0x34,0x75,
+    0x29,0x29,0x20,0x7c,0x7c,0x20,0x28,0x28,0x68,0x69,0x67,0x68,0x20,0x3d,0x3d,0x20,
+    0x28,0x63,0x5f,0x73,0x71,0x20,0x3c,0x3c,0x20,0x34,0x75,0x29,0x29,0x20,0x26,0x26,
+    0x20,0x28,0x28,0x6c,0x6f,0x77,0x20,0x26,0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x29,
+    0x20,0x3d,0x3d,0x20,0x30,0x75,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x75,0x69,0x6e,
+    0x74,0x20,0x72,0x65,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x64,0x5f,0x63,
+    0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,0x74,0x28,0x75,0x69,0x6e,0x74,0x20,0x63,0x5f,
+    0x73,0x71,0x2c,0x20,0x75,0x69,0x6e,0x74,0x20,0x73,0x29,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x6b,0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,0x28,
+    0x28,0x35,0x31,0x32,0x2e,0x30,0x66,0x20,0x2a,0x20,0x73,0x71,0x72,0x74,0x28,0x66,
+    0x6c,0x6f,0x61,0x74,0x28,0x63,0x5f,0x73,0x71,0x29,0x20,0x2f,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x28,0x73,0x29,0x29,0x29,0x20,0x2b,0x20,0x30,0x2e,0x35,0x66,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x28,0x6b,0x20,0x3e,
+    0x20,0x30,0x75,0x29,0x20,0x26,0x26,0x20,0x28,0x21,0x73,0x63,0x61,0x6c,0x65,0x64,
+    0x5f,0x73,0x71,0x75,0x61,0x72,0x65,0x5f,0x6c,0x65,0x28,0x28,0x28,0x32,0x75,0x20,
+    0x2a,0x20,0x6b,0x29,0x20,0x2d,0x20,0x31,0x75,0x29,0x20,0x2a,0x20,0x28,0x28,0x32,
+    0x75,0x20,0x2a,0x20,0x6b,0x29,0x20,0x2d,0x20,0x31,0x75,0x29,0x2c,0x20,0x73,0x2c,
+    0x20,0x63,0x5f,0x73,0x71,0x29,0x29,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6b,0x2d,0x2d,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x7d,0x0a,0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x73,0x63,0x61,
+    0x6c,0x65,0x64,0x5f,0x73,0x71,0x75,0x61,0x72,0x65,0x5f,0x6c,0x65,0x28,0x28,0x28,
+    0x32,0x75,0x20,0x2a,0x20,0x6b,0x29,0x20,0x2b,0x20,0x31,0x75,0x29,0x20,0x2a,0x20,
+    0x28,0x28,0x32,0x75,0x20,0x2a,0x20,0x6b,0x29,0x20,0x2b,0x20,0x31,0x75,0x29,0x2c,
+    0x20,0x73,0x2c,0x20,0x63,0x5f,0x73,0x71,0x29,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6b,0x2b,0x2b,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6b,
+    0x3b,0x0a,0x7d,0x0a,0x0a,0x75,0x69,0x6e,0x74,0x20,0x76,0x32,0x5f,0x72,0x6f,0x74,
+    0x61,0x74,0x69,0x6f,0x6e,0x5f,0x74,0x6f,0x5f,0x73,0x6d,0x61,0x6c,0x6c,0x65,0x73,
+    0x74,0x5f,0x74,0x68,0x72,0x65,0x65,0x28,0x75,0x69,0x6e,0x74,0x20,0x6f,0x66,0x66,
+    0x73,0x65,0x74,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x33,0x20,
+    0x63,0x20,0x3d,0x20,0x69,0x6e,0x74,0x33,0x28,0x69,0x6e,0x74,0x28,0x70,0x6c,0x61,
+    0x6e,0x65,0x5f,0x62,0x79,0x74,0x65,0x28,0x6f,0x66,0x66,0x73,0x65,0x74,0x29,0x20,
+    0x3c,0x3c,0x20,0x32,0x34,0x75,0x29,0x20,0x3e,0x3e,0x20,0x32,0x34,0x2c,0x20,0x69,
+    0x6e,0x74,0x28,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,0x74,0x65,0x28,0x6f,0x66,
+    0x66,0x73,0x65,0x74,0x20,0x2b,0x20,0x31,0x75,0x29,0x20,0x3c,0x3c,0x20,0x32,0x34,
+    0x75,0x29,0x20,0x3e,0x3e,0x20,0x32,0x34,0x2c,0x20,0x69,0x6e,0x74,0x28,0x70,0x6c,
+    0x61,0x6e,0x65,0x5f,0x62,0x79,0x74,0x65,0x28,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,
+    0x2b,0x20,0x32,0x75,0x29,0x20,0x3c,0x3c,0x20,0x32,0x34,0x75,0x29,0x20,0x3e,0x3e,
+    0x20,0x32,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x6c,0x65,
+    0x6e,0x67,0x74,0x68,0x5f,0x73,0x71,0x20,0x3d,0x20,0x28,0x28,0x63,0x2e,0x78,0x20,
+    0x2a,0x20,0x63,0x2e,0x78,0x29,0x20,0x2b,0x20,0x28,0x63,0x2e,0x79,0x20,0x2a,0x20,
+    0x63,0x2e,0x79,0x29,0x29,0x20,0x2b,0x20,0x28,0x63,0x2e,0x7a,0x20,0x2a,0x20,0x63,
+    0x2e,0x7a,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x77,0x5f,0x73,
+    0x71,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x31,0x36,0x33,0x38,0x34,0x20,0x2d,0x20,
+    0x6c,0x65,0x6e,0x67,0x74,0x68,0x5f,0x73,0x71,0x2c,0x20,0x30,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x73,0x71,0x75,0x61,0x72,0x65,0x73,0x5b,0x34,
+    0x5d,0x20,0x3d,0x20,0x7b,0x20,0x63,0x2e,0x78,0x20,0x2a,0x20,0x63,0x2e,0x78,0x2c,
+    0x20,0x63,0x2e,0x79,0x20,0x2a,0x20,0x63,0x2e,0x79,0x2c,0x20,0x63,0x2e,0x7a,0x20,
+    0x2a,0x20,0x63,0x2e,0x7a,0x2c,0x20,0x77,0x5f,0x73,0x71,0x20,0x7d,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x63,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,0x74,
+    0x73,0x5b,0x34,0x5d,0x20,0x3d,0x20,0x7b,0x20,0x34,0x20,0x2a,0x20,0x63,0x2e,0x78,
+    0x2c,0x20,0x34,0x20,0x2a,0x20,0x63,0x2e,0x79,0x2c,0x20,0x34,0x20,0x2a,0x20,0x63,
+    0x2e,0x7a,0x2c,0x20,0x69,0x6e,0x74,0x28,0x69,0x73,0x71,0x72,0x74,0x5f,0x72,0x6f,
+    0x75,0x6e,0x64,0x28,0x31,0x36,0x75,0x20,0x2a,0x20,0x75,0x69,0x6e,0x74,0x28,0x77,
+    0x5f,0x73,0x71,0x29,0x29,0x29,0x20,0x7d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,
+    0x20,0x28,0x6c,0x65,0x6e,0x67,0x74,0x68,0x5f,0x73,0x71,0x20,0x3e,0x20,0x31,0x36,
+    0x33,0x38,0x34,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x6b,0x20,0x3d,0x20,
+    0x30,0x3b,0x20,0x6b,0x20,0x3c,0x20,0x33,0x3b,0x20,0x6b,0x2b,0x2b,0x29,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x6d,0x61,0x67,0x6e,0x69,0x74,0x75,
+    0x64,0x65,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,0x72,0x65,0x6e,0x6f,0x72,0x6d,0x61,
+    0x6c,0x69,0x7a,0x65,0x64,0x5f,0x63,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,0x74,0x28,
+    0x75,0x69,0x6e,0x74,0x28,0x73,0x71,0x75,0x61,0x72,0x65,0x73,0x5b,0x6b,0x5d,0x29,
+    0x2c,0x20,0x75,0x69,0x6e,0x74,0x28,0x6c,0x65,0x6e,0x67,0x74,0x68,0x5f,0x73,0x71,
+    0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x63,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,0x74,0x73,0x5b,0x6b,0x5d,0x20,0x3d,
+    0x20,0x28,0x63,0x5b,0x6b,0x5d,0x20,0x3c,0x20,0x30,0x29,0x20,0x3f,0x20,0x28,0x2d,
+    0x6d,0x61,0x67,0x6e,0x69,0x74,0x75,0x64,0x65,0x29,0x20,0x3a,0x20,0x6d,0x61,0x67,
+    0x6e,0x69,0x74,0x75,0x64,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x7d,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,
+    0x20,0x6c,0x61,0x72,0x67,0x65,0x73,0x74,0x20,0x3d,0x20,0x30,0x75,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x75,0x69,0x6e,0x74,0x20,0x6a,0x20,0x3d,
+    0x20,0x31,0x75,0x3b,0x20,0x6a,0x20,0x3c,0x20,0x34,0x75,0x3b,0x20,0x6a,0x2b,0x2b,
+    0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x69,0x66,0x20,0x28,0x73,0x71,0x75,0x61,0x72,0x65,0x73,0x5b,0x6a,0x5d,0x20,0x3e,
+    0x20,0x73,0x71,0x75,0x61,0x72,0x65,0x73,0x5b,0x6c,0x61,0x72,0x67,0x65,0x73,0x74,
+    0x5d,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6c,0x61,0x72,0x67,0x65,0x73,0x74,
+    0x20,0x3d,0x20,0x6a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,
+    0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x73,0x69,
+    0x67,0x6e,0x5f,0x66,0x61,0x63,0x74,0x6f,0x72,0x20,0x3d,0x20,0x28,0x63,0x6f,0x6d,
+    0x70,0x6f,0x6e,0x65,0x6e,0x74,0x73,0x5b,0x6c,0x61,0x72,0x67,0x65,0x73,0x74,0x5d,
+    0x20,0x3c,0x20,0x30,0x29,0x20,0x3f,0x20,0x28,0x2d,0x31,0x29,0x20,0x3a,0x20,0x31,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x72,0x65,0x73,0x75,0x6c,
+    0x74,0x20,0x3d,0x20,0x6c,0x61,0x72,0x67,0x65,0x73,0x74,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x75,0x69,0x6e,0x74,0x20,0x73,0x68,0x69,0x66,0x74,0x20,0x3d,0x20,0x32,0x75,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x75,0x69,0x6e,0x74,0x20,
+    0x6a,0x5f,0x31,0x20,0x3d,0x20,0x30,0x75,0x3b,0x20,0x6a,0x5f,0x31,0x20,0x3c,0x20,
+    0x34,0x75,0x3b,0x20,0x6a,0x5f,0x31,0x2b,0x2b,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x6a,0x5f,0x31,
+    0x20,0x21,0x3d,0x20,0x6c,0x61,0x72,0x67,0x65,0x73,0x74,0x29,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x7c,0x3d,0x20,0x28,0x75,0x69,
+    0x6e,0x74,0x28,0x63,0x6c,0x61,0x6d,0x70,0x28,0x28,0x73,0x69,0x67,0x6e,0x5f,0x66,
+    0x61,0x63,0x74,0x6f,0x72,0x20,0x2a,0x20,0x63,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,
+    0x74,0x73,0x5b,0x6a,0x5f,0x31,0x5d,0x29,0x20,0x2b,0x20,0x35,0x31,0x32,0x2c,0x20,
+    0x30,0x2c,0x20,0x31,0x30,0x32,0x33,0x29,0x29,0x20,0x3c,0x3c,0x20,0x73,0x68,0x69,
+    0x66,0x74,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x73,0x68,0x69,0x66,0x74,0x20,0x2b,0x3d,0x20,0x31,0x30,0x75,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,
+    0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,
+    0x3b,0x0a,0x7d,0x0a,0x0a,0x75,0x69,0x6e,0x74,0x34,0x20,0x64,0x65,0x63,0x6f,0x64,
+    0x65,0x5f,0x73,0x70,0x6c,0x61,0x74,0x28,0x75,0x69,0x6e,0x74,0x20,0x6a,0x2c,0x20,
+    0x6f,0x75,0x74,0x20,0x75,0x69,0x6e,0x74,0x33,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x69,
+    0x20,0x3d,0x20,0x28,0x5f,0x34,0x30,0x5f,0x75,0x73,0x65,0x5f,0x6f,0x72,0x64,0x65,
+    0x72,0x20,0x21,0x3d,0x20,0x30,0x29,0x20,0x3f,0x20,0x5f,0x36,0x36,0x2e,0x4c,0x6f,
+    0x61,0x64,0x28,0x28,0x6a,0x29,0x20,0x2a,0x20,0x34,0x20,0x2b,0x20,0x30,0x29,0x20,
+    0x3a,0x20,0x6a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x63,0x68,
+    0x75,0x6e,0x6b,0x20,0x3d,0x20,0x28,0x6a,0x20,0x2f,0x20,0x32,0x35,0x36,0x75,0x29,
+    0x20,0x2a,0x20,0x38,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,
+    0x70,0x6f,0x73,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x3d,0x20,0x75,0x69,0x6e,
+    0x74,0x28,0x5f,0x34,0x30,0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x73,0x5f,
+    0x6f,0x66,0x66,0x73,0x65,0x74,0x29,0x20,0x2b,0x20,0x28,0x69,0x20,0x2a,0x20,0x39,
+    0x75,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x33,0x20,0x76,0x20,0x3d,
+    0x20,0x69,0x6e,0x74,0x33,0x28,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x66,0x69,0x78,0x65,
+    0x64,0x32,0x34,0x28,0x70,0x6f,0x73,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x29,0x2c,
+    0x20,0x2d,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x66,0x69,0x78,0x65,0x64,0x32,0x34,0x28,
+    0x70,0x6f,0x73,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x2b,0x20,0x33,0x75,0x29,
+    0x2c,0x20,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x66,0x69,0x78,0x65,0x64,0x32,0x34,0x28,
+    0x70,0x6f,0x73,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x2b,0x20,0x36,0x75,0x29,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x75,0x69,0x6e,0x74,
+    0x20,0x6b,0x20,0x3d,0x20,0x30,0x75,0x3b,0x20,0x6b,0x20,0x3c,0x20,0x33,0x75,0x3b,
+    0x20,0x6b,0x2b,0x2b,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5b,0x6b,0x5d,0x20,
+    0x3d,0x20,0x71,0x75,0x61,0x6e,0x74,0x69,0x7a,0x65,0x5f,0x63,0x68,0x75,0x6e,0x6b,
+    0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x75,0x69,0x6e,0x74,0x28,0x76,0x5b,0x6b,
+    0x5d,0x20,0x2d,0x20,0x69,0x6e,0x74,0x28,0x5f,0x38,0x30,0x2e,0x4c,0x6f,0x61,0x64,
+    0x28,0x28,0x63,0x68,0x75,0x6e,0x6b,0x20,0x2b,0x20,0x6b,0x29,0x20,0x2a,0x20,0x34,
+    0x20,0x2b,0x20,0x30,0x29,0x29,0x29,0x2c,0x20,0x5f,0x38,0x30,0x2e,0x4c,0x6f,0x61,
+    0x64,0x28,0x28,0x28,0x63,0x68,0x75,0x6e,0x6b,0x20,0x2b,0x20,0x34,0x75,0x29,0x20,
+    0x2b,0x20,0x6b,0x29,0x20,0x2a,0x20,0x34,0x20,0x2b,0x20,0x30,0x29,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x72,
+    0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
+    0x28,0x5f,0x34,0x30,0x5f,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x3d,0x3d,0x20,
+    0x33,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x75,0x69,0x6e,0x74,0x20,0x72,0x6f,0x74,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,
+    0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,0x28,0x5f,0x34,0x30,0x5f,0x72,0x6f,0x74,0x61,
+    0x74,0x69,0x6f,0x6e,0x73,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x29,0x20,0x2b,0x20,
+    0x28,0x69,0x20,0x2a,0x20,0x34,0x75,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x28,0x28,0x70,
+    0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,0x74,0x65,0x28,0x72,0x6f,0x74,0x5f,0x6f,0x66,
+    0x66,0x73,0x65,0x74,0x29,0x20,0x7c,0x20,0x28,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,
+    0x79,0x74,0x65,0x28,0x72,0x6f,0x74,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x2b,
+    0x20,0x31,0x75,0x29,0x20,0x3c,0x3c,0x20,0x38,0x75,0x29,0x29,0x20,0x7c,0x20,0x28,
+    0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,0x74,0x65,0x28,0x72,0x6f,0x74,0x5f,0x6f,
+    0x66,0x66,0x73,0x65,0x74,0x20,0x2b,0x20,0x32,0x75,0x29,0x20,0x3c,0x3c,0x20,0x31,
+    0x36,0x75,0x29,0x29,0x20,0x7c,0x20,0x28,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,
+    0x74,0x65,0x28,0x72,0x6f,0x74,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x2b,0x20,
+    0x33,0x75,0x29,0x20,0x3c,0x3c,0x20,0x32,0x34,0x75,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x6f,0x74,0x61,0x74,0x69,
+    0x6f,0x6e,0x20,0x3d,0x20,0x76,0x32,0x5f,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,
+    0x5f,0x74,0x6f,0x5f,0x73,0x6d,0x61,0x6c,0x6c,0x65,0x73,0x74,0x5f,0x74,0x68,0x72,
+    0x65,0x65,0x28,0x75,0x69,0x6e,0x74,0x28,0x5f,0x34,0x30,0x5f,0x72,0x6f,0x74,0x61,
+    0x74,0x69,0x6f,0x6e,0x73,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x29,0x20,0x2b,0x20,
+    0x28,0x69,0x20,0x2a,0x20,0x33,0x75,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,
+    0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x73,0x63,0x61,0x6c,0x65,0x5f,
+    0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,0x28,0x5f,0x34,
+    0x30,0x5f,0x73,0x63,0x61,0x6c,0x65,0x73,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x29,
+    0x20,0x2b,0x20,0x28,0x69,0x20,0x2a,0x20,0x33,0x75,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x75,0x69,0x6e,0x74,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,0x66,0x66,0x73,
+    0x65,0x74,0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,0x28,0x5f,0x34,0x30,0x5f,0x63,0x6f,
+    0x6c,0x6f,0x72,0x73,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x29,0x20,0x2b,0x20,0x28,
+    0x69,0x20,0x2a,0x20,0x33,0x75,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,
+    0x75,0x72,0x6e,0x20,0x75,0x69,0x6e,0x74,0x34,0x28,0x28,0x70,0x6f,0x73,0x69,0x74,
+    0x69,0x6f,0x6e,0x2e,0x78,0x20,0x3c,0x3c,0x20,0x31,0x36,0x75,0x29,0x20,0x7c,0x20,
+    0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2e,0x79,0x2c,0x20,0x28,0x70,0x6f,0x73,
+    0x69,0x74,0x69,0x6f,0x6e,0x2e,0x7a,0x20,0x3c,0x3c,0x20,0x31,0x36,0x75,0x29,0x20,
+    0x7c,0x20,0x28,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x20,0x26,0x20,0x36,0x35,
+    0x35,0x33,0x35,0x75,0x29,0x2c,0x20,0x28,0x28,0x28,0x28,0x28,0x72,0x6f,0x74,0x61,
+    0x74,0x69,0x6f,0x6e,0x20,0x3e,0x3e,0x20,0x31,0x36,0x75,0x29,0x20,0x26,0x20,0x32,
+    0x35,0x35,0x75,0x29,0x20,0x3c,0x3c,0x20,0x32,0x34,0x75,0x29,0x20,0x7c,0x20,0x28,
+    0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,0x74,0x65,0x28,0x73,0x63,0x61,0x6c,0x65,
+    0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x29,0x20,0x3c,0x3c,0x20,0x31,0x36,0x75,0x29,
+    0x29,0x20,0x7c,0x20,0x28,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,0x74,0x65,0x28,
+    0x73,0x63,0x61,0x6c,0x65,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x2b,0x20,0x31,
+    0x75,0x29,0x20,0x3c,0x3c,0x20,0x38,0x75,0x29,0x29,0x20,0x7c,0x20,0x28,0x72,0x6f,
+    0x74,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3e,0x3e,0x20,0x32,0x34,0x75,0x29,0x2c,0x20,
+    0x28,0x28,0x28,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,0x74,0x65,0x28,0x63,0x6f,
+    0x6c,0x6f,0x72,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x29,0x20,0x3c,0x3c,0x20,0x32,
+    0x34,0x75,0x29,0x20,0x7c,0x20,0x28,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,0x74,
+    0x65,0x28,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x2b,
+    0x20,0x31,0x75,0x29,0x20,0x3c,0x3c,0x20,0x31,0x36,0x75,0x29,0x29,0x20,0x7c,0x20,
+    0x28,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,0x74,0x65,0x28,0x63,0x6f,0x6c,0x6f,
+    0x72,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x2b,0x20,0x32,0x75,0x29,0x20,0x3c,
+    0x3c,0x20,0x38,0x75,0x29,0x29,0x20,0x7c,0x20,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,
+    0x79,0x74,0x65,0x28,0x75,0x69,0x6e,0x74,0x28,0x5f,0x34,0x30,0x5f,0x61,0x6c,0x70,
+    0x68,0x61,0x73,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x29,0x20,0x2b,0x20,0x69,0x29,
+    0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x63,0x6f,0x6d,0x70,0x5f,
+    0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,
+    0x74,0x20,0x70,0x61,0x69,0x72,0x20,0x3d,0x20,0x28,0x75,0x69,0x6e,0x74,0x28,0x5f,
+    0x34,0x30,0x5f,0x66,0x69,0x72,0x73,0x74,0x5f,0x73,0x70,0x6c,0x61,0x74,0x29,0x20,
+    0x2f,0x20,0x32,0x75,0x29,0x20,0x2b,0x20,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,
+    0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x6a,0x20,0x3d,0x20,0x70,0x61,
+    0x69,0x72,0x20,0x2a,0x20,0x32,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
+    0x28,0x6a,0x20,0x3e,0x3d,0x20,0x75,0x69,0x6e,0x74,0x28,0x5f,0x34,0x30,0x5f,0x65,
+    0x6e,0x64,0x5f,0x73,0x70,0x6c,0x61,0x74,0x29,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x33,
+    0x20,0x62,0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,0x33,0x28,0x30,0x75,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x33,0x20,0x61,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x75,0x69,0x6e,0x74,0x34,0x20,0x5f,0x36,0x31,0x30,0x20,0x3d,0x20,0x64,0x65,
+    0x63,0x6f,0x64,0x65,0x5f,0x73,0x70,0x6c,0x61,0x74,0x28,0x6a,0x2c,0x20,0x61,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x5f,0x39,0x38,0x2e,0x53,0x74,0x6f,0x72,0x65,0x34,
+    0x28,0x28,0x6a,0x29,0x20,0x2a,0x20,0x31,0x36,0x20,0x2b,0x20,0x30,0x2c,0x20,0x5f,
+    0x36,0x31,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x68,
+    0x61,0x73,0x5f,0x62,0x20,0x3d,0x20,0x28,0x6a,0x20,0x2b,0x20,0x31,0x75,0x29,0x20,
+    0x3c,0x20,0x75,0x69,0x6e,0x74,0x28,0x5f,0x34,0x30,0x5f,0x65,0x6e,0x64,0x5f,0x73,
+    0x70,0x6c,0x61,0x74,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x68,
+    0x61,0x73,0x5f,0x62,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x34,0x20,0x5f,0x36,0x33,0x30,0x20,0x3d,
+    0x20,0x64,0x65,0x63,0x6f,0x64,0x65,0x5f,0x73,0x70,0x6c,0x61,0x74,0x28,0x6a,0x20,
+    0x2b,0x20,0x31,0x75,0x2c,0x20,0x62,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x5f,0x39,0x38,0x2e,0x53,0x74,0x6f,0x72,0x65,0x34,0x28,0x28,0x6a,0x20,
+    0x2b,0x20,0x31,0x75,0x29,0x20,0x2a,0x20,0x31,0x36,0x20,0x2b,0x20,0x30,0x2c,0x20,
+    0x5f,0x36,0x33,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
+    0x20,0x75,0x69,0x6e,0x74,0x20,0x77,0x6f,0x72,0x64,0x20,0x3d,0x20,0x70,0x61,0x69,
+    0x72,0x20,0x2a,0x20,0x33,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x5f,0x31,0x31,0x30,
+    0x2e,0x53,0x74,0x6f,0x72,0x65,0x28,0x28,0x77,0x6f,0x72,0x64,0x29,0x20,0x2a,0x20,
+    0x34,0x20,0x2b,0x20,0x30,0x2c,0x20,0x61,0x2e,0x78,0x20,0x7c,0x20,0x28,0x61,0x2e,
+    0x79,0x20,0x3c,0x3c,0x20,0x31,0x36,0x75,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x5f,0x31,0x31,0x30,0x2e,0x53,0x74,0x6f,0x72,0x65,0x28,0x28,0x77,0x6f,0x72,0x64,
+    0x20,0x2b,0x20,0x31,0x75,0x29,0x20,0x2a,0x20,0x34,0x20,0x2b,0x20,0x30,0x2c,0x20,
+    0x61,0x2e,0x7a,0x20,0x7c,0x20,0x28,0x62,0x2e,0x78,0x20,0x3c,0x3c,0x20,0x31,0x36,
+    0x75,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x68,0x61,0x73,
+    0x5f,0x62,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x5f,0x31,0x31,0x30,0x2e,0x53,0x74,0x6f,0x72,0x65,0x28,0x28,0x77,0x6f,
+    0x72,0x64,0x20,0x2b,0x20,0x32,0x75,0x29,0x20,0x2a,0x20,0x34,0x20,0x2b,0x20,0x30,
+    0x2c,0x20,0x62,0x2e,0x79,0x20,0x7c,0x20,0x28,0x62,0x2e,0x7a,0x20,0x3c,0x3c,0x20,
+    0x31,0x36,0x75,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x7d,0x0a,0x0a,
+    0x5b,0x6e,0x75,0x6d,0x74,0x68,0x72,0x65,0x61,0x64,0x73,0x28,0x32,0x35,0x36,0x2c,
+    0x20,0x31,0x2c,0x20,0x31,0x29,0x5d,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,
+    0x6e,0x28,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,
+    0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,
+    0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x20,0x3d,0x20,0x73,
+    0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x67,0x6c,0x5f,0x47,0x6c,
+    0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6d,0x70,0x5f,0x6d,0x61,0x69,0x6e,0x28,
+    0x29,0x3b,0x0a,0x7d,0x0a,0x00,
+};
+/*
+    #pragma clang diagnostic ignored "-Wmissing-prototypes"
+
+    #include <metal_stdlib>
+    #include <simd/simd.h>
+
+    using namespace metal;
+
+    struct decode_params
+    {
+        int positions_offset;
+        int alphas_offset;
+        int colors_offset;
+        int scales_offset;
+        int rotations_offset;
+        int first_splat;
+        int end_splat;
+        int version;
+        int use_order;
+        int _pad0;
+        int _pad1;
+        int _pad2;
+    };
+
+    struct DecodeWord
+    {
+        uint value;
+    };
+
+    struct spz_planes
+    {
+        DecodeWord planes[1];
+    };
+
+    struct spz_order
+    {
+        DecodeWord order[1];
+    };
+
+    struct spz_chunks
+    {
+        DecodeWord chunk_fixed[1];
+    };
+
+    struct DecodeTexel
+    {
+        uint4 value;
+    };
+
+    struct splat_buffer
+    {
+        DecodeTexel splats[1];
+    };
+
+    struct position_buffer
+    {
+        DecodeWord position_words[1];
+    };
+
+    constant uint3 gl_WorkGroupSize [[maybe_unused]] = uint3(256u, 1u, 1u);
+
+    static inline __attribute__((always_inline))
+    uint plane_byte(uint offset, const device spz_planes& _61)
+    {
+        return (_61.planes[offset >> 2u].value >> ((offset & 3u) * 8u)) & 255u;
+    }
+
+    static inline __attribute__((always_inline))
+    int plane_fixed24(uint offset, const device spz_planes& _61)
+    {
+        uint raw = (plane_byte(offset, _61) | (plane_byte(offset + 1u, _61) << 8u)) | (plane_byte(offset + 2u, _61) << 16u);
+        return int(raw << 8u) >> 8;
+    }
+
+    static inline __attribute__((always_inline))
+    uint quantize_chunk_offset(uint d, uint range)
+    {
+        if (range == 0u)
+        {
+            return 0u;
+        }
+        uint q = (d >= range) ? 1u : 0u;
+        uint r = d - (q * range);
+        for (int bit = 0; bit < 16; bit++)
+        {
+            r = r << 1u;
+            q = q << 1u;
+            if (r >= range)
+            {
+                r -= range;
+                q |= 1u;
+            }
+        }
+        int t = int(r + (range >> 1u)) - int(d);
+        uint _150;
+        if (t >= 0)
+        {
+            _150 = q + (uint(t) / range);
+        }
+        else
+        {
+            _150 = q - (((uint(-t) + range) - 1u) / range);
+        }
+        return min(_150, 65535u);
+    }
+
+    static inline __attribute__((always_inline))
+    uint isqrt_round(uint n)
+    {
+        uint r = uint(sqrt(float(n)));
+        while ((r * r) > n)
+        {
+            r--;
+        }
+        while (((r + 1u) * (r + 1u)) <= n)
+        {
+            r++;
+        }
+        return (n > ((r * r) + r)) ? (r + 1u) : r;
+    }
+
+    static inline __attribute__((always_inline))
+    bool scaled_square_le(uint m, uint s, uint c_sq)
+    {
+        uint low = (m & 65535u) * s;
+        uint high = ((m >> 16u) * s) + (low >> 16u);
+        return (high < (c_sq << 4u)) || ((high == (c_sq << 4u)) && ((low & 65535u) == 0u));
+    }
+
+    static inline __attribute__((always_inline))
+    uint renormalized_component(uint c_sq, uint s)
+    {
+        uint k = uint((512.0 * sqrt(float(c_sq) / float(s))) + 0.5);
+        while ((k > 0u) && (!scaled_square_le(((2u * k) - 1u) * ((2u * k) - 1u), s, c_sq)))
+        {
+            k--;
+        }
+        while (scaled_square_le(((2u * k) + 1u) * ((2u * k) + 1u), s, c_sq))
+        {
+            k++;
+        }
+        return k;
+    }
+
+    static inline __attribute__((always_inline))
+    uint v2_rotation_to_smallest_three(uint offset, const device spz_planes& _61)
+    {
+        int3 c = int3(int(plane_byte(offset, _61) << 24u) >> 24, int(plane_byte(offset + 1u, _61) << 24u) >> 24, int(plane_byte(offset + 2u, _61) << 24u) >> 24);
+        int length_sq = ((c.x * c.x) + (c.y * c.y)) + (c.z * c.z);
+        int w_sq = max(16384 - length_sq, 0);
+        int squares[4] = { c.x * c.x, c.y * c.y, c.z * c.z, w_sq };
+        int components[4] = { 4 * c.x, 4 * c.y, 4 * c.z, int(isqrt_round(16u * uint(w_sq))) };
+        if (length_sq > 16384)
+        {
+            for (int k = 0; k < 3; k++)
+            {
+                int magnitude = int(renormalized_component(uint(squares[k]), uint(length_sq)));
+                components[k] = (c[k] < 0) ? (-magnitude) : magnitude;
+            }
+        }
+        uint largest = 0u;
+        for (uint j = 1u; j < 4u; j++)
+        {
+            if (squares[j] > squares[largest])
+            {
+                largest = j;
+            }
+        }
+        int sign_factor = (components[largest] < 0) ? (-1) : 1;
+        uint result = largest;
+        uint shift = 2u;
+        for (uint j_1 = 0u; j_1 < 4u; j_1++)
+        {
+            if (j_1 != largest)
+            {
+                result |= (uint(clamp((sign_factor * components[j_1]) + 512, 0, 1023)) << shift);
+                shift += 10u;
+            }
+        }
+        return result;
+    }
+
+    static inline __attribute__((always_inline))
+    uint4 decode_splat(uint j, thread uint3& position, constant decode_params& _40, const device spz_order& _66, const device spz_planes& _61, const device spz_chunks& _80)
+    {
+        uint i = (_40.use_order != 0) ? _66.order[j].value : j;
+        uint chunk = (j / 256u) * 8u;
+        uint pos_offset = uint(_40.positions_offset) + (i * 9u);
+        int3 v = int3(plane_fixed24(pos_offset, _61), -plane_fixed24(pos_offset + 3u, _61), plane_fixed24(pos_offset + 6u, _61));
+        for (uint k = 0u; k < 3u; k++)
+        {
+            position[k] = quantize_chunk_offset(uint(v[k] - int(_80.chunk_fixed[chunk + k].value)), _80.chunk_fixed[(chunk + 4u) + k].value);
+        }
+        uint rotation;
+        if (_40.version == 3)
+        {
+            uint rot_offset = uint(_40.rotations_offset) + (i * 4u);
+            rotation = ((plane_byte(rot_offset, _61) | (plane_byte(rot_offset + 1u, _61) << 8u)) | (plane_byte(rot_offset + 2u, _61) << 16u)) | (plane_byte(rot_offset + 3u, _61) << 24u);
+        }
+        else
+        {
+            rotation = v2_rotation_to_smallest_three(uint(_40.rotations_offset) + (i * 3u), _61);
+        }
+        uint scale_offset = uint(_40.scales_offset) + (i * 3u);
+        uint color_offset = uint(_40.colors_offset) + (i * 3u);
+        return uint4((position.x << 16u) | position.y, (position.z << 16u) | (rotation & 65535u), (((((rotation >> 16u) & 255u) << 24u) | (plane_byte(scale_offset, _61) << 16u)) | (plane_byte(scale_offset + 1u, _61) << 8u)) | (rotation >> 24u), (((plane_byte(color_offset, _61) << 24u) | (plane_byte(color_offset + 1u, _61) << 16u)) | (plane_byte(color_offset + 2u, _61) << 8u)) | plane_byte(uint(_40.alphas_offset) + i, _61));
+    }
+
+    kernel void main0(constant decode_params& _40 [[buffer(0)]], const device spz_planes& _61 [[buffer(10)]], const device spz_order& _66 [[buffer(11)]], const device spz_chunks& _80 [[buffer(12)]], device splat_buffer& _98 [[buffer(8)]], device position_buffer& _110 [[buffer(9)]], uint3 gl_GlobalInvocationID [[thread_position_in_grid]])
+    {
+        uint pair = (uint(_40.first_splat) / 2u) + gl_GlobalInvocationID.x;
+        uint j = pair * 2u;
+        if (j >= uint(_40.end_splat))
+        {
+            return;
+        }
+        uint3 b = uint3(0u);
+        uint3 a;
+        uint4 _610 = decode_splat(j, a, _40, _66, _61, _80);
+        _98.splats[j].value = _610;
+        bool has_b = (j + 1u) < uint(_40.end_splat);
+        if (has_b)
+        {
+            uint4 _630 = decode_splat(j + 1u, b, _40, _66, _61, _80);
+            _98.splats[j + 1u].value = _630;
+        }
+        uint word = pair * 3u;
+        _110.position_words[word].value = a.x | (a.y << 16u);
+        _110.position_words[word + 1u].value = a.z | (b.x << 16u);
+        if (has_b)
+        {
+            _110.position_words[word + 2u].value = b.y | (b.z << 16u);
+        }
+    }
+
+*/
+static const uint8_t spz_decode_source_metal_macos[6835] = {
+    0x23,0x70,0x72,0x61,0x67,0x6d,0x61,0x20,0x63,0x6c,0x61,0x6e,0x67,0x20,0x64,0x69,
+    0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x20,0x69,0x67,0x6e,0x6f,0x72,0x65,0x64,
+    0x20,0x22,0x2d,0x57,0x6d,0x69,0x73,0x73,0x69,0x6e,0x67,0x2d,0x70,0x72,0x6f,0x74,
+    0x6f,0x74,0x79,0x70,0x65,0x73,0x22,0x0a,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,
+    0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,
+    0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,
+    0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,
+    0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,
+    0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x64,0x65,0x63,0x6f,0x64,0x65,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,
+    0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x73,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x61,0x6c,0x70,0x68,0x61,0x73,
+    0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,
+    0x20,0x63,0x6f,0x6c,0x6f,0x72,0x73,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x73,0x63,0x61,0x6c,0x65,0x73,0x5f,0x6f,
+    0x66,0x66,0x73,0x65,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x72,
+    0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x73,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x66,0x69,0x72,0x73,0x74,0x5f,0x73,
+    0x70,0x6c,0x61,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x65,0x6e,
+    0x64,0x5f,0x73,0x70,0x6c,0x61,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,
+    0x20,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,
+    0x74,0x20,0x75,0x73,0x65,0x5f,0x6f,0x72,0x64,0x65,0x72,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x69,0x6e,0x74,0x20,0x5f,0x70,0x61,0x64,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x69,0x6e,0x74,0x20,0x5f,0x70,0x61,0x64,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,
+    0x6e,0x74,0x20,0x5f,0x70,0x61,0x64,0x32,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,
+    0x72,0x75,0x63,0x74,0x20,0x44,0x65,0x63,0x6f,0x64,0x65,0x57,0x6f,0x72,0x64,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x76,0x61,0x6c,0x75,0x65,
+    0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x73,0x70,0x7a,
+    0x5f,0x70,0x6c,0x61,0x6e,0x65,0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x44,0x65,
+    0x63,0x6f,0x64,0x65,0x57,0x6f,0x72,0x64,0x20,0x70,0x6c,0x61,0x6e,0x65,0x73,0x5b,
+    0x31,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x73,
+    0x70,0x7a,0x5f,0x6f,0x72,0x64,0x65,0x72,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x44,
+    0x65,0x63,0x6f,0x64,0x65,0x57,0x6f,0x72,0x64,0x20,0x6f,0x72,0x64,0x65,0x72,0x5b,
+    0x31,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x73,
+    0x70,0x7a,0x5f,0x63,0x68,0x75,0x6e,0x6b,0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x44,0x65,0x63,0x6f,0x64,0x65,0x57,0x6f,0x72,0x64,0x20,0x63,0x68,0x75,0x6e,0x6b,
+    0x5f,0x66,0x69,0x78,0x65,0x64,0x5b,0x31,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,
+    0x74,0x72,0x75,0x63,0x74,0x20,0x44,0x65,0x63,0x6f,0x64,0x65,0x54,0x65,0x78,0x65,
+    0x6c,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x34,0x20,0x76,0x61,
+    0x6c,0x75,0x65,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,
+    0x73,0x70,0x6c,0x61,0x74,0x5f,0x62,0x75,0x66,0x66,0x65,0x72,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x44,0x65,0x63,0x6f,0x64,0x65,0x54,0x65,0x78,0x65,0x6c,0x20,0x73,
+    0x70,0x6c,0x61,0x74,0x73,0x5b,0x31,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,
+    0x72,0x75,0x63,0x74,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x62,0x75,
+    0x66,0x66,0x65,0x72,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x44,0x65,0x63,0x6f,0x64,
+    0x65,0x57,0x6f,0x72,0x64,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x77,
+    0x6f,0x72,0x64,0x73,0x5b,0x31,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x63,0x6f,0x6e,
+    0x73,0x74,0x61,0x6e,0x74,0x20,0x75,0x69,0x6e,0x74,0x33,0x20,0x67,0x6c,0x5f,0x57,
+    0x6f,0x72,0x6b,0x47,0x72,0x6f,0x75,0x70,0x53,0x69,0x7a,0x65,0x20,0x5b,0x5b,0x6d,
+    0x61,0x79,0x62,0x65,0x5f,0x75,0x6e,0x75,0x73,0x65,0x64,0x5d,0x5d,0x20,0x3d,0x20,
+    0x75,0x69,0x6e,0x74,0x33,0x28,0x32,0x35,0x36,0x75,0x2c,0x20,0x31,0x75,0x2c,0x20,
+    0x31,0x75,0x29,0x3b,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,
+    0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,
+    0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,
+    0x29,0x29,0x0a,0x75,0x69,0x6e,0x74,0x20,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,
+    0x74,0x65,0x28,0x75,0x69,0x6e,0x74,0x20,0x6f,0x66,0x66,0x73,0x65,0x74,0x2c,0x20,
+    0x63,0x6f,0x6e,0x73,0x74,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x73,0x70,0x7a,
+    0x5f,0x70,0x6c,0x61,0x6e,0x65,0x73,0x26,0x20,0x5f,0x36,0x31,0x29,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x28,0x5f,0x36,0x31,0x2e,
+    0x70,0x6c,0x61,0x6e,0x65,0x73,0x5b,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x3e,0x3e,
+    0x20,0x32,0x75,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3e,0x3e,0x20,0x28,0x28,
+    0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x26,0x20,0x33,0x75,0x29,0x20,0x2a,0x20,0x38,
+    0x75,0x29,0x29,0x20,0x26,0x20,0x32,0x35,0x35,0x75,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,
+    0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,
+    0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,
+    0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x69,0x6e,0x74,0x20,
+    0x70,0x6c,0x61,0x6e,0x65,0x5f,0x66,0x69,0x78,0x65,0x64,0x32,0x34,0x28,0x75,0x69,
+    0x6e,0x74,0x20,0x6f,0x66,0x66,0x73,0x65,0x74,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,
+    0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x73,0x70,0x7a,0x5f,0x70,0x6c,0x61,0x6e,
+    0x65,0x73,0x26,0x20,0x5f,0x36,0x31,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,
+    0x69,0x6e,0x74,0x20,0x72,0x61,0x77,0x20,0x3d,0x20,0x28,0x70,0x6c,0x61,0x6e,0x65,
+    0x5f,0x62,0x79,0x74,0x65,0x28,0x6f,0x66,0x66,0x73,0x65,0x74,0x2c,0x20,0x5f,0x36,
+    0x31,0x29,0x20,0x7c,0x20,0x28,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,0x74,0x65,
+    0x28,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x2b,0x20,0x31,0x75,0x2c,0x20,0x5f,0x36,
+    0x31,0x29,0x20,0x3c,0x3c,0x20,0x38,0x75,0x29,0x29,0x20,0x7c,0x20,0x28,0x70,0x6c,
+    0x61,0x6e,0x65,0x5f,0x62,0x79,0x74,0x65,0x28,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,
+    0x2b,0x20,0x32,0x75,0x2c,0x20,0x5f,0x36,0x31,0x29,0x20,0x3c,0x3c,0x20,0x31,0x36,
+    0x75,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x69,
+    0x6e,0x74,0x28,0x72,0x61,0x77,0x20,0x3c,0x3c,0x20,0x38,0x75,0x29,0x20,0x3e,0x3e,
+    0x20,0x38,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,
+    0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,
+    0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,
+    0x65,0x29,0x29,0x0a,0x75,0x69,0x6e,0x74,0x20,0x71,0x75,0x61,0x6e,0x74,0x69,0x7a,
+    0x65,0x5f,0x63,0x68,0x75,0x6e,0x6b,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x75,
+    0x69,0x6e,0x74,0x20,0x64,0x2c,0x20,0x75,0x69,0x6e,0x74,0x20,0x72,0x61,0x6e,0x67,
+    0x65,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x72,0x61,0x6e,
+    0x67,0x65,0x20,0x3d,0x3d,0x20,0x30,0x75,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x30,
+    0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,
+    0x74,0x20,0x71,0x20,0x3d,0x20,0x28,0x64,0x20,0x3e,0x3d,0x20,0x72,0x61,0x6e,0x67,
+    0x65,0x29,0x20,0x3f,0x20,0x31,0x75,0x20,0x3a,0x20,0x30,0x75,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x72,0x20,0x3d,0x20,0x64,0x20,0x2d,0x20,0x28,
+    0x71,0x20,0x2a,0x20,0x72,0x61,0x6e,0x67,0x65,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x62,0x69,0x74,0x20,0x3d,0x20,0x30,
+    0x3b,0x20,0x62,0x69,0x74,0x20,0x3c,0x20,0x31,0x36,0x3b,0x20,0x62,0x69,0x74,0x2b,
+    0x2b,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x72,0x20,0x3d,0x20,0x72,0x20,0x3c,0x3c,0x20,0x31,0x75,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x71,0x20,0x3d,0x20,0x71,0x20,0x3c,0x3c,0x20,0x31,
+    0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x72,
+    0x20,0x3e,0x3d,0x20,0x72,0x61,0x6e,0x67,0x65,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x72,0x20,0x2d,0x3d,0x20,0x72,0x61,0x6e,0x67,0x65,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x71,0x20,0x7c,0x3d,0x20,0x31,0x75,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
+    0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x74,0x20,0x3d,0x20,0x69,0x6e,
+    0x74,0x28,0x72,0x20,0x2b,0x20,0x28,0x72,0x61,0x6e,0x67,0x65,0x20,0x3e,0x3e,0x20,
+    0x31,0x75,0x29,0x29,0x20,0x2d,0x20,0x69,0x6e,0x74,0x28,0x64,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,0x31,0x35,0x30,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x20,0x3e,0x3d,0x20,0x30,0x29,0x0a,0x20,0x20,
+    0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x31,0x35,0x30,
+    0x20,0x3d,0x20,0x71,0x20,0x2b,0x20,0x28,0x75,0x69,0x6e,0x74,0x28,0x74,0x29,0x20,
+    0x2f,0x20,0x72,0x61,0x6e,0x67,0x65,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,
+    0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x31,0x35,0x30,0x20,0x3d,0x20,0x71,0x20,
+    0x2d,0x20,0x28,0x28,0x28,0x75,0x69,0x6e,0x74,0x28,0x2d,0x74,0x29,0x20,0x2b,0x20,
+    0x72,0x61,0x6e,0x67,0x65,0x29,0x20,0x2d,0x20,0x31,0x75,0x29,0x20,0x2f,0x20,0x72,
+    0x61,0x6e,0x67,0x65,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
+    0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6d,0x69,0x6e,0x28,0x5f,0x31,0x35,0x30,
+    0x2c,0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,
+    0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,
+    0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,
+    0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x75,0x69,0x6e,0x74,0x20,
+    0x69,0x73,0x71,0x72,0x74,0x5f,0x72,0x6f,0x75,0x6e,0x64,0x28,0x75,0x69,0x6e,0x74,
+    0x20,0x6e,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x72,
+    0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,0x28,0x73,0x71,0x72,0x74,0x28,0x66,0x6c,0x6f,
+    0x61,0x74,0x28,0x6e,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x77,0x68,0x69,
+    0x6c,0x65,0x20,0x28,0x28,0x72,0x20,0x2a,0x20,0x72,0x29,0x20,0x3e,0x20,0x6e,0x29,
+    0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,
+    0x2d,0x2d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x77,0x68,
+    0x69,0x6c,0x65,0x20,0x28,0x28,0x28,0x72,0x20,0x2b,0x20,0x31,0x75,0x29,0x20,0x2a,
+    0x20,0x28,0x72,0x20,0x2b,0x20,0x31,0x75,0x29,0x29,0x20,0x3c,0x3d,0x20,0x6e,0x29,
+    0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,
+    0x2b,0x2b,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,
+    0x74,0x75,0x72,0x6e,0x20,0x28,0x6e,0x20,0x3e,0x20,0x28,0x28,0x72,0x20,0x2a,0x20,
+    0x72,0x29,0x20,0x2b,0x20,0x72,0x29,0x29,0x20,0x3f,0x20,0x28,0x72,0x20,0x2b,0x20,
+    0x31,0x75,0x29,0x20,0x3a,0x20,0x72,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,
+    0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,
+    0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,
+    0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x62,0x6f,0x6f,0x6c,0x20,0x73,0x63,
+    0x61,0x6c,0x65,0x64,0x5f,0x73,0x71,0x75,0x61,0x72,0x65,0x5f,0x6c,0x65,0x28,0x75,
+    0x69,0x6e,0x74,0x20,0x6d,0x2c,0x20,0x75,0x69,0x6e,0x74,0x20,0x73,0x2c,0x20,0x75,
+    0x69,0x6e,0x74,0x20,0x63,0x5f,0x73,0x71,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x75,0x69,0x6e,0x74,0x20,0x6c,0x6f,0x77,0x20,0x3d,0x20,0x28,0x6d,0x20,0x26,0x20,
+    0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x20,0x2a,0x20,0x73,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x75,0x69,0x6e,0x74,0x20,0x68,0x69,0x67,0x68,0x20,0x3d,0x20,0x28,0x28,0x6d,
+    0x20,0x3e,0x3e,0x20,0x31,0x36,0x75,0x29,0x20,0x2a,0x20,0x73,0x29,0x20,0x2b,0x20,
+    0x28,0x6c,0x6f,0x77,0x20,0x3e,0x3e,0x20,0x31,0x36,0x75,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x28,0x68,0x69,0x67,0x68,0x20,0x3c,
+    0x20,0x28,0x63,0x5f,0x73,0x71,0x20,0x3c,0x3c,0x20,0x34,0x75,0x29,0x29,0x20,0x7c,
+    0x7c,0x20,0x28,0x28,0x68,0x69,0x67,0x68,0x20,0x3d,0x3d,0x20,0x28,0x63,0x5f,0x73,
+    0x71,0x20,0x3c,0x3c,0x20,0x34,0x75,0x29,0x29,0x20,0x26,0x26,0x20,0x28,0x28,0x6c,
+    0x6f,0x77,0x20,0x26,0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x20,0x3d,0x3d,0x20,
+    0x30,0x75,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,
+    0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,
+    0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,
+    0x69,0x6e,0x65,0x29,0x29,0x0a,0x75,0x69,0x6e,0x74,0x20,0x72,0x65,0x6e,0x6f,0x72,
+    0x6d,0x61,0x6c,0x69,0x7a,0x65,0x64,0x5f,0x63,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,
+    0x74,0x28,0x75,0x69,0x6e,0x74,0x20,0x63,0x5f,0x73,0x71,0x2c,0x20,0x75,0x69,0x6e,
+    0x74,0x20,0x73,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,
+    0x6b,0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,0x28,0x28,0x35,0x31,0x32,0x2e,0x30,0x20,
+    0x2a,0x20,0x73,0x71,0x72,0x74,0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x63,0x5f,0x73,
+    0x71,0x29,0x20,0x2f,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x73,0x29,0x29,0x29,0x20,
+    0x2b,0x20,0x30,0x2e,0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,
+    0x65,0x20,0x28,0x28,0x6b,0x20,0x3e,0x20,0x30,0x75,0x29,0x20,0x26,0x26,0x20,0x28,
+    0x21,0x73,0x63,0x61,0x6c,0x65,0x64,0x5f,0x73,0x71,0x75,0x61,0x72,0x65,0x5f,0x6c,
+    0x65,0x28,0x28,0x28,0x32,0x75,0x20,0x2a,0x20,0x6b,0x29,0x20,0x2d,0x20,0x31,0x75,
+    0x29,0x20,0x2a,0x20,0x28,0x28,0x32,0x75,0x20,0x2a,0x20,0x6b,0x29,0x20,0x2d,0x20,
+    0x31,0x75,0x29,0x2c,0x20,0x73,0x2c,0x20,0x63,0x5f,0x73,0x71,0x29,0x29,0x29,0x0a,
+    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6b,0x2d,
+    0x2d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x77,0x68,0x69,
+    0x6c,0x65,0x20,0x28,0x73,0x63,0x61,0x6c,0x65,0x64,0x5f,0x73,0x71,0x75,0x61,0x72,
+    0x65,0x5f,0x6c,0x65,0x28,0x28,0x28,0x32,0x75,0x20,0x2a,0x20,0x6b,0x29,0x20,0x2b,
+    0x20,0x31,0x75,0x29,0x20,0x2a,0x20,0x28,0x28,0x32,0x75,0x20,0x2a,0x20,0x6b,0x29,
+    0x20,0x2b,0x20,0x31,0x75,0x29,0x2c,0x20,0x73,0x2c,0x20,0x63,0x5f,0x73,0x71,0x29,
+    0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x6b,0x2b,0x2b,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,
+    0x65,0x74,0x75,0x72,0x6e,0x20,0x6b,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,
+    0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,
+    0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,
+    0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x75,0x69,0x6e,0x74,0x20,0x76,0x32,
+    0x5f,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x5f,0x74,0x6f,0x5f,0x73,0x6d,0x61,
+    0x6c,0x6c,0x65,0x73,0x74,0x5f,0x74,0x68,0x72,0x65,0x65,0x28,0x75,0x69,0x6e,0x74,
+    0x20,0x6f,0x66,0x66,0x73,0x65,0x74,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x64,
+    0x65,0x76,0x69,0x63,0x65,0x20,0x73,0x70,0x7a,0x5f,0x70,0x6c,0x61,0x6e,0x65,0x73,
+    0x26,0x20,0x5f,0x36,0x31,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,
+    0x33,0x20,0x63,0x20,0x3d,0x20,0x69,0x6e,0x74,0x33,0x28,0x69,0x6e,0x74,0x28,0x70,
+    0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,0x74,0x65,0x28,0x6f,0x66,0x66,0x73,0x65,0x74,
+    0x2c,0x20,0x5f,0x36,0x31,0x29,0x20,0x3c,0x3c,0x20,0x32,0x34,0x75,0x29,0x20,0x3e,
+    0x3e,0x20,0x32,0x34,0x2c,0x20,0x69,0x6e,0x74,0x28,0x70,0x6c,0x61,0x6e,0x65,0x5f,
+    0x62,0x79,0x74,0x65,0x28,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x2b,0x20,0x31,0x75,
+    0x2c,0x20,0x5f,0x36,0x31,0x29,0x20,0x3c,0x3c,0x20,0x32,0x34,0x75,0x29,0x20,0x3e,
+    0x3e,0x20,0x32,0x34,0x2c,0x20,0x69,0x6e,0x74,0x28,0x70,0x6c,0x61,0x6e,0x65,0x5f,
+    0x62,0x79,0x74,0x65,0x28,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x2b,0x20,0x32,0x75,
+    0x2c,0x20,0x5f,0x36,0x31,0x29,0x20,0x3c,0x3c,0x20,0x32,0x34,0x75,0x29,0x20,0x3e,
+    0x3e,0x20,0x32,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x6c,
+    0x65,0x6e,0x67,0x74,0x68,0x5f,0x73,0x71,0x20,0x3d,0x20,0x28,0x28,0x63,0x2e,0x78,
+    0x20,0x2a,0x20,0x63,0x2e,0x78,0x29,0x20,0x2b,0x20,0x28,0x63,0x2e,0x79,0x20,0x2a,
+    0x20,0x63,0x2e,0x79,0x29,0x29,0x20,0x2b,0x20,0x28,0x63,0x2e,0x7a,0x20,0x2a,0x20,
+    0x63,0x2e,0x7a,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x77,0x5f,
+    0x73,0x71,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x31,0x36,0x33,0x38,0x34,0x20,0x2d,
+    0x20,0x6c,0x65,0x6e,0x67,0x74,0x68,0x5f,0x73,0x71,0x2c,0x20,0x30,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x73,0x71,0x75,0x61,0x72,0x65,0x73,0x5b,
+    0x34,0x5d,0x20,0x3d,0x20,0x7b,0x20,0x63,0x2e,0x78,0x20,0x2a,0x20,0x63,0x2e,0x78,
+    0x2c,0x20,0x63,0x2e,0x79,0x20,0x2a,0x20,0x63,0x2e,0x79,0x2c,0x20,0x63,0x2e,0x7a,
+    0x20,0x2a,0x20,0x63,0x2e,0x7a,0x2c,0x20,0x77,0x5f,0x73,0x71,0x20,0x7d,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x63,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,
+    0x74,0x73,0x5b,0x34,0x5d,0x20,0x3d,0x20,0x7b,0x20,0x34,0x20,0x2a,0x20,0x63,0x2e,
+    0x78,0x2c,0x20,0x34,0x20,0x2a,0x20,0x63,0x2e,0x79,0x2c,0x20,0x34,0x20,0x2a,0x20,
+    0x63,0x2e,0x7a,0x2c,0x20,0x69,0x6e,0x74,0x28,0x69,0x73,0x71,0x72,0x74,0x5f,0x72,
+    0x6f,0x75,0x6e,0x64,0x28,0x31,0x36,0x75,0x20,0x2a,0x20,0x75,0x69,0x6e,0x74,0x28,
+    0x77,0x5f,0x73,0x71,0x29,0x29,0x29,0x20,0x7d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,
+    0x66,0x20,0x28,0x6c,0x65,0x6e,0x67,0x74,0x68,0x5f,0x73,0x71,0x20,0x3e,0x20,0x31,
+    0x36,0x33,0x38,0x34,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x6b,0x20,0x3d,
+    0x20,0x30,0x3b,0x20,0x6b,0x20,0x3c,0x20,0x33,0x3b,0x20,0x6b,0x2b,0x2b,0x29,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x6d,0x61,0x67,0x6e,0x69,0x74,
+    0x75,0x64,0x65,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,0x72,0x65,0x6e,0x6f,0x72,0x6d,
+    0x61,0x6c,0x69,0x7a,0x65,0x64,0x5f,0x63,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,0x74,
+    0x28,0x75,0x69,0x6e,0x74,0x28,0x73,0x71,0x75,0x61,0x72,0x65,0x73,0x5b,0x6b,0x5d,
+    0x29,0x2c,0x20,0x75,0x69,0x6e,0x74,0x28,0x6c,0x65,0x6e,0x67,0x74,0x68,0x5f,0x73,
+    0x71,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x63,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,0x74,0x73,0x5b,0x6b,0x5d,0x20,
+    0x3d,0x20,0x28,0x63,0x5b,0x6b,0x5d,0x20,0x3c,0x20,0x30,0x29,0x20,0x3f,0x20,0x28,
+    0x2d,0x6d,0x61,0x67,0x6e,0x69,0x74,0x75,0x64,0x65,0x29,0x20,0x3a,0x20,0x6d,0x61,
+    0x67,0x6e,0x69,0x74,0x75,0x64,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,
+    0x74,0x20,0x6c,0x61,0x72,0x67,0x65,0x73,0x74,0x20,0x3d,0x20,0x30,0x75,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x75,0x69,0x6e,0x74,0x20,0x6a,0x20,
+    0x3d,0x20,0x31,0x75,0x3b,0x20,0x6a,0x20,0x3c,0x20,0x34,0x75,0x3b,0x20,0x6a,0x2b,
+    0x2b,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x69,0x66,0x20,0x28,0x73,0x71,0x75,0x61,0x72,0x65,0x73,0x5b,0x6a,0x5d,0x20,
+    0x3e,0x20,0x73,0x71,0x75,0x61,0x72,0x65,0x73,0x5b,0x6c,0x61,0x72,0x67,0x65,0x73,
+    0x74,0x5d,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6c,0x61,0x72,0x67,0x65,0x73,
+    0x74,0x20,0x3d,0x20,0x6a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,
+    0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x73,
+    0x69,0x67,0x6e,0x5f,0x66,0x61,0x63,0x74,0x6f,0x72,0x20,0x3d,0x20,0x28,0x63,0x6f,
+    0x6d,0x70,0x6f,0x6e,0x65,0x6e,0x74,0x73,0x5b,0x6c,0x61,0x72,0x67,0x65,0x73,0x74,
+    0x5d,0x20,0x3c,0x20,0x30,0x29,0x20,0x3f,0x20,0x28,0x2d,0x31,0x29,0x20,0x3a,0x20,
+    0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x72,0x65,0x73,0x75,
+    0x6c,0x74,0x20,0x3d,0x20,0x6c,0x61,0x72,0x67,0x65,0x73,0x74,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x73,0x68,0x69,0x66,0x74,0x20,0x3d,0x20,0x32,
+    0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x75,0x69,0x6e,0x74,
+    0x20,0x6a,0x5f,0x31,0x20,0x3d,0x20,0x30,0x75,0x3b,0x20,0x6a,0x5f,0x31,0x20,0x3c,
+    0x20,0x34,0x75,0x3b,0x20,0x6a,0x5f,0x31,0x2b,0x2b,0x29,0x0a,0x20,0x20,0x20,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x6a,0x5f,
+    0x31,0x20,0x21,0x3d,0x20,0x6c,0x61,0x72,0x67,0x65,0x73,0x74,0x29,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x7c,0x3d,0x20,0x28,0x75,
+    0x69,0x6e,0x74,0x28,0x63,0x6c,0x61,0x6d,0x70,0x28,0x28,0x73,0x69,0x67,0x6e,0x5f,
+    0x66,0x61,0x63,0x74,0x6f,0x72,0x20,0x2a,0x20,0x63,0x6f,0x6d,0x70,0x6f,0x6e,0x65,
+    0x6e,0x74,0x73,0x5b,0x6a,0x5f,0x31,0x5d,0x29,0x20,0x2b,0x20,0x35,0x31,0x32,0x2c,
+    0x20,0x30,0x2c,0x20,0x31,0x30,0x32,0x33,0x29,0x29,0x20,0x3c,0x3c,0x20,0x73,0x68,
+    0x69,0x66,0x74,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x73,0x68,0x69,0x66,0x74,0x20,0x2b,0x3d,0x20,0x31,0x30,0x75,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,
+    0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x72,0x65,0x73,0x75,0x6c,
+    0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,
+    0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,
+    0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,
+    0x29,0x29,0x0a,0x75,0x69,0x6e,0x74,0x34,0x20,0x64,0x65,0x63,0x6f,0x64,0x65,0x5f,
+    0x73,0x70,0x6c,0x61,0x74,0x28,0x75,0x69,0x6e,0x74,0x20,0x6a,0x2c,0x20,0x74,0x68,
+    0x72,0x65,0x61,0x64,0x20,0x75,0x69,0x6e,0x74,0x33,0x26,0x20,0x70,0x6f,0x73,0x69,
+    0x74,0x69,0x6f,0x6e,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x64,
+    0x65,0x63,0x6f,0x64,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x26,0x20,0x5f,0x34,
+    0x30,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,
+    0x73,0x70,0x7a,0x5f,0x6f,0x72,0x64,0x65,0x72,0x26,0x20,0x5f,0x36,0x36,0x2c,0x20,
+    0x63,0x6f,0x6e,0x73,0x74,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x73,0x70,0x7a,
+    0x5f,0x70,0x6c,0x61,0x6e,0x65,0x73,0x26,0x20,0x5f,0x36,0x31,0x2c,0x20,0x63,0x6f,
+    0x6e,0x73,0x74,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x73,0x70,0x7a,0x5f,0x63,
+    0x68,0x75,0x6e,0x6b,0x73,0x26,0x20,0x5f,0x38,0x30,0x29,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x69,0x20,0x3d,0x20,0x28,0x5f,0x34,0x30,0x2e,
+    0x75,0x73,0x65,0x5f,0x6f,0x72,0x64,0x65,0x72,0x20,0x21,0x3d,0x20,0x30,0x29,0x20,
+    0x3f,0x20,0x5f,0x36,0x36,0x2e,0x6f,0x72,0x64,0x65,0x72,0x5b,0x6a,0x5d,0x2e,0x76,
+    0x61,0x6c,0x75,0x65,0x20,0x3a,0x20,0x6a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,
+    0x6e,0x74,0x20,0x63,0x68,0x75,0x6e,0x6b,0x20,0x3d,0x20,0x28,0x6a,0x20,0x2f,0x20,
+    0x32,0x35,0x36,0x75,0x29,0x20,0x2a,0x20,0x38,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x75,0x69,0x6e,0x74,0x20,0x70,0x6f,0x73,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,
+    0x3d,0x20,0x75,0x69,0x6e,0x74,0x28,0x5f,0x34,0x30,0x2e,0x70,0x6f,0x73,0x69,0x74,
+    0x69,0x6f,0x6e,0x73,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x29,0x20,0x2b,0x20,0x28,
+    0x69,0x20,0x2a,0x20,0x39,0x75,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,
+    0x33,0x20,0x76,0x20,0x3d,0x20,0x69,0x6e,0x74,0x33,0x28,0x70,0x6c,0x61,0x6e,0x65,
+    0x5f,0x66,0x69,0x78,0x65,0x64,0x32,0x34,0x28,0x70,0x6f,0x73,0x5f,0x6f,0x66,0x66,
+    0x73,0x65,0x74,0x2c,0x20,0x5f,0x36,0x31,0x29,0x2c,0x20,0x2d,0x70,0x6c,0x61,0x6e,
+    0x65,0x5f,0x66,0x69,0x78,0x65,0x64,0x32,0x34,0x28,0x70,0x6f,0x73,0x5f,0x6f,0x66,
+    0x66,0x73,0x65,0x74,0x20,0x2b,0x20,0x33,0x75,0x2c,0x20,0x5f,0x36,0x31,0x29,0x2c,
+    0x20,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x66,0x69,0x78,0x65,0x64,0x32,0x34,0x28,0x70,
+    0x6f,0x73,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x2b,0x20,0x36,0x75,0x2c,0x20,
+    0x5f,0x36,0x31,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,
+    0x75,0x69,0x6e,0x74,0x20,0x6b,0x20,0x3d,0x20,0x30,0x75,0x3b,0x20,0x6b,0x20,0x3c,
+    0x20,0x33,0x75,0x3b,0x20,0x6b,0x2b,0x2b,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
+    0x5b,0x6b,0x5d,0x20,0x3d,0x20,0x71,0x75,0x61,0x6e,0x74,0x69,0x7a,0x65,0x5f,0x63,
+    0x68,0x75,0x6e,0x6b,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x75,0x69,0x6e,0x74,
+    0x28,0x76,0x5b,0x6b,0x5d,0x20,0x2d,0x20,0x69,0x6e,0x74,0x28,0x5f,0x38,0x30,0x2e,
+    0x63,0x68,0x75,0x6e,0x6b,0x5f,0x66,0x69,0x78,0x65,0x64,0x5b,0x63,0x68,0x75,0x6e,
+    0x6b,0x20,0x2b,0x20,0x6b,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x29,0x29,0x2c,0x20,
+    0x5f,0x38,0x30,0x2e,0x63,0x68,0x75,0x6e,0x6b,0x5f,0x66,0x69,0x78,0x65,0x64,0x5b,
+    0x28,0x63,0x68,0x75,0x6e,0x6b,0x20,0x2b,0x20,0x34,0x75,0x29,0x20,0x2b,0x20,0x6b,
+    0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,
+    0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,
+    0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x34,0x30,0x2e,0x76,
+    0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x3d,0x3d,0x20,0x33,0x29,0x0a,0x20,0x20,0x20,
+    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,
+    0x72,0x6f,0x74,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x3d,0x20,0x75,0x69,0x6e,
+    0x74,0x28,0x5f,0x34,0x30,0x2e,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x73,0x5f,
+    0x6f,0x66,0x66,0x73,0x65,0x74,0x29,0x20,0x2b,0x20,0x28,0x69,0x20,0x2a,0x20,0x34,
+    0x75,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x6f,0x74,0x61,
+    0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x28,0x28,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,
+    0x79,0x74,0x65,0x28,0x72,0x6f,0x74,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x2c,0x20,
+    0x5f,0x36,0x31,0x29,0x20,0x7c,0x20,0x28,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,
+    0x74,0x65,0x28,0x72,0x6f,0x74,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x2b,0x20,
+    0x31,0x75,0x2c,0x20,0x5f,0x36,0x31,0x29,0x20,0x3c,0x3c,0x20,0x38,0x75,0x29,0x29,
+    0x20,0x7c,0x20,0x28,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,0x74,0x65,0x28,0x72,
+    0x6f,0x74,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x2b,0x20,0x32,0x75,0x2c,0x20,
+    0x5f,0x36,0x31,0x29,0x20,0x3c,0x3c,0x20,0x31,0x36,0x75,0x29,0x29,0x20,0x7c,0x20,
+    0x28,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,0x74,0x65,0x28,0x72,0x6f,0x74,0x5f,
+    0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x2b,0x20,0x33,0x75,0x2c,0x20,0x5f,0x36,0x31,
+    0x29,0x20,0x3c,0x3c,0x20,0x32,0x34,0x75,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,
+    0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,
+    0x20,0x3d,0x20,0x76,0x32,0x5f,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x5f,0x74,
+    0x6f,0x5f,0x73,0x6d,0x61,0x6c,0x6c,0x65,0x73,0x74,0x5f,0x74,0x68,0x72,0x65,0x65,
+    0x28,0x75,0x69,0x6e,0x74,0x28,0x5f,0x34,0x30,0x2e,0x72,0x6f,0x74,0x61,0x74,0x69,
+    0x6f,0x6e,0x73,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x29,0x20,0x2b,0x20,0x28,0x69,
+    0x20,0x2a,0x20,0x33,0x75,0x29,0x2c,0x20,0x5f,0x36,0x31,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x73,0x63,0x61,
+    0x6c,0x65,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,
+    0x28,0x5f,0x34,0x30,0x2e,0x73,0x63,0x61,0x6c,0x65,0x73,0x5f,0x6f,0x66,0x66,0x73,
+    0x65,0x74,0x29,0x20,0x2b,0x20,0x28,0x69,0x20,0x2a,0x20,0x33,0x75,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,
+    0x66,0x66,0x73,0x65,0x74,0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,0x28,0x5f,0x34,0x30,
+    0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x73,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x29,0x20,
+    0x2b,0x20,0x28,0x69,0x20,0x2a,0x20,0x33,0x75,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x75,0x69,0x6e,0x74,0x34,0x28,0x28,0x70,0x6f,
+    0x73,0x69,0x74,0x69,0x6f,0x6e,0x2e,0x78,0x20,0x3c,0x3c,0x20,0x31,0x36,0x75,0x29,
+    0x20,0x7c,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2e,0x79,0x2c,0x20,0x28,
+    0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2e,0x7a,0x20,0x3c,0x3c,0x20,0x31,0x36,
+    0x75,0x29,0x20,0x7c,0x20,0x28,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x20,0x26,
+    0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x2c,0x20,0x28,0x28,0x28,0x28,0x28,0x72,
+    0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3e,0x3e,0x20,0x31,0x36,0x75,0x29,0x20,
+    0x26,0x20,0x32,0x35,0x35,0x75,0x29,0x20,0x3c,0x3c,0x20,0x32,0x34,0x75,0x29,0x20,
+    0x7c,0x20,0x28,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,0x74,0x65,0x28,0x73,0x63,
+    0x61,0x6c,0x65,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x2c,0x20,0x5f,0x36,0x31,0x29,
+    0x20,0x3c,0x3c,0x20,0x31,0x36,0x75,0x29,0x29,0x20,0x7c,0x20,0x28,0x70,0x6c,0x61,
+    0x6e,0x65,0x5f,0x62,0x79,0x74,0x65,0x28,0x73,0x63,0x61,0x6c,0x65,0x5f,0x6f,0x66,
+    0x66,0x73,0x65,0x74,0x20,0x2b,0x20,0x31,0x75,0x2c,0x20,0x5f,0x36,0x31,0x29,0x20,
+    0x3c,0x3c,0x20,0x38,0x75,0x29,0x29,0x20,0x7c,0x20,0x28,0x72,0x6f,0x74,0x61,0x74,
+    0x69,0x6f,0x6e,0x20,0x3e,0x3e,0x20,0x32,0x34,0x75,0x29,0x2c,0x20,0x28,0x28,0x28,
+    0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,0x74,0x65,0x28,0x63,0x6f,0x6c,0x6f,0x72,
+    0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x2c,0x20,0x5f,0x36,0x31,0x29,0x20,0x3c,0x3c,
+    0x20,0x32,0x34,0x75,0x29,0x20,0x7c,0x20,0x28,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,
+    0x79,0x74,0x65,0x28,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,
+    0x20,0x2b,0x20,0x31,0x75,0x2c,0x20,0x5f,0x36,0x31,0x29,0x20,0x3c,0x3c,0x20,0x31,
+    0x36,0x75,0x29,0x29,0x20,0x7c,0x20,0x28,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,
+    0x74,0x65,0x28,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,
+    0x2b,0x20,0x32,0x75,0x2c,0x20,0x5f,0x36,0x31,0x29,0x20,0x3c,0x3c,0x20,0x38,0x75,
+    0x29,0x29,0x20,0x7c,0x20,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,0x74,0x65,0x28,
+    0x75,0x69,0x6e,0x74,0x28,0x5f,0x34,0x30,0x2e,0x61,0x6c,0x70,0x68,0x61,0x73,0x5f,
+    0x6f,0x66,0x66,0x73,0x65,0x74,0x29,0x20,0x2b,0x20,0x69,0x2c,0x20,0x5f,0x36,0x31,
+    0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x6b,0x65,0x72,0x6e,0x65,0x6c,0x20,0x76,0x6f,
+    0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x30,0x28,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,
+    0x74,0x20,0x64,0x65,0x63,0x6f,0x64,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x26,
+    0x20,0x5f,0x34,0x30,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x30,0x29,
+    0x5d,0x5d,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x64,0x65,0x76,0x69,0x63,0x65,
+    0x20,0x73,0x70,0x7a,0x5f,0x70,0x6c,0x61,0x6e,0x65,0x73,0x26,0x20,0x5f,0x36,0x31,
+    0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x31,0x30,0x29,0x5d,0x5d,0x2c,
+    0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x73,0x70,
+    0x7a,0x5f,0x6f,0x72,0x64,0x65,0x72,0x26,0x20,0x5f,0x36,0x36,0x20,0x5b,0x5b,0x62,
+    0x75,0x66,0x66,0x65,0x72,0x28,0x31,0x31,0x29,0x5d,0x5d,0x2c,0x20,0x63,0x6f,0x6e,
+    0x73,0x74,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x73,0x70,0x7a,0x5f,0x63,0x68,
+    0x75,0x6e,0x6b,0x73,0x26,0x20,0x5f,0x38,0x30,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,
+    0x65,0x72,0x28,0x31,0x32,0x29,0x5d,0x5d,0x2c,0x20,0x64,0x65,0x76,0x69,0x63,0x65,
+    0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x62,0x75,0x66,0x66,0x65,0x72,0x26,0x20,0x5f,
+    0x39,0x38,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x38,0x29,0x5d,0x5d,
+    0x2c,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,
+    0x6e,0x5f,0x62,0x75,0x66,0x66,0x65,0x72,0x26,0x20,0x5f,0x31,0x31,0x30,0x20,0x5b,
+    0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x39,0x29,0x5d,0x5d,0x2c,0x20,0x75,0x69,
+    0x6e,0x74,0x33,0x20,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,
+    0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x20,0x5b,0x5b,0x74,0x68,0x72,0x65,
+    0x61,0x64,0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x69,0x6e,0x5f,0x67,
+    0x72,0x69,0x64,0x5d,0x5d,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,
+    0x74,0x20,0x70,0x61,0x69,0x72,0x20,0x3d,0x20,0x28,0x75,0x69,0x6e,0x74,0x28,0x5f,
+    0x34,0x30,0x2e,0x66,0x69,0x72,0x73,0x74,0x5f,0x73,0x70,0x6c,0x61,0x74,0x29,0x20,
+    0x2f,0x20,0x32,0x75,0x29,0x20,0x2b,0x20,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,
+    0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x6a,0x20,0x3d,0x20,0x70,0x61,
+    0x69,0x72,0x20,0x2a,0x20,0x32,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
+    0x28,0x6a,0x20,0x3e,0x3d,0x20,0x75,0x69,0x6e,0x74,0x28,0x5f,0x34,0x30,0x2e,0x65,
+    0x6e,0x64,0x5f,0x73,0x70,0x6c,0x61,0x74,0x29,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x33,
+    0x20,0x62,0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,0x33,0x28,0x30,0x75,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x33,0x20,0x61,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x75,0x69,0x6e,0x74,0x34,0x20,0x5f,0x36,0x31,0x30,0x20,0x3d,0x20,0x64,0x65,
+    0x63,0x6f,0x64,0x65,0x5f,0x73,0x70,0x6c,0x61,0x74,0x28,0x6a,0x2c,0x20,0x61,0x2c,
+    0x20,0x5f,0x34,0x30,0x2c,0x20,0x5f,0x36,0x36,0x2c,0x20,0x5f,0x36,0x31,0x2c,0x20,
+    0x5f,0x38,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x5f,0x39,0x38,0x2e,0x73,0x70,
+    0x6c,0x61,0x74,0x73,0x5b,0x6a,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,
+    0x5f,0x36,0x31,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x68,
+    0x61,0x73,0x5f,0x62,0x20,0x3d,0x20,0x28,0x6a,0x20,0x2b,0x20,0x31,0x75,0x29,0x20,
+    0x3c,0x20,0x75,0x69,0x6e,0x74,0x28,0x5f,0x34,0x30,0x2e,0x65,0x6e,0x64,0x5f,0x73,
+    0x70,0x6c,0x61,0x74,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x68,
+    0x61,0x73,0x5f,0x62,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x34,0x20,0x5f,0x36,0x33,0x30,0x20,0x3d,
+    0x20,0x64,0x65,0x63,0x6f,0x64,0x65,0x5f,0x73,0x70,0x6c,0x61,0x74,0x28,0x6a,0x20,
+    0x2b,0x20,0x31,0x75,0x2c,0x20,0x62,0x2c,0x20,0x5f,0x34,0x30,0x2c,0x20,0x5f,0x36,
+    0x36,0x2c,0x20,0x5f,0x36,0x31,0x2c,0x20,0x5f,0x38,0x30,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x39,0x38,0x2e,0x73,0x70,0x6c,0x61,0x74,0x73,
+    0x5b,0x6a,0x20,0x2b,0x20,0x31,0x75,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,
+    0x20,0x5f,0x36,0x33,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
+    0x20,0x75,0x69,0x6e,0x74,0x20,0x77,0x6f,0x72,0x64,0x20,0x3d,0x20,0x70,0x61,0x69,
+    0x72,0x20,0x2a,0x20,0x33,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x5f,0x31,0x31,0x30,
+    0x2e,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x77,0x6f,0x72,0x64,0x73,0x5b,
+    0x77,0x6f,0x72,0x64,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x61,0x2e,
+    0x78,0x20,0x7c,0x20,0x28,0x61,0x2e,0x79,0x20,0x3c,0x3c,0x20,0x31,0x36,0x75,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x5f,0x31,0x31,0x30,0x2e,0x70,0x6f,0x73,0x69,0x74,
+    0x69,0x6f,0x6e,0x5f,0x77,0x6f,0x72,0x64,0x73,0x5b,0x77,0x6f,0x72,0x64,0x20,0x2b,
+    0x20,0x31,0x75,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x61,0x2e,0x7a,
+    0x20,0x7c,0x20,0x28,0x62,0x2e,0x78,0x20,0x3c,0x3c,0x20,0x31,0x36,0x75,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x68,0x61,0x73,0x5f,0x62,0x29,0x0a,
+    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x31,
+    0x31,0x30,0x2e,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x77,0x6f,0x72,0x64,
+    0x73,0x5b,0x77,0x6f,0x72,0x64,0x20,0x2b,0x20,0x32,0x75,0x5d,0x2e,0x76,0x61,0x6c,
+    0x75,0x65,0x20,0x3d,0x20,0x62,0x2e,0x79,0x20,0x7c,0x20,0x28,0x62,0x2e,0x7a,0x20,
+    0x3c,0x3c,0x20,0x31,0x36,0x75,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x7d,
+    0x0a,0x0a,0x00,
+};
+/*
+    #pragma clang diagnostic ignored "-Wmissing-prototypes"
+
+    #include <metal_stdlib>
+    #include <simd/simd.h>
+
+    using namespace metal;
+
+    struct decode_params
+    {
+        int positions_offset;
+        int alphas_offset;
+        int colors_offset;
+        int scales_offset;
+        int rotations_offset;
+        int first_splat;
+        int end_splat;
+        int version;
+        int use_order;
+        int _pad0;
+        int _pad1;
+        int _pad2;
+    };
+
+    struct DecodeWord
+    {
+        uint value;
+    };
+
+    struct spz_planes
+    {
+        DecodeWord planes[1];
+    };
+
+    struct spz_order
+    {
+        DecodeWord order[1];
+    };
+
+    struct spz_chunks
+    {
+        DecodeWord chunk_fixed[1];
+    };
+
+    struct DecodeTexel
+    {
+        uint4 value;
+    };
+
+    struct splat_buffer
+    {
+        DecodeTexel splats[1];
+    };
+
+    struct position_buffer
+    {
+        DecodeWord position_words[1];
+    };
+
+    constant uint3 gl_WorkGroupSize [[maybe_unused]] = uint3(256u, 1u, 1u);
+
+    static inline __attribute__((always_inline))
+    uint plane_byte(uint offset, const device spz_planes& _61)
+    {
+        return (_61.planes[offset >> 2u].value >> ((offset & 3u) * 8u)) & 255u;
+    }
+
+    static inline __attribute__((always_inline))
+    int plane_fixed24(uint offset, const device spz_planes& _61)
+    {
+        uint raw = (plane_byte(offset, _61) | (plane_byte(offset + 1u, _61) << 8u)) | (plane_byte(offset + 2u, _61) << 16u);
+        return int(raw << 8u) >> 8;
+    }
+
+    static inline __attribute__((always_inline))
+    uint quantize_chunk_offset(uint d, uint range)
+    {
+        if (range == 0u)
+        {
+            return 0u;
+        }
+        uint q = (d >= range) ? 1u : 0u;
+        uint r = d - (q * range);
+        for (int bit = 0; bit < 16; bit++)
+        {
+            r = r << 1u;
+            q = q << 1u;
+            if (r >= range)
+            {
+                r -= range;
+                q |= 1u;
+            }
+        }
+        int t = int(r + (range >> 1u)) - int(d);
+        uint _150;
+        if (t >= 0)
+        {
+            _150 = q + (uint(t) / range);
+        }
+        else
+        {
+            _150 = q - (((uint(-t) + range) - 1u) / range);
+        }
+        return min(_150, 65535u);
+    }
+
+    static inline __attribute__((always_inline))
+    uint isqrt_round(uint n)
+    {
+        uint r = uint(sqrt(float(n)));
+        while ((r * r) > n)
+        {
+            r--;
+        }
+        while (((r + 1u) * (r + 1u)) <= n)
+        {
+            r++;
+        }
+        return (n > ((r * r) + r)) ? (r + 1u) : r;
+    }
+
+    static inline __attribute__((always_inline))
+    bool scaled_square_le(uint m, uint s, uint c_sq)
+    {
+        uint low = (m & 65535u) * s;
+        uint high = ((m >> 16u) * s) + (low >> 16u);
+        return (high < (c_sq << 4u)) || ((high == (c_sq << 4u)) && ((low & 65535u) == 0u));
+    }
+
+    static inline __attribute__((always_inline))
+    uint renormalized_component(uint c_sq, uint s)
+    {
+        uint k = uint((512.0 * sqrt(float(c_sq) / float(s))) + 0.5);
+        while ((k > 0u) && (!scaled_square_le(((2u * k) - 1u) * ((2u * k) - 1u), s, c_sq)))
+        {
+            k--;
+        }
+        while (scaled_square_le(((2u * k) + 1u) * ((2u * k) + 1u), s, c_sq))
+        {
+            k++;
+        }
+        return k;
+    }
+
+    static inline __attribute__((always_inline))
+    uint v2_rotation_to_smallest_three(uint offset, const device spz_planes& _61)
+    {
+        int3 c = int3(int(plane_byte(offset, _61) << 24u) >> 24, int(plane_byte(offset + 1u, _61) << 24u) >> 24, int(plane_byte(offset + 2u, _61) << 24u) >> 24);
+        int length_sq = ((c.x * c.x) + (c.y * c.y)) + (c.z * c.z);
+        int w_sq = max(16384 - length_sq, 0);
+        int squares[4] = { c.x * c.x, c.y * c.y, c.z * c.z, w_sq };
+        int components[4] = { 4 * c.x, 4 * c.y, 4 * c.z, int(isqrt_round(16u * uint(w_sq))) };
+        if (length_sq > 16384)
+        {
+            for (int k = 0; k < 3; k++)
+            {
+                int magnitude = int(renormalized_component(uint(squares[k]), uint(length_sq)));
+                components[k] = (c[k] < 0) ? (-magnitude) : magnitude;
+            }
+        }
+        uint largest = 0u;
+        for (uint j = 1u; j < 4u; j++)
+        {
+            if (squares[j] > squares[largest])
+            {
+                largest = j;
+            }
+        }
+        int sign_factor = (components[largest] < 0) ? (-1) : 1;
+        uint result = largest;
+        uint shift = 2u;
+        for (uint j_1 = 0u; j_1 < 4u; j_1++)
+        {
+            if (j_1 != largest)
+            {
+                result |= (uint(clamp((sign_factor * components[j_1]) + 512, 0, 1023)) << shift);
+                shift += 10u;
+            }
+        }
+        return result;
+    }
+
+    static inline __attribute__((always_inline))
+    uint4 decode_splat(uint j, thread uint3& position, constant decode_params& _40, const device spz_order& _66, const device spz_planes& _61, const device spz_chunks& _80)
+    {
+        uint i = (_40.use_order != 0) ? _66.order[j].value : j;
+        uint chunk = (j / 256u) * 8u;
+        uint pos_offset = uint(_40.positions_offset) + (i * 9u);
+        int3 v = int3(plane_fixed24(pos_offset, _61), -plane_fixed24(pos_offset + 3u, _61), plane_fixed24(pos_offset + 6u, _61));
+        for (uint k = 0u; k < 3u; k++)
+        {
+            position[k] = quantize_chunk_offset(uint(v[k] - int(_80.chunk_fixed[chunk + k].value)), _80.chunk_fixed[(chunk + 4u) + k].value);
+        }
+        uint rotation;
+        if (_40.version == 3)
+        {
+            uint rot_offset = uint(_40.rotations_offset) + (i * 4u);
+            rotation = ((plane_byte(rot_offset, _61) | (plane_byte(rot_offset + 1u, _61) << 8u)) | (plane_byte(rot_offset + 2u, _61) << 16u)) | (plane_byte(rot_offset + 3u, _61) << 24u);
+        }
+        else
+        {
+            rotation = v2_rotation_to_smallest_three(uint(_40.rotations_offset) + (i * 3u), _61);
+        }
+        uint scale_offset = uint(_40.scales_offset) + (i * 3u);
+        uint color_offset = uint(_40.colors_offset) + (i * 3u);
+        return uint4((position.x << 16u) | position.y, (position.z << 16u) | (rotation & 65535u), (((((rotation >> 16u) & 255u) << 24u) | (plane_byte(scale_offset, _61) << 16u)) | (plane_byte(scale_offset + 1u, _61) << 8u)) | (rotation >> 24u), (((plane_byte(color_offset, _61) << 24u) | (plane_byte(color_offset + 1u, _61) << 16u)) | (plane_byte(color_offset + 2u, _61) << 8u)) | plane_byte(uint(_40.alphas_offset) + i, _61));
+    }
+
+    kernel void main0(constant decode_params& _40 [[buffer(0)]], const device spz_planes& _61 [[buffer(10)]], const device spz_order& _66 [[buffer(11)]], const device spz_chunks& _80 [[buffer(12)]], device splat_buffer& _98 [[buffer(8)]], device position_buffer& _110 [[buffer(9)]], uint3 gl_GlobalInvocationID [[thread_position_in_grid]])
+    {
+        uint pair = (uint(_40.first_splat) / 2u) + gl_GlobalInvocationID.x;
+        uint j = pair * 2u;
+        if (j >= uint(_40.end_splat))
+        {
+            return;
+        }
+        uint3 b = uint3(0u);
+        uint3 a;
+        uint4 _610 = decode_splat(j, a, _40, _66, _61, _80);
+        _98.splats[j].value = _610;
+        bool has_b = (j + 1u) < uint(_40.end_splat);
+        if (has_b)
+        {
+            uint4 _630 = decode_splat(j + 1u, b, _40, _66, _61, _80);
+            _98.splats[j + 1u].value = _630;
+        }
+        uint word = pair * 3u;
+        _110.position_words[word].value = a.x | (a.y << 16u);
+        _110.position_words[word + 1u].value = a.z | (b.x << 16u);
+        if (has_b)
+        {
+            _110.position_words[word + 2u].value = b.y | (b.z << 16u);
+        }
+    }
+
+*/
+static const uint8_t spz_decode_source_metal_ios[6835] = {
+    0x23,0x70,0x72,0x61,0x67,0x6d,0x61,0x20,0x63,0x6c,0x61,0x6e,0x67,0x20,0x64,0x69,
+    0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x20,0x69,0x67,0x6e,0x6f,0x72,0x65,0x64,
+    0x20,0x22,0x2d,0x57,0x6d,0x69,0x73,0x73,0x69,0x6e,0x67,0x2d,0x70,0x72,0x6f,0x74,
+    0x6f,0x74,0x79,0x70,0x65,0x73,0x22,0x0a,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,
+    0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,
+    0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,
+    0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,
+    0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,
+    0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x64,0x65,0x63,0x6f,0x64,0x65,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,
+    0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x73,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x61,0x6c,0x70,0x68,0x61,0x73,
+    0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,
+    0x20,0x63,0x6f,0x6c,0x6f,0x72,0x73,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x73,0x63,0x61,0x6c,0x65,0x73,0x5f,0x6f,
+    0x66,0x66,0x73,0x65,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x72,
+    0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x73,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x66,0x69,0x72,0x73,0x74,0x5f,0x73,
+    0x70,0x6c,0x61,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x65,0x6e,
+    0x64,0x5f,0x73,0x70,0x6c,0x61,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,
+    0x20,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,
+    0x74,0x20,0x75,0x73,0x65,0x5f,0x6f,0x72,0x64,0x65,0x72,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x69,0x6e,0x74,0x20,0x5f,0x70,0x61,0x64,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x69,0x6e,0x74,0x20,0x5f,0x70,0x61,0x64,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,
+    0x6e,0x74,0x20,0x5f,0x70,0x61,0x64,0x32,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,
+    0x72,0x75,0x63,0x74,0x20,0x44,0x65,0x63,0x6f,0x64,0x65,0x57,0x6f,0x72,0x64,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x76,0x61,0x6c,0x75,0x65,
+    0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x73,0x70,0x7a,
+    0x5f,0x70,0x6c,0x61,0x6e,0x65,0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x44,0x65,
+    0x63,0x6f,0x64,0x65,0x57,0x6f,0x72,0x64,0x20,0x70,0x6c,0x61,0x6e,0x65,0x73,0x5b,
+    0x31,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x73,
+    0x70,0x7a,0x5f,0x6f,0x72,0x64,0x65,0x72,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x44,
+    0x65,0x63,0x6f,0x64,0x65,0x57,0x6f,0x72,0x64,0x20,0x6f,0x72,0x64,0x65,0x72,0x5b,
+    0x31,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x73,
+    0x70,0x7a,0x5f,0x63,0x68,0x75,0x6e,0x6b,0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x44,0x65,0x63,0x6f,0x64,0x65,0x57,0x6f,0x72,0x64,0x20,0x63,0x68,0x75,0x6e,0x6b,
+    0x5f,0x66,0x69,0x78,0x65,0x64,0x5b,0x31,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,
+    0x74,0x72,0x75,0x63,0x74,0x20,0x44,0x65,0x63,0x6f,0x64,0x65,0x54,0x65,0x78,0x65,
+    0x6c,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x34,0x20,0x76,0x61,
+    0x6c,0x75,0x65,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,
+    0x73,0x70,0x6c,0x61,0x74,0x5f,0x62,0x75,0x66,0x66,0x65,0x72,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x44,0x65,0x63,0x6f,0x64,0x65,0x54,0x65,0x78,0x65,0x6c,0x20,0x73,
+    0x70,0x6c,0x61,0x74,0x73,0x5b,0x31,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,
+    0x72,0x75,0x63,0x74,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x62,0x75,
+    0x66,0x66,0x65,0x72,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x44,0x65,0x63,0x6f,0x64,
+    0x65,0x57,0x6f,0x72,0x64,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x77,
+    0x6f,0x72,0x64,0x73,0x5b,0x31,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x63,0x6f,0x6e,
+    0x73,0x74,0x61,0x6e,0x74,0x20,0x75,0x69,0x6e,0x74,0x33,0x20,0x67,0x6c,0x5f,0x57,
+    0x6f,0x72,0x6b,0x47,0x72,0x6f,0x75,0x70,0x53,0x69,0x7a,0x65,0x20,0x5b,0x5b,0x6d,
+    0x61,0x79,0x62,0x65,0x5f,0x75,0x6e,0x75,0x73,0x65,0x64,0x5d,0x5d,0x20,0x3d,0x20,
+    0x75,0x69,0x6e,0x74,0x33,0x28,0x32,0x35,0x36,0x75,0x2c,0x20,0x31,0x75,0x2c,0x20,
+    0x31,0x75,0x29,0x3b,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,
+    0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,
+    0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,
+    0x29,0x29,0x0a,0x75,0x69,0x6e,0x74,0x20,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,
+    0x74,0x65,0x28,0x75,0x69,0x6e,0x74,0x20,0x6f,0x66,0x66,0x73,0x65,0x74,0x2c,0x20,
+    0x63,0x6f,0x6e,0x73,0x74,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x73,0x70,0x7a,
+    0x5f,0x70,0x6c,0x61,0x6e,0x65,0x73,0x26,0x20,0x5f,0x36,0x31,0x29,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x28,0x5f,0x36,0x31,0x2e,
+    0x70,0x6c,0x61,0x6e,0x65,0x73,0x5b,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x3e,0x3e,
+    0x20,0x32,0x75,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3e,0x3e,0x20,0x28,0x28,
+    0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x26,0x20,0x33,0x75,0x29,0x20,0x2a,0x20,0x38,
+    0x75,0x29,0x29,0x20,0x26,0x20,0x32,0x35,0x35,0x75,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,
+    0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,
+    0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,
+    0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x69,0x6e,0x74,0x20,
+    0x70,0x6c,0x61,0x6e,0x65,0x5f,0x66,0x69,0x78,0x65,0x64,0x32,0x34,0x28,0x75,0x69,
+    0x6e,0x74,0x20,0x6f,0x66,0x66,0x73,0x65,0x74,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,
+    0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x73,0x70,0x7a,0x5f,0x70,0x6c,0x61,0x6e,
+    0x65,0x73,0x26,0x20,0x5f,0x36,0x31,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,
+    0x69,0x6e,0x74,0x20,0x72,0x61,0x77,0x20,0x3d,0x20,0x28,0x70,0x6c,0x61,0x6e,0x65,
+    0x5f,0x62,0x79,0x74,0x65,0x28,0x6f,0x66,0x66,0x73,0x65,0x74,0x2c,0x20,0x5f,0x36,
+    0x31,0x29,0x20,0x7c,0x20,0x28,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,0x74,0x65,
+    0x28,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x2b,0x20,0x31,0x75,0x2c,0x20,0x5f,0x36,
+    0x31,0x29,0x20,0x3c,0x3c,0x20,0x38,0x75,0x29,0x29,0x20,0x7c,0x20,0x28,0x70,0x6c,
+    0x61,0x6e,0x65,0x5f,0x62,0x79,0x74,0x65,0x28,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,
+    0x2b,0x20,0x32,0x75,0x2c,0x20,0x5f,0x36,0x31,0x29,0x20,0x3c,0x3c,0x20,0x31,0x36,
+    0x75,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x69,
+    0x6e,0x74,0x28,0x72,0x61,0x77,0x20,0x3c,0x3c,0x20,0x38,0x75,0x29,0x20,0x3e,0x3e,
+    0x20,0x38,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,
+    0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,
+    0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,
+    0x65,0x29,0x29,0x0a,0x75,0x69,0x6e,0x74,0x20,0x71,0x75,0x61,0x6e,0x74,0x69,0x7a,
+    0x65,0x5f,0x63,0x68,0x75,0x6e,0x6b,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x75,
+    0x69,0x6e,0x74,0x20,0x64,0x2c,0x20,0x75,0x69,0x6e,0x74,0x20,0x72,0x61,0x6e,0x67,
+    0x65,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x72,0x61,0x6e,
+    0x67,0x65,0x20,0x3d,0x3d,0x20,0x30,0x75,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x30,
+    0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,
+    0x74,0x20,0x71,0x20,0x3d,0x20,0x28,0x64,0x20,0x3e,0x3d,0x20,0x72,0x61,0x6e,0x67,
+    0x65,0x29,0x20,0x3f,0x20,0x31,0x75,0x20,0x3a,0x20,0x30,0x75,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x72,0x20,0x3d,0x20,0x64,0x20,0x2d,0x20,0x28,
+    0x71,0x20,0x2a,0x20,0x72,0x61,0x6e,0x67,0x65,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x62,0x69,0x74,0x20,0x3d,0x20,0x30,
+    0x3b,0x20,0x62,0x69,0x74,0x20,0x3c,0x20,0x31,0x36,0x3b,0x20,0x62,0x69,0x74,0x2b,
+    0x2b,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x72,0x20,0x3d,0x20,0x72,0x20,0x3c,0x3c,0x20,0x31,0x75,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x71,0x20,0x3d,0x20,0x71,0x20,0x3c,0x3c,0x20,0x31,
+    0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x72,
+    0x20,0x3e,0x3d,0x20,0x72,0x61,0x6e,0x67,0x65,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x72,0x20,0x2d,0x3d,0x20,0x72,0x61,0x6e,0x67,0x65,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x71,0x20,0x7c,0x3d,0x20,0x31,0x75,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
+    0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x74,0x20,0x3d,0x20,0x69,0x6e,
+    0x74,0x28,0x72,0x20,0x2b,0x20,0x28,0x72,0x61,0x6e,0x67,0x65,0x20,0x3e,0x3e,0x20,
+    0x31,0x75,0x29,0x29,0x20,0x2d,0x20,0x69,0x6e,0x74,0x28,0x64,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,0x31,0x35,0x30,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x20,0x3e,0x3d,0x20,0x30,0x29,0x0a,0x20,0x20,
+    0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x31,0x35,0x30,
+    0x20,0x3d,0x20,0x71,0x20,0x2b,0x20,0x28,0x75,0x69,0x6e,0x74,0x28,0x74,0x29,0x20,
+    0x2f,0x20,0x72,0x61,0x6e,0x67,0x65,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,
+    0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x31,0x35,0x30,0x20,0x3d,0x20,0x71,0x20,
+    0x2d,0x20,0x28,0x28,0x28,0x75,0x69,0x6e,0x74,0x28,0x2d,0x74,0x29,0x20,0x2b,0x20,
+    0x72,0x61,0x6e,0x67,0x65,0x29,0x20,0x2d,0x20,0x31,0x75,0x29,0x20,0x2f,0x20,0x72,
+    0x61,0x6e,0x67,0x65,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
+    0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6d,0x69,0x6e,0x28,0x5f,0x31,0x35,0x30,
+    0x2c,0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,
+    0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,
+    0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,
+    0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x75,0x69,0x6e,0x74,0x20,
+    0x69,0x73,0x71,0x72,0x74,0x5f,0x72,0x6f,0x75,0x6e,0x64,0x28,0x75,0x69,0x6e,0x74,
+    0x20,0x6e,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x72,
+    0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,0x28,0x73,0x71,0x72,0x74,0x28,0x66,0x6c,0x6f,
+    0x61,0x74,0x28,0x6e,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x77,0x68,0x69,
+    0x6c,0x65,0x20,0x28,0x28,0x72,0x20,0x2a,0x20,0x72,0x29,0x20,0x3e,0x20,0x6e,0x29,
+    0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,
+    0x2d,0x2d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x77,0x68,
+    0x69,0x6c,0x65,0x20,0x28,0x28,0x28,0x72,0x20,0x2b,0x20,0x31,0x75,0x29,0x20,0x2a,
+    0x20,0x28,0x72,0x20,0x2b,0x20,0x31,0x75,0x29,0x29,0x20,0x3c,0x3d,0x20,0x6e,0x29,
+    0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,
+    0x2b,0x2b,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,
+    0x74,0x75,0x72,0x6e,0x20,0x28,0x6e,0x20,0x3e,0x20,0x28,0x28,0x72,0x20,0x2a,0x20,
+    0x72,0x29,0x20,0x2b,0x20,0x72,0x29,0x29,0x20,0x3f,0x20,0x28,0x72,0x20,0x2b,0x20,
+    0x31,0x75,0x29,0x20,0x3a,0x20,0x72,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,
+    0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,
+    0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,
+    0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x62,0x6f,0x6f,0x6c,0x20,0x73,0x63,
+    0x61,0x6c,0x65,0x64,0x5f,0x73,0x71,0x75,0x61,0x72,0x65,0x5f,0x6c,0x65,0x28,0x75,
+    0x69,0x6e,0x74,0x20,0x6d,0x2c,0x20,0x75,0x69,0x6e,0x74,0x20,0x73,0x2c,0x20,0x75,
+    0x69,0x6e,0x74,0x20,0x63,0x5f,0x73,0x71,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x75,0x69,0x6e,0x74,0x20,0x6c,0x6f,0x77,0x20,0x3d,0x20,0x28,0x6d,0x20,0x26,0x20,
+    0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x20,0x2a,0x20,0x73,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x75,0x69,0x6e,0x74,0x20,0x68,0x69,0x67,0x68,0x20,0x3d,0x20,0x28,0x28,0x6d,
+    0x20,0x3e,0x3e,0x20,0x31,0x36,0x75,0x29,0x20,0x2a,0x20,0x73,0x29,0x20,0x2b,0x20,
+    0x28,0x6c,0x6f,0x77,0x20,0x3e,0x3e,0x20,0x31,0x36,0x75,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x28,0x68,0x69,0x67,0x68,0x20,0x3c,
+    0x20,0x28,0x63,0x5f,0x73,0x71,0x20,0x3c,0x3c,0x20,0x34,0x75,0x29,0x29,0x20,0x7c,
+    0x7c,0x20,0x28,0x28,0x68,0x69,0x67,0x68,0x20,0x3d,0x3d,0x20,0x28,0x63,0x5f,0x73,
+    0x71,0x20,0x3c,0x3c,0x20,0x34,0x75,0x29,0x29,0x20,0x26,0x26,0x20,0x28,0x28,0x6c,
+    0x6f,0x77,0x20,0x26,0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x20,0x3d,0x3d,0x20,
+    0x30,0x75,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,
+    0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,
+    0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,
+    0x69,0x6e,0x65,0x29,0x29,0x0a,0x75,0x69,0x6e,0x74,0x20,0x72,0x65,0x6e,0x6f,0x72,
+    0x6d,0x61,0x6c,0x69,0x7a,0x65,0x64,0x5f,0x63,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,
+    0x74,0x28,0x75,0x69,0x6e,0x74,0x20,0x63,0x5f,0x73,0x71,0x2c,0x20,0x75,0x69,0x6e,
+    0x74,0x20,0x73,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,
+    0x6b,0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,0x28,0x28,0x35,0x31,0x32,0x2e,0x30,0x20,
+    0x2a,0x20,0x73,0x71,0x72,0x74,0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x63,0x5f,0x73,
+    0x71,0x29,0x20,0x2f,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x73,0x29,0x29,0x29,0x20,
+    0x2b,0x20,0x30,0x2e,0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,
+    0x65,0x20,0x28,0x28,0x6b,0x20,0x3e,0x20,0x30,0x75,0x29,0x20,0x26,0x26,0x20,0x28,
+    0x21,0x73,0x63,0x61,0x6c,0x65,0x64,0x5f,0x73,0x71,0x75,0x61,0x72,0x65,0x5f,0x6c,
+    0x65,0x28,0x28,0x28,0x32,0x75,0x20,0x2a,0x20,0x6b,0x29,0x20,0x2d,0x20,0x31,0x75,
+    0x29,0x20,0x2a,0x20,0x28,0x28,0x32,0x75,0x20,0x2a,0x20,0x6b,0x29,0x20,0x2d,0x20,
+    0x31,0x75,0x29,0x2c,0x20,0x73,0x2c,0x20,0x63,0x5f,0x73,0x71,0x29,0x29,0x29,0x0a,
+    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6b,0x2d,
+    0x2d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x77,0x68,0x69,
+    0x6c,0x65,0x20,0x28,0x73,0x63,0x61,0x6c,0x65,0x64,0x5f,0x73,0x71,0x75,0x61,0x72,
+    0x65,0x5f,0x6c,0x65,0x28,0x28,0x28,0x32,0x75,0x20,0x2a,0x20,0x6b,0x29,0x20,0x2b,
+    0x20,0x31,0x75,0x29,0x20,0x2a,0x20,0x28,0x28,0x32,0x75,0x20,0x2a,0x20,0x6b,0x29,
+    0x20,0x2b,0x20,0x31,0x75,0x29,0x2c,0x20,0x73,0x2c,0x20,0x63,0x5f,0x73,0x71,0x29,
+    0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x6b,0x2b,0x2b,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,
+    0x65,0x74,0x75,0x72,0x6e,0x20,0x6b,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,
+    0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,
+    0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,
+    0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x75,0x69,0x6e,0x74,0x20,0x76,0x32,
+    0x5f,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x5f,0x74,0x6f,0x5f,0x73,0x6d,0x61,
+    0x6c,0x6c,0x65,0x73,0x74,0x5f,0x74,0x68,0x72,0x65,0x65,0x28,0x75,0x69,0x6e,0x74,
+    0x20,0x6f,0x66,0x66,0x73,0x65,0x74,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x64,
+    0x65,0x76,0x69,0x63,0x65,0x20,0x73,0x70,0x7a,0x5f,0x70,0x6c,0x61,0x6e,0x65,0x73,
+    0x26,0x20,0x5f,0x36,0x31,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,
+    0x33,0x20,0x63,0x20,0x3d,0x20,0x69,0x6e,0x74,0x33,0x28,0x69,0x6e,0x74,0x28,0x70,
+    0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,0x74,0x65,0x28,0x6f,0x66,0x66,0x73,0x65,0x74,
+    0x2c,0x20,0x5f,0x36,0x31,0x29,0x20,0x3c,0x3c,0x20,0x32,0x34,0x75,0x29,0x20,0x3e,
+    0x3e,0x20,0x32,0x34,0x2c,0x20,0x69,0x6e,0x74,0x28,0x70,0x6c,0x61,0x6e,0x65,0x5f,
+    0x62,0x79,0x74,0x65,0x28,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x2b,0x20,0x31,0x75,
+    0x2c,0x20,0x5f,0x36,0x31,0x29,0x20,0x3c,0x3c,0x20,0x32,0x34,0x75,0x29,0x20,0x3e,
+    0x3e,0x20,0x32,0x34,0x2c,0x20,0x69,0x6e,0x74,0x28,0x70,0x6c,0x61,0x6e,0x65,0x5f,
+    0x62,0x79,0x74,0x65,0x28,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x2b,0x20,0x32,0x75,
+    0x2c,0x20,0x5f,0x36,0x31,0x29,0x20,0x3c,0x3c,0x20,0x32,0x34,0x75,0x29,0x20,0x3e,
+    0x3e,0x20,0x32,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x6c,
+    0x65,0x6e,0x67,0x74,0x68,0x5f,0x73,0x71,0x20,0x3d,0x20,0x28,0x28,0x63,0x2e,0x78,
+    0x20,0x2a,0x20,0x63,0x2e,0x78,0x29,0x20,0x2b,0x20,0x28,0x63,0x2e,0x79,0x20,0x2a,
+    0x20,0x63,0x2e,0x79,0x29,0x29,0x20,0x2b,0x20,0x28,0x63,0x2e,0x7a,0x20,0x2a,0x20,
+    0x63,0x2e,0x7a,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x77,0x5f,
+    0x73,0x71,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x31,0x36,0x33,0x38,0x34,0x20,0x2d,
+    0x20,0x6c,0x65,0x6e,0x67,0x74,0x68,0x5f,0x73,0x71,0x2c,0x20,0x30,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x73,0x71,0x75,0x61,0x72,0x65,0x73,0x5b,
+    0x34,0x5d,0x20,0x3d,0x20,0x7b,0x20,0x63,0x2e,0x78,0x20,0x2a,0x20,0x63,0x2e,0x78,
+    0x2c,0x20,0x63,0x2e,0x79,0x20,0x2a,0x20,0x63,0x2e,0x79,0x2c,0x20,0x63,0x2e,0x7a,
+    0x20,0x2a,0x20,0x63,0x2e,0x7a,0x2c,0x20,0x77,0x5f,0x73,0x71,0x20,0x7d,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x63,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,
+    0x74,0x73,0x5b,0x34,0x5d,0x20,0x3d,0x20,0x7b,0x20,0x34,0x20,0x2a,0x20,0x63,0x2e,
+    0x78,0x2c,0x20,0x34,0x20,0x2a,0x20,0x63,0x2e,0x79,0x2c,0x20,0x34,0x20,0x2a,0x20,
+    0x63,0x2e,0x7a,0x2c,0x20,0x69,0x6e,0x74,0x28,0x69,0x73,0x71,0x72,0x74,0x5f,0x72,
+    0x6f,0x75,0x6e,0x64,0x28,0x31,0x36,0x75,0x20,0x2a,0x20,0x75,0x69,0x6e,0x74,0x28,
+    0x77,0x5f,0x73,0x71,0x29,0x29,0x29,0x20,0x7d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,
+    0x66,0x20,0x28,0x6c,0x65,0x6e,0x67,0x74,0x68,0x5f,0x73,0x71,0x20,0x3e,0x20,0x31,
+    0x36,0x33,0x38,0x34,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x6b,0x20,0x3d,
+    0x20,0x30,0x3b,0x20,0x6b,0x20,0x3c,0x20,0x33,0x3b,0x20,0x6b,0x2b,0x2b,0x29,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x6d,0x61,0x67,0x6e,0x69,0x74,
+    0x75,0x64,0x65,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,0x72,0x65,0x6e,0x6f,0x72,0x6d,
+    0x61,0x6c,0x69,0x7a,0x65,0x64,0x5f,0x63,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,0x74,
+    0x28,0x75,0x69,0x6e,0x74,0x28,0x73,0x71,0x75,0x61,0x72,0x65,0x73,0x5b,0x6b,0x5d,
+    0x29,0x2c,0x20,0x75,0x69,0x6e,0x74,0x28,0x6c,0x65,0x6e,0x67,0x74,0x68,0x5f,0x73,
+    0x71,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x63,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,0x74,0x73,0x5b,0x6b,0x5d,0x20,
+    0x3d,0x20,0x28,0x63,0x5b,0x6b,0x5d,0x20,0x3c,0x20,0x30,0x29,0x20,0x3f,0x20,0x28,
+    0x2d,0x6d,0x61,0x67,0x6e,0x69,0x74,0x75,0x64,0x65,0x29,0x20,0x3a,0x20,0x6d,0x61,
+    0x67,0x6e,0x69,0x74,0x75,0x64,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,
+    0x74,0x20,0x6c,0x61,0x72,0x67,0x65,0x73,0x74,0x20,0x3d,0x20,0x30,0x75,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x75,0x69,0x6e,0x74,0x20,0x6a,0x20,
+    0x3d,0x20,0x31,0x75,0x3b,0x20,0x6a,0x20,0x3c,0x20,0x34,0x75,0x3b,0x20,0x6a,0x2b,
+    0x2b,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x69,0x66,0x20,0x28,0x73,0x71,0x75,0x61,0x72,0x65,0x73,0x5b,0x6a,0x5d,0x20,
+    0x3e,0x20,0x73,0x71,0x75,0x61,0x72,0x65,0x73,0x5b,0x6c,0x61,0x72,0x67,0x65,0x73,
+    0x74,0x5d,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6c,0x61,0x72,0x67,0x65,0x73,
+    0x74,0x20,0x3d,0x20,0x6a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,
+    0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x73,
+    0x69,0x67,0x6e,0x5f,0x66,0x61,0x63,0x74,0x6f,0x72,0x20,0x3d,0x20,0x28,0x63,0x6f,
+    0x6d,0x70,0x6f,0x6e,0x65,0x6e,0x74,0x73,0x5b,0x6c,0x61,0x72,0x67,0x65,0x73,0x74,
+    0x5d,0x20,0x3c,0x20,0x30,0x29,0x20,0x3f,0x20,0x28,0x2d,0x31,0x29,0x20,0x3a,0x20,
+    0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x72,0x65,0x73,0x75,
+    0x6c,0x74,0x20,0x3d,0x20,0x6c,0x61,0x72,0x67,0x65,0x73,0x74,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x73,0x68,0x69,0x66,0x74,0x20,0x3d,0x20,0x32,
+    0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x75,0x69,0x6e,0x74,
+    0x20,0x6a,0x5f,0x31,0x20,0x3d,0x20,0x30,0x75,0x3b,0x20,0x6a,0x5f,0x31,0x20,0x3c,
+    0x20,0x34,0x75,0x3b,0x20,0x6a,0x5f,0x31,0x2b,0x2b,0x29,0x0a,0x20,0x20,0x20,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x6a,0x5f,
+    0x31,0x20,0x21,0x3d,0x20,0x6c,0x61,0x72,0x67,0x65,0x73,0x74,0x29,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x7c,0x3d,0x20,0x28,0x75,
+    0x69,0x6e,0x74,0x28,0x63,0x6c,0x61,0x6d,0x70,0x28,0x28,0x73,0x69,0x67,0x6e,0x5f,
+    0x66,0x61,0x63,0x74,0x6f,0x72,0x20,0x2a,0x20,0x63,0x6f,0x6d,0x70,0x6f,0x6e,0x65,
+    0x6e,0x74,0x73,0x5b,0x6a,0x5f,0x31,0x5d,0x29,0x20,0x2b,0x20,0x35,0x31,0x32,0x2c,
+    0x20,0x30,0x2c,0x20,0x31,0x30,0x32,0x33,0x29,0x29,0x20,0x3c,0x3c,0x20,0x73,0x68,
+    0x69,0x66,0x74,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x73,0x68,0x69,0x66,0x74,0x20,0x2b,0x3d,0x20,0x31,0x30,0x75,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,
+    0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x72,0x65,0x73,0x75,0x6c,
+    0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,
+    0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,
+    0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,
+    0x29,0x29,0x0a,0x75,0x69,0x6e,0x74,0x34,0x20,0x64,0x65,0x63,0x6f,0x64,0x65,0x5f,
+    0x73,0x70,0x6c,0x61,0x74,0x28,0x75,0x69,0x6e,0x74,0x20,0x6a,0x2c,0x20,0x74,0x68,
+    0x72,0x65,0x61,0x64,0x20,0x75,0x69,0x6e,0x74,0x33,0x26,0x20,0x70,0x6f,0x73,0x69,
+    0x74,0x69,0x6f,0x6e,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x64,
+    0x65,0x63,0x6f,0x64,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x26,0x20,0x5f,0x34,
+    0x30,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,
+    0x73,0x70,0x7a,0x5f,0x6f,0x72,0x64,0x65,0x72,0x26,0x20,0x5f,0x36,0x36,0x2c,0x20,
+    0x63,0x6f,0x6e,0x73,0x74,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x73,0x70,0x7a,
+    0x5f,0x70,0x6c,0x61,0x6e,0x65,0x73,0x26,0x20,0x5f,0x36,0x31,0x2c,0x20,0x63,0x6f,
+    0x6e,0x73,0x74,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x73,0x70,0x7a,0x5f,0x63,
+    0x68,0x75,0x6e,0x6b,0x73,0x26,0x20,0x5f,0x38,0x30,0x29,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x69,0x20,0x3d,0x20,0x28,0x5f,0x34,0x30,0x2e,
+    0x75,0x73,0x65,0x5f,0x6f,0x72,0x64,0x65,0x72,0x20,0x21,0x3d,0x20,0x30,0x29,0x20,
+    0x3f,0x20,0x5f,0x36,0x36,0x2e,0x6f,0x72,0x64,0x65,0x72,0x5b,0x6a,0x5d,0x2e,0x76,
+    0x61,0x6c,0x75,0x65,0x20,0x3a,0x20,0x6a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,
+    0x6e,0x74,0x20,0x63,0x68,0x75,0x6e,0x6b,0x20,0x3d,0x20,0x28,0x6a,0x20,0x2f,0x20,
+    0x32,0x35,0x36,0x75,0x29,0x20,0x2a,0x20,0x38,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x75,0x69,0x6e,0x74,0x20,0x70,0x6f,0x73,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,
+    0x3d,0x20,0x75,0x69,0x6e,0x74,0x28,0x5f,0x34,0x30,0x2e,0x70,0x6f,0x73,0x69,0x74,
+    0x69,0x6f,0x6e,0x73,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x29,0x20,0x2b,0x20,0x28,
+    0x69,0x20,0x2a,0x20,0x39,0x75,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,
+    0x33,0x20,0x76,0x20,0x3d,0x20,0x69,0x6e,0x74,0x33,0x28,0x70,0x6c,0x61,0x6e,0x65,
+    0x5f,0x66,0x69,0x78,0x65,0x64,0x32,0x34,0x28,0x70,0x6f,0x73,0x5f,0x6f,0x66,0x66,
+    0x73,0x65,0x74,0x2c,0x20,0x5f,0x36,0x31,0x29,0x2c,0x20,0x2d,0x70,0x6c,0x61,0x6e,
+    0x65,0x5f,0x66,0x69,0x78,0x65,0x64,0x32,0x34,0x28,0x70,0x6f,0x73,0x5f,0x6f,0x66,
+    0x66,0x73,0x65,0x74,0x20,0x2b,0x20,0x33,0x75,0x2c,0x20,0x5f,0x36,0x31,0x29,0x2c,
+    0x20,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x66,0x69,0x78,0x65,0x64,0x32,0x34,0x28,0x70,
+    0x6f,0x73,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x2b,0x20,0x36,0x75,0x2c,0x20,
+    0x5f,0x36,0x31,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,
+    0x75,0x69,0x6e,0x74,0x20,0x6b,0x20,0x3d,0x20,0x30,0x75,0x3b,0x20,0x6b,0x20,0x3c,
+    0x20,0x33,0x75,0x3b,0x20,0x6b,0x2b,0x2b,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
+    0x5b,0x6b,0x5d,0x20,0x3d,0x20,0x71,0x75,0x61,0x6e,0x74,0x69,0x7a,0x65,0x5f,0x63,
+    0x68,0x75,0x6e,0x6b,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x75,0x69,0x6e,0x74,
+    0x28,0x76,0x5b,0x6b,0x5d,0x20,0x2d,0x20,0x69,0x6e,0x74,0x28,0x5f,0x38,0x30,0x2e,
+    0x63,0x68,0x75,0x6e,0x6b,0x5f,0x66,0x69,0x78,0x65,0x64,0x5b,0x63,0x68,0x75,0x6e,
+    0x6b,0x20,0x2b,0x20,0x6b,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x29,0x29,0x2c,0x20,
+    0x5f,0x38,0x30,0x2e,0x63,0x68,0x75,0x6e,0x6b,0x5f,0x66,0x69,0x78,0x65,0x64,0x5b,
+    0x28,0x63,0x68,0x75,0x6e,0x6b,0x20,0x2b,0x20,0x34,0x75,0x29,0x20,0x2b,0x20,0x6b,
+    0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,
+    0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,
+    0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x34,0x30,0x2e,0x76,
+    0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x3d,0x3d,0x20,0x33,0x29,0x0a,0x20,0x20,0x20,
+    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,
+    0x72,0x6f,0x74,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x3d,0x20,0x75,0x69,0x6e,
+    0x74,0x28,0x5f,0x34,0x30,0x2e,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x73,0x5f,
+    0x6f,0x66,0x66,0x73,0x65,0x74,0x29,0x20,0x2b,0x20,0x28,0x69,0x20,0x2a,0x20,0x34,
+    0x75,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x6f,0x74,0x61,
+    0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x28,0x28,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,
+    0x79,0x74,0x65,0x28,0x72,0x6f,0x74,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x2c,0x20,
+    0x5f,0x36,0x31,0x29,0x20,0x7c,0x20,0x28,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,
+    0x74,0x65,0x28,0x72,0x6f,0x74,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x2b,0x20,
+    0x31,0x75,0x2c,0x20,0x5f,0x36,0x31,0x29,0x20,0x3c,0x3c,0x20,0x38,0x75,0x29,0x29,
+    0x20,0x7c,0x20,0x28,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,0x74,0x65,0x28,0x72,
+    0x6f,0x74,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x2b,0x20,0x32,0x75,0x2c,0x20,
+    0x5f,0x36,0x31,0x29,0x20,0x3c,0x3c,0x20,0x31,0x36,0x75,0x29,0x29,0x20,0x7c,0x20,
+    0x28,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,0x74,0x65,0x28,0x72,0x6f,0x74,0x5f,
+    0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x2b,0x20,0x33,0x75,0x2c,0x20,0x5f,0x36,0x31,
+    0x29,0x20,0x3c,0x3c,0x20,0x32,0x34,0x75,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,
+    0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,
+    0x20,0x3d,0x20,0x76,0x32,0x5f,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x5f,0x74,
+    0x6f,0x5f,0x73,0x6d,0x61,0x6c,0x6c,0x65,0x73,0x74,0x5f,0x74,0x68,0x72,0x65,0x65,
+    0x28,0x75,0x69,0x6e,0x74,0x28,0x5f,0x34,0x30,0x2e,0x72,0x6f,0x74,0x61,0x74,0x69,
+    0x6f,0x6e,0x73,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x29,0x20,0x2b,0x20,0x28,0x69,
+    0x20,0x2a,0x20,0x33,0x75,0x29,0x2c,0x20,0x5f,0x36,0x31,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x73,0x63,0x61,
+    0x6c,0x65,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,
+    0x28,0x5f,0x34,0x30,0x2e,0x73,0x63,0x61,0x6c,0x65,0x73,0x5f,0x6f,0x66,0x66,0x73,
+    0x65,0x74,0x29,0x20,0x2b,0x20,0x28,0x69,0x20,0x2a,0x20,0x33,0x75,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,
+    0x66,0x66,0x73,0x65,0x74,0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,0x28,0x5f,0x34,0x30,
+    0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x73,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x29,0x20,
+    0x2b,0x20,0x28,0x69,0x20,0x2a,0x20,0x33,0x75,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x75,0x69,0x6e,0x74,0x34,0x28,0x28,0x70,0x6f,
+    0x73,0x69,0x74,0x69,0x6f,0x6e,0x2e,0x78,0x20,0x3c,0x3c,0x20,0x31,0x36,0x75,0x29,
+    0x20,0x7c,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2e,0x79,0x2c,0x20,0x28,
+    0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2e,0x7a,0x20,0x3c,0x3c,0x20,0x31,0x36,
+    0x75,0x29,0x20,0x7c,0x20,0x28,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x20,0x26,
+    0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x2c,0x20,0x28,0x28,0x28,0x28,0x28,0x72,
+    0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3e,0x3e,0x20,0x31,0x36,0x75,0x29,0x20,
+    0x26,0x20,0x32,0x35,0x35,0x75,0x29,0x20,0x3c,0x3c,0x20,0x32,0x34,0x75,0x29,0x20,
+    0x7c,0x20,0x28,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,0x74,0x65,0x28,0x73,0x63,
+    0x61,0x6c,0x65,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x2c,0x20,0x5f,0x36,0x31,0x29,
+    0x20,0x3c,0x3c,0x20,0x31,0x36,0x75,0x29,0x29,0x20,0x7c,0x20,0x28,0x70,0x6c,0x61,
+    0x6e,0x65,0x5f,0x62,0x79,0x74,0x65,0x28,0x73,0x63,0x61,0x6c,0x65,0x5f,0x6f,0x66,
+    0x66,0x73,0x65,0x74,0x20,0x2b,0x20,0x31,0x75,0x2c,0x20,0x5f,0x36,0x31,0x29,0x20,
+    0x3c,0x3c,0x20,0x38,0x75,0x29,0x29,0x20,0x7c,0x20,0x28,0x72,0x6f,0x74,0x61,0x74,
+    0x69,0x6f,0x6e,0x20,0x3e,0x3e,0x20,0x32,0x34,0x75,0x29,0x2c,0x20,0x28,0x28,0x28,
+    0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,0x74,0x65,0x28,0x63,0x6f,0x6c,0x6f,0x72,
+    0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x2c,0x20,0x5f,0x36,0x31,0x29,0x20,0x3c,0x3c,
+    0x20,0x32,0x34,0x75,0x29,0x20,0x7c,0x20,0x28,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,
+    0x79,0x74,0x65,0x28,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,
+    0x20,0x2b,0x20,0x31,0x75,0x2c,0x20,0x5f,0x36,0x31,0x29,0x20,0x3c,0x3c,0x20,0x31,
+    0x36,0x75,0x29,0x29,0x20,0x7c,0x20,0x28,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,
+    0x74,0x65,0x28,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,
+    0x2b,0x20,0x32,0x75,0x2c,0x20,0x5f,0x36,0x31,0x29,0x20,0x3c,0x3c,0x20,0x38,0x75,
+    0x29,0x29,0x20,0x7c,0x20,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,0x74,0x65,0x28,
+    0x75,0x69,0x6e,0x74,0x28,0x5f,0x34,0x30,0x2e,0x61,0x6c,0x70,0x68,0x61,0x73,0x5f,
+    0x6f,0x66,0x66,0x73,0x65,0x74,0x29,0x20,0x2b,0x20,0x69,0x2c,0x20,0x5f,0x36,0x31,
+    0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x6b,0x65,0x72,0x6e,0x65,0x6c,0x20,0x76,0x6f,
+    0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x30,0x28,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,
+    0x74,0x20,0x64,0x65,0x63,0x6f,0x64,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x26,
+    0x20,0x5f,0x34,0x30,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x30,0x29,
+    0x5d,0x5d,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x64,0x65,0x76,0x69,0x63,0x65,
+    0x20,0x73,0x70,0x7a,0x5f,0x70,0x6c,0x61,0x6e,0x65,0x73,0x26,0x20,0x5f,0x36,0x31,
+    0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x31,0x30,0x29,0x5d,0x5d,0x2c,
+    0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x73,0x70,
+    0x7a,0x5f,0x6f,0x72,0x64,0x65,0x72,0x26,0x20,0x5f,0x36,0x36,0x20,0x5b,0x5b,0x62,
+    0x75,0x66,0x66,0x65,0x72,0x28,0x31,0x31,0x29,0x5d,0x5d,0x2c,0x20,0x63,0x6f,0x6e,
+    0x73,0x74,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x73,0x70,0x7a,0x5f,0x63,0x68,
+    0x75,0x6e,0x6b,0x73,0x26,0x20,0x5f,0x38,0x30,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,
+    0x65,0x72,0x28,0x31,0x32,0x29,0x5d,0x5d,0x2c,0x20,0x64,0x65,0x76,0x69,0x63,0x65,
+    0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x62,0x75,0x66,0x66,0x65,0x72,0x26,0x20,0x5f,
+    0x39,0x38,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x38,0x29,0x5d,0x5d,
+    0x2c,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,
+    0x6e,0x5f,0x62,0x75,0x66,0x66,0x65,0x72,0x26,0x20,0x5f,0x31,0x31,0x30,0x20,0x5b,
+    0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x39,0x29,0x5d,0x5d,0x2c,0x20,0x75,0x69,
+    0x6e,0x74,0x33,0x20,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,
+    0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x20,0x5b,0x5b,0x74,0x68,0x72,0x65,
+    0x61,0x64,0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x69,0x6e,0x5f,0x67,
+    0x72,0x69,0x64,0x5d,0x5d,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,
+    0x74,0x20,0x70,0x61,0x69,0x72,0x20,0x3d,0x20,0x28,0x75,0x69,0x6e,0x74,0x28,0x5f,
+    0x34,0x30,0x2e,0x66,0x69,0x72,0x73,0x74,0x5f,0x73,0x70,0x6c,0x61,0x74,0x29,0x20,
+    0x2f,0x20,0x32,0x75,0x29,0x20,0x2b,0x20,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,
+    0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x6a,0x20,0x3d,0x20,0x70,0x61,
+    0x69,0x72,0x20,0x2a,0x20,0x32,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
+    0x28,0x6a,0x20,0x3e,0x3d,0x20,0x75,0x69,0x6e,0x74,0x28,0x5f,0x34,0x30,0x2e,0x65,
+    0x6e,0x64,0x5f,0x73,0x70,0x6c,0x61,0x74,0x29,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x33,
+    0x20,0x62,0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,0x33,0x28,0x30,0x75,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x33,0x20,0x61,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x75,0x69,0x6e,0x74,0x34,0x20,0x5f,0x36,0x31,0x30,0x20,0x3d,0x20,0x64,0x65,
+    0x63,0x6f,0x64,0x65,0x5f,0x73,0x70,0x6c,0x61,0x74,0x28,0x6a,0x2c,0x20,0x61,0x2c,
+    0x20,0x5f,0x34,0x30,0x2c,0x20,0x5f,0x36,0x36,0x2c,0x20,0x5f,0x36,0x31,0x2c,0x20,
+    0x5f,0x38,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x5f,0x39,0x38,0x2e,0x73,0x70,
+    0x6c,0x61,0x74,0x73,0x5b,0x6a,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,
+    0x5f,0x36,0x31,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x68,
+    0x61,0x73,0x5f,0x62,0x20,0x3d,0x20,0x28,0x6a,0x20,0x2b,0x20,0x31,0x75,0x29,0x20,
+    0x3c,0x20,0x75,0x69,0x6e,0x74,0x28,0x5f,0x34,0x30,0x2e,0x65,0x6e,0x64,0x5f,0x73,
+    0x70,0x6c,0x61,0x74,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x68,
+    0x61,0x73,0x5f,0x62,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x34,0x20,0x5f,0x36,0x33,0x30,0x20,0x3d,
+    0x20,0x64,0x65,0x63,0x6f,0x64,0x65,0x5f,0x73,0x70,0x6c,0x61,0x74,0x28,0x6a,0x20,
+    0x2b,0x20,0x31,0x75,0x2c,0x20,0x62,0x2c,0x20,0x5f,0x34,0x30,0x2c,0x20,0x5f,0x36,
+    0x36,0x2c,0x20,0x5f,0x36,0x31,0x2c,0x20,0x5f,0x38,0x30,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x39,0x38,0x2e,0x73,0x70,0x6c,0x61,0x74,0x73,
+    0x5b,0x6a,0x20,0x2b,0x20,0x31,0x75,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,
+    0x20,0x5f,0x36,0x33,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
+    0x20,0x75,0x69,0x6e,0x74,0x20,0x77,0x6f,0x72,0x64,0x20,0x3d,0x20,0x70,0x61,0x69,
+    0x72,0x20,0x2a,0x20,0x33,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x5f,0x31,0x31,0x30,
+    0x2e,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x77,0x6f,0x72,0x64,0x73,0x5b,
+    0x77,0x6f,0x72,0x64,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x61,0x2e,
+    0x78,0x20,0x7c,0x20,0x28,0x61,0x2e,0x79,0x20,0x3c,0x3c,0x20,0x31,0x36,0x75,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x5f,0x31,0x31,0x30,0x2e,0x70,0x6f,0x73,0x69,0x74,
+    0x69,0x6f,0x6e,0x5f,0x77,0x6f,0x72,0x64,0x73,0x5b,0x77,0x6f,0x72,0x64,0x20,0x2b,
+    0x20,0x31,0x75,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x61,0x2e,0x7a,
+    0x20,0x7c,0x20,0x28,0x62,0x2e,0x78,0x20,0x3c,0x3c,0x20,0x31,0x36,0x75,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x68,0x61,0x73,0x5f,0x62,0x29,0x0a,
+    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x31,
+    0x31,0x30,0x2e,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x77,0x6f,0x72,0x64,
+    0x73,0x5b,0x77,0x6f,0x72,0x64,0x20,0x2b,0x20,0x32,0x75,0x5d,0x2e,0x76,0x61,0x6c,
+    0x75,0x65,0x20,0x3d,0x20,0x62,0x2e,0x79,0x20,0x7c,0x20,0x28,0x62,0x2e,0x7a,0x20,
+    0x3c,0x3c,0x20,0x31,0x36,0x75,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x7d,
+    0x0a,0x0a,0x00,
+};
+/*
+    #pragma clang diagnostic ignored "-Wmissing-prototypes"
+
+    #include <metal_stdlib>
+    #include <simd/simd.h>
+
+    using namespace metal;
+
+    struct decode_params
+    {
+        int positions_offset;
+        int alphas_offset;
+        int colors_offset;
+        int scales_offset;
+        int rotations_offset;
+        int first_splat;
+        int end_splat;
+        int version;
+        int use_order;
+        int _pad0;
+        int _pad1;
+        int _pad2;
+    };
+
+    struct DecodeWord
+    {
+        uint value;
+    };
+
+    struct spz_planes
+    {
+        DecodeWord planes[1];
+    };
+
+    struct spz_order
+    {
+        DecodeWord order[1];
+    };
+
+    struct spz_chunks
+    {
+        DecodeWord chunk_fixed[1];
+    };
+
+    struct DecodeTexel
+    {
+        uint4 value;
+    };
+
+    struct splat_buffer
+    {
+        DecodeTexel splats[1];
+    };
+
+    struct position_buffer
+    {
+        DecodeWord position_words[1];
+    };
+
+    constant uint3 gl_WorkGroupSize [[maybe_unused]] = uint3(256u, 1u, 1u);
+
+    static inline __attribute__((always_inline))
+    uint plane_byte(uint offset, const device spz_planes& _61)
+    {
+        return (_61.planes[offset >> 2u].value >> ((offset & 3u) * 8u)) & 255u;
+    }
+
+    static inline __attribute__((always_inline))
+    int plane_fixed24(uint offset, const device spz_planes& _61)
+    {
+        uint raw = (plane_byte(offset, _61) | (plane_byte(offset + 1u, _61) << 8u)) | (plane_byte(offset + 2u, _61) << 16u);
+        return int(raw << 8u) >> 8;
+    }
+
+    static inline __attribute__((always_inline))
+    uint quantize_chunk_offset(uint d, uint range)
+    {
+        if (range == 0u)
+        {
+            return 0u;
+        }
+        uint q = (d >= range) ? 1u : 0u;
+        uint r = d - (q * range);
+        for (int bit = 0; bit < 16; bit++)
+        {
+            r = r << 1u;
+            q = q << 1u;
+            if (r >= range)
+            {
+                r -= range;
+                q |= 1u;
+            }
+        }
+        int t = int(r + (range >> 1u)) - int(d);
+        uint _150;
+        if (t >= 0)
+        {
+            _150 = q + (uint(t) / range);
+        }
+        else
+        {
+            _150 = q - (((uint(-t) + range) - 1u) / range);
+        }
+        return min(_150, 65535u);
+    }
+
+    static inline __attribute__((always_inline))
+    uint isqrt_round(uint n)
+    {
+        uint r = uint(sqrt(float(n)));
+        while ((r * r) > n)
+        {
+            r--;
+        }
+        while (((r + 1u) * (r + 1u)) <= n)
+        {
+            r++;
+        }
+        return (n > ((r * r) + r)) ? (r + 1u) : r;
+    }
+
+    static inline __attribute__((always_inline))
+    bool scaled_square_le(uint m, uint s, uint c_sq)
+    {
+        uint low = (m & 65535u) * s;
+        uint high = ((m >> 16u) * s) + (low >> 16u);
+        return (high < (c_sq << 4u)) || ((high == (c_sq << 4u)) && ((low & 65535u) == 0u));
+    }
+
+    static inline __attribute__((always_inline))
+    uint renormalized_component(uint c_sq, uint s)
+    {
+        uint k = uint((512.0 * sqrt(float(c_sq) / float(s))) + 0.5);
+        while ((k > 0u) && (!scaled_square_le(((2u * k) - 1u) * ((2u * k) - 1u), s, c_sq)))
+        {
+            k--;
+        }
+        while (scaled_square_le(((2u * k) + 1u) * ((2u * k) + 1u), s, c_sq))
+        {
+            k++;
+        }
+        return k;
+    }
+
+    static inline __attribute__((always_inline))
+    uint v2_rotation_to_smallest_three(uint offset, const device spz_planes& _61)
+    {
+        int3 c = int3(int(plane_byte(offset, _61) << 24u) >> 24, int(plane_byte(offset + 1u, _61) << 24u) >> 24, int(plane_byte(offset + 2u, _61) << 24u) >> 24);
+        int length_sq = ((c.x * c.x) + (c.y * c.y)) + (c.z * c.z);
+        int w_sq = max(16384 - length_sq, 0);
+        int squares[4] = { c.x * c.x, c.y * c.y, c.z * c.z, w_sq };
+        int components[4] = { 4 * c.x, 4 * c.y, 4 * c.z, int(isqrt_round(16u * uint(w_sq))) };
+        if (length_sq > 16384)
+        {
+            for (int k = 0; k < 3; k++)
+            {
+                int magnitude = int(renormalized_component(uint(squares[k]), uint(length_sq)));
+                components[k] = (c[k] < 0) ? (-magnitude) : magnitude;
+            }
+        }
+        uint largest = 0u;
+        for (uint j = 1u; j < 4u; j++)
+        {
+            if (squares[j] > squares[largest])
+            {
+                largest = j;
+            }
+        }
+        int sign_factor = (components[largest] < 0) ? (-1) : 1;
+        uint result = largest;
+        uint shift = 2u;
+        for (uint j_1 = 0u; j_1 < 4u; j_1++)
+        {
+            if (j_1 != largest)
+            {
+                result |= (uint(clamp((sign_factor * components[j_1]) + 512, 0, 1023)) << shift);
+                shift += 10u;
+            }
+        }
+        return result;
+    }
+
+    static inline __attribute__((always_inline))
+    uint4 decode_splat(uint j, thread uint3& position, constant decode_params& _40, const device spz_order& _66, const device spz_planes& _61, const device spz_chunks& _80)
+    {
+        uint i = (_40.use_order != 0) ? _66.order[j].value : j;
+        uint chunk = (j / 256u) * 8u;
+        uint pos_offset = uint(_40.positions_offset) + (i * 9u);
+        int3 v = int3(plane_fixed24(pos_offset, _61), -plane_fixed24(pos_offset + 3u, _61), plane_fixed24(pos_offset + 6u, _61));
+        for (uint k = 0u; k < 3u; k++)
+        {
+            position[k] = quantize_chunk_offset(uint(v[k] - int(_80.chunk_fixed[chunk + k].value)), _80.chunk_fixed[(chunk + 4u) + k].value);
+        }
+        uint rotation;
+        if (_40.version == 3)
+        {
+            uint rot_offset = uint(_40.rotations_offset) + (i * 4u);
+            rotation = ((plane_byte(rot_offset, _61) | (plane_byte(rot_offset + 1u, _61) << 8u)) | (plane_byte(rot_offset + 2u, _61) << 16u)) | (plane_byte(rot_offset + 3u, _61) << 24u);
+        }
+        else
+        {
+            rotation = v2_rotation_to_smallest_three(uint(_40.rotations_offset) + (i * 3u), _61);
+        }
+        uint scale_offset = uint(_40.scales_offset) + (i * 3u);
+        uint color_offset = uint(_40.colors_offset) + (i * 3u);
+        return uint4((position.x << 16u) | position.y, (position.z << 16u) | (rotation & 65535u), (((((rotation >> 16u) & 255u) << 24u) | (plane_byte(scale_offset, _61) << 16u)) | (plane_byte(scale_offset + 1u, _61) << 8u)) | (rotation >> 24u), (((plane_byte(color_offset, _61) << 24u) | (plane_byte(color_offset + 1u, _61) << 16u)) | (plane_byte(color_offset + 2u, _61) << 8u)) | plane_byte(uint(_40.alphas_offset) + i, _61));
+    }
+
+    kernel void main0(constant decode_params& _40 [[buffer(0)]], const device spz_planes& _61 [[buffer(10)]], const device spz_order& _66 [[buffer(11)]], const device spz_chunks& _80 [[buffer(12)]], device splat_buffer& _98 [[buffer(8)]], device position_buffer& _110 [[buffer(9)]], uint3 gl_GlobalInvocationID [[thread_position_in_grid]])
+    {
+        uint pair = (uint(_40.first_splat) / 2u) + gl_GlobalInvocationID.x;
+        uint j = pair * 2u;
+        if (j >= uint(_40.end_splat))
+        {
+            return;
+        }
+        uint3 b = uint3(0u);
+        uint3 a;
+        uint4 _610 = decode_splat(j, a, _40, _66, _61, _80);
+        _98.splats[j].value = _610;
+        bool has_b = (j + 1u) < uint(_40.end_splat);
+        if (has_b)
+        {
+            uint4 _630 = decode_splat(j + 1u, b, _40, _66, _61, _80);
+            _98.splats[j + 1u].value = _630;
+        }
+        uint word = pair * 3u;
+        _110.position_words[word].value = a.x | (a.y << 16u);
+        _110.position_words[word + 1u].value = a.z | (b.x << 16u);
+        if (has_b)
+        {
+            _110.position_words[word + 2u].value = b.y | (b.z << 16u);
+        }
+    }
+
+*/
+static const uint8_t spz_decode_source_metal_sim[6835] = {
+    0x23,0x70,0x72,0x61,0x67,0x6d,0x61,0x20,0x63,0x6c,0x61,0x6e,0x67,0x20,0x64,0x69,
+    0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x20,0x69,0x67,0x6e,0x6f,0x72,0x65,0x64,
+    0x20,0x22,0x2d,0x57,0x6d,0x69,0x73,0x73,0x69,0x6e,0x67,0x2d,0x70,0x72,0x6f,0x74,
+    0x6f,0x74,0x79,0x70,0x65,0x73,0x22,0x0a,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,
+    0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,
+    0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,
+    0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,
+    0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,
+    0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x64,0x65,0x63,0x6f,0x64,0x65,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,
+    0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x73,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x61,0x6c,0x70,0x68,0x61,0x73,
+    0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,
+    0x20,0x63,0x6f,0x6c,0x6f,0x72,0x73,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x73,0x63,0x61,0x6c,0x65,0x73,0x5f,0x6f,
+    0x66,0x66,0x73,0x65,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x72,
+    0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x73,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x66,0x69,0x72,0x73,0x74,0x5f,0x73,
+    0x70,0x6c,0x61,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x65,0x6e,
+    0x64,0x5f,0x73,0x70,0x6c,0x61,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,
+    0x20,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,
+    0x74,0x20,0x75,0x73,0x65,0x5f,0x6f,0x72,0x64,0x65,0x72,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x69,0x6e,0x74,0x20,0x5f,0x70,0x61,0x64,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x69,0x6e,0x74,0x20,0x5f,0x70,0x61,0x64,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,
+    0x6e,0x74,0x20,0x5f,0x70,0x61,0x64,0x32,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,
+    0x72,0x75,0x63,0x74,0x20,0x44,0x65,0x63,0x6f,0x64,0x65,0x57,0x6f,0x72,0x64,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x76,0x61,0x6c,0x75,0x65,
+    0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x73,0x70,0x7a,
+    0x5f,0x70,0x6c,0x61,0x6e,0x65,0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x44,0x65,
+    0x63,0x6f,0x64,0x65,0x57,0x6f,0x72,0x64,0x20,0x70,0x6c,0x61,0x6e,0x65,0x73,0x5b,
+    0x31,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x73,
+    0x70,0x7a,0x5f,0x6f,0x72,0x64,0x65,0x72,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x44,
+    0x65,0x63,0x6f,0x64,0x65,0x57,0x6f,0x72,0x64,0x20,0x6f,0x72,0x64,0x65,0x72,0x5b,
+    0x31,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x73,
+    0x70,0x7a,0x5f,0x63,0x68,0x75,0x6e,0x6b,0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x44,0x65,0x63,0x6f,0x64,0x65,0x57,0x6f,0x72,0x64,0x20,0x63,0x68,0x75,0x6e,0x6b,
+    0x5f,0x66,0x69,0x78,0x65,0x64,0x5b,0x31,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,
+    0x74,0x72,0x75,0x63,0x74,0x20,0x44,0x65,0x63,0x6f,0x64,0x65,0x54,0x65,0x78,0x65,
+    0x6c,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x34,0x20,0x76,0x61,
+    0x6c,0x75,0x65,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,
+    0x73,0x70,0x6c,0x61,0x74,0x5f,0x62,0x75,0x66,0x66,0x65,0x72,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x44,0x65,0x63,0x6f,0x64,0x65,0x54,0x65,0x78,0x65,0x6c,0x20,0x73,
+    0x70,0x6c,0x61,0x74,0x73,0x5b,0x31,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,
+    0x72,0x75,0x63,0x74,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x62,0x75,
+    0x66,0x66,0x65,0x72,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x44,0x65,0x63,0x6f,0x64,
+    0x65,0x57,0x6f,0x72,0x64,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x77,
+    0x6f,0x72,0x64,0x73,0x5b,0x31,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x63,0x6f,0x6e,
+    0x73,0x74,0x61,0x6e,0x74,0x20,0x75,0x69,0x6e,0x74,0x33,0x20,0x67,0x6c,0x5f,0x57,
+    0x6f,0x72,0x6b,0x47,0x72,0x6f,0x75,0x70,0x53,0x69,0x7a,0x65,0x20,0x5b,0x5b,0x6d,
+    0x61,0x79,0x62,0x65,0x5f,0x75,0x6e,0x75,0x73,0x65,0x64,0x5d,0x5d,0x20,0x3d,0x20,
+    0x75,0x69,0x6e,0x74,0x33,0x28,0x32,0x35,0x36,0x75,0x2c,0x20,0x31,0x75,0x2c,0x20,
+    0x31,0x75,0x29,0x3b,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,
+    0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,
+    0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,
+    0x29,0x29,0x0a,0x75,0x69,0x6e,0x74,0x20,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,
+    0x74,0x65,0x28,0x75,0x69,0x6e,0x74,0x20,0x6f,0x66,0x66,0x73,0x65,0x74,0x2c,0x20,
+    0x63,0x6f,0x6e,0x73,0x74,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x73,0x70,0x7a,
+    0x5f,0x70,0x6c,0x61,0x6e,0x65,0x73,0x26,0x20,0x5f,0x36,0x31,0x29,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x28,0x5f,0x36,0x31,0x2e,
+    0x70,0x6c,0x61,0x6e,0x65,0x73,0x5b,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x3e,0x3e,
+    0x20,0x32,0x75,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3e,0x3e,0x20,0x28,0x28,
+    0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x26,0x20,0x33,0x75,0x29,0x20,0x2a,0x20,0x38,
+    0x75,0x29,0x29,0x20,0x26,0x20,0x32,0x35,0x35,0x75,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,
+    0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,
+    0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,
+    0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x69,0x6e,0x74,0x20,
+    0x70,0x6c,0x61,0x6e,0x65,0x5f,0x66,0x69,0x78,0x65,0x64,0x32,0x34,0x28,0x75,0x69,
+    0x6e,0x74,0x20,0x6f,0x66,0x66,0x73,0x65,0x74,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,
+    0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x73,0x70,0x7a,0x5f,0x70,0x6c,0x61,0x6e,
+    0x65,0x73,0x26,0x20,0x5f,0x36,0x31,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,
+    0x69,0x6e,0x74,0x20,0x72,0x61,0x77,0x20,0x3d,0x20,0x28,0x70,0x6c,0x61,0x6e,0x65,
+    0x5f,0x62,0x79,0x74,0x65,0x28,0x6f,0x66,0x66,0x73,0x65,0x74,0x2c,0x20,0x5f,0x36,
+    0x31,0x29,0x20,0x7c,0x20,0x28,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,0x74,0x65,
+    0x28,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x2b,0x20,0x31,0x75,0x2c,0x20,0x5f,0x36,
+    0x31,0x29,0x20,0x3c,0x3c,0x20,0x38,0x75,0x29,0x29,0x20,0x7c,0x20,0x28,0x70,0x6c,
+    0x61,0x6e,0x65,0x5f,0x62,0x79,0x74,0x65,0x28,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,
+    0x2b,0x20,0x32,0x75,0x2c,0x20,0x5f,0x36,0x31,0x29,0x20,0x3c,0x3c,0x20,0x31,0x36,
+    0x75,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x69,
+    0x6e,0x74,0x28,0x72,0x61,0x77,0x20,0x3c,0x3c,0x20,0x38,0x75,0x29,0x20,0x3e,0x3e,
+    0x20,0x38,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,
+    0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,
+    0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,
+    0x65,0x29,0x29,0x0a,0x75,0x69,0x6e,0x74,0x20,0x71,0x75,0x61,0x6e,0x74,0x69,0x7a,
+    0x65,0x5f,0x63,0x68,0x75,0x6e,0x6b,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x75,
+    0x69,0x6e,0x74,0x20,0x64,0x2c,0x20,0x75,0x69,0x6e,0x74,0x20,0x72,0x61,0x6e,0x67,
+    0x65,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x72,0x61,0x6e,
+    0x67,0x65,0x20,0x3d,0x3d,0x20,0x30,0x75,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x30,
+    0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,
+    0x74,0x20,0x71,0x20,0x3d,0x20,0x28,0x64,0x20,0x3e,0x3d,0x20,0x72,0x61,0x6e,0x67,
+    0x65,0x29,0x20,0x3f,0x20,0x31,0x75,0x20,0x3a,0x20,0x30,0x75,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x72,0x20,0x3d,0x20,0x64,0x20,0x2d,0x20,0x28,
+    0x71,0x20,0x2a,0x20,0x72,0x61,0x6e,0x67,0x65,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x62,0x69,0x74,0x20,0x3d,0x20,0x30,
+    0x3b,0x20,0x62,0x69,0x74,0x20,0x3c,0x20,0x31,0x36,0x3b,0x20,0x62,0x69,0x74,0x2b,
+    0x2b,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x72,0x20,0x3d,0x20,0x72,0x20,0x3c,0x3c,0x20,0x31,0x75,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x71,0x20,0x3d,0x20,0x71,0x20,0x3c,0x3c,0x20,0x31,
+    0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x72,
+    0x20,0x3e,0x3d,0x20,0x72,0x61,0x6e,0x67,0x65,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x72,0x20,0x2d,0x3d,0x20,0x72,0x61,0x6e,0x67,0x65,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x71,0x20,0x7c,0x3d,0x20,0x31,0x75,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
+    0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x74,0x20,0x3d,0x20,0x69,0x6e,
+    0x74,0x28,0x72,0x20,0x2b,0x20,0x28,0x72,0x61,0x6e,0x67,0x65,0x20,0x3e,0x3e,0x20,
+    0x31,0x75,0x29,0x29,0x20,0x2d,0x20,0x69,0x6e,0x74,0x28,0x64,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,0x31,0x35,0x30,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x20,0x3e,0x3d,0x20,0x30,0x29,0x0a,0x20,0x20,
+    0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x31,0x35,0x30,
+    0x20,0x3d,0x20,0x71,0x20,0x2b,0x20,0x28,0x75,0x69,0x6e,0x74,0x28,0x74,0x29,0x20,
+    0x2f,0x20,0x72,0x61,0x6e,0x67,0x65,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,
+    0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x31,0x35,0x30,0x20,0x3d,0x20,0x71,0x20,
+    0x2d,0x20,0x28,0x28,0x28,0x75,0x69,0x6e,0x74,0x28,0x2d,0x74,0x29,0x20,0x2b,0x20,
+    0x72,0x61,0x6e,0x67,0x65,0x29,0x20,0x2d,0x20,0x31,0x75,0x29,0x20,0x2f,0x20,0x72,
+    0x61,0x6e,0x67,0x65,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
+    0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6d,0x69,0x6e,0x28,0x5f,0x31,0x35,0x30,
+    0x2c,0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,
+    0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,
+    0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,
+    0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x75,0x69,0x6e,0x74,0x20,
+    0x69,0x73,0x71,0x72,0x74,0x5f,0x72,0x6f,0x75,0x6e,0x64,0x28,0x75,0x69,0x6e,0x74,
+    0x20,0x6e,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x72,
+    0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,0x28,0x73,0x71,0x72,0x74,0x28,0x66,0x6c,0x6f,
+    0x61,0x74,0x28,0x6e,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x77,0x68,0x69,
+    0x6c,0x65,0x20,0x28,0x28,0x72,0x20,0x2a,0x20,0x72,0x29,0x20,0x3e,0x20,0x6e,0x29,
+    0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,
+    0x2d,0x2d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x77,0x68,
+    0x69,0x6c,0x65,0x20,0x28,0x28,0x28,0x72,0x20,0x2b,0x20,0x31,0x75,0x29,0x20,0x2a,
+    0x20,0x28,0x72,0x20,0x2b,0x20,0x31,0x75,0x29,0x29,0x20,0x3c,0x3d,0x20,0x6e,0x29,
+    0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,
+    0x2b,0x2b,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,
+    0x74,0x75,0x72,0x6e,0x20,0x28,0x6e,0x20,0x3e,0x20,0x28,0x28,0x72,0x20,0x2a,0x20,
+    0x72,0x29,0x20,0x2b,0x20,0x72,0x29,0x29,0x20,0x3f,0x20,0x28,0x72,0x20,0x2b,0x20,
+    0x31,0x75,0x29,0x20,0x3a,0x20,0x72,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,
+    0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,
+    0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,
+    0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x62,0x6f,0x6f,0x6c,0x20,0x73,0x63,
+    0x61,0x6c,0x65,0x64,0x5f,0x73,0x71,0x75,0x61,0x72,0x65,0x5f,0x6c,0x65,0x28,0x75,
+    0x69,0x6e,0x74,0x20,0x6d,0x2c,0x20,0x75,0x69,0x6e,0x74,0x20,0x73,0x2c,0x20,0x75,
+    0x69,0x6e,0x74,0x20,0x63,0x5f,0x73,0x71,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x75,0x69,0x6e,0x74,0x20,0x6c,0x6f,0x77,0x20,0x3d,0x20,0x28,0x6d,0x20,0x26,0x20,
+    0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x20,0x2a,0x20,0x73,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x75,0x69,0x6e,0x74,0x20,0x68,0x69,0x67,0x68,0x20,0x3d,0x20,0x28,0x28,0x6d,
+    0x20,0x3e,0x3e,0x20,0x31,0x36,0x75,0x29,0x20,0x2a,0x20,0x73,0x29,0x20,0x2b,0x20,
+    0x28,0x6c,0x6f,0x77,0x20,0x3e,0x3e,0x20,0x31,0x36,0x75,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x28,0x68,0x69,0x67,0x68,0x20,0x3c,
+    0x20,0x28,0x63,0x5f,0x73,0x71,0x20,0x3c,0x3c,0x20,0x34,0x75,0x29,0x29,0x20,0x7c,
+    0x7c,0x20,0x28,0x28,0x68,0x69,0x67,0x68,0x20,0x3d,0x3d,0x20,0x28,0x63,0x5f,0x73,
+    0x71,0x20,0x3c,0x3c,0x20,0x34,0x75,0x29,0x29,0x20,0x26,0x26,0x20,0x28,0x28,0x6c,
+    0x6f,0x77,0x20,0x26,0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x20,0x3d,0x3d,0x20,
+    0x30,0x75,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,
+    0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,
+    0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,
+    0x69,0x6e,0x65,0x29,0x29,0x0a,0x75,0x69,0x6e,0x74,0x20,0x72,0x65,0x6e,0x6f,0x72,
+    0x6d,0x61,0x6c,0x69,0x7a,0x65,0x64,0x5f,0x63,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,
+    0x74,0x28,0x75,0x69,0x6e,0x74,0x20,0x63,0x5f,0x73,0x71,0x2c,0x20,0x75,0x69,0x6e,
+    0x74,0x20,0x73,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,
+    0x6b,0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,0x28,0x28,0x35,0x31,0x32,0x2e,0x30,0x20,
+    0x2a,0x20,0x73,0x71,0x72,0x74,0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x63,0x5f,0x73,
+    0x71,0x29,0x20,0x2f,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x73,0x29,0x29,0x29,0x20,
+    0x2b,0x20,0x30,0x2e,0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x77,0x68,0x69,0x6c,
+    0x65,0x20,0x28,0x28,0x6b,0x20,0x3e,0x20,0x30,0x75,0x29,0x20,0x26,0x26,0x20,0x28,
+    0x21,0x73,0x63,0x61,0x6c,0x65,0x64,0x5f,0x73,0x71,0x75,0x61,0x72,0x65,0x5f,0x6c,
+    0x65,0x28,0x28,0x28,0x32,0x75,0x20,0x2a,0x20,0x6b,0x29,0x20,0x2d,0x20,0x31,0x75,
+    0x29,0x20,0x2a,0x20,0x28,0x28,0x32,0x75,0x20,0x2a,0x20,0x6b,0x29,0x20,0x2d,0x20,
+    0x31,0x75,0x29,0x2c,0x20,0x73,0x2c,0x20,0x63,0x5f,0x73,0x71,0x29,0x29,0x29,0x0a,
+    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6b,0x2d,
+    0x2d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x77,0x68,0x69,
+    0x6c,0x65,0x20,0x28,0x73,0x63,0x61,0x6c,0x65,0x64,0x5f,0x73,0x71,0x75,0x61,0x72,
+    0x65,0x5f,0x6c,0x65,0x28,0x28,0x28,0x32,0x75,0x20,0x2a,0x20,0x6b,0x29,0x20,0x2b,
+    0x20,0x31,0x75,0x29,0x20,0x2a,0x20,0x28,0x28,0x32,0x75,0x20,0x2a,0x20,0x6b,0x29,
+    0x20,0x2b,0x20,0x31,0x75,0x29,0x2c,0x20,0x73,0x2c,0x20,0x63,0x5f,0x73,0x71,0x29,
+    0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x6b,0x2b,0x2b,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,
+    0x65,0x74,0x75,0x72,0x6e,0x20,0x6b,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,
+    0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,
+    0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,
+    0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x75,0x69,0x6e,0x74,0x20,0x76,0x32,
+    0x5f,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x5f,0x74,0x6f,0x5f,0x73,0x6d,0x61,
+    0x6c,0x6c,0x65,0x73,0x74,0x5f,0x74,0x68,0x72,0x65,0x65,0x28,0x75,0x69,0x6e,0x74,
+    0x20,0x6f,0x66,0x66,0x73,0x65,0x74,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x64,
+    0x65,0x76,0x69,0x63,0x65,0x20,0x73,0x70,0x7a,0x5f,0x70,0x6c,0x61,0x6e,0x65,0x73,
+    0x26,0x20,0x5f,0x36,0x31,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,
+    0x33,0x20,0x63,0x20,0x3d,0x20,0x69,0x6e,0x74,0x33,0x28,0x69,0x6e,0x74,0x28,0x70,
+    0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,0x74,0x65,0x28,0x6f,0x66,0x66,0x73,0x65,0x74,
+    0x2c,0x20,0x5f,0x36,0x31,0x29,0x20,0x3c,0x3c,0x20,0x32,0x34,0x75,0x29,0x20,0x3e,
+    0x3e,0x20,0x32,0x34,0x2c,0x20,0x69,0x6e,0x74,0x28,0x70,0x6c,0x61,0x6e,0x65,0x5f,
+    0x62,0x79,0x74,0x65,0x28,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x2b,0x20,0x31,0x75,
+    0x2c,0x20,0x5f,0x36,0x31,0x29,0x20,0x3c,0x3c,0x20,0x32,0x34,0x75,0x29,0x20,0x3e,
+    0x3e,0x20,0x32,0x34,0x2c,0x20,0x69,0x6e,0x74,0x28,0x70,0x6c,0x61,0x6e,0x65,0x5f,
+    0x62,0x79,0x74,0x65,0x28,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x2b,0x20,0x32,0x75,
+    0x2c,0x20,0x5f,0x36,0x31,0x29,0x20,0x3c,0x3c,0x20,0x32,0x34,0x75,0x29,0x20,0x3e,
+    0x3e,0x20,0x32,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x6c,
+    0x65,0x6e,0x67,0x74,0x68,0x5f,0x73,0x71,0x20,0x3d,0x20,0x28,0x28,0x63,0x2e,0x78,
+    0x20,0x2a,0x20,0x63,0x2e,0x78,0x29,0x20,0x2b,0x20,0x28,0x63,0x2e,0x79,0x20,0x2a,
+    0x20,0x63,0x2e,0x79,0x29,0x29,0x20,0x2b,0x20,0x28,0x63,0x2e,0x7a,0x20,0x2a,0x20,
+    0x63,0x2e,0x7a,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x77,0x5f,
+    0x73,0x71,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x31,0x36,0x33,0x38,0x34,0x20,0x2d,
+    0x20,0x6c,0x65,0x6e,0x67,0x74,0x68,0x5f,0x73,0x71,0x2c,0x20,0x30,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x73,0x71,0x75,0x61,0x72,0x65,0x73,0x5b,
+    0x34,0x5d,0x20,0x3d,0x20,0x7b,0x20,0x63,0x2e,0x78,0x20,0x2a,0x20,0x63,0x2e,0x78,
+    0x2c,0x20,0x63,0x2e,0x79,0x20,0x2a,0x20,0x63,0x2e,0x79,0x2c,0x20,0x63,0x2e,0x7a,
+    0x20,0x2a,0x20,0x63,0x2e,0x7a,0x2c,0x20,0x77,0x5f,0x73,0x71,0x20,0x7d,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x63,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,
+    0x74,0x73,0x5b,0x34,0x5d,0x20,0x3d,0x20,0x7b,0x20,0x34,0x20,0x2a,0x20,0x63,0x2e,
+    0x78,0x2c,0x20,0x34,0x20,0x2a,0x20,0x63,0x2e,0x79,0x2c,0x20,0x34,0x20,0x2a,0x20,
+    0x63,0x2e,0x7a,0x2c,0x20,0x69,0x6e,0x74,0x28,0x69,0x73,0x71,0x72,0x74,0x5f,0x72,
+    0x6f,0x75,0x6e,0x64,0x28,0x31,0x36,0x75,0x20,0x2a,0x20,0x75,0x69,0x6e,0x74,0x28,
+    0x77,0x5f,0x73,0x71,0x29,0x29,0x29,0x20,0x7d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,
+    0x66,0x20,0x28,0x6c,0x65,0x6e,0x67,0x74,0x68,0x5f,0x73,0x71,0x20,0x3e,0x20,0x31,
+    0x36,0x33,0x38,0x34,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x6b,0x20,0x3d,
+    0x20,0x30,0x3b,0x20,0x6b,0x20,0x3c,0x20,0x33,0x3b,0x20,0x6b,0x2b,0x2b,0x29,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x6d,0x61,0x67,0x6e,0x69,0x74,
+    0x75,0x64,0x65,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,0x72,0x65,0x6e,0x6f,0x72,0x6d,
+    0x61,0x6c,0x69,0x7a,0x65,0x64,0x5f,0x63,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,0x74,
+    0x28,0x75,0x69,0x6e,0x74,0x28,0x73,0x71,0x75,0x61,0x72,0x65,0x73,0x5b,0x6b,0x5d,
+    0x29,0x2c,0x20,0x75,0x69,0x6e,0x74,0x28,0x6c,0x65,0x6e,0x67,0x74,0x68,0x5f,0x73,
+    0x71,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x63,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,0x74,0x73,0x5b,0x6b,0x5d,0x20,
+    0x3d,0x20,0x28,0x63,0x5b,0x6b,0x5d,0x20,0x3c,0x20,0x30,0x29,0x20,0x3f,0x20,0x28,
+    0x2d,0x6d,0x61,0x67,0x6e,0x69,0x74,0x75,0x64,0x65,0x29,0x20,0x3a,0x20,0x6d,0x61,
+    0x67,0x6e,0x69,0x74,0x75,0x64,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,
+    0x74,0x20,0x6c,0x61,0x72,0x67,0x65,0x73,0x74,0x20,0x3d,0x20,0x30,0x75,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x75,0x69,0x6e,0x74,0x20,0x6a,0x20,
+    0x3d,0x20,0x31,0x75,0x3b,0x20,0x6a,0x20,0x3c,0x20,0x34,0x75,0x3b,0x20,0x6a,0x2b,
+    0x2b,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x69,0x66,0x20,0x28,0x73,0x71,0x75,0x61,0x72,0x65,0x73,0x5b,0x6a,0x5d,0x20,
+    0x3e,0x20,0x73,0x71,0x75,0x61,0x72,0x65,0x73,0x5b,0x6c,0x61,0x72,0x67,0x65,0x73,
+    0x74,0x5d,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6c,0x61,0x72,0x67,0x65,0x73,
+    0x74,0x20,0x3d,0x20,0x6a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,
+    0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x73,
+    0x69,0x67,0x6e,0x5f,0x66,0x61,0x63,0x74,0x6f,0x72,0x20,0x3d,0x20,0x28,0x63,0x6f,
+    0x6d,0x70,0x6f,0x6e,0x65,0x6e,0x74,0x73,0x5b,0x6c,0x61,0x72,0x67,0x65,0x73,0x74,
+    0x5d,0x20,0x3c,0x20,0x30,0x29,0x20,0x3f,0x20,0x28,0x2d,0x31,0x29,0x20,0x3a,0x20,
+    0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x72,0x65,0x73,0x75,
+    0x6c,0x74,0x20,0x3d,0x20,0x6c,0x61,0x72,0x67,0x65,0x73,0x74,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x73,0x68,0x69,0x66,0x74,0x20,0x3d,0x20,0x32,
+    0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x75,0x69,0x6e,0x74,
+    0x20,0x6a,0x5f,0x31,0x20,0x3d,0x20,0x30,0x75,0x3b,0x20,0x6a,0x5f,0x31,0x20,0x3c,
+    0x20,0x34,0x75,0x3b,0x20,0x6a,0x5f,0x31,0x2b,0x2b,0x29,0x0a,0x20,0x20,0x20,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x6a,0x5f,
+    0x31,0x20,0x21,0x3d,0x20,0x6c,0x61,0x72,0x67,0x65,0x73,0x74,0x29,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x7c,0x3d,0x20,0x28,0x75,
+    0x69,0x6e,0x74,0x28,0x63,0x6c,0x61,0x6d,0x70,0x28,0x28,0x73,0x69,0x67,0x6e,0x5f,
+    0x66,0x61,0x63,0x74,0x6f,0x72,0x20,0x2a,0x20,0x63,0x6f,0x6d,0x70,0x6f,0x6e,0x65,
+    0x6e,0x74,0x73,0x5b,0x6a,0x5f,0x31,0x5d,0x29,0x20,0x2b,0x20,0x35,0x31,0x32,0x2c,
+    0x20,0x30,0x2c,0x20,0x31,0x30,0x32,0x33,0x29,0x29,0x20,0x3c,0x3c,0x20,0x73,0x68,
+    0x69,0x66,0x74,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x73,0x68,0x69,0x66,0x74,0x20,0x2b,0x3d,0x20,0x31,0x30,0x75,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,
+    0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x72,0x65,0x73,0x75,0x6c,
+    0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,
+    0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,
+    0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,
+    0x29,0x29,0x0a,0x75,0x69,0x6e,0x74,0x34,0x20,0x64,0x65,0x63,0x6f,0x64,0x65,0x5f,
+    0x73,0x70,0x6c,0x61,0x74,0x28,0x75,0x69,0x6e,0x74,0x20,0x6a,0x2c,0x20,0x74,0x68,
+    0x72,0x65,0x61,0x64,0x20,0x75,0x69,0x6e,0x74,0x33,0x26,0x20,0x70,0x6f,0x73,0x69,
+    0x74,0x69,0x6f,0x6e,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x64,
+    0x65,0x63,0x6f,0x64,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x26,0x20,0x5f,0x34,
+    0x30,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,
+    0x73,0x70,0x7a,0x5f,0x6f,0x72,0x64,0x65,0x72,0x26,0x20,0x5f,0x36,0x36,0x2c,0x20,
+    0x63,0x6f,0x6e,0x73,0x74,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x73,0x70,0x7a,
+    0x5f,0x70,0x6c,0x61,0x6e,0x65,0x73,0x26,0x20,0x5f,0x36,0x31,0x2c,0x20,0x63,0x6f,
+    0x6e,0x73,0x74,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x73,0x70,0x7a,0x5f,0x63,
+    0x68,0x75,0x6e,0x6b,0x73,0x26,0x20,0x5f,0x38,0x30,0x29,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x69,0x20,0x3d,0x20,0x28,0x5f,0x34,0x30,0x2e,
+    0x75,0x73,0x65,0x5f,0x6f,0x72,0x64,0x65,0x72,0x20,0x21,0x3d,0x20,0x30,0x29,0x20,
+    0x3f,0x20,0x5f,0x36,0x36,0x2e,0x6f,0x72,0x64,0x65,0x72,0x5b,0x6a,0x5d,0x2e,0x76,
+    0x61,0x6c,0x75,0x65,0x20,0x3a,0x20,0x6a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,
+    0x6e,0x74,0x20,0x63,0x68,0x75,0x6e,0x6b,0x20,0x3d,0x20,0x28,0x6a,0x20,0x2f,0x20,
+    0x32,0x35,0x36,0x75,0x29,0x20,0x2a,0x20,0x38,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x75,0x69,0x6e,0x74,0x20,0x70,0x6f,0x73,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,
+    0x3d,0x20,0x75,0x69,0x6e,0x74,0x28,0x5f,0x34,0x30,0x2e,0x70,0x6f,0x73,0x69,0x74,
+    0x69,0x6f,0x6e,0x73,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x29,0x20,0x2b,0x20,0x28,
+    0x69,0x20,0x2a,0x20,0x39,0x75,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,
+    0x33,0x20,0x76,0x20,0x3d,0x20,0x69,0x6e,0x74,0x33,0x28,0x70,0x6c,0x61,0x6e,0x65,
+    0x5f,0x66,0x69,0x78,0x65,0x64,0x32,0x34,0x28,0x70,0x6f,0x73,0x5f,0x6f,0x66,0x66,
+    0x73,0x65,0x74,0x2c,0x20,0x5f,0x36,0x31,0x29,0x2c,0x20,0x2d,0x70,0x6c,0x61,0x6e,
+    0x65,0x5f,0x66,0x69,0x78,0x65,0x64,0x32,0x34,0x28,0x70,0x6f,0x73,0x5f,0x6f,0x66,
+    0x66,0x73,0x65,0x74,0x20,0x2b,0x20,0x33,0x75,0x2c,0x20,0x5f,0x36,0x31,0x29,0x2c,
+    0x20,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x66,0x69,0x78,0x65,0x64,0x32,0x34,0x28,0x70,
+    0x6f,0x73,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x2b,0x20,0x36,0x75,0x2c,0x20,
+    0x5f,0x36,0x31,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,
+    0x75,0x69,0x6e,0x74,0x20,0x6b,0x20,0x3d,0x20,0x30,0x75,0x3b,0x20,0x6b,0x20,0x3c,
+    0x20,0x33,0x75,0x3b,0x20,0x6b,0x2b,0x2b,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
+    0x5b,0x6b,0x5d,0x20,0x3d,0x20,0x71,0x75,0x61,0x6e,0x74,0x69,0x7a,0x65,0x5f,0x63,
+    0x68,0x75,0x6e,0x6b,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x75,0x69,0x6e,0x74,
+    0x28,0x76,0x5b,0x6b,0x5d,0x20,0x2d,0x20,0x69,0x6e,0x74,0x28,0x5f,0x38,0x30,0x2e,
+    0x63,0x68,0x75,0x6e,0x6b,0x5f,0x66,0x69,0x78,0x65,0x64,0x5b,0x63,0x68,0x75,0x6e,
+    0x6b,0x20,0x2b,0x20,0x6b,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x29,0x29,0x2c,0x20,
+    0x5f,0x38,0x30,0x2e,0x63,0x68,0x75,0x6e,0x6b,0x5f,0x66,0x69,0x78,0x65,0x64,0x5b,
+    0x28,0x63,0x68,0x75,0x6e,0x6b,0x20,0x2b,0x20,0x34,0x75,0x29,0x20,0x2b,0x20,0x6b,
+    0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,
+    0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,
+    0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x34,0x30,0x2e,0x76,
+    0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x3d,0x3d,0x20,0x33,0x29,0x0a,0x20,0x20,0x20,
+    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,
+    0x72,0x6f,0x74,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x3d,0x20,0x75,0x69,0x6e,
+    0x74,0x28,0x5f,0x34,0x30,0x2e,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x73,0x5f,
+    0x6f,0x66,0x66,0x73,0x65,0x74,0x29,0x20,0x2b,0x20,0x28,0x69,0x20,0x2a,0x20,0x34,
+    0x75,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x6f,0x74,0x61,
+    0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x28,0x28,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,
+    0x79,0x74,0x65,0x28,0x72,0x6f,0x74,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x2c,0x20,
+    0x5f,0x36,0x31,0x29,0x20,0x7c,0x20,0x28,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,
+    0x74,0x65,0x28,0x72,0x6f,0x74,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x2b,0x20,
+    0x31,0x75,0x2c,0x20,0x5f,0x36,0x31,0x29,0x20,0x3c,0x3c,0x20,0x38,0x75,0x29,0x29,
+    0x20,0x7c,0x20,0x28,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,0x74,0x65,0x28,0x72,
+    0x6f,0x74,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x2b,0x20,0x32,0x75,0x2c,0x20,
+    0x5f,0x36,0x31,0x29,0x20,0x3c,0x3c,0x20,0x31,0x36,0x75,0x29,0x29,0x20,0x7c,0x20,
+    0x28,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,0x74,0x65,0x28,0x72,0x6f,0x74,0x5f,
+    0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x2b,0x20,0x33,0x75,0x2c,0x20,0x5f,0x36,0x31,
+    0x29,0x20,0x3c,0x3c,0x20,0x32,0x34,0x75,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,
+    0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,
+    0x20,0x3d,0x20,0x76,0x32,0x5f,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x5f,0x74,
+    0x6f,0x5f,0x73,0x6d,0x61,0x6c,0x6c,0x65,0x73,0x74,0x5f,0x74,0x68,0x72,0x65,0x65,
+    0x28,0x75,0x69,0x6e,0x74,0x28,0x5f,0x34,0x30,0x2e,0x72,0x6f,0x74,0x61,0x74,0x69,
+    0x6f,0x6e,0x73,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x29,0x20,0x2b,0x20,0x28,0x69,
+    0x20,0x2a,0x20,0x33,0x75,0x29,0x2c,0x20,0x5f,0x36,0x31,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x73,0x63,0x61,
+    0x6c,0x65,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,
+    0x28,0x5f,0x34,0x30,0x2e,0x73,0x63,0x61,0x6c,0x65,0x73,0x5f,0x6f,0x66,0x66,0x73,
+    0x65,0x74,0x29,0x20,0x2b,0x20,0x28,0x69,0x20,0x2a,0x20,0x33,0x75,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,
+    0x66,0x66,0x73,0x65,0x74,0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,0x28,0x5f,0x34,0x30,
+    0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x73,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x29,0x20,
+    0x2b,0x20,0x28,0x69,0x20,0x2a,0x20,0x33,0x75,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x75,0x69,0x6e,0x74,0x34,0x28,0x28,0x70,0x6f,
+    0x73,0x69,0x74,0x69,0x6f,0x6e,0x2e,0x78,0x20,0x3c,0x3c,0x20,0x31,0x36,0x75,0x29,
+    0x20,0x7c,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2e,0x79,0x2c,0x20,0x28,
+    0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2e,0x7a,0x20,0x3c,0x3c,0x20,0x31,0x36,
+    0x75,0x29,0x20,0x7c,0x20,0x28,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x20,0x26,
+    0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x2c,0x20,0x28,0x28,0x28,0x28,0x28,0x72,
+    0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3e,0x3e,0x20,0x31,0x36,0x75,0x29,0x20,
+    0x26,0x20,0x32,0x35,0x35,0x75,0x29,0x20,0x3c,0x3c,0x20,0x32,0x34,0x75,0x29,0x20,
+    0x7c,0x20,0x28,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,0x74,0x65,0x28,0x73,0x63,
+    0x61,0x6c,0x65,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x2c,0x20,0x5f,0x36,0x31,0x29,
+    0x20,0x3c,0x3c,0x20,0x31,0x36,0x75,0x29,0x29,0x20,0x7c,0x20,0x28,0x70,0x6c,0x61,
+    0x6e,0x65,0x5f,0x62,0x79,0x74,0x65,0x28,0x73,0x63,0x61,0x6c,0x65,0x5f,0x6f,0x66,
+    0x66,0x73,0x65,0x74,0x20,0x2b,0x20,0x31,0x75,0x2c,0x20,0x5f,0x36,0x31,0x29,0x20,
+    0x3c,0x3c,0x20,0x38,0x75,0x29,0x29,0x20,0x7c,0x20,0x28,0x72,0x6f,0x74,0x61,0x74,
+    0x69,0x6f,0x6e,0x20,0x3e,0x3e,0x20,0x32,0x34,0x75,0x29,0x2c,0x20,0x28,0x28,0x28,
+    0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,0x74,0x65,0x28,0x63,0x6f,0x6c,0x6f,0x72,
+    0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x2c,0x20,0x5f,0x36,0x31,0x29,0x20,0x3c,0x3c,
+    0x20,0x32,0x34,0x75,0x29,0x20,0x7c,0x20,0x28,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,
+    0x79,0x74,0x65,0x28,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,
+    0x20,0x2b,0x20,0x31,0x75,0x2c,0x20,0x5f,0x36,0x31,0x29,0x20,0x3c,0x3c,0x20,0x31,
+    0x36,0x75,0x29,0x29,0x20,0x7c,0x20,0x28,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,
+    0x74,0x65,0x28,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,
+    0x2b,0x20,0x32,0x75,0x2c,0x20,0x5f,0x36,0x31,0x29,0x20,0x3c,0x3c,0x20,0x38,0x75,
+    0x29,0x29,0x20,0x7c,0x20,0x70,0x6c,0x61,0x6e,0x65,0x5f,0x62,0x79,0x74,0x65,0x28,
+    0x75,0x69,0x6e,0x74,0x28,0x5f,0x34,0x30,0x2e,0x61,0x6c,0x70,0x68,0x61,0x73,0x5f,
+    0x6f,0x66,0x66,0x73,0x65,0x74,0x29,0x20,0x2b,0x20,0x69,0x2c,0x20,0x5f,0x36,0x31,
+    0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x6b,0x65,0x72,0x6e,0x65,0x6c,0x20,0x76,0x6f,
+    0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x30,0x28,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,
+    0x74,0x20,0x64,0x65,0x63,0x6f,0x64,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x26,
+    0x20,0x5f,0x34,0x30,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x30,0x29,
+    0x5d,0x5d,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x64,0x65,0x76,0x69,0x63,0x65,
+    0x20,0x73,0x70,0x7a,0x5f,0x70,0x6c,0x61,0x6e,0x65,0x73,0x26,0x20,0x5f,0x36,0x31,
+    0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x31,0x30,0x29,0x5d,0x5d,0x2c,
+    0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x73,0x70,
+    0x7a,0x5f,0x6f,0x72,0x64,0x65,0x72,0x26,0x20,0x5f,0x36,0x36,0x20,0x5b,0x5b,0x62,
+    0x75,0x66,0x66,0x65,0x72,0x28,0x31,0x31,0x29,0x5d,0x5d,0x2c,0x20,0x63,0x6f,0x6e,
+    0x73,0x74,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x73,0x70,0x7a,0x5f,0x63,0x68,
+    0x75,0x6e,0x6b,0x73,0x26,0x20,0x5f,0x38,0x30,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,
+    0x65,0x72,0x28,0x31,0x32,0x29,0x5d,0x5d,0x2c,0x20,0x64,0x65,0x76,0x69,0x63,0x65,
+    0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x62,0x75,0x66,0x66,0x65,0x72,0x26,0x20,0x5f,
+    0x39,0x38,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x38,0x29,0x5d,0x5d,
+    0x2c,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,
+    0x6e,0x5f,0x62,0x75,0x66,0x66,0x65,0x72,0x26,0x20,0x5f,0x31,0x31,0x30,0x20,0x5b,
+    0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x39,0x29,0x5d,0x5d,0x2c,0x20,0x75,0x69,
+    0x6e,0x74,0x33,0x20,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,
+    0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x20,0x5b,0x5b,0x74,0x68,0x72,0x65,
+    0x61,0x64,0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x69,0x6e,0x5f,0x67,
+    0x72,0x69,0x64,0x5d,0x5d,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,
+    0x74,0x20,0x70,0x61,0x69,0x72,0x20,0x3d,0x20,0x28,0x75,0x69,0x6e,0x74,0x28,0x5f,
+    0x34,0x30,0x2e,0x66,0x69,0x72,0x73,0x74,0x5f,0x73,0x70,0x6c,0x61,0x74,0x29,0x20,
+    0x2f,0x20,0x32,0x75,0x29,0x20,0x2b,0x20,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,
+    0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x6a,0x20,0x3d,0x20,0x70,0x61,
+    0x69,0x72,0x20,0x2a,0x20,0x32,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
+    0x28,0x6a,0x20,0x3e,0x3d,0x20,0x75,0x69,0x6e,0x74,0x28,0x5f,0x34,0x30,0x2e,0x65,
+    0x6e,0x64,0x5f,0x73,0x70,0x6c,0x61,0x74,0x29,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x33,
+    0x20,0x62,0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,0x33,0x28,0x30,0x75,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x33,0x20,0x61,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x75,0x69,0x6e,0x74,0x34,0x20,0x5f,0x36,0x31,0x30,0x20,0x3d,0x20,0x64,0x65,
+    0x63,0x6f,0x64,0x65,0x5f,0x73,0x70,0x6c,0x61,0x74,0x28,0x6a,0x2c,0x20,0x61,0x2c,
+    0x20,0x5f,0x34,0x30,0x2c,0x20,0x5f,0x36,0x36,0x2c,0x20,0x5f,0x36,0x31,0x2c,0x20,
+    0x5f,0x38,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x5f,0x39,0x38,0x2e,0x73,0x70,
+    0x6c,0x61,0x74,0x73,0x5b,0x6a,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,
+    0x5f,0x36,0x31,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x68,
+    0x61,0x73,0x5f,0x62,0x20,0x3d,0x20,0x28,0x6a,0x20,0x2b,0x20,0x31,0x75,0x29,0x20,
+    0x3c,0x20,0x75,0x69,0x6e,0x74,0x28,0x5f,0x34,0x30,0x2e,0x65,0x6e,0x64,0x5f,0x73,
+    0x70,0x6c,0x61,0x74,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x68,
+    0x61,0x73,0x5f,0x62,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x34,0x20,0x5f,0x36,0x33,0x30,0x20,0x3d,
+    0x20,0x64,0x65,0x63,0x6f,0x64,0x65,0x5f,0x73,0x70,0x6c,0x61,0x74,0x28,0x6a,0x20,
+    0x2b,0x20,0x31,0x75,0x2c,0x20,0x62,0x2c,0x20,0x5f,0x34,0x30,0x2c,0x20,0x5f,0x36,
+    0x36,0x2c,0x20,0x5f,0x36,0x31,0x2c,0x20,0x5f,0x38,0x30,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x39,0x38,0x2e,0x73,0x70,0x6c,0x61,0x74,0x73,
+    0x5b,0x6a,0x20,0x2b,0x20,0x31,0x75,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,
+    0x20,0x5f,0x36,0x33,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
+    0x20,0x75,0x69,0x6e,0x74,0x20,0x77,0x6f,0x72,0x64,0x20,0x3d,0x20,0x70,0x61,0x69,
+    0x72,0x20,0x2a,0x20,0x33,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x5f,0x31,0x31,0x30,
+    0x2e,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x77,0x6f,0x72,0x64,0x73,0x5b,
+    0x77,0x6f,0x72,0x64,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x61,0x2e,
+    0x78,0x20,0x7c,0x20,0x28,0x61,0x2e,0x79,0x20,0x3c,0x3c,0x20,0x31,0x36,0x75,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x5f,0x31,0x31,0x30,0x2e,0x70,0x6f,0x73,0x69,0x74,
+    0x69,0x6f,0x6e,0x5f,0x77,0x6f,0x72,0x64,0x73,0x5b,0x77,0x6f,0x72,0x64,0x20,0x2b,
+    0x20,0x31,0x75,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x61,0x2e,0x7a,
+    0x20,0x7c,0x20,0x28,0x62,0x2e,0x78,0x20,0x3c,0x3c,0x20,0x31,0x36,0x75,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x68,0x61,0x73,0x5f,0x62,0x29,0x0a,
+    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x31,
+    0x31,0x30,0x2e,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x77,0x6f,0x72,0x64,
+    0x73,0x5b,0x77,0x6f,0x72,0x64,0x20,0x2b,0x20,0x32,0x75,0x5d,0x2e,0x76,0x61,0x6c,
+    0x75,0x65,0x20,0x3d,0x20,0x62,0x2e,0x79,0x20,0x7c,0x20,0x28,0x62,0x2e,0x7a,0x20,
+    0x3c,0x3c,0x20,0x31,0x36,0x75,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x7d,
+    0x0a,0x0a,0x00,
+};
+static inline const sg_shader_desc* spz_decode_shader_desc(sg_backend backend) {
+    if (backend == SG_BACKEND_GLCORE) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.compute_func.source = (const char*)spz_decode_source_glsl410;
+            desc.compute_func.entry = "main";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_COMPUTE;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 48;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_INT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 3;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "decode_params";
+            desc.views[8].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[8].storage_buffer.readonly = false;
+            desc.views[8].storage_buffer.glsl_binding_n = 0;
+            desc.views[10].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[10].storage_buffer.readonly = false;
+            desc.views[10].storage_buffer.glsl_binding_n = 1;
+            desc.views[11].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[11].storage_buffer.readonly = true;
+            desc.views[11].storage_buffer.glsl_binding_n = 2;
+            desc.views[12].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[12].storage_buffer.readonly = true;
+            desc.views[12].storage_buffer.glsl_binding_n = 3;
+            desc.views[13].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[13].storage_buffer.readonly = true;
+            desc.views[13].storage_buffer.glsl_binding_n = 4;
+            desc.label = "spz_decode_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_GLES3) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.compute_func.source = (const char*)spz_decode_source_glsl310es;
+            desc.compute_func.entry = "main";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_COMPUTE;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 48;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_INT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 3;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "decode_params";
+            desc.views[8].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[8].storage_buffer.readonly = false;
+            desc.views[8].storage_buffer.glsl_binding_n = 0;
+            desc.views[10].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[10].storage_buffer.readonly = false;
+            desc.views[10].storage_buffer.glsl_binding_n = 1;
+            desc.views[11].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[11].storage_buffer.readonly = true;
+            desc.views[11].storage_buffer.glsl_binding_n = 2;
+            desc.views[12].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[12].storage_buffer.readonly = true;
+            desc.views[12].storage_buffer.glsl_binding_n = 3;
+            desc.views[13].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[13].storage_buffer.readonly = true;
+            desc.views[13].storage_buffer.glsl_binding_n = 4;
+            desc.label = "spz_decode_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_D3D11) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.compute_func.source = (const char*)spz_decode_source_hlsl5;
+            desc.compute_func.d3d11_target = "cs_5_0";
+            desc.compute_func.entry = "main";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_COMPUTE;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 48;
+            desc.uniform_blocks[0].hlsl_register_b_n = 0;
+            desc.views[8].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[8].storage_buffer.readonly = false;
+            desc.views[8].storage_buffer.hlsl_register_u_n = 0;
+            desc.views[10].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[10].storage_buffer.readonly = false;
+            desc.views[10].storage_buffer.hlsl_register_u_n = 1;
+            desc.views[11].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[11].storage_buffer.readonly = true;
+            desc.views[11].storage_buffer.hlsl_register_t_n = 0;
+            desc.views[12].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[12].storage_buffer.readonly = true;
+            desc.views[12].storage_buffer.hlsl_register_t_n = 1;
+            desc.views[13].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[13].storage_buffer.readonly = true;
+            desc.views[13].storage_buffer.hlsl_register_t_n = 2;
+            desc.label = "spz_decode_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_METAL_MACOS) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.compute_func.source = (const char*)spz_decode_source_metal_macos;
+            desc.compute_func.entry = "main0";
+            desc.mtl_threads_per_threadgroup.x = 256;
+            desc.mtl_threads_per_threadgroup.y = 1;
+            desc.mtl_threads_per_threadgroup.z = 1;
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_COMPUTE;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 48;
+            desc.uniform_blocks[0].msl_buffer_n = 0;
+            desc.views[8].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[8].storage_buffer.readonly = false;
+            desc.views[8].storage_buffer.msl_buffer_n = 8;
+            desc.views[10].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[10].storage_buffer.readonly = false;
+            desc.views[10].storage_buffer.msl_buffer_n = 9;
+            desc.views[11].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[11].storage_buffer.readonly = true;
+            desc.views[11].storage_buffer.msl_buffer_n = 10;
+            desc.views[12].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[12].storage_buffer.readonly = true;
+            desc.views[12].storage_buffer.msl_buffer_n = 11;
+            desc.views[13].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[13].storage_buffer.readonly = true;
+            desc.views[13].storage_buffer.msl_buffer_n = 12;
+            desc.label = "spz_decode_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_METAL_IOS) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.compute_func.source = (const char*)spz_decode_source_metal_ios;
+            desc.compute_func.entry = "main0";
+            desc.mtl_threads_per_threadgroup.x = 256;
+            desc.mtl_threads_per_threadgroup.y = 1;
+            desc.mtl_threads_per_threadgroup.z = 1;
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_COMPUTE;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 48;
+            desc.uniform_blocks[0].msl_buffer_n = 0;
+            desc.views[8].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[8].storage_buffer.readonly = false;
+            desc.views[8].storage_buffer.msl_buffer_n = 8;
+            desc.views[10].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[10].storage_buffer.readonly = false;
+            desc.views[10].storage_buffer.msl_buffer_n = 9;
+            desc.views[11].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[11].storage_buffer.readonly = true;
+            desc.views[11].storage_buffer.msl_buffer_n = 10;
+            desc.views[12].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[12].storage_buffer.readonly = true;
+            desc.views[12].storage_buffer.msl_buffer_n = 11;
+            desc.views[13].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[13].storage_buffer.readonly = true;
+            desc.views[13].storage_buffer.msl_buffer_n = 12;
+            desc.label = "spz_decode_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_METAL_SIMULATOR) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.compute_func.source = (const char*)spz_decode_source_metal_sim;
+            desc.compute_func.entry = "main0";
+            desc.mtl_threads_per_threadgroup.x = 256;
+            desc.mtl_threads_per_threadgroup.y = 1;
+            desc.mtl_threads_per_threadgroup.z = 1;
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_COMPUTE;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 48;
+            desc.uniform_blocks[0].msl_buffer_n = 0;
+            desc.views[8].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[8].storage_buffer.readonly = false;
+            desc.views[8].storage_buffer.msl_buffer_n = 8;
+            desc.views[10].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[10].storage_buffer.readonly = false;
+            desc.views[10].storage_buffer.msl_buffer_n = 9;
+            desc.views[11].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[11].storage_buffer.readonly = true;
+            desc.views[11].storage_buffer.msl_buffer_n = 10;
+            desc.views[12].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[12].storage_buffer.readonly = true;
+            desc.views[12].storage_buffer.msl_buffer_n = 11;
+            desc.views[13].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[13].storage_buffer.readonly = true;
+            desc.views[13].storage_buffer.msl_buffer_n = 12;
+            desc.label = "spz_decode_shader";
+        }
+        return &desc;
+    }
+    return 0;
+}
@@ -1,5 +1,7 @@
 // Depth calculation compute shader for Gaussian Splat sorting
 // Calculates view-space depth for each splat and initializes index buffer
+// With an active index list (LOD cut) only the listed splats are keyed; depths stay indexed by splat id
+// Reads the 6-byte position stream only, the full splat texel is left to the vertex stage
 
 @cs depth_calc
 layout(local_size_x = 256, local_size_y = 1, local_size_z = 1) in;
@@ -14,19 +16,12 @@ layout(binding=0) uniform depth_params {
     float _pad0;
     vec3 camera_forward;
     float _pad1;
-    vec3 bounds_min;
-    float _pad2;
-    vec3 bounds_size;
-    int splat_count;
-    int texture_width;
-    int texture_height;
-    int splats_per_layer;
-    float _pad3;
+    int splat_count;        // entries to key (active splats)
+    int sort_count;         // power of two >= splat_count, entries above splat_count are padding
+    int use_active_indices; // 0: entry i is splat i
+    int sentinel_index;     // depth slot reserved for padding entries
 };
 
-// Texture for packed splat data
-@image_sample_type splat_texture uint
-layout(binding = 1) uniform utexture2DArray splat_texture;
 @sampler_type splat_sampler nonfiltering
 layout(binding = 2) uniform sampler splat_sampler;
 
@@ -47,43 +42,71 @@ layout(binding=4) buffer index_output {
     DepthIndexData indices[];
 };
 
-// Unpack position from packed format
+struct ActiveIndex {
+    uint value;
+};
+
+layout(binding=5) readonly buffer active_input {
+    ActiveIndex active_indices[];
+};
+
+// Per-chunk position bounds, two texels (min, max) per chunk of 256 splats, see splat_chunk_t
+@image_sample_type chunk_texture unfilterable_float
+layout(binding = 6) uniform texture2D chunk_texture;
+
+// Chunk-relative 16-bit positions, three halfwords per splat packed back to back (see splat_position_words)
+struct PositionWord {
+    uint value;
+};
+
+layout(binding = 10) readonly buffer position_buffer {
+    PositionWord position_words[];
+};
+
+const int CHUNK_SIZE = 256;
+const int CHUNKS_PER_ROW = 1024;
+
+// Unpack position from the position stream
 vec3 unpack_position(uint splat_idx) {
-    // Calculate texture coordinates - same as splat.glsl
-    int layer = int(splat_idx) / splats_per_layer;
-    int pixel_in_layer = int(splat_idx) - (layer * splats_per_layer);
-    int pixel_x = pixel_in_layer % texture_width;
-    int pixel_y = pixel_in_layer / texture_width;
-    
-    // Single texture fetch - all splat data in one RGBA32UI pixel
-    uvec4 packed = texelFetch(
-        usampler2DArray(splat_texture, splat_sampler), 
-        ivec3(pixel_x, pixel_y, layer), 
-        0
-    );
-    
-    // Unpack position - use multiplication instead of division
+    // Halfwords 3i, 3i+1, 3i+2 span two words; odd splats start in the high half
+    uint first = (splat_idx * 3u) >> 1u;
+    uint w0 = position_words[first].value;
+    uint w1 = position_words[first + 1u].value;
+    uvec3 quantized = (splat_idx & 1u) == 0u
+        ? uvec3(w0 & 0xFFFFu, w0 >> 16u, w1 & 0xFFFFu)
+        : uvec3(w0 >> 16u, w1 & 0xFFFFu, w1 >> 16u);
+
+    // Use multiplication instead of division
     const float inv_65535 = 1.0 / 65535.0;
-    vec3 norm_pos = vec3(
-        float((packed.r >> 16u) & 0xFFFFu),
-        float(packed.r & 0xFFFFu),
-        float((packed.g >> 16u) & 0xFFFFu)
-    ) * inv_65535;
-    
-    // Denormalize to world space using bounding box
-    return bounds_min + norm_pos * bounds_size;
+    vec3 norm_pos = vec3(quantized) * inv_65535;
+
+    // Denormalize to world space using the bounds of the splat's chunk
+    int chunk = int(splat_idx) / CHUNK_SIZE;
+    ivec2 chunk_texel = ivec2((chunk % CHUNKS_PER_ROW) * 2, chunk / CHUNKS_PER_ROW);
+    vec3 chunk_min = texelFetch(sampler2D(chunk_texture, splat_sampler), chunk_texel, 0).xyz;
+    vec3 chunk_max = texelFetch(sampler2D(chunk_texture, splat_sampler), chunk_texel + ivec2(1, 0), 0).xyz;
+    return chunk_min + norm_pos * (chunk_max - chunk_min);
 }
 
 void main() {
     uint idx = gl_GlobalInvocationID.x;
 
     // Bounds check
+    if (int(idx) >= sort_count) {
+        return;
+    }
+
+    // Padding sorts behind everything and is never drawn
     if (int(idx) >= splat_count) {
+        depths[sentinel_index].value = -3.402823e38;
+        indices[idx].value = uint(sentinel_index);
         return;
     }
 
+    uint splat_idx = use_active_indices != 0 ? active_indices[idx].value : idx;
+
     // Unpack splat position
-    vec3 splat_pos = unpack_position(idx);
+    vec3 splat_pos = unpack_position(splat_idx);
 
     // Calculate view-space depth (distance along camera forward vector)
     // Negative because camera looks down -Z in view space
@@ -91,12 +114,11 @@ void main() {
     float depth = dot(to_splat, camera_forward);
 
     // Store depth (we want back-to-front, so larger depth = further)
-    depths[idx].value = depth;
+    depths[splat_idx].value = depth;
 
     // Initialize index
-    indices[idx].value = idx;
+    indices[idx].value = splat_idx;
 }
-
 @end
 
 @program depth depth_calc
\ No newline at end of file
@@ -16,6 +16,10 @@
         Uniform block 'depth_params':
             C struct: depth_params_t
             Bind slot: UB_depth_params => 0
+        Storage buffer 'position_buffer':
+            C struct: PositionWord_t
+            Bind slot: VIEW_position_buffer => 10
+            Readonly: true
         Storage buffer 'depth_output':
             C struct: DepthValue_t
             Bind slot: VIEW_depth_output => 3
@@ -24,11 +28,15 @@
             C struct: DepthIndexData_t
             Bind slot: VIEW_index_output => 4
             Readonly: false
-        Texture 'splat_texture':
-            Image type: SG_IMAGETYPE_ARRAY
-            Sample type: SG_IMAGESAMPLETYPE_UINT
+        Storage buffer 'active_input':
+            C struct: ActiveIndex_t
+            Bind slot: VIEW_active_input => 5
+            Readonly: true
+        Texture 'chunk_texture':
+            Image type: SG_IMAGETYPE_2D
+            Sample type: SG_IMAGESAMPLETYPE_UNFILTERABLE_FLOAT
             Multisampled: false
-            Bind slot: VIEW_splat_texture => 1
+            Bind slot: VIEW_chunk_texture => 6
         Sampler 'splat_sampler':
             Type: SG_SAMPLERTYPE_NONFILTERING
             Bind slot: SMP_splat_sampler => 2
@@ -44,9 +52,11 @@
 #endif
 #endif
 #define UB_depth_params (0)
+#define VIEW_position_buffer (10)
 #define VIEW_depth_output (3)
 #define VIEW_index_output (4)
-#define VIEW_splat_texture (1)
+#define VIEW_active_input (5)
+#define VIEW_chunk_texture (6)
 #define SMP_splat_sampler (2)
 #pragma pack(push,1)
 SOKOL_SHDC_ALIGN(16) typedef struct depth_params_t {
@@ -58,17 +68,18 @@ SOKOL_SHDC_ALIGN(16) typedef struct depth_params_t {
     float _pad0;
     float camera_forward[3];
     float _pad1;
-    float bounds_min[3];
-    float _pad2;
-    float bounds_size[3];
     int splat_count;
-    int texture_width;
-    int texture_height;
-    int splats_per_layer;
-    float _pad3;
+    int sort_count;
+    int use_active_indices;
+    int sentinel_index;
 } depth_params_t;
 #pragma pack(pop)
 #pragma pack(push,1)
+SOKOL_SHDC_ALIGN(4) typedef struct PositionWord_t {
+    uint32_t value;
+} PositionWord_t;
+#pragma pack(pop)
+#pragma pack(push,1)
 SOKOL_SHDC_ALIGN(4) typedef struct DepthValue_t {
     float value;
 } DepthValue_t;
@@ -78,11 +89,22 @@ SOKOL_SHDC_ALIGN(4) typedef struct DepthIndexData_t {
     uint32_t value;
 } DepthIndexData_t;
 #pragma pack(pop)
+#pragma pack(push,1)
+SOKOL_SHDC_ALIGN(4) typedef struct ActiveIndex_t {
+    uint32_t value;
+} ActiveIndex_t;
+#pragma pack(pop)
 /*
     #version 410
     #extension GL_ARB_compute_shader : require
+    #extension GL_ARB_shader_storage_buffer_object : require
     layout(local_size_x = 256, local_size_y = 1, local_size_z = 1) in;
 
+    struct PositionWord
+    {
+        uint value;
+    };
+
     struct DepthValue
     {
         float value;
@@ -93,6 +115,11 @@ SOKOL_SHDC_ALIGN(4) typedef struct DepthIndexData_t {
         uint value;
     };
 
+    struct ActiveIndex
+    {
+        uint value;
+    };
+
     struct depth_params
     {
         vec4 viewMat_row0;
@@ -103,160 +130,225 @@ SOKOL_SHDC_ALIGN(4) typedef struct DepthIndexData_t {
         float _pad0;
         vec3 camera_forward;
         float _pad1;
-        vec3 bounds_min;
-        float _pad2;
-        vec3 bounds_size;
         int splat_count;
-        int texture_width;
-        int texture_height;
-        int splats_per_layer;
-        float _pad3;
+        int sort_count;
+        int use_active_indices;
+        int sentinel_index;
     };
 
     uniform depth_params _22;
 
+    layout(std430) readonly buffer position_buffer
+    {
+        PositionWord position_words[];
+    } _58;
+
     layout(std430) writeonly buffer depth_output
     {
         DepthValue depths[];
-    } _141;
+    } _170;
 
     layout(std430) buffer index_output
     {
         DepthIndexData indices[];
-    } _150;
+    } _180;
+
+    layout(std430) readonly buffer active_input
+    {
+        ActiveIndex active_indices[];
+    } _195;
 
-    uniform usampler2DArray splat_texture_splat_sampler;
+    uniform sampler2D chunk_texture_splat_sampler;
 
     vec3 unpack_position(uint splat_idx)
     {
-        int _27 = int(splat_idx) / _22.splats_per_layer;
-        int _35 = int(splat_idx) - (_27 * _22.splats_per_layer);
-        uvec4 _67 = texelFetch(splat_texture_splat_sampler, ivec3(_35 % _22.texture_width, _35 / _22.texture_width, _27), 0);
-        uint _72 = _67.x;
-        return _22.bounds_min + ((vec3(float((_72 >> 16u) & 65535u), float(_72 & 65535u), float((_67.y >> 16u) & 65535u)) * 1.525902189314365386962890625e-05) * _22.bounds_size);
+        uint _31 = (splat_idx * 3u) >> 1u;
+        uint _38 = _58.position_words[_31].value;
+        uint _44 = _58.position_words[_31 + 1u].value;
+        uvec3 _71 = ((splat_idx & 1u) == 0u) ? uvec3(_38 & 65535u, _38 >> 16u, _44 & 65535u) : uvec3(_38 >> 16u, _44 & 65535u, _44 >> 16u);
+        int _83 = int(splat_idx) / 256;
+        ivec2 _96 = ivec2((_83 % 1024) * 2, _83 / 1024);
+        vec3 _105 = texelFetch(chunk_texture_splat_sampler, _96, 0).xyz;
+        return _105 + ((vec3(_71) * 1.525902189314365386962890625e-05) * (texelFetch(chunk_texture_splat_sampler, _96 + ivec2(1, 0), 0).xyz - _105));
     }
 
     void main()
     {
+        if (int(gl_GlobalInvocationID.x) >= _22.sort_count)
+        {
+            return;
+        }
         if (int(gl_GlobalInvocationID.x) >= _22.splat_count)
         {
+            _170.depths[_22.sentinel_index].value = -3.4028230607370965056222438961717e+38;
+            _180.indices[gl_GlobalInvocationID.x].value = uint(_22.sentinel_index);
             return;
         }
-        uint param = gl_GlobalInvocationID.x;
-        _141.depths[gl_GlobalInvocationID.x].value = dot(unpack_position(param) - _22.camera_position, _22.camera_forward);
-        _150.indices[gl_GlobalInvocationID.x].value = gl_GlobalInvocationID.x;
+        uint _156 = (_22.use_active_indices != 0) ? _195.active_indices[gl_GlobalInvocationID.x].value : gl_GlobalInvocationID.x;
+        uint param = _156;
+        _170.depths[_156].value = dot(unpack_position(param) - _22.camera_position, _22.camera_forward);
+        _180.indices[gl_GlobalInvocationID.x].value = _156;
     }
 
 */
-static const uint8_t depth_calc_source_glsl410[1636] = {
+static const uint8_t depth_calc_source_glsl410[2337] = {
     0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x31,0x30,0x0a,0x23,0x65,0x78,
     0x74,0x65,0x6e,0x73,0x69,0x6f,0x6e,0x20,0x47,0x4c,0x5f,0x41,0x52,0x42,0x5f,0x63,
     0x6f,0x6d,0x70,0x75,0x74,0x65,0x5f,0x73,0x68,0x61,0x64,0x65,0x72,0x20,0x3a,0x20,
-    0x72,0x65,0x71,0x75,0x69,0x72,0x65,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,
-    0x6f,0x63,0x61,0x6c,0x5f,0x73,0x69,0x7a,0x65,0x5f,0x78,0x20,0x3d,0x20,0x32,0x35,
-    0x36,0x2c,0x20,0x6c,0x6f,0x63,0x61,0x6c,0x5f,0x73,0x69,0x7a,0x65,0x5f,0x79,0x20,
-    0x3d,0x20,0x31,0x2c,0x20,0x6c,0x6f,0x63,0x61,0x6c,0x5f,0x73,0x69,0x7a,0x65,0x5f,
-    0x7a,0x20,0x3d,0x20,0x31,0x29,0x20,0x69,0x6e,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,
-    0x63,0x74,0x20,0x44,0x65,0x70,0x74,0x68,0x56,0x61,0x6c,0x75,0x65,0x0a,0x7b,0x0a,
-    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x61,0x6c,0x75,0x65,0x3b,
-    0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x44,0x65,0x70,0x74,
-    0x68,0x49,0x6e,0x64,0x65,0x78,0x44,0x61,0x74,0x61,0x0a,0x7b,0x0a,0x20,0x20,0x20,
-    0x20,0x75,0x69,0x6e,0x74,0x20,0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,0x7d,0x3b,0x0a,
-    0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x64,0x65,0x70,0x74,0x68,0x5f,0x70,0x61,
-    0x72,0x61,0x6d,0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,
-    0x76,0x69,0x65,0x77,0x4d,0x61,0x74,0x5f,0x72,0x6f,0x77,0x30,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x69,0x65,0x77,0x4d,0x61,0x74,0x5f,0x72,
-    0x6f,0x77,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x69,
-    0x65,0x77,0x4d,0x61,0x74,0x5f,0x72,0x6f,0x77,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x76,0x65,0x63,0x34,0x20,0x76,0x69,0x65,0x77,0x4d,0x61,0x74,0x5f,0x72,0x6f,0x77,
-    0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x63,0x61,0x6d,0x65,
-    0x72,0x61,0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x70,0x61,0x64,0x30,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x66,0x6f,
-    0x72,0x77,0x61,0x72,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
-    0x20,0x5f,0x70,0x61,0x64,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,
-    0x20,0x62,0x6f,0x75,0x6e,0x64,0x73,0x5f,0x6d,0x69,0x6e,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x70,0x61,0x64,0x32,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x62,0x6f,0x75,0x6e,0x64,0x73,0x5f,0x73,0x69,
-    0x7a,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x73,0x70,0x6c,0x61,
+    0x72,0x65,0x71,0x75,0x69,0x72,0x65,0x0a,0x23,0x65,0x78,0x74,0x65,0x6e,0x73,0x69,
+    0x6f,0x6e,0x20,0x47,0x4c,0x5f,0x41,0x52,0x42,0x5f,0x73,0x68,0x61,0x64,0x65,0x72,
+    0x5f,0x73,0x74,0x6f,0x72,0x61,0x67,0x65,0x5f,0x62,0x75,0x66,0x66,0x65,0x72,0x5f,
+    0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x3a,0x20,0x72,0x65,0x71,0x75,0x69,0x72,0x65,
+    0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x6c,0x5f,0x73,0x69,
+    0x7a,0x65,0x5f,0x78,0x20,0x3d,0x20,0x32,0x35,0x36,0x2c,0x20,0x6c,0x6f,0x63,0x61,
+    0x6c,0x5f,0x73,0x69,0x7a,0x65,0x5f,0x79,0x20,0x3d,0x20,0x31,0x2c,0x20,0x6c,0x6f,
+    0x63,0x61,0x6c,0x5f,0x73,0x69,0x7a,0x65,0x5f,0x7a,0x20,0x3d,0x20,0x31,0x29,0x20,
+    0x69,0x6e,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x50,0x6f,0x73,0x69,
+    0x74,0x69,0x6f,0x6e,0x57,0x6f,0x72,0x64,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,
+    0x69,0x6e,0x74,0x20,0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,
+    0x74,0x72,0x75,0x63,0x74,0x20,0x44,0x65,0x70,0x74,0x68,0x56,0x61,0x6c,0x75,0x65,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x61,0x6c,
+    0x75,0x65,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x44,
+    0x65,0x70,0x74,0x68,0x49,0x6e,0x64,0x65,0x78,0x44,0x61,0x74,0x61,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,
+    0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x41,0x63,0x74,0x69,0x76,
+    0x65,0x49,0x6e,0x64,0x65,0x78,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,
+    0x74,0x20,0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,
+    0x75,0x63,0x74,0x20,0x64,0x65,0x70,0x74,0x68,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x69,0x65,0x77,
+    0x4d,0x61,0x74,0x5f,0x72,0x6f,0x77,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,
+    0x63,0x34,0x20,0x76,0x69,0x65,0x77,0x4d,0x61,0x74,0x5f,0x72,0x6f,0x77,0x31,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x69,0x65,0x77,0x4d,0x61,
+    0x74,0x5f,0x72,0x6f,0x77,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,
+    0x20,0x76,0x69,0x65,0x77,0x4d,0x61,0x74,0x5f,0x72,0x6f,0x77,0x33,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x70,
+    0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x5f,0x70,0x61,0x64,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,
+    0x63,0x33,0x20,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x66,0x6f,0x72,0x77,0x61,0x72,
+    0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x70,0x61,
+    0x64,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x73,0x70,0x6c,0x61,
     0x74,0x5f,0x63,0x6f,0x75,0x6e,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,
-    0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x77,0x69,0x64,0x74,0x68,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,
-    0x68,0x65,0x69,0x67,0x68,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,
-    0x73,0x70,0x6c,0x61,0x74,0x73,0x5f,0x70,0x65,0x72,0x5f,0x6c,0x61,0x79,0x65,0x72,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x70,0x61,0x64,
-    0x33,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x64,
-    0x65,0x70,0x74,0x68,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,0x5f,0x32,0x32,0x3b,
-    0x0a,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x73,0x74,0x64,0x34,0x33,0x30,0x29,
-    0x20,0x77,0x72,0x69,0x74,0x65,0x6f,0x6e,0x6c,0x79,0x20,0x62,0x75,0x66,0x66,0x65,
-    0x72,0x20,0x64,0x65,0x70,0x74,0x68,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x0a,0x7b,
-    0x0a,0x20,0x20,0x20,0x20,0x44,0x65,0x70,0x74,0x68,0x56,0x61,0x6c,0x75,0x65,0x20,
-    0x64,0x65,0x70,0x74,0x68,0x73,0x5b,0x5d,0x3b,0x0a,0x7d,0x20,0x5f,0x31,0x34,0x31,
-    0x3b,0x0a,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x73,0x74,0x64,0x34,0x33,0x30,
-    0x29,0x20,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x69,0x6e,0x64,0x65,0x78,0x5f,0x6f,
-    0x75,0x74,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x44,0x65,0x70,0x74,
-    0x68,0x49,0x6e,0x64,0x65,0x78,0x44,0x61,0x74,0x61,0x20,0x69,0x6e,0x64,0x69,0x63,
-    0x65,0x73,0x5b,0x5d,0x3b,0x0a,0x7d,0x20,0x5f,0x31,0x35,0x30,0x3b,0x0a,0x0a,0x75,
-    0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x75,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,
-    0x44,0x41,0x72,0x72,0x61,0x79,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x74,0x65,0x78,
-    0x74,0x75,0x72,0x65,0x5f,0x73,0x70,0x6c,0x61,0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,
-    0x65,0x72,0x3b,0x0a,0x0a,0x76,0x65,0x63,0x33,0x20,0x75,0x6e,0x70,0x61,0x63,0x6b,
-    0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x28,0x75,0x69,0x6e,0x74,0x20,0x73,
-    0x70,0x6c,0x61,0x74,0x5f,0x69,0x64,0x78,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
-    0x69,0x6e,0x74,0x20,0x5f,0x32,0x37,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,0x73,0x70,
-    0x6c,0x61,0x74,0x5f,0x69,0x64,0x78,0x29,0x20,0x2f,0x20,0x5f,0x32,0x32,0x2e,0x73,
-    0x70,0x6c,0x61,0x74,0x73,0x5f,0x70,0x65,0x72,0x5f,0x6c,0x61,0x79,0x65,0x72,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x5f,0x33,0x35,0x20,0x3d,0x20,0x69,
-    0x6e,0x74,0x28,0x73,0x70,0x6c,0x61,0x74,0x5f,0x69,0x64,0x78,0x29,0x20,0x2d,0x20,
-    0x28,0x5f,0x32,0x37,0x20,0x2a,0x20,0x5f,0x32,0x32,0x2e,0x73,0x70,0x6c,0x61,0x74,
-    0x73,0x5f,0x70,0x65,0x72,0x5f,0x6c,0x61,0x79,0x65,0x72,0x29,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x75,0x76,0x65,0x63,0x34,0x20,0x5f,0x36,0x37,0x20,0x3d,0x20,0x74,0x65,
-    0x78,0x65,0x6c,0x46,0x65,0x74,0x63,0x68,0x28,0x73,0x70,0x6c,0x61,0x74,0x5f,0x74,
-    0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x70,0x6c,0x61,0x74,0x5f,0x73,0x61,0x6d,
-    0x70,0x6c,0x65,0x72,0x2c,0x20,0x69,0x76,0x65,0x63,0x33,0x28,0x5f,0x33,0x35,0x20,
-    0x25,0x20,0x5f,0x32,0x32,0x2e,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x77,0x69,
-    0x64,0x74,0x68,0x2c,0x20,0x5f,0x33,0x35,0x20,0x2f,0x20,0x5f,0x32,0x32,0x2e,0x74,
-    0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x77,0x69,0x64,0x74,0x68,0x2c,0x20,0x5f,0x32,
-    0x37,0x29,0x2c,0x20,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,
-    0x20,0x5f,0x37,0x32,0x20,0x3d,0x20,0x5f,0x36,0x37,0x2e,0x78,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5f,0x32,0x32,0x2e,0x62,0x6f,0x75,
-    0x6e,0x64,0x73,0x5f,0x6d,0x69,0x6e,0x20,0x2b,0x20,0x28,0x28,0x76,0x65,0x63,0x33,
-    0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x28,0x5f,0x37,0x32,0x20,0x3e,0x3e,0x20,0x31,
-    0x36,0x75,0x29,0x20,0x26,0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x2c,0x20,0x66,
-    0x6c,0x6f,0x61,0x74,0x28,0x5f,0x37,0x32,0x20,0x26,0x20,0x36,0x35,0x35,0x33,0x35,
-    0x75,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x28,0x5f,0x36,0x37,0x2e,0x79,
-    0x20,0x3e,0x3e,0x20,0x31,0x36,0x75,0x29,0x20,0x26,0x20,0x36,0x35,0x35,0x33,0x35,
-    0x75,0x29,0x29,0x20,0x2a,0x20,0x31,0x2e,0x35,0x32,0x35,0x39,0x30,0x32,0x31,0x38,
-    0x39,0x33,0x31,0x34,0x33,0x36,0x35,0x33,0x38,0x36,0x39,0x36,0x32,0x38,0x39,0x30,
-    0x36,0x32,0x35,0x65,0x2d,0x30,0x35,0x29,0x20,0x2a,0x20,0x5f,0x32,0x32,0x2e,0x62,
-    0x6f,0x75,0x6e,0x64,0x73,0x5f,0x73,0x69,0x7a,0x65,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,
-    0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x73,0x6f,0x72,0x74,0x5f,0x63,0x6f,0x75,0x6e,0x74,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x69,0x6e,0x74,0x20,0x75,0x73,0x65,0x5f,0x61,0x63,0x74,0x69,0x76,0x65,0x5f,
+    0x69,0x6e,0x64,0x69,0x63,0x65,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,
+    0x20,0x73,0x65,0x6e,0x74,0x69,0x6e,0x65,0x6c,0x5f,0x69,0x6e,0x64,0x65,0x78,0x3b,
+    0x0a,0x7d,0x3b,0x0a,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x64,0x65,0x70,
+    0x74,0x68,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,0x5f,0x32,0x32,0x3b,0x0a,0x0a,
+    0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x73,0x74,0x64,0x34,0x33,0x30,0x29,0x20,0x72,
+    0x65,0x61,0x64,0x6f,0x6e,0x6c,0x79,0x20,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x70,
+    0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x62,0x75,0x66,0x66,0x65,0x72,0x0a,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x57,0x6f,0x72,
+    0x64,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x77,0x6f,0x72,0x64,0x73,
+    0x5b,0x5d,0x3b,0x0a,0x7d,0x20,0x5f,0x35,0x38,0x3b,0x0a,0x0a,0x6c,0x61,0x79,0x6f,
+    0x75,0x74,0x28,0x73,0x74,0x64,0x34,0x33,0x30,0x29,0x20,0x77,0x72,0x69,0x74,0x65,
+    0x6f,0x6e,0x6c,0x79,0x20,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x64,0x65,0x70,0x74,
+    0x68,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x44,
+    0x65,0x70,0x74,0x68,0x56,0x61,0x6c,0x75,0x65,0x20,0x64,0x65,0x70,0x74,0x68,0x73,
+    0x5b,0x5d,0x3b,0x0a,0x7d,0x20,0x5f,0x31,0x37,0x30,0x3b,0x0a,0x0a,0x6c,0x61,0x79,
+    0x6f,0x75,0x74,0x28,0x73,0x74,0x64,0x34,0x33,0x30,0x29,0x20,0x62,0x75,0x66,0x66,
+    0x65,0x72,0x20,0x69,0x6e,0x64,0x65,0x78,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x44,0x65,0x70,0x74,0x68,0x49,0x6e,0x64,0x65,0x78,
+    0x44,0x61,0x74,0x61,0x20,0x69,0x6e,0x64,0x69,0x63,0x65,0x73,0x5b,0x5d,0x3b,0x0a,
+    0x7d,0x20,0x5f,0x31,0x38,0x30,0x3b,0x0a,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,
+    0x73,0x74,0x64,0x34,0x33,0x30,0x29,0x20,0x72,0x65,0x61,0x64,0x6f,0x6e,0x6c,0x79,
+    0x20,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x61,0x63,0x74,0x69,0x76,0x65,0x5f,0x69,
+    0x6e,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x41,0x63,0x74,0x69,0x76,
+    0x65,0x49,0x6e,0x64,0x65,0x78,0x20,0x61,0x63,0x74,0x69,0x76,0x65,0x5f,0x69,0x6e,
+    0x64,0x69,0x63,0x65,0x73,0x5b,0x5d,0x3b,0x0a,0x7d,0x20,0x5f,0x31,0x39,0x35,0x3b,
+    0x0a,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,
+    0x72,0x32,0x44,0x20,0x63,0x68,0x75,0x6e,0x6b,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,
+    0x65,0x5f,0x73,0x70,0x6c,0x61,0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x3b,
+    0x0a,0x0a,0x76,0x65,0x63,0x33,0x20,0x75,0x6e,0x70,0x61,0x63,0x6b,0x5f,0x70,0x6f,
+    0x73,0x69,0x74,0x69,0x6f,0x6e,0x28,0x75,0x69,0x6e,0x74,0x20,0x73,0x70,0x6c,0x61,
+    0x74,0x5f,0x69,0x64,0x78,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,
+    0x74,0x20,0x5f,0x33,0x31,0x20,0x3d,0x20,0x28,0x73,0x70,0x6c,0x61,0x74,0x5f,0x69,
+    0x64,0x78,0x20,0x2a,0x20,0x33,0x75,0x29,0x20,0x3e,0x3e,0x20,0x31,0x75,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,0x33,0x38,0x20,0x3d,0x20,0x5f,
+    0x35,0x38,0x2e,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x77,0x6f,0x72,0x64,
+    0x73,0x5b,0x5f,0x33,0x31,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,0x34,0x34,0x20,0x3d,0x20,0x5f,0x35,0x38,
+    0x2e,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x77,0x6f,0x72,0x64,0x73,0x5b,
+    0x5f,0x33,0x31,0x20,0x2b,0x20,0x31,0x75,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x75,0x76,0x65,0x63,0x33,0x20,0x5f,0x37,0x31,0x20,0x3d,
+    0x20,0x28,0x28,0x73,0x70,0x6c,0x61,0x74,0x5f,0x69,0x64,0x78,0x20,0x26,0x20,0x31,
+    0x75,0x29,0x20,0x3d,0x3d,0x20,0x30,0x75,0x29,0x20,0x3f,0x20,0x75,0x76,0x65,0x63,
+    0x33,0x28,0x5f,0x33,0x38,0x20,0x26,0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x2c,0x20,
+    0x5f,0x33,0x38,0x20,0x3e,0x3e,0x20,0x31,0x36,0x75,0x2c,0x20,0x5f,0x34,0x34,0x20,
+    0x26,0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x20,0x3a,0x20,0x75,0x76,0x65,0x63,
+    0x33,0x28,0x5f,0x33,0x38,0x20,0x3e,0x3e,0x20,0x31,0x36,0x75,0x2c,0x20,0x5f,0x34,
+    0x34,0x20,0x26,0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x2c,0x20,0x5f,0x34,0x34,0x20,
+    0x3e,0x3e,0x20,0x31,0x36,0x75,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,
+    0x20,0x5f,0x38,0x33,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,0x73,0x70,0x6c,0x61,0x74,
+    0x5f,0x69,0x64,0x78,0x29,0x20,0x2f,0x20,0x32,0x35,0x36,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x69,0x76,0x65,0x63,0x32,0x20,0x5f,0x39,0x36,0x20,0x3d,0x20,0x69,0x76,0x65,
+    0x63,0x32,0x28,0x28,0x5f,0x38,0x33,0x20,0x25,0x20,0x31,0x30,0x32,0x34,0x29,0x20,
+    0x2a,0x20,0x32,0x2c,0x20,0x5f,0x38,0x33,0x20,0x2f,0x20,0x31,0x30,0x32,0x34,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x5f,0x31,0x30,0x35,0x20,
+    0x3d,0x20,0x74,0x65,0x78,0x65,0x6c,0x46,0x65,0x74,0x63,0x68,0x28,0x63,0x68,0x75,
+    0x6e,0x6b,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x70,0x6c,0x61,0x74,
+    0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x5f,0x39,0x36,0x2c,0x20,0x30,
+    0x29,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,
+    0x6e,0x20,0x5f,0x31,0x30,0x35,0x20,0x2b,0x20,0x28,0x28,0x76,0x65,0x63,0x33,0x28,
+    0x5f,0x37,0x31,0x29,0x20,0x2a,0x20,0x31,0x2e,0x35,0x32,0x35,0x39,0x30,0x32,0x31,
+    0x38,0x39,0x33,0x31,0x34,0x33,0x36,0x35,0x33,0x38,0x36,0x39,0x36,0x32,0x38,0x39,
+    0x30,0x36,0x32,0x35,0x65,0x2d,0x30,0x35,0x29,0x20,0x2a,0x20,0x28,0x74,0x65,0x78,
+    0x65,0x6c,0x46,0x65,0x74,0x63,0x68,0x28,0x63,0x68,0x75,0x6e,0x6b,0x5f,0x74,0x65,
+    0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x70,0x6c,0x61,0x74,0x5f,0x73,0x61,0x6d,0x70,
+    0x6c,0x65,0x72,0x2c,0x20,0x5f,0x39,0x36,0x20,0x2b,0x20,0x69,0x76,0x65,0x63,0x32,
+    0x28,0x31,0x2c,0x20,0x30,0x29,0x2c,0x20,0x30,0x29,0x2e,0x78,0x79,0x7a,0x20,0x2d,
+    0x20,0x5f,0x31,0x30,0x35,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x6f,0x69,0x64,
+    0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,
+    0x20,0x28,0x69,0x6e,0x74,0x28,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,
+    0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x29,0x20,0x3e,
+    0x3d,0x20,0x5f,0x32,0x32,0x2e,0x73,0x6f,0x72,0x74,0x5f,0x63,0x6f,0x75,0x6e,0x74,
+    0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
     0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x6e,0x74,0x28,0x67,0x6c,0x5f,0x47,0x6c,0x6f,
     0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,
     0x78,0x29,0x20,0x3e,0x3d,0x20,0x5f,0x32,0x32,0x2e,0x73,0x70,0x6c,0x61,0x74,0x5f,
     0x63,0x6f,0x75,0x6e,0x74,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x70,0x61,0x72,0x61,
-    0x6d,0x20,0x3d,0x20,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,
-    0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x5f,0x31,0x34,0x31,0x2e,0x64,0x65,0x70,0x74,0x68,0x73,0x5b,0x67,0x6c,0x5f,
-    0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,
-    0x49,0x44,0x2e,0x78,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x64,0x6f,
+    0x20,0x20,0x20,0x20,0x20,0x5f,0x31,0x37,0x30,0x2e,0x64,0x65,0x70,0x74,0x68,0x73,
+    0x5b,0x5f,0x32,0x32,0x2e,0x73,0x65,0x6e,0x74,0x69,0x6e,0x65,0x6c,0x5f,0x69,0x6e,
+    0x64,0x65,0x78,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x2d,0x33,0x2e,
+    0x34,0x30,0x32,0x38,0x32,0x33,0x30,0x36,0x30,0x37,0x33,0x37,0x30,0x39,0x36,0x35,
+    0x30,0x35,0x36,0x32,0x32,0x32,0x34,0x33,0x38,0x39,0x36,0x31,0x37,0x31,0x37,0x65,
+    0x2b,0x33,0x38,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x31,0x38,
+    0x30,0x2e,0x69,0x6e,0x64,0x69,0x63,0x65,0x73,0x5b,0x67,0x6c,0x5f,0x47,0x6c,0x6f,
+    0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,
+    0x78,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,0x28,
+    0x5f,0x32,0x32,0x2e,0x73,0x65,0x6e,0x74,0x69,0x6e,0x65,0x6c,0x5f,0x69,0x6e,0x64,
+    0x65,0x78,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,
+    0x75,0x72,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x75,
+    0x69,0x6e,0x74,0x20,0x5f,0x31,0x35,0x36,0x20,0x3d,0x20,0x28,0x5f,0x32,0x32,0x2e,
+    0x75,0x73,0x65,0x5f,0x61,0x63,0x74,0x69,0x76,0x65,0x5f,0x69,0x6e,0x64,0x69,0x63,
+    0x65,0x73,0x20,0x21,0x3d,0x20,0x30,0x29,0x20,0x3f,0x20,0x5f,0x31,0x39,0x35,0x2e,
+    0x61,0x63,0x74,0x69,0x76,0x65,0x5f,0x69,0x6e,0x64,0x69,0x63,0x65,0x73,0x5b,0x67,
+    0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,
+    0x6f,0x6e,0x49,0x44,0x2e,0x78,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3a,0x20,
+    0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,
+    0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,
+    0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x5f,0x31,0x35,0x36,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x5f,0x31,0x37,0x30,0x2e,0x64,0x65,0x70,0x74,0x68,0x73,0x5b,
+    0x5f,0x31,0x35,0x36,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x64,0x6f,
     0x74,0x28,0x75,0x6e,0x70,0x61,0x63,0x6b,0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,
     0x6e,0x28,0x70,0x61,0x72,0x61,0x6d,0x29,0x20,0x2d,0x20,0x5f,0x32,0x32,0x2e,0x63,
     0x61,0x6d,0x65,0x72,0x61,0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2c,0x20,
     0x5f,0x32,0x32,0x2e,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x66,0x6f,0x72,0x77,0x61,
-    0x72,0x64,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x5f,0x31,0x35,0x30,0x2e,0x69,0x6e,
+    0x72,0x64,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x5f,0x31,0x38,0x30,0x2e,0x69,0x6e,
     0x64,0x69,0x63,0x65,0x73,0x5b,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,
     0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x5d,0x2e,0x76,
-    0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,
-    0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x3b,0x0a,
-    0x7d,0x0a,0x0a,0x00,
+    0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x5f,0x31,0x35,0x36,0x3b,0x0a,0x7d,0x0a,0x0a,
+    0x00,
 };
 /*
     #version 310 es
     layout(local_size_x = 256, local_size_y = 1, local_size_z = 1) in;
 
+    struct PositionWord
+    {
+        uint value;
+    };
+
     struct DepthValue
     {
         float value;
@@ -267,6 +359,11 @@ static const uint8_t depth_calc_source_glsl410[1636] = {
         uint value;
     };
 
+    struct ActiveIndex
+    {
+        uint value;
+    };
+
     struct depth_params
     {
         vec4 viewMat_row0;
@@ -277,158 +374,220 @@ static const uint8_t depth_calc_source_glsl410[1636] = {
         float _pad0;
         vec3 camera_forward;
         float _pad1;
-        vec3 bounds_min;
-        float _pad2;
-        vec3 bounds_size;
         int splat_count;
-        int texture_width;
-        int texture_height;
-        int splats_per_layer;
-        float _pad3;
+        int sort_count;
+        int use_active_indices;
+        int sentinel_index;
     };
 
     uniform depth_params _22;
 
-    layout(binding = 3, std430) writeonly buffer depth_output
+    layout(binding = 3, std430) readonly buffer position_buffer
+    {
+        PositionWord position_words[];
+    } _58;
+
+    layout(binding = 0, std430) writeonly buffer depth_output
     {
         DepthValue depths[];
-    } _141;
+    } _170;
 
-    layout(binding = 4, std430) buffer index_output
+    layout(binding = 1, std430) buffer index_output
     {
         DepthIndexData indices[];
-    } _150;
+    } _180;
 
-    layout(binding = 0) uniform highp usampler2DArray splat_texture_splat_sampler;
+    layout(binding = 2, std430) readonly buffer active_input
+    {
+        ActiveIndex active_indices[];
+    } _195;
+
+    layout(binding = 0) uniform highp sampler2D chunk_texture_splat_sampler;
 
     vec3 unpack_position(uint splat_idx)
     {
-        int _27 = int(splat_idx) / _22.splats_per_layer;
-        int _35 = int(splat_idx) - (_27 * _22.splats_per_layer);
-        uvec4 _67 = texelFetch(splat_texture_splat_sampler, ivec3(_35 % _22.texture_width, _35 / _22.texture_width, _27), 0);
-        uint _72 = _67.x;
-        return _22.bounds_min + ((vec3(float((_72 >> 16u) & 65535u), float(_72 & 65535u), float((_67.y >> 16u) & 65535u)) * 1.525902189314365386962890625e-05) * _22.bounds_size);
+        uint _31 = (splat_idx * 3u) >> 1u;
+        uint _38 = _58.position_words[_31].value;
+        uint _44 = _58.position_words[_31 + 1u].value;
+        uvec3 _71 = ((splat_idx & 1u) == 0u) ? uvec3(_38 & 65535u, _38 >> 16u, _44 & 65535u) : uvec3(_38 >> 16u, _44 & 65535u, _44 >> 16u);
+        int _83 = int(splat_idx) / 256;
+        ivec2 _96 = ivec2((_83 % 1024) * 2, _83 / 1024);
+        vec3 _105 = texelFetch(chunk_texture_splat_sampler, _96, 0).xyz;
+        return _105 + ((vec3(_71) * 1.525902189314365386962890625e-05) * (texelFetch(chunk_texture_splat_sampler, _96 + ivec2(1, 0), 0).xyz - _105));
     }
 
     void main()
     {
+        if (int(gl_GlobalInvocationID.x) >= _22.sort_count)
+        {
+            return;
+        }
         if (int(gl_GlobalInvocationID.x) >= _22.splat_count)
         {
+            _170.depths[_22.sentinel_index].value = -3.4028230607370965056222438961717e+38;
+            _180.indices[gl_GlobalInvocationID.x].value = uint(_22.sentinel_index);
             return;
         }
-        uint param = gl_GlobalInvocationID.x;
-        _141.depths[gl_GlobalInvocationID.x].value = dot(unpack_position(param) - _22.camera_position, _22.camera_forward);
-        _150.indices[gl_GlobalInvocationID.x].value = gl_GlobalInvocationID.x;
+        uint _156 = (_22.use_active_indices != 0) ? _195.active_indices[gl_GlobalInvocationID.x].value : gl_GlobalInvocationID.x;
+        uint param = _156;
+        _170.depths[_156].value = dot(unpack_position(param) - _22.camera_position, _22.camera_forward);
+        _180.indices[gl_GlobalInvocationID.x].value = _156;
     }
 
 */
-static const uint8_t depth_calc_source_glsl310es[1648] = {
+static const uint8_t depth_calc_source_glsl310es[2318] = {
     0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x31,0x30,0x20,0x65,0x73,0x0a,
     0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x6c,0x5f,0x73,0x69,0x7a,
     0x65,0x5f,0x78,0x20,0x3d,0x20,0x32,0x35,0x36,0x2c,0x20,0x6c,0x6f,0x63,0x61,0x6c,
     0x5f,0x73,0x69,0x7a,0x65,0x5f,0x79,0x20,0x3d,0x20,0x31,0x2c,0x20,0x6c,0x6f,0x63,
     0x61,0x6c,0x5f,0x73,0x69,0x7a,0x65,0x5f,0x7a,0x20,0x3d,0x20,0x31,0x29,0x20,0x69,
-    0x6e,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x44,0x65,0x70,0x74,0x68,
-    0x56,0x61,0x6c,0x75,0x65,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x20,0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,
-    0x75,0x63,0x74,0x20,0x44,0x65,0x70,0x74,0x68,0x49,0x6e,0x64,0x65,0x78,0x44,0x61,
-    0x74,0x61,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x76,0x61,
-    0x6c,0x75,0x65,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,
-    0x64,0x65,0x70,0x74,0x68,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x0a,0x7b,0x0a,0x20,
-    0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x69,0x65,0x77,0x4d,0x61,0x74,0x5f,
-    0x72,0x6f,0x77,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x76,
-    0x69,0x65,0x77,0x4d,0x61,0x74,0x5f,0x72,0x6f,0x77,0x31,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x69,0x65,0x77,0x4d,0x61,0x74,0x5f,0x72,0x6f,
-    0x77,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x69,0x65,
-    0x77,0x4d,0x61,0x74,0x5f,0x72,0x6f,0x77,0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,
-    0x65,0x63,0x33,0x20,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x70,0x6f,0x73,0x69,0x74,
-    0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,
-    0x70,0x61,0x64,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x63,
-    0x61,0x6d,0x65,0x72,0x61,0x5f,0x66,0x6f,0x72,0x77,0x61,0x72,0x64,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x70,0x61,0x64,0x31,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x62,0x6f,0x75,0x6e,0x64,0x73,0x5f,
-    0x6d,0x69,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,
-    0x70,0x61,0x64,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x62,
-    0x6f,0x75,0x6e,0x64,0x73,0x5f,0x73,0x69,0x7a,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x69,0x6e,0x74,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x63,0x6f,0x75,0x6e,0x74,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
-    0x5f,0x77,0x69,0x64,0x74,0x68,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,
-    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x68,0x65,0x69,0x67,0x68,0x74,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x73,0x70,0x6c,0x61,0x74,0x73,0x5f,0x70,
-    0x65,0x72,0x5f,0x6c,0x61,0x79,0x65,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
-    0x6f,0x61,0x74,0x20,0x5f,0x70,0x61,0x64,0x33,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x75,
-    0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x64,0x65,0x70,0x74,0x68,0x5f,0x70,0x61,0x72,
-    0x61,0x6d,0x73,0x20,0x5f,0x32,0x32,0x3b,0x0a,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,
-    0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x33,0x2c,0x20,0x73,0x74,
-    0x64,0x34,0x33,0x30,0x29,0x20,0x77,0x72,0x69,0x74,0x65,0x6f,0x6e,0x6c,0x79,0x20,
-    0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x64,0x65,0x70,0x74,0x68,0x5f,0x6f,0x75,0x74,
-    0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x44,0x65,0x70,0x74,0x68,0x56,
-    0x61,0x6c,0x75,0x65,0x20,0x64,0x65,0x70,0x74,0x68,0x73,0x5b,0x5d,0x3b,0x0a,0x7d,
-    0x20,0x5f,0x31,0x34,0x31,0x3b,0x0a,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x62,
-    0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x34,0x2c,0x20,0x73,0x74,0x64,0x34,
-    0x33,0x30,0x29,0x20,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x69,0x6e,0x64,0x65,0x78,
-    0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x44,0x65,
-    0x70,0x74,0x68,0x49,0x6e,0x64,0x65,0x78,0x44,0x61,0x74,0x61,0x20,0x69,0x6e,0x64,
-    0x69,0x63,0x65,0x73,0x5b,0x5d,0x3b,0x0a,0x7d,0x20,0x5f,0x31,0x35,0x30,0x3b,0x0a,
-    0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,
-    0x3d,0x20,0x30,0x29,0x20,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,
-    0x68,0x70,0x20,0x75,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x41,0x72,0x72,
-    0x61,0x79,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
-    0x5f,0x73,0x70,0x6c,0x61,0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x3b,0x0a,
-    0x0a,0x76,0x65,0x63,0x33,0x20,0x75,0x6e,0x70,0x61,0x63,0x6b,0x5f,0x70,0x6f,0x73,
-    0x69,0x74,0x69,0x6f,0x6e,0x28,0x75,0x69,0x6e,0x74,0x20,0x73,0x70,0x6c,0x61,0x74,
-    0x5f,0x69,0x64,0x78,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,
-    0x5f,0x32,0x37,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,0x73,0x70,0x6c,0x61,0x74,0x5f,
-    0x69,0x64,0x78,0x29,0x20,0x2f,0x20,0x5f,0x32,0x32,0x2e,0x73,0x70,0x6c,0x61,0x74,
-    0x73,0x5f,0x70,0x65,0x72,0x5f,0x6c,0x61,0x79,0x65,0x72,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x69,0x6e,0x74,0x20,0x5f,0x33,0x35,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,0x73,
-    0x70,0x6c,0x61,0x74,0x5f,0x69,0x64,0x78,0x29,0x20,0x2d,0x20,0x28,0x5f,0x32,0x37,
-    0x20,0x2a,0x20,0x5f,0x32,0x32,0x2e,0x73,0x70,0x6c,0x61,0x74,0x73,0x5f,0x70,0x65,
-    0x72,0x5f,0x6c,0x61,0x79,0x65,0x72,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x76,
-    0x65,0x63,0x34,0x20,0x5f,0x36,0x37,0x20,0x3d,0x20,0x74,0x65,0x78,0x65,0x6c,0x46,
-    0x65,0x74,0x63,0x68,0x28,0x73,0x70,0x6c,0x61,0x74,0x5f,0x74,0x65,0x78,0x74,0x75,
+    0x6e,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x50,0x6f,0x73,0x69,0x74,
+    0x69,0x6f,0x6e,0x57,0x6f,0x72,0x64,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,
+    0x6e,0x74,0x20,0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,
+    0x72,0x75,0x63,0x74,0x20,0x44,0x65,0x70,0x74,0x68,0x56,0x61,0x6c,0x75,0x65,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x61,0x6c,0x75,
+    0x65,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x44,0x65,
+    0x70,0x74,0x68,0x49,0x6e,0x64,0x65,0x78,0x44,0x61,0x74,0x61,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,0x7d,
+    0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x41,0x63,0x74,0x69,0x76,0x65,
+    0x49,0x6e,0x64,0x65,0x78,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,
+    0x20,0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,
+    0x63,0x74,0x20,0x64,0x65,0x70,0x74,0x68,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x69,0x65,0x77,0x4d,
+    0x61,0x74,0x5f,0x72,0x6f,0x77,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,
+    0x34,0x20,0x76,0x69,0x65,0x77,0x4d,0x61,0x74,0x5f,0x72,0x6f,0x77,0x31,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x69,0x65,0x77,0x4d,0x61,0x74,
+    0x5f,0x72,0x6f,0x77,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,
+    0x76,0x69,0x65,0x77,0x4d,0x61,0x74,0x5f,0x72,0x6f,0x77,0x33,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x70,0x6f,
+    0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x5f,0x70,0x61,0x64,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,
+    0x33,0x20,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x66,0x6f,0x72,0x77,0x61,0x72,0x64,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x70,0x61,0x64,
+    0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x73,0x70,0x6c,0x61,0x74,
+    0x5f,0x63,0x6f,0x75,0x6e,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,
+    0x73,0x6f,0x72,0x74,0x5f,0x63,0x6f,0x75,0x6e,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x69,0x6e,0x74,0x20,0x75,0x73,0x65,0x5f,0x61,0x63,0x74,0x69,0x76,0x65,0x5f,0x69,
+    0x6e,0x64,0x69,0x63,0x65,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,
+    0x73,0x65,0x6e,0x74,0x69,0x6e,0x65,0x6c,0x5f,0x69,0x6e,0x64,0x65,0x78,0x3b,0x0a,
+    0x7d,0x3b,0x0a,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x64,0x65,0x70,0x74,
+    0x68,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,0x5f,0x32,0x32,0x3b,0x0a,0x0a,0x6c,
+    0x61,0x79,0x6f,0x75,0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,
+    0x33,0x2c,0x20,0x73,0x74,0x64,0x34,0x33,0x30,0x29,0x20,0x72,0x65,0x61,0x64,0x6f,
+    0x6e,0x6c,0x79,0x20,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x70,0x6f,0x73,0x69,0x74,
+    0x69,0x6f,0x6e,0x5f,0x62,0x75,0x66,0x66,0x65,0x72,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x57,0x6f,0x72,0x64,0x20,0x70,0x6f,
+    0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x77,0x6f,0x72,0x64,0x73,0x5b,0x5d,0x3b,0x0a,
+    0x7d,0x20,0x5f,0x35,0x38,0x3b,0x0a,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x62,
+    0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x30,0x2c,0x20,0x73,0x74,0x64,0x34,
+    0x33,0x30,0x29,0x20,0x77,0x72,0x69,0x74,0x65,0x6f,0x6e,0x6c,0x79,0x20,0x62,0x75,
+    0x66,0x66,0x65,0x72,0x20,0x64,0x65,0x70,0x74,0x68,0x5f,0x6f,0x75,0x74,0x70,0x75,
+    0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x44,0x65,0x70,0x74,0x68,0x56,0x61,0x6c,
+    0x75,0x65,0x20,0x64,0x65,0x70,0x74,0x68,0x73,0x5b,0x5d,0x3b,0x0a,0x7d,0x20,0x5f,
+    0x31,0x37,0x30,0x3b,0x0a,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x62,0x69,0x6e,
+    0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x31,0x2c,0x20,0x73,0x74,0x64,0x34,0x33,0x30,
+    0x29,0x20,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x69,0x6e,0x64,0x65,0x78,0x5f,0x6f,
+    0x75,0x74,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x44,0x65,0x70,0x74,
+    0x68,0x49,0x6e,0x64,0x65,0x78,0x44,0x61,0x74,0x61,0x20,0x69,0x6e,0x64,0x69,0x63,
+    0x65,0x73,0x5b,0x5d,0x3b,0x0a,0x7d,0x20,0x5f,0x31,0x38,0x30,0x3b,0x0a,0x0a,0x6c,
+    0x61,0x79,0x6f,0x75,0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,
+    0x32,0x2c,0x20,0x73,0x74,0x64,0x34,0x33,0x30,0x29,0x20,0x72,0x65,0x61,0x64,0x6f,
+    0x6e,0x6c,0x79,0x20,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x61,0x63,0x74,0x69,0x76,
+    0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x41,0x63,
+    0x74,0x69,0x76,0x65,0x49,0x6e,0x64,0x65,0x78,0x20,0x61,0x63,0x74,0x69,0x76,0x65,
+    0x5f,0x69,0x6e,0x64,0x69,0x63,0x65,0x73,0x5b,0x5d,0x3b,0x0a,0x7d,0x20,0x5f,0x31,
+    0x39,0x35,0x3b,0x0a,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x62,0x69,0x6e,0x64,
+    0x69,0x6e,0x67,0x20,0x3d,0x20,0x30,0x29,0x20,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,
+    0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,
+    0x20,0x63,0x68,0x75,0x6e,0x6b,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,
+    0x70,0x6c,0x61,0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x3b,0x0a,0x0a,0x76,
+    0x65,0x63,0x33,0x20,0x75,0x6e,0x70,0x61,0x63,0x6b,0x5f,0x70,0x6f,0x73,0x69,0x74,
+    0x69,0x6f,0x6e,0x28,0x75,0x69,0x6e,0x74,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x69,
+    0x64,0x78,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,
+    0x33,0x31,0x20,0x3d,0x20,0x28,0x73,0x70,0x6c,0x61,0x74,0x5f,0x69,0x64,0x78,0x20,
+    0x2a,0x20,0x33,0x75,0x29,0x20,0x3e,0x3e,0x20,0x31,0x75,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,0x33,0x38,0x20,0x3d,0x20,0x5f,0x35,0x38,0x2e,
+    0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x77,0x6f,0x72,0x64,0x73,0x5b,0x5f,
+    0x33,0x31,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,
+    0x69,0x6e,0x74,0x20,0x5f,0x34,0x34,0x20,0x3d,0x20,0x5f,0x35,0x38,0x2e,0x70,0x6f,
+    0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x77,0x6f,0x72,0x64,0x73,0x5b,0x5f,0x33,0x31,
+    0x20,0x2b,0x20,0x31,0x75,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x75,0x76,0x65,0x63,0x33,0x20,0x5f,0x37,0x31,0x20,0x3d,0x20,0x28,0x28,
+    0x73,0x70,0x6c,0x61,0x74,0x5f,0x69,0x64,0x78,0x20,0x26,0x20,0x31,0x75,0x29,0x20,
+    0x3d,0x3d,0x20,0x30,0x75,0x29,0x20,0x3f,0x20,0x75,0x76,0x65,0x63,0x33,0x28,0x5f,
+    0x33,0x38,0x20,0x26,0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x2c,0x20,0x5f,0x33,0x38,
+    0x20,0x3e,0x3e,0x20,0x31,0x36,0x75,0x2c,0x20,0x5f,0x34,0x34,0x20,0x26,0x20,0x36,
+    0x35,0x35,0x33,0x35,0x75,0x29,0x20,0x3a,0x20,0x75,0x76,0x65,0x63,0x33,0x28,0x5f,
+    0x33,0x38,0x20,0x3e,0x3e,0x20,0x31,0x36,0x75,0x2c,0x20,0x5f,0x34,0x34,0x20,0x26,
+    0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x2c,0x20,0x5f,0x34,0x34,0x20,0x3e,0x3e,0x20,
+    0x31,0x36,0x75,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x5f,0x38,
+    0x33,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,0x73,0x70,0x6c,0x61,0x74,0x5f,0x69,0x64,
+    0x78,0x29,0x20,0x2f,0x20,0x32,0x35,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x76,
+    0x65,0x63,0x32,0x20,0x5f,0x39,0x36,0x20,0x3d,0x20,0x69,0x76,0x65,0x63,0x32,0x28,
+    0x28,0x5f,0x38,0x33,0x20,0x25,0x20,0x31,0x30,0x32,0x34,0x29,0x20,0x2a,0x20,0x32,
+    0x2c,0x20,0x5f,0x38,0x33,0x20,0x2f,0x20,0x31,0x30,0x32,0x34,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x5f,0x31,0x30,0x35,0x20,0x3d,0x20,0x74,
+    0x65,0x78,0x65,0x6c,0x46,0x65,0x74,0x63,0x68,0x28,0x63,0x68,0x75,0x6e,0x6b,0x5f,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x70,0x6c,0x61,0x74,0x5f,0x73,0x61,
+    0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x5f,0x39,0x36,0x2c,0x20,0x30,0x29,0x2e,0x78,
+    0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5f,
+    0x31,0x30,0x35,0x20,0x2b,0x20,0x28,0x28,0x76,0x65,0x63,0x33,0x28,0x5f,0x37,0x31,
+    0x29,0x20,0x2a,0x20,0x31,0x2e,0x35,0x32,0x35,0x39,0x30,0x32,0x31,0x38,0x39,0x33,
+    0x31,0x34,0x33,0x36,0x35,0x33,0x38,0x36,0x39,0x36,0x32,0x38,0x39,0x30,0x36,0x32,
+    0x35,0x65,0x2d,0x30,0x35,0x29,0x20,0x2a,0x20,0x28,0x74,0x65,0x78,0x65,0x6c,0x46,
+    0x65,0x74,0x63,0x68,0x28,0x63,0x68,0x75,0x6e,0x6b,0x5f,0x74,0x65,0x78,0x74,0x75,
     0x72,0x65,0x5f,0x73,0x70,0x6c,0x61,0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,
-    0x2c,0x20,0x69,0x76,0x65,0x63,0x33,0x28,0x5f,0x33,0x35,0x20,0x25,0x20,0x5f,0x32,
-    0x32,0x2e,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x77,0x69,0x64,0x74,0x68,0x2c,
-    0x20,0x5f,0x33,0x35,0x20,0x2f,0x20,0x5f,0x32,0x32,0x2e,0x74,0x65,0x78,0x74,0x75,
-    0x72,0x65,0x5f,0x77,0x69,0x64,0x74,0x68,0x2c,0x20,0x5f,0x32,0x37,0x29,0x2c,0x20,
-    0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,0x37,0x32,
-    0x20,0x3d,0x20,0x5f,0x36,0x37,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,
-    0x74,0x75,0x72,0x6e,0x20,0x5f,0x32,0x32,0x2e,0x62,0x6f,0x75,0x6e,0x64,0x73,0x5f,
-    0x6d,0x69,0x6e,0x20,0x2b,0x20,0x28,0x28,0x76,0x65,0x63,0x33,0x28,0x66,0x6c,0x6f,
-    0x61,0x74,0x28,0x28,0x5f,0x37,0x32,0x20,0x3e,0x3e,0x20,0x31,0x36,0x75,0x29,0x20,
-    0x26,0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,
-    0x28,0x5f,0x37,0x32,0x20,0x26,0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x2c,0x20,
-    0x66,0x6c,0x6f,0x61,0x74,0x28,0x28,0x5f,0x36,0x37,0x2e,0x79,0x20,0x3e,0x3e,0x20,
-    0x31,0x36,0x75,0x29,0x20,0x26,0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x29,0x20,
-    0x2a,0x20,0x31,0x2e,0x35,0x32,0x35,0x39,0x30,0x32,0x31,0x38,0x39,0x33,0x31,0x34,
-    0x33,0x36,0x35,0x33,0x38,0x36,0x39,0x36,0x32,0x38,0x39,0x30,0x36,0x32,0x35,0x65,
-    0x2d,0x30,0x35,0x29,0x20,0x2a,0x20,0x5f,0x32,0x32,0x2e,0x62,0x6f,0x75,0x6e,0x64,
-    0x73,0x5f,0x73,0x69,0x7a,0x65,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x6f,0x69,0x64,
-    0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,
-    0x20,0x28,0x69,0x6e,0x74,0x28,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,
-    0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x29,0x20,0x3e,
-    0x3d,0x20,0x5f,0x32,0x32,0x2e,0x73,0x70,0x6c,0x61,0x74,0x5f,0x63,0x6f,0x75,0x6e,
-    0x74,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,
-    0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,
-    0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,
-    0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x5f,0x31,0x34,
-    0x31,0x2e,0x64,0x65,0x70,0x74,0x68,0x73,0x5b,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,
-    0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,
-    0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x75,0x6e,
-    0x70,0x61,0x63,0x6b,0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x28,0x70,0x61,
-    0x72,0x61,0x6d,0x29,0x20,0x2d,0x20,0x5f,0x32,0x32,0x2e,0x63,0x61,0x6d,0x65,0x72,
-    0x61,0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x5f,0x32,0x32,0x2e,
-    0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x66,0x6f,0x72,0x77,0x61,0x72,0x64,0x29,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x5f,0x31,0x35,0x30,0x2e,0x69,0x6e,0x64,0x69,0x63,0x65,
-    0x73,0x5b,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,
-    0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,
-    0x20,0x3d,0x20,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,
-    0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
-
+    0x2c,0x20,0x5f,0x39,0x36,0x20,0x2b,0x20,0x69,0x76,0x65,0x63,0x32,0x28,0x31,0x2c,
+    0x20,0x30,0x29,0x2c,0x20,0x30,0x29,0x2e,0x78,0x79,0x7a,0x20,0x2d,0x20,0x5f,0x31,
+    0x30,0x35,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,
+    0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,
+    0x6e,0x74,0x28,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,
+    0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x29,0x20,0x3e,0x3d,0x20,0x5f,
+    0x32,0x32,0x2e,0x73,0x6f,0x72,0x74,0x5f,0x63,0x6f,0x75,0x6e,0x74,0x29,0x0a,0x20,
+    0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,
+    0x75,0x72,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,
+    0x66,0x20,0x28,0x69,0x6e,0x74,0x28,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,
+    0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x29,0x20,
+    0x3e,0x3d,0x20,0x5f,0x32,0x32,0x2e,0x73,0x70,0x6c,0x61,0x74,0x5f,0x63,0x6f,0x75,
+    0x6e,0x74,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x5f,0x31,0x37,0x30,0x2e,0x64,0x65,0x70,0x74,0x68,0x73,0x5b,0x5f,0x32,
+    0x32,0x2e,0x73,0x65,0x6e,0x74,0x69,0x6e,0x65,0x6c,0x5f,0x69,0x6e,0x64,0x65,0x78,
+    0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x2d,0x33,0x2e,0x34,0x30,0x32,
+    0x38,0x32,0x33,0x30,0x36,0x30,0x37,0x33,0x37,0x30,0x39,0x36,0x35,0x30,0x35,0x36,
+    0x32,0x32,0x32,0x34,0x33,0x38,0x39,0x36,0x31,0x37,0x31,0x37,0x65,0x2b,0x33,0x38,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x31,0x38,0x30,0x2e,0x69,
+    0x6e,0x64,0x69,0x63,0x65,0x73,0x5b,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,
+    0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x5d,0x2e,
+    0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,0x28,0x5f,0x32,0x32,
+    0x2e,0x73,0x65,0x6e,0x74,0x69,0x6e,0x65,0x6c,0x5f,0x69,0x6e,0x64,0x65,0x78,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,
+    0x20,0x5f,0x31,0x35,0x36,0x20,0x3d,0x20,0x28,0x5f,0x32,0x32,0x2e,0x75,0x73,0x65,
+    0x5f,0x61,0x63,0x74,0x69,0x76,0x65,0x5f,0x69,0x6e,0x64,0x69,0x63,0x65,0x73,0x20,
+    0x21,0x3d,0x20,0x30,0x29,0x20,0x3f,0x20,0x5f,0x31,0x39,0x35,0x2e,0x61,0x63,0x74,
+    0x69,0x76,0x65,0x5f,0x69,0x6e,0x64,0x69,0x63,0x65,0x73,0x5b,0x67,0x6c,0x5f,0x47,
+    0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,
+    0x44,0x2e,0x78,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3a,0x20,0x67,0x6c,0x5f,
+    0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,
+    0x49,0x44,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x70,
+    0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x5f,0x31,0x35,0x36,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x5f,0x31,0x37,0x30,0x2e,0x64,0x65,0x70,0x74,0x68,0x73,0x5b,0x5f,0x31,0x35,
+    0x36,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x75,
+    0x6e,0x70,0x61,0x63,0x6b,0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x28,0x70,
+    0x61,0x72,0x61,0x6d,0x29,0x20,0x2d,0x20,0x5f,0x32,0x32,0x2e,0x63,0x61,0x6d,0x65,
+    0x72,0x61,0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x5f,0x32,0x32,
+    0x2e,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x66,0x6f,0x72,0x77,0x61,0x72,0x64,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x5f,0x31,0x38,0x30,0x2e,0x69,0x6e,0x64,0x69,0x63,
+    0x65,0x73,0x5b,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,
+    0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x5d,0x2e,0x76,0x61,0x6c,0x75,
+    0x65,0x20,0x3d,0x20,0x5f,0x31,0x35,0x36,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
 };
 /*
+    struct PositionWord
+    {
+        uint value;
+    };
+
     struct DepthValue
     {
         float value;
@@ -439,6 +598,11 @@ static const uint8_t depth_calc_source_glsl310es[1648] = {
         uint value;
     };
 
+    struct ActiveIndex
+    {
+        uint value;
+    };
+
     static const uint3 gl_WorkGroupSize = uint3(256u, 1u, 1u);
 
     cbuffer depth_params : register(b0)
@@ -451,19 +615,17 @@ static const uint8_t depth_calc_source_glsl310es[1648] = {
         float _22_pad0 : packoffset(c4.w);
         float3 _22_camera_forward : packoffset(c5);
         float _22_pad1 : packoffset(c5.w);
-        float3 _22_bounds_min : packoffset(c6);
-        float _22_pad2 : packoffset(c6.w);
-        float3 _22_bounds_size : packoffset(c7);
-        int _22_splat_count : packoffset(c7.w);
-        int _22_texture_width : packoffset(c8);
-        int _22_texture_height : packoffset(c8.y);
-        int _22_splats_per_layer : packoffset(c8.z);
-        float _22_pad3 : packoffset(c8.w);
+        int _22_splat_count : packoffset(c6);
+        int _22_sort_count : packoffset(c6.y);
+        int _22_use_active_indices : packoffset(c6.z);
+        int _22_sentinel_index : packoffset(c6.w);
     };
 
-    RWByteAddressBuffer _141 : register(u0);
-    RWByteAddressBuffer _150 : register(u1);
-    Texture2DArray<uint4> splat_texture : register(t0);
+    ByteAddressBuffer _58 : register(t2);
+    RWByteAddressBuffer _170 : register(u0);
+    RWByteAddressBuffer _180 : register(u1);
+    ByteAddressBuffer _195 : register(t0);
+    Texture2D<float4> chunk_texture : register(t1);
     SamplerState splat_sampler : register(s2);
 
     static uint3 gl_GlobalInvocationID;
@@ -474,22 +636,32 @@ static const uint8_t depth_calc_source_glsl310es[1648] = {
 
     float3 unpack_position(uint splat_idx)
     {
-        int _27 = int(splat_idx) / _22_splats_per_layer;
-        int _35 = int(splat_idx) - (_27 * _22_splats_per_layer);
-        uint4 _67 = splat_texture.Load(int4(int3(_35 % _22_texture_width, _35 / _22_texture_width, _27), 0));
-        uint _72 = _67.x;
-        return _22_bounds_min + ((float3(float((_72 >> 16u) & 65535u), float(_72 & 65535u), float((_67.y >> 16u) & 65535u)) * 1.525902189314365386962890625e-05f) * _22_bounds_size);
+        uint _31 = (splat_idx * 3u) >> 1u;
+        uint _38 = _58.Load(_31 * 4 + 0);
+        uint _44 = _58.Load((_31 + 1u) * 4 + 0);
+        uint3 _71 = ((splat_idx & 1u) == 0u) ? uint3(_38 & 65535u, _38 >> 16u, _44 & 65535u) : uint3(_38 >> 16u, _44 & 65535u, _44 >> 16u);
+        int _83 = int(splat_idx) / 256;
+        int2 _96 = int2((_83 % 1024) * 2, _83 / 1024);
+        float3 _105 = chunk_texture.Load(int3(_96, 0)).xyz;
+        return _105 + ((float3(_71) * 1.525902189314365386962890625e-05f) * (chunk_texture.Load(int3(_96 + int2(1, 0), 0)).xyz - _105));
     }
 
     void comp_main()
     {
+        if (int(gl_GlobalInvocationID.x) >= _22_sort_count)
+        {
+            return;
+        }
         if (int(gl_GlobalInvocationID.x) >= _22_splat_count)
         {
+            _170.Store(_22_sentinel_index * 4 + 0, asuint(-3.4028230607370965056222438961717e+38f));
+            _180.Store(gl_GlobalInvocationID.x * 4 + 0, uint(_22_sentinel_index));
             return;
         }
-        uint param = gl_GlobalInvocationID.x;
-        _141.Store(gl_GlobalInvocationID.x * 4 + 0, asuint(dot(unpack_position(param) - _22_camera_position, _22_camera_forward)));
-        _150.Store(gl_GlobalInvocationID.x * 4 + 0, gl_GlobalInvocationID.x);
+        uint _156 = (_22_use_active_indices != 0) ? _195.Load(gl_GlobalInvocationID.x * 4 + 0) : gl_GlobalInvocationID.x;
+        uint param = _156;
+        _170.Store(_156 * 4 + 0, asuint(dot(unpack_position(param) - _22_camera_position, _22_camera_forward)));
+        _180.Store(gl_GlobalInvocationID.x * 4 + 0, _156);
     }
 
     [numthreads(256, 1, 1)]
@@ -499,143 +671,169 @@ static const uint8_t depth_calc_source_glsl310es[1648] = {
         comp_main();
     }
 */
-static const uint8_t depth_calc_source_hlsl5[2162] = {
-    0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x44,0x65,0x70,0x74,0x68,0x56,0x61,0x6c,0x75,
-    0x65,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x61,
-    0x6c,0x75,0x65,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,
-    0x44,0x65,0x70,0x74,0x68,0x49,0x6e,0x64,0x65,0x78,0x44,0x61,0x74,0x61,0x0a,0x7b,
-    0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x76,0x61,0x6c,0x75,0x65,0x3b,
-    0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x63,0x6f,0x6e,0x73,
-    0x74,0x20,0x75,0x69,0x6e,0x74,0x33,0x20,0x67,0x6c,0x5f,0x57,0x6f,0x72,0x6b,0x47,
-    0x72,0x6f,0x75,0x70,0x53,0x69,0x7a,0x65,0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,0x33,
-    0x28,0x32,0x35,0x36,0x75,0x2c,0x20,0x31,0x75,0x2c,0x20,0x31,0x75,0x29,0x3b,0x0a,
-    0x0a,0x63,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x64,0x65,0x70,0x74,0x68,0x5f,0x70,
-    0x61,0x72,0x61,0x6d,0x73,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,
-    0x28,0x62,0x30,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
-    0x34,0x20,0x5f,0x32,0x32,0x5f,0x76,0x69,0x65,0x77,0x4d,0x61,0x74,0x5f,0x72,0x6f,
-    0x77,0x30,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,
-    0x63,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
-    0x5f,0x32,0x32,0x5f,0x76,0x69,0x65,0x77,0x4d,0x61,0x74,0x5f,0x72,0x6f,0x77,0x31,
-    0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x31,
-    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x32,
-    0x32,0x5f,0x76,0x69,0x65,0x77,0x4d,0x61,0x74,0x5f,0x72,0x6f,0x77,0x32,0x20,0x3a,
-    0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x32,0x29,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x32,0x32,0x5f,
-    0x76,0x69,0x65,0x77,0x4d,0x61,0x74,0x5f,0x72,0x6f,0x77,0x33,0x20,0x3a,0x20,0x70,
-    0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x33,0x29,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x32,0x32,0x5f,0x63,0x61,
-    0x6d,0x65,0x72,0x61,0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,
-    0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x34,0x29,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,0x32,0x5f,0x70,0x61,
-    0x64,0x30,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,
-    0x63,0x34,0x2e,0x77,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
-    0x33,0x20,0x5f,0x32,0x32,0x5f,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x66,0x6f,0x72,
-    0x77,0x61,0x72,0x64,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,
-    0x74,0x28,0x63,0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
-    0x20,0x5f,0x32,0x32,0x5f,0x70,0x61,0x64,0x31,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,
-    0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x35,0x2e,0x77,0x29,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x32,0x32,0x5f,0x62,0x6f,0x75,
-    0x6e,0x64,0x73,0x5f,0x6d,0x69,0x6e,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,
-    0x66,0x73,0x65,0x74,0x28,0x63,0x36,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
-    0x6f,0x61,0x74,0x20,0x5f,0x32,0x32,0x5f,0x70,0x61,0x64,0x32,0x20,0x3a,0x20,0x70,
-    0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x36,0x2e,0x77,0x29,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x32,0x32,0x5f,
-    0x62,0x6f,0x75,0x6e,0x64,0x73,0x5f,0x73,0x69,0x7a,0x65,0x20,0x3a,0x20,0x70,0x61,
-    0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x37,0x29,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x69,0x6e,0x74,0x20,0x5f,0x32,0x32,0x5f,0x73,0x70,0x6c,0x61,0x74,0x5f,
-    0x63,0x6f,0x75,0x6e,0x74,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,
-    0x65,0x74,0x28,0x63,0x37,0x2e,0x77,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,
-    0x74,0x20,0x5f,0x32,0x32,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x77,0x69,
-    0x64,0x74,0x68,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,
-    0x28,0x63,0x38,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x5f,0x32,
-    0x32,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x68,0x65,0x69,0x67,0x68,0x74,
-    0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x38,
-    0x2e,0x79,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x5f,0x32,0x32,
-    0x5f,0x73,0x70,0x6c,0x61,0x74,0x73,0x5f,0x70,0x65,0x72,0x5f,0x6c,0x61,0x79,0x65,
-    0x72,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,
-    0x38,0x2e,0x7a,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
-    0x5f,0x32,0x32,0x5f,0x70,0x61,0x64,0x33,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,
-    0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x38,0x2e,0x77,0x29,0x3b,0x0a,0x7d,0x3b,0x0a,
-    0x0a,0x52,0x57,0x42,0x79,0x74,0x65,0x41,0x64,0x64,0x72,0x65,0x73,0x73,0x42,0x75,
-    0x66,0x66,0x65,0x72,0x20,0x5f,0x31,0x34,0x31,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,
-    0x73,0x74,0x65,0x72,0x28,0x75,0x30,0x29,0x3b,0x0a,0x52,0x57,0x42,0x79,0x74,0x65,
-    0x41,0x64,0x64,0x72,0x65,0x73,0x73,0x42,0x75,0x66,0x66,0x65,0x72,0x20,0x5f,0x31,
-    0x35,0x30,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x75,0x31,
-    0x29,0x3b,0x0a,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x44,0x41,0x72,0x72,0x61,
-    0x79,0x3c,0x75,0x69,0x6e,0x74,0x34,0x3e,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x74,
-    0x65,0x78,0x74,0x75,0x72,0x65,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,
-    0x72,0x28,0x74,0x30,0x29,0x3b,0x0a,0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,0x53,0x74,
-    0x61,0x74,0x65,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,
-    0x72,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x73,0x32,0x29,
-    0x3b,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x75,0x69,0x6e,0x74,0x33,0x20,
+static const uint8_t depth_calc_source_hlsl5[2585] = {
+    0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x57,
+    0x6f,0x72,0x64,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x76,
+    0x61,0x6c,0x75,0x65,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,
+    0x20,0x44,0x65,0x70,0x74,0x68,0x56,0x61,0x6c,0x75,0x65,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,0x7d,
+    0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x44,0x65,0x70,0x74,0x68,0x49,
+    0x6e,0x64,0x65,0x78,0x44,0x61,0x74,0x61,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,
+    0x69,0x6e,0x74,0x20,0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,
+    0x74,0x72,0x75,0x63,0x74,0x20,0x41,0x63,0x74,0x69,0x76,0x65,0x49,0x6e,0x64,0x65,
+    0x78,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x76,0x61,0x6c,
+    0x75,0x65,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x63,
+    0x6f,0x6e,0x73,0x74,0x20,0x75,0x69,0x6e,0x74,0x33,0x20,0x67,0x6c,0x5f,0x57,0x6f,
+    0x72,0x6b,0x47,0x72,0x6f,0x75,0x70,0x53,0x69,0x7a,0x65,0x20,0x3d,0x20,0x75,0x69,
+    0x6e,0x74,0x33,0x28,0x32,0x35,0x36,0x75,0x2c,0x20,0x31,0x75,0x2c,0x20,0x31,0x75,
+    0x29,0x3b,0x0a,0x0a,0x63,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x64,0x65,0x70,0x74,
+    0x68,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,
+    0x74,0x65,0x72,0x28,0x62,0x30,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x20,0x5f,0x32,0x32,0x5f,0x76,0x69,0x65,0x77,0x4d,0x61,0x74,
+    0x5f,0x72,0x6f,0x77,0x30,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,
+    0x65,0x74,0x28,0x63,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x34,0x20,0x5f,0x32,0x32,0x5f,0x76,0x69,0x65,0x77,0x4d,0x61,0x74,0x5f,0x72,
+    0x6f,0x77,0x31,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,
+    0x28,0x63,0x31,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x20,0x5f,0x32,0x32,0x5f,0x76,0x69,0x65,0x77,0x4d,0x61,0x74,0x5f,0x72,0x6f,0x77,
+    0x32,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,
+    0x32,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,
+    0x32,0x32,0x5f,0x76,0x69,0x65,0x77,0x4d,0x61,0x74,0x5f,0x72,0x6f,0x77,0x33,0x20,
+    0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x33,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x32,0x32,
+    0x5f,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
+    0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x34,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,0x32,
+    0x5f,0x70,0x61,0x64,0x30,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,
+    0x65,0x74,0x28,0x63,0x34,0x2e,0x77,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x33,0x20,0x5f,0x32,0x32,0x5f,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,
+    0x66,0x6f,0x72,0x77,0x61,0x72,0x64,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,
+    0x66,0x73,0x65,0x74,0x28,0x63,0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x5f,0x32,0x32,0x5f,0x70,0x61,0x64,0x31,0x20,0x3a,0x20,0x70,
+    0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x35,0x2e,0x77,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x5f,0x32,0x32,0x5f,0x73,0x70,0x6c,
+    0x61,0x74,0x5f,0x63,0x6f,0x75,0x6e,0x74,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,
+    0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x36,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,
+    0x6e,0x74,0x20,0x5f,0x32,0x32,0x5f,0x73,0x6f,0x72,0x74,0x5f,0x63,0x6f,0x75,0x6e,
+    0x74,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,
+    0x36,0x2e,0x79,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x5f,0x32,
+    0x32,0x5f,0x75,0x73,0x65,0x5f,0x61,0x63,0x74,0x69,0x76,0x65,0x5f,0x69,0x6e,0x64,
+    0x69,0x63,0x65,0x73,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,
+    0x74,0x28,0x63,0x36,0x2e,0x7a,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,
+    0x20,0x5f,0x32,0x32,0x5f,0x73,0x65,0x6e,0x74,0x69,0x6e,0x65,0x6c,0x5f,0x69,0x6e,
+    0x64,0x65,0x78,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,
+    0x28,0x63,0x36,0x2e,0x77,0x29,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x42,0x79,0x74,0x65,
+    0x41,0x64,0x64,0x72,0x65,0x73,0x73,0x42,0x75,0x66,0x66,0x65,0x72,0x20,0x5f,0x35,
+    0x38,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x74,0x32,0x29,
+    0x3b,0x0a,0x52,0x57,0x42,0x79,0x74,0x65,0x41,0x64,0x64,0x72,0x65,0x73,0x73,0x42,
+    0x75,0x66,0x66,0x65,0x72,0x20,0x5f,0x31,0x37,0x30,0x20,0x3a,0x20,0x72,0x65,0x67,
+    0x69,0x73,0x74,0x65,0x72,0x28,0x75,0x30,0x29,0x3b,0x0a,0x52,0x57,0x42,0x79,0x74,
+    0x65,0x41,0x64,0x64,0x72,0x65,0x73,0x73,0x42,0x75,0x66,0x66,0x65,0x72,0x20,0x5f,
+    0x31,0x38,0x30,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x75,
+    0x31,0x29,0x3b,0x0a,0x42,0x79,0x74,0x65,0x41,0x64,0x64,0x72,0x65,0x73,0x73,0x42,
+    0x75,0x66,0x66,0x65,0x72,0x20,0x5f,0x31,0x39,0x35,0x20,0x3a,0x20,0x72,0x65,0x67,
+    0x69,0x73,0x74,0x65,0x72,0x28,0x74,0x30,0x29,0x3b,0x0a,0x54,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x32,0x44,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x34,0x3e,0x20,0x63,0x68,0x75,
+    0x6e,0x6b,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x20,0x3a,0x20,0x72,0x65,0x67,
+    0x69,0x73,0x74,0x65,0x72,0x28,0x74,0x31,0x29,0x3b,0x0a,0x53,0x61,0x6d,0x70,0x6c,
+    0x65,0x72,0x53,0x74,0x61,0x74,0x65,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x73,0x61,
+    0x6d,0x70,0x6c,0x65,0x72,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,
+    0x28,0x73,0x32,0x29,0x3b,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x75,0x69,
+    0x6e,0x74,0x33,0x20,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,
+    0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x3b,0x0a,0x73,0x74,0x72,0x75,0x63,
+    0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,
+    0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x33,0x20,
     0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,
-    0x69,0x6f,0x6e,0x49,0x44,0x3b,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,
-    0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x0a,
-    0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x33,0x20,0x67,0x6c,0x5f,0x47,
-    0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,
-    0x44,0x20,0x3a,0x20,0x53,0x56,0x5f,0x44,0x69,0x73,0x70,0x61,0x74,0x63,0x68,0x54,
-    0x68,0x72,0x65,0x61,0x64,0x49,0x44,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x66,0x6c,0x6f,
-    0x61,0x74,0x33,0x20,0x75,0x6e,0x70,0x61,0x63,0x6b,0x5f,0x70,0x6f,0x73,0x69,0x74,
-    0x69,0x6f,0x6e,0x28,0x75,0x69,0x6e,0x74,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x69,
-    0x64,0x78,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x5f,0x32,
-    0x37,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,0x73,0x70,0x6c,0x61,0x74,0x5f,0x69,0x64,
-    0x78,0x29,0x20,0x2f,0x20,0x5f,0x32,0x32,0x5f,0x73,0x70,0x6c,0x61,0x74,0x73,0x5f,
-    0x70,0x65,0x72,0x5f,0x6c,0x61,0x79,0x65,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,
-    0x6e,0x74,0x20,0x5f,0x33,0x35,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,0x73,0x70,0x6c,
-    0x61,0x74,0x5f,0x69,0x64,0x78,0x29,0x20,0x2d,0x20,0x28,0x5f,0x32,0x37,0x20,0x2a,
-    0x20,0x5f,0x32,0x32,0x5f,0x73,0x70,0x6c,0x61,0x74,0x73,0x5f,0x70,0x65,0x72,0x5f,
-    0x6c,0x61,0x79,0x65,0x72,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,
-    0x34,0x20,0x5f,0x36,0x37,0x20,0x3d,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x74,0x65,
-    0x78,0x74,0x75,0x72,0x65,0x2e,0x4c,0x6f,0x61,0x64,0x28,0x69,0x6e,0x74,0x34,0x28,
-    0x69,0x6e,0x74,0x33,0x28,0x5f,0x33,0x35,0x20,0x25,0x20,0x5f,0x32,0x32,0x5f,0x74,
-    0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x77,0x69,0x64,0x74,0x68,0x2c,0x20,0x5f,0x33,
-    0x35,0x20,0x2f,0x20,0x5f,0x32,0x32,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,
-    0x77,0x69,0x64,0x74,0x68,0x2c,0x20,0x5f,0x32,0x37,0x29,0x2c,0x20,0x30,0x29,0x29,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,0x37,0x32,0x20,0x3d,
-    0x20,0x5f,0x36,0x37,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
-    0x72,0x6e,0x20,0x5f,0x32,0x32,0x5f,0x62,0x6f,0x75,0x6e,0x64,0x73,0x5f,0x6d,0x69,
-    0x6e,0x20,0x2b,0x20,0x28,0x28,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x66,0x6c,0x6f,
-    0x61,0x74,0x28,0x28,0x5f,0x37,0x32,0x20,0x3e,0x3e,0x20,0x31,0x36,0x75,0x29,0x20,
-    0x26,0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,
-    0x28,0x5f,0x37,0x32,0x20,0x26,0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x2c,0x20,
-    0x66,0x6c,0x6f,0x61,0x74,0x28,0x28,0x5f,0x36,0x37,0x2e,0x79,0x20,0x3e,0x3e,0x20,
-    0x31,0x36,0x75,0x29,0x20,0x26,0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x29,0x20,
-    0x2a,0x20,0x31,0x2e,0x35,0x32,0x35,0x39,0x30,0x32,0x31,0x38,0x39,0x33,0x31,0x34,
-    0x33,0x36,0x35,0x33,0x38,0x36,0x39,0x36,0x32,0x38,0x39,0x30,0x36,0x32,0x35,0x65,
-    0x2d,0x30,0x35,0x66,0x29,0x20,0x2a,0x20,0x5f,0x32,0x32,0x5f,0x62,0x6f,0x75,0x6e,
-    0x64,0x73,0x5f,0x73,0x69,0x7a,0x65,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x6f,0x69,
-    0x64,0x20,0x63,0x6f,0x6d,0x70,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,
-    0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x6e,0x74,0x28,0x67,0x6c,0x5f,0x47,
+    0x69,0x6f,0x6e,0x49,0x44,0x20,0x3a,0x20,0x53,0x56,0x5f,0x44,0x69,0x73,0x70,0x61,
+    0x74,0x63,0x68,0x54,0x68,0x72,0x65,0x61,0x64,0x49,0x44,0x3b,0x0a,0x7d,0x3b,0x0a,
+    0x0a,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x75,0x6e,0x70,0x61,0x63,0x6b,0x5f,0x70,
+    0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x28,0x75,0x69,0x6e,0x74,0x20,0x73,0x70,0x6c,
+    0x61,0x74,0x5f,0x69,0x64,0x78,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,
+    0x6e,0x74,0x20,0x5f,0x33,0x31,0x20,0x3d,0x20,0x28,0x73,0x70,0x6c,0x61,0x74,0x5f,
+    0x69,0x64,0x78,0x20,0x2a,0x20,0x33,0x75,0x29,0x20,0x3e,0x3e,0x20,0x31,0x75,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,0x33,0x38,0x20,0x3d,0x20,
+    0x5f,0x35,0x38,0x2e,0x4c,0x6f,0x61,0x64,0x28,0x5f,0x33,0x31,0x20,0x2a,0x20,0x34,
+    0x20,0x2b,0x20,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,
+    0x5f,0x34,0x34,0x20,0x3d,0x20,0x5f,0x35,0x38,0x2e,0x4c,0x6f,0x61,0x64,0x28,0x28,
+    0x5f,0x33,0x31,0x20,0x2b,0x20,0x31,0x75,0x29,0x20,0x2a,0x20,0x34,0x20,0x2b,0x20,
+    0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x33,0x20,0x5f,0x37,
+    0x31,0x20,0x3d,0x20,0x28,0x28,0x73,0x70,0x6c,0x61,0x74,0x5f,0x69,0x64,0x78,0x20,
+    0x26,0x20,0x31,0x75,0x29,0x20,0x3d,0x3d,0x20,0x30,0x75,0x29,0x20,0x3f,0x20,0x75,
+    0x69,0x6e,0x74,0x33,0x28,0x5f,0x33,0x38,0x20,0x26,0x20,0x36,0x35,0x35,0x33,0x35,
+    0x75,0x2c,0x20,0x5f,0x33,0x38,0x20,0x3e,0x3e,0x20,0x31,0x36,0x75,0x2c,0x20,0x5f,
+    0x34,0x34,0x20,0x26,0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x20,0x3a,0x20,0x75,
+    0x69,0x6e,0x74,0x33,0x28,0x5f,0x33,0x38,0x20,0x3e,0x3e,0x20,0x31,0x36,0x75,0x2c,
+    0x20,0x5f,0x34,0x34,0x20,0x26,0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x2c,0x20,0x5f,
+    0x34,0x34,0x20,0x3e,0x3e,0x20,0x31,0x36,0x75,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x69,0x6e,0x74,0x20,0x5f,0x38,0x33,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,0x73,0x70,
+    0x6c,0x61,0x74,0x5f,0x69,0x64,0x78,0x29,0x20,0x2f,0x20,0x32,0x35,0x36,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x32,0x20,0x5f,0x39,0x36,0x20,0x3d,0x20,0x69,
+    0x6e,0x74,0x32,0x28,0x28,0x5f,0x38,0x33,0x20,0x25,0x20,0x31,0x30,0x32,0x34,0x29,
+    0x20,0x2a,0x20,0x32,0x2c,0x20,0x5f,0x38,0x33,0x20,0x2f,0x20,0x31,0x30,0x32,0x34,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x31,
+    0x30,0x35,0x20,0x3d,0x20,0x63,0x68,0x75,0x6e,0x6b,0x5f,0x74,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x2e,0x4c,0x6f,0x61,0x64,0x28,0x69,0x6e,0x74,0x33,0x28,0x5f,0x39,0x36,
+    0x2c,0x20,0x30,0x29,0x29,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,
+    0x65,0x74,0x75,0x72,0x6e,0x20,0x5f,0x31,0x30,0x35,0x20,0x2b,0x20,0x28,0x28,0x66,
+    0x6c,0x6f,0x61,0x74,0x33,0x28,0x5f,0x37,0x31,0x29,0x20,0x2a,0x20,0x31,0x2e,0x35,
+    0x32,0x35,0x39,0x30,0x32,0x31,0x38,0x39,0x33,0x31,0x34,0x33,0x36,0x35,0x33,0x38,
+    0x36,0x39,0x36,0x32,0x38,0x39,0x30,0x36,0x32,0x35,0x65,0x2d,0x30,0x35,0x66,0x29,
+    0x20,0x2a,0x20,0x28,0x63,0x68,0x75,0x6e,0x6b,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,
+    0x65,0x2e,0x4c,0x6f,0x61,0x64,0x28,0x69,0x6e,0x74,0x33,0x28,0x5f,0x39,0x36,0x20,
+    0x2b,0x20,0x69,0x6e,0x74,0x32,0x28,0x31,0x2c,0x20,0x30,0x29,0x2c,0x20,0x30,0x29,
+    0x29,0x2e,0x78,0x79,0x7a,0x20,0x2d,0x20,0x5f,0x31,0x30,0x35,0x29,0x29,0x3b,0x0a,
+    0x7d,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x63,0x6f,0x6d,0x70,0x5f,0x6d,0x61,0x69,
+    0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x6e,
+    0x74,0x28,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,
+    0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x29,0x20,0x3e,0x3d,0x20,0x5f,0x32,
+    0x32,0x5f,0x73,0x6f,0x72,0x74,0x5f,0x63,0x6f,0x75,0x6e,0x74,0x29,0x0a,0x20,0x20,
+    0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+    0x72,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,
+    0x20,0x28,0x69,0x6e,0x74,0x28,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,
+    0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x29,0x20,0x3e,
+    0x3d,0x20,0x5f,0x32,0x32,0x5f,0x73,0x70,0x6c,0x61,0x74,0x5f,0x63,0x6f,0x75,0x6e,
+    0x74,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x5f,0x31,0x37,0x30,0x2e,0x53,0x74,0x6f,0x72,0x65,0x28,0x5f,0x32,0x32,0x5f,
+    0x73,0x65,0x6e,0x74,0x69,0x6e,0x65,0x6c,0x5f,0x69,0x6e,0x64,0x65,0x78,0x20,0x2a,
+    0x20,0x34,0x20,0x2b,0x20,0x30,0x2c,0x20,0x61,0x73,0x75,0x69,0x6e,0x74,0x28,0x2d,
+    0x33,0x2e,0x34,0x30,0x32,0x38,0x32,0x33,0x30,0x36,0x30,0x37,0x33,0x37,0x30,0x39,
+    0x36,0x35,0x30,0x35,0x36,0x32,0x32,0x32,0x34,0x33,0x38,0x39,0x36,0x31,0x37,0x31,
+    0x37,0x65,0x2b,0x33,0x38,0x66,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x5f,0x31,0x38,0x30,0x2e,0x53,0x74,0x6f,0x72,0x65,0x28,0x67,0x6c,0x5f,
+    0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,
+    0x49,0x44,0x2e,0x78,0x20,0x2a,0x20,0x34,0x20,0x2b,0x20,0x30,0x2c,0x20,0x75,0x69,
+    0x6e,0x74,0x28,0x5f,0x32,0x32,0x5f,0x73,0x65,0x6e,0x74,0x69,0x6e,0x65,0x6c,0x5f,
+    0x69,0x6e,0x64,0x65,0x78,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,
+    0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,0x31,0x35,0x36,0x20,0x3d,0x20,0x28,
+    0x5f,0x32,0x32,0x5f,0x75,0x73,0x65,0x5f,0x61,0x63,0x74,0x69,0x76,0x65,0x5f,0x69,
+    0x6e,0x64,0x69,0x63,0x65,0x73,0x20,0x21,0x3d,0x20,0x30,0x29,0x20,0x3f,0x20,0x5f,
+    0x31,0x39,0x35,0x2e,0x4c,0x6f,0x61,0x64,0x28,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,
+    0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,
+    0x20,0x2a,0x20,0x34,0x20,0x2b,0x20,0x30,0x29,0x20,0x3a,0x20,0x67,0x6c,0x5f,0x47,
     0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,
-    0x44,0x2e,0x78,0x29,0x20,0x3e,0x3d,0x20,0x5f,0x32,0x32,0x5f,0x73,0x70,0x6c,0x61,
-    0x74,0x5f,0x63,0x6f,0x75,0x6e,0x74,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x70,0x61,
-    0x72,0x61,0x6d,0x20,0x3d,0x20,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,
-    0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x5f,0x31,0x34,0x31,0x2e,0x53,0x74,0x6f,0x72,0x65,0x28,0x67,0x6c,
+    0x44,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x20,0x3d,0x20,0x5f,0x31,0x35,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x5f,0x31,0x37,0x30,0x2e,0x53,0x74,0x6f,0x72,0x65,0x28,0x5f,0x31,0x35,0x36,0x20,
+    0x2a,0x20,0x34,0x20,0x2b,0x20,0x30,0x2c,0x20,0x61,0x73,0x75,0x69,0x6e,0x74,0x28,
+    0x64,0x6f,0x74,0x28,0x75,0x6e,0x70,0x61,0x63,0x6b,0x5f,0x70,0x6f,0x73,0x69,0x74,
+    0x69,0x6f,0x6e,0x28,0x70,0x61,0x72,0x61,0x6d,0x29,0x20,0x2d,0x20,0x5f,0x32,0x32,
+    0x5f,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
+    0x2c,0x20,0x5f,0x32,0x32,0x5f,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x66,0x6f,0x72,
+    0x77,0x61,0x72,0x64,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x5f,0x31,0x38,
+    0x30,0x2e,0x53,0x74,0x6f,0x72,0x65,0x28,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,
+    0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x20,
+    0x2a,0x20,0x34,0x20,0x2b,0x20,0x30,0x2c,0x20,0x5f,0x31,0x35,0x36,0x29,0x3b,0x0a,
+    0x7d,0x0a,0x0a,0x5b,0x6e,0x75,0x6d,0x74,0x68,0x72,0x65,0x61,0x64,0x73,0x28,0x32,
+    0x35,0x36,0x2c,0x20,0x31,0x2c,0x20,0x31,0x29,0x5d,0x0a,0x76,0x6f,0x69,0x64,0x20,
+    0x6d,0x61,0x69,0x6e,0x28,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,
+    0x5f,0x49,0x6e,0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,
+    0x75,0x74,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x47,0x6c,0x6f,
+    0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x20,
+    0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x67,0x6c,
     0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,
-    0x6e,0x49,0x44,0x2e,0x78,0x20,0x2a,0x20,0x34,0x20,0x2b,0x20,0x30,0x2c,0x20,0x61,
-    0x73,0x75,0x69,0x6e,0x74,0x28,0x64,0x6f,0x74,0x28,0x75,0x6e,0x70,0x61,0x63,0x6b,
-    0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x28,0x70,0x61,0x72,0x61,0x6d,0x29,
-    0x20,0x2d,0x20,0x5f,0x32,0x32,0x5f,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x70,0x6f,
-    0x73,0x69,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x5f,0x32,0x32,0x5f,0x63,0x61,0x6d,0x65,
-    0x72,0x61,0x5f,0x66,0x6f,0x72,0x77,0x61,0x72,0x64,0x29,0x29,0x29,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x5f,0x31,0x35,0x30,0x2e,0x53,0x74,0x6f,0x72,0x65,0x28,0x67,0x6c,
-    0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,
-    0x6e,0x49,0x44,0x2e,0x78,0x20,0x2a,0x20,0x34,0x20,0x2b,0x20,0x30,0x2c,0x20,0x67,
-    0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,
-    0x6f,0x6e,0x49,0x44,0x2e,0x78,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x5b,0x6e,0x75,0x6d,
-    0x74,0x68,0x72,0x65,0x61,0x64,0x73,0x28,0x32,0x35,0x36,0x2c,0x20,0x31,0x2c,0x20,
-    0x31,0x29,0x5d,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x53,0x50,
-    0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x20,
-    0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x29,0x0a,0x7b,0x0a,0x20,
-    0x20,0x20,0x20,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,
-    0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,
-    0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,
-    0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x63,0x6f,0x6d,0x70,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x3b,0x0a,0x7d,
-    0x0a,0x00,
+    0x6e,0x49,0x44,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6d,0x70,0x5f,0x6d,0x61,
+    0x69,0x6e,0x28,0x29,0x3b,0x0a,0x7d,0x0a,0x00,
 };
 /*
     #pragma clang diagnostic ignored "-Wmissing-prototypes"
@@ -655,14 +853,20 @@ static const uint8_t depth_calc_source_hlsl5[2162] = {
         float _pad0;
         packed_float3 camera_forward;
         float _pad1;
-        packed_float3 bounds_min;
-        float _pad2;
-        packed_float3 bounds_size;
         int splat_count;
-        int texture_width;
-        int texture_height;
-        int splats_per_layer;
-        float _pad3;
+        int sort_count;
+        int use_active_indices;
+        int sentinel_index;
+    };
+
+    struct PositionWord
+    {
+        uint value;
+    };
+
+    struct position_buffer
+    {
+        PositionWord position_words[1];
     };
 
     struct DepthValue
@@ -685,32 +889,51 @@ static const uint8_t depth_calc_source_hlsl5[2162] = {
         DepthIndexData indices[1];
     };
 
+    struct ActiveIndex
+    {
+        uint value;
+    };
+
+    struct active_input
+    {
+        ActiveIndex active_indices[1];
+    };
+
     constant uint3 gl_WorkGroupSize [[maybe_unused]] = uint3(256u, 1u, 1u);
 
     static inline __attribute__((always_inline))
-    float3 unpack_position(thread const uint& splat_idx, constant depth_params& _22, texture2d_array<uint> splat_texture, sampler splat_sampler)
-    {
-        int _27 = int(splat_idx) / _22.splats_per_layer;
-        int _35 = int(splat_idx) - (_27 * _22.splats_per_layer);
-        int3 _64 = int3(_35 % _22.texture_width, _35 / _22.texture_width, _27);
-        uint4 _67 = splat_texture.read(uint2(_64.xy), uint(_64.z), 0);
-        uint _72 = _67.x;
-        return float3(_22.bounds_min) + ((float3(float((_72 >> 16u) & 65535u), float(_72 & 65535u), float((_67.y >> 16u) & 65535u)) * 1.525902189314365386962890625e-05) * float3(_22.bounds_size));
+    float3 unpack_position(thread const uint& splat_idx, const device position_buffer& _58, texture2d<float> chunk_texture, sampler splat_sampler)
+    {
+        uint _31 = (splat_idx * 3u) >> 1u;
+        uint _38 = _58.position_words[_31].value;
+        uint _44 = _58.position_words[_31 + 1u].value;
+        uint3 _71 = ((splat_idx & 1u) == 0u) ? uint3(_38 & 65535u, _38 >> 16u, _44 & 65535u) : uint3(_38 >> 16u, _44 & 65535u, _44 >> 16u);
+        int _83 = int(splat_idx) / 256;
+        int2 _96 = int2((_83 % 1024) * 2, _83 / 1024);
+        float3 _105 = chunk_texture.read(uint2(_96), 0).xyz;
+        return _105 + ((float3(_71) * 1.525902189314365386962890625e-05) * (chunk_texture.read(uint2(_96 + int2(1, 0)), 0).xyz - _105));
     }
 
-    kernel void main0(constant depth_params& _22 [[buffer(0)]], device depth_output& _141 [[buffer(8)]], device index_output& _150 [[buffer(9)]], texture2d_array<uint> splat_texture [[texture(0)]], sampler splat_sampler [[sampler(2)]], uint3 gl_GlobalInvocationID [[thread_position_in_grid]])
+    kernel void main0(constant depth_params& _22 [[buffer(0)]], const device position_buffer& _58 [[buffer(11)]], device depth_output& _170 [[buffer(8)]], device index_output& _180 [[buffer(9)]], const device active_input& _195 [[buffer(10)]], texture2d<float> chunk_texture [[texture(0)]], sampler splat_sampler [[sampler(2)]], uint3 gl_GlobalInvocationID [[thread_position_in_grid]])
     {
+        if (int(gl_GlobalInvocationID.x) >= _22.sort_count)
+        {
+            return;
+        }
         if (int(gl_GlobalInvocationID.x) >= _22.splat_count)
         {
+            _170.depths[_22.sentinel_index].value = -3.4028230607370965056222438961717e+38;
+            _180.indices[gl_GlobalInvocationID.x].value = uint(_22.sentinel_index);
             return;
         }
-        uint param = gl_GlobalInvocationID.x;
-        _141.depths[gl_GlobalInvocationID.x].value = dot(unpack_position(param, _22, splat_texture, splat_sampler) - float3(_22.camera_position), float3(_22.camera_forward));
-        _150.indices[gl_GlobalInvocationID.x].value = gl_GlobalInvocationID.x;
+        uint _156 = (_22.use_active_indices != 0) ? _195.active_indices[gl_GlobalInvocationID.x].value : gl_GlobalInvocationID.x;
+        uint param = _156;
+        _170.depths[_156].value = dot(unpack_position(param, _58, chunk_texture, splat_sampler) - float3(_22.camera_position), float3(_22.camera_forward));
+        _180.indices[gl_GlobalInvocationID.x].value = _156;
     }
 
 */
-static const uint8_t depth_calc_source_metal_macos[2145] = {
+static const uint8_t depth_calc_source_metal_macos[2751] = {
     0x23,0x70,0x72,0x61,0x67,0x6d,0x61,0x20,0x63,0x6c,0x61,0x6e,0x67,0x20,0x64,0x69,
     0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x20,0x69,0x67,0x6e,0x6f,0x72,0x65,0x64,
     0x20,0x22,0x2d,0x57,0x6d,0x69,0x73,0x73,0x69,0x6e,0x67,0x2d,0x70,0x72,0x6f,0x74,
@@ -733,119 +956,156 @@ static const uint8_t depth_calc_source_metal_macos[2145] = {
     0x20,0x20,0x20,0x70,0x61,0x63,0x6b,0x65,0x64,0x5f,0x66,0x6c,0x6f,0x61,0x74,0x33,
     0x20,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x66,0x6f,0x72,0x77,0x61,0x72,0x64,0x3b,
     0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x70,0x61,0x64,0x31,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x70,0x61,0x63,0x6b,0x65,0x64,0x5f,0x66,0x6c,0x6f,
-    0x61,0x74,0x33,0x20,0x62,0x6f,0x75,0x6e,0x64,0x73,0x5f,0x6d,0x69,0x6e,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x70,0x61,0x64,0x32,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x70,0x61,0x63,0x6b,0x65,0x64,0x5f,0x66,0x6c,0x6f,0x61,
-    0x74,0x33,0x20,0x62,0x6f,0x75,0x6e,0x64,0x73,0x5f,0x73,0x69,0x7a,0x65,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x63,0x6f,
-    0x75,0x6e,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x74,0x65,0x78,
-    0x74,0x75,0x72,0x65,0x5f,0x77,0x69,0x64,0x74,0x68,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x69,0x6e,0x74,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x68,0x65,0x69,0x67,
-    0x68,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x73,0x70,0x6c,0x61,
-    0x74,0x73,0x5f,0x70,0x65,0x72,0x5f,0x6c,0x61,0x79,0x65,0x72,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x70,0x61,0x64,0x33,0x3b,0x0a,0x7d,
-    0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x44,0x65,0x70,0x74,0x68,0x56,
-    0x61,0x6c,0x75,0x65,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
-    0x20,0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,
-    0x63,0x74,0x20,0x64,0x65,0x70,0x74,0x68,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x0a,
-    0x7b,0x0a,0x20,0x20,0x20,0x20,0x44,0x65,0x70,0x74,0x68,0x56,0x61,0x6c,0x75,0x65,
-    0x20,0x64,0x65,0x70,0x74,0x68,0x73,0x5b,0x31,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,
-    0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x44,0x65,0x70,0x74,0x68,0x49,0x6e,0x64,0x65,
-    0x78,0x44,0x61,0x74,0x61,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,
-    0x20,0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,
-    0x63,0x74,0x20,0x69,0x6e,0x64,0x65,0x78,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x0a,
-    0x7b,0x0a,0x20,0x20,0x20,0x20,0x44,0x65,0x70,0x74,0x68,0x49,0x6e,0x64,0x65,0x78,
-    0x44,0x61,0x74,0x61,0x20,0x69,0x6e,0x64,0x69,0x63,0x65,0x73,0x5b,0x31,0x5d,0x3b,
-    0x0a,0x7d,0x3b,0x0a,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x75,0x69,
-    0x6e,0x74,0x33,0x20,0x67,0x6c,0x5f,0x57,0x6f,0x72,0x6b,0x47,0x72,0x6f,0x75,0x70,
-    0x53,0x69,0x7a,0x65,0x20,0x5b,0x5b,0x6d,0x61,0x79,0x62,0x65,0x5f,0x75,0x6e,0x75,
-    0x73,0x65,0x64,0x5d,0x5d,0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,0x33,0x28,0x32,0x35,
-    0x36,0x75,0x2c,0x20,0x31,0x75,0x2c,0x20,0x31,0x75,0x29,0x3b,0x0a,0x0a,0x73,0x74,
-    0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,
-    0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,
-    0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,
-    0x33,0x20,0x75,0x6e,0x70,0x61,0x63,0x6b,0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,
-    0x6e,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x75,
-    0x69,0x6e,0x74,0x26,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x69,0x64,0x78,0x2c,0x20,
-    0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x64,0x65,0x70,0x74,0x68,0x5f,0x70,
-    0x61,0x72,0x61,0x6d,0x73,0x26,0x20,0x5f,0x32,0x32,0x2c,0x20,0x74,0x65,0x78,0x74,
-    0x75,0x72,0x65,0x32,0x64,0x5f,0x61,0x72,0x72,0x61,0x79,0x3c,0x75,0x69,0x6e,0x74,
-    0x3e,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2c,
-    0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x73,
-    0x61,0x6d,0x70,0x6c,0x65,0x72,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,
-    0x74,0x20,0x5f,0x32,0x37,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,0x73,0x70,0x6c,0x61,
-    0x74,0x5f,0x69,0x64,0x78,0x29,0x20,0x2f,0x20,0x5f,0x32,0x32,0x2e,0x73,0x70,0x6c,
-    0x61,0x74,0x73,0x5f,0x70,0x65,0x72,0x5f,0x6c,0x61,0x79,0x65,0x72,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x5f,0x33,0x35,0x20,0x3d,0x20,0x69,0x6e,0x74,
-    0x28,0x73,0x70,0x6c,0x61,0x74,0x5f,0x69,0x64,0x78,0x29,0x20,0x2d,0x20,0x28,0x5f,
-    0x32,0x37,0x20,0x2a,0x20,0x5f,0x32,0x32,0x2e,0x73,0x70,0x6c,0x61,0x74,0x73,0x5f,
-    0x70,0x65,0x72,0x5f,0x6c,0x61,0x79,0x65,0x72,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x69,0x6e,0x74,0x33,0x20,0x5f,0x36,0x34,0x20,0x3d,0x20,0x69,0x6e,0x74,0x33,0x28,
-    0x5f,0x33,0x35,0x20,0x25,0x20,0x5f,0x32,0x32,0x2e,0x74,0x65,0x78,0x74,0x75,0x72,
-    0x65,0x5f,0x77,0x69,0x64,0x74,0x68,0x2c,0x20,0x5f,0x33,0x35,0x20,0x2f,0x20,0x5f,
-    0x32,0x32,0x2e,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x77,0x69,0x64,0x74,0x68,
-    0x2c,0x20,0x5f,0x32,0x37,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,
-    0x34,0x20,0x5f,0x36,0x37,0x20,0x3d,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x74,0x65,
-    0x78,0x74,0x75,0x72,0x65,0x2e,0x72,0x65,0x61,0x64,0x28,0x75,0x69,0x6e,0x74,0x32,
-    0x28,0x5f,0x36,0x34,0x2e,0x78,0x79,0x29,0x2c,0x20,0x75,0x69,0x6e,0x74,0x28,0x5f,
-    0x36,0x34,0x2e,0x7a,0x29,0x2c,0x20,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,
-    0x69,0x6e,0x74,0x20,0x5f,0x37,0x32,0x20,0x3d,0x20,0x5f,0x36,0x37,0x2e,0x78,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x33,0x28,0x5f,0x32,0x32,0x2e,0x62,0x6f,0x75,0x6e,0x64,0x73,0x5f,0x6d,0x69,
-    0x6e,0x29,0x20,0x2b,0x20,0x28,0x28,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x66,0x6c,
-    0x6f,0x61,0x74,0x28,0x28,0x5f,0x37,0x32,0x20,0x3e,0x3e,0x20,0x31,0x36,0x75,0x29,
-    0x20,0x26,0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x28,0x5f,0x37,0x32,0x20,0x26,0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x2c,
-    0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x28,0x5f,0x36,0x37,0x2e,0x79,0x20,0x3e,0x3e,
-    0x20,0x31,0x36,0x75,0x29,0x20,0x26,0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x29,
-    0x20,0x2a,0x20,0x31,0x2e,0x35,0x32,0x35,0x39,0x30,0x32,0x31,0x38,0x39,0x33,0x31,
-    0x34,0x33,0x36,0x35,0x33,0x38,0x36,0x39,0x36,0x32,0x38,0x39,0x30,0x36,0x32,0x35,
-    0x65,0x2d,0x30,0x35,0x29,0x20,0x2a,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x5f,
-    0x32,0x32,0x2e,0x62,0x6f,0x75,0x6e,0x64,0x73,0x5f,0x73,0x69,0x7a,0x65,0x29,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,
+    0x63,0x6f,0x75,0x6e,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x73,
+    0x6f,0x72,0x74,0x5f,0x63,0x6f,0x75,0x6e,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,
+    0x6e,0x74,0x20,0x75,0x73,0x65,0x5f,0x61,0x63,0x74,0x69,0x76,0x65,0x5f,0x69,0x6e,
+    0x64,0x69,0x63,0x65,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x73,
+    0x65,0x6e,0x74,0x69,0x6e,0x65,0x6c,0x5f,0x69,0x6e,0x64,0x65,0x78,0x3b,0x0a,0x7d,
+    0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x50,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x57,0x6f,0x72,0x64,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,
+    0x74,0x20,0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,
+    0x75,0x63,0x74,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x62,0x75,0x66,
+    0x66,0x65,0x72,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x50,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x57,0x6f,0x72,0x64,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,
+    0x77,0x6f,0x72,0x64,0x73,0x5b,0x31,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,
+    0x72,0x75,0x63,0x74,0x20,0x44,0x65,0x70,0x74,0x68,0x56,0x61,0x6c,0x75,0x65,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x61,0x6c,0x75,
+    0x65,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x64,0x65,
+    0x70,0x74,0x68,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x44,0x65,0x70,0x74,0x68,0x56,0x61,0x6c,0x75,0x65,0x20,0x64,0x65,0x70,0x74,
+    0x68,0x73,0x5b,0x31,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,
+    0x74,0x20,0x44,0x65,0x70,0x74,0x68,0x49,0x6e,0x64,0x65,0x78,0x44,0x61,0x74,0x61,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x76,0x61,0x6c,0x75,
+    0x65,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x69,0x6e,
+    0x64,0x65,0x78,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x44,0x65,0x70,0x74,0x68,0x49,0x6e,0x64,0x65,0x78,0x44,0x61,0x74,0x61,0x20,
+    0x69,0x6e,0x64,0x69,0x63,0x65,0x73,0x5b,0x31,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,
+    0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x41,0x63,0x74,0x69,0x76,0x65,0x49,0x6e,0x64,
+    0x65,0x78,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x76,0x61,
+    0x6c,0x75,0x65,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,
+    0x61,0x63,0x74,0x69,0x76,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x41,0x63,0x74,0x69,0x76,0x65,0x49,0x6e,0x64,0x65,0x78,0x20,0x61,
+    0x63,0x74,0x69,0x76,0x65,0x5f,0x69,0x6e,0x64,0x69,0x63,0x65,0x73,0x5b,0x31,0x5d,
+    0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x75,
+    0x69,0x6e,0x74,0x33,0x20,0x67,0x6c,0x5f,0x57,0x6f,0x72,0x6b,0x47,0x72,0x6f,0x75,
+    0x70,0x53,0x69,0x7a,0x65,0x20,0x5b,0x5b,0x6d,0x61,0x79,0x62,0x65,0x5f,0x75,0x6e,
+    0x75,0x73,0x65,0x64,0x5d,0x5d,0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,0x33,0x28,0x32,
+    0x35,0x36,0x75,0x2c,0x20,0x31,0x75,0x2c,0x20,0x31,0x75,0x29,0x3b,0x0a,0x0a,0x73,
+    0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,
+    0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,
+    0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,
+    0x74,0x33,0x20,0x75,0x6e,0x70,0x61,0x63,0x6b,0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,
+    0x75,0x69,0x6e,0x74,0x26,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x69,0x64,0x78,0x2c,
+    0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x70,0x6f,
+    0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x62,0x75,0x66,0x66,0x65,0x72,0x26,0x20,0x5f,
+    0x35,0x38,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,
+    0x6f,0x61,0x74,0x3e,0x20,0x63,0x68,0x75,0x6e,0x6b,0x5f,0x74,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x73,0x70,0x6c,0x61,
+    0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,0x33,0x31,0x20,0x3d,0x20,0x28,0x73,0x70,0x6c,
+    0x61,0x74,0x5f,0x69,0x64,0x78,0x20,0x2a,0x20,0x33,0x75,0x29,0x20,0x3e,0x3e,0x20,
+    0x31,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,0x33,0x38,
+    0x20,0x3d,0x20,0x5f,0x35,0x38,0x2e,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,
+    0x77,0x6f,0x72,0x64,0x73,0x5b,0x5f,0x33,0x31,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,0x34,0x34,0x20,0x3d,
+    0x20,0x5f,0x35,0x38,0x2e,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x77,0x6f,
+    0x72,0x64,0x73,0x5b,0x5f,0x33,0x31,0x20,0x2b,0x20,0x31,0x75,0x5d,0x2e,0x76,0x61,
+    0x6c,0x75,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x33,0x20,0x5f,
+    0x37,0x31,0x20,0x3d,0x20,0x28,0x28,0x73,0x70,0x6c,0x61,0x74,0x5f,0x69,0x64,0x78,
+    0x20,0x26,0x20,0x31,0x75,0x29,0x20,0x3d,0x3d,0x20,0x30,0x75,0x29,0x20,0x3f,0x20,
+    0x75,0x69,0x6e,0x74,0x33,0x28,0x5f,0x33,0x38,0x20,0x26,0x20,0x36,0x35,0x35,0x33,
+    0x35,0x75,0x2c,0x20,0x5f,0x33,0x38,0x20,0x3e,0x3e,0x20,0x31,0x36,0x75,0x2c,0x20,
+    0x5f,0x34,0x34,0x20,0x26,0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x20,0x3a,0x20,
+    0x75,0x69,0x6e,0x74,0x33,0x28,0x5f,0x33,0x38,0x20,0x3e,0x3e,0x20,0x31,0x36,0x75,
+    0x2c,0x20,0x5f,0x34,0x34,0x20,0x26,0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x2c,0x20,
+    0x5f,0x34,0x34,0x20,0x3e,0x3e,0x20,0x31,0x36,0x75,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x69,0x6e,0x74,0x20,0x5f,0x38,0x33,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,0x73,
+    0x70,0x6c,0x61,0x74,0x5f,0x69,0x64,0x78,0x29,0x20,0x2f,0x20,0x32,0x35,0x36,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x32,0x20,0x5f,0x39,0x36,0x20,0x3d,0x20,
+    0x69,0x6e,0x74,0x32,0x28,0x28,0x5f,0x38,0x33,0x20,0x25,0x20,0x31,0x30,0x32,0x34,
+    0x29,0x20,0x2a,0x20,0x32,0x2c,0x20,0x5f,0x38,0x33,0x20,0x2f,0x20,0x31,0x30,0x32,
+    0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,
+    0x31,0x30,0x35,0x20,0x3d,0x20,0x63,0x68,0x75,0x6e,0x6b,0x5f,0x74,0x65,0x78,0x74,
+    0x75,0x72,0x65,0x2e,0x72,0x65,0x61,0x64,0x28,0x75,0x69,0x6e,0x74,0x32,0x28,0x5f,
+    0x39,0x36,0x29,0x2c,0x20,0x30,0x29,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5f,0x31,0x30,0x35,0x20,0x2b,0x20,0x28,
+    0x28,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x5f,0x37,0x31,0x29,0x20,0x2a,0x20,0x31,
+    0x2e,0x35,0x32,0x35,0x39,0x30,0x32,0x31,0x38,0x39,0x33,0x31,0x34,0x33,0x36,0x35,
+    0x33,0x38,0x36,0x39,0x36,0x32,0x38,0x39,0x30,0x36,0x32,0x35,0x65,0x2d,0x30,0x35,
+    0x29,0x20,0x2a,0x20,0x28,0x63,0x68,0x75,0x6e,0x6b,0x5f,0x74,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x2e,0x72,0x65,0x61,0x64,0x28,0x75,0x69,0x6e,0x74,0x32,0x28,0x5f,0x39,
+    0x36,0x20,0x2b,0x20,0x69,0x6e,0x74,0x32,0x28,0x31,0x2c,0x20,0x30,0x29,0x29,0x2c,
+    0x20,0x30,0x29,0x2e,0x78,0x79,0x7a,0x20,0x2d,0x20,0x5f,0x31,0x30,0x35,0x29,0x29,
     0x3b,0x0a,0x7d,0x0a,0x0a,0x6b,0x65,0x72,0x6e,0x65,0x6c,0x20,0x76,0x6f,0x69,0x64,
     0x20,0x6d,0x61,0x69,0x6e,0x30,0x28,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,
     0x64,0x65,0x70,0x74,0x68,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x26,0x20,0x5f,0x32,
     0x32,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x30,0x29,0x5d,0x5d,0x2c,
-    0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x64,0x65,0x70,0x74,0x68,0x5f,0x6f,0x75,
-    0x74,0x70,0x75,0x74,0x26,0x20,0x5f,0x31,0x34,0x31,0x20,0x5b,0x5b,0x62,0x75,0x66,
-    0x66,0x65,0x72,0x28,0x38,0x29,0x5d,0x5d,0x2c,0x20,0x64,0x65,0x76,0x69,0x63,0x65,
-    0x20,0x69,0x6e,0x64,0x65,0x78,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x26,0x20,0x5f,
-    0x31,0x35,0x30,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x39,0x29,0x5d,
-    0x5d,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x5f,0x61,0x72,0x72,
-    0x61,0x79,0x3c,0x75,0x69,0x6e,0x74,0x3e,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x74,
-    0x65,0x78,0x74,0x75,0x72,0x65,0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
-    0x28,0x30,0x29,0x5d,0x5d,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x73,
-    0x70,0x6c,0x61,0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x5b,0x5b,0x73,
-    0x61,0x6d,0x70,0x6c,0x65,0x72,0x28,0x32,0x29,0x5d,0x5d,0x2c,0x20,0x75,0x69,0x6e,
-    0x74,0x33,0x20,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,
-    0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x20,0x5b,0x5b,0x74,0x68,0x72,0x65,0x61,
-    0x64,0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x69,0x6e,0x5f,0x67,0x72,
-    0x69,0x64,0x5d,0x5d,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,
-    0x69,0x6e,0x74,0x28,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,
-    0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x29,0x20,0x3e,0x3d,0x20,
-    0x5f,0x32,0x32,0x2e,0x73,0x70,0x6c,0x61,0x74,0x5f,0x63,0x6f,0x75,0x6e,0x74,0x29,
-    0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,
-    0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
-    0x20,0x75,0x69,0x6e,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x67,0x6c,
-    0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,
-    0x6e,0x49,0x44,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x5f,0x31,0x34,0x31,0x2e,
-    0x64,0x65,0x70,0x74,0x68,0x73,0x5b,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,
-    0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x5d,0x2e,
-    0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x75,0x6e,0x70,0x61,
-    0x63,0x6b,0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x28,0x70,0x61,0x72,0x61,
-    0x6d,0x2c,0x20,0x5f,0x32,0x32,0x2c,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x74,0x65,
-    0x78,0x74,0x75,0x72,0x65,0x2c,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x73,0x61,0x6d,
-    0x70,0x6c,0x65,0x72,0x29,0x20,0x2d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x5f,
-    0x32,0x32,0x2e,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,
-    0x6f,0x6e,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x5f,0x32,0x32,0x2e,
-    0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x66,0x6f,0x72,0x77,0x61,0x72,0x64,0x29,0x29,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x5f,0x31,0x35,0x30,0x2e,0x69,0x6e,0x64,0x69,0x63,
-    0x65,0x73,0x5b,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,
-    0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x5d,0x2e,0x76,0x61,0x6c,0x75,
-    0x65,0x20,0x3d,0x20,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,
-    0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x3b,0x0a,0x7d,0x0a,0x0a,
-    0x00,
+    0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x70,0x6f,
+    0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x62,0x75,0x66,0x66,0x65,0x72,0x26,0x20,0x5f,
+    0x35,0x38,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x31,0x31,0x29,0x5d,
+    0x5d,0x2c,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x64,0x65,0x70,0x74,0x68,0x5f,
+    0x6f,0x75,0x74,0x70,0x75,0x74,0x26,0x20,0x5f,0x31,0x37,0x30,0x20,0x5b,0x5b,0x62,
+    0x75,0x66,0x66,0x65,0x72,0x28,0x38,0x29,0x5d,0x5d,0x2c,0x20,0x64,0x65,0x76,0x69,
+    0x63,0x65,0x20,0x69,0x6e,0x64,0x65,0x78,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x26,
+    0x20,0x5f,0x31,0x38,0x30,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x39,
+    0x29,0x5d,0x5d,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x64,0x65,0x76,0x69,0x63,
+    0x65,0x20,0x61,0x63,0x74,0x69,0x76,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x26,0x20,
+    0x5f,0x31,0x39,0x35,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x31,0x30,
+    0x29,0x5d,0x5d,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,
+    0x6c,0x6f,0x61,0x74,0x3e,0x20,0x63,0x68,0x75,0x6e,0x6b,0x5f,0x74,0x65,0x78,0x74,
+    0x75,0x72,0x65,0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x30,0x29,
+    0x5d,0x5d,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x73,0x70,0x6c,0x61,
+    0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x5b,0x5b,0x73,0x61,0x6d,0x70,
+    0x6c,0x65,0x72,0x28,0x32,0x29,0x5d,0x5d,0x2c,0x20,0x75,0x69,0x6e,0x74,0x33,0x20,
+    0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,
+    0x69,0x6f,0x6e,0x49,0x44,0x20,0x5b,0x5b,0x74,0x68,0x72,0x65,0x61,0x64,0x5f,0x70,
+    0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x69,0x6e,0x5f,0x67,0x72,0x69,0x64,0x5d,
+    0x5d,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x6e,0x74,
+    0x28,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,
+    0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x29,0x20,0x3e,0x3d,0x20,0x5f,0x32,0x32,
+    0x2e,0x73,0x6f,0x72,0x74,0x5f,0x63,0x6f,0x75,0x6e,0x74,0x29,0x0a,0x20,0x20,0x20,
+    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,
+    0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
+    0x28,0x69,0x6e,0x74,0x28,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,
+    0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x29,0x20,0x3e,0x3d,
+    0x20,0x5f,0x32,0x32,0x2e,0x73,0x70,0x6c,0x61,0x74,0x5f,0x63,0x6f,0x75,0x6e,0x74,
+    0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x5f,0x31,0x37,0x30,0x2e,0x64,0x65,0x70,0x74,0x68,0x73,0x5b,0x5f,0x32,0x32,0x2e,
+    0x73,0x65,0x6e,0x74,0x69,0x6e,0x65,0x6c,0x5f,0x69,0x6e,0x64,0x65,0x78,0x5d,0x2e,
+    0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x2d,0x33,0x2e,0x34,0x30,0x32,0x38,0x32,
+    0x33,0x30,0x36,0x30,0x37,0x33,0x37,0x30,0x39,0x36,0x35,0x30,0x35,0x36,0x32,0x32,
+    0x32,0x34,0x33,0x38,0x39,0x36,0x31,0x37,0x31,0x37,0x65,0x2b,0x33,0x38,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x31,0x38,0x30,0x2e,0x69,0x6e,0x64,
+    0x69,0x63,0x65,0x73,0x5b,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,
+    0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x5d,0x2e,0x76,0x61,
+    0x6c,0x75,0x65,0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,0x28,0x5f,0x32,0x32,0x2e,0x73,
+    0x65,0x6e,0x74,0x69,0x6e,0x65,0x6c,0x5f,0x69,0x6e,0x64,0x65,0x78,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,
+    0x31,0x35,0x36,0x20,0x3d,0x20,0x28,0x5f,0x32,0x32,0x2e,0x75,0x73,0x65,0x5f,0x61,
+    0x63,0x74,0x69,0x76,0x65,0x5f,0x69,0x6e,0x64,0x69,0x63,0x65,0x73,0x20,0x21,0x3d,
+    0x20,0x30,0x29,0x20,0x3f,0x20,0x5f,0x31,0x39,0x35,0x2e,0x61,0x63,0x74,0x69,0x76,
+    0x65,0x5f,0x69,0x6e,0x64,0x69,0x63,0x65,0x73,0x5b,0x67,0x6c,0x5f,0x47,0x6c,0x6f,
+    0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,
+    0x78,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3a,0x20,0x67,0x6c,0x5f,0x47,0x6c,
+    0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,
+    0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x20,0x3d,0x20,0x5f,0x31,0x35,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x5f,
+    0x31,0x37,0x30,0x2e,0x64,0x65,0x70,0x74,0x68,0x73,0x5b,0x5f,0x31,0x35,0x36,0x5d,
+    0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x75,0x6e,0x70,
+    0x61,0x63,0x6b,0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x28,0x70,0x61,0x72,
+    0x61,0x6d,0x2c,0x20,0x5f,0x35,0x38,0x2c,0x20,0x63,0x68,0x75,0x6e,0x6b,0x5f,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x2c,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x73,0x61,
+    0x6d,0x70,0x6c,0x65,0x72,0x29,0x20,0x2d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,
+    0x5f,0x32,0x32,0x2e,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x70,0x6f,0x73,0x69,0x74,
+    0x69,0x6f,0x6e,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x5f,0x32,0x32,
+    0x2e,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x66,0x6f,0x72,0x77,0x61,0x72,0x64,0x29,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x5f,0x31,0x38,0x30,0x2e,0x69,0x6e,0x64,0x69,
+    0x63,0x65,0x73,0x5b,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,
+    0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x5d,0x2e,0x76,0x61,0x6c,
+    0x75,0x65,0x20,0x3d,0x20,0x5f,0x31,0x35,0x36,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
 };
 /*
     #pragma clang diagnostic ignored "-Wmissing-prototypes"
@@ -865,14 +1125,20 @@ static const uint8_t depth_calc_source_metal_macos[2145] = {
         float _pad0;
         packed_float3 camera_forward;
         float _pad1;
-        packed_float3 bounds_min;
-        float _pad2;
-        packed_float3 bounds_size;
         int splat_count;
-        int texture_width;
-        int texture_height;
-        int splats_per_layer;
-        float _pad3;
+        int sort_count;
+        int use_active_indices;
+        int sentinel_index;
+    };
+
+    struct PositionWord
+    {
+        uint value;
+    };
+
+    struct position_buffer
+    {
+        PositionWord position_words[1];
     };
 
     struct DepthValue
@@ -895,32 +1161,51 @@ static const uint8_t depth_calc_source_metal_macos[2145] = {
         DepthIndexData indices[1];
     };
 
+    struct ActiveIndex
+    {
+        uint value;
+    };
+
+    struct active_input
+    {
+        ActiveIndex active_indices[1];
+    };
+
     constant uint3 gl_WorkGroupSize [[maybe_unused]] = uint3(256u, 1u, 1u);
 
     static inline __attribute__((always_inline))
-    float3 unpack_position(thread const uint& splat_idx, constant depth_params& _22, texture2d_array<uint> splat_texture, sampler splat_sampler)
-    {
-        int _27 = int(splat_idx) / _22.splats_per_layer;
-        int _35 = int(splat_idx) - (_27 * _22.splats_per_layer);
-        int3 _64 = int3(_35 % _22.texture_width, _35 / _22.texture_width, _27);
-        uint4 _67 = splat_texture.read(uint2(_64.xy), uint(_64.z), 0);
-        uint _72 = _67.x;
-        return float3(_22.bounds_min) + ((float3(float((_72 >> 16u) & 65535u), float(_72 & 65535u), float((_67.y >> 16u) & 65535u)) * 1.525902189314365386962890625e-05) * float3(_22.bounds_size));
+    float3 unpack_position(thread const uint& splat_idx, const device position_buffer& _58, texture2d<float> chunk_texture, sampler splat_sampler)
+    {
+        uint _31 = (splat_idx * 3u) >> 1u;
+        uint _38 = _58.position_words[_31].value;
+        uint _44 = _58.position_words[_31 + 1u].value;
+        uint3 _71 = ((splat_idx & 1u) == 0u) ? uint3(_38 & 65535u, _38 >> 16u, _44 & 65535u) : uint3(_38 >> 16u, _44 & 65535u, _44 >> 16u);
+        int _83 = int(splat_idx) / 256;
+        int2 _96 = int2((_83 % 1024) * 2, _83 / 1024);
+        float3 _105 = chunk_texture.read(uint2(_96), 0).xyz;
+        return _105 + ((float3(_71) * 1.525902189314365386962890625e-05) * (chunk_texture.read(uint2(_96 + int2(1, 0)), 0).xyz - _105));
     }
 
-    kernel void main0(constant depth_params& _22 [[buffer(0)]], device depth_output& _141 [[buffer(8)]], device index_output& _150 [[buffer(9)]], texture2d_array<uint> splat_texture [[texture(0)]], sampler splat_sampler [[sampler(2)]], uint3 gl_GlobalInvocationID [[thread_position_in_grid]])
+    kernel void main0(constant depth_params& _22 [[buffer(0)]], const device position_buffer& _58 [[buffer(11)]], device depth_output& _170 [[buffer(8)]], device index_output& _180 [[buffer(9)]], const device active_input& _195 [[buffer(10)]], texture2d<float> chunk_texture [[texture(0)]], sampler splat_sampler [[sampler(2)]], uint3 gl_GlobalInvocationID [[thread_position_in_grid]])
     {
+        if (int(gl_GlobalInvocationID.x) >= _22.sort_count)
+        {
+            return;
+        }
         if (int(gl_GlobalInvocationID.x) >= _22.splat_count)
         {
+            _170.depths[_22.sentinel_index].value = -3.4028230607370965056222438961717e+38;
+            _180.indices[gl_GlobalInvocationID.x].value = uint(_22.sentinel_index);
             return;
         }
-        uint param = gl_GlobalInvocationID.x;
-        _141.depths[gl_GlobalInvocationID.x].value = dot(unpack_position(param, _22, splat_texture, splat_sampler) - float3(_22.camera_position), float3(_22.camera_forward));
-        _150.indices[gl_GlobalInvocationID.x].value = gl_GlobalInvocationID.x;
+        uint _156 = (_22.use_active_indices != 0) ? _195.active_indices[gl_GlobalInvocationID.x].value : gl_GlobalInvocationID.x;
+        uint param = _156;
+        _170.depths[_156].value = dot(unpack_position(param, _58, chunk_texture, splat_sampler) - float3(_22.camera_position), float3(_22.camera_forward));
+        _180.indices[gl_GlobalInvocationID.x].value = _156;
     }
 
 */
-static const uint8_t depth_calc_source_metal_ios[2145] = {
+static const uint8_t depth_calc_source_metal_ios[2751] = {
     0x23,0x70,0x72,0x61,0x67,0x6d,0x61,0x20,0x63,0x6c,0x61,0x6e,0x67,0x20,0x64,0x69,
     0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x20,0x69,0x67,0x6e,0x6f,0x72,0x65,0x64,
     0x20,0x22,0x2d,0x57,0x6d,0x69,0x73,0x73,0x69,0x6e,0x67,0x2d,0x70,0x72,0x6f,0x74,
@@ -943,119 +1228,156 @@ static const uint8_t depth_calc_source_metal_ios[2145] = {
     0x20,0x20,0x20,0x70,0x61,0x63,0x6b,0x65,0x64,0x5f,0x66,0x6c,0x6f,0x61,0x74,0x33,
     0x20,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x66,0x6f,0x72,0x77,0x61,0x72,0x64,0x3b,
     0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x70,0x61,0x64,0x31,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x70,0x61,0x63,0x6b,0x65,0x64,0x5f,0x66,0x6c,0x6f,
-    0x61,0x74,0x33,0x20,0x62,0x6f,0x75,0x6e,0x64,0x73,0x5f,0x6d,0x69,0x6e,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x70,0x61,0x64,0x32,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x70,0x61,0x63,0x6b,0x65,0x64,0x5f,0x66,0x6c,0x6f,0x61,
-    0x74,0x33,0x20,0x62,0x6f,0x75,0x6e,0x64,0x73,0x5f,0x73,0x69,0x7a,0x65,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x63,0x6f,
-    0x75,0x6e,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x74,0x65,0x78,
-    0x74,0x75,0x72,0x65,0x5f,0x77,0x69,0x64,0x74,0x68,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x69,0x6e,0x74,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x68,0x65,0x69,0x67,
-    0x68,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x73,0x70,0x6c,0x61,
-    0x74,0x73,0x5f,0x70,0x65,0x72,0x5f,0x6c,0x61,0x79,0x65,0x72,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x70,0x61,0x64,0x33,0x3b,0x0a,0x7d,
-    0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x44,0x65,0x70,0x74,0x68,0x56,
-    0x61,0x6c,0x75,0x65,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
-    0x20,0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,
-    0x63,0x74,0x20,0x64,0x65,0x70,0x74,0x68,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x0a,
-    0x7b,0x0a,0x20,0x20,0x20,0x20,0x44,0x65,0x70,0x74,0x68,0x56,0x61,0x6c,0x75,0x65,
-    0x20,0x64,0x65,0x70,0x74,0x68,0x73,0x5b,0x31,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,
-    0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x44,0x65,0x70,0x74,0x68,0x49,0x6e,0x64,0x65,
-    0x78,0x44,0x61,0x74,0x61,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,
-    0x20,0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,
-    0x63,0x74,0x20,0x69,0x6e,0x64,0x65,0x78,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x0a,
-    0x7b,0x0a,0x20,0x20,0x20,0x20,0x44,0x65,0x70,0x74,0x68,0x49,0x6e,0x64,0x65,0x78,
-    0x44,0x61,0x74,0x61,0x20,0x69,0x6e,0x64,0x69,0x63,0x65,0x73,0x5b,0x31,0x5d,0x3b,
-    0x0a,0x7d,0x3b,0x0a,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x75,0x69,
-    0x6e,0x74,0x33,0x20,0x67,0x6c,0x5f,0x57,0x6f,0x72,0x6b,0x47,0x72,0x6f,0x75,0x70,
-    0x53,0x69,0x7a,0x65,0x20,0x5b,0x5b,0x6d,0x61,0x79,0x62,0x65,0x5f,0x75,0x6e,0x75,
-    0x73,0x65,0x64,0x5d,0x5d,0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,0x33,0x28,0x32,0x35,
-    0x36,0x75,0x2c,0x20,0x31,0x75,0x2c,0x20,0x31,0x75,0x29,0x3b,0x0a,0x0a,0x73,0x74,
-    0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,
-    0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,
-    0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,
-    0x33,0x20,0x75,0x6e,0x70,0x61,0x63,0x6b,0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,
-    0x6e,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x75,
-    0x69,0x6e,0x74,0x26,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x69,0x64,0x78,0x2c,0x20,
-    0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x64,0x65,0x70,0x74,0x68,0x5f,0x70,
-    0x61,0x72,0x61,0x6d,0x73,0x26,0x20,0x5f,0x32,0x32,0x2c,0x20,0x74,0x65,0x78,0x74,
-    0x75,0x72,0x65,0x32,0x64,0x5f,0x61,0x72,0x72,0x61,0x79,0x3c,0x75,0x69,0x6e,0x74,
-    0x3e,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2c,
-    0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x73,
-    0x61,0x6d,0x70,0x6c,0x65,0x72,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,
-    0x74,0x20,0x5f,0x32,0x37,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,0x73,0x70,0x6c,0x61,
-    0x74,0x5f,0x69,0x64,0x78,0x29,0x20,0x2f,0x20,0x5f,0x32,0x32,0x2e,0x73,0x70,0x6c,
-    0x61,0x74,0x73,0x5f,0x70,0x65,0x72,0x5f,0x6c,0x61,0x79,0x65,0x72,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x5f,0x33,0x35,0x20,0x3d,0x20,0x69,0x6e,0x74,
-    0x28,0x73,0x70,0x6c,0x61,0x74,0x5f,0x69,0x64,0x78,0x29,0x20,0x2d,0x20,0x28,0x5f,
-    0x32,0x37,0x20,0x2a,0x20,0x5f,0x32,0x32,0x2e,0x73,0x70,0x6c,0x61,0x74,0x73,0x5f,
-    0x70,0x65,0x72,0x5f,0x6c,0x61,0x79,0x65,0x72,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x69,0x6e,0x74,0x33,0x20,0x5f,0x36,0x34,0x20,0x3d,0x20,0x69,0x6e,0x74,0x33,0x28,
-    0x5f,0x33,0x35,0x20,0x25,0x20,0x5f,0x32,0x32,0x2e,0x74,0x65,0x78,0x74,0x75,0x72,
-    0x65,0x5f,0x77,0x69,0x64,0x74,0x68,0x2c,0x20,0x5f,0x33,0x35,0x20,0x2f,0x20,0x5f,
-    0x32,0x32,0x2e,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x77,0x69,0x64,0x74,0x68,
-    0x2c,0x20,0x5f,0x32,0x37,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,
-    0x34,0x20,0x5f,0x36,0x37,0x20,0x3d,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x74,0x65,
-    0x78,0x74,0x75,0x72,0x65,0x2e,0x72,0x65,0x61,0x64,0x28,0x75,0x69,0x6e,0x74,0x32,
-    0x28,0x5f,0x36,0x34,0x2e,0x78,0x79,0x29,0x2c,0x20,0x75,0x69,0x6e,0x74,0x28,0x5f,
-    0x36,0x34,0x2e,0x7a,0x29,0x2c,0x20,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,
-    0x69,0x6e,0x74,0x20,0x5f,0x37,0x32,0x20,0x3d,0x20,0x5f,0x36,0x37,0x2e,0x78,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x33,0x28,0x5f,0x32,0x32,0x2e,0x62,0x6f,0x75,0x6e,0x64,0x73,0x5f,0x6d,0x69,
-    0x6e,0x29,0x20,0x2b,0x20,0x28,0x28,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x66,0x6c,
-    0x6f,0x61,0x74,0x28,0x28,0x5f,0x37,0x32,0x20,0x3e,0x3e,0x20,0x31,0x36,0x75,0x29,
-    0x20,0x26,0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x28,0x5f,0x37,0x32,0x20,0x26,0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x2c,
-    0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x28,0x5f,0x36,0x37,0x2e,0x79,0x20,0x3e,0x3e,
-    0x20,0x31,0x36,0x75,0x29,0x20,0x26,0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x29,
-    0x20,0x2a,0x20,0x31,0x2e,0x35,0x32,0x35,0x39,0x30,0x32,0x31,0x38,0x39,0x33,0x31,
-    0x34,0x33,0x36,0x35,0x33,0x38,0x36,0x39,0x36,0x32,0x38,0x39,0x30,0x36,0x32,0x35,
-    0x65,0x2d,0x30,0x35,0x29,0x20,0x2a,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x5f,
-    0x32,0x32,0x2e,0x62,0x6f,0x75,0x6e,0x64,0x73,0x5f,0x73,0x69,0x7a,0x65,0x29,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,
+    0x63,0x6f,0x75,0x6e,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x73,
+    0x6f,0x72,0x74,0x5f,0x63,0x6f,0x75,0x6e,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,
+    0x6e,0x74,0x20,0x75,0x73,0x65,0x5f,0x61,0x63,0x74,0x69,0x76,0x65,0x5f,0x69,0x6e,
+    0x64,0x69,0x63,0x65,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x73,
+    0x65,0x6e,0x74,0x69,0x6e,0x65,0x6c,0x5f,0x69,0x6e,0x64,0x65,0x78,0x3b,0x0a,0x7d,
+    0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x50,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x57,0x6f,0x72,0x64,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,
+    0x74,0x20,0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,
+    0x75,0x63,0x74,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x62,0x75,0x66,
+    0x66,0x65,0x72,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x50,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x57,0x6f,0x72,0x64,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,
+    0x77,0x6f,0x72,0x64,0x73,0x5b,0x31,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,
+    0x72,0x75,0x63,0x74,0x20,0x44,0x65,0x70,0x74,0x68,0x56,0x61,0x6c,0x75,0x65,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x61,0x6c,0x75,
+    0x65,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x64,0x65,
+    0x70,0x74,0x68,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x44,0x65,0x70,0x74,0x68,0x56,0x61,0x6c,0x75,0x65,0x20,0x64,0x65,0x70,0x74,
+    0x68,0x73,0x5b,0x31,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,
+    0x74,0x20,0x44,0x65,0x70,0x74,0x68,0x49,0x6e,0x64,0x65,0x78,0x44,0x61,0x74,0x61,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x76,0x61,0x6c,0x75,
+    0x65,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x69,0x6e,
+    0x64,0x65,0x78,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x44,0x65,0x70,0x74,0x68,0x49,0x6e,0x64,0x65,0x78,0x44,0x61,0x74,0x61,0x20,
+    0x69,0x6e,0x64,0x69,0x63,0x65,0x73,0x5b,0x31,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,
+    0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x41,0x63,0x74,0x69,0x76,0x65,0x49,0x6e,0x64,
+    0x65,0x78,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x76,0x61,
+    0x6c,0x75,0x65,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,
+    0x61,0x63,0x74,0x69,0x76,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x41,0x63,0x74,0x69,0x76,0x65,0x49,0x6e,0x64,0x65,0x78,0x20,0x61,
+    0x63,0x74,0x69,0x76,0x65,0x5f,0x69,0x6e,0x64,0x69,0x63,0x65,0x73,0x5b,0x31,0x5d,
+    0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x75,
+    0x69,0x6e,0x74,0x33,0x20,0x67,0x6c,0x5f,0x57,0x6f,0x72,0x6b,0x47,0x72,0x6f,0x75,
+    0x70,0x53,0x69,0x7a,0x65,0x20,0x5b,0x5b,0x6d,0x61,0x79,0x62,0x65,0x5f,0x75,0x6e,
+    0x75,0x73,0x65,0x64,0x5d,0x5d,0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,0x33,0x28,0x32,
+    0x35,0x36,0x75,0x2c,0x20,0x31,0x75,0x2c,0x20,0x31,0x75,0x29,0x3b,0x0a,0x0a,0x73,
+    0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,
+    0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,
+    0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,
+    0x74,0x33,0x20,0x75,0x6e,0x70,0x61,0x63,0x6b,0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,
+    0x75,0x69,0x6e,0x74,0x26,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x69,0x64,0x78,0x2c,
+    0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x70,0x6f,
+    0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x62,0x75,0x66,0x66,0x65,0x72,0x26,0x20,0x5f,
+    0x35,0x38,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,
+    0x6f,0x61,0x74,0x3e,0x20,0x63,0x68,0x75,0x6e,0x6b,0x5f,0x74,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x73,0x70,0x6c,0x61,
+    0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,0x33,0x31,0x20,0x3d,0x20,0x28,0x73,0x70,0x6c,
+    0x61,0x74,0x5f,0x69,0x64,0x78,0x20,0x2a,0x20,0x33,0x75,0x29,0x20,0x3e,0x3e,0x20,
+    0x31,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,0x33,0x38,
+    0x20,0x3d,0x20,0x5f,0x35,0x38,0x2e,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,
+    0x77,0x6f,0x72,0x64,0x73,0x5b,0x5f,0x33,0x31,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,0x34,0x34,0x20,0x3d,
+    0x20,0x5f,0x35,0x38,0x2e,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x77,0x6f,
+    0x72,0x64,0x73,0x5b,0x5f,0x33,0x31,0x20,0x2b,0x20,0x31,0x75,0x5d,0x2e,0x76,0x61,
+    0x6c,0x75,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x33,0x20,0x5f,
+    0x37,0x31,0x20,0x3d,0x20,0x28,0x28,0x73,0x70,0x6c,0x61,0x74,0x5f,0x69,0x64,0x78,
+    0x20,0x26,0x20,0x31,0x75,0x29,0x20,0x3d,0x3d,0x20,0x30,0x75,0x29,0x20,0x3f,0x20,
+    0x75,0x69,0x6e,0x74,0x33,0x28,0x5f,0x33,0x38,0x20,0x26,0x20,0x36,0x35,0x35,0x33,
+    0x35,0x75,0x2c,0x20,0x5f,0x33,0x38,0x20,0x3e,0x3e,0x20,0x31,0x36,0x75,0x2c,0x20,
+    0x5f,0x34,0x34,0x20,0x26,0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x20,0x3a,0x20,
+    0x75,0x69,0x6e,0x74,0x33,0x28,0x5f,0x33,0x38,0x20,0x3e,0x3e,0x20,0x31,0x36,0x75,
+    0x2c,0x20,0x5f,0x34,0x34,0x20,0x26,0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x2c,0x20,
+    0x5f,0x34,0x34,0x20,0x3e,0x3e,0x20,0x31,0x36,0x75,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x69,0x6e,0x74,0x20,0x5f,0x38,0x33,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,0x73,
+    0x70,0x6c,0x61,0x74,0x5f,0x69,0x64,0x78,0x29,0x20,0x2f,0x20,0x32,0x35,0x36,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x32,0x20,0x5f,0x39,0x36,0x20,0x3d,0x20,
+    0x69,0x6e,0x74,0x32,0x28,0x28,0x5f,0x38,0x33,0x20,0x25,0x20,0x31,0x30,0x32,0x34,
+    0x29,0x20,0x2a,0x20,0x32,0x2c,0x20,0x5f,0x38,0x33,0x20,0x2f,0x20,0x31,0x30,0x32,
+    0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,
+    0x31,0x30,0x35,0x20,0x3d,0x20,0x63,0x68,0x75,0x6e,0x6b,0x5f,0x74,0x65,0x78,0x74,
+    0x75,0x72,0x65,0x2e,0x72,0x65,0x61,0x64,0x28,0x75,0x69,0x6e,0x74,0x32,0x28,0x5f,
+    0x39,0x36,0x29,0x2c,0x20,0x30,0x29,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5f,0x31,0x30,0x35,0x20,0x2b,0x20,0x28,
+    0x28,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x5f,0x37,0x31,0x29,0x20,0x2a,0x20,0x31,
+    0x2e,0x35,0x32,0x35,0x39,0x30,0x32,0x31,0x38,0x39,0x33,0x31,0x34,0x33,0x36,0x35,
+    0x33,0x38,0x36,0x39,0x36,0x32,0x38,0x39,0x30,0x36,0x32,0x35,0x65,0x2d,0x30,0x35,
+    0x29,0x20,0x2a,0x20,0x28,0x63,0x68,0x75,0x6e,0x6b,0x5f,0x74,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x2e,0x72,0x65,0x61,0x64,0x28,0x75,0x69,0x6e,0x74,0x32,0x28,0x5f,0x39,
+    0x36,0x20,0x2b,0x20,0x69,0x6e,0x74,0x32,0x28,0x31,0x2c,0x20,0x30,0x29,0x29,0x2c,
+    0x20,0x30,0x29,0x2e,0x78,0x79,0x7a,0x20,0x2d,0x20,0x5f,0x31,0x30,0x35,0x29,0x29,
     0x3b,0x0a,0x7d,0x0a,0x0a,0x6b,0x65,0x72,0x6e,0x65,0x6c,0x20,0x76,0x6f,0x69,0x64,
     0x20,0x6d,0x61,0x69,0x6e,0x30,0x28,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,
     0x64,0x65,0x70,0x74,0x68,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x26,0x20,0x5f,0x32,
     0x32,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x30,0x29,0x5d,0x5d,0x2c,
-    0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x64,0x65,0x70,0x74,0x68,0x5f,0x6f,0x75,
-    0x74,0x70,0x75,0x74,0x26,0x20,0x5f,0x31,0x34,0x31,0x20,0x5b,0x5b,0x62,0x75,0x66,
-    0x66,0x65,0x72,0x28,0x38,0x29,0x5d,0x5d,0x2c,0x20,0x64,0x65,0x76,0x69,0x63,0x65,
-    0x20,0x69,0x6e,0x64,0x65,0x78,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x26,0x20,0x5f,
-    0x31,0x35,0x30,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x39,0x29,0x5d,
-    0x5d,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x5f,0x61,0x72,0x72,
-    0x61,0x79,0x3c,0x75,0x69,0x6e,0x74,0x3e,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x74,
-    0x65,0x78,0x74,0x75,0x72,0x65,0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
-    0x28,0x30,0x29,0x5d,0x5d,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x73,
-    0x70,0x6c,0x61,0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x5b,0x5b,0x73,
-    0x61,0x6d,0x70,0x6c,0x65,0x72,0x28,0x32,0x29,0x5d,0x5d,0x2c,0x20,0x75,0x69,0x6e,
-    0x74,0x33,0x20,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,
-    0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x20,0x5b,0x5b,0x74,0x68,0x72,0x65,0x61,
-    0x64,0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x69,0x6e,0x5f,0x67,0x72,
-    0x69,0x64,0x5d,0x5d,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,
-    0x69,0x6e,0x74,0x28,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,
-    0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x29,0x20,0x3e,0x3d,0x20,
-    0x5f,0x32,0x32,0x2e,0x73,0x70,0x6c,0x61,0x74,0x5f,0x63,0x6f,0x75,0x6e,0x74,0x29,
-    0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,
-    0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
-    0x20,0x75,0x69,0x6e,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x67,0x6c,
-    0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,
-    0x6e,0x49,0x44,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x5f,0x31,0x34,0x31,0x2e,
-    0x64,0x65,0x70,0x74,0x68,0x73,0x5b,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,
-    0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x5d,0x2e,
-    0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x75,0x6e,0x70,0x61,
-    0x63,0x6b,0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x28,0x70,0x61,0x72,0x61,
-    0x6d,0x2c,0x20,0x5f,0x32,0x32,0x2c,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x74,0x65,
-    0x78,0x74,0x75,0x72,0x65,0x2c,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x73,0x61,0x6d,
-    0x70,0x6c,0x65,0x72,0x29,0x20,0x2d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x5f,
-    0x32,0x32,0x2e,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,
-    0x6f,0x6e,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x5f,0x32,0x32,0x2e,
-    0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x66,0x6f,0x72,0x77,0x61,0x72,0x64,0x29,0x29,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x5f,0x31,0x35,0x30,0x2e,0x69,0x6e,0x64,0x69,0x63,
-    0x65,0x73,0x5b,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,
-    0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x5d,0x2e,0x76,0x61,0x6c,0x75,
-    0x65,0x20,0x3d,0x20,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,
-    0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x3b,0x0a,0x7d,0x0a,0x0a,
-    0x00,
+    0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x70,0x6f,
+    0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x62,0x75,0x66,0x66,0x65,0x72,0x26,0x20,0x5f,
+    0x35,0x38,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x31,0x31,0x29,0x5d,
+    0x5d,0x2c,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x64,0x65,0x70,0x74,0x68,0x5f,
+    0x6f,0x75,0x74,0x70,0x75,0x74,0x26,0x20,0x5f,0x31,0x37,0x30,0x20,0x5b,0x5b,0x62,
+    0x75,0x66,0x66,0x65,0x72,0x28,0x38,0x29,0x5d,0x5d,0x2c,0x20,0x64,0x65,0x76,0x69,
+    0x63,0x65,0x20,0x69,0x6e,0x64,0x65,0x78,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x26,
+    0x20,0x5f,0x31,0x38,0x30,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x39,
+    0x29,0x5d,0x5d,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x64,0x65,0x76,0x69,0x63,
+    0x65,0x20,0x61,0x63,0x74,0x69,0x76,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x26,0x20,
+    0x5f,0x31,0x39,0x35,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x31,0x30,
+    0x29,0x5d,0x5d,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,
+    0x6c,0x6f,0x61,0x74,0x3e,0x20,0x63,0x68,0x75,0x6e,0x6b,0x5f,0x74,0x65,0x78,0x74,
+    0x75,0x72,0x65,0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x30,0x29,
+    0x5d,0x5d,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x73,0x70,0x6c,0x61,
+    0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x5b,0x5b,0x73,0x61,0x6d,0x70,
+    0x6c,0x65,0x72,0x28,0x32,0x29,0x5d,0x5d,0x2c,0x20,0x75,0x69,0x6e,0x74,0x33,0x20,
+    0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,
+    0x69,0x6f,0x6e,0x49,0x44,0x20,0x5b,0x5b,0x74,0x68,0x72,0x65,0x61,0x64,0x5f,0x70,
+    0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x69,0x6e,0x5f,0x67,0x72,0x69,0x64,0x5d,
+    0x5d,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x6e,0x74,
+    0x28,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,
+    0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x29,0x20,0x3e,0x3d,0x20,0x5f,0x32,0x32,
+    0x2e,0x73,0x6f,0x72,0x74,0x5f,0x63,0x6f,0x75,0x6e,0x74,0x29,0x0a,0x20,0x20,0x20,
+    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,
+    0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
+    0x28,0x69,0x6e,0x74,0x28,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,
+    0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x29,0x20,0x3e,0x3d,
+    0x20,0x5f,0x32,0x32,0x2e,0x73,0x70,0x6c,0x61,0x74,0x5f,0x63,0x6f,0x75,0x6e,0x74,
+    0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x5f,0x31,0x37,0x30,0x2e,0x64,0x65,0x70,0x74,0x68,0x73,0x5b,0x5f,0x32,0x32,0x2e,
+    0x73,0x65,0x6e,0x74,0x69,0x6e,0x65,0x6c,0x5f,0x69,0x6e,0x64,0x65,0x78,0x5d,0x2e,
+    0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x2d,0x33,0x2e,0x34,0x30,0x32,0x38,0x32,
+    0x33,0x30,0x36,0x30,0x37,0x33,0x37,0x30,0x39,0x36,0x35,0x30,0x35,0x36,0x32,0x32,
+    0x32,0x34,0x33,0x38,0x39,0x36,0x31,0x37,0x31,0x37,0x65,0x2b,0x33,0x38,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x31,0x38,0x30,0x2e,0x69,0x6e,0x64,
+    0x69,0x63,0x65,0x73,0x5b,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,
+    0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x5d,0x2e,0x76,0x61,
+    0x6c,0x75,0x65,0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,0x28,0x5f,0x32,0x32,0x2e,0x73,
+    0x65,0x6e,0x74,0x69,0x6e,0x65,0x6c,0x5f,0x69,0x6e,0x64,0x65,0x78,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,
+    0x31,0x35,0x36,0x20,0x3d,0x20,0x28,0x5f,0x32,0x32,0x2e,0x75,0x73,0x65,0x5f,0x61,
+    0x63,0x74,0x69,0x76,0x65,0x5f,0x69,0x6e,0x64,0x69,0x63,0x65,0x73,0x20,0x21,0x3d,
+    0x20,0x30,0x29,0x20,0x3f,0x20,0x5f,0x31,0x39,0x35,0x2e,0x61,0x63,0x74,0x69,0x76,
+    0x65,0x5f,0x69,0x6e,0x64,0x69,0x63,0x65,0x73,0x5b,0x67,0x6c,0x5f,0x47,0x6c,0x6f,
+    0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,
+    0x78,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3a,0x20,0x67,0x6c,0x5f,0x47,0x6c,
+    0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,
+    0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x20,0x3d,0x20,0x5f,0x31,0x35,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x5f,
+    0x31,0x37,0x30,0x2e,0x64,0x65,0x70,0x74,0x68,0x73,0x5b,0x5f,0x31,0x35,0x36,0x5d,
+    0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x75,0x6e,0x70,
+    0x61,0x63,0x6b,0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x28,0x70,0x61,0x72,
+    0x61,0x6d,0x2c,0x20,0x5f,0x35,0x38,0x2c,0x20,0x63,0x68,0x75,0x6e,0x6b,0x5f,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x2c,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x73,0x61,
+    0x6d,0x70,0x6c,0x65,0x72,0x29,0x20,0x2d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,
+    0x5f,0x32,0x32,0x2e,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x70,0x6f,0x73,0x69,0x74,
+    0x69,0x6f,0x6e,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x5f,0x32,0x32,
+    0x2e,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x66,0x6f,0x72,0x77,0x61,0x72,0x64,0x29,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x5f,0x31,0x38,0x30,0x2e,0x69,0x6e,0x64,0x69,
+    0x63,0x65,0x73,0x5b,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,
+    0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x5d,0x2e,0x76,0x61,0x6c,
+    0x75,0x65,0x20,0x3d,0x20,0x5f,0x31,0x35,0x36,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
 };
 /*
     #pragma clang diagnostic ignored "-Wmissing-prototypes"
@@ -1075,14 +1397,20 @@ static const uint8_t depth_calc_source_metal_ios[2145] = {
         float _pad0;
         packed_float3 camera_forward;
         float _pad1;
-        packed_float3 bounds_min;
-        float _pad2;
-        packed_float3 bounds_size;
         int splat_count;
-        int texture_width;
-        int texture_height;
-        int splats_per_layer;
-        float _pad3;
+        int sort_count;
+        int use_active_indices;
+        int sentinel_index;
+    };
+
+    struct PositionWord
+    {
+        uint value;
+    };
+
+    struct position_buffer
+    {
+        PositionWord position_words[1];
     };
 
     struct DepthValue
@@ -1105,32 +1433,51 @@ static const uint8_t depth_calc_source_metal_ios[2145] = {
         DepthIndexData indices[1];
     };
 
+    struct ActiveIndex
+    {
+        uint value;
+    };
+
+    struct active_input
+    {
+        ActiveIndex active_indices[1];
+    };
+
     constant uint3 gl_WorkGroupSize [[maybe_unused]] = uint3(256u, 1u, 1u);
 
     static inline __attribute__((always_inline))
-    float3 unpack_position(thread const uint& splat_idx, constant depth_params& _22, texture2d_array<uint> splat_texture, sampler splat_sampler)
-    {
-        int _27 = int(splat_idx) / _22.splats_per_layer;
-        int _35 = int(splat_idx) - (_27 * _22.splats_per_layer);
-        int3 _64 = int3(_35 % _22.texture_width, _35 / _22.texture_width, _27);
-        uint4 _67 = splat_texture.read(uint2(_64.xy), uint(_64.z), 0);
-        uint _72 = _67.x;
-        return float3(_22.bounds_min) + ((float3(float((_72 >> 16u) & 65535u), float(_72 & 65535u), float((_67.y >> 16u) & 65535u)) * 1.525902189314365386962890625e-05) * float3(_22.bounds_size));
+    float3 unpack_position(thread const uint& splat_idx, const device position_buffer& _58, texture2d<float> chunk_texture, sampler splat_sampler)
+    {
+        uint _31 = (splat_idx * 3u) >> 1u;
+        uint _38 = _58.position_words[_31].value;
+        uint _44 = _58.position_words[_31 + 1u].value;
+        uint3 _71 = ((splat_idx & 1u) == 0u) ? uint3(_38 & 65535u, _38 >> 16u, _44 & 65535u) : uint3(_38 >> 16u, _44 & 65535u, _44 >> 16u);
+        int _83 = int(splat_idx) / 256;
+        int2 _96 = int2((_83 % 1024) * 2, _83 / 1024);
+        float3 _105 = chunk_texture.read(uint2(_96), 0).xyz;
+        return _105 + ((float3(_71) * 1.525902189314365386962890625e-05) * (chunk_texture.read(uint2(_96 + int2(1, 0)), 0).xyz - _105));
     }
 
-    kernel void main0(constant depth_params& _22 [[buffer(0)]], device depth_output& _141 [[buffer(8)]], device index_output& _150 [[buffer(9)]], texture2d_array<uint> splat_texture [[texture(0)]], sampler splat_sampler [[sampler(2)]], uint3 gl_GlobalInvocationID [[thread_position_in_grid]])
+    kernel void main0(constant depth_params& _22 [[buffer(0)]], const device position_buffer& _58 [[buffer(11)]], device depth_output& _170 [[buffer(8)]], device index_output& _180 [[buffer(9)]], const device active_input& _195 [[buffer(10)]], texture2d<float> chunk_texture [[texture(0)]], sampler splat_sampler [[sampler(2)]], uint3 gl_GlobalInvocationID [[thread_position_in_grid]])
     {
+        if (int(gl_GlobalInvocationID.x) >= _22.sort_count)
+        {
+            return;
+        }
         if (int(gl_GlobalInvocationID.x) >= _22.splat_count)
         {
+            _170.depths[_22.sentinel_index].value = -3.4028230607370965056222438961717e+38;
+            _180.indices[gl_GlobalInvocationID.x].value = uint(_22.sentinel_index);
             return;
         }
-        uint param = gl_GlobalInvocationID.x;
-        _141.depths[gl_GlobalInvocationID.x].value = dot(unpack_position(param, _22, splat_texture, splat_sampler) - float3(_22.camera_position), float3(_22.camera_forward));
-        _150.indices[gl_GlobalInvocationID.x].value = gl_GlobalInvocationID.x;
+        uint _156 = (_22.use_active_indices != 0) ? _195.active_indices[gl_GlobalInvocationID.x].value : gl_GlobalInvocationID.x;
+        uint param = _156;
+        _170.depths[_156].value = dot(unpack_position(param, _58, chunk_texture, splat_sampler) - float3(_22.camera_position), float3(_22.camera_forward));
+        _180.indices[gl_GlobalInvocationID.x].value = _156;
     }
 
 */
-static const uint8_t depth_calc_source_metal_sim[2145] = {
+static const uint8_t depth_calc_source_metal_sim[2751] = {
     0x23,0x70,0x72,0x61,0x67,0x6d,0x61,0x20,0x63,0x6c,0x61,0x6e,0x67,0x20,0x64,0x69,
     0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x20,0x69,0x67,0x6e,0x6f,0x72,0x65,0x64,
     0x20,0x22,0x2d,0x57,0x6d,0x69,0x73,0x73,0x69,0x6e,0x67,0x2d,0x70,0x72,0x6f,0x74,
@@ -1153,119 +1500,156 @@ static const uint8_t depth_calc_source_metal_sim[2145] = {
     0x20,0x20,0x20,0x70,0x61,0x63,0x6b,0x65,0x64,0x5f,0x66,0x6c,0x6f,0x61,0x74,0x33,
     0x20,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x66,0x6f,0x72,0x77,0x61,0x72,0x64,0x3b,
     0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x70,0x61,0x64,0x31,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x70,0x61,0x63,0x6b,0x65,0x64,0x5f,0x66,0x6c,0x6f,
-    0x61,0x74,0x33,0x20,0x62,0x6f,0x75,0x6e,0x64,0x73,0x5f,0x6d,0x69,0x6e,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x70,0x61,0x64,0x32,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x70,0x61,0x63,0x6b,0x65,0x64,0x5f,0x66,0x6c,0x6f,0x61,
-    0x74,0x33,0x20,0x62,0x6f,0x75,0x6e,0x64,0x73,0x5f,0x73,0x69,0x7a,0x65,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x63,0x6f,
-    0x75,0x6e,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x74,0x65,0x78,
-    0x74,0x75,0x72,0x65,0x5f,0x77,0x69,0x64,0x74,0x68,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x69,0x6e,0x74,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x68,0x65,0x69,0x67,
-    0x68,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x73,0x70,0x6c,0x61,
-    0x74,0x73,0x5f,0x70,0x65,0x72,0x5f,0x6c,0x61,0x79,0x65,0x72,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x70,0x61,0x64,0x33,0x3b,0x0a,0x7d,
-    0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x44,0x65,0x70,0x74,0x68,0x56,
-    0x61,0x6c,0x75,0x65,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
-    0x20,0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,
-    0x63,0x74,0x20,0x64,0x65,0x70,0x74,0x68,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x0a,
-    0x7b,0x0a,0x20,0x20,0x20,0x20,0x44,0x65,0x70,0x74,0x68,0x56,0x61,0x6c,0x75,0x65,
-    0x20,0x64,0x65,0x70,0x74,0x68,0x73,0x5b,0x31,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,
-    0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x44,0x65,0x70,0x74,0x68,0x49,0x6e,0x64,0x65,
-    0x78,0x44,0x61,0x74,0x61,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,
-    0x20,0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,
-    0x63,0x74,0x20,0x69,0x6e,0x64,0x65,0x78,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x0a,
-    0x7b,0x0a,0x20,0x20,0x20,0x20,0x44,0x65,0x70,0x74,0x68,0x49,0x6e,0x64,0x65,0x78,
-    0x44,0x61,0x74,0x61,0x20,0x69,0x6e,0x64,0x69,0x63,0x65,0x73,0x5b,0x31,0x5d,0x3b,
-    0x0a,0x7d,0x3b,0x0a,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x75,0x69,
-    0x6e,0x74,0x33,0x20,0x67,0x6c,0x5f,0x57,0x6f,0x72,0x6b,0x47,0x72,0x6f,0x75,0x70,
-    0x53,0x69,0x7a,0x65,0x20,0x5b,0x5b,0x6d,0x61,0x79,0x62,0x65,0x5f,0x75,0x6e,0x75,
-    0x73,0x65,0x64,0x5d,0x5d,0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,0x33,0x28,0x32,0x35,
-    0x36,0x75,0x2c,0x20,0x31,0x75,0x2c,0x20,0x31,0x75,0x29,0x3b,0x0a,0x0a,0x73,0x74,
-    0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,
-    0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,
-    0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,
-    0x33,0x20,0x75,0x6e,0x70,0x61,0x63,0x6b,0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,
-    0x6e,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x75,
-    0x69,0x6e,0x74,0x26,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x69,0x64,0x78,0x2c,0x20,
-    0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x64,0x65,0x70,0x74,0x68,0x5f,0x70,
-    0x61,0x72,0x61,0x6d,0x73,0x26,0x20,0x5f,0x32,0x32,0x2c,0x20,0x74,0x65,0x78,0x74,
-    0x75,0x72,0x65,0x32,0x64,0x5f,0x61,0x72,0x72,0x61,0x79,0x3c,0x75,0x69,0x6e,0x74,
-    0x3e,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2c,
-    0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x73,
-    0x61,0x6d,0x70,0x6c,0x65,0x72,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,
-    0x74,0x20,0x5f,0x32,0x37,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,0x73,0x70,0x6c,0x61,
-    0x74,0x5f,0x69,0x64,0x78,0x29,0x20,0x2f,0x20,0x5f,0x32,0x32,0x2e,0x73,0x70,0x6c,
-    0x61,0x74,0x73,0x5f,0x70,0x65,0x72,0x5f,0x6c,0x61,0x79,0x65,0x72,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x5f,0x33,0x35,0x20,0x3d,0x20,0x69,0x6e,0x74,
-    0x28,0x73,0x70,0x6c,0x61,0x74,0x5f,0x69,0x64,0x78,0x29,0x20,0x2d,0x20,0x28,0x5f,
-    0x32,0x37,0x20,0x2a,0x20,0x5f,0x32,0x32,0x2e,0x73,0x70,0x6c,0x61,0x74,0x73,0x5f,
-    0x70,0x65,0x72,0x5f,0x6c,0x61,0x79,0x65,0x72,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x69,0x6e,0x74,0x33,0x20,0x5f,0x36,0x34,0x20,0x3d,0x20,0x69,0x6e,0x74,0x33,0x28,
-    0x5f,0x33,0x35,0x20,0x25,0x20,0x5f,0x32,0x32,0x2e,0x74,0x65,0x78,0x74,0x75,0x72,
-    0x65,0x5f,0x77,0x69,0x64,0x74,0x68,0x2c,0x20,0x5f,0x33,0x35,0x20,0x2f,0x20,0x5f,
-    0x32,0x32,0x2e,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x77,0x69,0x64,0x74,0x68,
-    0x2c,0x20,0x5f,0x32,0x37,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,
-    0x34,0x20,0x5f,0x36,0x37,0x20,0x3d,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x74,0x65,
-    0x78,0x74,0x75,0x72,0x65,0x2e,0x72,0x65,0x61,0x64,0x28,0x75,0x69,0x6e,0x74,0x32,
-    0x28,0x5f,0x36,0x34,0x2e,0x78,0x79,0x29,0x2c,0x20,0x75,0x69,0x6e,0x74,0x28,0x5f,
-    0x36,0x34,0x2e,0x7a,0x29,0x2c,0x20,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,
-    0x69,0x6e,0x74,0x20,0x5f,0x37,0x32,0x20,0x3d,0x20,0x5f,0x36,0x37,0x2e,0x78,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x33,0x28,0x5f,0x32,0x32,0x2e,0x62,0x6f,0x75,0x6e,0x64,0x73,0x5f,0x6d,0x69,
-    0x6e,0x29,0x20,0x2b,0x20,0x28,0x28,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x66,0x6c,
-    0x6f,0x61,0x74,0x28,0x28,0x5f,0x37,0x32,0x20,0x3e,0x3e,0x20,0x31,0x36,0x75,0x29,
-    0x20,0x26,0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x28,0x5f,0x37,0x32,0x20,0x26,0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x2c,
-    0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x28,0x5f,0x36,0x37,0x2e,0x79,0x20,0x3e,0x3e,
-    0x20,0x31,0x36,0x75,0x29,0x20,0x26,0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x29,
-    0x20,0x2a,0x20,0x31,0x2e,0x35,0x32,0x35,0x39,0x30,0x32,0x31,0x38,0x39,0x33,0x31,
-    0x34,0x33,0x36,0x35,0x33,0x38,0x36,0x39,0x36,0x32,0x38,0x39,0x30,0x36,0x32,0x35,
-    0x65,0x2d,0x30,0x35,0x29,0x20,0x2a,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x5f,
-    0x32,0x32,0x2e,0x62,0x6f,0x75,0x6e,0x64,0x73,0x5f,0x73,0x69,0x7a,0x65,0x29,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,
+    0x63,0x6f,0x75,0x6e,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x73,
+    0x6f,0x72,0x74,0x5f,0x63,0x6f,0x75,0x6e,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,
+    0x6e,0x74,0x20,0x75,0x73,0x65,0x5f,0x61,0x63,0x74,0x69,0x76,0x65,0x5f,0x69,0x6e,
+    0x64,0x69,0x63,0x65,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x73,
+    0x65,0x6e,0x74,0x69,0x6e,0x65,0x6c,0x5f,0x69,0x6e,0x64,0x65,0x78,0x3b,0x0a,0x7d,
+    0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x50,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x57,0x6f,0x72,0x64,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,
+    0x74,0x20,0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,
+    0x75,0x63,0x74,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x62,0x75,0x66,
+    0x66,0x65,0x72,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x50,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x57,0x6f,0x72,0x64,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,
+    0x77,0x6f,0x72,0x64,0x73,0x5b,0x31,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,
+    0x72,0x75,0x63,0x74,0x20,0x44,0x65,0x70,0x74,0x68,0x56,0x61,0x6c,0x75,0x65,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x61,0x6c,0x75,
+    0x65,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x64,0x65,
+    0x70,0x74,0x68,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x44,0x65,0x70,0x74,0x68,0x56,0x61,0x6c,0x75,0x65,0x20,0x64,0x65,0x70,0x74,
+    0x68,0x73,0x5b,0x31,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,
+    0x74,0x20,0x44,0x65,0x70,0x74,0x68,0x49,0x6e,0x64,0x65,0x78,0x44,0x61,0x74,0x61,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x76,0x61,0x6c,0x75,
+    0x65,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x69,0x6e,
+    0x64,0x65,0x78,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x44,0x65,0x70,0x74,0x68,0x49,0x6e,0x64,0x65,0x78,0x44,0x61,0x74,0x61,0x20,
+    0x69,0x6e,0x64,0x69,0x63,0x65,0x73,0x5b,0x31,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,
+    0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x41,0x63,0x74,0x69,0x76,0x65,0x49,0x6e,0x64,
+    0x65,0x78,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x76,0x61,
+    0x6c,0x75,0x65,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,
+    0x61,0x63,0x74,0x69,0x76,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x41,0x63,0x74,0x69,0x76,0x65,0x49,0x6e,0x64,0x65,0x78,0x20,0x61,
+    0x63,0x74,0x69,0x76,0x65,0x5f,0x69,0x6e,0x64,0x69,0x63,0x65,0x73,0x5b,0x31,0x5d,
+    0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x75,
+    0x69,0x6e,0x74,0x33,0x20,0x67,0x6c,0x5f,0x57,0x6f,0x72,0x6b,0x47,0x72,0x6f,0x75,
+    0x70,0x53,0x69,0x7a,0x65,0x20,0x5b,0x5b,0x6d,0x61,0x79,0x62,0x65,0x5f,0x75,0x6e,
+    0x75,0x73,0x65,0x64,0x5d,0x5d,0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,0x33,0x28,0x32,
+    0x35,0x36,0x75,0x2c,0x20,0x31,0x75,0x2c,0x20,0x31,0x75,0x29,0x3b,0x0a,0x0a,0x73,
+    0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,
+    0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,
+    0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,
+    0x74,0x33,0x20,0x75,0x6e,0x70,0x61,0x63,0x6b,0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,
+    0x75,0x69,0x6e,0x74,0x26,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x69,0x64,0x78,0x2c,
+    0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x70,0x6f,
+    0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x62,0x75,0x66,0x66,0x65,0x72,0x26,0x20,0x5f,
+    0x35,0x38,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,
+    0x6f,0x61,0x74,0x3e,0x20,0x63,0x68,0x75,0x6e,0x6b,0x5f,0x74,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x73,0x70,0x6c,0x61,
+    0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,0x33,0x31,0x20,0x3d,0x20,0x28,0x73,0x70,0x6c,
+    0x61,0x74,0x5f,0x69,0x64,0x78,0x20,0x2a,0x20,0x33,0x75,0x29,0x20,0x3e,0x3e,0x20,
+    0x31,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,0x33,0x38,
+    0x20,0x3d,0x20,0x5f,0x35,0x38,0x2e,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,
+    0x77,0x6f,0x72,0x64,0x73,0x5b,0x5f,0x33,0x31,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,0x34,0x34,0x20,0x3d,
+    0x20,0x5f,0x35,0x38,0x2e,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x77,0x6f,
+    0x72,0x64,0x73,0x5b,0x5f,0x33,0x31,0x20,0x2b,0x20,0x31,0x75,0x5d,0x2e,0x76,0x61,
+    0x6c,0x75,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x33,0x20,0x5f,
+    0x37,0x31,0x20,0x3d,0x20,0x28,0x28,0x73,0x70,0x6c,0x61,0x74,0x5f,0x69,0x64,0x78,
+    0x20,0x26,0x20,0x31,0x75,0x29,0x20,0x3d,0x3d,0x20,0x30,0x75,0x29,0x20,0x3f,0x20,
+    0x75,0x69,0x6e,0x74,0x33,0x28,0x5f,0x33,0x38,0x20,0x26,0x20,0x36,0x35,0x35,0x33,
+    0x35,0x75,0x2c,0x20,0x5f,0x33,0x38,0x20,0x3e,0x3e,0x20,0x31,0x36,0x75,0x2c,0x20,
+    0x5f,0x34,0x34,0x20,0x26,0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x20,0x3a,0x20,
+    0x75,0x69,0x6e,0x74,0x33,0x28,0x5f,0x33,0x38,0x20,0x3e,0x3e,0x20,0x31,0x36,0x75,
+    0x2c,0x20,0x5f,0x34,0x34,0x20,0x26,0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x2c,0x20,
+    0x5f,0x34,0x34,0x20,0x3e,0x3e,0x20,0x31,0x36,0x75,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x69,0x6e,0x74,0x20,0x5f,0x38,0x33,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,0x73,
+    0x70,0x6c,0x61,0x74,0x5f,0x69,0x64,0x78,0x29,0x20,0x2f,0x20,0x32,0x35,0x36,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x32,0x20,0x5f,0x39,0x36,0x20,0x3d,0x20,
+    0x69,0x6e,0x74,0x32,0x28,0x28,0x5f,0x38,0x33,0x20,0x25,0x20,0x31,0x30,0x32,0x34,
+    0x29,0x20,0x2a,0x20,0x32,0x2c,0x20,0x5f,0x38,0x33,0x20,0x2f,0x20,0x31,0x30,0x32,
+    0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,
+    0x31,0x30,0x35,0x20,0x3d,0x20,0x63,0x68,0x75,0x6e,0x6b,0x5f,0x74,0x65,0x78,0x74,
+    0x75,0x72,0x65,0x2e,0x72,0x65,0x61,0x64,0x28,0x75,0x69,0x6e,0x74,0x32,0x28,0x5f,
+    0x39,0x36,0x29,0x2c,0x20,0x30,0x29,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5f,0x31,0x30,0x35,0x20,0x2b,0x20,0x28,
+    0x28,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x5f,0x37,0x31,0x29,0x20,0x2a,0x20,0x31,
+    0x2e,0x35,0x32,0x35,0x39,0x30,0x32,0x31,0x38,0x39,0x33,0x31,0x34,0x33,0x36,0x35,
+    0x33,0x38,0x36,0x39,0x36,0x32,0x38,0x39,0x30,0x36,0x32,0x35,0x65,0x2d,0x30,0x35,
+    0x29,0x20,0x2a,0x20,0x28,0x63,0x68,0x75,0x6e,0x6b,0x5f,0x74,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x2e,0x72,0x65,0x61,0x64,0x28,0x75,0x69,0x6e,0x74,0x32,0x28,0x5f,0x39,
+    0x36,0x20,0x2b,0x20,0x69,0x6e,0x74,0x32,0x28,0x31,0x2c,0x20,0x30,0x29,0x29,0x2c,
+    0x20,0x30,0x29,0x2e,0x78,0x79,0x7a,0x20,0x2d,0x20,0x5f,0x31,0x30,0x35,0x29,0x29,
     0x3b,0x0a,0x7d,0x0a,0x0a,0x6b,0x65,0x72,0x6e,0x65,0x6c,0x20,0x76,0x6f,0x69,0x64,
     0x20,0x6d,0x61,0x69,0x6e,0x30,0x28,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,
     0x64,0x65,0x70,0x74,0x68,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x26,0x20,0x5f,0x32,
     0x32,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x30,0x29,0x5d,0x5d,0x2c,
-    0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x64,0x65,0x70,0x74,0x68,0x5f,0x6f,0x75,
-    0x74,0x70,0x75,0x74,0x26,0x20,0x5f,0x31,0x34,0x31,0x20,0x5b,0x5b,0x62,0x75,0x66,
-    0x66,0x65,0x72,0x28,0x38,0x29,0x5d,0x5d,0x2c,0x20,0x64,0x65,0x76,0x69,0x63,0x65,
-    0x20,0x69,0x6e,0x64,0x65,0x78,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x26,0x20,0x5f,
-    0x31,0x35,0x30,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x39,0x29,0x5d,
-    0x5d,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x5f,0x61,0x72,0x72,
-    0x61,0x79,0x3c,0x75,0x69,0x6e,0x74,0x3e,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x74,
-    0x65,0x78,0x74,0x75,0x72,0x65,0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
-    0x28,0x30,0x29,0x5d,0x5d,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x73,
-    0x70,0x6c,0x61,0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x5b,0x5b,0x73,
-    0x61,0x6d,0x70,0x6c,0x65,0x72,0x28,0x32,0x29,0x5d,0x5d,0x2c,0x20,0x75,0x69,0x6e,
-    0x74,0x33,0x20,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,
-    0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x20,0x5b,0x5b,0x74,0x68,0x72,0x65,0x61,
-    0x64,0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x69,0x6e,0x5f,0x67,0x72,
-    0x69,0x64,0x5d,0x5d,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,
-    0x69,0x6e,0x74,0x28,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,
-    0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x29,0x20,0x3e,0x3d,0x20,
-    0x5f,0x32,0x32,0x2e,0x73,0x70,0x6c,0x61,0x74,0x5f,0x63,0x6f,0x75,0x6e,0x74,0x29,
-    0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,
-    0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
-    0x20,0x75,0x69,0x6e,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x67,0x6c,
-    0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,
-    0x6e,0x49,0x44,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x5f,0x31,0x34,0x31,0x2e,
-    0x64,0x65,0x70,0x74,0x68,0x73,0x5b,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,
-    0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x5d,0x2e,
-    0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x75,0x6e,0x70,0x61,
-    0x63,0x6b,0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x28,0x70,0x61,0x72,0x61,
-    0x6d,0x2c,0x20,0x5f,0x32,0x32,0x2c,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x74,0x65,
-    0x78,0x74,0x75,0x72,0x65,0x2c,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x73,0x61,0x6d,
-    0x70,0x6c,0x65,0x72,0x29,0x20,0x2d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x5f,
-    0x32,0x32,0x2e,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,
-    0x6f,0x6e,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x5f,0x32,0x32,0x2e,
-    0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x66,0x6f,0x72,0x77,0x61,0x72,0x64,0x29,0x29,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x5f,0x31,0x35,0x30,0x2e,0x69,0x6e,0x64,0x69,0x63,
-    0x65,0x73,0x5b,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,
-    0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x5d,0x2e,0x76,0x61,0x6c,0x75,
-    0x65,0x20,0x3d,0x20,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,
-    0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x3b,0x0a,0x7d,0x0a,0x0a,
-    0x00,
+    0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x70,0x6f,
+    0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x62,0x75,0x66,0x66,0x65,0x72,0x26,0x20,0x5f,
+    0x35,0x38,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x31,0x31,0x29,0x5d,
+    0x5d,0x2c,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x64,0x65,0x70,0x74,0x68,0x5f,
+    0x6f,0x75,0x74,0x70,0x75,0x74,0x26,0x20,0x5f,0x31,0x37,0x30,0x20,0x5b,0x5b,0x62,
+    0x75,0x66,0x66,0x65,0x72,0x28,0x38,0x29,0x5d,0x5d,0x2c,0x20,0x64,0x65,0x76,0x69,
+    0x63,0x65,0x20,0x69,0x6e,0x64,0x65,0x78,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x26,
+    0x20,0x5f,0x31,0x38,0x30,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x39,
+    0x29,0x5d,0x5d,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x64,0x65,0x76,0x69,0x63,
+    0x65,0x20,0x61,0x63,0x74,0x69,0x76,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x26,0x20,
+    0x5f,0x31,0x39,0x35,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x31,0x30,
+    0x29,0x5d,0x5d,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,
+    0x6c,0x6f,0x61,0x74,0x3e,0x20,0x63,0x68,0x75,0x6e,0x6b,0x5f,0x74,0x65,0x78,0x74,
+    0x75,0x72,0x65,0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x30,0x29,
+    0x5d,0x5d,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x73,0x70,0x6c,0x61,
+    0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x5b,0x5b,0x73,0x61,0x6d,0x70,
+    0x6c,0x65,0x72,0x28,0x32,0x29,0x5d,0x5d,0x2c,0x20,0x75,0x69,0x6e,0x74,0x33,0x20,
+    0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,
+    0x69,0x6f,0x6e,0x49,0x44,0x20,0x5b,0x5b,0x74,0x68,0x72,0x65,0x61,0x64,0x5f,0x70,
+    0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x69,0x6e,0x5f,0x67,0x72,0x69,0x64,0x5d,
+    0x5d,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x6e,0x74,
+    0x28,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,
+    0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x29,0x20,0x3e,0x3d,0x20,0x5f,0x32,0x32,
+    0x2e,0x73,0x6f,0x72,0x74,0x5f,0x63,0x6f,0x75,0x6e,0x74,0x29,0x0a,0x20,0x20,0x20,
+    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,
+    0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
+    0x28,0x69,0x6e,0x74,0x28,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,
+    0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x29,0x20,0x3e,0x3d,
+    0x20,0x5f,0x32,0x32,0x2e,0x73,0x70,0x6c,0x61,0x74,0x5f,0x63,0x6f,0x75,0x6e,0x74,
+    0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x5f,0x31,0x37,0x30,0x2e,0x64,0x65,0x70,0x74,0x68,0x73,0x5b,0x5f,0x32,0x32,0x2e,
+    0x73,0x65,0x6e,0x74,0x69,0x6e,0x65,0x6c,0x5f,0x69,0x6e,0x64,0x65,0x78,0x5d,0x2e,
+    0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x2d,0x33,0x2e,0x34,0x30,0x32,0x38,0x32,
+    0x33,0x30,0x36,0x30,0x37,0x33,0x37,0x30,0x39,0x36,0x35,0x30,0x35,0x36,0x32,0x32,
+    0x32,0x34,0x33,0x38,0x39,0x36,0x31,0x37,0x31,0x37,0x65,0x2b,0x33,0x38,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x31,0x38,0x30,0x2e,0x69,0x6e,0x64,
+    0x69,0x63,0x65,0x73,0x5b,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,
+    0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x5d,0x2e,0x76,0x61,
+    0x6c,0x75,0x65,0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,0x28,0x5f,0x32,0x32,0x2e,0x73,
+    0x65,0x6e,0x74,0x69,0x6e,0x65,0x6c,0x5f,0x69,0x6e,0x64,0x65,0x78,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,
+    0x31,0x35,0x36,0x20,0x3d,0x20,0x28,0x5f,0x32,0x32,0x2e,0x75,0x73,0x65,0x5f,0x61,
+    0x63,0x74,0x69,0x76,0x65,0x5f,0x69,0x6e,0x64,0x69,0x63,0x65,0x73,0x20,0x21,0x3d,
+    0x20,0x30,0x29,0x20,0x3f,0x20,0x5f,0x31,0x39,0x35,0x2e,0x61,0x63,0x74,0x69,0x76,
+    0x65,0x5f,0x69,0x6e,0x64,0x69,0x63,0x65,0x73,0x5b,0x67,0x6c,0x5f,0x47,0x6c,0x6f,
+    0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,
+    0x78,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3a,0x20,0x67,0x6c,0x5f,0x47,0x6c,
+    0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,
+    0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x20,0x3d,0x20,0x5f,0x31,0x35,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x5f,
+    0x31,0x37,0x30,0x2e,0x64,0x65,0x70,0x74,0x68,0x73,0x5b,0x5f,0x31,0x35,0x36,0x5d,
+    0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x75,0x6e,0x70,
+    0x61,0x63,0x6b,0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x28,0x70,0x61,0x72,
+    0x61,0x6d,0x2c,0x20,0x5f,0x35,0x38,0x2c,0x20,0x63,0x68,0x75,0x6e,0x6b,0x5f,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x2c,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x73,0x61,
+    0x6d,0x70,0x6c,0x65,0x72,0x29,0x20,0x2d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,
+    0x5f,0x32,0x32,0x2e,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x70,0x6f,0x73,0x69,0x74,
+    0x69,0x6f,0x6e,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x5f,0x32,0x32,
+    0x2e,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x66,0x6f,0x72,0x77,0x61,0x72,0x64,0x29,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x5f,0x31,0x38,0x30,0x2e,0x69,0x6e,0x64,0x69,
+    0x63,0x65,0x73,0x5b,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,
+    0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x5d,0x2e,0x76,0x61,0x6c,
+    0x75,0x65,0x20,0x3d,0x20,0x5f,0x31,0x35,0x36,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
 };
 static inline const sg_shader_desc* depth_shader_desc(sg_backend backend) {
     if (backend == SG_BACKEND_GLCORE) {
@@ -1277,7 +1661,7 @@ static inline const sg_shader_desc* depth_shader_desc(sg_backend backend) {
             desc.compute_func.entry = "main";
             desc.uniform_blocks[0].stage = SG_SHADERSTAGE_COMPUTE;
             desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
-            desc.uniform_blocks[0].size = 144;
+            desc.uniform_blocks[0].size = 112;
             desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
             desc.uniform_blocks[0].glsl_uniforms[0].array_count = 0;
             desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "_22.viewMat_row0";
@@ -1302,46 +1686,40 @@ static inline const sg_shader_desc* depth_shader_desc(sg_backend backend) {
             desc.uniform_blocks[0].glsl_uniforms[7].type = SG_UNIFORMTYPE_FLOAT;
             desc.uniform_blocks[0].glsl_uniforms[7].array_count = 0;
             desc.uniform_blocks[0].glsl_uniforms[7].glsl_name = "_22._pad1";
-            desc.uniform_blocks[0].glsl_uniforms[8].type = SG_UNIFORMTYPE_FLOAT3;
+            desc.uniform_blocks[0].glsl_uniforms[8].type = SG_UNIFORMTYPE_INT;
             desc.uniform_blocks[0].glsl_uniforms[8].array_count = 0;
-            desc.uniform_blocks[0].glsl_uniforms[8].glsl_name = "_22.bounds_min";
-            desc.uniform_blocks[0].glsl_uniforms[9].type = SG_UNIFORMTYPE_FLOAT;
+            desc.uniform_blocks[0].glsl_uniforms[8].glsl_name = "_22.splat_count";
+            desc.uniform_blocks[0].glsl_uniforms[9].type = SG_UNIFORMTYPE_INT;
             desc.uniform_blocks[0].glsl_uniforms[9].array_count = 0;
-            desc.uniform_blocks[0].glsl_uniforms[9].glsl_name = "_22._pad2";
-            desc.uniform_blocks[0].glsl_uniforms[10].type = SG_UNIFORMTYPE_FLOAT3;
+            desc.uniform_blocks[0].glsl_uniforms[9].glsl_name = "_22.sort_count";
+            desc.uniform_blocks[0].glsl_uniforms[10].type = SG_UNIFORMTYPE_INT;
             desc.uniform_blocks[0].glsl_uniforms[10].array_count = 0;
-            desc.uniform_blocks[0].glsl_uniforms[10].glsl_name = "_22.bounds_size";
+            desc.uniform_blocks[0].glsl_uniforms[10].glsl_name = "_22.use_active_indices";
             desc.uniform_blocks[0].glsl_uniforms[11].type = SG_UNIFORMTYPE_INT;
             desc.uniform_blocks[0].glsl_uniforms[11].array_count = 0;
-            desc.uniform_blocks[0].glsl_uniforms[11].glsl_name = "_22.splat_count";
-            desc.uniform_blocks[0].glsl_uniforms[12].type = SG_UNIFORMTYPE_INT;
-            desc.uniform_blocks[0].glsl_uniforms[12].array_count = 0;
-            desc.uniform_blocks[0].glsl_uniforms[12].glsl_name = "_22.texture_width";
-            desc.uniform_blocks[0].glsl_uniforms[13].type = SG_UNIFORMTYPE_INT;
-            desc.uniform_blocks[0].glsl_uniforms[13].array_count = 0;
-            desc.uniform_blocks[0].glsl_uniforms[13].glsl_name = "_22.texture_height";
-            desc.uniform_blocks[0].glsl_uniforms[14].type = SG_UNIFORMTYPE_INT;
-            desc.uniform_blocks[0].glsl_uniforms[14].array_count = 0;
-            desc.uniform_blocks[0].glsl_uniforms[14].glsl_name = "_22.splats_per_layer";
-            desc.uniform_blocks[0].glsl_uniforms[15].type = SG_UNIFORMTYPE_FLOAT;
-            desc.uniform_blocks[0].glsl_uniforms[15].array_count = 0;
-            desc.uniform_blocks[0].glsl_uniforms[15].glsl_name = "_22._pad3";
-            desc.views[1].texture.stage = SG_SHADERSTAGE_COMPUTE;
-            desc.views[1].texture.image_type = SG_IMAGETYPE_ARRAY;
-            desc.views[1].texture.sample_type = SG_IMAGESAMPLETYPE_UINT;
-            desc.views[1].texture.multisampled = false;
+            desc.uniform_blocks[0].glsl_uniforms[11].glsl_name = "_22.sentinel_index";
             desc.views[3].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
             desc.views[3].storage_buffer.readonly = false;
-            desc.views[3].storage_buffer.glsl_binding_n = 3;
+            desc.views[3].storage_buffer.glsl_binding_n = 0;
             desc.views[4].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
             desc.views[4].storage_buffer.readonly = false;
-            desc.views[4].storage_buffer.glsl_binding_n = 4;
+            desc.views[4].storage_buffer.glsl_binding_n = 1;
+            desc.views[5].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[5].storage_buffer.readonly = true;
+            desc.views[5].storage_buffer.glsl_binding_n = 2;
+            desc.views[6].texture.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[6].texture.image_type = SG_IMAGETYPE_2D;
+            desc.views[6].texture.sample_type = SG_IMAGESAMPLETYPE_UNFILTERABLE_FLOAT;
+            desc.views[6].texture.multisampled = false;
+            desc.views[10].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[10].storage_buffer.readonly = true;
+            desc.views[10].storage_buffer.glsl_binding_n = 3;
             desc.samplers[2].stage = SG_SHADERSTAGE_COMPUTE;
             desc.samplers[2].sampler_type = SG_SAMPLERTYPE_NONFILTERING;
             desc.texture_sampler_pairs[0].stage = SG_SHADERSTAGE_COMPUTE;
-            desc.texture_sampler_pairs[0].view_slot = 1;
+            desc.texture_sampler_pairs[0].view_slot = 6;
             desc.texture_sampler_pairs[0].sampler_slot = 2;
-            desc.texture_sampler_pairs[0].glsl_name = "splat_texture_splat_sampler";
+            desc.texture_sampler_pairs[0].glsl_name = "chunk_texture_splat_sampler";
             desc.label = "depth_shader";
         }
         return &desc;
@@ -1355,7 +1733,7 @@ static inline const sg_shader_desc* depth_shader_desc(sg_backend backend) {
             desc.compute_func.entry = "main";
             desc.uniform_blocks[0].stage = SG_SHADERSTAGE_COMPUTE;
             desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
-            desc.uniform_blocks[0].size = 144;
+            desc.uniform_blocks[0].size = 112;
             desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
             desc.uniform_blocks[0].glsl_uniforms[0].array_count = 0;
             desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "_22.viewMat_row0";
@@ -1380,46 +1758,40 @@ static inline const sg_shader_desc* depth_shader_desc(sg_backend backend) {
             desc.uniform_blocks[0].glsl_uniforms[7].type = SG_UNIFORMTYPE_FLOAT;
             desc.uniform_blocks[0].glsl_uniforms[7].array_count = 0;
             desc.uniform_blocks[0].glsl_uniforms[7].glsl_name = "_22._pad1";
-            desc.uniform_blocks[0].glsl_uniforms[8].type = SG_UNIFORMTYPE_FLOAT3;
+            desc.uniform_blocks[0].glsl_uniforms[8].type = SG_UNIFORMTYPE_INT;
             desc.uniform_blocks[0].glsl_uniforms[8].array_count = 0;
-            desc.uniform_blocks[0].glsl_uniforms[8].glsl_name = "_22.bounds_min";
-            desc.uniform_blocks[0].glsl_uniforms[9].type = SG_UNIFORMTYPE_FLOAT;
+            desc.uniform_blocks[0].glsl_uniforms[8].glsl_name = "_22.splat_count";
+            desc.uniform_blocks[0].glsl_uniforms[9].type = SG_UNIFORMTYPE_INT;
             desc.uniform_blocks[0].glsl_uniforms[9].array_count = 0;
-            desc.uniform_blocks[0].glsl_uniforms[9].glsl_name = "_22._pad2";
-            desc.uniform_blocks[0].glsl_uniforms[10].type = SG_UNIFORMTYPE_FLOAT3;
+            desc.uniform_blocks[0].glsl_uniforms[9].glsl_name = "_22.sort_count";
+            desc.uniform_blocks[0].glsl_uniforms[10].type = SG_UNIFORMTYPE_INT;
             desc.uniform_blocks[0].glsl_uniforms[10].array_count = 0;
-            desc.uniform_blocks[0].glsl_uniforms[10].glsl_name = "_22.bounds_size";
+            desc.uniform_blocks[0].glsl_uniforms[10].glsl_name = "_22.use_active_indices";
             desc.uniform_blocks[0].glsl_uniforms[11].type = SG_UNIFORMTYPE_INT;
             desc.uniform_blocks[0].glsl_uniforms[11].array_count = 0;
-            desc.uniform_blocks[0].glsl_uniforms[11].glsl_name = "_22.splat_count";
-            desc.uniform_blocks[0].glsl_uniforms[12].type = SG_UNIFORMTYPE_INT;
-            desc.uniform_blocks[0].glsl_uniforms[12].array_count = 0;
-            desc.uniform_blocks[0].glsl_uniforms[12].glsl_name = "_22.texture_width";
-            desc.uniform_blocks[0].glsl_uniforms[13].type = SG_UNIFORMTYPE_INT;
-            desc.uniform_blocks[0].glsl_uniforms[13].array_count = 0;
-            desc.uniform_blocks[0].glsl_uniforms[13].glsl_name = "_22.texture_height";
-            desc.uniform_blocks[0].glsl_uniforms[14].type = SG_UNIFORMTYPE_INT;
-            desc.uniform_blocks[0].glsl_uniforms[14].array_count = 0;
-            desc.uniform_blocks[0].glsl_uniforms[14].glsl_name = "_22.splats_per_layer";
-            desc.uniform_blocks[0].glsl_uniforms[15].type = SG_UNIFORMTYPE_FLOAT;
-            desc.uniform_blocks[0].glsl_uniforms[15].array_count = 0;
-            desc.uniform_blocks[0].glsl_uniforms[15].glsl_name = "_22._pad3";
-            desc.views[1].texture.stage = SG_SHADERSTAGE_COMPUTE;
-            desc.views[1].texture.image_type = SG_IMAGETYPE_ARRAY;
-            desc.views[1].texture.sample_type = SG_IMAGESAMPLETYPE_UINT;
-            desc.views[1].texture.multisampled = false;
+            desc.uniform_blocks[0].glsl_uniforms[11].glsl_name = "_22.sentinel_index";
             desc.views[3].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
             desc.views[3].storage_buffer.readonly = false;
-            desc.views[3].storage_buffer.glsl_binding_n = 3;
+            desc.views[3].storage_buffer.glsl_binding_n = 0;
             desc.views[4].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
             desc.views[4].storage_buffer.readonly = false;
-            desc.views[4].storage_buffer.glsl_binding_n = 4;
+            desc.views[4].storage_buffer.glsl_binding_n = 1;
+            desc.views[5].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[5].storage_buffer.readonly = true;
+            desc.views[5].storage_buffer.glsl_binding_n = 2;
+            desc.views[6].texture.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[6].texture.image_type = SG_IMAGETYPE_2D;
+            desc.views[6].texture.sample_type = SG_IMAGESAMPLETYPE_UNFILTERABLE_FLOAT;
+            desc.views[6].texture.multisampled = false;
+            desc.views[10].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[10].storage_buffer.readonly = true;
+            desc.views[10].storage_buffer.glsl_binding_n = 3;
             desc.samplers[2].stage = SG_SHADERSTAGE_COMPUTE;
             desc.samplers[2].sampler_type = SG_SAMPLERTYPE_NONFILTERING;
             desc.texture_sampler_pairs[0].stage = SG_SHADERSTAGE_COMPUTE;
-            desc.texture_sampler_pairs[0].view_slot = 1;
+            desc.texture_sampler_pairs[0].view_slot = 6;
             desc.texture_sampler_pairs[0].sampler_slot = 2;
-            desc.texture_sampler_pairs[0].glsl_name = "splat_texture_splat_sampler";
+            desc.texture_sampler_pairs[0].glsl_name = "chunk_texture_splat_sampler";
             desc.label = "depth_shader";
         }
         return &desc;
@@ -1434,24 +1806,30 @@ static inline const sg_shader_desc* depth_shader_desc(sg_backend backend) {
             desc.compute_func.entry = "main";
             desc.uniform_blocks[0].stage = SG_SHADERSTAGE_COMPUTE;
             desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
-            desc.uniform_blocks[0].size = 144;
+            desc.uniform_blocks[0].size = 112;
             desc.uniform_blocks[0].hlsl_register_b_n = 0;
-            desc.views[1].texture.stage = SG_SHADERSTAGE_COMPUTE;
-            desc.views[1].texture.image_type = SG_IMAGETYPE_ARRAY;
-            desc.views[1].texture.sample_type = SG_IMAGESAMPLETYPE_UINT;
-            desc.views[1].texture.multisampled = false;
-            desc.views[1].texture.hlsl_register_t_n = 0;
             desc.views[3].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
             desc.views[3].storage_buffer.readonly = false;
             desc.views[3].storage_buffer.hlsl_register_u_n = 0;
             desc.views[4].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
             desc.views[4].storage_buffer.readonly = false;
             desc.views[4].storage_buffer.hlsl_register_u_n = 1;
+            desc.views[5].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[5].storage_buffer.readonly = true;
+            desc.views[5].storage_buffer.hlsl_register_t_n = 0;
+            desc.views[6].texture.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[6].texture.image_type = SG_IMAGETYPE_2D;
+            desc.views[6].texture.sample_type = SG_IMAGESAMPLETYPE_UNFILTERABLE_FLOAT;
+            desc.views[6].texture.multisampled = false;
+            desc.views[6].texture.hlsl_register_t_n = 1;
+            desc.views[10].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[10].storage_buffer.readonly = true;
+            desc.views[10].storage_buffer.hlsl_register_t_n = 2;
             desc.samplers[2].stage = SG_SHADERSTAGE_COMPUTE;
             desc.samplers[2].sampler_type = SG_SAMPLERTYPE_NONFILTERING;
             desc.samplers[2].hlsl_register_s_n = 2;
             desc.texture_sampler_pairs[0].stage = SG_SHADERSTAGE_COMPUTE;
-            desc.texture_sampler_pairs[0].view_slot = 1;
+            desc.texture_sampler_pairs[0].view_slot = 6;
             desc.texture_sampler_pairs[0].sampler_slot = 2;
             desc.label = "depth_shader";
         }
@@ -1469,24 +1847,30 @@ static inline const sg_shader_desc* depth_shader_desc(sg_backend backend) {
             desc.mtl_threads_per_threadgroup.z = 1;
             desc.uniform_blocks[0].stage = SG_SHADERSTAGE_COMPUTE;
             desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
-            desc.uniform_blocks[0].size = 144;
+            desc.uniform_blocks[0].size = 112;
             desc.uniform_blocks[0].msl_buffer_n = 0;
-            desc.views[1].texture.stage = SG_SHADERSTAGE_COMPUTE;
-            desc.views[1].texture.image_type = SG_IMAGETYPE_ARRAY;
-            desc.views[1].texture.sample_type = SG_IMAGESAMPLETYPE_UINT;
-            desc.views[1].texture.multisampled = false;
-            desc.views[1].texture.msl_texture_n = 0;
             desc.views[3].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
             desc.views[3].storage_buffer.readonly = false;
             desc.views[3].storage_buffer.msl_buffer_n = 8;
             desc.views[4].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
             desc.views[4].storage_buffer.readonly = false;
             desc.views[4].storage_buffer.msl_buffer_n = 9;
+            desc.views[5].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[5].storage_buffer.readonly = true;
+            desc.views[5].storage_buffer.msl_buffer_n = 10;
+            desc.views[6].texture.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[6].texture.image_type = SG_IMAGETYPE_2D;
+            desc.views[6].texture.sample_type = SG_IMAGESAMPLETYPE_UNFILTERABLE_FLOAT;
+            desc.views[6].texture.multisampled = false;
+            desc.views[6].texture.msl_texture_n = 0;
+            desc.views[10].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[10].storage_buffer.readonly = true;
+            desc.views[10].storage_buffer.msl_buffer_n = 11;
             desc.samplers[2].stage = SG_SHADERSTAGE_COMPUTE;
             desc.samplers[2].sampler_type = SG_SAMPLERTYPE_NONFILTERING;
             desc.samplers[2].msl_sampler_n = 2;
             desc.texture_sampler_pairs[0].stage = SG_SHADERSTAGE_COMPUTE;
-            desc.texture_sampler_pairs[0].view_slot = 1;
+            desc.texture_sampler_pairs[0].view_slot = 6;
             desc.texture_sampler_pairs[0].sampler_slot = 2;
             desc.label = "depth_shader";
         }
@@ -1504,24 +1888,30 @@ static inline const sg_shader_desc* depth_shader_desc(sg_backend backend) {
             desc.mtl_threads_per_threadgroup.z = 1;
             desc.uniform_blocks[0].stage = SG_SHADERSTAGE_COMPUTE;
             desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
-            desc.uniform_blocks[0].size = 144;
+            desc.uniform_blocks[0].size = 112;
             desc.uniform_blocks[0].msl_buffer_n = 0;
-            desc.views[1].texture.stage = SG_SHADERSTAGE_COMPUTE;
-            desc.views[1].texture.image_type = SG_IMAGETYPE_ARRAY;
-            desc.views[1].texture.sample_type = SG_IMAGESAMPLETYPE_UINT;
-            desc.views[1].texture.multisampled = false;
-            desc.views[1].texture.msl_texture_n = 0;
             desc.views[3].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
             desc.views[3].storage_buffer.readonly = false;
             desc.views[3].storage_buffer.msl_buffer_n = 8;
             desc.views[4].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
             desc.views[4].storage_buffer.readonly = false;
             desc.views[4].storage_buffer.msl_buffer_n = 9;
+            desc.views[5].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[5].storage_buffer.readonly = true;
+            desc.views[5].storage_buffer.msl_buffer_n = 10;
+            desc.views[6].texture.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[6].texture.image_type = SG_IMAGETYPE_2D;
+            desc.views[6].texture.sample_type = SG_IMAGESAMPLETYPE_UNFILTERABLE_FLOAT;
+            desc.views[6].texture.multisampled = false;
+            desc.views[6].texture.msl_texture_n = 0;
+            desc.views[10].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[10].storage_buffer.readonly = true;
+            desc.views[10].storage_buffer.msl_buffer_n = 11;
             desc.samplers[2].stage = SG_SHADERSTAGE_COMPUTE;
             desc.samplers[2].sampler_type = SG_SAMPLERTYPE_NONFILTERING;
             desc.samplers[2].msl_sampler_n = 2;
             desc.texture_sampler_pairs[0].stage = SG_SHADERSTAGE_COMPUTE;
-            desc.texture_sampler_pairs[0].view_slot = 1;
+            desc.texture_sampler_pairs[0].view_slot = 6;
             desc.texture_sampler_pairs[0].sampler_slot = 2;
             desc.label = "depth_shader";
         }
@@ -1539,24 +1929,30 @@ static inline const sg_shader_desc* depth_shader_desc(sg_backend backend) {
             desc.mtl_threads_per_threadgroup.z = 1;
             desc.uniform_blocks[0].stage = SG_SHADERSTAGE_COMPUTE;
             desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
-            desc.uniform_blocks[0].size = 144;
+            desc.uniform_blocks[0].size = 112;
             desc.uniform_blocks[0].msl_buffer_n = 0;
-            desc.views[1].texture.stage = SG_SHADERSTAGE_COMPUTE;
-            desc.views[1].texture.image_type = SG_IMAGETYPE_ARRAY;
-            desc.views[1].texture.sample_type = SG_IMAGESAMPLETYPE_UINT;
-            desc.views[1].texture.multisampled = false;
-            desc.views[1].texture.msl_texture_n = 0;
             desc.views[3].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
             desc.views[3].storage_buffer.readonly = false;
             desc.views[3].storage_buffer.msl_buffer_n = 8;
             desc.views[4].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
             desc.views[4].storage_buffer.readonly = false;
             desc.views[4].storage_buffer.msl_buffer_n = 9;
+            desc.views[5].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[5].storage_buffer.readonly = true;
+            desc.views[5].storage_buffer.msl_buffer_n = 10;
+            desc.views[6].texture.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[6].texture.image_type = SG_IMAGETYPE_2D;
+            desc.views[6].texture.sample_type = SG_IMAGESAMPLETYPE_UNFILTERABLE_FLOAT;
+            desc.views[6].texture.multisampled = false;
+            desc.views[6].texture.msl_texture_n = 0;
+            desc.views[10].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[10].storage_buffer.readonly = true;
+            desc.views[10].storage_buffer.msl_buffer_n = 11;
             desc.samplers[2].stage = SG_SHADERSTAGE_COMPUTE;
             desc.samplers[2].sampler_type = SG_SAMPLERTYPE_NONFILTERING;
             desc.samplers[2].msl_sampler_n = 2;
             desc.texture_sampler_pairs[0].stage = SG_SHADERSTAGE_COMPUTE;
-            desc.texture_sampler_pairs[0].view_slot = 1;
+            desc.texture_sampler_pairs[0].view_slot = 6;
             desc.texture_sampler_pairs[0].sampler_slot = 2;
             desc.label = "depth_shader";
         }
@@ -0,0 +1,250 @@
+// Splat budget selection compute shaders
+// Scores candidates by projected area * opacity, builds a log histogram, finds the threshold bin
+// for the budget and compacts the survivors into the active list used by the depth pass.
+// Mirrors budget_select in splat_budget.c; histogram constants must match splat_budget.h.
+// The state buffer starts zeroed and select_threshold leaves the histogram cleared for the next frame.
+
+@block select_common
+layout(binding=0) uniform select_params {
+    vec4 viewProj_row0;
+    vec4 viewProj_row1;
+    vec4 viewProj_row2;
+    vec4 viewProj_row3;
+    vec3 camera_position;
+    float focal_px;
+    vec3 camera_forward;
+    float viewport_width;
+    float viewport_height;
+    int candidate_count;
+    int use_candidates; // 0: candidate i is splat i
+    int budget;
+    int texture_width;
+    int splats_per_layer;
+};
+
+struct SelectValue {
+    uint value;
+};
+
+// Histogram bins followed by the control words
+const int HISTOGRAM_BINS = 1024;
+const int STATE_THRESHOLD_BIN = 1024;
+const int STATE_QUOTA = 1025;
+const int STATE_KEPT = 1026;
+const int STATE_TIES = 1027;
+@end
+
+// Scoring is shared by the texture array (score_bins) and storage buffer (score_bins_buffer) variants
+@block score_common
+@sampler_type splat_sampler nonfiltering
+layout(binding = 2) uniform sampler splat_sampler;
+
+layout(binding=3) readonly buffer candidate_input {
+    SelectValue candidates[];
+};
+
+layout(binding=4) buffer bin_buffer {
+    SelectValue bins[];
+};
+
+layout(binding=5) buffer select_state {
+    SelectValue state[];
+};
+
+// Per-chunk position bounds, two texels (min, max) per chunk of 256 splats, see splat_chunk_t
+@image_sample_type chunk_texture unfilterable_float
+layout(binding = 6) uniform texture2D chunk_texture;
+
+const int CHUNK_SIZE = 256;
+const int CHUNKS_PER_ROW = 1024;
+@end
+
+@block score_main
+uint score_bin(uint splat_idx) {
+    uvec4 packed = fetch_splat(splat_idx);
+
+    // Same alpha cut as splat.glsl
+    uint alpha = packed.a & 0xFFu;
+    if (alpha < 3u) {
+        return 0u;
+    }
+
+    const float inv_65535 = 1.0 / 65535.0;
+    vec3 norm_pos = vec3(
+        float((packed.r >> 16u) & 0xFFFFu),
+        float(packed.r & 0xFFFFu),
+        float((packed.g >> 16u) & 0xFFFFu)
+    ) * inv_65535;
+    int chunk = int(splat_idx) / CHUNK_SIZE;
+    ivec2 chunk_texel = ivec2((chunk % CHUNKS_PER_ROW) * 2, chunk / CHUNKS_PER_ROW);
+    vec3 chunk_min = texelFetch(sampler2D(chunk_texture, splat_sampler), chunk_texel, 0).xyz;
+    vec3 chunk_max = texelFetch(sampler2D(chunk_texture, splat_sampler), chunk_texel + ivec2(1, 0), 0).xyz;
+    vec3 pos = chunk_min + norm_pos * (chunk_max - chunk_min);
+
+    float depth = dot(pos - camera_position, camera_forward);
+    if (depth < 1e-3) {
+        return 0u;
+    }
+
+    vec2 scale = exp(vec2(
+        float((packed.b >> 16u) & 0xFFu),
+        float((packed.b >> 8u) & 0xFFu)
+    ) * (1.0 / 25.5) - 5.0);
+    float px_per_unit = focal_px / depth;
+
+    // Off screen by more than the splat's own radius
+    vec4 p = vec4(pos, 1.0);
+    vec4 clip = vec4(dot(viewProj_row0, p), dot(viewProj_row1, p), dot(viewProj_row2, p), dot(viewProj_row3, p));
+    float radius_px = 0.5 * max(scale.x, scale.y) * px_per_unit;
+    vec2 ndc = clip.xy / clip.w;
+    if (abs(ndc.x) > 1.0 + 2.0 * radius_px / viewport_width ||
+        abs(ndc.y) > 1.0 + 2.0 * radius_px / viewport_height) {
+        return 0u;
+    }
+
+    float score = scale.x * scale.y * px_per_unit * px_per_unit * float(alpha) * (1.0 / 255.0);
+    if (!(score > 0.0)) {
+        return 0u;
+    }
+
+    // log2 range [-16, 24] over bins 1..1023
+    float bin = (log2(score) + 16.0) * (1023.0 / 40.0) + 1.0;
+    return uint(clamp(bin, 1.0, 1023.0));
+}
+
+void main() {
+    uint idx = gl_GlobalInvocationID.x;
+    if (int(idx) >= candidate_count) {
+        return;
+    }
+
+    uint splat_idx = use_candidates != 0 ? candidates[idx].value : idx;
+    uint bin = score_bin(splat_idx);
+    bins[idx].value = bin;
+    atomicAdd(state[bin].value, 1u);
+}
+@end
+
+@cs score_bins
+layout(local_size_x = 256, local_size_y = 1, local_size_z = 1) in;
+@include_block select_common
+
+@image_sample_type splat_texture uint
+layout(binding = 1) uniform utexture2DArray splat_texture;
+
+@include_block score_common
+
+uvec4 fetch_splat(uint splat_idx) {
+    int layer = int(splat_idx) / splats_per_layer;
+    int pixel_in_layer = int(splat_idx) - (layer * splats_per_layer);
+    return texelFetch(
+        usampler2DArray(splat_texture, splat_sampler),
+        ivec3(pixel_in_layer % texture_width, pixel_in_layer / texture_width, layer),
+        0
+    );
+}
+
+@include_block score_main
+@end
+
+@cs score_bins_buffer
+layout(local_size_x = 256, local_size_y = 1, local_size_z = 1) in;
+@include_block select_common
+
+struct SelectSplatTexel {
+    uvec4 value;
+};
+
+layout(binding = 8) readonly buffer splat_buffer {
+    SelectSplatTexel splats[];
+};
+
+@include_block score_common
+
+uvec4 fetch_splat(uint splat_idx) {
+    return splats[splat_idx].value;
+}
+
+@include_block score_main
+@end
+
+@cs find_threshold
+layout(local_size_x = 1, local_size_y = 1, local_size_z = 1) in;
+@include_block select_common
+
+layout(binding=5) buffer select_state {
+    SelectValue state[];
+};
+
+// Walk the histogram from the highest scores down until the budget is filled.
+// The histogram is cleared on the way so the next frame starts from zero.
+void main() {
+    uint remaining = uint(budget);
+    uint threshold_bin = 0u;
+    bool found = false;
+    for (int b = HISTOGRAM_BINS - 1; b >= 0; b--) {
+        uint count = state[b].value;
+        state[b].value = 0u;
+        if (found) {
+            continue;
+        }
+        if (count >= remaining) {
+            threshold_bin = uint(b);
+            found = true;
+        } else {
+            remaining -= count;
+        }
+    }
+    state[STATE_THRESHOLD_BIN].value = threshold_bin;
+    state[STATE_QUOTA].value = remaining;
+    state[STATE_KEPT].value = 0u;
+    state[STATE_TIES].value = 0u;
+}
+@end
+
+@cs compact_selected
+layout(local_size_x = 256, local_size_y = 1, local_size_z = 1) in;
+@include_block select_common
+
+layout(binding=3) readonly buffer candidate_input {
+    SelectValue candidates[];
+};
+
+layout(binding=4) buffer bin_buffer {
+    SelectValue bins[];
+};
+
+layout(binding=5) buffer select_state {
+    SelectValue state[];
+};
+
+layout(binding=7) writeonly buffer selected_output {
+    SelectValue selected[];
+};
+
+void main() {
+    uint idx = gl_GlobalInvocationID.x;
+    if (int(idx) >= candidate_count) {
+        return;
+    }
+
+    uint bin = bins[idx].value;
+    uint threshold_bin = state[STATE_THRESHOLD_BIN].value;
+    bool keep = bin > threshold_bin;
+
+    // Ties in the threshold bin fill the remaining quota
+    if (bin == threshold_bin) {
+        keep = atomicAdd(state[STATE_TIES].value, 1u) < state[STATE_QUOTA].value;
+    }
+
+    if (keep) {
+        uint slot = atomicAdd(state[STATE_KEPT].value, 1u);
+        selected[slot].value = use_candidates != 0 ? candidates[idx].value : idx;
+    }
+}
+@end
+
+@program select_score score_bins
+@program select_score_buffer score_bins_buffer
+@program select_threshold find_threshold
+@program select_compact compact_selected
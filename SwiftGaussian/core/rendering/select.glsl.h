@@ -0,0 +1,7234 @@
+#pragma once
+/*
+    #version:1# (machine generated, don't edit!)
+
+    Generated by sokol-shdc (https://github.com/floooh/sokol-tools)
+
+    Cmdline:
+        sokol-shdc -i ./ios-splats/ios-splats/core/rendering/select.glsl -o ./ios-splats/ios-splats/core/rendering/select.glsl.h -l metal_ios:metal_sim:metal_macos:hlsl5:glsl310es:glsl410
+
+    Overview:
+    =========
+    Shader program: 'select_score':
+        Get shader desc: select_score_shader_desc(sg_query_backend());
+        Compute Shader: score_bins
+    Shader program: 'select_score_buffer':
+        Get shader desc: select_score_buffer_shader_desc(sg_query_backend());
+        Compute Shader: score_bins_buffer
+    Shader program: 'select_threshold':
+        Get shader desc: select_threshold_shader_desc(sg_query_backend());
+        Compute Shader: find_threshold
+    Shader program: 'select_compact':
+        Get shader desc: select_compact_shader_desc(sg_query_backend());
+        Compute Shader: compact_selected
+    Bindings:
+        Uniform block 'select_params':
+            C struct: select_params_t
+            Bind slot: UB_select_params => 0
+        Storage buffer 'candidate_input':
+            C struct: SelectValue_t
+            Bind slot: VIEW_candidate_input => 3
+            Readonly: true
+        Storage buffer 'bin_buffer':
+            C struct: SelectValue_t
+            Bind slot: VIEW_bin_buffer => 4
+            Readonly: false
+        Storage buffer 'select_state':
+            C struct: SelectValue_t
+            Bind slot: VIEW_select_state => 5
+            Readonly: false
+        Storage buffer 'splat_buffer':
+            C struct: SelectSplatTexel_t
+            Bind slot: VIEW_splat_buffer => 8
+            Readonly: true
+        Storage buffer 'selected_output':
+            C struct: SelectValue_t
+            Bind slot: VIEW_selected_output => 7
+            Readonly: false
+        Texture 'splat_texture':
+            Image type: SG_IMAGETYPE_ARRAY
+            Sample type: SG_IMAGESAMPLETYPE_UINT
+            Multisampled: false
+            Bind slot: VIEW_splat_texture => 1
+        Texture 'chunk_texture':
+            Image type: SG_IMAGETYPE_2D
+            Sample type: SG_IMAGESAMPLETYPE_UNFILTERABLE_FLOAT
+            Multisampled: false
+            Bind slot: VIEW_chunk_texture => 6
+        Sampler 'splat_sampler':
+            Type: SG_SAMPLERTYPE_NONFILTERING
+            Bind slot: SMP_splat_sampler => 2
+*/
+#if !defined(SOKOL_GFX_INCLUDED)
+#error "Please include sokol_gfx.h before select.glsl.h"
+#endif
+#if !defined(SOKOL_SHDC_ALIGN)
+#if defined(_MSC_VER)
+#define SOKOL_SHDC_ALIGN(a) __declspec(align(a))
+#else
+#define SOKOL_SHDC_ALIGN(a) __attribute__((aligned(a)))
+#endif
+#endif
+#define UB_select_params (0)
+#define VIEW_candidate_input (3)
+#define VIEW_bin_buffer (4)
+#define VIEW_select_state (5)
+#define VIEW_splat_buffer (8)
+#define VIEW_selected_output (7)
+#define VIEW_splat_texture (1)
+#define VIEW_chunk_texture (6)
+#define SMP_splat_sampler (2)
+#pragma pack(push,1)
+SOKOL_SHDC_ALIGN(16) typedef struct select_params_t {
+    float viewProj_row0[4];
+    float viewProj_row1[4];
+    float viewProj_row2[4];
+    float viewProj_row3[4];
+    float camera_position[3];
+    float focal_px;
+    float camera_forward[3];
+    float viewport_width;
+    float viewport_height;
+    int candidate_count;
+    int use_candidates;
+    int budget;
+    int texture_width;
+    int splats_per_layer;
+    uint8_t _pad_120[8];
+} select_params_t;
+#pragma pack(pop)
+#pragma pack(push,1)
+SOKOL_SHDC_ALIGN(4) typedef struct SelectValue_t {
+    uint32_t value;
+} SelectValue_t;
+#pragma pack(pop)
+#pragma pack(push,1)
+SOKOL_SHDC_ALIGN(16) typedef struct SelectSplatTexel_t {
+    uint32_t value[4];
+} SelectSplatTexel_t;
+#pragma pack(pop)
+/*
+    #version 410
+    #extension GL_ARB_compute_shader : require
+    #extension GL_ARB_shader_storage_buffer_object : require
+    layout(local_size_x = 256, local_size_y = 1, local_size_z = 1) in;
+
+    struct SelectValue
+    {
+        uint value;
+    };
+
+    struct select_params
+    {
+        vec4 viewProj_row0;
+        vec4 viewProj_row1;
+        vec4 viewProj_row2;
+        vec4 viewProj_row3;
+        vec3 camera_position;
+        float focal_px;
+        vec3 camera_forward;
+        float viewport_width;
+        float viewport_height;
+        int candidate_count;
+        int use_candidates;
+        int budget;
+        int texture_width;
+        int splats_per_layer;
+    };
+
+    uniform select_params _40;
+
+    layout(std430) readonly buffer candidate_input
+    {
+        SelectValue candidates[];
+    } _250;
+
+    layout(std430) buffer bin_buffer
+    {
+        SelectValue bins[];
+    } _262;
+
+    layout(std430) buffer select_state
+    {
+        SelectValue state[];
+    } _270;
+
+    uniform usampler2DArray splat_texture_splat_sampler;
+    uniform sampler2D chunk_texture_splat_sampler;
+
+    uvec4 fetch_splat(uint splat_idx)
+    {
+        int _31 = int(splat_idx) / _40.splats_per_layer;
+        int _37 = int(splat_idx) - (_31 * _40.splats_per_layer);
+        return texelFetch(splat_texture_splat_sampler, ivec3(_37 % _40.texture_width, _37 / _40.texture_width, _31), 0);
+    }
+
+    uint score_bin(uint splat_idx)
+    {
+        uint param = splat_idx;
+        uvec4 _80 = fetch_splat(param);
+        uint _84 = _80.w & 255u;
+        if (_84 < 3u)
+        {
+            return 0u;
+        }
+        int _112 = int(splat_idx) / 256;
+        ivec2 _120 = ivec2((_112 % 1024) * 2, _112 / 1024);
+        vec3 _128 = texelFetch(chunk_texture_splat_sampler, _120, 0).xyz;
+        vec3 _138 = _128 + ((vec3(float((_80.x >> 16u) & 65535u), float(_80.x & 65535u), float((_80.y >> 16u) & 65535u)) * 1.525902189314365386962890625e-05) * (texelFetch(chunk_texture_splat_sampler, _120 + ivec2(1, 0), 0).xyz - _128));
+        float _146 = dot(_138 - _40.camera_position, _40.camera_forward);
+        if (_146 < 0.001000000047497451305389404296875)
+        {
+            return 0u;
+        }
+        vec2 _166 = exp((vec2(float((_80.z >> 16u) & 255u), float((_80.z >> 8u) & 255u)) * 0.0392156876623630523681640625) - vec2(5.0));
+        float _171 = _40.focal_px / _146;
+        vec4 _176 = vec4(_138, 1.0);
+        vec4 _197 = vec4(dot(_40.viewProj_row0, _176), dot(_40.viewProj_row1, _176), dot(_40.viewProj_row2, _176), dot(_40.viewProj_row3, _176));
+        float _205 = (0.5 * max(_166.x, _166.y)) * _171;
+        vec2 _209 = _197.xy / vec2(_197.w);
+        if ((abs(_209.x) > (1.0 + ((2.0 * _205) / _40.viewport_width))) || (abs(_209.y) > (1.0 + ((2.0 * _205) / _40.viewport_height))))
+        {
+            return 0u;
+        }
+        float _235 = ((((_166.x * _166.y) * _171) * _171) * float(_84)) * 0.0039215688593685626983642578125;
+        if (!(_235 > 0.0))
+        {
+            return 0u;
+        }
+        return uint(clamp(((log2(_235) + 16.0) * 25.575000762939453125) + 1.0, 1.0, 1023.0));
+    }
+
+    void main()
+    {
+        if (int(gl_GlobalInvocationID.x) >= _40.candidate_count)
+        {
+            return;
+        }
+        uint _265 = (_40.use_candidates != 0) ? _250.candidates[gl_GlobalInvocationID.x].value : gl_GlobalInvocationID.x;
+        uint param_1 = _265;
+        uint _268 = score_bin(param_1);
+        _262.bins[gl_GlobalInvocationID.x].value = _268;
+        uint _275 = atomicAdd(_270.state[_268].value, 1u);
+    }
+
+*/
+static const uint8_t score_bins_source_glsl410[3183] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x31,0x30,0x0a,0x23,0x65,0x78,
+    0x74,0x65,0x6e,0x73,0x69,0x6f,0x6e,0x20,0x47,0x4c,0x5f,0x41,0x52,0x42,0x5f,0x63,
+    0x6f,0x6d,0x70,0x75,0x74,0x65,0x5f,0x73,0x68,0x61,0x64,0x65,0x72,0x20,0x3a,0x20,
+    0x72,0x65,0x71,0x75,0x69,0x72,0x65,0x0a,0x23,0x65,0x78,0x74,0x65,0x6e,0x73,0x69,
+    0x6f,0x6e,0x20,0x47,0x4c,0x5f,0x41,0x52,0x42,0x5f,0x73,0x68,0x61,0x64,0x65,0x72,
+    0x5f,0x73,0x74,0x6f,0x72,0x61,0x67,0x65,0x5f,0x62,0x75,0x66,0x66,0x65,0x72,0x5f,
+    0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x3a,0x20,0x72,0x65,0x71,0x75,0x69,0x72,0x65,
+    0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x6c,0x5f,0x73,0x69,
+    0x7a,0x65,0x5f,0x78,0x20,0x3d,0x20,0x32,0x35,0x36,0x2c,0x20,0x6c,0x6f,0x63,0x61,
+    0x6c,0x5f,0x73,0x69,0x7a,0x65,0x5f,0x79,0x20,0x3d,0x20,0x31,0x2c,0x20,0x6c,0x6f,
+    0x63,0x61,0x6c,0x5f,0x73,0x69,0x7a,0x65,0x5f,0x7a,0x20,0x3d,0x20,0x31,0x29,0x20,
+    0x69,0x6e,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x65,0x6c,0x65,
+    0x63,0x74,0x56,0x61,0x6c,0x75,0x65,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,
+    0x6e,0x74,0x20,0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,
+    0x72,0x75,0x63,0x74,0x20,0x73,0x65,0x6c,0x65,0x63,0x74,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x69,
+    0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x30,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,
+    0x6f,0x77,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x69,
+    0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x32,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,
+    0x6f,0x77,0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x63,0x61,
+    0x6d,0x65,0x72,0x61,0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x66,0x6f,0x63,0x61,0x6c,0x5f,0x70,
+    0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x63,0x61,0x6d,0x65,
+    0x72,0x61,0x5f,0x66,0x6f,0x72,0x77,0x61,0x72,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x69,0x65,0x77,0x70,0x6f,0x72,0x74,0x5f,0x77,
+    0x69,0x64,0x74,0x68,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x76,0x69,0x65,0x77,0x70,0x6f,0x72,0x74,0x5f,0x68,0x65,0x69,0x67,0x68,0x74,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,
+    0x74,0x65,0x5f,0x63,0x6f,0x75,0x6e,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,
+    0x74,0x20,0x75,0x73,0x65,0x5f,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x73,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x62,0x75,0x64,0x67,0x65,0x74,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x74,0x65,0x78,0x74,0x75,0x72,
+    0x65,0x5f,0x77,0x69,0x64,0x74,0x68,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,
+    0x20,0x73,0x70,0x6c,0x61,0x74,0x73,0x5f,0x70,0x65,0x72,0x5f,0x6c,0x61,0x79,0x65,
+    0x72,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,
+    0x65,0x6c,0x65,0x63,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,0x5f,0x34,0x30,
+    0x3b,0x0a,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x73,0x74,0x64,0x34,0x33,0x30,
+    0x29,0x20,0x72,0x65,0x61,0x64,0x6f,0x6e,0x6c,0x79,0x20,0x62,0x75,0x66,0x66,0x65,
+    0x72,0x20,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x5f,0x69,0x6e,0x70,0x75,
+    0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x53,0x65,0x6c,0x65,0x63,0x74,0x56,0x61,
+    0x6c,0x75,0x65,0x20,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x73,0x5b,0x5d,
+    0x3b,0x0a,0x7d,0x20,0x5f,0x32,0x35,0x30,0x3b,0x0a,0x0a,0x6c,0x61,0x79,0x6f,0x75,
+    0x74,0x28,0x73,0x74,0x64,0x34,0x33,0x30,0x29,0x20,0x62,0x75,0x66,0x66,0x65,0x72,
+    0x20,0x62,0x69,0x6e,0x5f,0x62,0x75,0x66,0x66,0x65,0x72,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x53,0x65,0x6c,0x65,0x63,0x74,0x56,0x61,0x6c,0x75,0x65,0x20,0x62,0x69,
+    0x6e,0x73,0x5b,0x5d,0x3b,0x0a,0x7d,0x20,0x5f,0x32,0x36,0x32,0x3b,0x0a,0x0a,0x6c,
+    0x61,0x79,0x6f,0x75,0x74,0x28,0x73,0x74,0x64,0x34,0x33,0x30,0x29,0x20,0x62,0x75,
+    0x66,0x66,0x65,0x72,0x20,0x73,0x65,0x6c,0x65,0x63,0x74,0x5f,0x73,0x74,0x61,0x74,
+    0x65,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x53,0x65,0x6c,0x65,0x63,0x74,0x56,0x61,
+    0x6c,0x75,0x65,0x20,0x73,0x74,0x61,0x74,0x65,0x5b,0x5d,0x3b,0x0a,0x7d,0x20,0x5f,
+    0x32,0x37,0x30,0x3b,0x0a,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x75,0x73,
+    0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x41,0x72,0x72,0x61,0x79,0x20,0x73,0x70,
+    0x6c,0x61,0x74,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x70,0x6c,0x61,
+    0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x3b,0x0a,0x75,0x6e,0x69,0x66,0x6f,
+    0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x63,0x68,0x75,
+    0x6e,0x6b,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x70,0x6c,0x61,0x74,
+    0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x3b,0x0a,0x0a,0x75,0x76,0x65,0x63,0x34,
+    0x20,0x66,0x65,0x74,0x63,0x68,0x5f,0x73,0x70,0x6c,0x61,0x74,0x28,0x75,0x69,0x6e,
+    0x74,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x69,0x64,0x78,0x29,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x5f,0x33,0x31,0x20,0x3d,0x20,0x69,0x6e,0x74,
+    0x28,0x73,0x70,0x6c,0x61,0x74,0x5f,0x69,0x64,0x78,0x29,0x20,0x2f,0x20,0x5f,0x34,
+    0x30,0x2e,0x73,0x70,0x6c,0x61,0x74,0x73,0x5f,0x70,0x65,0x72,0x5f,0x6c,0x61,0x79,
+    0x65,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x5f,0x33,0x37,0x20,
+    0x3d,0x20,0x69,0x6e,0x74,0x28,0x73,0x70,0x6c,0x61,0x74,0x5f,0x69,0x64,0x78,0x29,
+    0x20,0x2d,0x20,0x28,0x5f,0x33,0x31,0x20,0x2a,0x20,0x5f,0x34,0x30,0x2e,0x73,0x70,
+    0x6c,0x61,0x74,0x73,0x5f,0x70,0x65,0x72,0x5f,0x6c,0x61,0x79,0x65,0x72,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x74,0x65,0x78,0x65,
+    0x6c,0x46,0x65,0x74,0x63,0x68,0x28,0x73,0x70,0x6c,0x61,0x74,0x5f,0x74,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x5f,0x73,0x70,0x6c,0x61,0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,
+    0x65,0x72,0x2c,0x20,0x69,0x76,0x65,0x63,0x33,0x28,0x5f,0x33,0x37,0x20,0x25,0x20,
+    0x5f,0x34,0x30,0x2e,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x77,0x69,0x64,0x74,
+    0x68,0x2c,0x20,0x5f,0x33,0x37,0x20,0x2f,0x20,0x5f,0x34,0x30,0x2e,0x74,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x5f,0x77,0x69,0x64,0x74,0x68,0x2c,0x20,0x5f,0x33,0x31,0x29,
+    0x2c,0x20,0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x75,0x69,0x6e,0x74,0x20,0x73,0x63,
+    0x6f,0x72,0x65,0x5f,0x62,0x69,0x6e,0x28,0x75,0x69,0x6e,0x74,0x20,0x73,0x70,0x6c,
+    0x61,0x74,0x5f,0x69,0x64,0x78,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,
+    0x6e,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x73,0x70,0x6c,0x61,0x74,
+    0x5f,0x69,0x64,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x76,0x65,0x63,0x34,0x20,
+    0x5f,0x38,0x30,0x20,0x3d,0x20,0x66,0x65,0x74,0x63,0x68,0x5f,0x73,0x70,0x6c,0x61,
+    0x74,0x28,0x70,0x61,0x72,0x61,0x6d,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,
+    0x6e,0x74,0x20,0x5f,0x38,0x34,0x20,0x3d,0x20,0x5f,0x38,0x30,0x2e,0x77,0x20,0x26,
+    0x20,0x32,0x35,0x35,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,
+    0x38,0x34,0x20,0x3c,0x20,0x33,0x75,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x30,0x75,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,
+    0x5f,0x31,0x31,0x32,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,0x73,0x70,0x6c,0x61,0x74,
+    0x5f,0x69,0x64,0x78,0x29,0x20,0x2f,0x20,0x32,0x35,0x36,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x69,0x76,0x65,0x63,0x32,0x20,0x5f,0x31,0x32,0x30,0x20,0x3d,0x20,0x69,0x76,
+    0x65,0x63,0x32,0x28,0x28,0x5f,0x31,0x31,0x32,0x20,0x25,0x20,0x31,0x30,0x32,0x34,
+    0x29,0x20,0x2a,0x20,0x32,0x2c,0x20,0x5f,0x31,0x31,0x32,0x20,0x2f,0x20,0x31,0x30,
+    0x32,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x5f,0x31,
+    0x32,0x38,0x20,0x3d,0x20,0x74,0x65,0x78,0x65,0x6c,0x46,0x65,0x74,0x63,0x68,0x28,
+    0x63,0x68,0x75,0x6e,0x6b,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x70,
+    0x6c,0x61,0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x5f,0x31,0x32,
+    0x30,0x2c,0x20,0x30,0x29,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,
+    0x65,0x63,0x33,0x20,0x5f,0x31,0x33,0x38,0x20,0x3d,0x20,0x5f,0x31,0x32,0x38,0x20,
+    0x2b,0x20,0x28,0x28,0x76,0x65,0x63,0x33,0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x28,
+    0x5f,0x38,0x30,0x2e,0x78,0x20,0x3e,0x3e,0x20,0x31,0x36,0x75,0x29,0x20,0x26,0x20,
+    0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x5f,
+    0x38,0x30,0x2e,0x78,0x20,0x26,0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x2c,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x28,0x28,0x5f,0x38,0x30,0x2e,0x79,0x20,0x3e,0x3e,0x20,
+    0x31,0x36,0x75,0x29,0x20,0x26,0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x29,0x20,
+    0x2a,0x20,0x31,0x2e,0x35,0x32,0x35,0x39,0x30,0x32,0x31,0x38,0x39,0x33,0x31,0x34,
+    0x33,0x36,0x35,0x33,0x38,0x36,0x39,0x36,0x32,0x38,0x39,0x30,0x36,0x32,0x35,0x65,
+    0x2d,0x30,0x35,0x29,0x20,0x2a,0x20,0x28,0x74,0x65,0x78,0x65,0x6c,0x46,0x65,0x74,
+    0x63,0x68,0x28,0x63,0x68,0x75,0x6e,0x6b,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x5f,0x73,0x70,0x6c,0x61,0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,
+    0x5f,0x31,0x32,0x30,0x20,0x2b,0x20,0x69,0x76,0x65,0x63,0x32,0x28,0x31,0x2c,0x20,
+    0x30,0x29,0x2c,0x20,0x30,0x29,0x2e,0x78,0x79,0x7a,0x20,0x2d,0x20,0x5f,0x31,0x32,
+    0x38,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,
+    0x31,0x34,0x36,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x31,0x33,0x38,0x20,0x2d,
+    0x20,0x5f,0x34,0x30,0x2e,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x70,0x6f,0x73,0x69,
+    0x74,0x69,0x6f,0x6e,0x2c,0x20,0x5f,0x34,0x30,0x2e,0x63,0x61,0x6d,0x65,0x72,0x61,
+    0x5f,0x66,0x6f,0x72,0x77,0x61,0x72,0x64,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,
+    0x66,0x20,0x28,0x5f,0x31,0x34,0x36,0x20,0x3c,0x20,0x30,0x2e,0x30,0x30,0x31,0x30,
+    0x30,0x30,0x30,0x30,0x30,0x30,0x34,0x37,0x34,0x39,0x37,0x34,0x35,0x31,0x33,0x30,
+    0x35,0x33,0x38,0x39,0x34,0x30,0x34,0x32,0x39,0x36,0x38,0x37,0x35,0x29,0x0a,0x20,
+    0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,
+    0x75,0x72,0x6e,0x20,0x30,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
+    0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x31,0x36,0x36,0x20,0x3d,0x20,0x65,0x78,
+    0x70,0x28,0x28,0x76,0x65,0x63,0x32,0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x28,0x5f,
+    0x38,0x30,0x2e,0x7a,0x20,0x3e,0x3e,0x20,0x31,0x36,0x75,0x29,0x20,0x26,0x20,0x32,
+    0x35,0x35,0x75,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x28,0x5f,0x38,0x30,
+    0x2e,0x7a,0x20,0x3e,0x3e,0x20,0x38,0x75,0x29,0x20,0x26,0x20,0x32,0x35,0x35,0x75,
+    0x29,0x29,0x20,0x2a,0x20,0x30,0x2e,0x30,0x33,0x39,0x32,0x31,0x35,0x36,0x38,0x37,
+    0x36,0x36,0x32,0x33,0x36,0x33,0x30,0x35,0x32,0x33,0x36,0x38,0x31,0x36,0x34,0x30,
+    0x36,0x32,0x35,0x29,0x20,0x2d,0x20,0x76,0x65,0x63,0x32,0x28,0x35,0x2e,0x30,0x29,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,0x37,
+    0x31,0x20,0x3d,0x20,0x5f,0x34,0x30,0x2e,0x66,0x6f,0x63,0x61,0x6c,0x5f,0x70,0x78,
+    0x20,0x2f,0x20,0x5f,0x31,0x34,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,
+    0x34,0x20,0x5f,0x31,0x37,0x36,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x5f,0x31,
+    0x33,0x38,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,
+    0x63,0x34,0x20,0x5f,0x31,0x39,0x37,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x64,
+    0x6f,0x74,0x28,0x5f,0x34,0x30,0x2e,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,
+    0x72,0x6f,0x77,0x30,0x2c,0x20,0x5f,0x31,0x37,0x36,0x29,0x2c,0x20,0x64,0x6f,0x74,
+    0x28,0x5f,0x34,0x30,0x2e,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,
+    0x77,0x31,0x2c,0x20,0x5f,0x31,0x37,0x36,0x29,0x2c,0x20,0x64,0x6f,0x74,0x28,0x5f,
+    0x34,0x30,0x2e,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x32,
+    0x2c,0x20,0x5f,0x31,0x37,0x36,0x29,0x2c,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x30,
+    0x2e,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x33,0x2c,0x20,
+    0x5f,0x31,0x37,0x36,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x5f,0x32,0x30,0x35,0x20,0x3d,0x20,0x28,0x30,0x2e,0x35,0x20,0x2a,0x20,
+    0x6d,0x61,0x78,0x28,0x5f,0x31,0x36,0x36,0x2e,0x78,0x2c,0x20,0x5f,0x31,0x36,0x36,
+    0x2e,0x79,0x29,0x29,0x20,0x2a,0x20,0x5f,0x31,0x37,0x31,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x32,0x30,0x39,0x20,0x3d,0x20,0x5f,0x31,0x39,
+    0x37,0x2e,0x78,0x79,0x20,0x2f,0x20,0x76,0x65,0x63,0x32,0x28,0x5f,0x31,0x39,0x37,
+    0x2e,0x77,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x28,0x61,0x62,
+    0x73,0x28,0x5f,0x32,0x30,0x39,0x2e,0x78,0x29,0x20,0x3e,0x20,0x28,0x31,0x2e,0x30,
+    0x20,0x2b,0x20,0x28,0x28,0x32,0x2e,0x30,0x20,0x2a,0x20,0x5f,0x32,0x30,0x35,0x29,
+    0x20,0x2f,0x20,0x5f,0x34,0x30,0x2e,0x76,0x69,0x65,0x77,0x70,0x6f,0x72,0x74,0x5f,
+    0x77,0x69,0x64,0x74,0x68,0x29,0x29,0x29,0x20,0x7c,0x7c,0x20,0x28,0x61,0x62,0x73,
+    0x28,0x5f,0x32,0x30,0x39,0x2e,0x79,0x29,0x20,0x3e,0x20,0x28,0x31,0x2e,0x30,0x20,
+    0x2b,0x20,0x28,0x28,0x32,0x2e,0x30,0x20,0x2a,0x20,0x5f,0x32,0x30,0x35,0x29,0x20,
+    0x2f,0x20,0x5f,0x34,0x30,0x2e,0x76,0x69,0x65,0x77,0x70,0x6f,0x72,0x74,0x5f,0x68,
+    0x65,0x69,0x67,0x68,0x74,0x29,0x29,0x29,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x30,
+    0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x5f,0x32,0x33,0x35,0x20,0x3d,0x20,0x28,0x28,0x28,0x28,0x5f,0x31,
+    0x36,0x36,0x2e,0x78,0x20,0x2a,0x20,0x5f,0x31,0x36,0x36,0x2e,0x79,0x29,0x20,0x2a,
+    0x20,0x5f,0x31,0x37,0x31,0x29,0x20,0x2a,0x20,0x5f,0x31,0x37,0x31,0x29,0x20,0x2a,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x5f,0x38,0x34,0x29,0x29,0x20,0x2a,0x20,0x30,
+    0x2e,0x30,0x30,0x33,0x39,0x32,0x31,0x35,0x36,0x38,0x38,0x35,0x39,0x33,0x36,0x38,
+    0x35,0x36,0x32,0x36,0x39,0x38,0x33,0x36,0x34,0x32,0x35,0x37,0x38,0x31,0x32,0x35,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x21,0x28,0x5f,0x32,0x33,0x35,
+    0x20,0x3e,0x20,0x30,0x2e,0x30,0x29,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x30,0x75,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+    0x72,0x6e,0x20,0x75,0x69,0x6e,0x74,0x28,0x63,0x6c,0x61,0x6d,0x70,0x28,0x28,0x28,
+    0x6c,0x6f,0x67,0x32,0x28,0x5f,0x32,0x33,0x35,0x29,0x20,0x2b,0x20,0x31,0x36,0x2e,
+    0x30,0x29,0x20,0x2a,0x20,0x32,0x35,0x2e,0x35,0x37,0x35,0x30,0x30,0x30,0x37,0x36,
+    0x32,0x39,0x33,0x39,0x34,0x35,0x33,0x31,0x32,0x35,0x29,0x20,0x2b,0x20,0x31,0x2e,
+    0x30,0x2c,0x20,0x31,0x2e,0x30,0x2c,0x20,0x31,0x30,0x32,0x33,0x2e,0x30,0x29,0x29,
+    0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x6e,0x74,0x28,0x67,
+    0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,
+    0x6f,0x6e,0x49,0x44,0x2e,0x78,0x29,0x20,0x3e,0x3d,0x20,0x5f,0x34,0x30,0x2e,0x63,
+    0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x5f,0x63,0x6f,0x75,0x6e,0x74,0x29,0x0a,
+    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,
+    0x74,0x75,0x72,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
+    0x75,0x69,0x6e,0x74,0x20,0x5f,0x32,0x36,0x35,0x20,0x3d,0x20,0x28,0x5f,0x34,0x30,
+    0x2e,0x75,0x73,0x65,0x5f,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x73,0x20,
+    0x21,0x3d,0x20,0x30,0x29,0x20,0x3f,0x20,0x5f,0x32,0x35,0x30,0x2e,0x63,0x61,0x6e,
+    0x64,0x69,0x64,0x61,0x74,0x65,0x73,0x5b,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,
+    0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x5d,
+    0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3a,0x20,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,
+    0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x31,0x20,0x3d,0x20,0x5f,0x32,0x36,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,
+    0x69,0x6e,0x74,0x20,0x5f,0x32,0x36,0x38,0x20,0x3d,0x20,0x73,0x63,0x6f,0x72,0x65,
+    0x5f,0x62,0x69,0x6e,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x5f,0x32,0x36,0x32,0x2e,0x62,0x69,0x6e,0x73,0x5b,0x67,0x6c,0x5f,
+    0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,
+    0x49,0x44,0x2e,0x78,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x5f,0x32,
+    0x36,0x38,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,0x32,0x37,
+    0x35,0x20,0x3d,0x20,0x61,0x74,0x6f,0x6d,0x69,0x63,0x41,0x64,0x64,0x28,0x5f,0x32,
+    0x37,0x30,0x2e,0x73,0x74,0x61,0x74,0x65,0x5b,0x5f,0x32,0x36,0x38,0x5d,0x2e,0x76,
+    0x61,0x6c,0x75,0x65,0x2c,0x20,0x31,0x75,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 410
+    #extension GL_ARB_compute_shader : require
+    #extension GL_ARB_shader_storage_buffer_object : require
+    layout(local_size_x = 256, local_size_y = 1, local_size_z = 1) in;
+
+    struct SelectValue
+    {
+        uint value;
+    };
+
+    struct SelectSplatTexel
+    {
+        uvec4 value;
+    };
+
+    struct select_params
+    {
+        vec4 viewProj_row0;
+        vec4 viewProj_row1;
+        vec4 viewProj_row2;
+        vec4 viewProj_row3;
+        vec3 camera_position;
+        float focal_px;
+        vec3 camera_forward;
+        float viewport_width;
+        float viewport_height;
+        int candidate_count;
+        int use_candidates;
+        int budget;
+        int texture_width;
+        int splats_per_layer;
+    };
+
+    uniform select_params _40;
+
+    layout(std430) readonly buffer splat_buffer
+    {
+        SelectSplatTexel splats[];
+    } _25;
+
+    layout(std430) readonly buffer candidate_input
+    {
+        SelectValue candidates[];
+    } _250;
+
+    layout(std430) buffer bin_buffer
+    {
+        SelectValue bins[];
+    } _262;
+
+    layout(std430) buffer select_state
+    {
+        SelectValue state[];
+    } _270;
+
+    uniform sampler2D chunk_texture_splat_sampler;
+
+    uvec4 fetch_splat(uint splat_idx)
+    {
+        return _25.splats[splat_idx].value;
+    }
+
+    uint score_bin(uint splat_idx)
+    {
+        uint param = splat_idx;
+        uvec4 _80 = fetch_splat(param);
+        uint _84 = _80.w & 255u;
+        if (_84 < 3u)
+        {
+            return 0u;
+        }
+        int _112 = int(splat_idx) / 256;
+        ivec2 _120 = ivec2((_112 % 1024) * 2, _112 / 1024);
+        vec3 _128 = texelFetch(chunk_texture_splat_sampler, _120, 0).xyz;
+        vec3 _138 = _128 + ((vec3(float((_80.x >> 16u) & 65535u), float(_80.x & 65535u), float((_80.y >> 16u) & 65535u)) * 1.525902189314365386962890625e-05) * (texelFetch(chunk_texture_splat_sampler, _120 + ivec2(1, 0), 0).xyz - _128));
+        float _146 = dot(_138 - _40.camera_position, _40.camera_forward);
+        if (_146 < 0.001000000047497451305389404296875)
+        {
+            return 0u;
+        }
+        vec2 _166 = exp((vec2(float((_80.z >> 16u) & 255u), float((_80.z >> 8u) & 255u)) * 0.0392156876623630523681640625) - vec2(5.0));
+        float _171 = _40.focal_px / _146;
+        vec4 _176 = vec4(_138, 1.0);
+        vec4 _197 = vec4(dot(_40.viewProj_row0, _176), dot(_40.viewProj_row1, _176), dot(_40.viewProj_row2, _176), dot(_40.viewProj_row3, _176));
+        float _205 = (0.5 * max(_166.x, _166.y)) * _171;
+        vec2 _209 = _197.xy / vec2(_197.w);
+        if ((abs(_209.x) > (1.0 + ((2.0 * _205) / _40.viewport_width))) || (abs(_209.y) > (1.0 + ((2.0 * _205) / _40.viewport_height))))
+        {
+            return 0u;
+        }
+        float _235 = ((((_166.x * _166.y) * _171) * _171) * float(_84)) * 0.0039215688593685626983642578125;
+        if (!(_235 > 0.0))
+        {
+            return 0u;
+        }
+        return uint(clamp(((log2(_235) + 16.0) * 25.575000762939453125) + 1.0, 1.0, 1023.0));
+    }
+
+    void main()
+    {
+        if (int(gl_GlobalInvocationID.x) >= _40.candidate_count)
+        {
+            return;
+        }
+        uint _265 = (_40.use_candidates != 0) ? _250.candidates[gl_GlobalInvocationID.x].value : gl_GlobalInvocationID.x;
+        uint param_1 = _265;
+        uint _268 = score_bin(param_1);
+        _262.bins[gl_GlobalInvocationID.x].value = _268;
+        uint _275 = atomicAdd(_270.state[_268].value, 1u);
+    }
+
+*/
+static const uint8_t score_bins_buffer_source_glsl410[3071] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x31,0x30,0x0a,0x23,0x65,0x78,
+    0x74,0x65,0x6e,0x73,0x69,0x6f,0x6e,0x20,0x47,0x4c,0x5f,0x41,0x52,0x42,0x5f,0x63,
+    0x6f,0x6d,0x70,0x75,0x74,0x65,0x5f,0x73,0x68,0x61,0x64,0x65,0x72,0x20,0x3a,0x20,
+    0x72,0x65,0x71,0x75,0x69,0x72,0x65,0x0a,0x23,0x65,0x78,0x74,0x65,0x6e,0x73,0x69,
+    0x6f,0x6e,0x20,0x47,0x4c,0x5f,0x41,0x52,0x42,0x5f,0x73,0x68,0x61,0x64,0x65,0x72,
+    0x5f,0x73,0x74,0x6f,0x72,0x61,0x67,0x65,0x5f,0x62,0x75,0x66,0x66,0x65,0x72,0x5f,
+    0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x3a,0x20,0x72,0x65,0x71,0x75,0x69,0x72,0x65,
+    0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x6c,0x5f,0x73,0x69,
+    0x7a,0x65,0x5f,0x78,0x20,0x3d,0x20,0x32,0x35,0x36,0x2c,0x20,0x6c,0x6f,0x63,0x61,
+    0x6c,0x5f,0x73,0x69,0x7a,0x65,0x5f,0x79,0x20,0x3d,0x20,0x31,0x2c,0x20,0x6c,0x6f,
+    0x63,0x61,0x6c,0x5f,0x73,0x69,0x7a,0x65,0x5f,0x7a,0x20,0x3d,0x20,0x31,0x29,0x20,
+    0x69,0x6e,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x65,0x6c,0x65,
+    0x63,0x74,0x56,0x61,0x6c,0x75,0x65,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,
+    0x6e,0x74,0x20,0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,
+    0x72,0x75,0x63,0x74,0x20,0x53,0x65,0x6c,0x65,0x63,0x74,0x53,0x70,0x6c,0x61,0x74,
+    0x54,0x65,0x78,0x65,0x6c,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x76,0x65,0x63,
+    0x34,0x20,0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,
+    0x75,0x63,0x74,0x20,0x73,0x65,0x6c,0x65,0x63,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x69,0x65,
+    0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x76,0x65,0x63,0x34,0x20,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,
+    0x77,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x69,0x65,
+    0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x76,0x65,0x63,0x34,0x20,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,
+    0x77,0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x63,0x61,0x6d,
+    0x65,0x72,0x61,0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x66,0x6f,0x63,0x61,0x6c,0x5f,0x70,0x78,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x63,0x61,0x6d,0x65,0x72,
+    0x61,0x5f,0x66,0x6f,0x72,0x77,0x61,0x72,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x76,0x69,0x65,0x77,0x70,0x6f,0x72,0x74,0x5f,0x77,0x69,
+    0x64,0x74,0x68,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,
+    0x69,0x65,0x77,0x70,0x6f,0x72,0x74,0x5f,0x68,0x65,0x69,0x67,0x68,0x74,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,
+    0x65,0x5f,0x63,0x6f,0x75,0x6e,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,
+    0x20,0x75,0x73,0x65,0x5f,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x73,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x62,0x75,0x64,0x67,0x65,0x74,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x5f,0x77,0x69,0x64,0x74,0x68,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,
+    0x73,0x70,0x6c,0x61,0x74,0x73,0x5f,0x70,0x65,0x72,0x5f,0x6c,0x61,0x79,0x65,0x72,
+    0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x65,
+    0x6c,0x65,0x63,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,0x5f,0x34,0x30,0x3b,
+    0x0a,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x73,0x74,0x64,0x34,0x33,0x30,0x29,
+    0x20,0x72,0x65,0x61,0x64,0x6f,0x6e,0x6c,0x79,0x20,0x62,0x75,0x66,0x66,0x65,0x72,
+    0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x62,0x75,0x66,0x66,0x65,0x72,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x53,0x65,0x6c,0x65,0x63,0x74,0x53,0x70,0x6c,0x61,0x74,0x54,
+    0x65,0x78,0x65,0x6c,0x20,0x73,0x70,0x6c,0x61,0x74,0x73,0x5b,0x5d,0x3b,0x0a,0x7d,
+    0x20,0x5f,0x32,0x35,0x3b,0x0a,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x73,0x74,
+    0x64,0x34,0x33,0x30,0x29,0x20,0x72,0x65,0x61,0x64,0x6f,0x6e,0x6c,0x79,0x20,0x62,
+    0x75,0x66,0x66,0x65,0x72,0x20,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x5f,
+    0x69,0x6e,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x53,0x65,0x6c,0x65,
+    0x63,0x74,0x56,0x61,0x6c,0x75,0x65,0x20,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,
+    0x65,0x73,0x5b,0x5d,0x3b,0x0a,0x7d,0x20,0x5f,0x32,0x35,0x30,0x3b,0x0a,0x0a,0x6c,
+    0x61,0x79,0x6f,0x75,0x74,0x28,0x73,0x74,0x64,0x34,0x33,0x30,0x29,0x20,0x62,0x75,
+    0x66,0x66,0x65,0x72,0x20,0x62,0x69,0x6e,0x5f,0x62,0x75,0x66,0x66,0x65,0x72,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x53,0x65,0x6c,0x65,0x63,0x74,0x56,0x61,0x6c,0x75,
+    0x65,0x20,0x62,0x69,0x6e,0x73,0x5b,0x5d,0x3b,0x0a,0x7d,0x20,0x5f,0x32,0x36,0x32,
+    0x3b,0x0a,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x73,0x74,0x64,0x34,0x33,0x30,
+    0x29,0x20,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x73,0x65,0x6c,0x65,0x63,0x74,0x5f,
+    0x73,0x74,0x61,0x74,0x65,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x53,0x65,0x6c,0x65,
+    0x63,0x74,0x56,0x61,0x6c,0x75,0x65,0x20,0x73,0x74,0x61,0x74,0x65,0x5b,0x5d,0x3b,
+    0x0a,0x7d,0x20,0x5f,0x32,0x37,0x30,0x3b,0x0a,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,
+    0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x63,0x68,0x75,0x6e,
+    0x6b,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x70,0x6c,0x61,0x74,0x5f,
+    0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x3b,0x0a,0x0a,0x75,0x76,0x65,0x63,0x34,0x20,
+    0x66,0x65,0x74,0x63,0x68,0x5f,0x73,0x70,0x6c,0x61,0x74,0x28,0x75,0x69,0x6e,0x74,
+    0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x69,0x64,0x78,0x29,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5f,0x32,0x35,0x2e,0x73,0x70,0x6c,
+    0x61,0x74,0x73,0x5b,0x73,0x70,0x6c,0x61,0x74,0x5f,0x69,0x64,0x78,0x5d,0x2e,0x76,
+    0x61,0x6c,0x75,0x65,0x3b,0x0a,0x7d,0x0a,0x0a,0x75,0x69,0x6e,0x74,0x20,0x73,0x63,
+    0x6f,0x72,0x65,0x5f,0x62,0x69,0x6e,0x28,0x75,0x69,0x6e,0x74,0x20,0x73,0x70,0x6c,
+    0x61,0x74,0x5f,0x69,0x64,0x78,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,
+    0x6e,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x73,0x70,0x6c,0x61,0x74,
+    0x5f,0x69,0x64,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x76,0x65,0x63,0x34,0x20,
+    0x5f,0x38,0x30,0x20,0x3d,0x20,0x66,0x65,0x74,0x63,0x68,0x5f,0x73,0x70,0x6c,0x61,
+    0x74,0x28,0x70,0x61,0x72,0x61,0x6d,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,
+    0x6e,0x74,0x20,0x5f,0x38,0x34,0x20,0x3d,0x20,0x5f,0x38,0x30,0x2e,0x77,0x20,0x26,
+    0x20,0x32,0x35,0x35,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,
+    0x38,0x34,0x20,0x3c,0x20,0x33,0x75,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x30,0x75,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,
+    0x5f,0x31,0x31,0x32,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,0x73,0x70,0x6c,0x61,0x74,
+    0x5f,0x69,0x64,0x78,0x29,0x20,0x2f,0x20,0x32,0x35,0x36,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x69,0x76,0x65,0x63,0x32,0x20,0x5f,0x31,0x32,0x30,0x20,0x3d,0x20,0x69,0x76,
+    0x65,0x63,0x32,0x28,0x28,0x5f,0x31,0x31,0x32,0x20,0x25,0x20,0x31,0x30,0x32,0x34,
+    0x29,0x20,0x2a,0x20,0x32,0x2c,0x20,0x5f,0x31,0x31,0x32,0x20,0x2f,0x20,0x31,0x30,
+    0x32,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x5f,0x31,
+    0x32,0x38,0x20,0x3d,0x20,0x74,0x65,0x78,0x65,0x6c,0x46,0x65,0x74,0x63,0x68,0x28,
+    0x63,0x68,0x75,0x6e,0x6b,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x70,
+    0x6c,0x61,0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x5f,0x31,0x32,
+    0x30,0x2c,0x20,0x30,0x29,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,
+    0x65,0x63,0x33,0x20,0x5f,0x31,0x33,0x38,0x20,0x3d,0x20,0x5f,0x31,0x32,0x38,0x20,
+    0x2b,0x20,0x28,0x28,0x76,0x65,0x63,0x33,0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x28,
+    0x5f,0x38,0x30,0x2e,0x78,0x20,0x3e,0x3e,0x20,0x31,0x36,0x75,0x29,0x20,0x26,0x20,
+    0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x5f,
+    0x38,0x30,0x2e,0x78,0x20,0x26,0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x2c,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x28,0x28,0x5f,0x38,0x30,0x2e,0x79,0x20,0x3e,0x3e,0x20,
+    0x31,0x36,0x75,0x29,0x20,0x26,0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x29,0x20,
+    0x2a,0x20,0x31,0x2e,0x35,0x32,0x35,0x39,0x30,0x32,0x31,0x38,0x39,0x33,0x31,0x34,
+    0x33,0x36,0x35,0x33,0x38,0x36,0x39,0x36,0x32,0x38,0x39,0x30,0x36,0x32,0x35,0x65,
+    0x2d,0x30,0x35,0x29,0x20,0x2a,0x20,0x28,0x74,0x65,0x78,0x65,0x6c,0x46,0x65,0x74,
+    0x63,0x68,0x28,0x63,0x68,0x75,0x6e,0x6b,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x5f,0x73,0x70,0x6c,0x61,0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,
+    0x5f,0x31,0x32,0x30,0x20,0x2b,0x20,0x69,0x76,0x65,0x63,0x32,0x28,0x31,0x2c,0x20,
+    0x30,0x29,0x2c,0x20,0x30,0x29,0x2e,0x78,0x79,0x7a,0x20,0x2d,0x20,0x5f,0x31,0x32,
+    0x38,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,
+    0x31,0x34,0x36,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x31,0x33,0x38,0x20,0x2d,
+    0x20,0x5f,0x34,0x30,0x2e,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x70,0x6f,0x73,0x69,
+    0x74,0x69,0x6f,0x6e,0x2c,0x20,0x5f,0x34,0x30,0x2e,0x63,0x61,0x6d,0x65,0x72,0x61,
+    0x5f,0x66,0x6f,0x72,0x77,0x61,0x72,0x64,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,
+    0x66,0x20,0x28,0x5f,0x31,0x34,0x36,0x20,0x3c,0x20,0x30,0x2e,0x30,0x30,0x31,0x30,
+    0x30,0x30,0x30,0x30,0x30,0x30,0x34,0x37,0x34,0x39,0x37,0x34,0x35,0x31,0x33,0x30,
+    0x35,0x33,0x38,0x39,0x34,0x30,0x34,0x32,0x39,0x36,0x38,0x37,0x35,0x29,0x0a,0x20,
+    0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,
+    0x75,0x72,0x6e,0x20,0x30,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
+    0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x31,0x36,0x36,0x20,0x3d,0x20,0x65,0x78,
+    0x70,0x28,0x28,0x76,0x65,0x63,0x32,0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x28,0x5f,
+    0x38,0x30,0x2e,0x7a,0x20,0x3e,0x3e,0x20,0x31,0x36,0x75,0x29,0x20,0x26,0x20,0x32,
+    0x35,0x35,0x75,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x28,0x5f,0x38,0x30,
+    0x2e,0x7a,0x20,0x3e,0x3e,0x20,0x38,0x75,0x29,0x20,0x26,0x20,0x32,0x35,0x35,0x75,
+    0x29,0x29,0x20,0x2a,0x20,0x30,0x2e,0x30,0x33,0x39,0x32,0x31,0x35,0x36,0x38,0x37,
+    0x36,0x36,0x32,0x33,0x36,0x33,0x30,0x35,0x32,0x33,0x36,0x38,0x31,0x36,0x34,0x30,
+    0x36,0x32,0x35,0x29,0x20,0x2d,0x20,0x76,0x65,0x63,0x32,0x28,0x35,0x2e,0x30,0x29,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,0x37,
+    0x31,0x20,0x3d,0x20,0x5f,0x34,0x30,0x2e,0x66,0x6f,0x63,0x61,0x6c,0x5f,0x70,0x78,
+    0x20,0x2f,0x20,0x5f,0x31,0x34,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,
+    0x34,0x20,0x5f,0x31,0x37,0x36,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x5f,0x31,
+    0x33,0x38,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,
+    0x63,0x34,0x20,0x5f,0x31,0x39,0x37,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x64,
+    0x6f,0x74,0x28,0x5f,0x34,0x30,0x2e,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,
+    0x72,0x6f,0x77,0x30,0x2c,0x20,0x5f,0x31,0x37,0x36,0x29,0x2c,0x20,0x64,0x6f,0x74,
+    0x28,0x5f,0x34,0x30,0x2e,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,
+    0x77,0x31,0x2c,0x20,0x5f,0x31,0x37,0x36,0x29,0x2c,0x20,0x64,0x6f,0x74,0x28,0x5f,
+    0x34,0x30,0x2e,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x32,
+    0x2c,0x20,0x5f,0x31,0x37,0x36,0x29,0x2c,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x30,
+    0x2e,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x33,0x2c,0x20,
+    0x5f,0x31,0x37,0x36,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x5f,0x32,0x30,0x35,0x20,0x3d,0x20,0x28,0x30,0x2e,0x35,0x20,0x2a,0x20,
+    0x6d,0x61,0x78,0x28,0x5f,0x31,0x36,0x36,0x2e,0x78,0x2c,0x20,0x5f,0x31,0x36,0x36,
+    0x2e,0x79,0x29,0x29,0x20,0x2a,0x20,0x5f,0x31,0x37,0x31,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x32,0x30,0x39,0x20,0x3d,0x20,0x5f,0x31,0x39,
+    0x37,0x2e,0x78,0x79,0x20,0x2f,0x20,0x76,0x65,0x63,0x32,0x28,0x5f,0x31,0x39,0x37,
+    0x2e,0x77,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x28,0x61,0x62,
+    0x73,0x28,0x5f,0x32,0x30,0x39,0x2e,0x78,0x29,0x20,0x3e,0x20,0x28,0x31,0x2e,0x30,
+    0x20,0x2b,0x20,0x28,0x28,0x32,0x2e,0x30,0x20,0x2a,0x20,0x5f,0x32,0x30,0x35,0x29,
+    0x20,0x2f,0x20,0x5f,0x34,0x30,0x2e,0x76,0x69,0x65,0x77,0x70,0x6f,0x72,0x74,0x5f,
+    0x77,0x69,0x64,0x74,0x68,0x29,0x29,0x29,0x20,0x7c,0x7c,0x20,0x28,0x61,0x62,0x73,
+    0x28,0x5f,0x32,0x30,0x39,0x2e,0x79,0x29,0x20,0x3e,0x20,0x28,0x31,0x2e,0x30,0x20,
+    0x2b,0x20,0x28,0x28,0x32,0x2e,0x30,0x20,0x2a,0x20,0x5f,0x32,0x30,0x35,0x29,0x20,
+    0x2f,0x20,0x5f,0x34,0x30,0x2e,0x76,0x69,0x65,0x77,0x70,0x6f,0x72,0x74,0x5f,0x68,
+    0x65,0x69,0x67,0x68,0x74,0x29,0x29,0x29,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x30,
+    0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x5f,0x32,0x33,0x35,0x20,0x3d,0x20,0x28,0x28,0x28,0x28,0x5f,0x31,
+    0x36,0x36,0x2e,0x78,0x20,0x2a,0x20,0x5f,0x31,0x36,0x36,0x2e,0x79,0x29,0x20,0x2a,
+    0x20,0x5f,0x31,0x37,0x31,0x29,0x20,0x2a,0x20,0x5f,0x31,0x37,0x31,0x29,0x20,0x2a,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x5f,0x38,0x34,0x29,0x29,0x20,0x2a,0x20,0x30,
+    0x2e,0x30,0x30,0x33,0x39,0x32,0x31,0x35,0x36,0x38,0x38,0x35,0x39,0x33,0x36,0x38,
+    0x35,0x36,0x32,0x36,0x39,0x38,0x33,0x36,0x34,0x32,0x35,0x37,0x38,0x31,0x32,0x35,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x21,0x28,0x5f,0x32,0x33,0x35,
+    0x20,0x3e,0x20,0x30,0x2e,0x30,0x29,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x30,0x75,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+    0x72,0x6e,0x20,0x75,0x69,0x6e,0x74,0x28,0x63,0x6c,0x61,0x6d,0x70,0x28,0x28,0x28,
+    0x6c,0x6f,0x67,0x32,0x28,0x5f,0x32,0x33,0x35,0x29,0x20,0x2b,0x20,0x31,0x36,0x2e,
+    0x30,0x29,0x20,0x2a,0x20,0x32,0x35,0x2e,0x35,0x37,0x35,0x30,0x30,0x30,0x37,0x36,
+    0x32,0x39,0x33,0x39,0x34,0x35,0x33,0x31,0x32,0x35,0x29,0x20,0x2b,0x20,0x31,0x2e,
+    0x30,0x2c,0x20,0x31,0x2e,0x30,0x2c,0x20,0x31,0x30,0x32,0x33,0x2e,0x30,0x29,0x29,
+    0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x6e,0x74,0x28,0x67,
+    0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,
+    0x6f,0x6e,0x49,0x44,0x2e,0x78,0x29,0x20,0x3e,0x3d,0x20,0x5f,0x34,0x30,0x2e,0x63,
+    0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x5f,0x63,0x6f,0x75,0x6e,0x74,0x29,0x0a,
+    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,
+    0x74,0x75,0x72,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
+    0x75,0x69,0x6e,0x74,0x20,0x5f,0x32,0x36,0x35,0x20,0x3d,0x20,0x28,0x5f,0x34,0x30,
+    0x2e,0x75,0x73,0x65,0x5f,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x73,0x20,
+    0x21,0x3d,0x20,0x30,0x29,0x20,0x3f,0x20,0x5f,0x32,0x35,0x30,0x2e,0x63,0x61,0x6e,
+    0x64,0x69,0x64,0x61,0x74,0x65,0x73,0x5b,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,
+    0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x5d,
+    0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3a,0x20,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,
+    0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x31,0x20,0x3d,0x20,0x5f,0x32,0x36,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,
+    0x69,0x6e,0x74,0x20,0x5f,0x32,0x36,0x38,0x20,0x3d,0x20,0x73,0x63,0x6f,0x72,0x65,
+    0x5f,0x62,0x69,0x6e,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x5f,0x32,0x36,0x32,0x2e,0x62,0x69,0x6e,0x73,0x5b,0x67,0x6c,0x5f,
+    0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,
+    0x49,0x44,0x2e,0x78,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x5f,0x32,
+    0x36,0x38,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,0x32,0x37,
+    0x35,0x20,0x3d,0x20,0x61,0x74,0x6f,0x6d,0x69,0x63,0x41,0x64,0x64,0x28,0x5f,0x32,
+    0x37,0x30,0x2e,0x73,0x74,0x61,0x74,0x65,0x5b,0x5f,0x32,0x36,0x38,0x5d,0x2e,0x76,
+    0x61,0x6c,0x75,0x65,0x2c,0x20,0x31,0x75,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 410
+    #extension GL_ARB_compute_shader : require
+    #extension GL_ARB_shader_storage_buffer_object : require
+    layout(local_size_x = 1, local_size_y = 1, local_size_z = 1) in;
+
+    struct SelectValue
+    {
+        uint value;
+    };
+
+    struct select_params
+    {
+        vec4 viewProj_row0;
+        vec4 viewProj_row1;
+        vec4 viewProj_row2;
+        vec4 viewProj_row3;
+        vec3 camera_position;
+        float focal_px;
+        vec3 camera_forward;
+        float viewport_width;
+        float viewport_height;
+        int candidate_count;
+        int use_candidates;
+        int budget;
+        int texture_width;
+        int splats_per_layer;
+    };
+
+    uniform select_params _40;
+
+    layout(std430) buffer select_state
+    {
+        SelectValue state[];
+    } _35;
+
+    void main()
+    {
+        uint remaining = uint(_40.budget);
+        uint threshold_bin = 0u;
+        bool found = false;
+        for (int b = 1023; b >= 0; b--)
+        {
+            uint _48 = _35.state[b].value;
+            _35.state[b].value = 0u;
+            if (found)
+            {
+                continue;
+            }
+            if (_48 >= remaining)
+            {
+                threshold_bin = uint(b);
+                found = true;
+            }
+            else
+            {
+                remaining -= _48;
+            }
+        }
+        _35.state[1024].value = threshold_bin;
+        _35.state[1025].value = remaining;
+        _35.state[1026].value = 0u;
+        _35.state[1027].value = 0u;
+    }
+
+*/
+static const uint8_t find_threshold_source_glsl410[1292] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x31,0x30,0x0a,0x23,0x65,0x78,
+    0x74,0x65,0x6e,0x73,0x69,0x6f,0x6e,0x20,0x47,0x4c,0x5f,0x41,0x52,0x42,0x5f,0x63,
+    0x6f,0x6d,0x70,0x75,0x74,0x65,0x5f,0x73,0x68,0x61,0x64,0x65,0x72,0x20,0x3a,0x20,
+    0x72,0x65,0x71,0x75,0x69,0x72,0x65,0x0a,0x23,0x65,0x78,0x74,0x65,0x6e,0x73,0x69,
+    0x6f,0x6e,0x20,0x47,0x4c,0x5f,0x41,0x52,0x42,0x5f,0x73,0x68,0x61,0x64,0x65,0x72,
+    0x5f,0x73,0x74,0x6f,0x72,0x61,0x67,0x65,0x5f,0x62,0x75,0x66,0x66,0x65,0x72,0x5f,
+    0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x3a,0x20,0x72,0x65,0x71,0x75,0x69,0x72,0x65,
+    0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x6c,0x5f,0x73,0x69,
+    0x7a,0x65,0x5f,0x78,0x20,0x3d,0x20,0x31,0x2c,0x20,0x6c,0x6f,0x63,0x61,0x6c,0x5f,
+    0x73,0x69,0x7a,0x65,0x5f,0x79,0x20,0x3d,0x20,0x31,0x2c,0x20,0x6c,0x6f,0x63,0x61,
+    0x6c,0x5f,0x73,0x69,0x7a,0x65,0x5f,0x7a,0x20,0x3d,0x20,0x31,0x29,0x20,0x69,0x6e,
+    0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x65,0x6c,0x65,0x63,0x74,
+    0x56,0x61,0x6c,0x75,0x65,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,
+    0x20,0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,
+    0x63,0x74,0x20,0x73,0x65,0x6c,0x65,0x63,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x69,0x65,0x77,
+    0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,
+    0x65,0x63,0x34,0x20,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,
+    0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x69,0x65,0x77,
+    0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,
+    0x65,0x63,0x34,0x20,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,
+    0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x63,0x61,0x6d,0x65,
+    0x72,0x61,0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x66,0x6f,0x63,0x61,0x6c,0x5f,0x70,0x78,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x63,0x61,0x6d,0x65,0x72,0x61,
+    0x5f,0x66,0x6f,0x72,0x77,0x61,0x72,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x76,0x69,0x65,0x77,0x70,0x6f,0x72,0x74,0x5f,0x77,0x69,0x64,
+    0x74,0x68,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x69,
+    0x65,0x77,0x70,0x6f,0x72,0x74,0x5f,0x68,0x65,0x69,0x67,0x68,0x74,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,
+    0x5f,0x63,0x6f,0x75,0x6e,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,
+    0x75,0x73,0x65,0x5f,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x73,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x62,0x75,0x64,0x67,0x65,0x74,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,
+    0x77,0x69,0x64,0x74,0x68,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x73,
+    0x70,0x6c,0x61,0x74,0x73,0x5f,0x70,0x65,0x72,0x5f,0x6c,0x61,0x79,0x65,0x72,0x3b,
+    0x0a,0x7d,0x3b,0x0a,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x65,0x6c,
+    0x65,0x63,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,0x5f,0x34,0x30,0x3b,0x0a,
+    0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x73,0x74,0x64,0x34,0x33,0x30,0x29,0x20,
+    0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x73,0x65,0x6c,0x65,0x63,0x74,0x5f,0x73,0x74,
+    0x61,0x74,0x65,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x53,0x65,0x6c,0x65,0x63,0x74,
+    0x56,0x61,0x6c,0x75,0x65,0x20,0x73,0x74,0x61,0x74,0x65,0x5b,0x5d,0x3b,0x0a,0x7d,
+    0x20,0x5f,0x33,0x35,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,
+    0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x72,0x65,
+    0x6d,0x61,0x69,0x6e,0x69,0x6e,0x67,0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,0x28,0x5f,
+    0x34,0x30,0x2e,0x62,0x75,0x64,0x67,0x65,0x74,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x75,0x69,0x6e,0x74,0x20,0x74,0x68,0x72,0x65,0x73,0x68,0x6f,0x6c,0x64,0x5f,0x62,
+    0x69,0x6e,0x20,0x3d,0x20,0x30,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,
+    0x6c,0x20,0x66,0x6f,0x75,0x6e,0x64,0x20,0x3d,0x20,0x66,0x61,0x6c,0x73,0x65,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x62,0x20,
+    0x3d,0x20,0x31,0x30,0x32,0x33,0x3b,0x20,0x62,0x20,0x3e,0x3d,0x20,0x30,0x3b,0x20,
+    0x62,0x2d,0x2d,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,0x34,0x38,0x20,0x3d,0x20,0x5f,0x33,
+    0x35,0x2e,0x73,0x74,0x61,0x74,0x65,0x5b,0x62,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x33,0x35,0x2e,0x73,0x74,
+    0x61,0x74,0x65,0x5b,0x62,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x30,
+    0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x66,
+    0x6f,0x75,0x6e,0x64,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6f,0x6e,0x74,
+    0x69,0x6e,0x75,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x34,0x38,0x20,
+    0x3e,0x3d,0x20,0x72,0x65,0x6d,0x61,0x69,0x6e,0x69,0x6e,0x67,0x29,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x74,0x68,0x72,0x65,0x73,0x68,0x6f,0x6c,0x64,0x5f,0x62,0x69,
+    0x6e,0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,0x28,0x62,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6f,0x75,0x6e,0x64,0x20,0x3d,
+    0x20,0x74,0x72,0x75,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x72,0x65,0x6d,0x61,0x69,0x6e,0x69,0x6e,0x67,0x20,0x2d,0x3d,
+    0x20,0x5f,0x34,0x38,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,
+    0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x5f,0x33,0x35,0x2e,0x73,0x74,
+    0x61,0x74,0x65,0x5b,0x31,0x30,0x32,0x34,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,
+    0x3d,0x20,0x74,0x68,0x72,0x65,0x73,0x68,0x6f,0x6c,0x64,0x5f,0x62,0x69,0x6e,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x5f,0x33,0x35,0x2e,0x73,0x74,0x61,0x74,0x65,0x5b,0x31,
+    0x30,0x32,0x35,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x72,0x65,0x6d,
+    0x61,0x69,0x6e,0x69,0x6e,0x67,0x3b,0x0a,0x20,0x20,0x20,0x20,0x5f,0x33,0x35,0x2e,
+    0x73,0x74,0x61,0x74,0x65,0x5b,0x31,0x30,0x32,0x36,0x5d,0x2e,0x76,0x61,0x6c,0x75,
+    0x65,0x20,0x3d,0x20,0x30,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x5f,0x33,0x35,0x2e,
+    0x73,0x74,0x61,0x74,0x65,0x5b,0x31,0x30,0x32,0x37,0x5d,0x2e,0x76,0x61,0x6c,0x75,
+    0x65,0x20,0x3d,0x20,0x30,0x75,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 410
+    #extension GL_ARB_compute_shader : require
+    #extension GL_ARB_shader_storage_buffer_object : require
+    layout(local_size_x = 256, local_size_y = 1, local_size_z = 1) in;
+
+    struct SelectValue
+    {
+        uint value;
+    };
+
+    struct select_params
+    {
+        vec4 viewProj_row0;
+        vec4 viewProj_row1;
+        vec4 viewProj_row2;
+        vec4 viewProj_row3;
+        vec3 camera_position;
+        float focal_px;
+        vec3 camera_forward;
+        float viewport_width;
+        float viewport_height;
+        int candidate_count;
+        int use_candidates;
+        int budget;
+        int texture_width;
+        int splats_per_layer;
+    };
+
+    uniform select_params _40;
+
+    layout(std430) readonly buffer candidate_input
+    {
+        SelectValue candidates[];
+    } _250;
+
+    layout(std430) buffer bin_buffer
+    {
+        SelectValue bins[];
+    } _262;
+
+    layout(std430) buffer select_state
+    {
+        SelectValue state[];
+    } _270;
+
+    layout(std430) writeonly buffer selected_output
+    {
+        SelectValue selected[];
+    } _290;
+
+    void main()
+    {
+        if (int(gl_GlobalInvocationID.x) >= _40.candidate_count)
+        {
+            return;
+        }
+        uint _41 = _262.bins[gl_GlobalInvocationID.x].value;
+        uint _49 = _270.state[1024].value;
+        bool keep = _41 > _49;
+        if (_41 == _49)
+        {
+            uint _64 = atomicAdd(_270.state[1027].value, 1u);
+            keep = _64 < _270.state[1025].value;
+        }
+        if (keep)
+        {
+            uint _77 = atomicAdd(_270.state[1026].value, 1u);
+            _290.selected[_77].value = (_40.use_candidates != 0) ? _250.candidates[gl_GlobalInvocationID.x].value : gl_GlobalInvocationID.x;
+        }
+    }
+
+*/
+static const uint8_t compact_selected_source_glsl410[1511] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x31,0x30,0x0a,0x23,0x65,0x78,
+    0x74,0x65,0x6e,0x73,0x69,0x6f,0x6e,0x20,0x47,0x4c,0x5f,0x41,0x52,0x42,0x5f,0x63,
+    0x6f,0x6d,0x70,0x75,0x74,0x65,0x5f,0x73,0x68,0x61,0x64,0x65,0x72,0x20,0x3a,0x20,
+    0x72,0x65,0x71,0x75,0x69,0x72,0x65,0x0a,0x23,0x65,0x78,0x74,0x65,0x6e,0x73,0x69,
+    0x6f,0x6e,0x20,0x47,0x4c,0x5f,0x41,0x52,0x42,0x5f,0x73,0x68,0x61,0x64,0x65,0x72,
+    0x5f,0x73,0x74,0x6f,0x72,0x61,0x67,0x65,0x5f,0x62,0x75,0x66,0x66,0x65,0x72,0x5f,
+    0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,0x3a,0x20,0x72,0x65,0x71,0x75,0x69,0x72,0x65,
+    0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x6c,0x5f,0x73,0x69,
+    0x7a,0x65,0x5f,0x78,0x20,0x3d,0x20,0x32,0x35,0x36,0x2c,0x20,0x6c,0x6f,0x63,0x61,
+    0x6c,0x5f,0x73,0x69,0x7a,0x65,0x5f,0x79,0x20,0x3d,0x20,0x31,0x2c,0x20,0x6c,0x6f,
+    0x63,0x61,0x6c,0x5f,0x73,0x69,0x7a,0x65,0x5f,0x7a,0x20,0x3d,0x20,0x31,0x29,0x20,
+    0x69,0x6e,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x65,0x6c,0x65,
+    0x63,0x74,0x56,0x61,0x6c,0x75,0x65,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,
+    0x6e,0x74,0x20,0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,
+    0x72,0x75,0x63,0x74,0x20,0x73,0x65,0x6c,0x65,0x63,0x74,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x69,
+    0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x30,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,
+    0x6f,0x77,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x69,
+    0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x32,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,
+    0x6f,0x77,0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x63,0x61,
+    0x6d,0x65,0x72,0x61,0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x66,0x6f,0x63,0x61,0x6c,0x5f,0x70,
+    0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x63,0x61,0x6d,0x65,
+    0x72,0x61,0x5f,0x66,0x6f,0x72,0x77,0x61,0x72,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x69,0x65,0x77,0x70,0x6f,0x72,0x74,0x5f,0x77,
+    0x69,0x64,0x74,0x68,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x76,0x69,0x65,0x77,0x70,0x6f,0x72,0x74,0x5f,0x68,0x65,0x69,0x67,0x68,0x74,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,
+    0x74,0x65,0x5f,0x63,0x6f,0x75,0x6e,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,
+    0x74,0x20,0x75,0x73,0x65,0x5f,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x73,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x62,0x75,0x64,0x67,0x65,0x74,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x74,0x65,0x78,0x74,0x75,0x72,
+    0x65,0x5f,0x77,0x69,0x64,0x74,0x68,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,
+    0x20,0x73,0x70,0x6c,0x61,0x74,0x73,0x5f,0x70,0x65,0x72,0x5f,0x6c,0x61,0x79,0x65,
+    0x72,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,
+    0x65,0x6c,0x65,0x63,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,0x5f,0x34,0x30,
+    0x3b,0x0a,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x73,0x74,0x64,0x34,0x33,0x30,
+    0x29,0x20,0x72,0x65,0x61,0x64,0x6f,0x6e,0x6c,0x79,0x20,0x62,0x75,0x66,0x66,0x65,
+    0x72,0x20,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x5f,0x69,0x6e,0x70,0x75,
+    0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x53,0x65,0x6c,0x65,0x63,0x74,0x56,0x61,
+    0x6c,0x75,0x65,0x20,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x73,0x5b,0x5d,
+    0x3b,0x0a,0x7d,0x20,0x5f,0x32,0x35,0x30,0x3b,0x0a,0x0a,0x6c,0x61,0x79,0x6f,0x75,
+    0x74,0x28,0x73,0x74,0x64,0x34,0x33,0x30,0x29,0x20,0x62,0x75,0x66,0x66,0x65,0x72,
+    0x20,0x62,0x69,0x6e,0x5f,0x62,0x75,0x66,0x66,0x65,0x72,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x53,0x65,0x6c,0x65,0x63,0x74,0x56,0x61,0x6c,0x75,0x65,0x20,0x62,0x69,
+    0x6e,0x73,0x5b,0x5d,0x3b,0x0a,0x7d,0x20,0x5f,0x32,0x36,0x32,0x3b,0x0a,0x0a,0x6c,
+    0x61,0x79,0x6f,0x75,0x74,0x28,0x73,0x74,0x64,0x34,0x33,0x30,0x29,0x20,0x62,0x75,
+    0x66,0x66,0x65,0x72,0x20,0x73,0x65,0x6c,0x65,0x63,0x74,0x5f,0x73,0x74,0x61,0x74,
+    0x65,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x53,0x65,0x6c,0x65,0x63,0x74,0x56,0x61,
+    0x6c,0x75,0x65,0x20,0x73,0x74,0x61,0x74,0x65,0x5b,0x5d,0x3b,0x0a,0x7d,0x20,0x5f,
+    0x32,0x37,0x30,0x3b,0x0a,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x73,0x74,0x64,
+    0x34,0x33,0x30,0x29,0x20,0x77,0x72,0x69,0x74,0x65,0x6f,0x6e,0x6c,0x79,0x20,0x62,
+    0x75,0x66,0x66,0x65,0x72,0x20,0x73,0x65,0x6c,0x65,0x63,0x74,0x65,0x64,0x5f,0x6f,
+    0x75,0x74,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x53,0x65,0x6c,0x65,
+    0x63,0x74,0x56,0x61,0x6c,0x75,0x65,0x20,0x73,0x65,0x6c,0x65,0x63,0x74,0x65,0x64,
+    0x5b,0x5d,0x3b,0x0a,0x7d,0x20,0x5f,0x32,0x39,0x30,0x3b,0x0a,0x0a,0x76,0x6f,0x69,
+    0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,
+    0x66,0x20,0x28,0x69,0x6e,0x74,0x28,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,
+    0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x29,0x20,
+    0x3e,0x3d,0x20,0x5f,0x34,0x30,0x2e,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,
+    0x5f,0x63,0x6f,0x75,0x6e,0x74,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,0x34,0x31,
+    0x20,0x3d,0x20,0x5f,0x32,0x36,0x32,0x2e,0x62,0x69,0x6e,0x73,0x5b,0x67,0x6c,0x5f,
+    0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,
+    0x49,0x44,0x2e,0x78,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,0x34,0x39,0x20,0x3d,0x20,0x5f,0x32,0x37,0x30,
+    0x2e,0x73,0x74,0x61,0x74,0x65,0x5b,0x31,0x30,0x32,0x34,0x5d,0x2e,0x76,0x61,0x6c,
+    0x75,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x6b,0x65,0x65,
+    0x70,0x20,0x3d,0x20,0x5f,0x34,0x31,0x20,0x3e,0x20,0x5f,0x34,0x39,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x34,0x31,0x20,0x3d,0x3d,0x20,0x5f,0x34,
+    0x39,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,0x36,0x34,0x20,0x3d,0x20,0x61,0x74,0x6f,0x6d,
+    0x69,0x63,0x41,0x64,0x64,0x28,0x5f,0x32,0x37,0x30,0x2e,0x73,0x74,0x61,0x74,0x65,
+    0x5b,0x31,0x30,0x32,0x37,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x2c,0x20,0x31,0x75,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6b,0x65,0x65,0x70,0x20,
+    0x3d,0x20,0x5f,0x36,0x34,0x20,0x3c,0x20,0x5f,0x32,0x37,0x30,0x2e,0x73,0x74,0x61,
+    0x74,0x65,0x5b,0x31,0x30,0x32,0x35,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x6b,0x65,
+    0x65,0x70,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,0x37,0x37,0x20,0x3d,0x20,0x61,0x74,0x6f,
+    0x6d,0x69,0x63,0x41,0x64,0x64,0x28,0x5f,0x32,0x37,0x30,0x2e,0x73,0x74,0x61,0x74,
+    0x65,0x5b,0x31,0x30,0x32,0x36,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x2c,0x20,0x31,
+    0x75,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x32,0x39,0x30,
+    0x2e,0x73,0x65,0x6c,0x65,0x63,0x74,0x65,0x64,0x5b,0x5f,0x37,0x37,0x5d,0x2e,0x76,
+    0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x28,0x5f,0x34,0x30,0x2e,0x75,0x73,0x65,0x5f,
+    0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x73,0x20,0x21,0x3d,0x20,0x30,0x29,
+    0x20,0x3f,0x20,0x5f,0x32,0x35,0x30,0x2e,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,
+    0x65,0x73,0x5b,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,
+    0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x5d,0x2e,0x76,0x61,0x6c,0x75,
+    0x65,0x20,0x3a,0x20,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,
+    0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x7d,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 310 es
+    layout(local_size_x = 256, local_size_y = 1, local_size_z = 1) in;
+
+    struct SelectValue
+    {
+        uint value;
+    };
+
+    struct select_params
+    {
+        vec4 viewProj_row0;
+        vec4 viewProj_row1;
+        vec4 viewProj_row2;
+        vec4 viewProj_row3;
+        vec3 camera_position;
+        float focal_px;
+        vec3 camera_forward;
+        float viewport_width;
+        float viewport_height;
+        int candidate_count;
+        int use_candidates;
+        int budget;
+        int texture_width;
+        int splats_per_layer;
+    };
+
+    uniform select_params _40;
+
+    layout(binding = 3, std430) readonly buffer candidate_input
+    {
+        SelectValue candidates[];
+    } _250;
+
+    layout(binding = 4, std430) buffer bin_buffer
+    {
+        SelectValue bins[];
+    } _262;
+
+    layout(binding = 5, std430) buffer select_state
+    {
+        SelectValue state[];
+    } _270;
+
+    layout(binding = 0) uniform highp usampler2DArray splat_texture_splat_sampler;
+    layout(binding = 1) uniform highp sampler2D chunk_texture_splat_sampler;
+
+    uvec4 fetch_splat(uint splat_idx)
+    {
+        int _31 = int(splat_idx) / _40.splats_per_layer;
+        int _37 = int(splat_idx) - (_31 * _40.splats_per_layer);
+        return texelFetch(splat_texture_splat_sampler, ivec3(_37 % _40.texture_width, _37 / _40.texture_width, _31), 0);
+    }
+
+    uint score_bin(uint splat_idx)
+    {
+        uint param = splat_idx;
+        uvec4 _80 = fetch_splat(param);
+        uint _84 = _80.w & 255u;
+        if (_84 < 3u)
+        {
+            return 0u;
+        }
+        int _112 = int(splat_idx) / 256;
+        ivec2 _120 = ivec2((_112 % 1024) * 2, _112 / 1024);
+        vec3 _128 = texelFetch(chunk_texture_splat_sampler, _120, 0).xyz;
+        vec3 _138 = _128 + ((vec3(float((_80.x >> 16u) & 65535u), float(_80.x & 65535u), float((_80.y >> 16u) & 65535u)) * 1.525902189314365386962890625e-05) * (texelFetch(chunk_texture_splat_sampler, _120 + ivec2(1, 0), 0).xyz - _128));
+        float _146 = dot(_138 - _40.camera_position, _40.camera_forward);
+        if (_146 < 0.001000000047497451305389404296875)
+        {
+            return 0u;
+        }
+        vec2 _166 = exp((vec2(float((_80.z >> 16u) & 255u), float((_80.z >> 8u) & 255u)) * 0.0392156876623630523681640625) - vec2(5.0));
+        float _171 = _40.focal_px / _146;
+        vec4 _176 = vec4(_138, 1.0);
+        vec4 _197 = vec4(dot(_40.viewProj_row0, _176), dot(_40.viewProj_row1, _176), dot(_40.viewProj_row2, _176), dot(_40.viewProj_row3, _176));
+        float _205 = (0.5 * max(_166.x, _166.y)) * _171;
+        vec2 _209 = _197.xy / vec2(_197.w);
+        if ((abs(_209.x) > (1.0 + ((2.0 * _205) / _40.viewport_width))) || (abs(_209.y) > (1.0 + ((2.0 * _205) / _40.viewport_height))))
+        {
+            return 0u;
+        }
+        float _235 = ((((_166.x * _166.y) * _171) * _171) * float(_84)) * 0.0039215688593685626983642578125;
+        if (!(_235 > 0.0))
+        {
+            return 0u;
+        }
+        return uint(clamp(((log2(_235) + 16.0) * 25.575000762939453125) + 1.0, 1.0, 1023.0));
+    }
+
+    void main()
+    {
+        if (int(gl_GlobalInvocationID.x) >= _40.candidate_count)
+        {
+            return;
+        }
+        uint _265 = (_40.use_candidates != 0) ? _250.candidates[gl_GlobalInvocationID.x].value : gl_GlobalInvocationID.x;
+        uint param_1 = _265;
+        uint _268 = score_bin(param_1);
+        _262.bins[gl_GlobalInvocationID.x].value = _268;
+        uint _275 = atomicAdd(_270.state[_268].value, 1u);
+    }
+
+*/
+static const uint8_t score_bins_source_glsl310es[3177] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x31,0x30,0x20,0x65,0x73,0x0a,
+    0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x6c,0x5f,0x73,0x69,0x7a,
+    0x65,0x5f,0x78,0x20,0x3d,0x20,0x32,0x35,0x36,0x2c,0x20,0x6c,0x6f,0x63,0x61,0x6c,
+    0x5f,0x73,0x69,0x7a,0x65,0x5f,0x79,0x20,0x3d,0x20,0x31,0x2c,0x20,0x6c,0x6f,0x63,
+    0x61,0x6c,0x5f,0x73,0x69,0x7a,0x65,0x5f,0x7a,0x20,0x3d,0x20,0x31,0x29,0x20,0x69,
+    0x6e,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x65,0x6c,0x65,0x63,
+    0x74,0x56,0x61,0x6c,0x75,0x65,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,
+    0x74,0x20,0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,
+    0x75,0x63,0x74,0x20,0x73,0x65,0x6c,0x65,0x63,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x69,0x65,
+    0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x76,0x65,0x63,0x34,0x20,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,
+    0x77,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x69,0x65,
+    0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x76,0x65,0x63,0x34,0x20,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,
+    0x77,0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x63,0x61,0x6d,
+    0x65,0x72,0x61,0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x66,0x6f,0x63,0x61,0x6c,0x5f,0x70,0x78,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x63,0x61,0x6d,0x65,0x72,
+    0x61,0x5f,0x66,0x6f,0x72,0x77,0x61,0x72,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x76,0x69,0x65,0x77,0x70,0x6f,0x72,0x74,0x5f,0x77,0x69,
+    0x64,0x74,0x68,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,
+    0x69,0x65,0x77,0x70,0x6f,0x72,0x74,0x5f,0x68,0x65,0x69,0x67,0x68,0x74,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,
+    0x65,0x5f,0x63,0x6f,0x75,0x6e,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,
+    0x20,0x75,0x73,0x65,0x5f,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x73,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x62,0x75,0x64,0x67,0x65,0x74,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x5f,0x77,0x69,0x64,0x74,0x68,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,
+    0x73,0x70,0x6c,0x61,0x74,0x73,0x5f,0x70,0x65,0x72,0x5f,0x6c,0x61,0x79,0x65,0x72,
+    0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x65,
+    0x6c,0x65,0x63,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,0x5f,0x34,0x30,0x3b,
+    0x0a,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,
+    0x20,0x3d,0x20,0x33,0x2c,0x20,0x73,0x74,0x64,0x34,0x33,0x30,0x29,0x20,0x72,0x65,
+    0x61,0x64,0x6f,0x6e,0x6c,0x79,0x20,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x63,0x61,
+    0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x53,0x65,0x6c,0x65,0x63,0x74,0x56,0x61,0x6c,0x75,0x65,0x20,
+    0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x73,0x5b,0x5d,0x3b,0x0a,0x7d,0x20,
+    0x5f,0x32,0x35,0x30,0x3b,0x0a,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x62,0x69,
+    0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x34,0x2c,0x20,0x73,0x74,0x64,0x34,0x33,
+    0x30,0x29,0x20,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x62,0x69,0x6e,0x5f,0x62,0x75,
+    0x66,0x66,0x65,0x72,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x53,0x65,0x6c,0x65,0x63,
+    0x74,0x56,0x61,0x6c,0x75,0x65,0x20,0x62,0x69,0x6e,0x73,0x5b,0x5d,0x3b,0x0a,0x7d,
+    0x20,0x5f,0x32,0x36,0x32,0x3b,0x0a,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x62,
+    0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x35,0x2c,0x20,0x73,0x74,0x64,0x34,
+    0x33,0x30,0x29,0x20,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x73,0x65,0x6c,0x65,0x63,
+    0x74,0x5f,0x73,0x74,0x61,0x74,0x65,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x53,0x65,
+    0x6c,0x65,0x63,0x74,0x56,0x61,0x6c,0x75,0x65,0x20,0x73,0x74,0x61,0x74,0x65,0x5b,
+    0x5d,0x3b,0x0a,0x7d,0x20,0x5f,0x32,0x37,0x30,0x3b,0x0a,0x0a,0x6c,0x61,0x79,0x6f,
+    0x75,0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x30,0x29,0x20,
+    0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x75,0x73,
+    0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x41,0x72,0x72,0x61,0x79,0x20,0x73,0x70,
+    0x6c,0x61,0x74,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x70,0x6c,0x61,
+    0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,
+    0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x31,0x29,0x20,0x75,
+    0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x73,0x61,0x6d,
+    0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x63,0x68,0x75,0x6e,0x6b,0x5f,0x74,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x5f,0x73,0x70,0x6c,0x61,0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,
+    0x65,0x72,0x3b,0x0a,0x0a,0x75,0x76,0x65,0x63,0x34,0x20,0x66,0x65,0x74,0x63,0x68,
+    0x5f,0x73,0x70,0x6c,0x61,0x74,0x28,0x75,0x69,0x6e,0x74,0x20,0x73,0x70,0x6c,0x61,
+    0x74,0x5f,0x69,0x64,0x78,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,
+    0x20,0x5f,0x33,0x31,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,0x73,0x70,0x6c,0x61,0x74,
+    0x5f,0x69,0x64,0x78,0x29,0x20,0x2f,0x20,0x5f,0x34,0x30,0x2e,0x73,0x70,0x6c,0x61,
+    0x74,0x73,0x5f,0x70,0x65,0x72,0x5f,0x6c,0x61,0x79,0x65,0x72,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x6e,0x74,0x20,0x5f,0x33,0x37,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,
+    0x73,0x70,0x6c,0x61,0x74,0x5f,0x69,0x64,0x78,0x29,0x20,0x2d,0x20,0x28,0x5f,0x33,
+    0x31,0x20,0x2a,0x20,0x5f,0x34,0x30,0x2e,0x73,0x70,0x6c,0x61,0x74,0x73,0x5f,0x70,
+    0x65,0x72,0x5f,0x6c,0x61,0x79,0x65,0x72,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,
+    0x65,0x74,0x75,0x72,0x6e,0x20,0x74,0x65,0x78,0x65,0x6c,0x46,0x65,0x74,0x63,0x68,
+    0x28,0x73,0x70,0x6c,0x61,0x74,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,
+    0x70,0x6c,0x61,0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x69,0x76,
+    0x65,0x63,0x33,0x28,0x5f,0x33,0x37,0x20,0x25,0x20,0x5f,0x34,0x30,0x2e,0x74,0x65,
+    0x78,0x74,0x75,0x72,0x65,0x5f,0x77,0x69,0x64,0x74,0x68,0x2c,0x20,0x5f,0x33,0x37,
+    0x20,0x2f,0x20,0x5f,0x34,0x30,0x2e,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x77,
+    0x69,0x64,0x74,0x68,0x2c,0x20,0x5f,0x33,0x31,0x29,0x2c,0x20,0x30,0x29,0x3b,0x0a,
+    0x7d,0x0a,0x0a,0x75,0x69,0x6e,0x74,0x20,0x73,0x63,0x6f,0x72,0x65,0x5f,0x62,0x69,
+    0x6e,0x28,0x75,0x69,0x6e,0x74,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x69,0x64,0x78,
+    0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x20,0x3d,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x69,0x64,0x78,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x75,0x76,0x65,0x63,0x34,0x20,0x5f,0x38,0x30,0x20,0x3d,0x20,
+    0x66,0x65,0x74,0x63,0x68,0x5f,0x73,0x70,0x6c,0x61,0x74,0x28,0x70,0x61,0x72,0x61,
+    0x6d,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,0x38,0x34,
+    0x20,0x3d,0x20,0x5f,0x38,0x30,0x2e,0x77,0x20,0x26,0x20,0x32,0x35,0x35,0x75,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x38,0x34,0x20,0x3c,0x20,0x33,
+    0x75,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x30,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x5f,0x31,0x31,0x32,0x20,0x3d,
+    0x20,0x69,0x6e,0x74,0x28,0x73,0x70,0x6c,0x61,0x74,0x5f,0x69,0x64,0x78,0x29,0x20,
+    0x2f,0x20,0x32,0x35,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x76,0x65,0x63,0x32,
+    0x20,0x5f,0x31,0x32,0x30,0x20,0x3d,0x20,0x69,0x76,0x65,0x63,0x32,0x28,0x28,0x5f,
+    0x31,0x31,0x32,0x20,0x25,0x20,0x31,0x30,0x32,0x34,0x29,0x20,0x2a,0x20,0x32,0x2c,
+    0x20,0x5f,0x31,0x31,0x32,0x20,0x2f,0x20,0x31,0x30,0x32,0x34,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x5f,0x31,0x32,0x38,0x20,0x3d,0x20,0x74,
+    0x65,0x78,0x65,0x6c,0x46,0x65,0x74,0x63,0x68,0x28,0x63,0x68,0x75,0x6e,0x6b,0x5f,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x70,0x6c,0x61,0x74,0x5f,0x73,0x61,
+    0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x5f,0x31,0x32,0x30,0x2c,0x20,0x30,0x29,0x2e,
+    0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x5f,0x31,
+    0x33,0x38,0x20,0x3d,0x20,0x5f,0x31,0x32,0x38,0x20,0x2b,0x20,0x28,0x28,0x76,0x65,
+    0x63,0x33,0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x28,0x5f,0x38,0x30,0x2e,0x78,0x20,
+    0x3e,0x3e,0x20,0x31,0x36,0x75,0x29,0x20,0x26,0x20,0x36,0x35,0x35,0x33,0x35,0x75,
+    0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x5f,0x38,0x30,0x2e,0x78,0x20,0x26,
+    0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,
+    0x28,0x5f,0x38,0x30,0x2e,0x79,0x20,0x3e,0x3e,0x20,0x31,0x36,0x75,0x29,0x20,0x26,
+    0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x29,0x20,0x2a,0x20,0x31,0x2e,0x35,0x32,
+    0x35,0x39,0x30,0x32,0x31,0x38,0x39,0x33,0x31,0x34,0x33,0x36,0x35,0x33,0x38,0x36,
+    0x39,0x36,0x32,0x38,0x39,0x30,0x36,0x32,0x35,0x65,0x2d,0x30,0x35,0x29,0x20,0x2a,
+    0x20,0x28,0x74,0x65,0x78,0x65,0x6c,0x46,0x65,0x74,0x63,0x68,0x28,0x63,0x68,0x75,
+    0x6e,0x6b,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x70,0x6c,0x61,0x74,
+    0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x5f,0x31,0x32,0x30,0x20,0x2b,
+    0x20,0x69,0x76,0x65,0x63,0x32,0x28,0x31,0x2c,0x20,0x30,0x29,0x2c,0x20,0x30,0x29,
+    0x2e,0x78,0x79,0x7a,0x20,0x2d,0x20,0x5f,0x31,0x32,0x38,0x29,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,0x34,0x36,0x20,0x3d,0x20,
+    0x64,0x6f,0x74,0x28,0x5f,0x31,0x33,0x38,0x20,0x2d,0x20,0x5f,0x34,0x30,0x2e,0x63,
+    0x61,0x6d,0x65,0x72,0x61,0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2c,0x20,
+    0x5f,0x34,0x30,0x2e,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x66,0x6f,0x72,0x77,0x61,
+    0x72,0x64,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x31,0x34,
+    0x36,0x20,0x3c,0x20,0x30,0x2e,0x30,0x30,0x31,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+    0x34,0x37,0x34,0x39,0x37,0x34,0x35,0x31,0x33,0x30,0x35,0x33,0x38,0x39,0x34,0x30,
+    0x34,0x32,0x39,0x36,0x38,0x37,0x35,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x30,0x75,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,
+    0x20,0x5f,0x31,0x36,0x36,0x20,0x3d,0x20,0x65,0x78,0x70,0x28,0x28,0x76,0x65,0x63,
+    0x32,0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x28,0x5f,0x38,0x30,0x2e,0x7a,0x20,0x3e,
+    0x3e,0x20,0x31,0x36,0x75,0x29,0x20,0x26,0x20,0x32,0x35,0x35,0x75,0x29,0x2c,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x28,0x28,0x5f,0x38,0x30,0x2e,0x7a,0x20,0x3e,0x3e,0x20,
+    0x38,0x75,0x29,0x20,0x26,0x20,0x32,0x35,0x35,0x75,0x29,0x29,0x20,0x2a,0x20,0x30,
+    0x2e,0x30,0x33,0x39,0x32,0x31,0x35,0x36,0x38,0x37,0x36,0x36,0x32,0x33,0x36,0x33,
+    0x30,0x35,0x32,0x33,0x36,0x38,0x31,0x36,0x34,0x30,0x36,0x32,0x35,0x29,0x20,0x2d,
+    0x20,0x76,0x65,0x63,0x32,0x28,0x35,0x2e,0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,0x37,0x31,0x20,0x3d,0x20,0x5f,0x34,
+    0x30,0x2e,0x66,0x6f,0x63,0x61,0x6c,0x5f,0x70,0x78,0x20,0x2f,0x20,0x5f,0x31,0x34,
+    0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x5f,0x31,0x37,0x36,
+    0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x5f,0x31,0x33,0x38,0x2c,0x20,0x31,0x2e,
+    0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x5f,0x31,0x39,
+    0x37,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x64,0x6f,0x74,0x28,0x5f,0x34,0x30,
+    0x2e,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x30,0x2c,0x20,
+    0x5f,0x31,0x37,0x36,0x29,0x2c,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x30,0x2e,0x76,
+    0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x31,0x2c,0x20,0x5f,0x31,
+    0x37,0x36,0x29,0x2c,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x30,0x2e,0x76,0x69,0x65,
+    0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x32,0x2c,0x20,0x5f,0x31,0x37,0x36,
+    0x29,0x2c,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x30,0x2e,0x76,0x69,0x65,0x77,0x50,
+    0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x33,0x2c,0x20,0x5f,0x31,0x37,0x36,0x29,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,0x30,0x35,
+    0x20,0x3d,0x20,0x28,0x30,0x2e,0x35,0x20,0x2a,0x20,0x6d,0x61,0x78,0x28,0x5f,0x31,
+    0x36,0x36,0x2e,0x78,0x2c,0x20,0x5f,0x31,0x36,0x36,0x2e,0x79,0x29,0x29,0x20,0x2a,
+    0x20,0x5f,0x31,0x37,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,
+    0x5f,0x32,0x30,0x39,0x20,0x3d,0x20,0x5f,0x31,0x39,0x37,0x2e,0x78,0x79,0x20,0x2f,
+    0x20,0x76,0x65,0x63,0x32,0x28,0x5f,0x31,0x39,0x37,0x2e,0x77,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x28,0x61,0x62,0x73,0x28,0x5f,0x32,0x30,0x39,
+    0x2e,0x78,0x29,0x20,0x3e,0x20,0x28,0x31,0x2e,0x30,0x20,0x2b,0x20,0x28,0x28,0x32,
+    0x2e,0x30,0x20,0x2a,0x20,0x5f,0x32,0x30,0x35,0x29,0x20,0x2f,0x20,0x5f,0x34,0x30,
+    0x2e,0x76,0x69,0x65,0x77,0x70,0x6f,0x72,0x74,0x5f,0x77,0x69,0x64,0x74,0x68,0x29,
+    0x29,0x29,0x20,0x7c,0x7c,0x20,0x28,0x61,0x62,0x73,0x28,0x5f,0x32,0x30,0x39,0x2e,
+    0x79,0x29,0x20,0x3e,0x20,0x28,0x31,0x2e,0x30,0x20,0x2b,0x20,0x28,0x28,0x32,0x2e,
+    0x30,0x20,0x2a,0x20,0x5f,0x32,0x30,0x35,0x29,0x20,0x2f,0x20,0x5f,0x34,0x30,0x2e,
+    0x76,0x69,0x65,0x77,0x70,0x6f,0x72,0x74,0x5f,0x68,0x65,0x69,0x67,0x68,0x74,0x29,
+    0x29,0x29,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x30,0x75,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,0x33,
+    0x35,0x20,0x3d,0x20,0x28,0x28,0x28,0x28,0x5f,0x31,0x36,0x36,0x2e,0x78,0x20,0x2a,
+    0x20,0x5f,0x31,0x36,0x36,0x2e,0x79,0x29,0x20,0x2a,0x20,0x5f,0x31,0x37,0x31,0x29,
+    0x20,0x2a,0x20,0x5f,0x31,0x37,0x31,0x29,0x20,0x2a,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x28,0x5f,0x38,0x34,0x29,0x29,0x20,0x2a,0x20,0x30,0x2e,0x30,0x30,0x33,0x39,0x32,
+    0x31,0x35,0x36,0x38,0x38,0x35,0x39,0x33,0x36,0x38,0x35,0x36,0x32,0x36,0x39,0x38,
+    0x33,0x36,0x34,0x32,0x35,0x37,0x38,0x31,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x69,0x66,0x20,0x28,0x21,0x28,0x5f,0x32,0x33,0x35,0x20,0x3e,0x20,0x30,0x2e,0x30,
+    0x29,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x30,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x75,0x69,0x6e,
+    0x74,0x28,0x63,0x6c,0x61,0x6d,0x70,0x28,0x28,0x28,0x6c,0x6f,0x67,0x32,0x28,0x5f,
+    0x32,0x33,0x35,0x29,0x20,0x2b,0x20,0x31,0x36,0x2e,0x30,0x29,0x20,0x2a,0x20,0x32,
+    0x35,0x2e,0x35,0x37,0x35,0x30,0x30,0x30,0x37,0x36,0x32,0x39,0x33,0x39,0x34,0x35,
+    0x33,0x31,0x32,0x35,0x29,0x20,0x2b,0x20,0x31,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,
+    0x2c,0x20,0x31,0x30,0x32,0x33,0x2e,0x30,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,
+    0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x69,0x66,0x20,0x28,0x69,0x6e,0x74,0x28,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,
+    0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,
+    0x29,0x20,0x3e,0x3d,0x20,0x5f,0x34,0x30,0x2e,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,
+    0x74,0x65,0x5f,0x63,0x6f,0x75,0x6e,0x74,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,
+    0x32,0x36,0x35,0x20,0x3d,0x20,0x28,0x5f,0x34,0x30,0x2e,0x75,0x73,0x65,0x5f,0x63,
+    0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x73,0x20,0x21,0x3d,0x20,0x30,0x29,0x20,
+    0x3f,0x20,0x5f,0x32,0x35,0x30,0x2e,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,
+    0x73,0x5b,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,
+    0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,
+    0x20,0x3a,0x20,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,
+    0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x75,0x69,0x6e,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x5f,
+    0x32,0x36,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,0x32,
+    0x36,0x38,0x20,0x3d,0x20,0x73,0x63,0x6f,0x72,0x65,0x5f,0x62,0x69,0x6e,0x28,0x70,
+    0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x5f,0x32,0x36,
+    0x32,0x2e,0x62,0x69,0x6e,0x73,0x5b,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,
+    0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x5d,0x2e,
+    0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x5f,0x32,0x36,0x38,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,0x32,0x37,0x35,0x20,0x3d,0x20,0x61,0x74,
+    0x6f,0x6d,0x69,0x63,0x41,0x64,0x64,0x28,0x5f,0x32,0x37,0x30,0x2e,0x73,0x74,0x61,
+    0x74,0x65,0x5b,0x5f,0x32,0x36,0x38,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x2c,0x20,
+    0x31,0x75,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 310 es
+    layout(local_size_x = 256, local_size_y = 1, local_size_z = 1) in;
+
+    struct SelectValue
+    {
+        uint value;
+    };
+
+    struct SelectSplatTexel
+    {
+        uvec4 value;
+    };
+
+    struct select_params
+    {
+        vec4 viewProj_row0;
+        vec4 viewProj_row1;
+        vec4 viewProj_row2;
+        vec4 viewProj_row3;
+        vec3 camera_position;
+        float focal_px;
+        vec3 camera_forward;
+        float viewport_width;
+        float viewport_height;
+        int candidate_count;
+        int use_candidates;
+        int budget;
+        int texture_width;
+        int splats_per_layer;
+    };
+
+    uniform select_params _40;
+
+    layout(binding = 3, std430) readonly buffer splat_buffer
+    {
+        SelectSplatTexel splats[];
+    } _25;
+
+    layout(binding = 0, std430) readonly buffer candidate_input
+    {
+        SelectValue candidates[];
+    } _250;
+
+    layout(binding = 1, std430) buffer bin_buffer
+    {
+        SelectValue bins[];
+    } _262;
+
+    layout(binding = 2, std430) buffer select_state
+    {
+        SelectValue state[];
+    } _270;
+
+    layout(binding = 0) uniform highp sampler2D chunk_texture_splat_sampler;
+
+    uvec4 fetch_splat(uint splat_idx)
+    {
+        return _25.splats[splat_idx].value;
+    }
+
+    uint score_bin(uint splat_idx)
+    {
+        uint param = splat_idx;
+        uvec4 _80 = fetch_splat(param);
+        uint _84 = _80.w & 255u;
+        if (_84 < 3u)
+        {
+            return 0u;
+        }
+        int _112 = int(splat_idx) / 256;
+        ivec2 _120 = ivec2((_112 % 1024) * 2, _112 / 1024);
+        vec3 _128 = texelFetch(chunk_texture_splat_sampler, _120, 0).xyz;
+        vec3 _138 = _128 + ((vec3(float((_80.x >> 16u) & 65535u), float(_80.x & 65535u), float((_80.y >> 16u) & 65535u)) * 1.525902189314365386962890625e-05) * (texelFetch(chunk_texture_splat_sampler, _120 + ivec2(1, 0), 0).xyz - _128));
+        float _146 = dot(_138 - _40.camera_position, _40.camera_forward);
+        if (_146 < 0.001000000047497451305389404296875)
+        {
+            return 0u;
+        }
+        vec2 _166 = exp((vec2(float((_80.z >> 16u) & 255u), float((_80.z >> 8u) & 255u)) * 0.0392156876623630523681640625) - vec2(5.0));
+        float _171 = _40.focal_px / _146;
+        vec4 _176 = vec4(_138, 1.0);
+        vec4 _197 = vec4(dot(_40.viewProj_row0, _176), dot(_40.viewProj_row1, _176), dot(_40.viewProj_row2, _176), dot(_40.viewProj_row3, _176));
+        float _205 = (0.5 * max(_166.x, _166.y)) * _171;
+        vec2 _209 = _197.xy / vec2(_197.w);
+        if ((abs(_209.x) > (1.0 + ((2.0 * _205) / _40.viewport_width))) || (abs(_209.y) > (1.0 + ((2.0 * _205) / _40.viewport_height))))
+        {
+            return 0u;
+        }
+        float _235 = ((((_166.x * _166.y) * _171) * _171) * float(_84)) * 0.0039215688593685626983642578125;
+        if (!(_235 > 0.0))
+        {
+            return 0u;
+        }
+        return uint(clamp(((log2(_235) + 16.0) * 25.575000762939453125) + 1.0, 1.0, 1023.0));
+    }
+
+    void main()
+    {
+        if (int(gl_GlobalInvocationID.x) >= _40.candidate_count)
+        {
+            return;
+        }
+        uint _265 = (_40.use_candidates != 0) ? _250.candidates[gl_GlobalInvocationID.x].value : gl_GlobalInvocationID.x;
+        uint param_1 = _265;
+        uint _268 = score_bin(param_1);
+        _262.bins[gl_GlobalInvocationID.x].value = _268;
+        uint _275 = atomicAdd(_270.state[_268].value, 1u);
+    }
+
+*/
+static const uint8_t score_bins_buffer_source_glsl310es[3052] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x31,0x30,0x20,0x65,0x73,0x0a,
+    0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x6c,0x5f,0x73,0x69,0x7a,
+    0x65,0x5f,0x78,0x20,0x3d,0x20,0x32,0x35,0x36,0x2c,0x20,0x6c,0x6f,0x63,0x61,0x6c,
+    0x5f,0x73,0x69,0x7a,0x65,0x5f,0x79,0x20,0x3d,0x20,0x31,0x2c,0x20,0x6c,0x6f,0x63,
+    0x61,0x6c,0x5f,0x73,0x69,0x7a,0x65,0x5f,0x7a,0x20,0x3d,0x20,0x31,0x29,0x20,0x69,
+    0x6e,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x65,0x6c,0x65,0x63,
+    0x74,0x56,0x61,0x6c,0x75,0x65,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,
+    0x74,0x20,0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,
+    0x75,0x63,0x74,0x20,0x53,0x65,0x6c,0x65,0x63,0x74,0x53,0x70,0x6c,0x61,0x74,0x54,
+    0x65,0x78,0x65,0x6c,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x76,0x65,0x63,0x34,
+    0x20,0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,
+    0x63,0x74,0x20,0x73,0x65,0x6c,0x65,0x63,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x69,0x65,0x77,
+    0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,
+    0x65,0x63,0x34,0x20,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,
+    0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x69,0x65,0x77,
+    0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,
+    0x65,0x63,0x34,0x20,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,
+    0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x63,0x61,0x6d,0x65,
+    0x72,0x61,0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x66,0x6f,0x63,0x61,0x6c,0x5f,0x70,0x78,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x63,0x61,0x6d,0x65,0x72,0x61,
+    0x5f,0x66,0x6f,0x72,0x77,0x61,0x72,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x76,0x69,0x65,0x77,0x70,0x6f,0x72,0x74,0x5f,0x77,0x69,0x64,
+    0x74,0x68,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x69,
+    0x65,0x77,0x70,0x6f,0x72,0x74,0x5f,0x68,0x65,0x69,0x67,0x68,0x74,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,
+    0x5f,0x63,0x6f,0x75,0x6e,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,
+    0x75,0x73,0x65,0x5f,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x73,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x62,0x75,0x64,0x67,0x65,0x74,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,
+    0x77,0x69,0x64,0x74,0x68,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x73,
+    0x70,0x6c,0x61,0x74,0x73,0x5f,0x70,0x65,0x72,0x5f,0x6c,0x61,0x79,0x65,0x72,0x3b,
+    0x0a,0x7d,0x3b,0x0a,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x65,0x6c,
+    0x65,0x63,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,0x5f,0x34,0x30,0x3b,0x0a,
+    0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,
+    0x3d,0x20,0x33,0x2c,0x20,0x73,0x74,0x64,0x34,0x33,0x30,0x29,0x20,0x72,0x65,0x61,
+    0x64,0x6f,0x6e,0x6c,0x79,0x20,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x73,0x70,0x6c,
+    0x61,0x74,0x5f,0x62,0x75,0x66,0x66,0x65,0x72,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x53,0x65,0x6c,0x65,0x63,0x74,0x53,0x70,0x6c,0x61,0x74,0x54,0x65,0x78,0x65,0x6c,
+    0x20,0x73,0x70,0x6c,0x61,0x74,0x73,0x5b,0x5d,0x3b,0x0a,0x7d,0x20,0x5f,0x32,0x35,
+    0x3b,0x0a,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,
+    0x67,0x20,0x3d,0x20,0x30,0x2c,0x20,0x73,0x74,0x64,0x34,0x33,0x30,0x29,0x20,0x72,
+    0x65,0x61,0x64,0x6f,0x6e,0x6c,0x79,0x20,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x63,
+    0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x0a,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x53,0x65,0x6c,0x65,0x63,0x74,0x56,0x61,0x6c,0x75,0x65,
+    0x20,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x73,0x5b,0x5d,0x3b,0x0a,0x7d,
+    0x20,0x5f,0x32,0x35,0x30,0x3b,0x0a,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x62,
+    0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x31,0x2c,0x20,0x73,0x74,0x64,0x34,
+    0x33,0x30,0x29,0x20,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x62,0x69,0x6e,0x5f,0x62,
+    0x75,0x66,0x66,0x65,0x72,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x53,0x65,0x6c,0x65,
+    0x63,0x74,0x56,0x61,0x6c,0x75,0x65,0x20,0x62,0x69,0x6e,0x73,0x5b,0x5d,0x3b,0x0a,
+    0x7d,0x20,0x5f,0x32,0x36,0x32,0x3b,0x0a,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,
+    0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x32,0x2c,0x20,0x73,0x74,0x64,
+    0x34,0x33,0x30,0x29,0x20,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x73,0x65,0x6c,0x65,
+    0x63,0x74,0x5f,0x73,0x74,0x61,0x74,0x65,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x53,
+    0x65,0x6c,0x65,0x63,0x74,0x56,0x61,0x6c,0x75,0x65,0x20,0x73,0x74,0x61,0x74,0x65,
+    0x5b,0x5d,0x3b,0x0a,0x7d,0x20,0x5f,0x32,0x37,0x30,0x3b,0x0a,0x0a,0x6c,0x61,0x79,
+    0x6f,0x75,0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x30,0x29,
+    0x20,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x73,
+    0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x63,0x68,0x75,0x6e,0x6b,0x5f,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x70,0x6c,0x61,0x74,0x5f,0x73,0x61,0x6d,
+    0x70,0x6c,0x65,0x72,0x3b,0x0a,0x0a,0x75,0x76,0x65,0x63,0x34,0x20,0x66,0x65,0x74,
+    0x63,0x68,0x5f,0x73,0x70,0x6c,0x61,0x74,0x28,0x75,0x69,0x6e,0x74,0x20,0x73,0x70,
+    0x6c,0x61,0x74,0x5f,0x69,0x64,0x78,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,
+    0x65,0x74,0x75,0x72,0x6e,0x20,0x5f,0x32,0x35,0x2e,0x73,0x70,0x6c,0x61,0x74,0x73,
+    0x5b,0x73,0x70,0x6c,0x61,0x74,0x5f,0x69,0x64,0x78,0x5d,0x2e,0x76,0x61,0x6c,0x75,
+    0x65,0x3b,0x0a,0x7d,0x0a,0x0a,0x75,0x69,0x6e,0x74,0x20,0x73,0x63,0x6f,0x72,0x65,
+    0x5f,0x62,0x69,0x6e,0x28,0x75,0x69,0x6e,0x74,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,
+    0x69,0x64,0x78,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x69,0x64,
+    0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x76,0x65,0x63,0x34,0x20,0x5f,0x38,0x30,
+    0x20,0x3d,0x20,0x66,0x65,0x74,0x63,0x68,0x5f,0x73,0x70,0x6c,0x61,0x74,0x28,0x70,
+    0x61,0x72,0x61,0x6d,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,
+    0x5f,0x38,0x34,0x20,0x3d,0x20,0x5f,0x38,0x30,0x2e,0x77,0x20,0x26,0x20,0x32,0x35,
+    0x35,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x38,0x34,0x20,
+    0x3c,0x20,0x33,0x75,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x30,0x75,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x5f,0x31,0x31,
+    0x32,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,0x73,0x70,0x6c,0x61,0x74,0x5f,0x69,0x64,
+    0x78,0x29,0x20,0x2f,0x20,0x32,0x35,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x76,
+    0x65,0x63,0x32,0x20,0x5f,0x31,0x32,0x30,0x20,0x3d,0x20,0x69,0x76,0x65,0x63,0x32,
+    0x28,0x28,0x5f,0x31,0x31,0x32,0x20,0x25,0x20,0x31,0x30,0x32,0x34,0x29,0x20,0x2a,
+    0x20,0x32,0x2c,0x20,0x5f,0x31,0x31,0x32,0x20,0x2f,0x20,0x31,0x30,0x32,0x34,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x5f,0x31,0x32,0x38,0x20,
+    0x3d,0x20,0x74,0x65,0x78,0x65,0x6c,0x46,0x65,0x74,0x63,0x68,0x28,0x63,0x68,0x75,
+    0x6e,0x6b,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x70,0x6c,0x61,0x74,
+    0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x5f,0x31,0x32,0x30,0x2c,0x20,
+    0x30,0x29,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,
+    0x20,0x5f,0x31,0x33,0x38,0x20,0x3d,0x20,0x5f,0x31,0x32,0x38,0x20,0x2b,0x20,0x28,
+    0x28,0x76,0x65,0x63,0x33,0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x28,0x5f,0x38,0x30,
+    0x2e,0x78,0x20,0x3e,0x3e,0x20,0x31,0x36,0x75,0x29,0x20,0x26,0x20,0x36,0x35,0x35,
+    0x33,0x35,0x75,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x5f,0x38,0x30,0x2e,
+    0x78,0x20,0x26,0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x2c,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x28,0x28,0x5f,0x38,0x30,0x2e,0x79,0x20,0x3e,0x3e,0x20,0x31,0x36,0x75,
+    0x29,0x20,0x26,0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x29,0x20,0x2a,0x20,0x31,
+    0x2e,0x35,0x32,0x35,0x39,0x30,0x32,0x31,0x38,0x39,0x33,0x31,0x34,0x33,0x36,0x35,
+    0x33,0x38,0x36,0x39,0x36,0x32,0x38,0x39,0x30,0x36,0x32,0x35,0x65,0x2d,0x30,0x35,
+    0x29,0x20,0x2a,0x20,0x28,0x74,0x65,0x78,0x65,0x6c,0x46,0x65,0x74,0x63,0x68,0x28,
+    0x63,0x68,0x75,0x6e,0x6b,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x70,
+    0x6c,0x61,0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x5f,0x31,0x32,
+    0x30,0x20,0x2b,0x20,0x69,0x76,0x65,0x63,0x32,0x28,0x31,0x2c,0x20,0x30,0x29,0x2c,
+    0x20,0x30,0x29,0x2e,0x78,0x79,0x7a,0x20,0x2d,0x20,0x5f,0x31,0x32,0x38,0x29,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,0x34,0x36,
+    0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x31,0x33,0x38,0x20,0x2d,0x20,0x5f,0x34,
+    0x30,0x2e,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,
+    0x6e,0x2c,0x20,0x5f,0x34,0x30,0x2e,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x66,0x6f,
+    0x72,0x77,0x61,0x72,0x64,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,
+    0x5f,0x31,0x34,0x36,0x20,0x3c,0x20,0x30,0x2e,0x30,0x30,0x31,0x30,0x30,0x30,0x30,
+    0x30,0x30,0x30,0x34,0x37,0x34,0x39,0x37,0x34,0x35,0x31,0x33,0x30,0x35,0x33,0x38,
+    0x39,0x34,0x30,0x34,0x32,0x39,0x36,0x38,0x37,0x35,0x29,0x0a,0x20,0x20,0x20,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x20,0x30,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x76,
+    0x65,0x63,0x32,0x20,0x5f,0x31,0x36,0x36,0x20,0x3d,0x20,0x65,0x78,0x70,0x28,0x28,
+    0x76,0x65,0x63,0x32,0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x28,0x5f,0x38,0x30,0x2e,
+    0x7a,0x20,0x3e,0x3e,0x20,0x31,0x36,0x75,0x29,0x20,0x26,0x20,0x32,0x35,0x35,0x75,
+    0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x28,0x5f,0x38,0x30,0x2e,0x7a,0x20,
+    0x3e,0x3e,0x20,0x38,0x75,0x29,0x20,0x26,0x20,0x32,0x35,0x35,0x75,0x29,0x29,0x20,
+    0x2a,0x20,0x30,0x2e,0x30,0x33,0x39,0x32,0x31,0x35,0x36,0x38,0x37,0x36,0x36,0x32,
+    0x33,0x36,0x33,0x30,0x35,0x32,0x33,0x36,0x38,0x31,0x36,0x34,0x30,0x36,0x32,0x35,
+    0x29,0x20,0x2d,0x20,0x76,0x65,0x63,0x32,0x28,0x35,0x2e,0x30,0x29,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,0x37,0x31,0x20,0x3d,
+    0x20,0x5f,0x34,0x30,0x2e,0x66,0x6f,0x63,0x61,0x6c,0x5f,0x70,0x78,0x20,0x2f,0x20,
+    0x5f,0x31,0x34,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x5f,
+    0x31,0x37,0x36,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x5f,0x31,0x33,0x38,0x2c,
+    0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,
+    0x5f,0x31,0x39,0x37,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x64,0x6f,0x74,0x28,
+    0x5f,0x34,0x30,0x2e,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,
+    0x30,0x2c,0x20,0x5f,0x31,0x37,0x36,0x29,0x2c,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,
+    0x30,0x2e,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x31,0x2c,
+    0x20,0x5f,0x31,0x37,0x36,0x29,0x2c,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x30,0x2e,
+    0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x32,0x2c,0x20,0x5f,
+    0x31,0x37,0x36,0x29,0x2c,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x30,0x2e,0x76,0x69,
+    0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x33,0x2c,0x20,0x5f,0x31,0x37,
+    0x36,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,
+    0x32,0x30,0x35,0x20,0x3d,0x20,0x28,0x30,0x2e,0x35,0x20,0x2a,0x20,0x6d,0x61,0x78,
+    0x28,0x5f,0x31,0x36,0x36,0x2e,0x78,0x2c,0x20,0x5f,0x31,0x36,0x36,0x2e,0x79,0x29,
+    0x29,0x20,0x2a,0x20,0x5f,0x31,0x37,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,
+    0x63,0x32,0x20,0x5f,0x32,0x30,0x39,0x20,0x3d,0x20,0x5f,0x31,0x39,0x37,0x2e,0x78,
+    0x79,0x20,0x2f,0x20,0x76,0x65,0x63,0x32,0x28,0x5f,0x31,0x39,0x37,0x2e,0x77,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x28,0x61,0x62,0x73,0x28,0x5f,
+    0x32,0x30,0x39,0x2e,0x78,0x29,0x20,0x3e,0x20,0x28,0x31,0x2e,0x30,0x20,0x2b,0x20,
+    0x28,0x28,0x32,0x2e,0x30,0x20,0x2a,0x20,0x5f,0x32,0x30,0x35,0x29,0x20,0x2f,0x20,
+    0x5f,0x34,0x30,0x2e,0x76,0x69,0x65,0x77,0x70,0x6f,0x72,0x74,0x5f,0x77,0x69,0x64,
+    0x74,0x68,0x29,0x29,0x29,0x20,0x7c,0x7c,0x20,0x28,0x61,0x62,0x73,0x28,0x5f,0x32,
+    0x30,0x39,0x2e,0x79,0x29,0x20,0x3e,0x20,0x28,0x31,0x2e,0x30,0x20,0x2b,0x20,0x28,
+    0x28,0x32,0x2e,0x30,0x20,0x2a,0x20,0x5f,0x32,0x30,0x35,0x29,0x20,0x2f,0x20,0x5f,
+    0x34,0x30,0x2e,0x76,0x69,0x65,0x77,0x70,0x6f,0x72,0x74,0x5f,0x68,0x65,0x69,0x67,
+    0x68,0x74,0x29,0x29,0x29,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x30,0x75,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x5f,0x32,0x33,0x35,0x20,0x3d,0x20,0x28,0x28,0x28,0x28,0x5f,0x31,0x36,0x36,0x2e,
+    0x78,0x20,0x2a,0x20,0x5f,0x31,0x36,0x36,0x2e,0x79,0x29,0x20,0x2a,0x20,0x5f,0x31,
+    0x37,0x31,0x29,0x20,0x2a,0x20,0x5f,0x31,0x37,0x31,0x29,0x20,0x2a,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x28,0x5f,0x38,0x34,0x29,0x29,0x20,0x2a,0x20,0x30,0x2e,0x30,0x30,
+    0x33,0x39,0x32,0x31,0x35,0x36,0x38,0x38,0x35,0x39,0x33,0x36,0x38,0x35,0x36,0x32,
+    0x36,0x39,0x38,0x33,0x36,0x34,0x32,0x35,0x37,0x38,0x31,0x32,0x35,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x21,0x28,0x5f,0x32,0x33,0x35,0x20,0x3e,0x20,
+    0x30,0x2e,0x30,0x29,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x30,0x75,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
+    0x75,0x69,0x6e,0x74,0x28,0x63,0x6c,0x61,0x6d,0x70,0x28,0x28,0x28,0x6c,0x6f,0x67,
+    0x32,0x28,0x5f,0x32,0x33,0x35,0x29,0x20,0x2b,0x20,0x31,0x36,0x2e,0x30,0x29,0x20,
+    0x2a,0x20,0x32,0x35,0x2e,0x35,0x37,0x35,0x30,0x30,0x30,0x37,0x36,0x32,0x39,0x33,
+    0x39,0x34,0x35,0x33,0x31,0x32,0x35,0x29,0x20,0x2b,0x20,0x31,0x2e,0x30,0x2c,0x20,
+    0x31,0x2e,0x30,0x2c,0x20,0x31,0x30,0x32,0x33,0x2e,0x30,0x29,0x29,0x3b,0x0a,0x7d,
+    0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x6e,0x74,0x28,0x67,0x6c,0x5f,0x47,
+    0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,
+    0x44,0x2e,0x78,0x29,0x20,0x3e,0x3d,0x20,0x5f,0x34,0x30,0x2e,0x63,0x61,0x6e,0x64,
+    0x69,0x64,0x61,0x74,0x65,0x5f,0x63,0x6f,0x75,0x6e,0x74,0x29,0x0a,0x20,0x20,0x20,
+    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,
+    0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,
+    0x74,0x20,0x5f,0x32,0x36,0x35,0x20,0x3d,0x20,0x28,0x5f,0x34,0x30,0x2e,0x75,0x73,
+    0x65,0x5f,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x73,0x20,0x21,0x3d,0x20,
+    0x30,0x29,0x20,0x3f,0x20,0x5f,0x32,0x35,0x30,0x2e,0x63,0x61,0x6e,0x64,0x69,0x64,
+    0x61,0x74,0x65,0x73,0x5b,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,
+    0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x5d,0x2e,0x76,0x61,
+    0x6c,0x75,0x65,0x20,0x3a,0x20,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,
+    0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,
+    0x3d,0x20,0x5f,0x32,0x36,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,
+    0x20,0x5f,0x32,0x36,0x38,0x20,0x3d,0x20,0x73,0x63,0x6f,0x72,0x65,0x5f,0x62,0x69,
+    0x6e,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x5f,0x32,0x36,0x32,0x2e,0x62,0x69,0x6e,0x73,0x5b,0x67,0x6c,0x5f,0x47,0x6c,0x6f,
+    0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,
+    0x78,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x5f,0x32,0x36,0x38,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,0x32,0x37,0x35,0x20,0x3d,
+    0x20,0x61,0x74,0x6f,0x6d,0x69,0x63,0x41,0x64,0x64,0x28,0x5f,0x32,0x37,0x30,0x2e,
+    0x73,0x74,0x61,0x74,0x65,0x5b,0x5f,0x32,0x36,0x38,0x5d,0x2e,0x76,0x61,0x6c,0x75,
+    0x65,0x2c,0x20,0x31,0x75,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 310 es
+    layout(local_size_x = 1, local_size_y = 1, local_size_z = 1) in;
+
+    struct SelectValue
+    {
+        uint value;
+    };
+
+    struct select_params
+    {
+        vec4 viewProj_row0;
+        vec4 viewProj_row1;
+        vec4 viewProj_row2;
+        vec4 viewProj_row3;
+        vec3 camera_position;
+        float focal_px;
+        vec3 camera_forward;
+        float viewport_width;
+        float viewport_height;
+        int candidate_count;
+        int use_candidates;
+        int budget;
+        int texture_width;
+        int splats_per_layer;
+    };
+
+    uniform select_params _40;
+
+    layout(binding = 5, std430) buffer select_state
+    {
+        SelectValue state[];
+    } _35;
+
+    void main()
+    {
+        uint remaining = uint(_40.budget);
+        uint threshold_bin = 0u;
+        bool found = false;
+        for (int b = 1023; b >= 0; b--)
+        {
+            uint _48 = _35.state[b].value;
+            _35.state[b].value = 0u;
+            if (found)
+            {
+                continue;
+            }
+            if (_48 >= remaining)
+            {
+                threshold_bin = uint(b);
+                found = true;
+            }
+            else
+            {
+                remaining -= _48;
+            }
+        }
+        _35.state[1024].value = threshold_bin;
+        _35.state[1025].value = remaining;
+        _35.state[1026].value = 0u;
+        _35.state[1027].value = 0u;
+    }
+
+*/
+static const uint8_t find_threshold_source_glsl310es[1208] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x31,0x30,0x20,0x65,0x73,0x0a,
+    0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x6c,0x5f,0x73,0x69,0x7a,
+    0x65,0x5f,0x78,0x20,0x3d,0x20,0x31,0x2c,0x20,0x6c,0x6f,0x63,0x61,0x6c,0x5f,0x73,
+    0x69,0x7a,0x65,0x5f,0x79,0x20,0x3d,0x20,0x31,0x2c,0x20,0x6c,0x6f,0x63,0x61,0x6c,
+    0x5f,0x73,0x69,0x7a,0x65,0x5f,0x7a,0x20,0x3d,0x20,0x31,0x29,0x20,0x69,0x6e,0x3b,
+    0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x65,0x6c,0x65,0x63,0x74,0x56,
+    0x61,0x6c,0x75,0x65,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,
+    0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,
+    0x74,0x20,0x73,0x65,0x6c,0x65,0x63,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x69,0x65,0x77,0x50,
+    0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,
+    0x63,0x34,0x20,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x31,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x69,0x65,0x77,0x50,
+    0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,
+    0x63,0x34,0x20,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x33,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x63,0x61,0x6d,0x65,0x72,
+    0x61,0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x66,0x6f,0x63,0x61,0x6c,0x5f,0x70,0x78,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,
+    0x66,0x6f,0x72,0x77,0x61,0x72,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x76,0x69,0x65,0x77,0x70,0x6f,0x72,0x74,0x5f,0x77,0x69,0x64,0x74,
+    0x68,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x69,0x65,
+    0x77,0x70,0x6f,0x72,0x74,0x5f,0x68,0x65,0x69,0x67,0x68,0x74,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x6e,0x74,0x20,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x5f,
+    0x63,0x6f,0x75,0x6e,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x75,
+    0x73,0x65,0x5f,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x73,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x62,0x75,0x64,0x67,0x65,0x74,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x77,
+    0x69,0x64,0x74,0x68,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x73,0x70,
+    0x6c,0x61,0x74,0x73,0x5f,0x70,0x65,0x72,0x5f,0x6c,0x61,0x79,0x65,0x72,0x3b,0x0a,
+    0x7d,0x3b,0x0a,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x65,0x6c,0x65,
+    0x63,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,0x5f,0x34,0x30,0x3b,0x0a,0x0a,
+    0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,
+    0x20,0x35,0x2c,0x20,0x73,0x74,0x64,0x34,0x33,0x30,0x29,0x20,0x62,0x75,0x66,0x66,
+    0x65,0x72,0x20,0x73,0x65,0x6c,0x65,0x63,0x74,0x5f,0x73,0x74,0x61,0x74,0x65,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x53,0x65,0x6c,0x65,0x63,0x74,0x56,0x61,0x6c,0x75,
+    0x65,0x20,0x73,0x74,0x61,0x74,0x65,0x5b,0x5d,0x3b,0x0a,0x7d,0x20,0x5f,0x33,0x35,
+    0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x72,0x65,0x6d,0x61,0x69,0x6e,
+    0x69,0x6e,0x67,0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,0x28,0x5f,0x34,0x30,0x2e,0x62,
+    0x75,0x64,0x67,0x65,0x74,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,
+    0x20,0x74,0x68,0x72,0x65,0x73,0x68,0x6f,0x6c,0x64,0x5f,0x62,0x69,0x6e,0x20,0x3d,
+    0x20,0x30,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x66,0x6f,
+    0x75,0x6e,0x64,0x20,0x3d,0x20,0x66,0x61,0x6c,0x73,0x65,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x62,0x20,0x3d,0x20,0x31,0x30,
+    0x32,0x33,0x3b,0x20,0x62,0x20,0x3e,0x3d,0x20,0x30,0x3b,0x20,0x62,0x2d,0x2d,0x29,
+    0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x75,
+    0x69,0x6e,0x74,0x20,0x5f,0x34,0x38,0x20,0x3d,0x20,0x5f,0x33,0x35,0x2e,0x73,0x74,
+    0x61,0x74,0x65,0x5b,0x62,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x33,0x35,0x2e,0x73,0x74,0x61,0x74,0x65,0x5b,
+    0x62,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x30,0x75,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x66,0x6f,0x75,0x6e,0x64,
+    0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6f,0x6e,0x74,0x69,0x6e,0x75,0x65,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x34,0x38,0x20,0x3e,0x3d,0x20,0x72,
+    0x65,0x6d,0x61,0x69,0x6e,0x69,0x6e,0x67,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x74,0x68,0x72,0x65,0x73,0x68,0x6f,0x6c,0x64,0x5f,0x62,0x69,0x6e,0x20,0x3d,0x20,
+    0x75,0x69,0x6e,0x74,0x28,0x62,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x66,0x6f,0x75,0x6e,0x64,0x20,0x3d,0x20,0x74,0x72,0x75,
+    0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x72,0x65,0x6d,0x61,0x69,0x6e,0x69,0x6e,0x67,0x20,0x2d,0x3d,0x20,0x5f,0x34,0x38,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
+    0x7d,0x0a,0x20,0x20,0x20,0x20,0x5f,0x33,0x35,0x2e,0x73,0x74,0x61,0x74,0x65,0x5b,
+    0x31,0x30,0x32,0x34,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x74,0x68,
+    0x72,0x65,0x73,0x68,0x6f,0x6c,0x64,0x5f,0x62,0x69,0x6e,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x5f,0x33,0x35,0x2e,0x73,0x74,0x61,0x74,0x65,0x5b,0x31,0x30,0x32,0x35,0x5d,
+    0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x72,0x65,0x6d,0x61,0x69,0x6e,0x69,
+    0x6e,0x67,0x3b,0x0a,0x20,0x20,0x20,0x20,0x5f,0x33,0x35,0x2e,0x73,0x74,0x61,0x74,
+    0x65,0x5b,0x31,0x30,0x32,0x36,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,
+    0x30,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x5f,0x33,0x35,0x2e,0x73,0x74,0x61,0x74,
+    0x65,0x5b,0x31,0x30,0x32,0x37,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,
+    0x30,0x75,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 310 es
+    layout(local_size_x = 256, local_size_y = 1, local_size_z = 1) in;
+
+    struct SelectValue
+    {
+        uint value;
+    };
+
+    struct select_params
+    {
+        vec4 viewProj_row0;
+        vec4 viewProj_row1;
+        vec4 viewProj_row2;
+        vec4 viewProj_row3;
+        vec3 camera_position;
+        float focal_px;
+        vec3 camera_forward;
+        float viewport_width;
+        float viewport_height;
+        int candidate_count;
+        int use_candidates;
+        int budget;
+        int texture_width;
+        int splats_per_layer;
+    };
+
+    uniform select_params _40;
+
+    layout(binding = 3, std430) readonly buffer candidate_input
+    {
+        SelectValue candidates[];
+    } _250;
+
+    layout(binding = 4, std430) buffer bin_buffer
+    {
+        SelectValue bins[];
+    } _262;
+
+    layout(binding = 5, std430) buffer select_state
+    {
+        SelectValue state[];
+    } _270;
+
+    layout(binding = 7, std430) writeonly buffer selected_output
+    {
+        SelectValue selected[];
+    } _290;
+
+    void main()
+    {
+        if (int(gl_GlobalInvocationID.x) >= _40.candidate_count)
+        {
+            return;
+        }
+        uint _41 = _262.bins[gl_GlobalInvocationID.x].value;
+        uint _49 = _270.state[1024].value;
+        bool keep = _41 > _49;
+        if (_41 == _49)
+        {
+            uint _64 = atomicAdd(_270.state[1027].value, 1u);
+            keep = _64 < _270.state[1025].value;
+        }
+        if (keep)
+        {
+            uint _77 = atomicAdd(_270.state[1026].value, 1u);
+            _290.selected[_77].value = (_40.use_candidates != 0) ? _250.candidates[gl_GlobalInvocationID.x].value : gl_GlobalInvocationID.x;
+        }
+    }
+
+*/
+static const uint8_t compact_selected_source_glsl310es[1466] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x31,0x30,0x20,0x65,0x73,0x0a,
+    0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x6c,0x5f,0x73,0x69,0x7a,
+    0x65,0x5f,0x78,0x20,0x3d,0x20,0x32,0x35,0x36,0x2c,0x20,0x6c,0x6f,0x63,0x61,0x6c,
+    0x5f,0x73,0x69,0x7a,0x65,0x5f,0x79,0x20,0x3d,0x20,0x31,0x2c,0x20,0x6c,0x6f,0x63,
+    0x61,0x6c,0x5f,0x73,0x69,0x7a,0x65,0x5f,0x7a,0x20,0x3d,0x20,0x31,0x29,0x20,0x69,
+    0x6e,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x65,0x6c,0x65,0x63,
+    0x74,0x56,0x61,0x6c,0x75,0x65,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,
+    0x74,0x20,0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,
+    0x75,0x63,0x74,0x20,0x73,0x65,0x6c,0x65,0x63,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x69,0x65,
+    0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x76,0x65,0x63,0x34,0x20,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,
+    0x77,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x69,0x65,
+    0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x76,0x65,0x63,0x34,0x20,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,
+    0x77,0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x63,0x61,0x6d,
+    0x65,0x72,0x61,0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x66,0x6f,0x63,0x61,0x6c,0x5f,0x70,0x78,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x63,0x61,0x6d,0x65,0x72,
+    0x61,0x5f,0x66,0x6f,0x72,0x77,0x61,0x72,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x76,0x69,0x65,0x77,0x70,0x6f,0x72,0x74,0x5f,0x77,0x69,
+    0x64,0x74,0x68,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,
+    0x69,0x65,0x77,0x70,0x6f,0x72,0x74,0x5f,0x68,0x65,0x69,0x67,0x68,0x74,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,
+    0x65,0x5f,0x63,0x6f,0x75,0x6e,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,
+    0x20,0x75,0x73,0x65,0x5f,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x73,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x62,0x75,0x64,0x67,0x65,0x74,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x5f,0x77,0x69,0x64,0x74,0x68,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,
+    0x73,0x70,0x6c,0x61,0x74,0x73,0x5f,0x70,0x65,0x72,0x5f,0x6c,0x61,0x79,0x65,0x72,
+    0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x65,
+    0x6c,0x65,0x63,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,0x5f,0x34,0x30,0x3b,
+    0x0a,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,
+    0x20,0x3d,0x20,0x33,0x2c,0x20,0x73,0x74,0x64,0x34,0x33,0x30,0x29,0x20,0x72,0x65,
+    0x61,0x64,0x6f,0x6e,0x6c,0x79,0x20,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x63,0x61,
+    0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x53,0x65,0x6c,0x65,0x63,0x74,0x56,0x61,0x6c,0x75,0x65,0x20,
+    0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x73,0x5b,0x5d,0x3b,0x0a,0x7d,0x20,
+    0x5f,0x32,0x35,0x30,0x3b,0x0a,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x62,0x69,
+    0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x34,0x2c,0x20,0x73,0x74,0x64,0x34,0x33,
+    0x30,0x29,0x20,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x62,0x69,0x6e,0x5f,0x62,0x75,
+    0x66,0x66,0x65,0x72,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x53,0x65,0x6c,0x65,0x63,
+    0x74,0x56,0x61,0x6c,0x75,0x65,0x20,0x62,0x69,0x6e,0x73,0x5b,0x5d,0x3b,0x0a,0x7d,
+    0x20,0x5f,0x32,0x36,0x32,0x3b,0x0a,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x62,
+    0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x35,0x2c,0x20,0x73,0x74,0x64,0x34,
+    0x33,0x30,0x29,0x20,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x73,0x65,0x6c,0x65,0x63,
+    0x74,0x5f,0x73,0x74,0x61,0x74,0x65,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x53,0x65,
+    0x6c,0x65,0x63,0x74,0x56,0x61,0x6c,0x75,0x65,0x20,0x73,0x74,0x61,0x74,0x65,0x5b,
+    0x5d,0x3b,0x0a,0x7d,0x20,0x5f,0x32,0x37,0x30,0x3b,0x0a,0x0a,0x6c,0x61,0x79,0x6f,
+    0x75,0x74,0x28,0x62,0x69,0x6e,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x37,0x2c,0x20,
+    0x73,0x74,0x64,0x34,0x33,0x30,0x29,0x20,0x77,0x72,0x69,0x74,0x65,0x6f,0x6e,0x6c,
+    0x79,0x20,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x73,0x65,0x6c,0x65,0x63,0x74,0x65,
+    0x64,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x53,
+    0x65,0x6c,0x65,0x63,0x74,0x56,0x61,0x6c,0x75,0x65,0x20,0x73,0x65,0x6c,0x65,0x63,
+    0x74,0x65,0x64,0x5b,0x5d,0x3b,0x0a,0x7d,0x20,0x5f,0x32,0x39,0x30,0x3b,0x0a,0x0a,
+    0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x6e,0x74,0x28,0x67,0x6c,0x5f,0x47,0x6c,0x6f,
+    0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,
+    0x78,0x29,0x20,0x3e,0x3d,0x20,0x5f,0x34,0x30,0x2e,0x63,0x61,0x6e,0x64,0x69,0x64,
+    0x61,0x74,0x65,0x5f,0x63,0x6f,0x75,0x6e,0x74,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,
+    0x5f,0x34,0x31,0x20,0x3d,0x20,0x5f,0x32,0x36,0x32,0x2e,0x62,0x69,0x6e,0x73,0x5b,
+    0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,
+    0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,0x34,0x39,0x20,0x3d,0x20,0x5f,
+    0x32,0x37,0x30,0x2e,0x73,0x74,0x61,0x74,0x65,0x5b,0x31,0x30,0x32,0x34,0x5d,0x2e,
+    0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,
+    0x6b,0x65,0x65,0x70,0x20,0x3d,0x20,0x5f,0x34,0x31,0x20,0x3e,0x20,0x5f,0x34,0x39,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x34,0x31,0x20,0x3d,0x3d,
+    0x20,0x5f,0x34,0x39,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,0x36,0x34,0x20,0x3d,0x20,0x61,
+    0x74,0x6f,0x6d,0x69,0x63,0x41,0x64,0x64,0x28,0x5f,0x32,0x37,0x30,0x2e,0x73,0x74,
+    0x61,0x74,0x65,0x5b,0x31,0x30,0x32,0x37,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x2c,
+    0x20,0x31,0x75,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6b,0x65,
+    0x65,0x70,0x20,0x3d,0x20,0x5f,0x36,0x34,0x20,0x3c,0x20,0x5f,0x32,0x37,0x30,0x2e,
+    0x73,0x74,0x61,0x74,0x65,0x5b,0x31,0x30,0x32,0x35,0x5d,0x2e,0x76,0x61,0x6c,0x75,
+    0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
+    0x28,0x6b,0x65,0x65,0x70,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,0x37,0x37,0x20,0x3d,0x20,
+    0x61,0x74,0x6f,0x6d,0x69,0x63,0x41,0x64,0x64,0x28,0x5f,0x32,0x37,0x30,0x2e,0x73,
+    0x74,0x61,0x74,0x65,0x5b,0x31,0x30,0x32,0x36,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,
+    0x2c,0x20,0x31,0x75,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,
+    0x32,0x39,0x30,0x2e,0x73,0x65,0x6c,0x65,0x63,0x74,0x65,0x64,0x5b,0x5f,0x37,0x37,
+    0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x28,0x5f,0x34,0x30,0x2e,0x75,
+    0x73,0x65,0x5f,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x73,0x20,0x21,0x3d,
+    0x20,0x30,0x29,0x20,0x3f,0x20,0x5f,0x32,0x35,0x30,0x2e,0x63,0x61,0x6e,0x64,0x69,
+    0x64,0x61,0x74,0x65,0x73,0x5b,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,
+    0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x5d,0x2e,0x76,
+    0x61,0x6c,0x75,0x65,0x20,0x3a,0x20,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,
+    0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x7d,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    struct SelectValue
+    {
+        uint value;
+    };
+
+    static const uint3 gl_WorkGroupSize = uint3(256u, 1u, 1u);
+
+    cbuffer select_params : register(b0)
+    {
+        float4 _40_viewProj_row0 : packoffset(c0);
+        float4 _40_viewProj_row1 : packoffset(c1);
+        float4 _40_viewProj_row2 : packoffset(c2);
+        float4 _40_viewProj_row3 : packoffset(c3);
+        float3 _40_camera_position : packoffset(c4);
+        float _40_focal_px : packoffset(c4.w);
+        float3 _40_camera_forward : packoffset(c5);
+        float _40_viewport_width : packoffset(c5.w);
+        float _40_viewport_height : packoffset(c6);
+        int _40_candidate_count : packoffset(c6.y);
+        int _40_use_candidates : packoffset(c6.z);
+        int _40_budget : packoffset(c6.w);
+        int _40_texture_width : packoffset(c7);
+        int _40_splats_per_layer : packoffset(c7.y);
+    };
+
+    ByteAddressBuffer _250 : register(t1);
+    RWByteAddressBuffer _262 : register(u0);
+    RWByteAddressBuffer _270 : register(u1);
+    Texture2DArray<uint4> splat_texture : register(t0);
+    Texture2D<float4> chunk_texture : register(t2);
+    SamplerState splat_sampler : register(s2);
+
+    static uint3 gl_GlobalInvocationID;
+    struct SPIRV_Cross_Input
+    {
+        uint3 gl_GlobalInvocationID : SV_DispatchThreadID;
+    };
+
+    uint4 fetch_splat(uint splat_idx)
+    {
+        int _31 = int(splat_idx) / _40_splats_per_layer;
+        int _37 = int(splat_idx) - (_31 * _40_splats_per_layer);
+        return splat_texture.Load(int4(int3(_37 % _40_texture_width, _37 / _40_texture_width, _31), 0));
+    }
+
+    uint score_bin(uint splat_idx)
+    {
+        uint param = splat_idx;
+        uint4 _80 = fetch_splat(param);
+        uint _84 = _80.w & 255u;
+        if (_84 < 3u)
+        {
+            return 0u;
+        }
+        int _112 = int(splat_idx) / 256;
+        int2 _120 = int2((_112 % 1024) * 2, _112 / 1024);
+        float3 _128 = chunk_texture.Load(int3(_120, 0)).xyz;
+        float3 _138 = _128 + ((float3(float((_80.x >> 16u) & 65535u), float(_80.x & 65535u), float((_80.y >> 16u) & 65535u)) * 1.525902189314365386962890625e-05f) * (chunk_texture.Load(int3(_120 + int2(1, 0), 0)).xyz - _128));
+        float _146 = dot(_138 - _40_camera_position, _40_camera_forward);
+        if (_146 < 0.001000000047497451305389404296875f)
+        {
+            return 0u;
+        }
+        float2 _166 = exp((float2(float((_80.z >> 16u) & 255u), float((_80.z >> 8u) & 255u)) * 0.0392156876623630523681640625f) - 5.0f.xx);
+        float _171 = _40_focal_px / _146;
+        float4 _176 = float4(_138, 1.0f);
+        float4 _197 = float4(dot(_40_viewProj_row0, _176), dot(_40_viewProj_row1, _176), dot(_40_viewProj_row2, _176), dot(_40_viewProj_row3, _176));
+        float _205 = (0.5f * max(_166.x, _166.y)) * _171;
+        float2 _209 = _197.xy / _197.w.xx;
+        if ((abs(_209.x) > (1.0f + ((2.0f * _205) / _40_viewport_width))) || (abs(_209.y) > (1.0f + ((2.0f * _205) / _40_viewport_height))))
+        {
+            return 0u;
+        }
+        float _235 = ((((_166.x * _166.y) * _171) * _171) * float(_84)) * 0.0039215688593685626983642578125f;
+        if (!(_235 > 0.0f))
+        {
+            return 0u;
+        }
+        return uint(clamp(((log2(_235) + 16.0f) * 25.575000762939453125f) + 1.0f, 1.0f, 1023.0f));
+    }
+
+    void comp_main()
+    {
+        if (int(gl_GlobalInvocationID.x) >= _40_candidate_count)
+        {
+            return;
+        }
+        uint _265 = (_40_use_candidates != 0) ? _250.Load(gl_GlobalInvocationID.x * 4 + 0) : gl_GlobalInvocationID.x;
+        uint param_1 = _265;
+        uint _268 = score_bin(param_1);
+        _262.Store(gl_GlobalInvocationID.x * 4 + 0, _268);
+        uint _275;
+        _270.InterlockedAdd(_268 * 4 + 0, 1u, _275);
+    }
+
+    [numthreads(256, 1, 1)]
+    void main(SPIRV_Cross_Input stage_input)
+    {
+        gl_GlobalInvocationID = stage_input.gl_GlobalInvocationID;
+        comp_main();
+    }
+*/
+static const uint8_t score_bins_source_hlsl5[3570] = {
+    0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x65,0x6c,0x65,0x63,0x74,0x56,0x61,0x6c,
+    0x75,0x65,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x76,0x61,
+    0x6c,0x75,0x65,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,
+    0x63,0x6f,0x6e,0x73,0x74,0x20,0x75,0x69,0x6e,0x74,0x33,0x20,0x67,0x6c,0x5f,0x57,
+    0x6f,0x72,0x6b,0x47,0x72,0x6f,0x75,0x70,0x53,0x69,0x7a,0x65,0x20,0x3d,0x20,0x75,
+    0x69,0x6e,0x74,0x33,0x28,0x32,0x35,0x36,0x75,0x2c,0x20,0x31,0x75,0x2c,0x20,0x31,
+    0x75,0x29,0x3b,0x0a,0x0a,0x63,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x73,0x65,0x6c,
+    0x65,0x63,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,0x3a,0x20,0x72,0x65,0x67,
+    0x69,0x73,0x74,0x65,0x72,0x28,0x62,0x30,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x34,0x30,0x5f,0x76,0x69,0x65,0x77,0x50,
+    0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x30,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,
+    0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x34,0x30,0x5f,0x76,0x69,0x65,0x77,0x50,0x72,
+    0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x31,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,
+    0x66,0x73,0x65,0x74,0x28,0x63,0x31,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x20,0x5f,0x34,0x30,0x5f,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,
+    0x6a,0x5f,0x72,0x6f,0x77,0x32,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,
+    0x73,0x65,0x74,0x28,0x63,0x32,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x20,0x5f,0x34,0x30,0x5f,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,
+    0x5f,0x72,0x6f,0x77,0x33,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,
+    0x65,0x74,0x28,0x63,0x33,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x33,0x20,0x5f,0x34,0x30,0x5f,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x70,0x6f,
+    0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,
+    0x73,0x65,0x74,0x28,0x63,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x5f,0x34,0x30,0x5f,0x66,0x6f,0x63,0x61,0x6c,0x5f,0x70,0x78,0x20,
+    0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x34,0x2e,
+    0x77,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,
+    0x34,0x30,0x5f,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x66,0x6f,0x72,0x77,0x61,0x72,
+    0x64,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,
+    0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x34,
+    0x30,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x72,0x74,0x5f,0x77,0x69,0x64,0x74,0x68,
+    0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x35,
+    0x2e,0x77,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,
+    0x34,0x30,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x72,0x74,0x5f,0x68,0x65,0x69,0x67,
+    0x68,0x74,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,
+    0x63,0x36,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x5f,0x34,0x30,
+    0x5f,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x5f,0x63,0x6f,0x75,0x6e,0x74,
+    0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x36,
+    0x2e,0x79,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x5f,0x34,0x30,
+    0x5f,0x75,0x73,0x65,0x5f,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x73,0x20,
+    0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x36,0x2e,
+    0x7a,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x5f,0x34,0x30,0x5f,
+    0x62,0x75,0x64,0x67,0x65,0x74,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,
+    0x73,0x65,0x74,0x28,0x63,0x36,0x2e,0x77,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,
+    0x6e,0x74,0x20,0x5f,0x34,0x30,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x77,
+    0x69,0x64,0x74,0x68,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,
+    0x74,0x28,0x63,0x37,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x5f,
+    0x34,0x30,0x5f,0x73,0x70,0x6c,0x61,0x74,0x73,0x5f,0x70,0x65,0x72,0x5f,0x6c,0x61,
+    0x79,0x65,0x72,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,
+    0x28,0x63,0x37,0x2e,0x79,0x29,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x42,0x79,0x74,0x65,
+    0x41,0x64,0x64,0x72,0x65,0x73,0x73,0x42,0x75,0x66,0x66,0x65,0x72,0x20,0x5f,0x32,
+    0x35,0x30,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x74,0x31,
+    0x29,0x3b,0x0a,0x52,0x57,0x42,0x79,0x74,0x65,0x41,0x64,0x64,0x72,0x65,0x73,0x73,
+    0x42,0x75,0x66,0x66,0x65,0x72,0x20,0x5f,0x32,0x36,0x32,0x20,0x3a,0x20,0x72,0x65,
+    0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x75,0x30,0x29,0x3b,0x0a,0x52,0x57,0x42,0x79,
+    0x74,0x65,0x41,0x64,0x64,0x72,0x65,0x73,0x73,0x42,0x75,0x66,0x66,0x65,0x72,0x20,
+    0x5f,0x32,0x37,0x30,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,
+    0x75,0x31,0x29,0x3b,0x0a,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x44,0x41,0x72,
+    0x72,0x61,0x79,0x3c,0x75,0x69,0x6e,0x74,0x34,0x3e,0x20,0x73,0x70,0x6c,0x61,0x74,
+    0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,
+    0x74,0x65,0x72,0x28,0x74,0x30,0x29,0x3b,0x0a,0x54,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x32,0x44,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x34,0x3e,0x20,0x63,0x68,0x75,0x6e,0x6b,
+    0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,
+    0x74,0x65,0x72,0x28,0x74,0x32,0x29,0x3b,0x0a,0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,
+    0x53,0x74,0x61,0x74,0x65,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x73,0x61,0x6d,0x70,
+    0x6c,0x65,0x72,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x73,
+    0x32,0x29,0x3b,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x75,0x69,0x6e,0x74,
+    0x33,0x20,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,
+    0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x3b,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,
+    0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,
+    0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x33,0x20,0x67,0x6c,
+    0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,
+    0x6e,0x49,0x44,0x20,0x3a,0x20,0x53,0x56,0x5f,0x44,0x69,0x73,0x70,0x61,0x74,0x63,
+    0x68,0x54,0x68,0x72,0x65,0x61,0x64,0x49,0x44,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x75,
+    0x69,0x6e,0x74,0x34,0x20,0x66,0x65,0x74,0x63,0x68,0x5f,0x73,0x70,0x6c,0x61,0x74,
+    0x28,0x75,0x69,0x6e,0x74,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x69,0x64,0x78,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x5f,0x33,0x31,0x20,0x3d,
+    0x20,0x69,0x6e,0x74,0x28,0x73,0x70,0x6c,0x61,0x74,0x5f,0x69,0x64,0x78,0x29,0x20,
+    0x2f,0x20,0x5f,0x34,0x30,0x5f,0x73,0x70,0x6c,0x61,0x74,0x73,0x5f,0x70,0x65,0x72,
+    0x5f,0x6c,0x61,0x79,0x65,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,
+    0x5f,0x33,0x37,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,0x73,0x70,0x6c,0x61,0x74,0x5f,
+    0x69,0x64,0x78,0x29,0x20,0x2d,0x20,0x28,0x5f,0x33,0x31,0x20,0x2a,0x20,0x5f,0x34,
+    0x30,0x5f,0x73,0x70,0x6c,0x61,0x74,0x73,0x5f,0x70,0x65,0x72,0x5f,0x6c,0x61,0x79,
+    0x65,0x72,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
+    0x73,0x70,0x6c,0x61,0x74,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x4c,0x6f,
+    0x61,0x64,0x28,0x69,0x6e,0x74,0x34,0x28,0x69,0x6e,0x74,0x33,0x28,0x5f,0x33,0x37,
+    0x20,0x25,0x20,0x5f,0x34,0x30,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x77,
+    0x69,0x64,0x74,0x68,0x2c,0x20,0x5f,0x33,0x37,0x20,0x2f,0x20,0x5f,0x34,0x30,0x5f,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x77,0x69,0x64,0x74,0x68,0x2c,0x20,0x5f,
+    0x33,0x31,0x29,0x2c,0x20,0x30,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x75,0x69,0x6e,
+    0x74,0x20,0x73,0x63,0x6f,0x72,0x65,0x5f,0x62,0x69,0x6e,0x28,0x75,0x69,0x6e,0x74,
+    0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x69,0x64,0x78,0x29,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x73,
+    0x70,0x6c,0x61,0x74,0x5f,0x69,0x64,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,
+    0x6e,0x74,0x34,0x20,0x5f,0x38,0x30,0x20,0x3d,0x20,0x66,0x65,0x74,0x63,0x68,0x5f,
+    0x73,0x70,0x6c,0x61,0x74,0x28,0x70,0x61,0x72,0x61,0x6d,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,0x38,0x34,0x20,0x3d,0x20,0x5f,0x38,0x30,
+    0x2e,0x77,0x20,0x26,0x20,0x32,0x35,0x35,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,
+    0x66,0x20,0x28,0x5f,0x38,0x34,0x20,0x3c,0x20,0x33,0x75,0x29,0x0a,0x20,0x20,0x20,
+    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,
+    0x6e,0x20,0x30,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
+    0x69,0x6e,0x74,0x20,0x5f,0x31,0x31,0x32,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,0x73,
+    0x70,0x6c,0x61,0x74,0x5f,0x69,0x64,0x78,0x29,0x20,0x2f,0x20,0x32,0x35,0x36,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x32,0x20,0x5f,0x31,0x32,0x30,0x20,0x3d,
+    0x20,0x69,0x6e,0x74,0x32,0x28,0x28,0x5f,0x31,0x31,0x32,0x20,0x25,0x20,0x31,0x30,
+    0x32,0x34,0x29,0x20,0x2a,0x20,0x32,0x2c,0x20,0x5f,0x31,0x31,0x32,0x20,0x2f,0x20,
+    0x31,0x30,0x32,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x33,0x20,0x5f,0x31,0x32,0x38,0x20,0x3d,0x20,0x63,0x68,0x75,0x6e,0x6b,0x5f,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x4c,0x6f,0x61,0x64,0x28,0x69,0x6e,0x74,0x33,
+    0x28,0x5f,0x31,0x32,0x30,0x2c,0x20,0x30,0x29,0x29,0x2e,0x78,0x79,0x7a,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x31,0x33,0x38,0x20,
+    0x3d,0x20,0x5f,0x31,0x32,0x38,0x20,0x2b,0x20,0x28,0x28,0x66,0x6c,0x6f,0x61,0x74,
+    0x33,0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x28,0x5f,0x38,0x30,0x2e,0x78,0x20,0x3e,
+    0x3e,0x20,0x31,0x36,0x75,0x29,0x20,0x26,0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x29,
+    0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x5f,0x38,0x30,0x2e,0x78,0x20,0x26,0x20,
+    0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x28,
+    0x5f,0x38,0x30,0x2e,0x79,0x20,0x3e,0x3e,0x20,0x31,0x36,0x75,0x29,0x20,0x26,0x20,
+    0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x29,0x20,0x2a,0x20,0x31,0x2e,0x35,0x32,0x35,
+    0x39,0x30,0x32,0x31,0x38,0x39,0x33,0x31,0x34,0x33,0x36,0x35,0x33,0x38,0x36,0x39,
+    0x36,0x32,0x38,0x39,0x30,0x36,0x32,0x35,0x65,0x2d,0x30,0x35,0x66,0x29,0x20,0x2a,
+    0x20,0x28,0x63,0x68,0x75,0x6e,0x6b,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,
+    0x4c,0x6f,0x61,0x64,0x28,0x69,0x6e,0x74,0x33,0x28,0x5f,0x31,0x32,0x30,0x20,0x2b,
+    0x20,0x69,0x6e,0x74,0x32,0x28,0x31,0x2c,0x20,0x30,0x29,0x2c,0x20,0x30,0x29,0x29,
+    0x2e,0x78,0x79,0x7a,0x20,0x2d,0x20,0x5f,0x31,0x32,0x38,0x29,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,0x34,0x36,0x20,0x3d,0x20,
+    0x64,0x6f,0x74,0x28,0x5f,0x31,0x33,0x38,0x20,0x2d,0x20,0x5f,0x34,0x30,0x5f,0x63,
+    0x61,0x6d,0x65,0x72,0x61,0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2c,0x20,
+    0x5f,0x34,0x30,0x5f,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x66,0x6f,0x72,0x77,0x61,
+    0x72,0x64,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x31,0x34,
+    0x36,0x20,0x3c,0x20,0x30,0x2e,0x30,0x30,0x31,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+    0x34,0x37,0x34,0x39,0x37,0x34,0x35,0x31,0x33,0x30,0x35,0x33,0x38,0x39,0x34,0x30,
+    0x34,0x32,0x39,0x36,0x38,0x37,0x35,0x66,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x30,
+    0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x20,0x5f,0x31,0x36,0x36,0x20,0x3d,0x20,0x65,0x78,0x70,0x28,0x28,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x28,0x5f,0x38,
+    0x30,0x2e,0x7a,0x20,0x3e,0x3e,0x20,0x31,0x36,0x75,0x29,0x20,0x26,0x20,0x32,0x35,
+    0x35,0x75,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x28,0x5f,0x38,0x30,0x2e,
+    0x7a,0x20,0x3e,0x3e,0x20,0x38,0x75,0x29,0x20,0x26,0x20,0x32,0x35,0x35,0x75,0x29,
+    0x29,0x20,0x2a,0x20,0x30,0x2e,0x30,0x33,0x39,0x32,0x31,0x35,0x36,0x38,0x37,0x36,
+    0x36,0x32,0x33,0x36,0x33,0x30,0x35,0x32,0x33,0x36,0x38,0x31,0x36,0x34,0x30,0x36,
+    0x32,0x35,0x66,0x29,0x20,0x2d,0x20,0x35,0x2e,0x30,0x66,0x2e,0x78,0x78,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,0x37,0x31,0x20,
+    0x3d,0x20,0x5f,0x34,0x30,0x5f,0x66,0x6f,0x63,0x61,0x6c,0x5f,0x70,0x78,0x20,0x2f,
+    0x20,0x5f,0x31,0x34,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x20,0x5f,0x31,0x37,0x36,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,
+    0x5f,0x31,0x33,0x38,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x31,0x39,0x37,0x20,0x3d,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x28,0x64,0x6f,0x74,0x28,0x5f,0x34,0x30,0x5f,0x76,0x69,
+    0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x30,0x2c,0x20,0x5f,0x31,0x37,
+    0x36,0x29,0x2c,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x30,0x5f,0x76,0x69,0x65,0x77,
+    0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x31,0x2c,0x20,0x5f,0x31,0x37,0x36,0x29,
+    0x2c,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x30,0x5f,0x76,0x69,0x65,0x77,0x50,0x72,
+    0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x32,0x2c,0x20,0x5f,0x31,0x37,0x36,0x29,0x2c,0x20,
+    0x64,0x6f,0x74,0x28,0x5f,0x34,0x30,0x5f,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,
+    0x5f,0x72,0x6f,0x77,0x33,0x2c,0x20,0x5f,0x31,0x37,0x36,0x29,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,0x30,0x35,0x20,0x3d,0x20,
+    0x28,0x30,0x2e,0x35,0x66,0x20,0x2a,0x20,0x6d,0x61,0x78,0x28,0x5f,0x31,0x36,0x36,
+    0x2e,0x78,0x2c,0x20,0x5f,0x31,0x36,0x36,0x2e,0x79,0x29,0x29,0x20,0x2a,0x20,0x5f,
+    0x31,0x37,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
+    0x5f,0x32,0x30,0x39,0x20,0x3d,0x20,0x5f,0x31,0x39,0x37,0x2e,0x78,0x79,0x20,0x2f,
+    0x20,0x5f,0x31,0x39,0x37,0x2e,0x77,0x2e,0x78,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x69,0x66,0x20,0x28,0x28,0x61,0x62,0x73,0x28,0x5f,0x32,0x30,0x39,0x2e,0x78,0x29,
+    0x20,0x3e,0x20,0x28,0x31,0x2e,0x30,0x66,0x20,0x2b,0x20,0x28,0x28,0x32,0x2e,0x30,
+    0x66,0x20,0x2a,0x20,0x5f,0x32,0x30,0x35,0x29,0x20,0x2f,0x20,0x5f,0x34,0x30,0x5f,
+    0x76,0x69,0x65,0x77,0x70,0x6f,0x72,0x74,0x5f,0x77,0x69,0x64,0x74,0x68,0x29,0x29,
+    0x29,0x20,0x7c,0x7c,0x20,0x28,0x61,0x62,0x73,0x28,0x5f,0x32,0x30,0x39,0x2e,0x79,
+    0x29,0x20,0x3e,0x20,0x28,0x31,0x2e,0x30,0x66,0x20,0x2b,0x20,0x28,0x28,0x32,0x2e,
+    0x30,0x66,0x20,0x2a,0x20,0x5f,0x32,0x30,0x35,0x29,0x20,0x2f,0x20,0x5f,0x34,0x30,
+    0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x72,0x74,0x5f,0x68,0x65,0x69,0x67,0x68,0x74,
+    0x29,0x29,0x29,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x30,0x75,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,
+    0x33,0x35,0x20,0x3d,0x20,0x28,0x28,0x28,0x28,0x5f,0x31,0x36,0x36,0x2e,0x78,0x20,
+    0x2a,0x20,0x5f,0x31,0x36,0x36,0x2e,0x79,0x29,0x20,0x2a,0x20,0x5f,0x31,0x37,0x31,
+    0x29,0x20,0x2a,0x20,0x5f,0x31,0x37,0x31,0x29,0x20,0x2a,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x28,0x5f,0x38,0x34,0x29,0x29,0x20,0x2a,0x20,0x30,0x2e,0x30,0x30,0x33,0x39,
+    0x32,0x31,0x35,0x36,0x38,0x38,0x35,0x39,0x33,0x36,0x38,0x35,0x36,0x32,0x36,0x39,
+    0x38,0x33,0x36,0x34,0x32,0x35,0x37,0x38,0x31,0x32,0x35,0x66,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x66,0x20,0x28,0x21,0x28,0x5f,0x32,0x33,0x35,0x20,0x3e,0x20,0x30,
+    0x2e,0x30,0x66,0x29,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x30,0x75,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
+    0x75,0x69,0x6e,0x74,0x28,0x63,0x6c,0x61,0x6d,0x70,0x28,0x28,0x28,0x6c,0x6f,0x67,
+    0x32,0x28,0x5f,0x32,0x33,0x35,0x29,0x20,0x2b,0x20,0x31,0x36,0x2e,0x30,0x66,0x29,
+    0x20,0x2a,0x20,0x32,0x35,0x2e,0x35,0x37,0x35,0x30,0x30,0x30,0x37,0x36,0x32,0x39,
+    0x33,0x39,0x34,0x35,0x33,0x31,0x32,0x35,0x66,0x29,0x20,0x2b,0x20,0x31,0x2e,0x30,
+    0x66,0x2c,0x20,0x31,0x2e,0x30,0x66,0x2c,0x20,0x31,0x30,0x32,0x33,0x2e,0x30,0x66,
+    0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x63,0x6f,0x6d,0x70,
+    0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,
+    0x20,0x28,0x69,0x6e,0x74,0x28,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,
+    0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x29,0x20,0x3e,
+    0x3d,0x20,0x5f,0x34,0x30,0x5f,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x5f,
+    0x63,0x6f,0x75,0x6e,0x74,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,0x32,0x36,0x35,
+    0x20,0x3d,0x20,0x28,0x5f,0x34,0x30,0x5f,0x75,0x73,0x65,0x5f,0x63,0x61,0x6e,0x64,
+    0x69,0x64,0x61,0x74,0x65,0x73,0x20,0x21,0x3d,0x20,0x30,0x29,0x20,0x3f,0x20,0x5f,
+    0x32,0x35,0x30,0x2e,0x4c,0x6f,0x61,0x64,0x28,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,
+    0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,
+    0x20,0x2a,0x20,0x34,0x20,0x2b,0x20,0x30,0x29,0x20,0x3a,0x20,0x67,0x6c,0x5f,0x47,
+    0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,
+    0x44,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x5f,0x32,0x36,0x35,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,0x32,0x36,0x38,0x20,0x3d,0x20,0x73,0x63,
+    0x6f,0x72,0x65,0x5f,0x62,0x69,0x6e,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x5f,0x32,0x36,0x32,0x2e,0x53,0x74,0x6f,0x72,0x65,
+    0x28,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,
+    0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x20,0x2a,0x20,0x34,0x20,0x2b,0x20,0x30,
+    0x2c,0x20,0x5f,0x32,0x36,0x38,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,
+    0x74,0x20,0x5f,0x32,0x37,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x5f,0x32,0x37,0x30,
+    0x2e,0x49,0x6e,0x74,0x65,0x72,0x6c,0x6f,0x63,0x6b,0x65,0x64,0x41,0x64,0x64,0x28,
+    0x5f,0x32,0x36,0x38,0x20,0x2a,0x20,0x34,0x20,0x2b,0x20,0x30,0x2c,0x20,0x31,0x75,
+    0x2c,0x20,0x5f,0x32,0x37,0x35,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x5b,0x6e,0x75,0x6d,
+    0x74,0x68,0x72,0x65,0x61,0x64,0x73,0x28,0x32,0x35,0x36,0x2c,0x20,0x31,0x2c,0x20,
+    0x31,0x29,0x5d,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x53,0x50,
+    0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x20,
+    0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x29,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,
+    0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,
+    0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,
+    0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x63,0x6f,0x6d,0x70,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x3b,0x0a,0x7d,
+    0x0a,0x00,
+};
+/*
+    struct SelectValue
+    {
+        uint value;
+    };
+
+    struct SelectSplatTexel
+    {
+        uint4 value;
+    };
+
+    static const uint3 gl_WorkGroupSize = uint3(256u, 1u, 1u);
+
+    cbuffer select_params : register(b0)
+    {
+        float4 _40_viewProj_row0 : packoffset(c0);
+        float4 _40_viewProj_row1 : packoffset(c1);
+        float4 _40_viewProj_row2 : packoffset(c2);
+        float4 _40_viewProj_row3 : packoffset(c3);
+        float3 _40_camera_position : packoffset(c4);
+        float _40_focal_px : packoffset(c4.w);
+        float3 _40_camera_forward : packoffset(c5);
+        float _40_viewport_width : packoffset(c5.w);
+        float _40_viewport_height : packoffset(c6);
+        int _40_candidate_count : packoffset(c6.y);
+        int _40_use_candidates : packoffset(c6.z);
+        int _40_budget : packoffset(c6.w);
+        int _40_texture_width : packoffset(c7);
+        int _40_splats_per_layer : packoffset(c7.y);
+    };
+
+    ByteAddressBuffer _25 : register(t2);
+    ByteAddressBuffer _250 : register(t0);
+    RWByteAddressBuffer _262 : register(u0);
+    RWByteAddressBuffer _270 : register(u1);
+    Texture2D<float4> chunk_texture : register(t1);
+    SamplerState splat_sampler : register(s2);
+
+    static uint3 gl_GlobalInvocationID;
+    struct SPIRV_Cross_Input
+    {
+        uint3 gl_GlobalInvocationID : SV_DispatchThreadID;
+    };
+
+    uint4 fetch_splat(uint splat_idx)
+    {
+        return _25.Load4(splat_idx * 16 + 0);
+    }
+
+    uint score_bin(uint splat_idx)
+    {
+        uint param = splat_idx;
+        uint4 _80 = fetch_splat(param);
+        uint _84 = _80.w & 255u;
+        if (_84 < 3u)
+        {
+            return 0u;
+        }
+        int _112 = int(splat_idx) / 256;
+        int2 _120 = int2((_112 % 1024) * 2, _112 / 1024);
+        float3 _128 = chunk_texture.Load(int3(_120, 0)).xyz;
+        float3 _138 = _128 + ((float3(float((_80.x >> 16u) & 65535u), float(_80.x & 65535u), float((_80.y >> 16u) & 65535u)) * 1.525902189314365386962890625e-05f) * (chunk_texture.Load(int3(_120 + int2(1, 0), 0)).xyz - _128));
+        float _146 = dot(_138 - _40_camera_position, _40_camera_forward);
+        if (_146 < 0.001000000047497451305389404296875f)
+        {
+            return 0u;
+        }
+        float2 _166 = exp((float2(float((_80.z >> 16u) & 255u), float((_80.z >> 8u) & 255u)) * 0.0392156876623630523681640625f) - 5.0f.xx);
+        float _171 = _40_focal_px / _146;
+        float4 _176 = float4(_138, 1.0f);
+        float4 _197 = float4(dot(_40_viewProj_row0, _176), dot(_40_viewProj_row1, _176), dot(_40_viewProj_row2, _176), dot(_40_viewProj_row3, _176));
+        float _205 = (0.5f * max(_166.x, _166.y)) * _171;
+        float2 _209 = _197.xy / _197.w.xx;
+        if ((abs(_209.x) > (1.0f + ((2.0f * _205) / _40_viewport_width))) || (abs(_209.y) > (1.0f + ((2.0f * _205) / _40_viewport_height))))
+        {
+            return 0u;
+        }
+        float _235 = ((((_166.x * _166.y) * _171) * _171) * float(_84)) * 0.0039215688593685626983642578125f;
+        if (!(_235 > 0.0f))
+        {
+            return 0u;
+        }
+        return uint(clamp(((log2(_235) + 16.0f) * 25.575000762939453125f) + 1.0f, 1.0f, 1023.0f));
+    }
+
+    void comp_main()
+    {
+        if (int(gl_GlobalInvocationID.x) >= _40_candidate_count)
+        {
+            return;
+        }
+        uint _265 = (_40_use_candidates != 0) ? _250.Load(gl_GlobalInvocationID.x * 4 + 0) : gl_GlobalInvocationID.x;
+        uint param_1 = _265;
+        uint _268 = score_bin(param_1);
+        _262.Store(gl_GlobalInvocationID.x * 4 + 0, _268);
+        uint _275;
+        _270.InterlockedAdd(_268 * 4 + 0, 1u, _275);
+    }
+
+    [numthreads(256, 1, 1)]
+    void main(SPIRV_Cross_Input stage_input)
+    {
+        gl_GlobalInvocationID = stage_input.gl_GlobalInvocationID;
+        comp_main();
+    }
+*/
+static const uint8_t score_bins_buffer_source_hlsl5[3430] = {
+    0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x65,0x6c,0x65,0x63,0x74,0x56,0x61,0x6c,
+    0x75,0x65,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x76,0x61,
+    0x6c,0x75,0x65,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,
+    0x53,0x65,0x6c,0x65,0x63,0x74,0x53,0x70,0x6c,0x61,0x74,0x54,0x65,0x78,0x65,0x6c,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x34,0x20,0x76,0x61,0x6c,
+    0x75,0x65,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x63,
+    0x6f,0x6e,0x73,0x74,0x20,0x75,0x69,0x6e,0x74,0x33,0x20,0x67,0x6c,0x5f,0x57,0x6f,
+    0x72,0x6b,0x47,0x72,0x6f,0x75,0x70,0x53,0x69,0x7a,0x65,0x20,0x3d,0x20,0x75,0x69,
+    0x6e,0x74,0x33,0x28,0x32,0x35,0x36,0x75,0x2c,0x20,0x31,0x75,0x2c,0x20,0x31,0x75,
+    0x29,0x3b,0x0a,0x0a,0x63,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x73,0x65,0x6c,0x65,
+    0x63,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,
+    0x73,0x74,0x65,0x72,0x28,0x62,0x30,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x34,0x30,0x5f,0x76,0x69,0x65,0x77,0x50,0x72,
+    0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x30,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,
+    0x66,0x73,0x65,0x74,0x28,0x63,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x20,0x5f,0x34,0x30,0x5f,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,
+    0x6a,0x5f,0x72,0x6f,0x77,0x31,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,
+    0x73,0x65,0x74,0x28,0x63,0x31,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x20,0x5f,0x34,0x30,0x5f,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,
+    0x5f,0x72,0x6f,0x77,0x32,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,
+    0x65,0x74,0x28,0x63,0x32,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x34,0x20,0x5f,0x34,0x30,0x5f,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,
+    0x72,0x6f,0x77,0x33,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,
+    0x74,0x28,0x63,0x33,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x33,0x20,0x5f,0x34,0x30,0x5f,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x70,0x6f,0x73,
+    0x69,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,
+    0x65,0x74,0x28,0x63,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x5f,0x34,0x30,0x5f,0x66,0x6f,0x63,0x61,0x6c,0x5f,0x70,0x78,0x20,0x3a,
+    0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x34,0x2e,0x77,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x34,
+    0x30,0x5f,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x66,0x6f,0x72,0x77,0x61,0x72,0x64,
+    0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x35,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x34,0x30,
+    0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x72,0x74,0x5f,0x77,0x69,0x64,0x74,0x68,0x20,
+    0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x35,0x2e,
+    0x77,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x34,
+    0x30,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x72,0x74,0x5f,0x68,0x65,0x69,0x67,0x68,
+    0x74,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,
+    0x36,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x5f,0x34,0x30,0x5f,
+    0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x5f,0x63,0x6f,0x75,0x6e,0x74,0x20,
+    0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x36,0x2e,
+    0x79,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x5f,0x34,0x30,0x5f,
+    0x75,0x73,0x65,0x5f,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x73,0x20,0x3a,
+    0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x36,0x2e,0x7a,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x5f,0x34,0x30,0x5f,0x62,
+    0x75,0x64,0x67,0x65,0x74,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,
+    0x65,0x74,0x28,0x63,0x36,0x2e,0x77,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,
+    0x74,0x20,0x5f,0x34,0x30,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x77,0x69,
+    0x64,0x74,0x68,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,
+    0x28,0x63,0x37,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x5f,0x34,
+    0x30,0x5f,0x73,0x70,0x6c,0x61,0x74,0x73,0x5f,0x70,0x65,0x72,0x5f,0x6c,0x61,0x79,
+    0x65,0x72,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,
+    0x63,0x37,0x2e,0x79,0x29,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x42,0x79,0x74,0x65,0x41,
+    0x64,0x64,0x72,0x65,0x73,0x73,0x42,0x75,0x66,0x66,0x65,0x72,0x20,0x5f,0x32,0x35,
+    0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x74,0x32,0x29,0x3b,
+    0x0a,0x42,0x79,0x74,0x65,0x41,0x64,0x64,0x72,0x65,0x73,0x73,0x42,0x75,0x66,0x66,
+    0x65,0x72,0x20,0x5f,0x32,0x35,0x30,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,
+    0x65,0x72,0x28,0x74,0x30,0x29,0x3b,0x0a,0x52,0x57,0x42,0x79,0x74,0x65,0x41,0x64,
+    0x64,0x72,0x65,0x73,0x73,0x42,0x75,0x66,0x66,0x65,0x72,0x20,0x5f,0x32,0x36,0x32,
+    0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x75,0x30,0x29,0x3b,
+    0x0a,0x52,0x57,0x42,0x79,0x74,0x65,0x41,0x64,0x64,0x72,0x65,0x73,0x73,0x42,0x75,
+    0x66,0x66,0x65,0x72,0x20,0x5f,0x32,0x37,0x30,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,
+    0x73,0x74,0x65,0x72,0x28,0x75,0x31,0x29,0x3b,0x0a,0x54,0x65,0x78,0x74,0x75,0x72,
+    0x65,0x32,0x44,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x34,0x3e,0x20,0x63,0x68,0x75,0x6e,
+    0x6b,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,
+    0x73,0x74,0x65,0x72,0x28,0x74,0x31,0x29,0x3b,0x0a,0x53,0x61,0x6d,0x70,0x6c,0x65,
+    0x72,0x53,0x74,0x61,0x74,0x65,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x73,0x61,0x6d,
+    0x70,0x6c,0x65,0x72,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,
+    0x73,0x32,0x29,0x3b,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x75,0x69,0x6e,
+    0x74,0x33,0x20,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,
+    0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x3b,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,
+    0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,
+    0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x33,0x20,0x67,
+    0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,
+    0x6f,0x6e,0x49,0x44,0x20,0x3a,0x20,0x53,0x56,0x5f,0x44,0x69,0x73,0x70,0x61,0x74,
+    0x63,0x68,0x54,0x68,0x72,0x65,0x61,0x64,0x49,0x44,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,
+    0x75,0x69,0x6e,0x74,0x34,0x20,0x66,0x65,0x74,0x63,0x68,0x5f,0x73,0x70,0x6c,0x61,
+    0x74,0x28,0x75,0x69,0x6e,0x74,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x69,0x64,0x78,
+    0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5f,
+    0x32,0x35,0x2e,0x4c,0x6f,0x61,0x64,0x34,0x28,0x73,0x70,0x6c,0x61,0x74,0x5f,0x69,
+    0x64,0x78,0x20,0x2a,0x20,0x31,0x36,0x20,0x2b,0x20,0x30,0x29,0x3b,0x0a,0x7d,0x0a,
+    0x0a,0x75,0x69,0x6e,0x74,0x20,0x73,0x63,0x6f,0x72,0x65,0x5f,0x62,0x69,0x6e,0x28,
+    0x75,0x69,0x6e,0x74,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x69,0x64,0x78,0x29,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,
+    0x20,0x3d,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x69,0x64,0x78,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x75,0x69,0x6e,0x74,0x34,0x20,0x5f,0x38,0x30,0x20,0x3d,0x20,0x66,0x65,
+    0x74,0x63,0x68,0x5f,0x73,0x70,0x6c,0x61,0x74,0x28,0x70,0x61,0x72,0x61,0x6d,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,0x38,0x34,0x20,0x3d,
+    0x20,0x5f,0x38,0x30,0x2e,0x77,0x20,0x26,0x20,0x32,0x35,0x35,0x75,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x38,0x34,0x20,0x3c,0x20,0x33,0x75,0x29,
+    0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,
+    0x65,0x74,0x75,0x72,0x6e,0x20,0x30,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,
+    0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x5f,0x31,0x31,0x32,0x20,0x3d,0x20,0x69,
+    0x6e,0x74,0x28,0x73,0x70,0x6c,0x61,0x74,0x5f,0x69,0x64,0x78,0x29,0x20,0x2f,0x20,
+    0x32,0x35,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x32,0x20,0x5f,0x31,
+    0x32,0x30,0x20,0x3d,0x20,0x69,0x6e,0x74,0x32,0x28,0x28,0x5f,0x31,0x31,0x32,0x20,
+    0x25,0x20,0x31,0x30,0x32,0x34,0x29,0x20,0x2a,0x20,0x32,0x2c,0x20,0x5f,0x31,0x31,
+    0x32,0x20,0x2f,0x20,0x31,0x30,0x32,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x31,0x32,0x38,0x20,0x3d,0x20,0x63,0x68,0x75,
+    0x6e,0x6b,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x4c,0x6f,0x61,0x64,0x28,
+    0x69,0x6e,0x74,0x33,0x28,0x5f,0x31,0x32,0x30,0x2c,0x20,0x30,0x29,0x29,0x2e,0x78,
+    0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,
+    0x31,0x33,0x38,0x20,0x3d,0x20,0x5f,0x31,0x32,0x38,0x20,0x2b,0x20,0x28,0x28,0x66,
+    0x6c,0x6f,0x61,0x74,0x33,0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x28,0x5f,0x38,0x30,
+    0x2e,0x78,0x20,0x3e,0x3e,0x20,0x31,0x36,0x75,0x29,0x20,0x26,0x20,0x36,0x35,0x35,
+    0x33,0x35,0x75,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x5f,0x38,0x30,0x2e,
+    0x78,0x20,0x26,0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x2c,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x28,0x28,0x5f,0x38,0x30,0x2e,0x79,0x20,0x3e,0x3e,0x20,0x31,0x36,0x75,
+    0x29,0x20,0x26,0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x29,0x20,0x2a,0x20,0x31,
+    0x2e,0x35,0x32,0x35,0x39,0x30,0x32,0x31,0x38,0x39,0x33,0x31,0x34,0x33,0x36,0x35,
+    0x33,0x38,0x36,0x39,0x36,0x32,0x38,0x39,0x30,0x36,0x32,0x35,0x65,0x2d,0x30,0x35,
+    0x66,0x29,0x20,0x2a,0x20,0x28,0x63,0x68,0x75,0x6e,0x6b,0x5f,0x74,0x65,0x78,0x74,
+    0x75,0x72,0x65,0x2e,0x4c,0x6f,0x61,0x64,0x28,0x69,0x6e,0x74,0x33,0x28,0x5f,0x31,
+    0x32,0x30,0x20,0x2b,0x20,0x69,0x6e,0x74,0x32,0x28,0x31,0x2c,0x20,0x30,0x29,0x2c,
+    0x20,0x30,0x29,0x29,0x2e,0x78,0x79,0x7a,0x20,0x2d,0x20,0x5f,0x31,0x32,0x38,0x29,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,0x34,
+    0x36,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x31,0x33,0x38,0x20,0x2d,0x20,0x5f,
+    0x34,0x30,0x5f,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x2c,0x20,0x5f,0x34,0x30,0x5f,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x66,
+    0x6f,0x72,0x77,0x61,0x72,0x64,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
+    0x28,0x5f,0x31,0x34,0x36,0x20,0x3c,0x20,0x30,0x2e,0x30,0x30,0x31,0x30,0x30,0x30,
+    0x30,0x30,0x30,0x30,0x34,0x37,0x34,0x39,0x37,0x34,0x35,0x31,0x33,0x30,0x35,0x33,
+    0x38,0x39,0x34,0x30,0x34,0x32,0x39,0x36,0x38,0x37,0x35,0x66,0x29,0x0a,0x20,0x20,
+    0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+    0x72,0x6e,0x20,0x30,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x31,0x36,0x36,0x20,0x3d,0x20,0x65,
+    0x78,0x70,0x28,0x28,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x66,0x6c,0x6f,0x61,0x74,
+    0x28,0x28,0x5f,0x38,0x30,0x2e,0x7a,0x20,0x3e,0x3e,0x20,0x31,0x36,0x75,0x29,0x20,
+    0x26,0x20,0x32,0x35,0x35,0x75,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x28,
+    0x5f,0x38,0x30,0x2e,0x7a,0x20,0x3e,0x3e,0x20,0x38,0x75,0x29,0x20,0x26,0x20,0x32,
+    0x35,0x35,0x75,0x29,0x29,0x20,0x2a,0x20,0x30,0x2e,0x30,0x33,0x39,0x32,0x31,0x35,
+    0x36,0x38,0x37,0x36,0x36,0x32,0x33,0x36,0x33,0x30,0x35,0x32,0x33,0x36,0x38,0x31,
+    0x36,0x34,0x30,0x36,0x32,0x35,0x66,0x29,0x20,0x2d,0x20,0x35,0x2e,0x30,0x66,0x2e,
+    0x78,0x78,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,
+    0x31,0x37,0x31,0x20,0x3d,0x20,0x5f,0x34,0x30,0x5f,0x66,0x6f,0x63,0x61,0x6c,0x5f,
+    0x70,0x78,0x20,0x2f,0x20,0x5f,0x31,0x34,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x31,0x37,0x36,0x20,0x3d,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x28,0x5f,0x31,0x33,0x38,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x31,0x39,0x37,
+    0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x64,0x6f,0x74,0x28,0x5f,0x34,
+    0x30,0x5f,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x30,0x2c,
+    0x20,0x5f,0x31,0x37,0x36,0x29,0x2c,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x30,0x5f,
+    0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x31,0x2c,0x20,0x5f,
+    0x31,0x37,0x36,0x29,0x2c,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x30,0x5f,0x76,0x69,
+    0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x32,0x2c,0x20,0x5f,0x31,0x37,
+    0x36,0x29,0x2c,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x30,0x5f,0x76,0x69,0x65,0x77,
+    0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x33,0x2c,0x20,0x5f,0x31,0x37,0x36,0x29,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,0x30,
+    0x35,0x20,0x3d,0x20,0x28,0x30,0x2e,0x35,0x66,0x20,0x2a,0x20,0x6d,0x61,0x78,0x28,
+    0x5f,0x31,0x36,0x36,0x2e,0x78,0x2c,0x20,0x5f,0x31,0x36,0x36,0x2e,0x79,0x29,0x29,
+    0x20,0x2a,0x20,0x5f,0x31,0x37,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x20,0x5f,0x32,0x30,0x39,0x20,0x3d,0x20,0x5f,0x31,0x39,0x37,0x2e,
+    0x78,0x79,0x20,0x2f,0x20,0x5f,0x31,0x39,0x37,0x2e,0x77,0x2e,0x78,0x78,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x28,0x61,0x62,0x73,0x28,0x5f,0x32,0x30,
+    0x39,0x2e,0x78,0x29,0x20,0x3e,0x20,0x28,0x31,0x2e,0x30,0x66,0x20,0x2b,0x20,0x28,
+    0x28,0x32,0x2e,0x30,0x66,0x20,0x2a,0x20,0x5f,0x32,0x30,0x35,0x29,0x20,0x2f,0x20,
+    0x5f,0x34,0x30,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x72,0x74,0x5f,0x77,0x69,0x64,
+    0x74,0x68,0x29,0x29,0x29,0x20,0x7c,0x7c,0x20,0x28,0x61,0x62,0x73,0x28,0x5f,0x32,
+    0x30,0x39,0x2e,0x79,0x29,0x20,0x3e,0x20,0x28,0x31,0x2e,0x30,0x66,0x20,0x2b,0x20,
+    0x28,0x28,0x32,0x2e,0x30,0x66,0x20,0x2a,0x20,0x5f,0x32,0x30,0x35,0x29,0x20,0x2f,
+    0x20,0x5f,0x34,0x30,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x72,0x74,0x5f,0x68,0x65,
+    0x69,0x67,0x68,0x74,0x29,0x29,0x29,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x30,0x75,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x5f,0x32,0x33,0x35,0x20,0x3d,0x20,0x28,0x28,0x28,0x28,0x5f,0x31,0x36,
+    0x36,0x2e,0x78,0x20,0x2a,0x20,0x5f,0x31,0x36,0x36,0x2e,0x79,0x29,0x20,0x2a,0x20,
+    0x5f,0x31,0x37,0x31,0x29,0x20,0x2a,0x20,0x5f,0x31,0x37,0x31,0x29,0x20,0x2a,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x28,0x5f,0x38,0x34,0x29,0x29,0x20,0x2a,0x20,0x30,0x2e,
+    0x30,0x30,0x33,0x39,0x32,0x31,0x35,0x36,0x38,0x38,0x35,0x39,0x33,0x36,0x38,0x35,
+    0x36,0x32,0x36,0x39,0x38,0x33,0x36,0x34,0x32,0x35,0x37,0x38,0x31,0x32,0x35,0x66,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x21,0x28,0x5f,0x32,0x33,0x35,
+    0x20,0x3e,0x20,0x30,0x2e,0x30,0x66,0x29,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x30,
+    0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,
+    0x75,0x72,0x6e,0x20,0x75,0x69,0x6e,0x74,0x28,0x63,0x6c,0x61,0x6d,0x70,0x28,0x28,
+    0x28,0x6c,0x6f,0x67,0x32,0x28,0x5f,0x32,0x33,0x35,0x29,0x20,0x2b,0x20,0x31,0x36,
+    0x2e,0x30,0x66,0x29,0x20,0x2a,0x20,0x32,0x35,0x2e,0x35,0x37,0x35,0x30,0x30,0x30,
+    0x37,0x36,0x32,0x39,0x33,0x39,0x34,0x35,0x33,0x31,0x32,0x35,0x66,0x29,0x20,0x2b,
+    0x20,0x31,0x2e,0x30,0x66,0x2c,0x20,0x31,0x2e,0x30,0x66,0x2c,0x20,0x31,0x30,0x32,
+    0x33,0x2e,0x30,0x66,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,
+    0x63,0x6f,0x6d,0x70,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x6e,0x74,0x28,0x67,0x6c,0x5f,0x47,0x6c,0x6f,
+    0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,
+    0x78,0x29,0x20,0x3e,0x3d,0x20,0x5f,0x34,0x30,0x5f,0x63,0x61,0x6e,0x64,0x69,0x64,
+    0x61,0x74,0x65,0x5f,0x63,0x6f,0x75,0x6e,0x74,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,
+    0x5f,0x32,0x36,0x35,0x20,0x3d,0x20,0x28,0x5f,0x34,0x30,0x5f,0x75,0x73,0x65,0x5f,
+    0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x73,0x20,0x21,0x3d,0x20,0x30,0x29,
+    0x20,0x3f,0x20,0x5f,0x32,0x35,0x30,0x2e,0x4c,0x6f,0x61,0x64,0x28,0x67,0x6c,0x5f,
+    0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,
+    0x49,0x44,0x2e,0x78,0x20,0x2a,0x20,0x34,0x20,0x2b,0x20,0x30,0x29,0x20,0x3a,0x20,
+    0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,
+    0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,
+    0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x5f,0x32,0x36,0x35,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,0x32,0x36,0x38,0x20,
+    0x3d,0x20,0x73,0x63,0x6f,0x72,0x65,0x5f,0x62,0x69,0x6e,0x28,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x31,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x5f,0x32,0x36,0x32,0x2e,0x53,
+    0x74,0x6f,0x72,0x65,0x28,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,
+    0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x20,0x2a,0x20,0x34,
+    0x20,0x2b,0x20,0x30,0x2c,0x20,0x5f,0x32,0x36,0x38,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,0x32,0x37,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x5f,0x32,0x37,0x30,0x2e,0x49,0x6e,0x74,0x65,0x72,0x6c,0x6f,0x63,0x6b,0x65,0x64,
+    0x41,0x64,0x64,0x28,0x5f,0x32,0x36,0x38,0x20,0x2a,0x20,0x34,0x20,0x2b,0x20,0x30,
+    0x2c,0x20,0x31,0x75,0x2c,0x20,0x5f,0x32,0x37,0x35,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,
+    0x5b,0x6e,0x75,0x6d,0x74,0x68,0x72,0x65,0x61,0x64,0x73,0x28,0x32,0x35,0x36,0x2c,
+    0x20,0x31,0x2c,0x20,0x31,0x29,0x5d,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,
+    0x6e,0x28,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,
+    0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,
+    0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x20,0x3d,0x20,0x73,
+    0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x67,0x6c,0x5f,0x47,0x6c,
+    0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6d,0x70,0x5f,0x6d,0x61,0x69,0x6e,0x28,
+    0x29,0x3b,0x0a,0x7d,0x0a,0x00,
+};
+/*
+    struct SelectValue
+    {
+        uint value;
+    };
+
+    static const uint3 gl_WorkGroupSize = uint3(1u, 1u, 1u);
+
+    cbuffer select_params : register(b0)
+    {
+        float4 _40_viewProj_row0 : packoffset(c0);
+        float4 _40_viewProj_row1 : packoffset(c1);
+        float4 _40_viewProj_row2 : packoffset(c2);
+        float4 _40_viewProj_row3 : packoffset(c3);
+        float3 _40_camera_position : packoffset(c4);
+        float _40_focal_px : packoffset(c4.w);
+        float3 _40_camera_forward : packoffset(c5);
+        float _40_viewport_width : packoffset(c5.w);
+        float _40_viewport_height : packoffset(c6);
+        int _40_candidate_count : packoffset(c6.y);
+        int _40_use_candidates : packoffset(c6.z);
+        int _40_budget : packoffset(c6.w);
+        int _40_texture_width : packoffset(c7);
+        int _40_splats_per_layer : packoffset(c7.y);
+    };
+
+    RWByteAddressBuffer _35 : register(u0);
+
+    void comp_main()
+    {
+        uint remaining = uint(_40_budget);
+        uint threshold_bin = 0u;
+        bool found = false;
+        for (int b = 1023; b >= 0; b--)
+        {
+            uint _48 = _35.Load(b * 4 + 0);
+            _35.Store(b * 4 + 0, 0u);
+            if (found)
+            {
+                continue;
+            }
+            if (_48 >= remaining)
+            {
+                threshold_bin = uint(b);
+                found = true;
+            }
+            else
+            {
+                remaining -= _48;
+            }
+        }
+        _35.Store(4096, threshold_bin);
+        _35.Store(4100, remaining);
+        _35.Store(4104, 0u);
+        _35.Store(4108, 0u);
+    }
+
+    [numthreads(1, 1, 1)]
+    void main(SPIRV_Cross_Input stage_input)
+    {
+        gl_GlobalInvocationID = stage_input.gl_GlobalInvocationID;
+        comp_main();
+    }
+*/
+static const uint8_t find_threshold_source_hlsl5[1574] = {
+    0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x65,0x6c,0x65,0x63,0x74,0x56,0x61,0x6c,
+    0x75,0x65,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x76,0x61,
+    0x6c,0x75,0x65,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,
+    0x63,0x6f,0x6e,0x73,0x74,0x20,0x75,0x69,0x6e,0x74,0x33,0x20,0x67,0x6c,0x5f,0x57,
+    0x6f,0x72,0x6b,0x47,0x72,0x6f,0x75,0x70,0x53,0x69,0x7a,0x65,0x20,0x3d,0x20,0x75,
+    0x69,0x6e,0x74,0x33,0x28,0x31,0x75,0x2c,0x20,0x31,0x75,0x2c,0x20,0x31,0x75,0x29,
+    0x3b,0x0a,0x0a,0x63,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x73,0x65,0x6c,0x65,0x63,
+    0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,
+    0x74,0x65,0x72,0x28,0x62,0x30,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x20,0x5f,0x34,0x30,0x5f,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,
+    0x6a,0x5f,0x72,0x6f,0x77,0x30,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,
+    0x73,0x65,0x74,0x28,0x63,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x20,0x5f,0x34,0x30,0x5f,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,
+    0x5f,0x72,0x6f,0x77,0x31,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,
+    0x65,0x74,0x28,0x63,0x31,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x34,0x20,0x5f,0x34,0x30,0x5f,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,
+    0x72,0x6f,0x77,0x32,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,
+    0x74,0x28,0x63,0x32,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x20,0x5f,0x34,0x30,0x5f,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,
+    0x6f,0x77,0x33,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,
+    0x28,0x63,0x33,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,
+    0x20,0x5f,0x34,0x30,0x5f,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x70,0x6f,0x73,0x69,
+    0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,
+    0x74,0x28,0x63,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x5f,0x34,0x30,0x5f,0x66,0x6f,0x63,0x61,0x6c,0x5f,0x70,0x78,0x20,0x3a,0x20,
+    0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x34,0x2e,0x77,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x34,0x30,
+    0x5f,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x66,0x6f,0x72,0x77,0x61,0x72,0x64,0x20,
+    0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x35,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x34,0x30,0x5f,
+    0x76,0x69,0x65,0x77,0x70,0x6f,0x72,0x74,0x5f,0x77,0x69,0x64,0x74,0x68,0x20,0x3a,
+    0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x35,0x2e,0x77,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x34,0x30,
+    0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x72,0x74,0x5f,0x68,0x65,0x69,0x67,0x68,0x74,
+    0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x36,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x5f,0x34,0x30,0x5f,0x63,
+    0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x5f,0x63,0x6f,0x75,0x6e,0x74,0x20,0x3a,
+    0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x36,0x2e,0x79,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x5f,0x34,0x30,0x5f,0x75,
+    0x73,0x65,0x5f,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x73,0x20,0x3a,0x20,
+    0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x36,0x2e,0x7a,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x5f,0x34,0x30,0x5f,0x62,0x75,
+    0x64,0x67,0x65,0x74,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,
+    0x74,0x28,0x63,0x36,0x2e,0x77,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,
+    0x20,0x5f,0x34,0x30,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x77,0x69,0x64,
+    0x74,0x68,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,
+    0x63,0x37,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x5f,0x34,0x30,
+    0x5f,0x73,0x70,0x6c,0x61,0x74,0x73,0x5f,0x70,0x65,0x72,0x5f,0x6c,0x61,0x79,0x65,
+    0x72,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,
+    0x37,0x2e,0x79,0x29,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x52,0x57,0x42,0x79,0x74,0x65,
+    0x41,0x64,0x64,0x72,0x65,0x73,0x73,0x42,0x75,0x66,0x66,0x65,0x72,0x20,0x5f,0x33,
+    0x35,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x75,0x30,0x29,
+    0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x63,0x6f,0x6d,0x70,0x5f,0x6d,0x61,0x69,
+    0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x72,
+    0x65,0x6d,0x61,0x69,0x6e,0x69,0x6e,0x67,0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,0x28,
+    0x5f,0x34,0x30,0x5f,0x62,0x75,0x64,0x67,0x65,0x74,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x75,0x69,0x6e,0x74,0x20,0x74,0x68,0x72,0x65,0x73,0x68,0x6f,0x6c,0x64,0x5f,
+    0x62,0x69,0x6e,0x20,0x3d,0x20,0x30,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,
+    0x6f,0x6c,0x20,0x66,0x6f,0x75,0x6e,0x64,0x20,0x3d,0x20,0x66,0x61,0x6c,0x73,0x65,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x62,
+    0x20,0x3d,0x20,0x31,0x30,0x32,0x33,0x3b,0x20,0x62,0x20,0x3e,0x3d,0x20,0x30,0x3b,
+    0x20,0x62,0x2d,0x2d,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,0x34,0x38,0x20,0x3d,0x20,0x5f,
+    0x33,0x35,0x2e,0x4c,0x6f,0x61,0x64,0x28,0x62,0x20,0x2a,0x20,0x34,0x20,0x2b,0x20,
+    0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x33,0x35,0x2e,
+    0x53,0x74,0x6f,0x72,0x65,0x28,0x62,0x20,0x2a,0x20,0x34,0x20,0x2b,0x20,0x30,0x2c,
+    0x20,0x30,0x75,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,
+    0x20,0x28,0x66,0x6f,0x75,0x6e,0x64,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,
+    0x6f,0x6e,0x74,0x69,0x6e,0x75,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,
+    0x34,0x38,0x20,0x3e,0x3d,0x20,0x72,0x65,0x6d,0x61,0x69,0x6e,0x69,0x6e,0x67,0x29,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x72,0x65,0x73,0x68,0x6f,0x6c,0x64,
+    0x5f,0x62,0x69,0x6e,0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,0x28,0x62,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6f,0x75,0x6e,
+    0x64,0x20,0x3d,0x20,0x74,0x72,0x75,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x6d,0x61,0x69,0x6e,0x69,0x6e,0x67,
+    0x20,0x2d,0x3d,0x20,0x5f,0x34,0x38,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x5f,0x33,0x35,
+    0x2e,0x53,0x74,0x6f,0x72,0x65,0x28,0x34,0x30,0x39,0x36,0x2c,0x20,0x74,0x68,0x72,
+    0x65,0x73,0x68,0x6f,0x6c,0x64,0x5f,0x62,0x69,0x6e,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x5f,0x33,0x35,0x2e,0x53,0x74,0x6f,0x72,0x65,0x28,0x34,0x31,0x30,0x30,0x2c,
+    0x20,0x72,0x65,0x6d,0x61,0x69,0x6e,0x69,0x6e,0x67,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x5f,0x33,0x35,0x2e,0x53,0x74,0x6f,0x72,0x65,0x28,0x34,0x31,0x30,0x34,0x2c,
+    0x20,0x30,0x75,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x5f,0x33,0x35,0x2e,0x53,0x74,
+    0x6f,0x72,0x65,0x28,0x34,0x31,0x30,0x38,0x2c,0x20,0x30,0x75,0x29,0x3b,0x0a,0x7d,
+    0x0a,0x0a,0x5b,0x6e,0x75,0x6d,0x74,0x68,0x72,0x65,0x61,0x64,0x73,0x28,0x31,0x2c,
+    0x20,0x31,0x2c,0x20,0x31,0x29,0x5d,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,
+    0x6e,0x28,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,
+    0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,
+    0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x20,0x3d,0x20,0x73,
+    0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x67,0x6c,0x5f,0x47,0x6c,
+    0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6d,0x70,0x5f,0x6d,0x61,0x69,0x6e,0x28,
+    0x29,0x3b,0x0a,0x7d,0x0a,0x00,
+};
+/*
+    struct SelectValue
+    {
+        uint value;
+    };
+
+    static const uint3 gl_WorkGroupSize = uint3(256u, 1u, 1u);
+
+    cbuffer select_params : register(b0)
+    {
+        float4 _40_viewProj_row0 : packoffset(c0);
+        float4 _40_viewProj_row1 : packoffset(c1);
+        float4 _40_viewProj_row2 : packoffset(c2);
+        float4 _40_viewProj_row3 : packoffset(c3);
+        float3 _40_camera_position : packoffset(c4);
+        float _40_focal_px : packoffset(c4.w);
+        float3 _40_camera_forward : packoffset(c5);
+        float _40_viewport_width : packoffset(c5.w);
+        float _40_viewport_height : packoffset(c6);
+        int _40_candidate_count : packoffset(c6.y);
+        int _40_use_candidates : packoffset(c6.z);
+        int _40_budget : packoffset(c6.w);
+        int _40_texture_width : packoffset(c7);
+        int _40_splats_per_layer : packoffset(c7.y);
+    };
+
+    ByteAddressBuffer _250 : register(t0);
+    RWByteAddressBuffer _262 : register(u0);
+    RWByteAddressBuffer _270 : register(u1);
+    RWByteAddressBuffer _290 : register(u2);
+
+    static uint3 gl_GlobalInvocationID;
+    struct SPIRV_Cross_Input
+    {
+        uint3 gl_GlobalInvocationID : SV_DispatchThreadID;
+    };
+
+    void comp_main()
+    {
+        if (int(gl_GlobalInvocationID.x) >= _40_candidate_count)
+        {
+            return;
+        }
+        uint _41 = _262.Load(gl_GlobalInvocationID.x * 4 + 0);
+        uint _49 = _270.Load(4096);
+        bool keep = _41 > _49;
+        if (_41 == _49)
+        {
+            uint _64;
+            _270.InterlockedAdd(4108, 1u, _64);
+            keep = _64 < _270.Load(4100);
+        }
+        if (keep)
+        {
+            uint _77;
+            _270.InterlockedAdd(4104, 1u, _77);
+            _290.Store(_77 * 4 + 0, (_40_use_candidates != 0) ? _250.Load(gl_GlobalInvocationID.x * 4 + 0) : gl_GlobalInvocationID.x);
+        }
+    }
+
+    [numthreads(256, 1, 1)]
+    void main(SPIRV_Cross_Input stage_input)
+    {
+        gl_GlobalInvocationID = stage_input.gl_GlobalInvocationID;
+        comp_main();
+    }
+*/
+static const uint8_t compact_selected_source_hlsl5[1811] = {
+    0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x65,0x6c,0x65,0x63,0x74,0x56,0x61,0x6c,
+    0x75,0x65,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x76,0x61,
+    0x6c,0x75,0x65,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,
+    0x63,0x6f,0x6e,0x73,0x74,0x20,0x75,0x69,0x6e,0x74,0x33,0x20,0x67,0x6c,0x5f,0x57,
+    0x6f,0x72,0x6b,0x47,0x72,0x6f,0x75,0x70,0x53,0x69,0x7a,0x65,0x20,0x3d,0x20,0x75,
+    0x69,0x6e,0x74,0x33,0x28,0x32,0x35,0x36,0x75,0x2c,0x20,0x31,0x75,0x2c,0x20,0x31,
+    0x75,0x29,0x3b,0x0a,0x0a,0x63,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x73,0x65,0x6c,
+    0x65,0x63,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,0x3a,0x20,0x72,0x65,0x67,
+    0x69,0x73,0x74,0x65,0x72,0x28,0x62,0x30,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x34,0x30,0x5f,0x76,0x69,0x65,0x77,0x50,
+    0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x30,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,
+    0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x34,0x30,0x5f,0x76,0x69,0x65,0x77,0x50,0x72,
+    0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x31,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,
+    0x66,0x73,0x65,0x74,0x28,0x63,0x31,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x20,0x5f,0x34,0x30,0x5f,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,
+    0x6a,0x5f,0x72,0x6f,0x77,0x32,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,
+    0x73,0x65,0x74,0x28,0x63,0x32,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x20,0x5f,0x34,0x30,0x5f,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,
+    0x5f,0x72,0x6f,0x77,0x33,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,
+    0x65,0x74,0x28,0x63,0x33,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x33,0x20,0x5f,0x34,0x30,0x5f,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x70,0x6f,
+    0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,
+    0x73,0x65,0x74,0x28,0x63,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x5f,0x34,0x30,0x5f,0x66,0x6f,0x63,0x61,0x6c,0x5f,0x70,0x78,0x20,
+    0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x34,0x2e,
+    0x77,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,
+    0x34,0x30,0x5f,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x66,0x6f,0x72,0x77,0x61,0x72,
+    0x64,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,
+    0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x34,
+    0x30,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x72,0x74,0x5f,0x77,0x69,0x64,0x74,0x68,
+    0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x35,
+    0x2e,0x77,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,
+    0x34,0x30,0x5f,0x76,0x69,0x65,0x77,0x70,0x6f,0x72,0x74,0x5f,0x68,0x65,0x69,0x67,
+    0x68,0x74,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,
+    0x63,0x36,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x5f,0x34,0x30,
+    0x5f,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x5f,0x63,0x6f,0x75,0x6e,0x74,
+    0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x36,
+    0x2e,0x79,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x5f,0x34,0x30,
+    0x5f,0x75,0x73,0x65,0x5f,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x73,0x20,
+    0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x36,0x2e,
+    0x7a,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x5f,0x34,0x30,0x5f,
+    0x62,0x75,0x64,0x67,0x65,0x74,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,
+    0x73,0x65,0x74,0x28,0x63,0x36,0x2e,0x77,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,
+    0x6e,0x74,0x20,0x5f,0x34,0x30,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x77,
+    0x69,0x64,0x74,0x68,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,
+    0x74,0x28,0x63,0x37,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x5f,
+    0x34,0x30,0x5f,0x73,0x70,0x6c,0x61,0x74,0x73,0x5f,0x70,0x65,0x72,0x5f,0x6c,0x61,
+    0x79,0x65,0x72,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,
+    0x28,0x63,0x37,0x2e,0x79,0x29,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x42,0x79,0x74,0x65,
+    0x41,0x64,0x64,0x72,0x65,0x73,0x73,0x42,0x75,0x66,0x66,0x65,0x72,0x20,0x5f,0x32,
+    0x35,0x30,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x74,0x30,
+    0x29,0x3b,0x0a,0x52,0x57,0x42,0x79,0x74,0x65,0x41,0x64,0x64,0x72,0x65,0x73,0x73,
+    0x42,0x75,0x66,0x66,0x65,0x72,0x20,0x5f,0x32,0x36,0x32,0x20,0x3a,0x20,0x72,0x65,
+    0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x75,0x30,0x29,0x3b,0x0a,0x52,0x57,0x42,0x79,
+    0x74,0x65,0x41,0x64,0x64,0x72,0x65,0x73,0x73,0x42,0x75,0x66,0x66,0x65,0x72,0x20,
+    0x5f,0x32,0x37,0x30,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,
+    0x75,0x31,0x29,0x3b,0x0a,0x52,0x57,0x42,0x79,0x74,0x65,0x41,0x64,0x64,0x72,0x65,
+    0x73,0x73,0x42,0x75,0x66,0x66,0x65,0x72,0x20,0x5f,0x32,0x39,0x30,0x20,0x3a,0x20,
+    0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x75,0x32,0x29,0x3b,0x0a,0x0a,0x73,
+    0x74,0x61,0x74,0x69,0x63,0x20,0x75,0x69,0x6e,0x74,0x33,0x20,0x67,0x6c,0x5f,0x47,
+    0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,
+    0x44,0x3b,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,
+    0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x75,0x69,0x6e,0x74,0x33,0x20,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,
+    0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x20,0x3a,0x20,
+    0x53,0x56,0x5f,0x44,0x69,0x73,0x70,0x61,0x74,0x63,0x68,0x54,0x68,0x72,0x65,0x61,
+    0x64,0x49,0x44,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x63,0x6f,
+    0x6d,0x70,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x69,0x66,0x20,0x28,0x69,0x6e,0x74,0x28,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,
+    0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x29,
+    0x20,0x3e,0x3d,0x20,0x5f,0x34,0x30,0x5f,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,
+    0x65,0x5f,0x63,0x6f,0x75,0x6e,0x74,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,0x34,
+    0x31,0x20,0x3d,0x20,0x5f,0x32,0x36,0x32,0x2e,0x4c,0x6f,0x61,0x64,0x28,0x67,0x6c,
+    0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,
+    0x6e,0x49,0x44,0x2e,0x78,0x20,0x2a,0x20,0x34,0x20,0x2b,0x20,0x30,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,0x34,0x39,0x20,0x3d,0x20,0x5f,
+    0x32,0x37,0x30,0x2e,0x4c,0x6f,0x61,0x64,0x28,0x34,0x30,0x39,0x36,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x6b,0x65,0x65,0x70,0x20,0x3d,0x20,
+    0x5f,0x34,0x31,0x20,0x3e,0x20,0x5f,0x34,0x39,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,
+    0x66,0x20,0x28,0x5f,0x34,0x31,0x20,0x3d,0x3d,0x20,0x5f,0x34,0x39,0x29,0x0a,0x20,
+    0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,
+    0x74,0x20,0x5f,0x36,0x34,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,
+    0x32,0x37,0x30,0x2e,0x49,0x6e,0x74,0x65,0x72,0x6c,0x6f,0x63,0x6b,0x65,0x64,0x41,
+    0x64,0x64,0x28,0x34,0x31,0x30,0x38,0x2c,0x20,0x31,0x75,0x2c,0x20,0x5f,0x36,0x34,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6b,0x65,0x65,0x70,0x20,
+    0x3d,0x20,0x5f,0x36,0x34,0x20,0x3c,0x20,0x5f,0x32,0x37,0x30,0x2e,0x4c,0x6f,0x61,
+    0x64,0x28,0x34,0x31,0x30,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,
+    0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x6b,0x65,0x65,0x70,0x29,0x0a,0x20,0x20,0x20,
+    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,
+    0x5f,0x37,0x37,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x32,0x37,
+    0x30,0x2e,0x49,0x6e,0x74,0x65,0x72,0x6c,0x6f,0x63,0x6b,0x65,0x64,0x41,0x64,0x64,
+    0x28,0x34,0x31,0x30,0x34,0x2c,0x20,0x31,0x75,0x2c,0x20,0x5f,0x37,0x37,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x32,0x39,0x30,0x2e,0x53,0x74,
+    0x6f,0x72,0x65,0x28,0x5f,0x37,0x37,0x20,0x2a,0x20,0x34,0x20,0x2b,0x20,0x30,0x2c,
+    0x20,0x28,0x5f,0x34,0x30,0x5f,0x75,0x73,0x65,0x5f,0x63,0x61,0x6e,0x64,0x69,0x64,
+    0x61,0x74,0x65,0x73,0x20,0x21,0x3d,0x20,0x30,0x29,0x20,0x3f,0x20,0x5f,0x32,0x35,
+    0x30,0x2e,0x4c,0x6f,0x61,0x64,0x28,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,
+    0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x20,0x2a,
+    0x20,0x34,0x20,0x2b,0x20,0x30,0x29,0x20,0x3a,0x20,0x67,0x6c,0x5f,0x47,0x6c,0x6f,
+    0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,
+    0x78,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x7d,0x0a,0x0a,0x5b,0x6e,0x75,
+    0x6d,0x74,0x68,0x72,0x65,0x61,0x64,0x73,0x28,0x32,0x35,0x36,0x2c,0x20,0x31,0x2c,
+    0x20,0x31,0x29,0x5d,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x53,
+    0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,
+    0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x29,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,
+    0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,
+    0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,
+    0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x63,0x6f,0x6d,0x70,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x3b,0x0a,
+    0x7d,0x0a,0x00,
+};
+/*
+    #pragma clang diagnostic ignored "-Wmissing-prototypes"
+
+    #include <metal_stdlib>
+    #include <simd/simd.h>
+    #include <metal_atomic>
+
+    using namespace metal;
+
+    struct select_params
+    {
+        float4 viewProj_row0;
+        float4 viewProj_row1;
+        float4 viewProj_row2;
+        float4 viewProj_row3;
+        packed_float3 camera_position;
+        float focal_px;
+        packed_float3 camera_forward;
+        float viewport_width;
+        float viewport_height;
+        int candidate_count;
+        int use_candidates;
+        int budget;
+        int texture_width;
+        int splats_per_layer;
+    };
+
+    struct SelectValue
+    {
+        uint value;
+    };
+
+    struct candidate_input
+    {
+        SelectValue candidates[1];
+    };
+
+    struct bin_buffer
+    {
+        SelectValue bins[1];
+    };
+
+    struct select_state
+    {
+        SelectValue state[1];
+    };
+
+    constant uint3 gl_WorkGroupSize [[maybe_unused]] = uint3(256u, 1u, 1u);
+
+    static inline __attribute__((always_inline))
+    uint4 fetch_splat(thread const uint& splat_idx, constant select_params& _40, texture2d_array<uint> splat_texture, sampler splat_sampler)
+    {
+        int _31 = int(splat_idx) / _40.splats_per_layer;
+        int _37 = int(splat_idx) - (_31 * _40.splats_per_layer);
+        int3 _52 = int3(_37 % _40.texture_width, _37 / _40.texture_width, _31);
+        return splat_texture.read(uint2(_52.xy), uint(_52.z), 0);
+    }
+
+    static inline __attribute__((always_inline))
+    uint score_bin(thread const uint& splat_idx, texture2d_array<uint> splat_texture, sampler splat_sampler, constant select_params& _40, texture2d<float> chunk_texture)
+    {
+        uint param = splat_idx;
+        uint4 _80 = fetch_splat(param, _40, splat_texture, splat_sampler);
+        uint _84 = _80.w & 255u;
+        if (_84 < 3u)
+        {
+            return 0u;
+        }
+        int _112 = int(splat_idx) / 256;
+        int2 _120 = int2((_112 % 1024) * 2, _112 / 1024);
+        float3 _128 = chunk_texture.read(uint2(_120), 0).xyz;
+        float3 _138 = _128 + ((float3(float((_80.x >> 16u) & 65535u), float(_80.x & 65535u), float((_80.y >> 16u) & 65535u)) * 1.525902189314365386962890625e-05) * (chunk_texture.read(uint2(_120 + int2(1, 0)), 0).xyz - _128));
+        float _146 = dot(_138 - float3(_40.camera_position), float3(_40.camera_forward));
+        if (_146 < 0.001000000047497451305389404296875)
+        {
+            return 0u;
+        }
+        float2 _166 = exp((float2(float((_80.z >> 16u) & 255u), float((_80.z >> 8u) & 255u)) * 0.0392156876623630523681640625) - float2(5.0));
+        float _171 = _40.focal_px / _146;
+        float4 _176 = float4(_138, 1.0);
+        float4 _197 = float4(dot(_40.viewProj_row0, _176), dot(_40.viewProj_row1, _176), dot(_40.viewProj_row2, _176), dot(_40.viewProj_row3, _176));
+        float _205 = (0.5 * fast::max(_166.x, _166.y)) * _171;
+        float2 _209 = _197.xy / float2(_197.w);
+        if ((abs(_209.x) > (1.0 + ((2.0 * _205) / _40.viewport_width))) || (abs(_209.y) > (1.0 + ((2.0 * _205) / _40.viewport_height))))
+        {
+            return 0u;
+        }
+        float _235 = ((((_166.x * _166.y) * _171) * _171) * float(_84)) * 0.0039215688593685626983642578125;
+        if (!(_235 > 0.0))
+        {
+            return 0u;
+        }
+        return uint(fast::clamp(((log2(_235) + 16.0) * 25.575000762939453125) + 1.0, 1.0, 1023.0));
+    }
+
+    kernel void main0(constant select_params& _40 [[buffer(0)]], const device candidate_input& _250 [[buffer(8)]], device bin_buffer& _262 [[buffer(9)]], device select_state& _270 [[buffer(10)]], texture2d_array<uint> splat_texture [[texture(0)]], texture2d<float> chunk_texture [[texture(1)]], sampler splat_sampler [[sampler(2)]], uint3 gl_GlobalInvocationID [[thread_position_in_grid]])
+    {
+        if (int(gl_GlobalInvocationID.x) >= _40.candidate_count)
+        {
+            return;
+        }
+        uint _265 = (_40.use_candidates != 0) ? _250.candidates[gl_GlobalInvocationID.x].value : gl_GlobalInvocationID.x;
+        uint param_1 = _265;
+        uint _268 = score_bin(param_1, splat_texture, splat_sampler, _40, chunk_texture);
+        _262.bins[gl_GlobalInvocationID.x].value = _268;
+        uint _275 = atomic_fetch_add_explicit((device atomic_uint*)&_270.state[_268].value, 1u, memory_order_relaxed);
+    }
+
+*/
+static const uint8_t score_bins_source_metal_macos[3948] = {
+    0x23,0x70,0x72,0x61,0x67,0x6d,0x61,0x20,0x63,0x6c,0x61,0x6e,0x67,0x20,0x64,0x69,
+    0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x20,0x69,0x67,0x6e,0x6f,0x72,0x65,0x64,
+    0x20,0x22,0x2d,0x57,0x6d,0x69,0x73,0x73,0x69,0x6e,0x67,0x2d,0x70,0x72,0x6f,0x74,
+    0x6f,0x74,0x79,0x70,0x65,0x73,0x22,0x0a,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,
+    0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,
+    0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,
+    0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+    0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,0x61,0x74,0x6f,0x6d,0x69,0x63,0x3e,0x0a,
+    0x0a,0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,
+    0x20,0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,
+    0x73,0x65,0x6c,0x65,0x63,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x69,0x65,0x77,0x50,
+    0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x20,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,
+    0x77,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,
+    0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x32,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,
+    0x6a,0x5f,0x72,0x6f,0x77,0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,0x70,0x61,0x63,0x6b,
+    0x65,0x64,0x5f,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x63,0x61,0x6d,0x65,0x72,0x61,
+    0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x66,0x6f,0x63,0x61,0x6c,0x5f,0x70,0x78,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x70,0x61,0x63,0x6b,0x65,0x64,0x5f,0x66,0x6c,0x6f,0x61,0x74,0x33,
+    0x20,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x66,0x6f,0x72,0x77,0x61,0x72,0x64,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x69,0x65,0x77,0x70,
+    0x6f,0x72,0x74,0x5f,0x77,0x69,0x64,0x74,0x68,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x76,0x69,0x65,0x77,0x70,0x6f,0x72,0x74,0x5f,0x68,0x65,
+    0x69,0x67,0x68,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x63,0x61,
+    0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x5f,0x63,0x6f,0x75,0x6e,0x74,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x75,0x73,0x65,0x5f,0x63,0x61,0x6e,0x64,0x69,
+    0x64,0x61,0x74,0x65,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x62,
+    0x75,0x64,0x67,0x65,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x77,0x69,0x64,0x74,0x68,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x6e,0x74,0x20,0x73,0x70,0x6c,0x61,0x74,0x73,0x5f,0x70,0x65,0x72,
+    0x5f,0x6c,0x61,0x79,0x65,0x72,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,
+    0x63,0x74,0x20,0x53,0x65,0x6c,0x65,0x63,0x74,0x56,0x61,0x6c,0x75,0x65,0x0a,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x76,0x61,0x6c,0x75,0x65,0x3b,
+    0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x63,0x61,0x6e,0x64,
+    0x69,0x64,0x61,0x74,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x53,0x65,0x6c,0x65,0x63,0x74,0x56,0x61,0x6c,0x75,0x65,0x20,0x63,0x61,
+    0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x73,0x5b,0x31,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,
+    0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x62,0x69,0x6e,0x5f,0x62,0x75,0x66,0x66,
+    0x65,0x72,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x53,0x65,0x6c,0x65,0x63,0x74,0x56,
+    0x61,0x6c,0x75,0x65,0x20,0x62,0x69,0x6e,0x73,0x5b,0x31,0x5d,0x3b,0x0a,0x7d,0x3b,
+    0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x73,0x65,0x6c,0x65,0x63,0x74,0x5f,
+    0x73,0x74,0x61,0x74,0x65,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x53,0x65,0x6c,0x65,
+    0x63,0x74,0x56,0x61,0x6c,0x75,0x65,0x20,0x73,0x74,0x61,0x74,0x65,0x5b,0x31,0x5d,
+    0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x75,
+    0x69,0x6e,0x74,0x33,0x20,0x67,0x6c,0x5f,0x57,0x6f,0x72,0x6b,0x47,0x72,0x6f,0x75,
+    0x70,0x53,0x69,0x7a,0x65,0x20,0x5b,0x5b,0x6d,0x61,0x79,0x62,0x65,0x5f,0x75,0x6e,
+    0x75,0x73,0x65,0x64,0x5d,0x5d,0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,0x33,0x28,0x32,
+    0x35,0x36,0x75,0x2c,0x20,0x31,0x75,0x2c,0x20,0x31,0x75,0x29,0x3b,0x0a,0x0a,0x73,
+    0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,
+    0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,
+    0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x75,0x69,0x6e,0x74,
+    0x34,0x20,0x66,0x65,0x74,0x63,0x68,0x5f,0x73,0x70,0x6c,0x61,0x74,0x28,0x74,0x68,
+    0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x75,0x69,0x6e,0x74,0x26,
+    0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x69,0x64,0x78,0x2c,0x20,0x63,0x6f,0x6e,0x73,
+    0x74,0x61,0x6e,0x74,0x20,0x73,0x65,0x6c,0x65,0x63,0x74,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x73,0x26,0x20,0x5f,0x34,0x30,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x32,0x64,0x5f,0x61,0x72,0x72,0x61,0x79,0x3c,0x75,0x69,0x6e,0x74,0x3e,0x20,0x73,
+    0x70,0x6c,0x61,0x74,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2c,0x20,0x73,0x61,
+    0x6d,0x70,0x6c,0x65,0x72,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x73,0x61,0x6d,0x70,
+    0x6c,0x65,0x72,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x5f,
+    0x33,0x31,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,0x73,0x70,0x6c,0x61,0x74,0x5f,0x69,
+    0x64,0x78,0x29,0x20,0x2f,0x20,0x5f,0x34,0x30,0x2e,0x73,0x70,0x6c,0x61,0x74,0x73,
+    0x5f,0x70,0x65,0x72,0x5f,0x6c,0x61,0x79,0x65,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x69,0x6e,0x74,0x20,0x5f,0x33,0x37,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,0x73,0x70,
+    0x6c,0x61,0x74,0x5f,0x69,0x64,0x78,0x29,0x20,0x2d,0x20,0x28,0x5f,0x33,0x31,0x20,
+    0x2a,0x20,0x5f,0x34,0x30,0x2e,0x73,0x70,0x6c,0x61,0x74,0x73,0x5f,0x70,0x65,0x72,
+    0x5f,0x6c,0x61,0x79,0x65,0x72,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,
+    0x33,0x20,0x5f,0x35,0x32,0x20,0x3d,0x20,0x69,0x6e,0x74,0x33,0x28,0x5f,0x33,0x37,
+    0x20,0x25,0x20,0x5f,0x34,0x30,0x2e,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x77,
+    0x69,0x64,0x74,0x68,0x2c,0x20,0x5f,0x33,0x37,0x20,0x2f,0x20,0x5f,0x34,0x30,0x2e,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x77,0x69,0x64,0x74,0x68,0x2c,0x20,0x5f,
+    0x33,0x31,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
+    0x73,0x70,0x6c,0x61,0x74,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x72,0x65,
+    0x61,0x64,0x28,0x75,0x69,0x6e,0x74,0x32,0x28,0x5f,0x35,0x32,0x2e,0x78,0x79,0x29,
+    0x2c,0x20,0x75,0x69,0x6e,0x74,0x28,0x5f,0x35,0x32,0x2e,0x7a,0x29,0x2c,0x20,0x30,
+    0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,
+    0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,
+    0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,
+    0x29,0x29,0x0a,0x75,0x69,0x6e,0x74,0x20,0x73,0x63,0x6f,0x72,0x65,0x5f,0x62,0x69,
+    0x6e,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x75,
+    0x69,0x6e,0x74,0x26,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x69,0x64,0x78,0x2c,0x20,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x5f,0x61,0x72,0x72,0x61,0x79,0x3c,
+    0x75,0x69,0x6e,0x74,0x3e,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x74,0x65,0x78,0x74,
+    0x75,0x72,0x65,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x73,0x70,0x6c,
+    0x61,0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x63,0x6f,0x6e,0x73,
+    0x74,0x61,0x6e,0x74,0x20,0x73,0x65,0x6c,0x65,0x63,0x74,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x73,0x26,0x20,0x5f,0x34,0x30,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x63,0x68,0x75,0x6e,0x6b,0x5f,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,
+    0x69,0x6e,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x73,0x70,0x6c,0x61,
+    0x74,0x5f,0x69,0x64,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x34,
+    0x20,0x5f,0x38,0x30,0x20,0x3d,0x20,0x66,0x65,0x74,0x63,0x68,0x5f,0x73,0x70,0x6c,
+    0x61,0x74,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x5f,0x34,0x30,0x2c,0x20,0x73,
+    0x70,0x6c,0x61,0x74,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2c,0x20,0x73,0x70,
+    0x6c,0x61,0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,0x38,0x34,0x20,0x3d,0x20,0x5f,0x38,0x30,
+    0x2e,0x77,0x20,0x26,0x20,0x32,0x35,0x35,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,
+    0x66,0x20,0x28,0x5f,0x38,0x34,0x20,0x3c,0x20,0x33,0x75,0x29,0x0a,0x20,0x20,0x20,
+    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,
+    0x6e,0x20,0x30,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
+    0x69,0x6e,0x74,0x20,0x5f,0x31,0x31,0x32,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,0x73,
+    0x70,0x6c,0x61,0x74,0x5f,0x69,0x64,0x78,0x29,0x20,0x2f,0x20,0x32,0x35,0x36,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x32,0x20,0x5f,0x31,0x32,0x30,0x20,0x3d,
+    0x20,0x69,0x6e,0x74,0x32,0x28,0x28,0x5f,0x31,0x31,0x32,0x20,0x25,0x20,0x31,0x30,
+    0x32,0x34,0x29,0x20,0x2a,0x20,0x32,0x2c,0x20,0x5f,0x31,0x31,0x32,0x20,0x2f,0x20,
+    0x31,0x30,0x32,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x33,0x20,0x5f,0x31,0x32,0x38,0x20,0x3d,0x20,0x63,0x68,0x75,0x6e,0x6b,0x5f,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x72,0x65,0x61,0x64,0x28,0x75,0x69,0x6e,0x74,
+    0x32,0x28,0x5f,0x31,0x32,0x30,0x29,0x2c,0x20,0x30,0x29,0x2e,0x78,0x79,0x7a,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x31,0x33,0x38,
+    0x20,0x3d,0x20,0x5f,0x31,0x32,0x38,0x20,0x2b,0x20,0x28,0x28,0x66,0x6c,0x6f,0x61,
+    0x74,0x33,0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x28,0x5f,0x38,0x30,0x2e,0x78,0x20,
+    0x3e,0x3e,0x20,0x31,0x36,0x75,0x29,0x20,0x26,0x20,0x36,0x35,0x35,0x33,0x35,0x75,
+    0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x5f,0x38,0x30,0x2e,0x78,0x20,0x26,
+    0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,
+    0x28,0x5f,0x38,0x30,0x2e,0x79,0x20,0x3e,0x3e,0x20,0x31,0x36,0x75,0x29,0x20,0x26,
+    0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x29,0x20,0x2a,0x20,0x31,0x2e,0x35,0x32,
+    0x35,0x39,0x30,0x32,0x31,0x38,0x39,0x33,0x31,0x34,0x33,0x36,0x35,0x33,0x38,0x36,
+    0x39,0x36,0x32,0x38,0x39,0x30,0x36,0x32,0x35,0x65,0x2d,0x30,0x35,0x29,0x20,0x2a,
+    0x20,0x28,0x63,0x68,0x75,0x6e,0x6b,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,
+    0x72,0x65,0x61,0x64,0x28,0x75,0x69,0x6e,0x74,0x32,0x28,0x5f,0x31,0x32,0x30,0x20,
+    0x2b,0x20,0x69,0x6e,0x74,0x32,0x28,0x31,0x2c,0x20,0x30,0x29,0x29,0x2c,0x20,0x30,
+    0x29,0x2e,0x78,0x79,0x7a,0x20,0x2d,0x20,0x5f,0x31,0x32,0x38,0x29,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,0x34,0x36,0x20,0x3d,
+    0x20,0x64,0x6f,0x74,0x28,0x5f,0x31,0x33,0x38,0x20,0x2d,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x33,0x28,0x5f,0x34,0x30,0x2e,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x70,0x6f,
+    0x73,0x69,0x74,0x69,0x6f,0x6e,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,
+    0x5f,0x34,0x30,0x2e,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x66,0x6f,0x72,0x77,0x61,
+    0x72,0x64,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x31,
+    0x34,0x36,0x20,0x3c,0x20,0x30,0x2e,0x30,0x30,0x31,0x30,0x30,0x30,0x30,0x30,0x30,
+    0x30,0x34,0x37,0x34,0x39,0x37,0x34,0x35,0x31,0x33,0x30,0x35,0x33,0x38,0x39,0x34,
+    0x30,0x34,0x32,0x39,0x36,0x38,0x37,0x35,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x30,
+    0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x20,0x5f,0x31,0x36,0x36,0x20,0x3d,0x20,0x65,0x78,0x70,0x28,0x28,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x28,0x5f,0x38,
+    0x30,0x2e,0x7a,0x20,0x3e,0x3e,0x20,0x31,0x36,0x75,0x29,0x20,0x26,0x20,0x32,0x35,
+    0x35,0x75,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x28,0x5f,0x38,0x30,0x2e,
+    0x7a,0x20,0x3e,0x3e,0x20,0x38,0x75,0x29,0x20,0x26,0x20,0x32,0x35,0x35,0x75,0x29,
+    0x29,0x20,0x2a,0x20,0x30,0x2e,0x30,0x33,0x39,0x32,0x31,0x35,0x36,0x38,0x37,0x36,
+    0x36,0x32,0x33,0x36,0x33,0x30,0x35,0x32,0x33,0x36,0x38,0x31,0x36,0x34,0x30,0x36,
+    0x32,0x35,0x29,0x20,0x2d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x35,0x2e,0x30,
+    0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,
+    0x37,0x31,0x20,0x3d,0x20,0x5f,0x34,0x30,0x2e,0x66,0x6f,0x63,0x61,0x6c,0x5f,0x70,
+    0x78,0x20,0x2f,0x20,0x5f,0x31,0x34,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x20,0x5f,0x31,0x37,0x36,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x34,0x28,0x5f,0x31,0x33,0x38,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x31,0x39,0x37,0x20,0x3d,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x64,0x6f,0x74,0x28,0x5f,0x34,0x30,0x2e,
+    0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x30,0x2c,0x20,0x5f,
+    0x31,0x37,0x36,0x29,0x2c,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x30,0x2e,0x76,0x69,
+    0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x31,0x2c,0x20,0x5f,0x31,0x37,
+    0x36,0x29,0x2c,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x30,0x2e,0x76,0x69,0x65,0x77,
+    0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x32,0x2c,0x20,0x5f,0x31,0x37,0x36,0x29,
+    0x2c,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x30,0x2e,0x76,0x69,0x65,0x77,0x50,0x72,
+    0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x33,0x2c,0x20,0x5f,0x31,0x37,0x36,0x29,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,0x30,0x35,0x20,
+    0x3d,0x20,0x28,0x30,0x2e,0x35,0x20,0x2a,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,0x6d,
+    0x61,0x78,0x28,0x5f,0x31,0x36,0x36,0x2e,0x78,0x2c,0x20,0x5f,0x31,0x36,0x36,0x2e,
+    0x79,0x29,0x29,0x20,0x2a,0x20,0x5f,0x31,0x37,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x32,0x30,0x39,0x20,0x3d,0x20,0x5f,0x31,
+    0x39,0x37,0x2e,0x78,0x79,0x20,0x2f,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x5f,
+    0x31,0x39,0x37,0x2e,0x77,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,
+    0x28,0x61,0x62,0x73,0x28,0x5f,0x32,0x30,0x39,0x2e,0x78,0x29,0x20,0x3e,0x20,0x28,
+    0x31,0x2e,0x30,0x20,0x2b,0x20,0x28,0x28,0x32,0x2e,0x30,0x20,0x2a,0x20,0x5f,0x32,
+    0x30,0x35,0x29,0x20,0x2f,0x20,0x5f,0x34,0x30,0x2e,0x76,0x69,0x65,0x77,0x70,0x6f,
+    0x72,0x74,0x5f,0x77,0x69,0x64,0x74,0x68,0x29,0x29,0x29,0x20,0x7c,0x7c,0x20,0x28,
+    0x61,0x62,0x73,0x28,0x5f,0x32,0x30,0x39,0x2e,0x79,0x29,0x20,0x3e,0x20,0x28,0x31,
+    0x2e,0x30,0x20,0x2b,0x20,0x28,0x28,0x32,0x2e,0x30,0x20,0x2a,0x20,0x5f,0x32,0x30,
+    0x35,0x29,0x20,0x2f,0x20,0x5f,0x34,0x30,0x2e,0x76,0x69,0x65,0x77,0x70,0x6f,0x72,
+    0x74,0x5f,0x68,0x65,0x69,0x67,0x68,0x74,0x29,0x29,0x29,0x29,0x0a,0x20,0x20,0x20,
+    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,
+    0x6e,0x20,0x30,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,0x33,0x35,0x20,0x3d,0x20,0x28,0x28,0x28,
+    0x28,0x5f,0x31,0x36,0x36,0x2e,0x78,0x20,0x2a,0x20,0x5f,0x31,0x36,0x36,0x2e,0x79,
+    0x29,0x20,0x2a,0x20,0x5f,0x31,0x37,0x31,0x29,0x20,0x2a,0x20,0x5f,0x31,0x37,0x31,
+    0x29,0x20,0x2a,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x5f,0x38,0x34,0x29,0x29,0x20,
+    0x2a,0x20,0x30,0x2e,0x30,0x30,0x33,0x39,0x32,0x31,0x35,0x36,0x38,0x38,0x35,0x39,
+    0x33,0x36,0x38,0x35,0x36,0x32,0x36,0x39,0x38,0x33,0x36,0x34,0x32,0x35,0x37,0x38,
+    0x31,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x21,0x28,0x5f,
+    0x32,0x33,0x35,0x20,0x3e,0x20,0x30,0x2e,0x30,0x29,0x29,0x0a,0x20,0x20,0x20,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x20,0x30,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,
+    0x65,0x74,0x75,0x72,0x6e,0x20,0x75,0x69,0x6e,0x74,0x28,0x66,0x61,0x73,0x74,0x3a,
+    0x3a,0x63,0x6c,0x61,0x6d,0x70,0x28,0x28,0x28,0x6c,0x6f,0x67,0x32,0x28,0x5f,0x32,
+    0x33,0x35,0x29,0x20,0x2b,0x20,0x31,0x36,0x2e,0x30,0x29,0x20,0x2a,0x20,0x32,0x35,
+    0x2e,0x35,0x37,0x35,0x30,0x30,0x30,0x37,0x36,0x32,0x39,0x33,0x39,0x34,0x35,0x33,
+    0x31,0x32,0x35,0x29,0x20,0x2b,0x20,0x31,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x2c,
+    0x20,0x31,0x30,0x32,0x33,0x2e,0x30,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x6b,0x65,
+    0x72,0x6e,0x65,0x6c,0x20,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x30,0x28,
+    0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x73,0x65,0x6c,0x65,0x63,0x74,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x26,0x20,0x5f,0x34,0x30,0x20,0x5b,0x5b,0x62,0x75,
+    0x66,0x66,0x65,0x72,0x28,0x30,0x29,0x5d,0x5d,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,
+    0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,
+    0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x26,0x20,0x5f,0x32,0x35,0x30,0x20,0x5b,0x5b,
+    0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x38,0x29,0x5d,0x5d,0x2c,0x20,0x64,0x65,0x76,
+    0x69,0x63,0x65,0x20,0x62,0x69,0x6e,0x5f,0x62,0x75,0x66,0x66,0x65,0x72,0x26,0x20,
+    0x5f,0x32,0x36,0x32,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x39,0x29,
+    0x5d,0x5d,0x2c,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x73,0x65,0x6c,0x65,0x63,
+    0x74,0x5f,0x73,0x74,0x61,0x74,0x65,0x26,0x20,0x5f,0x32,0x37,0x30,0x20,0x5b,0x5b,
+    0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x31,0x30,0x29,0x5d,0x5d,0x2c,0x20,0x74,0x65,
+    0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x5f,0x61,0x72,0x72,0x61,0x79,0x3c,0x75,0x69,
+    0x6e,0x74,0x3e,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,
+    0x65,0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x30,0x29,0x5d,0x5d,
+    0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,
+    0x74,0x3e,0x20,0x63,0x68,0x75,0x6e,0x6b,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x31,0x29,0x5d,0x5d,0x2c,
+    0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x73,
+    0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x5b,0x5b,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,
+    0x28,0x32,0x29,0x5d,0x5d,0x2c,0x20,0x75,0x69,0x6e,0x74,0x33,0x20,0x67,0x6c,0x5f,
+    0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,
+    0x49,0x44,0x20,0x5b,0x5b,0x74,0x68,0x72,0x65,0x61,0x64,0x5f,0x70,0x6f,0x73,0x69,
+    0x74,0x69,0x6f,0x6e,0x5f,0x69,0x6e,0x5f,0x67,0x72,0x69,0x64,0x5d,0x5d,0x29,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x6e,0x74,0x28,0x67,0x6c,
+    0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,
+    0x6e,0x49,0x44,0x2e,0x78,0x29,0x20,0x3e,0x3d,0x20,0x5f,0x34,0x30,0x2e,0x63,0x61,
+    0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x5f,0x63,0x6f,0x75,0x6e,0x74,0x29,0x0a,0x20,
+    0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,
+    0x75,0x72,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x75,
+    0x69,0x6e,0x74,0x20,0x5f,0x32,0x36,0x35,0x20,0x3d,0x20,0x28,0x5f,0x34,0x30,0x2e,
+    0x75,0x73,0x65,0x5f,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x73,0x20,0x21,
+    0x3d,0x20,0x30,0x29,0x20,0x3f,0x20,0x5f,0x32,0x35,0x30,0x2e,0x63,0x61,0x6e,0x64,
+    0x69,0x64,0x61,0x74,0x65,0x73,0x5b,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,
+    0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x5d,0x2e,
+    0x76,0x61,0x6c,0x75,0x65,0x20,0x3a,0x20,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,
+    0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x31,0x20,0x3d,0x20,0x5f,0x32,0x36,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,
+    0x6e,0x74,0x20,0x5f,0x32,0x36,0x38,0x20,0x3d,0x20,0x73,0x63,0x6f,0x72,0x65,0x5f,
+    0x62,0x69,0x6e,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x2c,0x20,0x73,0x70,0x6c,
+    0x61,0x74,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2c,0x20,0x73,0x70,0x6c,0x61,
+    0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x5f,0x34,0x30,0x2c,0x20,
+    0x63,0x68,0x75,0x6e,0x6b,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x5f,0x32,0x36,0x32,0x2e,0x62,0x69,0x6e,0x73,0x5b,0x67,0x6c,
+    0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,
+    0x6e,0x49,0x44,0x2e,0x78,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x5f,
+    0x32,0x36,0x38,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,0x32,
+    0x37,0x35,0x20,0x3d,0x20,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x66,0x65,0x74,0x63,
+    0x68,0x5f,0x61,0x64,0x64,0x5f,0x65,0x78,0x70,0x6c,0x69,0x63,0x69,0x74,0x28,0x28,
+    0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x75,0x69,
+    0x6e,0x74,0x2a,0x29,0x26,0x5f,0x32,0x37,0x30,0x2e,0x73,0x74,0x61,0x74,0x65,0x5b,
+    0x5f,0x32,0x36,0x38,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x2c,0x20,0x31,0x75,0x2c,
+    0x20,0x6d,0x65,0x6d,0x6f,0x72,0x79,0x5f,0x6f,0x72,0x64,0x65,0x72,0x5f,0x72,0x65,
+    0x6c,0x61,0x78,0x65,0x64,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #pragma clang diagnostic ignored "-Wmissing-prototypes"
+
+    #include <metal_stdlib>
+    #include <simd/simd.h>
+    #include <metal_atomic>
+
+    using namespace metal;
+
+    struct select_params
+    {
+        float4 viewProj_row0;
+        float4 viewProj_row1;
+        float4 viewProj_row2;
+        float4 viewProj_row3;
+        packed_float3 camera_position;
+        float focal_px;
+        packed_float3 camera_forward;
+        float viewport_width;
+        float viewport_height;
+        int candidate_count;
+        int use_candidates;
+        int budget;
+        int texture_width;
+        int splats_per_layer;
+    };
+
+    struct SelectValue
+    {
+        uint value;
+    };
+
+    struct SelectSplatTexel
+    {
+        uint4 value;
+    };
+
+    struct splat_buffer
+    {
+        SelectSplatTexel splats[1];
+    };
+
+    struct candidate_input
+    {
+        SelectValue candidates[1];
+    };
+
+    struct bin_buffer
+    {
+        SelectValue bins[1];
+    };
+
+    struct select_state
+    {
+        SelectValue state[1];
+    };
+
+    constant uint3 gl_WorkGroupSize [[maybe_unused]] = uint3(256u, 1u, 1u);
+
+    static inline __attribute__((always_inline))
+    uint4 fetch_splat(thread const uint& splat_idx, const device splat_buffer& _25)
+    {
+        return _25.splats[splat_idx].value;
+    }
+
+    static inline __attribute__((always_inline))
+    uint score_bin(thread const uint& splat_idx, const device splat_buffer& _25, constant select_params& _40, texture2d<float> chunk_texture)
+    {
+        uint param = splat_idx;
+        uint4 _80 = fetch_splat(param, _25);
+        uint _84 = _80.w & 255u;
+        if (_84 < 3u)
+        {
+            return 0u;
+        }
+        int _112 = int(splat_idx) / 256;
+        int2 _120 = int2((_112 % 1024) * 2, _112 / 1024);
+        float3 _128 = chunk_texture.read(uint2(_120), 0).xyz;
+        float3 _138 = _128 + ((float3(float((_80.x >> 16u) & 65535u), float(_80.x & 65535u), float((_80.y >> 16u) & 65535u)) * 1.525902189314365386962890625e-05) * (chunk_texture.read(uint2(_120 + int2(1, 0)), 0).xyz - _128));
+        float _146 = dot(_138 - float3(_40.camera_position), float3(_40.camera_forward));
+        if (_146 < 0.001000000047497451305389404296875)
+        {
+            return 0u;
+        }
+        float2 _166 = exp((float2(float((_80.z >> 16u) & 255u), float((_80.z >> 8u) & 255u)) * 0.0392156876623630523681640625) - float2(5.0));
+        float _171 = _40.focal_px / _146;
+        float4 _176 = float4(_138, 1.0);
+        float4 _197 = float4(dot(_40.viewProj_row0, _176), dot(_40.viewProj_row1, _176), dot(_40.viewProj_row2, _176), dot(_40.viewProj_row3, _176));
+        float _205 = (0.5 * fast::max(_166.x, _166.y)) * _171;
+        float2 _209 = _197.xy / float2(_197.w);
+        if ((abs(_209.x) > (1.0 + ((2.0 * _205) / _40.viewport_width))) || (abs(_209.y) > (1.0 + ((2.0 * _205) / _40.viewport_height))))
+        {
+            return 0u;
+        }
+        float _235 = ((((_166.x * _166.y) * _171) * _171) * float(_84)) * 0.0039215688593685626983642578125;
+        if (!(_235 > 0.0))
+        {
+            return 0u;
+        }
+        return uint(fast::clamp(((log2(_235) + 16.0) * 25.575000762939453125) + 1.0, 1.0, 1023.0));
+    }
+
+    kernel void main0(constant select_params& _40 [[buffer(0)]], const device splat_buffer& _25 [[buffer(11)]], const device candidate_input& _250 [[buffer(8)]], device bin_buffer& _262 [[buffer(9)]], device select_state& _270 [[buffer(10)]], texture2d<float> chunk_texture [[texture(0)]], sampler splat_sampler [[sampler(2)]], uint3 gl_GlobalInvocationID [[thread_position_in_grid]])
+    {
+        if (int(gl_GlobalInvocationID.x) >= _40.candidate_count)
+        {
+            return;
+        }
+        uint _265 = (_40.use_candidates != 0) ? _250.candidates[gl_GlobalInvocationID.x].value : gl_GlobalInvocationID.x;
+        uint param_1 = _265;
+        uint _268 = score_bin(param_1, _25, _40, chunk_texture);
+        _262.bins[gl_GlobalInvocationID.x].value = _268;
+        uint _275 = atomic_fetch_add_explicit((device atomic_uint*)&_270.state[_268].value, 1u, memory_order_relaxed);
+    }
+
+*/
+static const uint8_t score_bins_buffer_source_metal_macos[3696] = {
+    0x23,0x70,0x72,0x61,0x67,0x6d,0x61,0x20,0x63,0x6c,0x61,0x6e,0x67,0x20,0x64,0x69,
+    0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x20,0x69,0x67,0x6e,0x6f,0x72,0x65,0x64,
+    0x20,0x22,0x2d,0x57,0x6d,0x69,0x73,0x73,0x69,0x6e,0x67,0x2d,0x70,0x72,0x6f,0x74,
+    0x6f,0x74,0x79,0x70,0x65,0x73,0x22,0x0a,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,
+    0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,
+    0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,
+    0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+    0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,0x61,0x74,0x6f,0x6d,0x69,0x63,0x3e,0x0a,
+    0x0a,0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,
+    0x20,0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,
+    0x73,0x65,0x6c,0x65,0x63,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x69,0x65,0x77,0x50,
+    0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x20,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,
+    0x77,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,
+    0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x32,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,
+    0x6a,0x5f,0x72,0x6f,0x77,0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,0x70,0x61,0x63,0x6b,
+    0x65,0x64,0x5f,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x63,0x61,0x6d,0x65,0x72,0x61,
+    0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x66,0x6f,0x63,0x61,0x6c,0x5f,0x70,0x78,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x70,0x61,0x63,0x6b,0x65,0x64,0x5f,0x66,0x6c,0x6f,0x61,0x74,0x33,
+    0x20,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x66,0x6f,0x72,0x77,0x61,0x72,0x64,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x69,0x65,0x77,0x70,
+    0x6f,0x72,0x74,0x5f,0x77,0x69,0x64,0x74,0x68,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x76,0x69,0x65,0x77,0x70,0x6f,0x72,0x74,0x5f,0x68,0x65,
+    0x69,0x67,0x68,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x63,0x61,
+    0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x5f,0x63,0x6f,0x75,0x6e,0x74,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x75,0x73,0x65,0x5f,0x63,0x61,0x6e,0x64,0x69,
+    0x64,0x61,0x74,0x65,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x62,
+    0x75,0x64,0x67,0x65,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x77,0x69,0x64,0x74,0x68,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x6e,0x74,0x20,0x73,0x70,0x6c,0x61,0x74,0x73,0x5f,0x70,0x65,0x72,
+    0x5f,0x6c,0x61,0x79,0x65,0x72,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,
+    0x63,0x74,0x20,0x53,0x65,0x6c,0x65,0x63,0x74,0x56,0x61,0x6c,0x75,0x65,0x0a,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x76,0x61,0x6c,0x75,0x65,0x3b,
+    0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x65,0x6c,0x65,
+    0x63,0x74,0x53,0x70,0x6c,0x61,0x74,0x54,0x65,0x78,0x65,0x6c,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x34,0x20,0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,
+    0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x73,0x70,0x6c,0x61,0x74,
+    0x5f,0x62,0x75,0x66,0x66,0x65,0x72,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x53,0x65,
+    0x6c,0x65,0x63,0x74,0x53,0x70,0x6c,0x61,0x74,0x54,0x65,0x78,0x65,0x6c,0x20,0x73,
+    0x70,0x6c,0x61,0x74,0x73,0x5b,0x31,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,
+    0x72,0x75,0x63,0x74,0x20,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x5f,0x69,
+    0x6e,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x53,0x65,0x6c,0x65,0x63,
+    0x74,0x56,0x61,0x6c,0x75,0x65,0x20,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,
+    0x73,0x5b,0x31,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,
+    0x20,0x62,0x69,0x6e,0x5f,0x62,0x75,0x66,0x66,0x65,0x72,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x53,0x65,0x6c,0x65,0x63,0x74,0x56,0x61,0x6c,0x75,0x65,0x20,0x62,0x69,
+    0x6e,0x73,0x5b,0x31,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,
+    0x74,0x20,0x73,0x65,0x6c,0x65,0x63,0x74,0x5f,0x73,0x74,0x61,0x74,0x65,0x0a,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x53,0x65,0x6c,0x65,0x63,0x74,0x56,0x61,0x6c,0x75,0x65,
+    0x20,0x73,0x74,0x61,0x74,0x65,0x5b,0x31,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x63,
+    0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x75,0x69,0x6e,0x74,0x33,0x20,0x67,0x6c,
+    0x5f,0x57,0x6f,0x72,0x6b,0x47,0x72,0x6f,0x75,0x70,0x53,0x69,0x7a,0x65,0x20,0x5b,
+    0x5b,0x6d,0x61,0x79,0x62,0x65,0x5f,0x75,0x6e,0x75,0x73,0x65,0x64,0x5d,0x5d,0x20,
+    0x3d,0x20,0x75,0x69,0x6e,0x74,0x33,0x28,0x32,0x35,0x36,0x75,0x2c,0x20,0x31,0x75,
+    0x2c,0x20,0x31,0x75,0x29,0x3b,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,
+    0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,
+    0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,
+    0x6e,0x65,0x29,0x29,0x0a,0x75,0x69,0x6e,0x74,0x34,0x20,0x66,0x65,0x74,0x63,0x68,
+    0x5f,0x73,0x70,0x6c,0x61,0x74,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,
+    0x6e,0x73,0x74,0x20,0x75,0x69,0x6e,0x74,0x26,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,
+    0x69,0x64,0x78,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x64,0x65,0x76,0x69,0x63,
+    0x65,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x62,0x75,0x66,0x66,0x65,0x72,0x26,0x20,
+    0x5f,0x32,0x35,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,
+    0x6e,0x20,0x5f,0x32,0x35,0x2e,0x73,0x70,0x6c,0x61,0x74,0x73,0x5b,0x73,0x70,0x6c,
+    0x61,0x74,0x5f,0x69,0x64,0x78,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,0x7d,
+    0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,
+    0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,
+    0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x75,
+    0x69,0x6e,0x74,0x20,0x73,0x63,0x6f,0x72,0x65,0x5f,0x62,0x69,0x6e,0x28,0x74,0x68,
+    0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x75,0x69,0x6e,0x74,0x26,
+    0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x69,0x64,0x78,0x2c,0x20,0x63,0x6f,0x6e,0x73,
+    0x74,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x62,
+    0x75,0x66,0x66,0x65,0x72,0x26,0x20,0x5f,0x32,0x35,0x2c,0x20,0x63,0x6f,0x6e,0x73,
+    0x74,0x61,0x6e,0x74,0x20,0x73,0x65,0x6c,0x65,0x63,0x74,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x73,0x26,0x20,0x5f,0x34,0x30,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x63,0x68,0x75,0x6e,0x6b,0x5f,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,
+    0x69,0x6e,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x73,0x70,0x6c,0x61,
+    0x74,0x5f,0x69,0x64,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x34,
+    0x20,0x5f,0x38,0x30,0x20,0x3d,0x20,0x66,0x65,0x74,0x63,0x68,0x5f,0x73,0x70,0x6c,
+    0x61,0x74,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x5f,0x32,0x35,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,0x38,0x34,0x20,0x3d,0x20,0x5f,
+    0x38,0x30,0x2e,0x77,0x20,0x26,0x20,0x32,0x35,0x35,0x75,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x69,0x66,0x20,0x28,0x5f,0x38,0x34,0x20,0x3c,0x20,0x33,0x75,0x29,0x0a,0x20,
+    0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,
+    0x75,0x72,0x6e,0x20,0x30,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x6e,0x74,0x20,0x5f,0x31,0x31,0x32,0x20,0x3d,0x20,0x69,0x6e,0x74,
+    0x28,0x73,0x70,0x6c,0x61,0x74,0x5f,0x69,0x64,0x78,0x29,0x20,0x2f,0x20,0x32,0x35,
+    0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x32,0x20,0x5f,0x31,0x32,0x30,
+    0x20,0x3d,0x20,0x69,0x6e,0x74,0x32,0x28,0x28,0x5f,0x31,0x31,0x32,0x20,0x25,0x20,
+    0x31,0x30,0x32,0x34,0x29,0x20,0x2a,0x20,0x32,0x2c,0x20,0x5f,0x31,0x31,0x32,0x20,
+    0x2f,0x20,0x31,0x30,0x32,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x33,0x20,0x5f,0x31,0x32,0x38,0x20,0x3d,0x20,0x63,0x68,0x75,0x6e,0x6b,
+    0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x72,0x65,0x61,0x64,0x28,0x75,0x69,
+    0x6e,0x74,0x32,0x28,0x5f,0x31,0x32,0x30,0x29,0x2c,0x20,0x30,0x29,0x2e,0x78,0x79,
+    0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x31,
+    0x33,0x38,0x20,0x3d,0x20,0x5f,0x31,0x32,0x38,0x20,0x2b,0x20,0x28,0x28,0x66,0x6c,
+    0x6f,0x61,0x74,0x33,0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x28,0x5f,0x38,0x30,0x2e,
+    0x78,0x20,0x3e,0x3e,0x20,0x31,0x36,0x75,0x29,0x20,0x26,0x20,0x36,0x35,0x35,0x33,
+    0x35,0x75,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x5f,0x38,0x30,0x2e,0x78,
+    0x20,0x26,0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x28,0x28,0x5f,0x38,0x30,0x2e,0x79,0x20,0x3e,0x3e,0x20,0x31,0x36,0x75,0x29,
+    0x20,0x26,0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x29,0x20,0x2a,0x20,0x31,0x2e,
+    0x35,0x32,0x35,0x39,0x30,0x32,0x31,0x38,0x39,0x33,0x31,0x34,0x33,0x36,0x35,0x33,
+    0x38,0x36,0x39,0x36,0x32,0x38,0x39,0x30,0x36,0x32,0x35,0x65,0x2d,0x30,0x35,0x29,
+    0x20,0x2a,0x20,0x28,0x63,0x68,0x75,0x6e,0x6b,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,
+    0x65,0x2e,0x72,0x65,0x61,0x64,0x28,0x75,0x69,0x6e,0x74,0x32,0x28,0x5f,0x31,0x32,
+    0x30,0x20,0x2b,0x20,0x69,0x6e,0x74,0x32,0x28,0x31,0x2c,0x20,0x30,0x29,0x29,0x2c,
+    0x20,0x30,0x29,0x2e,0x78,0x79,0x7a,0x20,0x2d,0x20,0x5f,0x31,0x32,0x38,0x29,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,0x34,0x36,
+    0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x31,0x33,0x38,0x20,0x2d,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x33,0x28,0x5f,0x34,0x30,0x2e,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,
+    0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x33,0x28,0x5f,0x34,0x30,0x2e,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x66,0x6f,0x72,
+    0x77,0x61,0x72,0x64,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,
+    0x5f,0x31,0x34,0x36,0x20,0x3c,0x20,0x30,0x2e,0x30,0x30,0x31,0x30,0x30,0x30,0x30,
+    0x30,0x30,0x30,0x34,0x37,0x34,0x39,0x37,0x34,0x35,0x31,0x33,0x30,0x35,0x33,0x38,
+    0x39,0x34,0x30,0x34,0x32,0x39,0x36,0x38,0x37,0x35,0x29,0x0a,0x20,0x20,0x20,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x20,0x30,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x31,0x36,0x36,0x20,0x3d,0x20,0x65,0x78,0x70,
+    0x28,0x28,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x28,
+    0x5f,0x38,0x30,0x2e,0x7a,0x20,0x3e,0x3e,0x20,0x31,0x36,0x75,0x29,0x20,0x26,0x20,
+    0x32,0x35,0x35,0x75,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x28,0x5f,0x38,
+    0x30,0x2e,0x7a,0x20,0x3e,0x3e,0x20,0x38,0x75,0x29,0x20,0x26,0x20,0x32,0x35,0x35,
+    0x75,0x29,0x29,0x20,0x2a,0x20,0x30,0x2e,0x30,0x33,0x39,0x32,0x31,0x35,0x36,0x38,
+    0x37,0x36,0x36,0x32,0x33,0x36,0x33,0x30,0x35,0x32,0x33,0x36,0x38,0x31,0x36,0x34,
+    0x30,0x36,0x32,0x35,0x29,0x20,0x2d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x35,
+    0x2e,0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x5f,0x31,0x37,0x31,0x20,0x3d,0x20,0x5f,0x34,0x30,0x2e,0x66,0x6f,0x63,0x61,0x6c,
+    0x5f,0x70,0x78,0x20,0x2f,0x20,0x5f,0x31,0x34,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x31,0x37,0x36,0x20,0x3d,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x28,0x5f,0x31,0x33,0x38,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x31,0x39,0x37,
+    0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x64,0x6f,0x74,0x28,0x5f,0x34,
+    0x30,0x2e,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x30,0x2c,
+    0x20,0x5f,0x31,0x37,0x36,0x29,0x2c,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x30,0x2e,
+    0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x31,0x2c,0x20,0x5f,
+    0x31,0x37,0x36,0x29,0x2c,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x30,0x2e,0x76,0x69,
+    0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x32,0x2c,0x20,0x5f,0x31,0x37,
+    0x36,0x29,0x2c,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x30,0x2e,0x76,0x69,0x65,0x77,
+    0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x33,0x2c,0x20,0x5f,0x31,0x37,0x36,0x29,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,0x30,
+    0x35,0x20,0x3d,0x20,0x28,0x30,0x2e,0x35,0x20,0x2a,0x20,0x66,0x61,0x73,0x74,0x3a,
+    0x3a,0x6d,0x61,0x78,0x28,0x5f,0x31,0x36,0x36,0x2e,0x78,0x2c,0x20,0x5f,0x31,0x36,
+    0x36,0x2e,0x79,0x29,0x29,0x20,0x2a,0x20,0x5f,0x31,0x37,0x31,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x32,0x30,0x39,0x20,0x3d,0x20,
+    0x5f,0x31,0x39,0x37,0x2e,0x78,0x79,0x20,0x2f,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
+    0x28,0x5f,0x31,0x39,0x37,0x2e,0x77,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,
+    0x20,0x28,0x28,0x61,0x62,0x73,0x28,0x5f,0x32,0x30,0x39,0x2e,0x78,0x29,0x20,0x3e,
+    0x20,0x28,0x31,0x2e,0x30,0x20,0x2b,0x20,0x28,0x28,0x32,0x2e,0x30,0x20,0x2a,0x20,
+    0x5f,0x32,0x30,0x35,0x29,0x20,0x2f,0x20,0x5f,0x34,0x30,0x2e,0x76,0x69,0x65,0x77,
+    0x70,0x6f,0x72,0x74,0x5f,0x77,0x69,0x64,0x74,0x68,0x29,0x29,0x29,0x20,0x7c,0x7c,
+    0x20,0x28,0x61,0x62,0x73,0x28,0x5f,0x32,0x30,0x39,0x2e,0x79,0x29,0x20,0x3e,0x20,
+    0x28,0x31,0x2e,0x30,0x20,0x2b,0x20,0x28,0x28,0x32,0x2e,0x30,0x20,0x2a,0x20,0x5f,
+    0x32,0x30,0x35,0x29,0x20,0x2f,0x20,0x5f,0x34,0x30,0x2e,0x76,0x69,0x65,0x77,0x70,
+    0x6f,0x72,0x74,0x5f,0x68,0x65,0x69,0x67,0x68,0x74,0x29,0x29,0x29,0x29,0x0a,0x20,
+    0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,
+    0x75,0x72,0x6e,0x20,0x30,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,0x33,0x35,0x20,0x3d,0x20,0x28,
+    0x28,0x28,0x28,0x5f,0x31,0x36,0x36,0x2e,0x78,0x20,0x2a,0x20,0x5f,0x31,0x36,0x36,
+    0x2e,0x79,0x29,0x20,0x2a,0x20,0x5f,0x31,0x37,0x31,0x29,0x20,0x2a,0x20,0x5f,0x31,
+    0x37,0x31,0x29,0x20,0x2a,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x5f,0x38,0x34,0x29,
+    0x29,0x20,0x2a,0x20,0x30,0x2e,0x30,0x30,0x33,0x39,0x32,0x31,0x35,0x36,0x38,0x38,
+    0x35,0x39,0x33,0x36,0x38,0x35,0x36,0x32,0x36,0x39,0x38,0x33,0x36,0x34,0x32,0x35,
+    0x37,0x38,0x31,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x21,
+    0x28,0x5f,0x32,0x33,0x35,0x20,0x3e,0x20,0x30,0x2e,0x30,0x29,0x29,0x0a,0x20,0x20,
+    0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+    0x72,0x6e,0x20,0x30,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
+    0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x75,0x69,0x6e,0x74,0x28,0x66,0x61,0x73,
+    0x74,0x3a,0x3a,0x63,0x6c,0x61,0x6d,0x70,0x28,0x28,0x28,0x6c,0x6f,0x67,0x32,0x28,
+    0x5f,0x32,0x33,0x35,0x29,0x20,0x2b,0x20,0x31,0x36,0x2e,0x30,0x29,0x20,0x2a,0x20,
+    0x32,0x35,0x2e,0x35,0x37,0x35,0x30,0x30,0x30,0x37,0x36,0x32,0x39,0x33,0x39,0x34,
+    0x35,0x33,0x31,0x32,0x35,0x29,0x20,0x2b,0x20,0x31,0x2e,0x30,0x2c,0x20,0x31,0x2e,
+    0x30,0x2c,0x20,0x31,0x30,0x32,0x33,0x2e,0x30,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,
+    0x6b,0x65,0x72,0x6e,0x65,0x6c,0x20,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,
+    0x30,0x28,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x73,0x65,0x6c,0x65,0x63,
+    0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x26,0x20,0x5f,0x34,0x30,0x20,0x5b,0x5b,
+    0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x30,0x29,0x5d,0x5d,0x2c,0x20,0x63,0x6f,0x6e,
+    0x73,0x74,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,
+    0x62,0x75,0x66,0x66,0x65,0x72,0x26,0x20,0x5f,0x32,0x35,0x20,0x5b,0x5b,0x62,0x75,
+    0x66,0x66,0x65,0x72,0x28,0x31,0x31,0x29,0x5d,0x5d,0x2c,0x20,0x63,0x6f,0x6e,0x73,
+    0x74,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,
+    0x74,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x26,0x20,0x5f,0x32,0x35,0x30,0x20,0x5b,
+    0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x38,0x29,0x5d,0x5d,0x2c,0x20,0x64,0x65,
+    0x76,0x69,0x63,0x65,0x20,0x62,0x69,0x6e,0x5f,0x62,0x75,0x66,0x66,0x65,0x72,0x26,
+    0x20,0x5f,0x32,0x36,0x32,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x39,
+    0x29,0x5d,0x5d,0x2c,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x73,0x65,0x6c,0x65,
+    0x63,0x74,0x5f,0x73,0x74,0x61,0x74,0x65,0x26,0x20,0x5f,0x32,0x37,0x30,0x20,0x5b,
+    0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x31,0x30,0x29,0x5d,0x5d,0x2c,0x20,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,
+    0x63,0x68,0x75,0x6e,0x6b,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x20,0x5b,0x5b,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x30,0x29,0x5d,0x5d,0x2c,0x20,0x73,0x61,
+    0x6d,0x70,0x6c,0x65,0x72,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x73,0x61,0x6d,0x70,
+    0x6c,0x65,0x72,0x20,0x5b,0x5b,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x28,0x32,0x29,
+    0x5d,0x5d,0x2c,0x20,0x75,0x69,0x6e,0x74,0x33,0x20,0x67,0x6c,0x5f,0x47,0x6c,0x6f,
+    0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x20,
+    0x5b,0x5b,0x74,0x68,0x72,0x65,0x61,0x64,0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,
+    0x6e,0x5f,0x69,0x6e,0x5f,0x67,0x72,0x69,0x64,0x5d,0x5d,0x29,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x6e,0x74,0x28,0x67,0x6c,0x5f,0x47,0x6c,
+    0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,
+    0x2e,0x78,0x29,0x20,0x3e,0x3d,0x20,0x5f,0x34,0x30,0x2e,0x63,0x61,0x6e,0x64,0x69,
+    0x64,0x61,0x74,0x65,0x5f,0x63,0x6f,0x75,0x6e,0x74,0x29,0x0a,0x20,0x20,0x20,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,
+    0x20,0x5f,0x32,0x36,0x35,0x20,0x3d,0x20,0x28,0x5f,0x34,0x30,0x2e,0x75,0x73,0x65,
+    0x5f,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x73,0x20,0x21,0x3d,0x20,0x30,
+    0x29,0x20,0x3f,0x20,0x5f,0x32,0x35,0x30,0x2e,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,
+    0x74,0x65,0x73,0x5b,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,
+    0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x5d,0x2e,0x76,0x61,0x6c,
+    0x75,0x65,0x20,0x3a,0x20,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,
+    0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,
+    0x20,0x5f,0x32,0x36,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,
+    0x5f,0x32,0x36,0x38,0x20,0x3d,0x20,0x73,0x63,0x6f,0x72,0x65,0x5f,0x62,0x69,0x6e,
+    0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x2c,0x20,0x5f,0x32,0x35,0x2c,0x20,0x5f,
+    0x34,0x30,0x2c,0x20,0x63,0x68,0x75,0x6e,0x6b,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,
+    0x65,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x5f,0x32,0x36,0x32,0x2e,0x62,0x69,0x6e,
+    0x73,0x5b,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,
+    0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,
+    0x20,0x3d,0x20,0x5f,0x32,0x36,0x38,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,
+    0x74,0x20,0x5f,0x32,0x37,0x35,0x20,0x3d,0x20,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,
+    0x66,0x65,0x74,0x63,0x68,0x5f,0x61,0x64,0x64,0x5f,0x65,0x78,0x70,0x6c,0x69,0x63,
+    0x69,0x74,0x28,0x28,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x61,0x74,0x6f,0x6d,0x69,
+    0x63,0x5f,0x75,0x69,0x6e,0x74,0x2a,0x29,0x26,0x5f,0x32,0x37,0x30,0x2e,0x73,0x74,
+    0x61,0x74,0x65,0x5b,0x5f,0x32,0x36,0x38,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x2c,
+    0x20,0x31,0x75,0x2c,0x20,0x6d,0x65,0x6d,0x6f,0x72,0x79,0x5f,0x6f,0x72,0x64,0x65,
+    0x72,0x5f,0x72,0x65,0x6c,0x61,0x78,0x65,0x64,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+
+};
+/*
+    #include <metal_stdlib>
+    #include <simd/simd.h>
+
+    using namespace metal;
+
+    struct select_params
+    {
+        float4 viewProj_row0;
+        float4 viewProj_row1;
+        float4 viewProj_row2;
+        float4 viewProj_row3;
+        packed_float3 camera_position;
+        float focal_px;
+        packed_float3 camera_forward;
+        float viewport_width;
+        float viewport_height;
+        int candidate_count;
+        int use_candidates;
+        int budget;
+        int texture_width;
+        int splats_per_layer;
+    };
+
+    struct SelectValue
+    {
+        uint value;
+    };
+
+    struct select_state
+    {
+        SelectValue state[1];
+    };
+
+    constant uint3 gl_WorkGroupSize [[maybe_unused]] = uint3(1u, 1u, 1u);
+
+    kernel void main0(constant select_params& _40 [[buffer(0)]], device select_state& _35 [[buffer(8)]])
+    {
+        uint remaining = uint(_40.budget);
+        uint threshold_bin = 0u;
+        bool found = false;
+        for (int b = 1023; b >= 0; b--)
+        {
+            uint _48 = _35.state[b].value;
+            _35.state[b].value = 0u;
+            if (found)
+            {
+                continue;
+            }
+            if (_48 >= remaining)
+            {
+                threshold_bin = uint(b);
+                found = true;
+            }
+            else
+            {
+                remaining -= _48;
+            }
+        }
+        _35.state[1024].value = threshold_bin;
+        _35.state[1025].value = remaining;
+        _35.state[1026].value = 0u;
+        _35.state[1027].value = 0u;
+    }
+
+*/
+static const uint8_t find_threshold_source_metal_macos[1325] = {
+    0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,
+    0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+    0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,
+    0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,
+    0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x73,
+    0x65,0x6c,0x65,0x63,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x69,0x65,0x77,0x50,0x72,
+    0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x20,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,
+    0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x69,
+    0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x32,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,
+    0x5f,0x72,0x6f,0x77,0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,0x70,0x61,0x63,0x6b,0x65,
+    0x64,0x5f,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,
+    0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x66,0x6f,0x63,0x61,0x6c,0x5f,0x70,0x78,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x70,0x61,0x63,0x6b,0x65,0x64,0x5f,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,
+    0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x66,0x6f,0x72,0x77,0x61,0x72,0x64,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x69,0x65,0x77,0x70,0x6f,
+    0x72,0x74,0x5f,0x77,0x69,0x64,0x74,0x68,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x76,0x69,0x65,0x77,0x70,0x6f,0x72,0x74,0x5f,0x68,0x65,0x69,
+    0x67,0x68,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x63,0x61,0x6e,
+    0x64,0x69,0x64,0x61,0x74,0x65,0x5f,0x63,0x6f,0x75,0x6e,0x74,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x6e,0x74,0x20,0x75,0x73,0x65,0x5f,0x63,0x61,0x6e,0x64,0x69,0x64,
+    0x61,0x74,0x65,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x62,0x75,
+    0x64,0x67,0x65,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x74,0x65,
+    0x78,0x74,0x75,0x72,0x65,0x5f,0x77,0x69,0x64,0x74,0x68,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x69,0x6e,0x74,0x20,0x73,0x70,0x6c,0x61,0x74,0x73,0x5f,0x70,0x65,0x72,0x5f,
+    0x6c,0x61,0x79,0x65,0x72,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,
+    0x74,0x20,0x53,0x65,0x6c,0x65,0x63,0x74,0x56,0x61,0x6c,0x75,0x65,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,
+    0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x73,0x65,0x6c,0x65,0x63,
+    0x74,0x5f,0x73,0x74,0x61,0x74,0x65,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x53,0x65,
+    0x6c,0x65,0x63,0x74,0x56,0x61,0x6c,0x75,0x65,0x20,0x73,0x74,0x61,0x74,0x65,0x5b,
+    0x31,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,
+    0x20,0x75,0x69,0x6e,0x74,0x33,0x20,0x67,0x6c,0x5f,0x57,0x6f,0x72,0x6b,0x47,0x72,
+    0x6f,0x75,0x70,0x53,0x69,0x7a,0x65,0x20,0x5b,0x5b,0x6d,0x61,0x79,0x62,0x65,0x5f,
+    0x75,0x6e,0x75,0x73,0x65,0x64,0x5d,0x5d,0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,0x33,
+    0x28,0x31,0x75,0x2c,0x20,0x31,0x75,0x2c,0x20,0x31,0x75,0x29,0x3b,0x0a,0x0a,0x6b,
+    0x65,0x72,0x6e,0x65,0x6c,0x20,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x30,
+    0x28,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x73,0x65,0x6c,0x65,0x63,0x74,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x26,0x20,0x5f,0x34,0x30,0x20,0x5b,0x5b,0x62,
+    0x75,0x66,0x66,0x65,0x72,0x28,0x30,0x29,0x5d,0x5d,0x2c,0x20,0x64,0x65,0x76,0x69,
+    0x63,0x65,0x20,0x73,0x65,0x6c,0x65,0x63,0x74,0x5f,0x73,0x74,0x61,0x74,0x65,0x26,
+    0x20,0x5f,0x33,0x35,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x38,0x29,
+    0x5d,0x5d,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x72,
+    0x65,0x6d,0x61,0x69,0x6e,0x69,0x6e,0x67,0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,0x28,
+    0x5f,0x34,0x30,0x2e,0x62,0x75,0x64,0x67,0x65,0x74,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x75,0x69,0x6e,0x74,0x20,0x74,0x68,0x72,0x65,0x73,0x68,0x6f,0x6c,0x64,0x5f,
+    0x62,0x69,0x6e,0x20,0x3d,0x20,0x30,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,
+    0x6f,0x6c,0x20,0x66,0x6f,0x75,0x6e,0x64,0x20,0x3d,0x20,0x66,0x61,0x6c,0x73,0x65,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x62,
+    0x20,0x3d,0x20,0x31,0x30,0x32,0x33,0x3b,0x20,0x62,0x20,0x3e,0x3d,0x20,0x30,0x3b,
+    0x20,0x62,0x2d,0x2d,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,0x34,0x38,0x20,0x3d,0x20,0x5f,
+    0x33,0x35,0x2e,0x73,0x74,0x61,0x74,0x65,0x5b,0x62,0x5d,0x2e,0x76,0x61,0x6c,0x75,
+    0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x33,0x35,0x2e,0x73,
+    0x74,0x61,0x74,0x65,0x5b,0x62,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,
+    0x30,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,
+    0x66,0x6f,0x75,0x6e,0x64,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6f,0x6e,
+    0x74,0x69,0x6e,0x75,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x34,0x38,
+    0x20,0x3e,0x3d,0x20,0x72,0x65,0x6d,0x61,0x69,0x6e,0x69,0x6e,0x67,0x29,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x72,0x65,0x73,0x68,0x6f,0x6c,0x64,0x5f,0x62,
+    0x69,0x6e,0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,0x28,0x62,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6f,0x75,0x6e,0x64,0x20,
+    0x3d,0x20,0x74,0x72,0x75,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x6d,0x61,0x69,0x6e,0x69,0x6e,0x67,0x20,0x2d,
+    0x3d,0x20,0x5f,0x34,0x38,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,
+    0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x5f,0x33,0x35,0x2e,0x73,
+    0x74,0x61,0x74,0x65,0x5b,0x31,0x30,0x32,0x34,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,
+    0x20,0x3d,0x20,0x74,0x68,0x72,0x65,0x73,0x68,0x6f,0x6c,0x64,0x5f,0x62,0x69,0x6e,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x5f,0x33,0x35,0x2e,0x73,0x74,0x61,0x74,0x65,0x5b,
+    0x31,0x30,0x32,0x35,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x72,0x65,
+    0x6d,0x61,0x69,0x6e,0x69,0x6e,0x67,0x3b,0x0a,0x20,0x20,0x20,0x20,0x5f,0x33,0x35,
+    0x2e,0x73,0x74,0x61,0x74,0x65,0x5b,0x31,0x30,0x32,0x36,0x5d,0x2e,0x76,0x61,0x6c,
+    0x75,0x65,0x20,0x3d,0x20,0x30,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x5f,0x33,0x35,
+    0x2e,0x73,0x74,0x61,0x74,0x65,0x5b,0x31,0x30,0x32,0x37,0x5d,0x2e,0x76,0x61,0x6c,
+    0x75,0x65,0x20,0x3d,0x20,0x30,0x75,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #include <metal_stdlib>
+    #include <simd/simd.h>
+    #include <metal_atomic>
+
+    using namespace metal;
+
+    struct select_params
+    {
+        float4 viewProj_row0;
+        float4 viewProj_row1;
+        float4 viewProj_row2;
+        float4 viewProj_row3;
+        packed_float3 camera_position;
+        float focal_px;
+        packed_float3 camera_forward;
+        float viewport_width;
+        float viewport_height;
+        int candidate_count;
+        int use_candidates;
+        int budget;
+        int texture_width;
+        int splats_per_layer;
+    };
+
+    struct SelectValue
+    {
+        uint value;
+    };
+
+    struct candidate_input
+    {
+        SelectValue candidates[1];
+    };
+
+    struct bin_buffer
+    {
+        SelectValue bins[1];
+    };
+
+    struct select_state
+    {
+        SelectValue state[1];
+    };
+
+    struct selected_output
+    {
+        SelectValue selected[1];
+    };
+
+    constant uint3 gl_WorkGroupSize [[maybe_unused]] = uint3(256u, 1u, 1u);
+
+    kernel void main0(constant select_params& _40 [[buffer(0)]], const device candidate_input& _250 [[buffer(8)]], device bin_buffer& _262 [[buffer(9)]], device select_state& _270 [[buffer(10)]], device selected_output& _290 [[buffer(11)]], uint3 gl_GlobalInvocationID [[thread_position_in_grid]])
+    {
+        if (int(gl_GlobalInvocationID.x) >= _40.candidate_count)
+        {
+            return;
+        }
+        uint _41 = _262.bins[gl_GlobalInvocationID.x].value;
+        uint _49 = _270.state[1024].value;
+        bool keep = _41 > _49;
+        if (_41 == _49)
+        {
+            uint _64 = atomic_fetch_add_explicit((device atomic_uint*)&_270.state[1027].value, 1u, memory_order_relaxed);
+            keep = _64 < _270.state[1025].value;
+        }
+        if (keep)
+        {
+            uint _77 = atomic_fetch_add_explicit((device atomic_uint*)&_270.state[1026].value, 1u, memory_order_relaxed);
+            _290.selected[_77].value = (_40.use_candidates != 0) ? _250.candidates[gl_GlobalInvocationID.x].value : gl_GlobalInvocationID.x;
+        }
+    }
+
+*/
+static const uint8_t compact_selected_source_metal_macos[1804] = {
+    0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,
+    0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+    0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x23,
+    0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,0x61,
+    0x74,0x6f,0x6d,0x69,0x63,0x3e,0x0a,0x0a,0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,0x61,
+    0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,0x0a,
+    0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x73,0x65,0x6c,0x65,0x63,0x74,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x20,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x30,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x69,0x65,0x77,
+    0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,
+    0x6f,0x77,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x33,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x70,0x61,0x63,0x6b,0x65,0x64,0x5f,0x66,0x6c,0x6f,0x61,0x74,0x33,
+    0x20,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x66,0x6f,0x63,0x61,
+    0x6c,0x5f,0x70,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x70,0x61,0x63,0x6b,0x65,0x64,
+    0x5f,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x66,
+    0x6f,0x72,0x77,0x61,0x72,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x76,0x69,0x65,0x77,0x70,0x6f,0x72,0x74,0x5f,0x77,0x69,0x64,0x74,0x68,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x69,0x65,0x77,
+    0x70,0x6f,0x72,0x74,0x5f,0x68,0x65,0x69,0x67,0x68,0x74,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x69,0x6e,0x74,0x20,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x5f,0x63,
+    0x6f,0x75,0x6e,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x75,0x73,
+    0x65,0x5f,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x73,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x6e,0x74,0x20,0x62,0x75,0x64,0x67,0x65,0x74,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x6e,0x74,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x77,0x69,
+    0x64,0x74,0x68,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x73,0x70,0x6c,
+    0x61,0x74,0x73,0x5f,0x70,0x65,0x72,0x5f,0x6c,0x61,0x79,0x65,0x72,0x3b,0x0a,0x7d,
+    0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x65,0x6c,0x65,0x63,0x74,
+    0x56,0x61,0x6c,0x75,0x65,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,
+    0x20,0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,
+    0x63,0x74,0x20,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x5f,0x69,0x6e,0x70,
+    0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x53,0x65,0x6c,0x65,0x63,0x74,0x56,
+    0x61,0x6c,0x75,0x65,0x20,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x73,0x5b,
+    0x31,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x62,
+    0x69,0x6e,0x5f,0x62,0x75,0x66,0x66,0x65,0x72,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x53,0x65,0x6c,0x65,0x63,0x74,0x56,0x61,0x6c,0x75,0x65,0x20,0x62,0x69,0x6e,0x73,
+    0x5b,0x31,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,
+    0x73,0x65,0x6c,0x65,0x63,0x74,0x5f,0x73,0x74,0x61,0x74,0x65,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x53,0x65,0x6c,0x65,0x63,0x74,0x56,0x61,0x6c,0x75,0x65,0x20,0x73,
+    0x74,0x61,0x74,0x65,0x5b,0x31,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,
+    0x75,0x63,0x74,0x20,0x73,0x65,0x6c,0x65,0x63,0x74,0x65,0x64,0x5f,0x6f,0x75,0x74,
+    0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x53,0x65,0x6c,0x65,0x63,0x74,
+    0x56,0x61,0x6c,0x75,0x65,0x20,0x73,0x65,0x6c,0x65,0x63,0x74,0x65,0x64,0x5b,0x31,
+    0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,
+    0x75,0x69,0x6e,0x74,0x33,0x20,0x67,0x6c,0x5f,0x57,0x6f,0x72,0x6b,0x47,0x72,0x6f,
+    0x75,0x70,0x53,0x69,0x7a,0x65,0x20,0x5b,0x5b,0x6d,0x61,0x79,0x62,0x65,0x5f,0x75,
+    0x6e,0x75,0x73,0x65,0x64,0x5d,0x5d,0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,0x33,0x28,
+    0x32,0x35,0x36,0x75,0x2c,0x20,0x31,0x75,0x2c,0x20,0x31,0x75,0x29,0x3b,0x0a,0x0a,
+    0x6b,0x65,0x72,0x6e,0x65,0x6c,0x20,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,
+    0x30,0x28,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x73,0x65,0x6c,0x65,0x63,
+    0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x26,0x20,0x5f,0x34,0x30,0x20,0x5b,0x5b,
+    0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x30,0x29,0x5d,0x5d,0x2c,0x20,0x63,0x6f,0x6e,
+    0x73,0x74,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x63,0x61,0x6e,0x64,0x69,0x64,
+    0x61,0x74,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x26,0x20,0x5f,0x32,0x35,0x30,0x20,
+    0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x38,0x29,0x5d,0x5d,0x2c,0x20,0x64,
+    0x65,0x76,0x69,0x63,0x65,0x20,0x62,0x69,0x6e,0x5f,0x62,0x75,0x66,0x66,0x65,0x72,
+    0x26,0x20,0x5f,0x32,0x36,0x32,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,
+    0x39,0x29,0x5d,0x5d,0x2c,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x73,0x65,0x6c,
+    0x65,0x63,0x74,0x5f,0x73,0x74,0x61,0x74,0x65,0x26,0x20,0x5f,0x32,0x37,0x30,0x20,
+    0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x31,0x30,0x29,0x5d,0x5d,0x2c,0x20,
+    0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x73,0x65,0x6c,0x65,0x63,0x74,0x65,0x64,0x5f,
+    0x6f,0x75,0x74,0x70,0x75,0x74,0x26,0x20,0x5f,0x32,0x39,0x30,0x20,0x5b,0x5b,0x62,
+    0x75,0x66,0x66,0x65,0x72,0x28,0x31,0x31,0x29,0x5d,0x5d,0x2c,0x20,0x75,0x69,0x6e,
+    0x74,0x33,0x20,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,
+    0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x20,0x5b,0x5b,0x74,0x68,0x72,0x65,0x61,
+    0x64,0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x69,0x6e,0x5f,0x67,0x72,
+    0x69,0x64,0x5d,0x5d,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,
+    0x69,0x6e,0x74,0x28,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,
+    0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x29,0x20,0x3e,0x3d,0x20,
+    0x5f,0x34,0x30,0x2e,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x5f,0x63,0x6f,
+    0x75,0x6e,0x74,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,
+    0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,0x34,0x31,0x20,0x3d,0x20,
+    0x5f,0x32,0x36,0x32,0x2e,0x62,0x69,0x6e,0x73,0x5b,0x67,0x6c,0x5f,0x47,0x6c,0x6f,
+    0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,
+    0x78,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,
+    0x6e,0x74,0x20,0x5f,0x34,0x39,0x20,0x3d,0x20,0x5f,0x32,0x37,0x30,0x2e,0x73,0x74,
+    0x61,0x74,0x65,0x5b,0x31,0x30,0x32,0x34,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x6b,0x65,0x65,0x70,0x20,0x3d,
+    0x20,0x5f,0x34,0x31,0x20,0x3e,0x20,0x5f,0x34,0x39,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x69,0x66,0x20,0x28,0x5f,0x34,0x31,0x20,0x3d,0x3d,0x20,0x5f,0x34,0x39,0x29,0x0a,
+    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x75,0x69,
+    0x6e,0x74,0x20,0x5f,0x36,0x34,0x20,0x3d,0x20,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,
+    0x66,0x65,0x74,0x63,0x68,0x5f,0x61,0x64,0x64,0x5f,0x65,0x78,0x70,0x6c,0x69,0x63,
+    0x69,0x74,0x28,0x28,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x61,0x74,0x6f,0x6d,0x69,
+    0x63,0x5f,0x75,0x69,0x6e,0x74,0x2a,0x29,0x26,0x5f,0x32,0x37,0x30,0x2e,0x73,0x74,
+    0x61,0x74,0x65,0x5b,0x31,0x30,0x32,0x37,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x2c,
+    0x20,0x31,0x75,0x2c,0x20,0x6d,0x65,0x6d,0x6f,0x72,0x79,0x5f,0x6f,0x72,0x64,0x65,
+    0x72,0x5f,0x72,0x65,0x6c,0x61,0x78,0x65,0x64,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x6b,0x65,0x65,0x70,0x20,0x3d,0x20,0x5f,0x36,0x34,0x20,0x3c,
+    0x20,0x5f,0x32,0x37,0x30,0x2e,0x73,0x74,0x61,0x74,0x65,0x5b,0x31,0x30,0x32,0x35,
+    0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,
+    0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x6b,0x65,0x65,0x70,0x29,0x0a,0x20,0x20,0x20,
+    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,
+    0x5f,0x37,0x37,0x20,0x3d,0x20,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x66,0x65,0x74,
+    0x63,0x68,0x5f,0x61,0x64,0x64,0x5f,0x65,0x78,0x70,0x6c,0x69,0x63,0x69,0x74,0x28,
+    0x28,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x75,
+    0x69,0x6e,0x74,0x2a,0x29,0x26,0x5f,0x32,0x37,0x30,0x2e,0x73,0x74,0x61,0x74,0x65,
+    0x5b,0x31,0x30,0x32,0x36,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x2c,0x20,0x31,0x75,
+    0x2c,0x20,0x6d,0x65,0x6d,0x6f,0x72,0x79,0x5f,0x6f,0x72,0x64,0x65,0x72,0x5f,0x72,
+    0x65,0x6c,0x61,0x78,0x65,0x64,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x5f,0x32,0x39,0x30,0x2e,0x73,0x65,0x6c,0x65,0x63,0x74,0x65,0x64,0x5b,0x5f,
+    0x37,0x37,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x28,0x5f,0x34,0x30,
+    0x2e,0x75,0x73,0x65,0x5f,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x73,0x20,
+    0x21,0x3d,0x20,0x30,0x29,0x20,0x3f,0x20,0x5f,0x32,0x35,0x30,0x2e,0x63,0x61,0x6e,
+    0x64,0x69,0x64,0x61,0x74,0x65,0x73,0x5b,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,
+    0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x5d,
+    0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3a,0x20,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,
+    0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #pragma clang diagnostic ignored "-Wmissing-prototypes"
+
+    #include <metal_stdlib>
+    #include <simd/simd.h>
+    #include <metal_atomic>
+
+    using namespace metal;
+
+    struct select_params
+    {
+        float4 viewProj_row0;
+        float4 viewProj_row1;
+        float4 viewProj_row2;
+        float4 viewProj_row3;
+        packed_float3 camera_position;
+        float focal_px;
+        packed_float3 camera_forward;
+        float viewport_width;
+        float viewport_height;
+        int candidate_count;
+        int use_candidates;
+        int budget;
+        int texture_width;
+        int splats_per_layer;
+    };
+
+    struct SelectValue
+    {
+        uint value;
+    };
+
+    struct candidate_input
+    {
+        SelectValue candidates[1];
+    };
+
+    struct bin_buffer
+    {
+        SelectValue bins[1];
+    };
+
+    struct select_state
+    {
+        SelectValue state[1];
+    };
+
+    constant uint3 gl_WorkGroupSize [[maybe_unused]] = uint3(256u, 1u, 1u);
+
+    static inline __attribute__((always_inline))
+    uint4 fetch_splat(thread const uint& splat_idx, constant select_params& _40, texture2d_array<uint> splat_texture, sampler splat_sampler)
+    {
+        int _31 = int(splat_idx) / _40.splats_per_layer;
+        int _37 = int(splat_idx) - (_31 * _40.splats_per_layer);
+        int3 _52 = int3(_37 % _40.texture_width, _37 / _40.texture_width, _31);
+        return splat_texture.read(uint2(_52.xy), uint(_52.z), 0);
+    }
+
+    static inline __attribute__((always_inline))
+    uint score_bin(thread const uint& splat_idx, texture2d_array<uint> splat_texture, sampler splat_sampler, constant select_params& _40, texture2d<float> chunk_texture)
+    {
+        uint param = splat_idx;
+        uint4 _80 = fetch_splat(param, _40, splat_texture, splat_sampler);
+        uint _84 = _80.w & 255u;
+        if (_84 < 3u)
+        {
+            return 0u;
+        }
+        int _112 = int(splat_idx) / 256;
+        int2 _120 = int2((_112 % 1024) * 2, _112 / 1024);
+        float3 _128 = chunk_texture.read(uint2(_120), 0).xyz;
+        float3 _138 = _128 + ((float3(float((_80.x >> 16u) & 65535u), float(_80.x & 65535u), float((_80.y >> 16u) & 65535u)) * 1.525902189314365386962890625e-05) * (chunk_texture.read(uint2(_120 + int2(1, 0)), 0).xyz - _128));
+        float _146 = dot(_138 - float3(_40.camera_position), float3(_40.camera_forward));
+        if (_146 < 0.001000000047497451305389404296875)
+        {
+            return 0u;
+        }
+        float2 _166 = exp((float2(float((_80.z >> 16u) & 255u), float((_80.z >> 8u) & 255u)) * 0.0392156876623630523681640625) - float2(5.0));
+        float _171 = _40.focal_px / _146;
+        float4 _176 = float4(_138, 1.0);
+        float4 _197 = float4(dot(_40.viewProj_row0, _176), dot(_40.viewProj_row1, _176), dot(_40.viewProj_row2, _176), dot(_40.viewProj_row3, _176));
+        float _205 = (0.5 * fast::max(_166.x, _166.y)) * _171;
+        float2 _209 = _197.xy / float2(_197.w);
+        if ((abs(_209.x) > (1.0 + ((2.0 * _205) / _40.viewport_width))) || (abs(_209.y) > (1.0 + ((2.0 * _205) / _40.viewport_height))))
+        {
+            return 0u;
+        }
+        float _235 = ((((_166.x * _166.y) * _171) * _171) * float(_84)) * 0.0039215688593685626983642578125;
+        if (!(_235 > 0.0))
+        {
+            return 0u;
+        }
+        return uint(fast::clamp(((log2(_235) + 16.0) * 25.575000762939453125) + 1.0, 1.0, 1023.0));
+    }
+
+    kernel void main0(constant select_params& _40 [[buffer(0)]], const device candidate_input& _250 [[buffer(8)]], device bin_buffer& _262 [[buffer(9)]], device select_state& _270 [[buffer(10)]], texture2d_array<uint> splat_texture [[texture(0)]], texture2d<float> chunk_texture [[texture(1)]], sampler splat_sampler [[sampler(2)]], uint3 gl_GlobalInvocationID [[thread_position_in_grid]])
+    {
+        if (int(gl_GlobalInvocationID.x) >= _40.candidate_count)
+        {
+            return;
+        }
+        uint _265 = (_40.use_candidates != 0) ? _250.candidates[gl_GlobalInvocationID.x].value : gl_GlobalInvocationID.x;
+        uint param_1 = _265;
+        uint _268 = score_bin(param_1, splat_texture, splat_sampler, _40, chunk_texture);
+        _262.bins[gl_GlobalInvocationID.x].value = _268;
+        uint _275 = atomic_fetch_add_explicit((device atomic_uint*)&_270.state[_268].value, 1u, memory_order_relaxed);
+    }
+
+*/
+static const uint8_t score_bins_source_metal_ios[3948] = {
+    0x23,0x70,0x72,0x61,0x67,0x6d,0x61,0x20,0x63,0x6c,0x61,0x6e,0x67,0x20,0x64,0x69,
+    0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x20,0x69,0x67,0x6e,0x6f,0x72,0x65,0x64,
+    0x20,0x22,0x2d,0x57,0x6d,0x69,0x73,0x73,0x69,0x6e,0x67,0x2d,0x70,0x72,0x6f,0x74,
+    0x6f,0x74,0x79,0x70,0x65,0x73,0x22,0x0a,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,
+    0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,
+    0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,
+    0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+    0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,0x61,0x74,0x6f,0x6d,0x69,0x63,0x3e,0x0a,
+    0x0a,0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,
+    0x20,0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,
+    0x73,0x65,0x6c,0x65,0x63,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x69,0x65,0x77,0x50,
+    0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x20,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,
+    0x77,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,
+    0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x32,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,
+    0x6a,0x5f,0x72,0x6f,0x77,0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,0x70,0x61,0x63,0x6b,
+    0x65,0x64,0x5f,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x63,0x61,0x6d,0x65,0x72,0x61,
+    0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x66,0x6f,0x63,0x61,0x6c,0x5f,0x70,0x78,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x70,0x61,0x63,0x6b,0x65,0x64,0x5f,0x66,0x6c,0x6f,0x61,0x74,0x33,
+    0x20,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x66,0x6f,0x72,0x77,0x61,0x72,0x64,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x69,0x65,0x77,0x70,
+    0x6f,0x72,0x74,0x5f,0x77,0x69,0x64,0x74,0x68,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x76,0x69,0x65,0x77,0x70,0x6f,0x72,0x74,0x5f,0x68,0x65,
+    0x69,0x67,0x68,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x63,0x61,
+    0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x5f,0x63,0x6f,0x75,0x6e,0x74,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x75,0x73,0x65,0x5f,0x63,0x61,0x6e,0x64,0x69,
+    0x64,0x61,0x74,0x65,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x62,
+    0x75,0x64,0x67,0x65,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x77,0x69,0x64,0x74,0x68,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x6e,0x74,0x20,0x73,0x70,0x6c,0x61,0x74,0x73,0x5f,0x70,0x65,0x72,
+    0x5f,0x6c,0x61,0x79,0x65,0x72,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,
+    0x63,0x74,0x20,0x53,0x65,0x6c,0x65,0x63,0x74,0x56,0x61,0x6c,0x75,0x65,0x0a,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x76,0x61,0x6c,0x75,0x65,0x3b,
+    0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x63,0x61,0x6e,0x64,
+    0x69,0x64,0x61,0x74,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x53,0x65,0x6c,0x65,0x63,0x74,0x56,0x61,0x6c,0x75,0x65,0x20,0x63,0x61,
+    0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x73,0x5b,0x31,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,
+    0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x62,0x69,0x6e,0x5f,0x62,0x75,0x66,0x66,
+    0x65,0x72,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x53,0x65,0x6c,0x65,0x63,0x74,0x56,
+    0x61,0x6c,0x75,0x65,0x20,0x62,0x69,0x6e,0x73,0x5b,0x31,0x5d,0x3b,0x0a,0x7d,0x3b,
+    0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x73,0x65,0x6c,0x65,0x63,0x74,0x5f,
+    0x73,0x74,0x61,0x74,0x65,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x53,0x65,0x6c,0x65,
+    0x63,0x74,0x56,0x61,0x6c,0x75,0x65,0x20,0x73,0x74,0x61,0x74,0x65,0x5b,0x31,0x5d,
+    0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x75,
+    0x69,0x6e,0x74,0x33,0x20,0x67,0x6c,0x5f,0x57,0x6f,0x72,0x6b,0x47,0x72,0x6f,0x75,
+    0x70,0x53,0x69,0x7a,0x65,0x20,0x5b,0x5b,0x6d,0x61,0x79,0x62,0x65,0x5f,0x75,0x6e,
+    0x75,0x73,0x65,0x64,0x5d,0x5d,0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,0x33,0x28,0x32,
+    0x35,0x36,0x75,0x2c,0x20,0x31,0x75,0x2c,0x20,0x31,0x75,0x29,0x3b,0x0a,0x0a,0x73,
+    0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,
+    0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,
+    0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x75,0x69,0x6e,0x74,
+    0x34,0x20,0x66,0x65,0x74,0x63,0x68,0x5f,0x73,0x70,0x6c,0x61,0x74,0x28,0x74,0x68,
+    0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x75,0x69,0x6e,0x74,0x26,
+    0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x69,0x64,0x78,0x2c,0x20,0x63,0x6f,0x6e,0x73,
+    0x74,0x61,0x6e,0x74,0x20,0x73,0x65,0x6c,0x65,0x63,0x74,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x73,0x26,0x20,0x5f,0x34,0x30,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x32,0x64,0x5f,0x61,0x72,0x72,0x61,0x79,0x3c,0x75,0x69,0x6e,0x74,0x3e,0x20,0x73,
+    0x70,0x6c,0x61,0x74,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2c,0x20,0x73,0x61,
+    0x6d,0x70,0x6c,0x65,0x72,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x73,0x61,0x6d,0x70,
+    0x6c,0x65,0x72,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x5f,
+    0x33,0x31,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,0x73,0x70,0x6c,0x61,0x74,0x5f,0x69,
+    0x64,0x78,0x29,0x20,0x2f,0x20,0x5f,0x34,0x30,0x2e,0x73,0x70,0x6c,0x61,0x74,0x73,
+    0x5f,0x70,0x65,0x72,0x5f,0x6c,0x61,0x79,0x65,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x69,0x6e,0x74,0x20,0x5f,0x33,0x37,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,0x73,0x70,
+    0x6c,0x61,0x74,0x5f,0x69,0x64,0x78,0x29,0x20,0x2d,0x20,0x28,0x5f,0x33,0x31,0x20,
+    0x2a,0x20,0x5f,0x34,0x30,0x2e,0x73,0x70,0x6c,0x61,0x74,0x73,0x5f,0x70,0x65,0x72,
+    0x5f,0x6c,0x61,0x79,0x65,0x72,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,
+    0x33,0x20,0x5f,0x35,0x32,0x20,0x3d,0x20,0x69,0x6e,0x74,0x33,0x28,0x5f,0x33,0x37,
+    0x20,0x25,0x20,0x5f,0x34,0x30,0x2e,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x77,
+    0x69,0x64,0x74,0x68,0x2c,0x20,0x5f,0x33,0x37,0x20,0x2f,0x20,0x5f,0x34,0x30,0x2e,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x77,0x69,0x64,0x74,0x68,0x2c,0x20,0x5f,
+    0x33,0x31,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
+    0x73,0x70,0x6c,0x61,0x74,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x72,0x65,
+    0x61,0x64,0x28,0x75,0x69,0x6e,0x74,0x32,0x28,0x5f,0x35,0x32,0x2e,0x78,0x79,0x29,
+    0x2c,0x20,0x75,0x69,0x6e,0x74,0x28,0x5f,0x35,0x32,0x2e,0x7a,0x29,0x2c,0x20,0x30,
+    0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,
+    0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,
+    0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,
+    0x29,0x29,0x0a,0x75,0x69,0x6e,0x74,0x20,0x73,0x63,0x6f,0x72,0x65,0x5f,0x62,0x69,
+    0x6e,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x75,
+    0x69,0x6e,0x74,0x26,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x69,0x64,0x78,0x2c,0x20,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x5f,0x61,0x72,0x72,0x61,0x79,0x3c,
+    0x75,0x69,0x6e,0x74,0x3e,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x74,0x65,0x78,0x74,
+    0x75,0x72,0x65,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x73,0x70,0x6c,
+    0x61,0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x63,0x6f,0x6e,0x73,
+    0x74,0x61,0x6e,0x74,0x20,0x73,0x65,0x6c,0x65,0x63,0x74,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x73,0x26,0x20,0x5f,0x34,0x30,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x63,0x68,0x75,0x6e,0x6b,0x5f,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,
+    0x69,0x6e,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x73,0x70,0x6c,0x61,
+    0x74,0x5f,0x69,0x64,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x34,
+    0x20,0x5f,0x38,0x30,0x20,0x3d,0x20,0x66,0x65,0x74,0x63,0x68,0x5f,0x73,0x70,0x6c,
+    0x61,0x74,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x5f,0x34,0x30,0x2c,0x20,0x73,
+    0x70,0x6c,0x61,0x74,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2c,0x20,0x73,0x70,
+    0x6c,0x61,0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,0x38,0x34,0x20,0x3d,0x20,0x5f,0x38,0x30,
+    0x2e,0x77,0x20,0x26,0x20,0x32,0x35,0x35,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,
+    0x66,0x20,0x28,0x5f,0x38,0x34,0x20,0x3c,0x20,0x33,0x75,0x29,0x0a,0x20,0x20,0x20,
+    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,
+    0x6e,0x20,0x30,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
+    0x69,0x6e,0x74,0x20,0x5f,0x31,0x31,0x32,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,0x73,
+    0x70,0x6c,0x61,0x74,0x5f,0x69,0x64,0x78,0x29,0x20,0x2f,0x20,0x32,0x35,0x36,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x32,0x20,0x5f,0x31,0x32,0x30,0x20,0x3d,
+    0x20,0x69,0x6e,0x74,0x32,0x28,0x28,0x5f,0x31,0x31,0x32,0x20,0x25,0x20,0x31,0x30,
+    0x32,0x34,0x29,0x20,0x2a,0x20,0x32,0x2c,0x20,0x5f,0x31,0x31,0x32,0x20,0x2f,0x20,
+    0x31,0x30,0x32,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x33,0x20,0x5f,0x31,0x32,0x38,0x20,0x3d,0x20,0x63,0x68,0x75,0x6e,0x6b,0x5f,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x72,0x65,0x61,0x64,0x28,0x75,0x69,0x6e,0x74,
+    0x32,0x28,0x5f,0x31,0x32,0x30,0x29,0x2c,0x20,0x30,0x29,0x2e,0x78,0x79,0x7a,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x31,0x33,0x38,
+    0x20,0x3d,0x20,0x5f,0x31,0x32,0x38,0x20,0x2b,0x20,0x28,0x28,0x66,0x6c,0x6f,0x61,
+    0x74,0x33,0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x28,0x5f,0x38,0x30,0x2e,0x78,0x20,
+    0x3e,0x3e,0x20,0x31,0x36,0x75,0x29,0x20,0x26,0x20,0x36,0x35,0x35,0x33,0x35,0x75,
+    0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x5f,0x38,0x30,0x2e,0x78,0x20,0x26,
+    0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,
+    0x28,0x5f,0x38,0x30,0x2e,0x79,0x20,0x3e,0x3e,0x20,0x31,0x36,0x75,0x29,0x20,0x26,
+    0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x29,0x20,0x2a,0x20,0x31,0x2e,0x35,0x32,
+    0x35,0x39,0x30,0x32,0x31,0x38,0x39,0x33,0x31,0x34,0x33,0x36,0x35,0x33,0x38,0x36,
+    0x39,0x36,0x32,0x38,0x39,0x30,0x36,0x32,0x35,0x65,0x2d,0x30,0x35,0x29,0x20,0x2a,
+    0x20,0x28,0x63,0x68,0x75,0x6e,0x6b,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,
+    0x72,0x65,0x61,0x64,0x28,0x75,0x69,0x6e,0x74,0x32,0x28,0x5f,0x31,0x32,0x30,0x20,
+    0x2b,0x20,0x69,0x6e,0x74,0x32,0x28,0x31,0x2c,0x20,0x30,0x29,0x29,0x2c,0x20,0x30,
+    0x29,0x2e,0x78,0x79,0x7a,0x20,0x2d,0x20,0x5f,0x31,0x32,0x38,0x29,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,0x34,0x36,0x20,0x3d,
+    0x20,0x64,0x6f,0x74,0x28,0x5f,0x31,0x33,0x38,0x20,0x2d,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x33,0x28,0x5f,0x34,0x30,0x2e,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x70,0x6f,
+    0x73,0x69,0x74,0x69,0x6f,0x6e,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,
+    0x5f,0x34,0x30,0x2e,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x66,0x6f,0x72,0x77,0x61,
+    0x72,0x64,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x31,
+    0x34,0x36,0x20,0x3c,0x20,0x30,0x2e,0x30,0x30,0x31,0x30,0x30,0x30,0x30,0x30,0x30,
+    0x30,0x34,0x37,0x34,0x39,0x37,0x34,0x35,0x31,0x33,0x30,0x35,0x33,0x38,0x39,0x34,
+    0x30,0x34,0x32,0x39,0x36,0x38,0x37,0x35,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x30,
+    0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x20,0x5f,0x31,0x36,0x36,0x20,0x3d,0x20,0x65,0x78,0x70,0x28,0x28,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x28,0x5f,0x38,
+    0x30,0x2e,0x7a,0x20,0x3e,0x3e,0x20,0x31,0x36,0x75,0x29,0x20,0x26,0x20,0x32,0x35,
+    0x35,0x75,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x28,0x5f,0x38,0x30,0x2e,
+    0x7a,0x20,0x3e,0x3e,0x20,0x38,0x75,0x29,0x20,0x26,0x20,0x32,0x35,0x35,0x75,0x29,
+    0x29,0x20,0x2a,0x20,0x30,0x2e,0x30,0x33,0x39,0x32,0x31,0x35,0x36,0x38,0x37,0x36,
+    0x36,0x32,0x33,0x36,0x33,0x30,0x35,0x32,0x33,0x36,0x38,0x31,0x36,0x34,0x30,0x36,
+    0x32,0x35,0x29,0x20,0x2d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x35,0x2e,0x30,
+    0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,
+    0x37,0x31,0x20,0x3d,0x20,0x5f,0x34,0x30,0x2e,0x66,0x6f,0x63,0x61,0x6c,0x5f,0x70,
+    0x78,0x20,0x2f,0x20,0x5f,0x31,0x34,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x20,0x5f,0x31,0x37,0x36,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x34,0x28,0x5f,0x31,0x33,0x38,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x31,0x39,0x37,0x20,0x3d,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x64,0x6f,0x74,0x28,0x5f,0x34,0x30,0x2e,
+    0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x30,0x2c,0x20,0x5f,
+    0x31,0x37,0x36,0x29,0x2c,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x30,0x2e,0x76,0x69,
+    0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x31,0x2c,0x20,0x5f,0x31,0x37,
+    0x36,0x29,0x2c,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x30,0x2e,0x76,0x69,0x65,0x77,
+    0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x32,0x2c,0x20,0x5f,0x31,0x37,0x36,0x29,
+    0x2c,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x30,0x2e,0x76,0x69,0x65,0x77,0x50,0x72,
+    0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x33,0x2c,0x20,0x5f,0x31,0x37,0x36,0x29,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,0x30,0x35,0x20,
+    0x3d,0x20,0x28,0x30,0x2e,0x35,0x20,0x2a,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,0x6d,
+    0x61,0x78,0x28,0x5f,0x31,0x36,0x36,0x2e,0x78,0x2c,0x20,0x5f,0x31,0x36,0x36,0x2e,
+    0x79,0x29,0x29,0x20,0x2a,0x20,0x5f,0x31,0x37,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x32,0x30,0x39,0x20,0x3d,0x20,0x5f,0x31,
+    0x39,0x37,0x2e,0x78,0x79,0x20,0x2f,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x5f,
+    0x31,0x39,0x37,0x2e,0x77,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,
+    0x28,0x61,0x62,0x73,0x28,0x5f,0x32,0x30,0x39,0x2e,0x78,0x29,0x20,0x3e,0x20,0x28,
+    0x31,0x2e,0x30,0x20,0x2b,0x20,0x28,0x28,0x32,0x2e,0x30,0x20,0x2a,0x20,0x5f,0x32,
+    0x30,0x35,0x29,0x20,0x2f,0x20,0x5f,0x34,0x30,0x2e,0x76,0x69,0x65,0x77,0x70,0x6f,
+    0x72,0x74,0x5f,0x77,0x69,0x64,0x74,0x68,0x29,0x29,0x29,0x20,0x7c,0x7c,0x20,0x28,
+    0x61,0x62,0x73,0x28,0x5f,0x32,0x30,0x39,0x2e,0x79,0x29,0x20,0x3e,0x20,0x28,0x31,
+    0x2e,0x30,0x20,0x2b,0x20,0x28,0x28,0x32,0x2e,0x30,0x20,0x2a,0x20,0x5f,0x32,0x30,
+    0x35,0x29,0x20,0x2f,0x20,0x5f,0x34,0x30,0x2e,0x76,0x69,0x65,0x77,0x70,0x6f,0x72,
+    0x74,0x5f,0x68,0x65,0x69,0x67,0x68,0x74,0x29,0x29,0x29,0x29,0x0a,0x20,0x20,0x20,
+    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,
+    0x6e,0x20,0x30,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,0x33,0x35,0x20,0x3d,0x20,0x28,0x28,0x28,
+    0x28,0x5f,0x31,0x36,0x36,0x2e,0x78,0x20,0x2a,0x20,0x5f,0x31,0x36,0x36,0x2e,0x79,
+    0x29,0x20,0x2a,0x20,0x5f,0x31,0x37,0x31,0x29,0x20,0x2a,0x20,0x5f,0x31,0x37,0x31,
+    0x29,0x20,0x2a,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x5f,0x38,0x34,0x29,0x29,0x20,
+    0x2a,0x20,0x30,0x2e,0x30,0x30,0x33,0x39,0x32,0x31,0x35,0x36,0x38,0x38,0x35,0x39,
+    0x33,0x36,0x38,0x35,0x36,0x32,0x36,0x39,0x38,0x33,0x36,0x34,0x32,0x35,0x37,0x38,
+    0x31,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x21,0x28,0x5f,
+    0x32,0x33,0x35,0x20,0x3e,0x20,0x30,0x2e,0x30,0x29,0x29,0x0a,0x20,0x20,0x20,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x20,0x30,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,
+    0x65,0x74,0x75,0x72,0x6e,0x20,0x75,0x69,0x6e,0x74,0x28,0x66,0x61,0x73,0x74,0x3a,
+    0x3a,0x63,0x6c,0x61,0x6d,0x70,0x28,0x28,0x28,0x6c,0x6f,0x67,0x32,0x28,0x5f,0x32,
+    0x33,0x35,0x29,0x20,0x2b,0x20,0x31,0x36,0x2e,0x30,0x29,0x20,0x2a,0x20,0x32,0x35,
+    0x2e,0x35,0x37,0x35,0x30,0x30,0x30,0x37,0x36,0x32,0x39,0x33,0x39,0x34,0x35,0x33,
+    0x31,0x32,0x35,0x29,0x20,0x2b,0x20,0x31,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x2c,
+    0x20,0x31,0x30,0x32,0x33,0x2e,0x30,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x6b,0x65,
+    0x72,0x6e,0x65,0x6c,0x20,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x30,0x28,
+    0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x73,0x65,0x6c,0x65,0x63,0x74,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x26,0x20,0x5f,0x34,0x30,0x20,0x5b,0x5b,0x62,0x75,
+    0x66,0x66,0x65,0x72,0x28,0x30,0x29,0x5d,0x5d,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,
+    0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,
+    0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x26,0x20,0x5f,0x32,0x35,0x30,0x20,0x5b,0x5b,
+    0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x38,0x29,0x5d,0x5d,0x2c,0x20,0x64,0x65,0x76,
+    0x69,0x63,0x65,0x20,0x62,0x69,0x6e,0x5f,0x62,0x75,0x66,0x66,0x65,0x72,0x26,0x20,
+    0x5f,0x32,0x36,0x32,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x39,0x29,
+    0x5d,0x5d,0x2c,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x73,0x65,0x6c,0x65,0x63,
+    0x74,0x5f,0x73,0x74,0x61,0x74,0x65,0x26,0x20,0x5f,0x32,0x37,0x30,0x20,0x5b,0x5b,
+    0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x31,0x30,0x29,0x5d,0x5d,0x2c,0x20,0x74,0x65,
+    0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x5f,0x61,0x72,0x72,0x61,0x79,0x3c,0x75,0x69,
+    0x6e,0x74,0x3e,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,
+    0x65,0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x30,0x29,0x5d,0x5d,
+    0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,
+    0x74,0x3e,0x20,0x63,0x68,0x75,0x6e,0x6b,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x31,0x29,0x5d,0x5d,0x2c,
+    0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x73,
+    0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x5b,0x5b,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,
+    0x28,0x32,0x29,0x5d,0x5d,0x2c,0x20,0x75,0x69,0x6e,0x74,0x33,0x20,0x67,0x6c,0x5f,
+    0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,
+    0x49,0x44,0x20,0x5b,0x5b,0x74,0x68,0x72,0x65,0x61,0x64,0x5f,0x70,0x6f,0x73,0x69,
+    0x74,0x69,0x6f,0x6e,0x5f,0x69,0x6e,0x5f,0x67,0x72,0x69,0x64,0x5d,0x5d,0x29,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x6e,0x74,0x28,0x67,0x6c,
+    0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,
+    0x6e,0x49,0x44,0x2e,0x78,0x29,0x20,0x3e,0x3d,0x20,0x5f,0x34,0x30,0x2e,0x63,0x61,
+    0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x5f,0x63,0x6f,0x75,0x6e,0x74,0x29,0x0a,0x20,
+    0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,
+    0x75,0x72,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x75,
+    0x69,0x6e,0x74,0x20,0x5f,0x32,0x36,0x35,0x20,0x3d,0x20,0x28,0x5f,0x34,0x30,0x2e,
+    0x75,0x73,0x65,0x5f,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x73,0x20,0x21,
+    0x3d,0x20,0x30,0x29,0x20,0x3f,0x20,0x5f,0x32,0x35,0x30,0x2e,0x63,0x61,0x6e,0x64,
+    0x69,0x64,0x61,0x74,0x65,0x73,0x5b,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,
+    0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x5d,0x2e,
+    0x76,0x61,0x6c,0x75,0x65,0x20,0x3a,0x20,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,
+    0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x31,0x20,0x3d,0x20,0x5f,0x32,0x36,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,
+    0x6e,0x74,0x20,0x5f,0x32,0x36,0x38,0x20,0x3d,0x20,0x73,0x63,0x6f,0x72,0x65,0x5f,
+    0x62,0x69,0x6e,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x2c,0x20,0x73,0x70,0x6c,
+    0x61,0x74,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2c,0x20,0x73,0x70,0x6c,0x61,
+    0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x5f,0x34,0x30,0x2c,0x20,
+    0x63,0x68,0x75,0x6e,0x6b,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x5f,0x32,0x36,0x32,0x2e,0x62,0x69,0x6e,0x73,0x5b,0x67,0x6c,
+    0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,
+    0x6e,0x49,0x44,0x2e,0x78,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x5f,
+    0x32,0x36,0x38,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,0x32,
+    0x37,0x35,0x20,0x3d,0x20,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x66,0x65,0x74,0x63,
+    0x68,0x5f,0x61,0x64,0x64,0x5f,0x65,0x78,0x70,0x6c,0x69,0x63,0x69,0x74,0x28,0x28,
+    0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x75,0x69,
+    0x6e,0x74,0x2a,0x29,0x26,0x5f,0x32,0x37,0x30,0x2e,0x73,0x74,0x61,0x74,0x65,0x5b,
+    0x5f,0x32,0x36,0x38,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x2c,0x20,0x31,0x75,0x2c,
+    0x20,0x6d,0x65,0x6d,0x6f,0x72,0x79,0x5f,0x6f,0x72,0x64,0x65,0x72,0x5f,0x72,0x65,
+    0x6c,0x61,0x78,0x65,0x64,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #pragma clang diagnostic ignored "-Wmissing-prototypes"
+
+    #include <metal_stdlib>
+    #include <simd/simd.h>
+    #include <metal_atomic>
+
+    using namespace metal;
+
+    struct select_params
+    {
+        float4 viewProj_row0;
+        float4 viewProj_row1;
+        float4 viewProj_row2;
+        float4 viewProj_row3;
+        packed_float3 camera_position;
+        float focal_px;
+        packed_float3 camera_forward;
+        float viewport_width;
+        float viewport_height;
+        int candidate_count;
+        int use_candidates;
+        int budget;
+        int texture_width;
+        int splats_per_layer;
+    };
+
+    struct SelectValue
+    {
+        uint value;
+    };
+
+    struct SelectSplatTexel
+    {
+        uint4 value;
+    };
+
+    struct splat_buffer
+    {
+        SelectSplatTexel splats[1];
+    };
+
+    struct candidate_input
+    {
+        SelectValue candidates[1];
+    };
+
+    struct bin_buffer
+    {
+        SelectValue bins[1];
+    };
+
+    struct select_state
+    {
+        SelectValue state[1];
+    };
+
+    constant uint3 gl_WorkGroupSize [[maybe_unused]] = uint3(256u, 1u, 1u);
+
+    static inline __attribute__((always_inline))
+    uint4 fetch_splat(thread const uint& splat_idx, const device splat_buffer& _25)
+    {
+        return _25.splats[splat_idx].value;
+    }
+
+    static inline __attribute__((always_inline))
+    uint score_bin(thread const uint& splat_idx, const device splat_buffer& _25, constant select_params& _40, texture2d<float> chunk_texture)
+    {
+        uint param = splat_idx;
+        uint4 _80 = fetch_splat(param, _25);
+        uint _84 = _80.w & 255u;
+        if (_84 < 3u)
+        {
+            return 0u;
+        }
+        int _112 = int(splat_idx) / 256;
+        int2 _120 = int2((_112 % 1024) * 2, _112 / 1024);
+        float3 _128 = chunk_texture.read(uint2(_120), 0).xyz;
+        float3 _138 = _128 + ((float3(float((_80.x >> 16u) & 65535u), float(_80.x & 65535u), float((_80.y >> 16u) & 65535u)) * 1.525902189314365386962890625e-05) * (chunk_texture.read(uint2(_120 + int2(1, 0)), 0).xyz - _128));
+        float _146 = dot(_138 - float3(_40.camera_position), float3(_40.camera_forward));
+        if (_146 < 0.001000000047497451305389404296875)
+        {
+            return 0u;
+        }
+        float2 _166 = exp((float2(float((_80.z >> 16u) & 255u), float((_80.z >> 8u) & 255u)) * 0.0392156876623630523681640625) - float2(5.0));
+        float _171 = _40.focal_px / _146;
+        float4 _176 = float4(_138, 1.0);
+        float4 _197 = float4(dot(_40.viewProj_row0, _176), dot(_40.viewProj_row1, _176), dot(_40.viewProj_row2, _176), dot(_40.viewProj_row3, _176));
+        float _205 = (0.5 * fast::max(_166.x, _166.y)) * _171;
+        float2 _209 = _197.xy / float2(_197.w);
+        if ((abs(_209.x) > (1.0 + ((2.0 * _205) / _40.viewport_width))) || (abs(_209.y) > (1.0 + ((2.0 * _205) / _40.viewport_height))))
+        {
+            return 0u;
+        }
+        float _235 = ((((_166.x * _166.y) * _171) * _171) * float(_84)) * 0.0039215688593685626983642578125;
+        if (!(_235 > 0.0))
+        {
+            return 0u;
+        }
+        return uint(fast::clamp(((log2(_235) + 16.0) * 25.575000762939453125) + 1.0, 1.0, 1023.0));
+    }
+
+    kernel void main0(constant select_params& _40 [[buffer(0)]], const device splat_buffer& _25 [[buffer(11)]], const device candidate_input& _250 [[buffer(8)]], device bin_buffer& _262 [[buffer(9)]], device select_state& _270 [[buffer(10)]], texture2d<float> chunk_texture [[texture(0)]], sampler splat_sampler [[sampler(2)]], uint3 gl_GlobalInvocationID [[thread_position_in_grid]])
+    {
+        if (int(gl_GlobalInvocationID.x) >= _40.candidate_count)
+        {
+            return;
+        }
+        uint _265 = (_40.use_candidates != 0) ? _250.candidates[gl_GlobalInvocationID.x].value : gl_GlobalInvocationID.x;
+        uint param_1 = _265;
+        uint _268 = score_bin(param_1, _25, _40, chunk_texture);
+        _262.bins[gl_GlobalInvocationID.x].value = _268;
+        uint _275 = atomic_fetch_add_explicit((device atomic_uint*)&_270.state[_268].value, 1u, memory_order_relaxed);
+    }
+
+*/
+static const uint8_t score_bins_buffer_source_metal_ios[3696] = {
+    0x23,0x70,0x72,0x61,0x67,0x6d,0x61,0x20,0x63,0x6c,0x61,0x6e,0x67,0x20,0x64,0x69,
+    0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x20,0x69,0x67,0x6e,0x6f,0x72,0x65,0x64,
+    0x20,0x22,0x2d,0x57,0x6d,0x69,0x73,0x73,0x69,0x6e,0x67,0x2d,0x70,0x72,0x6f,0x74,
+    0x6f,0x74,0x79,0x70,0x65,0x73,0x22,0x0a,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,
+    0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,
+    0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,
+    0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+    0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,0x61,0x74,0x6f,0x6d,0x69,0x63,0x3e,0x0a,
+    0x0a,0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,
+    0x20,0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,
+    0x73,0x65,0x6c,0x65,0x63,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x69,0x65,0x77,0x50,
+    0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x20,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,
+    0x77,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,
+    0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x32,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,
+    0x6a,0x5f,0x72,0x6f,0x77,0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,0x70,0x61,0x63,0x6b,
+    0x65,0x64,0x5f,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x63,0x61,0x6d,0x65,0x72,0x61,
+    0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x66,0x6f,0x63,0x61,0x6c,0x5f,0x70,0x78,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x70,0x61,0x63,0x6b,0x65,0x64,0x5f,0x66,0x6c,0x6f,0x61,0x74,0x33,
+    0x20,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x66,0x6f,0x72,0x77,0x61,0x72,0x64,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x69,0x65,0x77,0x70,
+    0x6f,0x72,0x74,0x5f,0x77,0x69,0x64,0x74,0x68,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x76,0x69,0x65,0x77,0x70,0x6f,0x72,0x74,0x5f,0x68,0x65,
+    0x69,0x67,0x68,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x63,0x61,
+    0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x5f,0x63,0x6f,0x75,0x6e,0x74,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x75,0x73,0x65,0x5f,0x63,0x61,0x6e,0x64,0x69,
+    0x64,0x61,0x74,0x65,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x62,
+    0x75,0x64,0x67,0x65,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x77,0x69,0x64,0x74,0x68,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x6e,0x74,0x20,0x73,0x70,0x6c,0x61,0x74,0x73,0x5f,0x70,0x65,0x72,
+    0x5f,0x6c,0x61,0x79,0x65,0x72,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,
+    0x63,0x74,0x20,0x53,0x65,0x6c,0x65,0x63,0x74,0x56,0x61,0x6c,0x75,0x65,0x0a,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x76,0x61,0x6c,0x75,0x65,0x3b,
+    0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x65,0x6c,0x65,
+    0x63,0x74,0x53,0x70,0x6c,0x61,0x74,0x54,0x65,0x78,0x65,0x6c,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x34,0x20,0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,
+    0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x73,0x70,0x6c,0x61,0x74,
+    0x5f,0x62,0x75,0x66,0x66,0x65,0x72,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x53,0x65,
+    0x6c,0x65,0x63,0x74,0x53,0x70,0x6c,0x61,0x74,0x54,0x65,0x78,0x65,0x6c,0x20,0x73,
+    0x70,0x6c,0x61,0x74,0x73,0x5b,0x31,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,
+    0x72,0x75,0x63,0x74,0x20,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x5f,0x69,
+    0x6e,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x53,0x65,0x6c,0x65,0x63,
+    0x74,0x56,0x61,0x6c,0x75,0x65,0x20,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,
+    0x73,0x5b,0x31,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,
+    0x20,0x62,0x69,0x6e,0x5f,0x62,0x75,0x66,0x66,0x65,0x72,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x53,0x65,0x6c,0x65,0x63,0x74,0x56,0x61,0x6c,0x75,0x65,0x20,0x62,0x69,
+    0x6e,0x73,0x5b,0x31,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,
+    0x74,0x20,0x73,0x65,0x6c,0x65,0x63,0x74,0x5f,0x73,0x74,0x61,0x74,0x65,0x0a,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x53,0x65,0x6c,0x65,0x63,0x74,0x56,0x61,0x6c,0x75,0x65,
+    0x20,0x73,0x74,0x61,0x74,0x65,0x5b,0x31,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x63,
+    0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x75,0x69,0x6e,0x74,0x33,0x20,0x67,0x6c,
+    0x5f,0x57,0x6f,0x72,0x6b,0x47,0x72,0x6f,0x75,0x70,0x53,0x69,0x7a,0x65,0x20,0x5b,
+    0x5b,0x6d,0x61,0x79,0x62,0x65,0x5f,0x75,0x6e,0x75,0x73,0x65,0x64,0x5d,0x5d,0x20,
+    0x3d,0x20,0x75,0x69,0x6e,0x74,0x33,0x28,0x32,0x35,0x36,0x75,0x2c,0x20,0x31,0x75,
+    0x2c,0x20,0x31,0x75,0x29,0x3b,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,
+    0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,
+    0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,
+    0x6e,0x65,0x29,0x29,0x0a,0x75,0x69,0x6e,0x74,0x34,0x20,0x66,0x65,0x74,0x63,0x68,
+    0x5f,0x73,0x70,0x6c,0x61,0x74,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,
+    0x6e,0x73,0x74,0x20,0x75,0x69,0x6e,0x74,0x26,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,
+    0x69,0x64,0x78,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x64,0x65,0x76,0x69,0x63,
+    0x65,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x62,0x75,0x66,0x66,0x65,0x72,0x26,0x20,
+    0x5f,0x32,0x35,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,
+    0x6e,0x20,0x5f,0x32,0x35,0x2e,0x73,0x70,0x6c,0x61,0x74,0x73,0x5b,0x73,0x70,0x6c,
+    0x61,0x74,0x5f,0x69,0x64,0x78,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,0x7d,
+    0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,
+    0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,
+    0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x75,
+    0x69,0x6e,0x74,0x20,0x73,0x63,0x6f,0x72,0x65,0x5f,0x62,0x69,0x6e,0x28,0x74,0x68,
+    0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x75,0x69,0x6e,0x74,0x26,
+    0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x69,0x64,0x78,0x2c,0x20,0x63,0x6f,0x6e,0x73,
+    0x74,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x62,
+    0x75,0x66,0x66,0x65,0x72,0x26,0x20,0x5f,0x32,0x35,0x2c,0x20,0x63,0x6f,0x6e,0x73,
+    0x74,0x61,0x6e,0x74,0x20,0x73,0x65,0x6c,0x65,0x63,0x74,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x73,0x26,0x20,0x5f,0x34,0x30,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x63,0x68,0x75,0x6e,0x6b,0x5f,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,
+    0x69,0x6e,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x73,0x70,0x6c,0x61,
+    0x74,0x5f,0x69,0x64,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x34,
+    0x20,0x5f,0x38,0x30,0x20,0x3d,0x20,0x66,0x65,0x74,0x63,0x68,0x5f,0x73,0x70,0x6c,
+    0x61,0x74,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x5f,0x32,0x35,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,0x38,0x34,0x20,0x3d,0x20,0x5f,
+    0x38,0x30,0x2e,0x77,0x20,0x26,0x20,0x32,0x35,0x35,0x75,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x69,0x66,0x20,0x28,0x5f,0x38,0x34,0x20,0x3c,0x20,0x33,0x75,0x29,0x0a,0x20,
+    0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,
+    0x75,0x72,0x6e,0x20,0x30,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x6e,0x74,0x20,0x5f,0x31,0x31,0x32,0x20,0x3d,0x20,0x69,0x6e,0x74,
+    0x28,0x73,0x70,0x6c,0x61,0x74,0x5f,0x69,0x64,0x78,0x29,0x20,0x2f,0x20,0x32,0x35,
+    0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x32,0x20,0x5f,0x31,0x32,0x30,
+    0x20,0x3d,0x20,0x69,0x6e,0x74,0x32,0x28,0x28,0x5f,0x31,0x31,0x32,0x20,0x25,0x20,
+    0x31,0x30,0x32,0x34,0x29,0x20,0x2a,0x20,0x32,0x2c,0x20,0x5f,0x31,0x31,0x32,0x20,
+    0x2f,0x20,0x31,0x30,0x32,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x33,0x20,0x5f,0x31,0x32,0x38,0x20,0x3d,0x20,0x63,0x68,0x75,0x6e,0x6b,
+    0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x72,0x65,0x61,0x64,0x28,0x75,0x69,
+    0x6e,0x74,0x32,0x28,0x5f,0x31,0x32,0x30,0x29,0x2c,0x20,0x30,0x29,0x2e,0x78,0x79,
+    0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x31,
+    0x33,0x38,0x20,0x3d,0x20,0x5f,0x31,0x32,0x38,0x20,0x2b,0x20,0x28,0x28,0x66,0x6c,
+    0x6f,0x61,0x74,0x33,0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x28,0x5f,0x38,0x30,0x2e,
+    0x78,0x20,0x3e,0x3e,0x20,0x31,0x36,0x75,0x29,0x20,0x26,0x20,0x36,0x35,0x35,0x33,
+    0x35,0x75,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x5f,0x38,0x30,0x2e,0x78,
+    0x20,0x26,0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x28,0x28,0x5f,0x38,0x30,0x2e,0x79,0x20,0x3e,0x3e,0x20,0x31,0x36,0x75,0x29,
+    0x20,0x26,0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x29,0x20,0x2a,0x20,0x31,0x2e,
+    0x35,0x32,0x35,0x39,0x30,0x32,0x31,0x38,0x39,0x33,0x31,0x34,0x33,0x36,0x35,0x33,
+    0x38,0x36,0x39,0x36,0x32,0x38,0x39,0x30,0x36,0x32,0x35,0x65,0x2d,0x30,0x35,0x29,
+    0x20,0x2a,0x20,0x28,0x63,0x68,0x75,0x6e,0x6b,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,
+    0x65,0x2e,0x72,0x65,0x61,0x64,0x28,0x75,0x69,0x6e,0x74,0x32,0x28,0x5f,0x31,0x32,
+    0x30,0x20,0x2b,0x20,0x69,0x6e,0x74,0x32,0x28,0x31,0x2c,0x20,0x30,0x29,0x29,0x2c,
+    0x20,0x30,0x29,0x2e,0x78,0x79,0x7a,0x20,0x2d,0x20,0x5f,0x31,0x32,0x38,0x29,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,0x34,0x36,
+    0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x31,0x33,0x38,0x20,0x2d,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x33,0x28,0x5f,0x34,0x30,0x2e,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,
+    0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x33,0x28,0x5f,0x34,0x30,0x2e,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x66,0x6f,0x72,
+    0x77,0x61,0x72,0x64,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,
+    0x5f,0x31,0x34,0x36,0x20,0x3c,0x20,0x30,0x2e,0x30,0x30,0x31,0x30,0x30,0x30,0x30,
+    0x30,0x30,0x30,0x34,0x37,0x34,0x39,0x37,0x34,0x35,0x31,0x33,0x30,0x35,0x33,0x38,
+    0x39,0x34,0x30,0x34,0x32,0x39,0x36,0x38,0x37,0x35,0x29,0x0a,0x20,0x20,0x20,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x20,0x30,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x31,0x36,0x36,0x20,0x3d,0x20,0x65,0x78,0x70,
+    0x28,0x28,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x28,
+    0x5f,0x38,0x30,0x2e,0x7a,0x20,0x3e,0x3e,0x20,0x31,0x36,0x75,0x29,0x20,0x26,0x20,
+    0x32,0x35,0x35,0x75,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x28,0x5f,0x38,
+    0x30,0x2e,0x7a,0x20,0x3e,0x3e,0x20,0x38,0x75,0x29,0x20,0x26,0x20,0x32,0x35,0x35,
+    0x75,0x29,0x29,0x20,0x2a,0x20,0x30,0x2e,0x30,0x33,0x39,0x32,0x31,0x35,0x36,0x38,
+    0x37,0x36,0x36,0x32,0x33,0x36,0x33,0x30,0x35,0x32,0x33,0x36,0x38,0x31,0x36,0x34,
+    0x30,0x36,0x32,0x35,0x29,0x20,0x2d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x35,
+    0x2e,0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x5f,0x31,0x37,0x31,0x20,0x3d,0x20,0x5f,0x34,0x30,0x2e,0x66,0x6f,0x63,0x61,0x6c,
+    0x5f,0x70,0x78,0x20,0x2f,0x20,0x5f,0x31,0x34,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x31,0x37,0x36,0x20,0x3d,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x28,0x5f,0x31,0x33,0x38,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x31,0x39,0x37,
+    0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x64,0x6f,0x74,0x28,0x5f,0x34,
+    0x30,0x2e,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x30,0x2c,
+    0x20,0x5f,0x31,0x37,0x36,0x29,0x2c,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x30,0x2e,
+    0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x31,0x2c,0x20,0x5f,
+    0x31,0x37,0x36,0x29,0x2c,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x30,0x2e,0x76,0x69,
+    0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x32,0x2c,0x20,0x5f,0x31,0x37,
+    0x36,0x29,0x2c,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x30,0x2e,0x76,0x69,0x65,0x77,
+    0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x33,0x2c,0x20,0x5f,0x31,0x37,0x36,0x29,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,0x30,
+    0x35,0x20,0x3d,0x20,0x28,0x30,0x2e,0x35,0x20,0x2a,0x20,0x66,0x61,0x73,0x74,0x3a,
+    0x3a,0x6d,0x61,0x78,0x28,0x5f,0x31,0x36,0x36,0x2e,0x78,0x2c,0x20,0x5f,0x31,0x36,
+    0x36,0x2e,0x79,0x29,0x29,0x20,0x2a,0x20,0x5f,0x31,0x37,0x31,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x32,0x30,0x39,0x20,0x3d,0x20,
+    0x5f,0x31,0x39,0x37,0x2e,0x78,0x79,0x20,0x2f,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
+    0x28,0x5f,0x31,0x39,0x37,0x2e,0x77,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,
+    0x20,0x28,0x28,0x61,0x62,0x73,0x28,0x5f,0x32,0x30,0x39,0x2e,0x78,0x29,0x20,0x3e,
+    0x20,0x28,0x31,0x2e,0x30,0x20,0x2b,0x20,0x28,0x28,0x32,0x2e,0x30,0x20,0x2a,0x20,
+    0x5f,0x32,0x30,0x35,0x29,0x20,0x2f,0x20,0x5f,0x34,0x30,0x2e,0x76,0x69,0x65,0x77,
+    0x70,0x6f,0x72,0x74,0x5f,0x77,0x69,0x64,0x74,0x68,0x29,0x29,0x29,0x20,0x7c,0x7c,
+    0x20,0x28,0x61,0x62,0x73,0x28,0x5f,0x32,0x30,0x39,0x2e,0x79,0x29,0x20,0x3e,0x20,
+    0x28,0x31,0x2e,0x30,0x20,0x2b,0x20,0x28,0x28,0x32,0x2e,0x30,0x20,0x2a,0x20,0x5f,
+    0x32,0x30,0x35,0x29,0x20,0x2f,0x20,0x5f,0x34,0x30,0x2e,0x76,0x69,0x65,0x77,0x70,
+    0x6f,0x72,0x74,0x5f,0x68,0x65,0x69,0x67,0x68,0x74,0x29,0x29,0x29,0x29,0x0a,0x20,
+    0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,
+    0x75,0x72,0x6e,0x20,0x30,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,0x33,0x35,0x20,0x3d,0x20,0x28,
+    0x28,0x28,0x28,0x5f,0x31,0x36,0x36,0x2e,0x78,0x20,0x2a,0x20,0x5f,0x31,0x36,0x36,
+    0x2e,0x79,0x29,0x20,0x2a,0x20,0x5f,0x31,0x37,0x31,0x29,0x20,0x2a,0x20,0x5f,0x31,
+    0x37,0x31,0x29,0x20,0x2a,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x5f,0x38,0x34,0x29,
+    0x29,0x20,0x2a,0x20,0x30,0x2e,0x30,0x30,0x33,0x39,0x32,0x31,0x35,0x36,0x38,0x38,
+    0x35,0x39,0x33,0x36,0x38,0x35,0x36,0x32,0x36,0x39,0x38,0x33,0x36,0x34,0x32,0x35,
+    0x37,0x38,0x31,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x21,
+    0x28,0x5f,0x32,0x33,0x35,0x20,0x3e,0x20,0x30,0x2e,0x30,0x29,0x29,0x0a,0x20,0x20,
+    0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+    0x72,0x6e,0x20,0x30,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
+    0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x75,0x69,0x6e,0x74,0x28,0x66,0x61,0x73,
+    0x74,0x3a,0x3a,0x63,0x6c,0x61,0x6d,0x70,0x28,0x28,0x28,0x6c,0x6f,0x67,0x32,0x28,
+    0x5f,0x32,0x33,0x35,0x29,0x20,0x2b,0x20,0x31,0x36,0x2e,0x30,0x29,0x20,0x2a,0x20,
+    0x32,0x35,0x2e,0x35,0x37,0x35,0x30,0x30,0x30,0x37,0x36,0x32,0x39,0x33,0x39,0x34,
+    0x35,0x33,0x31,0x32,0x35,0x29,0x20,0x2b,0x20,0x31,0x2e,0x30,0x2c,0x20,0x31,0x2e,
+    0x30,0x2c,0x20,0x31,0x30,0x32,0x33,0x2e,0x30,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,
+    0x6b,0x65,0x72,0x6e,0x65,0x6c,0x20,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,
+    0x30,0x28,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x73,0x65,0x6c,0x65,0x63,
+    0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x26,0x20,0x5f,0x34,0x30,0x20,0x5b,0x5b,
+    0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x30,0x29,0x5d,0x5d,0x2c,0x20,0x63,0x6f,0x6e,
+    0x73,0x74,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,
+    0x62,0x75,0x66,0x66,0x65,0x72,0x26,0x20,0x5f,0x32,0x35,0x20,0x5b,0x5b,0x62,0x75,
+    0x66,0x66,0x65,0x72,0x28,0x31,0x31,0x29,0x5d,0x5d,0x2c,0x20,0x63,0x6f,0x6e,0x73,
+    0x74,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,
+    0x74,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x26,0x20,0x5f,0x32,0x35,0x30,0x20,0x5b,
+    0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x38,0x29,0x5d,0x5d,0x2c,0x20,0x64,0x65,
+    0x76,0x69,0x63,0x65,0x20,0x62,0x69,0x6e,0x5f,0x62,0x75,0x66,0x66,0x65,0x72,0x26,
+    0x20,0x5f,0x32,0x36,0x32,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x39,
+    0x29,0x5d,0x5d,0x2c,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x73,0x65,0x6c,0x65,
+    0x63,0x74,0x5f,0x73,0x74,0x61,0x74,0x65,0x26,0x20,0x5f,0x32,0x37,0x30,0x20,0x5b,
+    0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x31,0x30,0x29,0x5d,0x5d,0x2c,0x20,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,
+    0x63,0x68,0x75,0x6e,0x6b,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x20,0x5b,0x5b,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x30,0x29,0x5d,0x5d,0x2c,0x20,0x73,0x61,
+    0x6d,0x70,0x6c,0x65,0x72,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x73,0x61,0x6d,0x70,
+    0x6c,0x65,0x72,0x20,0x5b,0x5b,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x28,0x32,0x29,
+    0x5d,0x5d,0x2c,0x20,0x75,0x69,0x6e,0x74,0x33,0x20,0x67,0x6c,0x5f,0x47,0x6c,0x6f,
+    0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x20,
+    0x5b,0x5b,0x74,0x68,0x72,0x65,0x61,0x64,0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,
+    0x6e,0x5f,0x69,0x6e,0x5f,0x67,0x72,0x69,0x64,0x5d,0x5d,0x29,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x6e,0x74,0x28,0x67,0x6c,0x5f,0x47,0x6c,
+    0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,
+    0x2e,0x78,0x29,0x20,0x3e,0x3d,0x20,0x5f,0x34,0x30,0x2e,0x63,0x61,0x6e,0x64,0x69,
+    0x64,0x61,0x74,0x65,0x5f,0x63,0x6f,0x75,0x6e,0x74,0x29,0x0a,0x20,0x20,0x20,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,
+    0x20,0x5f,0x32,0x36,0x35,0x20,0x3d,0x20,0x28,0x5f,0x34,0x30,0x2e,0x75,0x73,0x65,
+    0x5f,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x73,0x20,0x21,0x3d,0x20,0x30,
+    0x29,0x20,0x3f,0x20,0x5f,0x32,0x35,0x30,0x2e,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,
+    0x74,0x65,0x73,0x5b,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,
+    0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x5d,0x2e,0x76,0x61,0x6c,
+    0x75,0x65,0x20,0x3a,0x20,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,
+    0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,
+    0x20,0x5f,0x32,0x36,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,
+    0x5f,0x32,0x36,0x38,0x20,0x3d,0x20,0x73,0x63,0x6f,0x72,0x65,0x5f,0x62,0x69,0x6e,
+    0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x2c,0x20,0x5f,0x32,0x35,0x2c,0x20,0x5f,
+    0x34,0x30,0x2c,0x20,0x63,0x68,0x75,0x6e,0x6b,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,
+    0x65,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x5f,0x32,0x36,0x32,0x2e,0x62,0x69,0x6e,
+    0x73,0x5b,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,
+    0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,
+    0x20,0x3d,0x20,0x5f,0x32,0x36,0x38,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,
+    0x74,0x20,0x5f,0x32,0x37,0x35,0x20,0x3d,0x20,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,
+    0x66,0x65,0x74,0x63,0x68,0x5f,0x61,0x64,0x64,0x5f,0x65,0x78,0x70,0x6c,0x69,0x63,
+    0x69,0x74,0x28,0x28,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x61,0x74,0x6f,0x6d,0x69,
+    0x63,0x5f,0x75,0x69,0x6e,0x74,0x2a,0x29,0x26,0x5f,0x32,0x37,0x30,0x2e,0x73,0x74,
+    0x61,0x74,0x65,0x5b,0x5f,0x32,0x36,0x38,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x2c,
+    0x20,0x31,0x75,0x2c,0x20,0x6d,0x65,0x6d,0x6f,0x72,0x79,0x5f,0x6f,0x72,0x64,0x65,
+    0x72,0x5f,0x72,0x65,0x6c,0x61,0x78,0x65,0x64,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+
+};
+/*
+    #include <metal_stdlib>
+    #include <simd/simd.h>
+
+    using namespace metal;
+
+    struct select_params
+    {
+        float4 viewProj_row0;
+        float4 viewProj_row1;
+        float4 viewProj_row2;
+        float4 viewProj_row3;
+        packed_float3 camera_position;
+        float focal_px;
+        packed_float3 camera_forward;
+        float viewport_width;
+        float viewport_height;
+        int candidate_count;
+        int use_candidates;
+        int budget;
+        int texture_width;
+        int splats_per_layer;
+    };
+
+    struct SelectValue
+    {
+        uint value;
+    };
+
+    struct select_state
+    {
+        SelectValue state[1];
+    };
+
+    constant uint3 gl_WorkGroupSize [[maybe_unused]] = uint3(1u, 1u, 1u);
+
+    kernel void main0(constant select_params& _40 [[buffer(0)]], device select_state& _35 [[buffer(8)]])
+    {
+        uint remaining = uint(_40.budget);
+        uint threshold_bin = 0u;
+        bool found = false;
+        for (int b = 1023; b >= 0; b--)
+        {
+            uint _48 = _35.state[b].value;
+            _35.state[b].value = 0u;
+            if (found)
+            {
+                continue;
+            }
+            if (_48 >= remaining)
+            {
+                threshold_bin = uint(b);
+                found = true;
+            }
+            else
+            {
+                remaining -= _48;
+            }
+        }
+        _35.state[1024].value = threshold_bin;
+        _35.state[1025].value = remaining;
+        _35.state[1026].value = 0u;
+        _35.state[1027].value = 0u;
+    }
+
+*/
+static const uint8_t find_threshold_source_metal_ios[1325] = {
+    0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,
+    0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+    0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,
+    0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,
+    0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x73,
+    0x65,0x6c,0x65,0x63,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x69,0x65,0x77,0x50,0x72,
+    0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x20,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,
+    0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x69,
+    0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x32,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,
+    0x5f,0x72,0x6f,0x77,0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,0x70,0x61,0x63,0x6b,0x65,
+    0x64,0x5f,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,
+    0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x66,0x6f,0x63,0x61,0x6c,0x5f,0x70,0x78,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x70,0x61,0x63,0x6b,0x65,0x64,0x5f,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,
+    0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x66,0x6f,0x72,0x77,0x61,0x72,0x64,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x69,0x65,0x77,0x70,0x6f,
+    0x72,0x74,0x5f,0x77,0x69,0x64,0x74,0x68,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x76,0x69,0x65,0x77,0x70,0x6f,0x72,0x74,0x5f,0x68,0x65,0x69,
+    0x67,0x68,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x63,0x61,0x6e,
+    0x64,0x69,0x64,0x61,0x74,0x65,0x5f,0x63,0x6f,0x75,0x6e,0x74,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x6e,0x74,0x20,0x75,0x73,0x65,0x5f,0x63,0x61,0x6e,0x64,0x69,0x64,
+    0x61,0x74,0x65,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x62,0x75,
+    0x64,0x67,0x65,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x74,0x65,
+    0x78,0x74,0x75,0x72,0x65,0x5f,0x77,0x69,0x64,0x74,0x68,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x69,0x6e,0x74,0x20,0x73,0x70,0x6c,0x61,0x74,0x73,0x5f,0x70,0x65,0x72,0x5f,
+    0x6c,0x61,0x79,0x65,0x72,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,
+    0x74,0x20,0x53,0x65,0x6c,0x65,0x63,0x74,0x56,0x61,0x6c,0x75,0x65,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,
+    0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x73,0x65,0x6c,0x65,0x63,
+    0x74,0x5f,0x73,0x74,0x61,0x74,0x65,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x53,0x65,
+    0x6c,0x65,0x63,0x74,0x56,0x61,0x6c,0x75,0x65,0x20,0x73,0x74,0x61,0x74,0x65,0x5b,
+    0x31,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,
+    0x20,0x75,0x69,0x6e,0x74,0x33,0x20,0x67,0x6c,0x5f,0x57,0x6f,0x72,0x6b,0x47,0x72,
+    0x6f,0x75,0x70,0x53,0x69,0x7a,0x65,0x20,0x5b,0x5b,0x6d,0x61,0x79,0x62,0x65,0x5f,
+    0x75,0x6e,0x75,0x73,0x65,0x64,0x5d,0x5d,0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,0x33,
+    0x28,0x31,0x75,0x2c,0x20,0x31,0x75,0x2c,0x20,0x31,0x75,0x29,0x3b,0x0a,0x0a,0x6b,
+    0x65,0x72,0x6e,0x65,0x6c,0x20,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x30,
+    0x28,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x73,0x65,0x6c,0x65,0x63,0x74,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x26,0x20,0x5f,0x34,0x30,0x20,0x5b,0x5b,0x62,
+    0x75,0x66,0x66,0x65,0x72,0x28,0x30,0x29,0x5d,0x5d,0x2c,0x20,0x64,0x65,0x76,0x69,
+    0x63,0x65,0x20,0x73,0x65,0x6c,0x65,0x63,0x74,0x5f,0x73,0x74,0x61,0x74,0x65,0x26,
+    0x20,0x5f,0x33,0x35,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x38,0x29,
+    0x5d,0x5d,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x72,
+    0x65,0x6d,0x61,0x69,0x6e,0x69,0x6e,0x67,0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,0x28,
+    0x5f,0x34,0x30,0x2e,0x62,0x75,0x64,0x67,0x65,0x74,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x75,0x69,0x6e,0x74,0x20,0x74,0x68,0x72,0x65,0x73,0x68,0x6f,0x6c,0x64,0x5f,
+    0x62,0x69,0x6e,0x20,0x3d,0x20,0x30,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,
+    0x6f,0x6c,0x20,0x66,0x6f,0x75,0x6e,0x64,0x20,0x3d,0x20,0x66,0x61,0x6c,0x73,0x65,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x62,
+    0x20,0x3d,0x20,0x31,0x30,0x32,0x33,0x3b,0x20,0x62,0x20,0x3e,0x3d,0x20,0x30,0x3b,
+    0x20,0x62,0x2d,0x2d,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,0x34,0x38,0x20,0x3d,0x20,0x5f,
+    0x33,0x35,0x2e,0x73,0x74,0x61,0x74,0x65,0x5b,0x62,0x5d,0x2e,0x76,0x61,0x6c,0x75,
+    0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x33,0x35,0x2e,0x73,
+    0x74,0x61,0x74,0x65,0x5b,0x62,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,
+    0x30,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,
+    0x66,0x6f,0x75,0x6e,0x64,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6f,0x6e,
+    0x74,0x69,0x6e,0x75,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x34,0x38,
+    0x20,0x3e,0x3d,0x20,0x72,0x65,0x6d,0x61,0x69,0x6e,0x69,0x6e,0x67,0x29,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x72,0x65,0x73,0x68,0x6f,0x6c,0x64,0x5f,0x62,
+    0x69,0x6e,0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,0x28,0x62,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6f,0x75,0x6e,0x64,0x20,
+    0x3d,0x20,0x74,0x72,0x75,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x6d,0x61,0x69,0x6e,0x69,0x6e,0x67,0x20,0x2d,
+    0x3d,0x20,0x5f,0x34,0x38,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,
+    0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x5f,0x33,0x35,0x2e,0x73,
+    0x74,0x61,0x74,0x65,0x5b,0x31,0x30,0x32,0x34,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,
+    0x20,0x3d,0x20,0x74,0x68,0x72,0x65,0x73,0x68,0x6f,0x6c,0x64,0x5f,0x62,0x69,0x6e,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x5f,0x33,0x35,0x2e,0x73,0x74,0x61,0x74,0x65,0x5b,
+    0x31,0x30,0x32,0x35,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x72,0x65,
+    0x6d,0x61,0x69,0x6e,0x69,0x6e,0x67,0x3b,0x0a,0x20,0x20,0x20,0x20,0x5f,0x33,0x35,
+    0x2e,0x73,0x74,0x61,0x74,0x65,0x5b,0x31,0x30,0x32,0x36,0x5d,0x2e,0x76,0x61,0x6c,
+    0x75,0x65,0x20,0x3d,0x20,0x30,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x5f,0x33,0x35,
+    0x2e,0x73,0x74,0x61,0x74,0x65,0x5b,0x31,0x30,0x32,0x37,0x5d,0x2e,0x76,0x61,0x6c,
+    0x75,0x65,0x20,0x3d,0x20,0x30,0x75,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #include <metal_stdlib>
+    #include <simd/simd.h>
+    #include <metal_atomic>
+
+    using namespace metal;
+
+    struct select_params
+    {
+        float4 viewProj_row0;
+        float4 viewProj_row1;
+        float4 viewProj_row2;
+        float4 viewProj_row3;
+        packed_float3 camera_position;
+        float focal_px;
+        packed_float3 camera_forward;
+        float viewport_width;
+        float viewport_height;
+        int candidate_count;
+        int use_candidates;
+        int budget;
+        int texture_width;
+        int splats_per_layer;
+    };
+
+    struct SelectValue
+    {
+        uint value;
+    };
+
+    struct candidate_input
+    {
+        SelectValue candidates[1];
+    };
+
+    struct bin_buffer
+    {
+        SelectValue bins[1];
+    };
+
+    struct select_state
+    {
+        SelectValue state[1];
+    };
+
+    struct selected_output
+    {
+        SelectValue selected[1];
+    };
+
+    constant uint3 gl_WorkGroupSize [[maybe_unused]] = uint3(256u, 1u, 1u);
+
+    kernel void main0(constant select_params& _40 [[buffer(0)]], const device candidate_input& _250 [[buffer(8)]], device bin_buffer& _262 [[buffer(9)]], device select_state& _270 [[buffer(10)]], device selected_output& _290 [[buffer(11)]], uint3 gl_GlobalInvocationID [[thread_position_in_grid]])
+    {
+        if (int(gl_GlobalInvocationID.x) >= _40.candidate_count)
+        {
+            return;
+        }
+        uint _41 = _262.bins[gl_GlobalInvocationID.x].value;
+        uint _49 = _270.state[1024].value;
+        bool keep = _41 > _49;
+        if (_41 == _49)
+        {
+            uint _64 = atomic_fetch_add_explicit((device atomic_uint*)&_270.state[1027].value, 1u, memory_order_relaxed);
+            keep = _64 < _270.state[1025].value;
+        }
+        if (keep)
+        {
+            uint _77 = atomic_fetch_add_explicit((device atomic_uint*)&_270.state[1026].value, 1u, memory_order_relaxed);
+            _290.selected[_77].value = (_40.use_candidates != 0) ? _250.candidates[gl_GlobalInvocationID.x].value : gl_GlobalInvocationID.x;
+        }
+    }
+
+*/
+static const uint8_t compact_selected_source_metal_ios[1804] = {
+    0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,
+    0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+    0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x23,
+    0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,0x61,
+    0x74,0x6f,0x6d,0x69,0x63,0x3e,0x0a,0x0a,0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,0x61,
+    0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,0x0a,
+    0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x73,0x65,0x6c,0x65,0x63,0x74,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x20,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x30,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x69,0x65,0x77,
+    0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,
+    0x6f,0x77,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x33,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x70,0x61,0x63,0x6b,0x65,0x64,0x5f,0x66,0x6c,0x6f,0x61,0x74,0x33,
+    0x20,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x66,0x6f,0x63,0x61,
+    0x6c,0x5f,0x70,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x70,0x61,0x63,0x6b,0x65,0x64,
+    0x5f,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x66,
+    0x6f,0x72,0x77,0x61,0x72,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x76,0x69,0x65,0x77,0x70,0x6f,0x72,0x74,0x5f,0x77,0x69,0x64,0x74,0x68,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x69,0x65,0x77,
+    0x70,0x6f,0x72,0x74,0x5f,0x68,0x65,0x69,0x67,0x68,0x74,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x69,0x6e,0x74,0x20,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x5f,0x63,
+    0x6f,0x75,0x6e,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x75,0x73,
+    0x65,0x5f,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x73,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x6e,0x74,0x20,0x62,0x75,0x64,0x67,0x65,0x74,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x6e,0x74,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x77,0x69,
+    0x64,0x74,0x68,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x73,0x70,0x6c,
+    0x61,0x74,0x73,0x5f,0x70,0x65,0x72,0x5f,0x6c,0x61,0x79,0x65,0x72,0x3b,0x0a,0x7d,
+    0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x65,0x6c,0x65,0x63,0x74,
+    0x56,0x61,0x6c,0x75,0x65,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,
+    0x20,0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,
+    0x63,0x74,0x20,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x5f,0x69,0x6e,0x70,
+    0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x53,0x65,0x6c,0x65,0x63,0x74,0x56,
+    0x61,0x6c,0x75,0x65,0x20,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x73,0x5b,
+    0x31,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x62,
+    0x69,0x6e,0x5f,0x62,0x75,0x66,0x66,0x65,0x72,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x53,0x65,0x6c,0x65,0x63,0x74,0x56,0x61,0x6c,0x75,0x65,0x20,0x62,0x69,0x6e,0x73,
+    0x5b,0x31,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,
+    0x73,0x65,0x6c,0x65,0x63,0x74,0x5f,0x73,0x74,0x61,0x74,0x65,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x53,0x65,0x6c,0x65,0x63,0x74,0x56,0x61,0x6c,0x75,0x65,0x20,0x73,
+    0x74,0x61,0x74,0x65,0x5b,0x31,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,
+    0x75,0x63,0x74,0x20,0x73,0x65,0x6c,0x65,0x63,0x74,0x65,0x64,0x5f,0x6f,0x75,0x74,
+    0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x53,0x65,0x6c,0x65,0x63,0x74,
+    0x56,0x61,0x6c,0x75,0x65,0x20,0x73,0x65,0x6c,0x65,0x63,0x74,0x65,0x64,0x5b,0x31,
+    0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,
+    0x75,0x69,0x6e,0x74,0x33,0x20,0x67,0x6c,0x5f,0x57,0x6f,0x72,0x6b,0x47,0x72,0x6f,
+    0x75,0x70,0x53,0x69,0x7a,0x65,0x20,0x5b,0x5b,0x6d,0x61,0x79,0x62,0x65,0x5f,0x75,
+    0x6e,0x75,0x73,0x65,0x64,0x5d,0x5d,0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,0x33,0x28,
+    0x32,0x35,0x36,0x75,0x2c,0x20,0x31,0x75,0x2c,0x20,0x31,0x75,0x29,0x3b,0x0a,0x0a,
+    0x6b,0x65,0x72,0x6e,0x65,0x6c,0x20,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,
+    0x30,0x28,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x73,0x65,0x6c,0x65,0x63,
+    0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x26,0x20,0x5f,0x34,0x30,0x20,0x5b,0x5b,
+    0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x30,0x29,0x5d,0x5d,0x2c,0x20,0x63,0x6f,0x6e,
+    0x73,0x74,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x63,0x61,0x6e,0x64,0x69,0x64,
+    0x61,0x74,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x26,0x20,0x5f,0x32,0x35,0x30,0x20,
+    0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x38,0x29,0x5d,0x5d,0x2c,0x20,0x64,
+    0x65,0x76,0x69,0x63,0x65,0x20,0x62,0x69,0x6e,0x5f,0x62,0x75,0x66,0x66,0x65,0x72,
+    0x26,0x20,0x5f,0x32,0x36,0x32,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,
+    0x39,0x29,0x5d,0x5d,0x2c,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x73,0x65,0x6c,
+    0x65,0x63,0x74,0x5f,0x73,0x74,0x61,0x74,0x65,0x26,0x20,0x5f,0x32,0x37,0x30,0x20,
+    0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x31,0x30,0x29,0x5d,0x5d,0x2c,0x20,
+    0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x73,0x65,0x6c,0x65,0x63,0x74,0x65,0x64,0x5f,
+    0x6f,0x75,0x74,0x70,0x75,0x74,0x26,0x20,0x5f,0x32,0x39,0x30,0x20,0x5b,0x5b,0x62,
+    0x75,0x66,0x66,0x65,0x72,0x28,0x31,0x31,0x29,0x5d,0x5d,0x2c,0x20,0x75,0x69,0x6e,
+    0x74,0x33,0x20,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,
+    0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x20,0x5b,0x5b,0x74,0x68,0x72,0x65,0x61,
+    0x64,0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x69,0x6e,0x5f,0x67,0x72,
+    0x69,0x64,0x5d,0x5d,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,
+    0x69,0x6e,0x74,0x28,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,
+    0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x29,0x20,0x3e,0x3d,0x20,
+    0x5f,0x34,0x30,0x2e,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x5f,0x63,0x6f,
+    0x75,0x6e,0x74,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,
+    0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,0x34,0x31,0x20,0x3d,0x20,
+    0x5f,0x32,0x36,0x32,0x2e,0x62,0x69,0x6e,0x73,0x5b,0x67,0x6c,0x5f,0x47,0x6c,0x6f,
+    0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,
+    0x78,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,
+    0x6e,0x74,0x20,0x5f,0x34,0x39,0x20,0x3d,0x20,0x5f,0x32,0x37,0x30,0x2e,0x73,0x74,
+    0x61,0x74,0x65,0x5b,0x31,0x30,0x32,0x34,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x6b,0x65,0x65,0x70,0x20,0x3d,
+    0x20,0x5f,0x34,0x31,0x20,0x3e,0x20,0x5f,0x34,0x39,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x69,0x66,0x20,0x28,0x5f,0x34,0x31,0x20,0x3d,0x3d,0x20,0x5f,0x34,0x39,0x29,0x0a,
+    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x75,0x69,
+    0x6e,0x74,0x20,0x5f,0x36,0x34,0x20,0x3d,0x20,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,
+    0x66,0x65,0x74,0x63,0x68,0x5f,0x61,0x64,0x64,0x5f,0x65,0x78,0x70,0x6c,0x69,0x63,
+    0x69,0x74,0x28,0x28,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x61,0x74,0x6f,0x6d,0x69,
+    0x63,0x5f,0x75,0x69,0x6e,0x74,0x2a,0x29,0x26,0x5f,0x32,0x37,0x30,0x2e,0x73,0x74,
+    0x61,0x74,0x65,0x5b,0x31,0x30,0x32,0x37,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x2c,
+    0x20,0x31,0x75,0x2c,0x20,0x6d,0x65,0x6d,0x6f,0x72,0x79,0x5f,0x6f,0x72,0x64,0x65,
+    0x72,0x5f,0x72,0x65,0x6c,0x61,0x78,0x65,0x64,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x6b,0x65,0x65,0x70,0x20,0x3d,0x20,0x5f,0x36,0x34,0x20,0x3c,
+    0x20,0x5f,0x32,0x37,0x30,0x2e,0x73,0x74,0x61,0x74,0x65,0x5b,0x31,0x30,0x32,0x35,
+    0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,
+    0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x6b,0x65,0x65,0x70,0x29,0x0a,0x20,0x20,0x20,
+    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,
+    0x5f,0x37,0x37,0x20,0x3d,0x20,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x66,0x65,0x74,
+    0x63,0x68,0x5f,0x61,0x64,0x64,0x5f,0x65,0x78,0x70,0x6c,0x69,0x63,0x69,0x74,0x28,
+    0x28,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x75,
+    0x69,0x6e,0x74,0x2a,0x29,0x26,0x5f,0x32,0x37,0x30,0x2e,0x73,0x74,0x61,0x74,0x65,
+    0x5b,0x31,0x30,0x32,0x36,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x2c,0x20,0x31,0x75,
+    0x2c,0x20,0x6d,0x65,0x6d,0x6f,0x72,0x79,0x5f,0x6f,0x72,0x64,0x65,0x72,0x5f,0x72,
+    0x65,0x6c,0x61,0x78,0x65,0x64,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x5f,0x32,0x39,0x30,0x2e,0x73,0x65,0x6c,0x65,0x63,0x74,0x65,0x64,0x5b,0x5f,
+    0x37,0x37,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x28,0x5f,0x34,0x30,
+    0x2e,0x75,0x73,0x65,0x5f,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x73,0x20,
+    0x21,0x3d,0x20,0x30,0x29,0x20,0x3f,0x20,0x5f,0x32,0x35,0x30,0x2e,0x63,0x61,0x6e,
+    0x64,0x69,0x64,0x61,0x74,0x65,0x73,0x5b,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,
+    0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x5d,
+    0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3a,0x20,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,
+    0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #pragma clang diagnostic ignored "-Wmissing-prototypes"
+
+    #include <metal_stdlib>
+    #include <simd/simd.h>
+    #include <metal_atomic>
+
+    using namespace metal;
+
+    struct select_params
+    {
+        float4 viewProj_row0;
+        float4 viewProj_row1;
+        float4 viewProj_row2;
+        float4 viewProj_row3;
+        packed_float3 camera_position;
+        float focal_px;
+        packed_float3 camera_forward;
+        float viewport_width;
+        float viewport_height;
+        int candidate_count;
+        int use_candidates;
+        int budget;
+        int texture_width;
+        int splats_per_layer;
+    };
+
+    struct SelectValue
+    {
+        uint value;
+    };
+
+    struct candidate_input
+    {
+        SelectValue candidates[1];
+    };
+
+    struct bin_buffer
+    {
+        SelectValue bins[1];
+    };
+
+    struct select_state
+    {
+        SelectValue state[1];
+    };
+
+    constant uint3 gl_WorkGroupSize [[maybe_unused]] = uint3(256u, 1u, 1u);
+
+    static inline __attribute__((always_inline))
+    uint4 fetch_splat(thread const uint& splat_idx, constant select_params& _40, texture2d_array<uint> splat_texture, sampler splat_sampler)
+    {
+        int _31 = int(splat_idx) / _40.splats_per_layer;
+        int _37 = int(splat_idx) - (_31 * _40.splats_per_layer);
+        int3 _52 = int3(_37 % _40.texture_width, _37 / _40.texture_width, _31);
+        return splat_texture.read(uint2(_52.xy), uint(_52.z), 0);
+    }
+
+    static inline __attribute__((always_inline))
+    uint score_bin(thread const uint& splat_idx, texture2d_array<uint> splat_texture, sampler splat_sampler, constant select_params& _40, texture2d<float> chunk_texture)
+    {
+        uint param = splat_idx;
+        uint4 _80 = fetch_splat(param, _40, splat_texture, splat_sampler);
+        uint _84 = _80.w & 255u;
+        if (_84 < 3u)
+        {
+            return 0u;
+        }
+        int _112 = int(splat_idx) / 256;
+        int2 _120 = int2((_112 % 1024) * 2, _112 / 1024);
+        float3 _128 = chunk_texture.read(uint2(_120), 0).xyz;
+        float3 _138 = _128 + ((float3(float((_80.x >> 16u) & 65535u), float(_80.x & 65535u), float((_80.y >> 16u) & 65535u)) * 1.525902189314365386962890625e-05) * (chunk_texture.read(uint2(_120 + int2(1, 0)), 0).xyz - _128));
+        float _146 = dot(_138 - float3(_40.camera_position), float3(_40.camera_forward));
+        if (_146 < 0.001000000047497451305389404296875)
+        {
+            return 0u;
+        }
+        float2 _166 = exp((float2(float((_80.z >> 16u) & 255u), float((_80.z >> 8u) & 255u)) * 0.0392156876623630523681640625) - float2(5.0));
+        float _171 = _40.focal_px / _146;
+        float4 _176 = float4(_138, 1.0);
+        float4 _197 = float4(dot(_40.viewProj_row0, _176), dot(_40.viewProj_row1, _176), dot(_40.viewProj_row2, _176), dot(_40.viewProj_row3, _176));
+        float _205 = (0.5 * fast::max(_166.x, _166.y)) * _171;
+        float2 _209 = _197.xy / float2(_197.w);
+        if ((abs(_209.x) > (1.0 + ((2.0 * _205) / _40.viewport_width))) || (abs(_209.y) > (1.0 + ((2.0 * _205) / _40.viewport_height))))
+        {
+            return 0u;
+        }
+        float _235 = ((((_166.x * _166.y) * _171) * _171) * float(_84)) * 0.0039215688593685626983642578125;
+        if (!(_235 > 0.0))
+        {
+            return 0u;
+        }
+        return uint(fast::clamp(((log2(_235) + 16.0) * 25.575000762939453125) + 1.0, 1.0, 1023.0));
+    }
+
+    kernel void main0(constant select_params& _40 [[buffer(0)]], const device candidate_input& _250 [[buffer(8)]], device bin_buffer& _262 [[buffer(9)]], device select_state& _270 [[buffer(10)]], texture2d_array<uint> splat_texture [[texture(0)]], texture2d<float> chunk_texture [[texture(1)]], sampler splat_sampler [[sampler(2)]], uint3 gl_GlobalInvocationID [[thread_position_in_grid]])
+    {
+        if (int(gl_GlobalInvocationID.x) >= _40.candidate_count)
+        {
+            return;
+        }
+        uint _265 = (_40.use_candidates != 0) ? _250.candidates[gl_GlobalInvocationID.x].value : gl_GlobalInvocationID.x;
+        uint param_1 = _265;
+        uint _268 = score_bin(param_1, splat_texture, splat_sampler, _40, chunk_texture);
+        _262.bins[gl_GlobalInvocationID.x].value = _268;
+        uint _275 = atomic_fetch_add_explicit((device atomic_uint*)&_270.state[_268].value, 1u, memory_order_relaxed);
+    }
+
+*/
+static const uint8_t score_bins_source_metal_sim[3948] = {
+    0x23,0x70,0x72,0x61,0x67,0x6d,0x61,0x20,0x63,0x6c,0x61,0x6e,0x67,0x20,0x64,0x69,
+    0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x20,0x69,0x67,0x6e,0x6f,0x72,0x65,0x64,
+    0x20,0x22,0x2d,0x57,0x6d,0x69,0x73,0x73,0x69,0x6e,0x67,0x2d,0x70,0x72,0x6f,0x74,
+    0x6f,0x74,0x79,0x70,0x65,0x73,0x22,0x0a,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,
+    0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,
+    0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,
+    0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+    0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,0x61,0x74,0x6f,0x6d,0x69,0x63,0x3e,0x0a,
+    0x0a,0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,
+    0x20,0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,
+    0x73,0x65,0x6c,0x65,0x63,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x69,0x65,0x77,0x50,
+    0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x20,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,
+    0x77,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,
+    0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x32,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,
+    0x6a,0x5f,0x72,0x6f,0x77,0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,0x70,0x61,0x63,0x6b,
+    0x65,0x64,0x5f,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x63,0x61,0x6d,0x65,0x72,0x61,
+    0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x66,0x6f,0x63,0x61,0x6c,0x5f,0x70,0x78,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x70,0x61,0x63,0x6b,0x65,0x64,0x5f,0x66,0x6c,0x6f,0x61,0x74,0x33,
+    0x20,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x66,0x6f,0x72,0x77,0x61,0x72,0x64,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x69,0x65,0x77,0x70,
+    0x6f,0x72,0x74,0x5f,0x77,0x69,0x64,0x74,0x68,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x76,0x69,0x65,0x77,0x70,0x6f,0x72,0x74,0x5f,0x68,0x65,
+    0x69,0x67,0x68,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x63,0x61,
+    0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x5f,0x63,0x6f,0x75,0x6e,0x74,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x75,0x73,0x65,0x5f,0x63,0x61,0x6e,0x64,0x69,
+    0x64,0x61,0x74,0x65,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x62,
+    0x75,0x64,0x67,0x65,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x77,0x69,0x64,0x74,0x68,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x6e,0x74,0x20,0x73,0x70,0x6c,0x61,0x74,0x73,0x5f,0x70,0x65,0x72,
+    0x5f,0x6c,0x61,0x79,0x65,0x72,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,
+    0x63,0x74,0x20,0x53,0x65,0x6c,0x65,0x63,0x74,0x56,0x61,0x6c,0x75,0x65,0x0a,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x76,0x61,0x6c,0x75,0x65,0x3b,
+    0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x63,0x61,0x6e,0x64,
+    0x69,0x64,0x61,0x74,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x53,0x65,0x6c,0x65,0x63,0x74,0x56,0x61,0x6c,0x75,0x65,0x20,0x63,0x61,
+    0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x73,0x5b,0x31,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,
+    0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x62,0x69,0x6e,0x5f,0x62,0x75,0x66,0x66,
+    0x65,0x72,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x53,0x65,0x6c,0x65,0x63,0x74,0x56,
+    0x61,0x6c,0x75,0x65,0x20,0x62,0x69,0x6e,0x73,0x5b,0x31,0x5d,0x3b,0x0a,0x7d,0x3b,
+    0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x73,0x65,0x6c,0x65,0x63,0x74,0x5f,
+    0x73,0x74,0x61,0x74,0x65,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x53,0x65,0x6c,0x65,
+    0x63,0x74,0x56,0x61,0x6c,0x75,0x65,0x20,0x73,0x74,0x61,0x74,0x65,0x5b,0x31,0x5d,
+    0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x75,
+    0x69,0x6e,0x74,0x33,0x20,0x67,0x6c,0x5f,0x57,0x6f,0x72,0x6b,0x47,0x72,0x6f,0x75,
+    0x70,0x53,0x69,0x7a,0x65,0x20,0x5b,0x5b,0x6d,0x61,0x79,0x62,0x65,0x5f,0x75,0x6e,
+    0x75,0x73,0x65,0x64,0x5d,0x5d,0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,0x33,0x28,0x32,
+    0x35,0x36,0x75,0x2c,0x20,0x31,0x75,0x2c,0x20,0x31,0x75,0x29,0x3b,0x0a,0x0a,0x73,
+    0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,
+    0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,
+    0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x75,0x69,0x6e,0x74,
+    0x34,0x20,0x66,0x65,0x74,0x63,0x68,0x5f,0x73,0x70,0x6c,0x61,0x74,0x28,0x74,0x68,
+    0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x75,0x69,0x6e,0x74,0x26,
+    0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x69,0x64,0x78,0x2c,0x20,0x63,0x6f,0x6e,0x73,
+    0x74,0x61,0x6e,0x74,0x20,0x73,0x65,0x6c,0x65,0x63,0x74,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x73,0x26,0x20,0x5f,0x34,0x30,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x32,0x64,0x5f,0x61,0x72,0x72,0x61,0x79,0x3c,0x75,0x69,0x6e,0x74,0x3e,0x20,0x73,
+    0x70,0x6c,0x61,0x74,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2c,0x20,0x73,0x61,
+    0x6d,0x70,0x6c,0x65,0x72,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x73,0x61,0x6d,0x70,
+    0x6c,0x65,0x72,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x5f,
+    0x33,0x31,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,0x73,0x70,0x6c,0x61,0x74,0x5f,0x69,
+    0x64,0x78,0x29,0x20,0x2f,0x20,0x5f,0x34,0x30,0x2e,0x73,0x70,0x6c,0x61,0x74,0x73,
+    0x5f,0x70,0x65,0x72,0x5f,0x6c,0x61,0x79,0x65,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x69,0x6e,0x74,0x20,0x5f,0x33,0x37,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,0x73,0x70,
+    0x6c,0x61,0x74,0x5f,0x69,0x64,0x78,0x29,0x20,0x2d,0x20,0x28,0x5f,0x33,0x31,0x20,
+    0x2a,0x20,0x5f,0x34,0x30,0x2e,0x73,0x70,0x6c,0x61,0x74,0x73,0x5f,0x70,0x65,0x72,
+    0x5f,0x6c,0x61,0x79,0x65,0x72,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,
+    0x33,0x20,0x5f,0x35,0x32,0x20,0x3d,0x20,0x69,0x6e,0x74,0x33,0x28,0x5f,0x33,0x37,
+    0x20,0x25,0x20,0x5f,0x34,0x30,0x2e,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x77,
+    0x69,0x64,0x74,0x68,0x2c,0x20,0x5f,0x33,0x37,0x20,0x2f,0x20,0x5f,0x34,0x30,0x2e,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x77,0x69,0x64,0x74,0x68,0x2c,0x20,0x5f,
+    0x33,0x31,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
+    0x73,0x70,0x6c,0x61,0x74,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x72,0x65,
+    0x61,0x64,0x28,0x75,0x69,0x6e,0x74,0x32,0x28,0x5f,0x35,0x32,0x2e,0x78,0x79,0x29,
+    0x2c,0x20,0x75,0x69,0x6e,0x74,0x28,0x5f,0x35,0x32,0x2e,0x7a,0x29,0x2c,0x20,0x30,
+    0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,
+    0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,
+    0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,
+    0x29,0x29,0x0a,0x75,0x69,0x6e,0x74,0x20,0x73,0x63,0x6f,0x72,0x65,0x5f,0x62,0x69,
+    0x6e,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x75,
+    0x69,0x6e,0x74,0x26,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x69,0x64,0x78,0x2c,0x20,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x5f,0x61,0x72,0x72,0x61,0x79,0x3c,
+    0x75,0x69,0x6e,0x74,0x3e,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x74,0x65,0x78,0x74,
+    0x75,0x72,0x65,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x73,0x70,0x6c,
+    0x61,0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x63,0x6f,0x6e,0x73,
+    0x74,0x61,0x6e,0x74,0x20,0x73,0x65,0x6c,0x65,0x63,0x74,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x73,0x26,0x20,0x5f,0x34,0x30,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x63,0x68,0x75,0x6e,0x6b,0x5f,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,
+    0x69,0x6e,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x73,0x70,0x6c,0x61,
+    0x74,0x5f,0x69,0x64,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x34,
+    0x20,0x5f,0x38,0x30,0x20,0x3d,0x20,0x66,0x65,0x74,0x63,0x68,0x5f,0x73,0x70,0x6c,
+    0x61,0x74,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x5f,0x34,0x30,0x2c,0x20,0x73,
+    0x70,0x6c,0x61,0x74,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2c,0x20,0x73,0x70,
+    0x6c,0x61,0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,0x38,0x34,0x20,0x3d,0x20,0x5f,0x38,0x30,
+    0x2e,0x77,0x20,0x26,0x20,0x32,0x35,0x35,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,
+    0x66,0x20,0x28,0x5f,0x38,0x34,0x20,0x3c,0x20,0x33,0x75,0x29,0x0a,0x20,0x20,0x20,
+    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,
+    0x6e,0x20,0x30,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
+    0x69,0x6e,0x74,0x20,0x5f,0x31,0x31,0x32,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,0x73,
+    0x70,0x6c,0x61,0x74,0x5f,0x69,0x64,0x78,0x29,0x20,0x2f,0x20,0x32,0x35,0x36,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x32,0x20,0x5f,0x31,0x32,0x30,0x20,0x3d,
+    0x20,0x69,0x6e,0x74,0x32,0x28,0x28,0x5f,0x31,0x31,0x32,0x20,0x25,0x20,0x31,0x30,
+    0x32,0x34,0x29,0x20,0x2a,0x20,0x32,0x2c,0x20,0x5f,0x31,0x31,0x32,0x20,0x2f,0x20,
+    0x31,0x30,0x32,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x33,0x20,0x5f,0x31,0x32,0x38,0x20,0x3d,0x20,0x63,0x68,0x75,0x6e,0x6b,0x5f,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x72,0x65,0x61,0x64,0x28,0x75,0x69,0x6e,0x74,
+    0x32,0x28,0x5f,0x31,0x32,0x30,0x29,0x2c,0x20,0x30,0x29,0x2e,0x78,0x79,0x7a,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x31,0x33,0x38,
+    0x20,0x3d,0x20,0x5f,0x31,0x32,0x38,0x20,0x2b,0x20,0x28,0x28,0x66,0x6c,0x6f,0x61,
+    0x74,0x33,0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x28,0x5f,0x38,0x30,0x2e,0x78,0x20,
+    0x3e,0x3e,0x20,0x31,0x36,0x75,0x29,0x20,0x26,0x20,0x36,0x35,0x35,0x33,0x35,0x75,
+    0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x5f,0x38,0x30,0x2e,0x78,0x20,0x26,
+    0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,
+    0x28,0x5f,0x38,0x30,0x2e,0x79,0x20,0x3e,0x3e,0x20,0x31,0x36,0x75,0x29,0x20,0x26,
+    0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x29,0x20,0x2a,0x20,0x31,0x2e,0x35,0x32,
+    0x35,0x39,0x30,0x32,0x31,0x38,0x39,0x33,0x31,0x34,0x33,0x36,0x35,0x33,0x38,0x36,
+    0x39,0x36,0x32,0x38,0x39,0x30,0x36,0x32,0x35,0x65,0x2d,0x30,0x35,0x29,0x20,0x2a,
+    0x20,0x28,0x63,0x68,0x75,0x6e,0x6b,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,
+    0x72,0x65,0x61,0x64,0x28,0x75,0x69,0x6e,0x74,0x32,0x28,0x5f,0x31,0x32,0x30,0x20,
+    0x2b,0x20,0x69,0x6e,0x74,0x32,0x28,0x31,0x2c,0x20,0x30,0x29,0x29,0x2c,0x20,0x30,
+    0x29,0x2e,0x78,0x79,0x7a,0x20,0x2d,0x20,0x5f,0x31,0x32,0x38,0x29,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,0x34,0x36,0x20,0x3d,
+    0x20,0x64,0x6f,0x74,0x28,0x5f,0x31,0x33,0x38,0x20,0x2d,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x33,0x28,0x5f,0x34,0x30,0x2e,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x70,0x6f,
+    0x73,0x69,0x74,0x69,0x6f,0x6e,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,
+    0x5f,0x34,0x30,0x2e,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x66,0x6f,0x72,0x77,0x61,
+    0x72,0x64,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x31,
+    0x34,0x36,0x20,0x3c,0x20,0x30,0x2e,0x30,0x30,0x31,0x30,0x30,0x30,0x30,0x30,0x30,
+    0x30,0x34,0x37,0x34,0x39,0x37,0x34,0x35,0x31,0x33,0x30,0x35,0x33,0x38,0x39,0x34,
+    0x30,0x34,0x32,0x39,0x36,0x38,0x37,0x35,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x30,
+    0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x20,0x5f,0x31,0x36,0x36,0x20,0x3d,0x20,0x65,0x78,0x70,0x28,0x28,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x28,0x5f,0x38,
+    0x30,0x2e,0x7a,0x20,0x3e,0x3e,0x20,0x31,0x36,0x75,0x29,0x20,0x26,0x20,0x32,0x35,
+    0x35,0x75,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x28,0x5f,0x38,0x30,0x2e,
+    0x7a,0x20,0x3e,0x3e,0x20,0x38,0x75,0x29,0x20,0x26,0x20,0x32,0x35,0x35,0x75,0x29,
+    0x29,0x20,0x2a,0x20,0x30,0x2e,0x30,0x33,0x39,0x32,0x31,0x35,0x36,0x38,0x37,0x36,
+    0x36,0x32,0x33,0x36,0x33,0x30,0x35,0x32,0x33,0x36,0x38,0x31,0x36,0x34,0x30,0x36,
+    0x32,0x35,0x29,0x20,0x2d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x35,0x2e,0x30,
+    0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,
+    0x37,0x31,0x20,0x3d,0x20,0x5f,0x34,0x30,0x2e,0x66,0x6f,0x63,0x61,0x6c,0x5f,0x70,
+    0x78,0x20,0x2f,0x20,0x5f,0x31,0x34,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x20,0x5f,0x31,0x37,0x36,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x34,0x28,0x5f,0x31,0x33,0x38,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x31,0x39,0x37,0x20,0x3d,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x64,0x6f,0x74,0x28,0x5f,0x34,0x30,0x2e,
+    0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x30,0x2c,0x20,0x5f,
+    0x31,0x37,0x36,0x29,0x2c,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x30,0x2e,0x76,0x69,
+    0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x31,0x2c,0x20,0x5f,0x31,0x37,
+    0x36,0x29,0x2c,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x30,0x2e,0x76,0x69,0x65,0x77,
+    0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x32,0x2c,0x20,0x5f,0x31,0x37,0x36,0x29,
+    0x2c,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x30,0x2e,0x76,0x69,0x65,0x77,0x50,0x72,
+    0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x33,0x2c,0x20,0x5f,0x31,0x37,0x36,0x29,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,0x30,0x35,0x20,
+    0x3d,0x20,0x28,0x30,0x2e,0x35,0x20,0x2a,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,0x6d,
+    0x61,0x78,0x28,0x5f,0x31,0x36,0x36,0x2e,0x78,0x2c,0x20,0x5f,0x31,0x36,0x36,0x2e,
+    0x79,0x29,0x29,0x20,0x2a,0x20,0x5f,0x31,0x37,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x32,0x30,0x39,0x20,0x3d,0x20,0x5f,0x31,
+    0x39,0x37,0x2e,0x78,0x79,0x20,0x2f,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x5f,
+    0x31,0x39,0x37,0x2e,0x77,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,
+    0x28,0x61,0x62,0x73,0x28,0x5f,0x32,0x30,0x39,0x2e,0x78,0x29,0x20,0x3e,0x20,0x28,
+    0x31,0x2e,0x30,0x20,0x2b,0x20,0x28,0x28,0x32,0x2e,0x30,0x20,0x2a,0x20,0x5f,0x32,
+    0x30,0x35,0x29,0x20,0x2f,0x20,0x5f,0x34,0x30,0x2e,0x76,0x69,0x65,0x77,0x70,0x6f,
+    0x72,0x74,0x5f,0x77,0x69,0x64,0x74,0x68,0x29,0x29,0x29,0x20,0x7c,0x7c,0x20,0x28,
+    0x61,0x62,0x73,0x28,0x5f,0x32,0x30,0x39,0x2e,0x79,0x29,0x20,0x3e,0x20,0x28,0x31,
+    0x2e,0x30,0x20,0x2b,0x20,0x28,0x28,0x32,0x2e,0x30,0x20,0x2a,0x20,0x5f,0x32,0x30,
+    0x35,0x29,0x20,0x2f,0x20,0x5f,0x34,0x30,0x2e,0x76,0x69,0x65,0x77,0x70,0x6f,0x72,
+    0x74,0x5f,0x68,0x65,0x69,0x67,0x68,0x74,0x29,0x29,0x29,0x29,0x0a,0x20,0x20,0x20,
+    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,
+    0x6e,0x20,0x30,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,0x33,0x35,0x20,0x3d,0x20,0x28,0x28,0x28,
+    0x28,0x5f,0x31,0x36,0x36,0x2e,0x78,0x20,0x2a,0x20,0x5f,0x31,0x36,0x36,0x2e,0x79,
+    0x29,0x20,0x2a,0x20,0x5f,0x31,0x37,0x31,0x29,0x20,0x2a,0x20,0x5f,0x31,0x37,0x31,
+    0x29,0x20,0x2a,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x5f,0x38,0x34,0x29,0x29,0x20,
+    0x2a,0x20,0x30,0x2e,0x30,0x30,0x33,0x39,0x32,0x31,0x35,0x36,0x38,0x38,0x35,0x39,
+    0x33,0x36,0x38,0x35,0x36,0x32,0x36,0x39,0x38,0x33,0x36,0x34,0x32,0x35,0x37,0x38,
+    0x31,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x21,0x28,0x5f,
+    0x32,0x33,0x35,0x20,0x3e,0x20,0x30,0x2e,0x30,0x29,0x29,0x0a,0x20,0x20,0x20,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x20,0x30,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,
+    0x65,0x74,0x75,0x72,0x6e,0x20,0x75,0x69,0x6e,0x74,0x28,0x66,0x61,0x73,0x74,0x3a,
+    0x3a,0x63,0x6c,0x61,0x6d,0x70,0x28,0x28,0x28,0x6c,0x6f,0x67,0x32,0x28,0x5f,0x32,
+    0x33,0x35,0x29,0x20,0x2b,0x20,0x31,0x36,0x2e,0x30,0x29,0x20,0x2a,0x20,0x32,0x35,
+    0x2e,0x35,0x37,0x35,0x30,0x30,0x30,0x37,0x36,0x32,0x39,0x33,0x39,0x34,0x35,0x33,
+    0x31,0x32,0x35,0x29,0x20,0x2b,0x20,0x31,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x2c,
+    0x20,0x31,0x30,0x32,0x33,0x2e,0x30,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x6b,0x65,
+    0x72,0x6e,0x65,0x6c,0x20,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x30,0x28,
+    0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x73,0x65,0x6c,0x65,0x63,0x74,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x26,0x20,0x5f,0x34,0x30,0x20,0x5b,0x5b,0x62,0x75,
+    0x66,0x66,0x65,0x72,0x28,0x30,0x29,0x5d,0x5d,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,
+    0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,
+    0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x26,0x20,0x5f,0x32,0x35,0x30,0x20,0x5b,0x5b,
+    0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x38,0x29,0x5d,0x5d,0x2c,0x20,0x64,0x65,0x76,
+    0x69,0x63,0x65,0x20,0x62,0x69,0x6e,0x5f,0x62,0x75,0x66,0x66,0x65,0x72,0x26,0x20,
+    0x5f,0x32,0x36,0x32,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x39,0x29,
+    0x5d,0x5d,0x2c,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x73,0x65,0x6c,0x65,0x63,
+    0x74,0x5f,0x73,0x74,0x61,0x74,0x65,0x26,0x20,0x5f,0x32,0x37,0x30,0x20,0x5b,0x5b,
+    0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x31,0x30,0x29,0x5d,0x5d,0x2c,0x20,0x74,0x65,
+    0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x5f,0x61,0x72,0x72,0x61,0x79,0x3c,0x75,0x69,
+    0x6e,0x74,0x3e,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,
+    0x65,0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x30,0x29,0x5d,0x5d,
+    0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,
+    0x74,0x3e,0x20,0x63,0x68,0x75,0x6e,0x6b,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x31,0x29,0x5d,0x5d,0x2c,
+    0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x73,
+    0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x5b,0x5b,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,
+    0x28,0x32,0x29,0x5d,0x5d,0x2c,0x20,0x75,0x69,0x6e,0x74,0x33,0x20,0x67,0x6c,0x5f,
+    0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,
+    0x49,0x44,0x20,0x5b,0x5b,0x74,0x68,0x72,0x65,0x61,0x64,0x5f,0x70,0x6f,0x73,0x69,
+    0x74,0x69,0x6f,0x6e,0x5f,0x69,0x6e,0x5f,0x67,0x72,0x69,0x64,0x5d,0x5d,0x29,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x6e,0x74,0x28,0x67,0x6c,
+    0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,
+    0x6e,0x49,0x44,0x2e,0x78,0x29,0x20,0x3e,0x3d,0x20,0x5f,0x34,0x30,0x2e,0x63,0x61,
+    0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x5f,0x63,0x6f,0x75,0x6e,0x74,0x29,0x0a,0x20,
+    0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,
+    0x75,0x72,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x75,
+    0x69,0x6e,0x74,0x20,0x5f,0x32,0x36,0x35,0x20,0x3d,0x20,0x28,0x5f,0x34,0x30,0x2e,
+    0x75,0x73,0x65,0x5f,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x73,0x20,0x21,
+    0x3d,0x20,0x30,0x29,0x20,0x3f,0x20,0x5f,0x32,0x35,0x30,0x2e,0x63,0x61,0x6e,0x64,
+    0x69,0x64,0x61,0x74,0x65,0x73,0x5b,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,
+    0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x5d,0x2e,
+    0x76,0x61,0x6c,0x75,0x65,0x20,0x3a,0x20,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,
+    0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x31,0x20,0x3d,0x20,0x5f,0x32,0x36,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,
+    0x6e,0x74,0x20,0x5f,0x32,0x36,0x38,0x20,0x3d,0x20,0x73,0x63,0x6f,0x72,0x65,0x5f,
+    0x62,0x69,0x6e,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x2c,0x20,0x73,0x70,0x6c,
+    0x61,0x74,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2c,0x20,0x73,0x70,0x6c,0x61,
+    0x74,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x5f,0x34,0x30,0x2c,0x20,
+    0x63,0x68,0x75,0x6e,0x6b,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x5f,0x32,0x36,0x32,0x2e,0x62,0x69,0x6e,0x73,0x5b,0x67,0x6c,
+    0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,
+    0x6e,0x49,0x44,0x2e,0x78,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x5f,
+    0x32,0x36,0x38,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,0x32,
+    0x37,0x35,0x20,0x3d,0x20,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x66,0x65,0x74,0x63,
+    0x68,0x5f,0x61,0x64,0x64,0x5f,0x65,0x78,0x70,0x6c,0x69,0x63,0x69,0x74,0x28,0x28,
+    0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x75,0x69,
+    0x6e,0x74,0x2a,0x29,0x26,0x5f,0x32,0x37,0x30,0x2e,0x73,0x74,0x61,0x74,0x65,0x5b,
+    0x5f,0x32,0x36,0x38,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x2c,0x20,0x31,0x75,0x2c,
+    0x20,0x6d,0x65,0x6d,0x6f,0x72,0x79,0x5f,0x6f,0x72,0x64,0x65,0x72,0x5f,0x72,0x65,
+    0x6c,0x61,0x78,0x65,0x64,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #pragma clang diagnostic ignored "-Wmissing-prototypes"
+
+    #include <metal_stdlib>
+    #include <simd/simd.h>
+    #include <metal_atomic>
+
+    using namespace metal;
+
+    struct select_params
+    {
+        float4 viewProj_row0;
+        float4 viewProj_row1;
+        float4 viewProj_row2;
+        float4 viewProj_row3;
+        packed_float3 camera_position;
+        float focal_px;
+        packed_float3 camera_forward;
+        float viewport_width;
+        float viewport_height;
+        int candidate_count;
+        int use_candidates;
+        int budget;
+        int texture_width;
+        int splats_per_layer;
+    };
+
+    struct SelectValue
+    {
+        uint value;
+    };
+
+    struct SelectSplatTexel
+    {
+        uint4 value;
+    };
+
+    struct splat_buffer
+    {
+        SelectSplatTexel splats[1];
+    };
+
+    struct candidate_input
+    {
+        SelectValue candidates[1];
+    };
+
+    struct bin_buffer
+    {
+        SelectValue bins[1];
+    };
+
+    struct select_state
+    {
+        SelectValue state[1];
+    };
+
+    constant uint3 gl_WorkGroupSize [[maybe_unused]] = uint3(256u, 1u, 1u);
+
+    static inline __attribute__((always_inline))
+    uint4 fetch_splat(thread const uint& splat_idx, const device splat_buffer& _25)
+    {
+        return _25.splats[splat_idx].value;
+    }
+
+    static inline __attribute__((always_inline))
+    uint score_bin(thread const uint& splat_idx, const device splat_buffer& _25, constant select_params& _40, texture2d<float> chunk_texture)
+    {
+        uint param = splat_idx;
+        uint4 _80 = fetch_splat(param, _25);
+        uint _84 = _80.w & 255u;
+        if (_84 < 3u)
+        {
+            return 0u;
+        }
+        int _112 = int(splat_idx) / 256;
+        int2 _120 = int2((_112 % 1024) * 2, _112 / 1024);
+        float3 _128 = chunk_texture.read(uint2(_120), 0).xyz;
+        float3 _138 = _128 + ((float3(float((_80.x >> 16u) & 65535u), float(_80.x & 65535u), float((_80.y >> 16u) & 65535u)) * 1.525902189314365386962890625e-05) * (chunk_texture.read(uint2(_120 + int2(1, 0)), 0).xyz - _128));
+        float _146 = dot(_138 - float3(_40.camera_position), float3(_40.camera_forward));
+        if (_146 < 0.001000000047497451305389404296875)
+        {
+            return 0u;
+        }
+        float2 _166 = exp((float2(float((_80.z >> 16u) & 255u), float((_80.z >> 8u) & 255u)) * 0.0392156876623630523681640625) - float2(5.0));
+        float _171 = _40.focal_px / _146;
+        float4 _176 = float4(_138, 1.0);
+        float4 _197 = float4(dot(_40.viewProj_row0, _176), dot(_40.viewProj_row1, _176), dot(_40.viewProj_row2, _176), dot(_40.viewProj_row3, _176));
+        float _205 = (0.5 * fast::max(_166.x, _166.y)) * _171;
+        float2 _209 = _197.xy / float2(_197.w);
+        if ((abs(_209.x) > (1.0 + ((2.0 * _205) / _40.viewport_width))) || (abs(_209.y) > (1.0 + ((2.0 * _205) / _40.viewport_height))))
+        {
+            return 0u;
+        }
+        float _235 = ((((_166.x * _166.y) * _171) * _171) * float(_84)) * 0.0039215688593685626983642578125;
+        if (!(_235 > 0.0))
+        {
+            return 0u;
+        }
+        return uint(fast::clamp(((log2(_235) + 16.0) * 25.575000762939453125) + 1.0, 1.0, 1023.0));
+    }
+
+    kernel void main0(constant select_params& _40 [[buffer(0)]], const device splat_buffer& _25 [[buffer(11)]], const device candidate_input& _250 [[buffer(8)]], device bin_buffer& _262 [[buffer(9)]], device select_state& _270 [[buffer(10)]], texture2d<float> chunk_texture [[texture(0)]], sampler splat_sampler [[sampler(2)]], uint3 gl_GlobalInvocationID [[thread_position_in_grid]])
+    {
+        if (int(gl_GlobalInvocationID.x) >= _40.candidate_count)
+        {
+            return;
+        }
+        uint _265 = (_40.use_candidates != 0) ? _250.candidates[gl_GlobalInvocationID.x].value : gl_GlobalInvocationID.x;
+        uint param_1 = _265;
+        uint _268 = score_bin(param_1, _25, _40, chunk_texture);
+        _262.bins[gl_GlobalInvocationID.x].value = _268;
+        uint _275 = atomic_fetch_add_explicit((device atomic_uint*)&_270.state[_268].value, 1u, memory_order_relaxed);
+    }
+
+*/
+static const uint8_t score_bins_buffer_source_metal_sim[3696] = {
+    0x23,0x70,0x72,0x61,0x67,0x6d,0x61,0x20,0x63,0x6c,0x61,0x6e,0x67,0x20,0x64,0x69,
+    0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x20,0x69,0x67,0x6e,0x6f,0x72,0x65,0x64,
+    0x20,0x22,0x2d,0x57,0x6d,0x69,0x73,0x73,0x69,0x6e,0x67,0x2d,0x70,0x72,0x6f,0x74,
+    0x6f,0x74,0x79,0x70,0x65,0x73,0x22,0x0a,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,
+    0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,
+    0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,
+    0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+    0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,0x61,0x74,0x6f,0x6d,0x69,0x63,0x3e,0x0a,
+    0x0a,0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,
+    0x20,0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,
+    0x73,0x65,0x6c,0x65,0x63,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x69,0x65,0x77,0x50,
+    0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x20,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,
+    0x77,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,
+    0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x32,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,
+    0x6a,0x5f,0x72,0x6f,0x77,0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,0x70,0x61,0x63,0x6b,
+    0x65,0x64,0x5f,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x63,0x61,0x6d,0x65,0x72,0x61,
+    0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x66,0x6f,0x63,0x61,0x6c,0x5f,0x70,0x78,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x70,0x61,0x63,0x6b,0x65,0x64,0x5f,0x66,0x6c,0x6f,0x61,0x74,0x33,
+    0x20,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x66,0x6f,0x72,0x77,0x61,0x72,0x64,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x69,0x65,0x77,0x70,
+    0x6f,0x72,0x74,0x5f,0x77,0x69,0x64,0x74,0x68,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x76,0x69,0x65,0x77,0x70,0x6f,0x72,0x74,0x5f,0x68,0x65,
+    0x69,0x67,0x68,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x63,0x61,
+    0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x5f,0x63,0x6f,0x75,0x6e,0x74,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x75,0x73,0x65,0x5f,0x63,0x61,0x6e,0x64,0x69,
+    0x64,0x61,0x74,0x65,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x62,
+    0x75,0x64,0x67,0x65,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x77,0x69,0x64,0x74,0x68,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x6e,0x74,0x20,0x73,0x70,0x6c,0x61,0x74,0x73,0x5f,0x70,0x65,0x72,
+    0x5f,0x6c,0x61,0x79,0x65,0x72,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,
+    0x63,0x74,0x20,0x53,0x65,0x6c,0x65,0x63,0x74,0x56,0x61,0x6c,0x75,0x65,0x0a,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x76,0x61,0x6c,0x75,0x65,0x3b,
+    0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x65,0x6c,0x65,
+    0x63,0x74,0x53,0x70,0x6c,0x61,0x74,0x54,0x65,0x78,0x65,0x6c,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x34,0x20,0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,
+    0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x73,0x70,0x6c,0x61,0x74,
+    0x5f,0x62,0x75,0x66,0x66,0x65,0x72,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x53,0x65,
+    0x6c,0x65,0x63,0x74,0x53,0x70,0x6c,0x61,0x74,0x54,0x65,0x78,0x65,0x6c,0x20,0x73,
+    0x70,0x6c,0x61,0x74,0x73,0x5b,0x31,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,
+    0x72,0x75,0x63,0x74,0x20,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x5f,0x69,
+    0x6e,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x53,0x65,0x6c,0x65,0x63,
+    0x74,0x56,0x61,0x6c,0x75,0x65,0x20,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,
+    0x73,0x5b,0x31,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,
+    0x20,0x62,0x69,0x6e,0x5f,0x62,0x75,0x66,0x66,0x65,0x72,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x53,0x65,0x6c,0x65,0x63,0x74,0x56,0x61,0x6c,0x75,0x65,0x20,0x62,0x69,
+    0x6e,0x73,0x5b,0x31,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,
+    0x74,0x20,0x73,0x65,0x6c,0x65,0x63,0x74,0x5f,0x73,0x74,0x61,0x74,0x65,0x0a,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x53,0x65,0x6c,0x65,0x63,0x74,0x56,0x61,0x6c,0x75,0x65,
+    0x20,0x73,0x74,0x61,0x74,0x65,0x5b,0x31,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x63,
+    0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x75,0x69,0x6e,0x74,0x33,0x20,0x67,0x6c,
+    0x5f,0x57,0x6f,0x72,0x6b,0x47,0x72,0x6f,0x75,0x70,0x53,0x69,0x7a,0x65,0x20,0x5b,
+    0x5b,0x6d,0x61,0x79,0x62,0x65,0x5f,0x75,0x6e,0x75,0x73,0x65,0x64,0x5d,0x5d,0x20,
+    0x3d,0x20,0x75,0x69,0x6e,0x74,0x33,0x28,0x32,0x35,0x36,0x75,0x2c,0x20,0x31,0x75,
+    0x2c,0x20,0x31,0x75,0x29,0x3b,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,
+    0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,
+    0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,
+    0x6e,0x65,0x29,0x29,0x0a,0x75,0x69,0x6e,0x74,0x34,0x20,0x66,0x65,0x74,0x63,0x68,
+    0x5f,0x73,0x70,0x6c,0x61,0x74,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,
+    0x6e,0x73,0x74,0x20,0x75,0x69,0x6e,0x74,0x26,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,
+    0x69,0x64,0x78,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x64,0x65,0x76,0x69,0x63,
+    0x65,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x62,0x75,0x66,0x66,0x65,0x72,0x26,0x20,
+    0x5f,0x32,0x35,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,
+    0x6e,0x20,0x5f,0x32,0x35,0x2e,0x73,0x70,0x6c,0x61,0x74,0x73,0x5b,0x73,0x70,0x6c,
+    0x61,0x74,0x5f,0x69,0x64,0x78,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,0x7d,
+    0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,
+    0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,
+    0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x75,
+    0x69,0x6e,0x74,0x20,0x73,0x63,0x6f,0x72,0x65,0x5f,0x62,0x69,0x6e,0x28,0x74,0x68,
+    0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x75,0x69,0x6e,0x74,0x26,
+    0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x69,0x64,0x78,0x2c,0x20,0x63,0x6f,0x6e,0x73,
+    0x74,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x62,
+    0x75,0x66,0x66,0x65,0x72,0x26,0x20,0x5f,0x32,0x35,0x2c,0x20,0x63,0x6f,0x6e,0x73,
+    0x74,0x61,0x6e,0x74,0x20,0x73,0x65,0x6c,0x65,0x63,0x74,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x73,0x26,0x20,0x5f,0x34,0x30,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x63,0x68,0x75,0x6e,0x6b,0x5f,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,
+    0x69,0x6e,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x73,0x70,0x6c,0x61,
+    0x74,0x5f,0x69,0x64,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x34,
+    0x20,0x5f,0x38,0x30,0x20,0x3d,0x20,0x66,0x65,0x74,0x63,0x68,0x5f,0x73,0x70,0x6c,
+    0x61,0x74,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x5f,0x32,0x35,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,0x38,0x34,0x20,0x3d,0x20,0x5f,
+    0x38,0x30,0x2e,0x77,0x20,0x26,0x20,0x32,0x35,0x35,0x75,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x69,0x66,0x20,0x28,0x5f,0x38,0x34,0x20,0x3c,0x20,0x33,0x75,0x29,0x0a,0x20,
+    0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,
+    0x75,0x72,0x6e,0x20,0x30,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x6e,0x74,0x20,0x5f,0x31,0x31,0x32,0x20,0x3d,0x20,0x69,0x6e,0x74,
+    0x28,0x73,0x70,0x6c,0x61,0x74,0x5f,0x69,0x64,0x78,0x29,0x20,0x2f,0x20,0x32,0x35,
+    0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x32,0x20,0x5f,0x31,0x32,0x30,
+    0x20,0x3d,0x20,0x69,0x6e,0x74,0x32,0x28,0x28,0x5f,0x31,0x31,0x32,0x20,0x25,0x20,
+    0x31,0x30,0x32,0x34,0x29,0x20,0x2a,0x20,0x32,0x2c,0x20,0x5f,0x31,0x31,0x32,0x20,
+    0x2f,0x20,0x31,0x30,0x32,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x33,0x20,0x5f,0x31,0x32,0x38,0x20,0x3d,0x20,0x63,0x68,0x75,0x6e,0x6b,
+    0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x72,0x65,0x61,0x64,0x28,0x75,0x69,
+    0x6e,0x74,0x32,0x28,0x5f,0x31,0x32,0x30,0x29,0x2c,0x20,0x30,0x29,0x2e,0x78,0x79,
+    0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x31,
+    0x33,0x38,0x20,0x3d,0x20,0x5f,0x31,0x32,0x38,0x20,0x2b,0x20,0x28,0x28,0x66,0x6c,
+    0x6f,0x61,0x74,0x33,0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x28,0x5f,0x38,0x30,0x2e,
+    0x78,0x20,0x3e,0x3e,0x20,0x31,0x36,0x75,0x29,0x20,0x26,0x20,0x36,0x35,0x35,0x33,
+    0x35,0x75,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x5f,0x38,0x30,0x2e,0x78,
+    0x20,0x26,0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x28,0x28,0x5f,0x38,0x30,0x2e,0x79,0x20,0x3e,0x3e,0x20,0x31,0x36,0x75,0x29,
+    0x20,0x26,0x20,0x36,0x35,0x35,0x33,0x35,0x75,0x29,0x29,0x20,0x2a,0x20,0x31,0x2e,
+    0x35,0x32,0x35,0x39,0x30,0x32,0x31,0x38,0x39,0x33,0x31,0x34,0x33,0x36,0x35,0x33,
+    0x38,0x36,0x39,0x36,0x32,0x38,0x39,0x30,0x36,0x32,0x35,0x65,0x2d,0x30,0x35,0x29,
+    0x20,0x2a,0x20,0x28,0x63,0x68,0x75,0x6e,0x6b,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,
+    0x65,0x2e,0x72,0x65,0x61,0x64,0x28,0x75,0x69,0x6e,0x74,0x32,0x28,0x5f,0x31,0x32,
+    0x30,0x20,0x2b,0x20,0x69,0x6e,0x74,0x32,0x28,0x31,0x2c,0x20,0x30,0x29,0x29,0x2c,
+    0x20,0x30,0x29,0x2e,0x78,0x79,0x7a,0x20,0x2d,0x20,0x5f,0x31,0x32,0x38,0x29,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,0x34,0x36,
+    0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x31,0x33,0x38,0x20,0x2d,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x33,0x28,0x5f,0x34,0x30,0x2e,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,
+    0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x33,0x28,0x5f,0x34,0x30,0x2e,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x66,0x6f,0x72,
+    0x77,0x61,0x72,0x64,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,
+    0x5f,0x31,0x34,0x36,0x20,0x3c,0x20,0x30,0x2e,0x30,0x30,0x31,0x30,0x30,0x30,0x30,
+    0x30,0x30,0x30,0x34,0x37,0x34,0x39,0x37,0x34,0x35,0x31,0x33,0x30,0x35,0x33,0x38,
+    0x39,0x34,0x30,0x34,0x32,0x39,0x36,0x38,0x37,0x35,0x29,0x0a,0x20,0x20,0x20,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x20,0x30,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x31,0x36,0x36,0x20,0x3d,0x20,0x65,0x78,0x70,
+    0x28,0x28,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x28,
+    0x5f,0x38,0x30,0x2e,0x7a,0x20,0x3e,0x3e,0x20,0x31,0x36,0x75,0x29,0x20,0x26,0x20,
+    0x32,0x35,0x35,0x75,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x28,0x5f,0x38,
+    0x30,0x2e,0x7a,0x20,0x3e,0x3e,0x20,0x38,0x75,0x29,0x20,0x26,0x20,0x32,0x35,0x35,
+    0x75,0x29,0x29,0x20,0x2a,0x20,0x30,0x2e,0x30,0x33,0x39,0x32,0x31,0x35,0x36,0x38,
+    0x37,0x36,0x36,0x32,0x33,0x36,0x33,0x30,0x35,0x32,0x33,0x36,0x38,0x31,0x36,0x34,
+    0x30,0x36,0x32,0x35,0x29,0x20,0x2d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x35,
+    0x2e,0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x5f,0x31,0x37,0x31,0x20,0x3d,0x20,0x5f,0x34,0x30,0x2e,0x66,0x6f,0x63,0x61,0x6c,
+    0x5f,0x70,0x78,0x20,0x2f,0x20,0x5f,0x31,0x34,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x31,0x37,0x36,0x20,0x3d,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x28,0x5f,0x31,0x33,0x38,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x31,0x39,0x37,
+    0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x64,0x6f,0x74,0x28,0x5f,0x34,
+    0x30,0x2e,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x30,0x2c,
+    0x20,0x5f,0x31,0x37,0x36,0x29,0x2c,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x30,0x2e,
+    0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x31,0x2c,0x20,0x5f,
+    0x31,0x37,0x36,0x29,0x2c,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x30,0x2e,0x76,0x69,
+    0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x32,0x2c,0x20,0x5f,0x31,0x37,
+    0x36,0x29,0x2c,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x30,0x2e,0x76,0x69,0x65,0x77,
+    0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x33,0x2c,0x20,0x5f,0x31,0x37,0x36,0x29,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,0x30,
+    0x35,0x20,0x3d,0x20,0x28,0x30,0x2e,0x35,0x20,0x2a,0x20,0x66,0x61,0x73,0x74,0x3a,
+    0x3a,0x6d,0x61,0x78,0x28,0x5f,0x31,0x36,0x36,0x2e,0x78,0x2c,0x20,0x5f,0x31,0x36,
+    0x36,0x2e,0x79,0x29,0x29,0x20,0x2a,0x20,0x5f,0x31,0x37,0x31,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x32,0x30,0x39,0x20,0x3d,0x20,
+    0x5f,0x31,0x39,0x37,0x2e,0x78,0x79,0x20,0x2f,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
+    0x28,0x5f,0x31,0x39,0x37,0x2e,0x77,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,
+    0x20,0x28,0x28,0x61,0x62,0x73,0x28,0x5f,0x32,0x30,0x39,0x2e,0x78,0x29,0x20,0x3e,
+    0x20,0x28,0x31,0x2e,0x30,0x20,0x2b,0x20,0x28,0x28,0x32,0x2e,0x30,0x20,0x2a,0x20,
+    0x5f,0x32,0x30,0x35,0x29,0x20,0x2f,0x20,0x5f,0x34,0x30,0x2e,0x76,0x69,0x65,0x77,
+    0x70,0x6f,0x72,0x74,0x5f,0x77,0x69,0x64,0x74,0x68,0x29,0x29,0x29,0x20,0x7c,0x7c,
+    0x20,0x28,0x61,0x62,0x73,0x28,0x5f,0x32,0x30,0x39,0x2e,0x79,0x29,0x20,0x3e,0x20,
+    0x28,0x31,0x2e,0x30,0x20,0x2b,0x20,0x28,0x28,0x32,0x2e,0x30,0x20,0x2a,0x20,0x5f,
+    0x32,0x30,0x35,0x29,0x20,0x2f,0x20,0x5f,0x34,0x30,0x2e,0x76,0x69,0x65,0x77,0x70,
+    0x6f,0x72,0x74,0x5f,0x68,0x65,0x69,0x67,0x68,0x74,0x29,0x29,0x29,0x29,0x0a,0x20,
+    0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,
+    0x75,0x72,0x6e,0x20,0x30,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,0x33,0x35,0x20,0x3d,0x20,0x28,
+    0x28,0x28,0x28,0x5f,0x31,0x36,0x36,0x2e,0x78,0x20,0x2a,0x20,0x5f,0x31,0x36,0x36,
+    0x2e,0x79,0x29,0x20,0x2a,0x20,0x5f,0x31,0x37,0x31,0x29,0x20,0x2a,0x20,0x5f,0x31,
+    0x37,0x31,0x29,0x20,0x2a,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x5f,0x38,0x34,0x29,
+    0x29,0x20,0x2a,0x20,0x30,0x2e,0x30,0x30,0x33,0x39,0x32,0x31,0x35,0x36,0x38,0x38,
+    0x35,0x39,0x33,0x36,0x38,0x35,0x36,0x32,0x36,0x39,0x38,0x33,0x36,0x34,0x32,0x35,
+    0x37,0x38,0x31,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x21,
+    0x28,0x5f,0x32,0x33,0x35,0x20,0x3e,0x20,0x30,0x2e,0x30,0x29,0x29,0x0a,0x20,0x20,
+    0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+    0x72,0x6e,0x20,0x30,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
+    0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x75,0x69,0x6e,0x74,0x28,0x66,0x61,0x73,
+    0x74,0x3a,0x3a,0x63,0x6c,0x61,0x6d,0x70,0x28,0x28,0x28,0x6c,0x6f,0x67,0x32,0x28,
+    0x5f,0x32,0x33,0x35,0x29,0x20,0x2b,0x20,0x31,0x36,0x2e,0x30,0x29,0x20,0x2a,0x20,
+    0x32,0x35,0x2e,0x35,0x37,0x35,0x30,0x30,0x30,0x37,0x36,0x32,0x39,0x33,0x39,0x34,
+    0x35,0x33,0x31,0x32,0x35,0x29,0x20,0x2b,0x20,0x31,0x2e,0x30,0x2c,0x20,0x31,0x2e,
+    0x30,0x2c,0x20,0x31,0x30,0x32,0x33,0x2e,0x30,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,
+    0x6b,0x65,0x72,0x6e,0x65,0x6c,0x20,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,
+    0x30,0x28,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x73,0x65,0x6c,0x65,0x63,
+    0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x26,0x20,0x5f,0x34,0x30,0x20,0x5b,0x5b,
+    0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x30,0x29,0x5d,0x5d,0x2c,0x20,0x63,0x6f,0x6e,
+    0x73,0x74,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,
+    0x62,0x75,0x66,0x66,0x65,0x72,0x26,0x20,0x5f,0x32,0x35,0x20,0x5b,0x5b,0x62,0x75,
+    0x66,0x66,0x65,0x72,0x28,0x31,0x31,0x29,0x5d,0x5d,0x2c,0x20,0x63,0x6f,0x6e,0x73,
+    0x74,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,
+    0x74,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x26,0x20,0x5f,0x32,0x35,0x30,0x20,0x5b,
+    0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x38,0x29,0x5d,0x5d,0x2c,0x20,0x64,0x65,
+    0x76,0x69,0x63,0x65,0x20,0x62,0x69,0x6e,0x5f,0x62,0x75,0x66,0x66,0x65,0x72,0x26,
+    0x20,0x5f,0x32,0x36,0x32,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x39,
+    0x29,0x5d,0x5d,0x2c,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x73,0x65,0x6c,0x65,
+    0x63,0x74,0x5f,0x73,0x74,0x61,0x74,0x65,0x26,0x20,0x5f,0x32,0x37,0x30,0x20,0x5b,
+    0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x31,0x30,0x29,0x5d,0x5d,0x2c,0x20,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,
+    0x63,0x68,0x75,0x6e,0x6b,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x20,0x5b,0x5b,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x30,0x29,0x5d,0x5d,0x2c,0x20,0x73,0x61,
+    0x6d,0x70,0x6c,0x65,0x72,0x20,0x73,0x70,0x6c,0x61,0x74,0x5f,0x73,0x61,0x6d,0x70,
+    0x6c,0x65,0x72,0x20,0x5b,0x5b,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x28,0x32,0x29,
+    0x5d,0x5d,0x2c,0x20,0x75,0x69,0x6e,0x74,0x33,0x20,0x67,0x6c,0x5f,0x47,0x6c,0x6f,
+    0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x20,
+    0x5b,0x5b,0x74,0x68,0x72,0x65,0x61,0x64,0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,
+    0x6e,0x5f,0x69,0x6e,0x5f,0x67,0x72,0x69,0x64,0x5d,0x5d,0x29,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x6e,0x74,0x28,0x67,0x6c,0x5f,0x47,0x6c,
+    0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,
+    0x2e,0x78,0x29,0x20,0x3e,0x3d,0x20,0x5f,0x34,0x30,0x2e,0x63,0x61,0x6e,0x64,0x69,
+    0x64,0x61,0x74,0x65,0x5f,0x63,0x6f,0x75,0x6e,0x74,0x29,0x0a,0x20,0x20,0x20,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,
+    0x20,0x5f,0x32,0x36,0x35,0x20,0x3d,0x20,0x28,0x5f,0x34,0x30,0x2e,0x75,0x73,0x65,
+    0x5f,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x73,0x20,0x21,0x3d,0x20,0x30,
+    0x29,0x20,0x3f,0x20,0x5f,0x32,0x35,0x30,0x2e,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,
+    0x74,0x65,0x73,0x5b,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,
+    0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x5d,0x2e,0x76,0x61,0x6c,
+    0x75,0x65,0x20,0x3a,0x20,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,
+    0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,
+    0x20,0x5f,0x32,0x36,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,
+    0x5f,0x32,0x36,0x38,0x20,0x3d,0x20,0x73,0x63,0x6f,0x72,0x65,0x5f,0x62,0x69,0x6e,
+    0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x2c,0x20,0x5f,0x32,0x35,0x2c,0x20,0x5f,
+    0x34,0x30,0x2c,0x20,0x63,0x68,0x75,0x6e,0x6b,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,
+    0x65,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x5f,0x32,0x36,0x32,0x2e,0x62,0x69,0x6e,
+    0x73,0x5b,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,
+    0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,
+    0x20,0x3d,0x20,0x5f,0x32,0x36,0x38,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,
+    0x74,0x20,0x5f,0x32,0x37,0x35,0x20,0x3d,0x20,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,
+    0x66,0x65,0x74,0x63,0x68,0x5f,0x61,0x64,0x64,0x5f,0x65,0x78,0x70,0x6c,0x69,0x63,
+    0x69,0x74,0x28,0x28,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x61,0x74,0x6f,0x6d,0x69,
+    0x63,0x5f,0x75,0x69,0x6e,0x74,0x2a,0x29,0x26,0x5f,0x32,0x37,0x30,0x2e,0x73,0x74,
+    0x61,0x74,0x65,0x5b,0x5f,0x32,0x36,0x38,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x2c,
+    0x20,0x31,0x75,0x2c,0x20,0x6d,0x65,0x6d,0x6f,0x72,0x79,0x5f,0x6f,0x72,0x64,0x65,
+    0x72,0x5f,0x72,0x65,0x6c,0x61,0x78,0x65,0x64,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+
+};
+/*
+    #include <metal_stdlib>
+    #include <simd/simd.h>
+
+    using namespace metal;
+
+    struct select_params
+    {
+        float4 viewProj_row0;
+        float4 viewProj_row1;
+        float4 viewProj_row2;
+        float4 viewProj_row3;
+        packed_float3 camera_position;
+        float focal_px;
+        packed_float3 camera_forward;
+        float viewport_width;
+        float viewport_height;
+        int candidate_count;
+        int use_candidates;
+        int budget;
+        int texture_width;
+        int splats_per_layer;
+    };
+
+    struct SelectValue
+    {
+        uint value;
+    };
+
+    struct select_state
+    {
+        SelectValue state[1];
+    };
+
+    constant uint3 gl_WorkGroupSize [[maybe_unused]] = uint3(1u, 1u, 1u);
+
+    kernel void main0(constant select_params& _40 [[buffer(0)]], device select_state& _35 [[buffer(8)]])
+    {
+        uint remaining = uint(_40.budget);
+        uint threshold_bin = 0u;
+        bool found = false;
+        for (int b = 1023; b >= 0; b--)
+        {
+            uint _48 = _35.state[b].value;
+            _35.state[b].value = 0u;
+            if (found)
+            {
+                continue;
+            }
+            if (_48 >= remaining)
+            {
+                threshold_bin = uint(b);
+                found = true;
+            }
+            else
+            {
+                remaining -= _48;
+            }
+        }
+        _35.state[1024].value = threshold_bin;
+        _35.state[1025].value = remaining;
+        _35.state[1026].value = 0u;
+        _35.state[1027].value = 0u;
+    }
+
+*/
+static const uint8_t find_threshold_source_metal_sim[1325] = {
+    0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,
+    0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+    0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,
+    0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,
+    0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x73,
+    0x65,0x6c,0x65,0x63,0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x69,0x65,0x77,0x50,0x72,
+    0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x20,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,
+    0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x69,
+    0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x32,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,
+    0x5f,0x72,0x6f,0x77,0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,0x70,0x61,0x63,0x6b,0x65,
+    0x64,0x5f,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,
+    0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x66,0x6f,0x63,0x61,0x6c,0x5f,0x70,0x78,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x70,0x61,0x63,0x6b,0x65,0x64,0x5f,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,
+    0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x66,0x6f,0x72,0x77,0x61,0x72,0x64,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x69,0x65,0x77,0x70,0x6f,
+    0x72,0x74,0x5f,0x77,0x69,0x64,0x74,0x68,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x76,0x69,0x65,0x77,0x70,0x6f,0x72,0x74,0x5f,0x68,0x65,0x69,
+    0x67,0x68,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x63,0x61,0x6e,
+    0x64,0x69,0x64,0x61,0x74,0x65,0x5f,0x63,0x6f,0x75,0x6e,0x74,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x6e,0x74,0x20,0x75,0x73,0x65,0x5f,0x63,0x61,0x6e,0x64,0x69,0x64,
+    0x61,0x74,0x65,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x62,0x75,
+    0x64,0x67,0x65,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x74,0x65,
+    0x78,0x74,0x75,0x72,0x65,0x5f,0x77,0x69,0x64,0x74,0x68,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x69,0x6e,0x74,0x20,0x73,0x70,0x6c,0x61,0x74,0x73,0x5f,0x70,0x65,0x72,0x5f,
+    0x6c,0x61,0x79,0x65,0x72,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,
+    0x74,0x20,0x53,0x65,0x6c,0x65,0x63,0x74,0x56,0x61,0x6c,0x75,0x65,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,
+    0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x73,0x65,0x6c,0x65,0x63,
+    0x74,0x5f,0x73,0x74,0x61,0x74,0x65,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x53,0x65,
+    0x6c,0x65,0x63,0x74,0x56,0x61,0x6c,0x75,0x65,0x20,0x73,0x74,0x61,0x74,0x65,0x5b,
+    0x31,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,
+    0x20,0x75,0x69,0x6e,0x74,0x33,0x20,0x67,0x6c,0x5f,0x57,0x6f,0x72,0x6b,0x47,0x72,
+    0x6f,0x75,0x70,0x53,0x69,0x7a,0x65,0x20,0x5b,0x5b,0x6d,0x61,0x79,0x62,0x65,0x5f,
+    0x75,0x6e,0x75,0x73,0x65,0x64,0x5d,0x5d,0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,0x33,
+    0x28,0x31,0x75,0x2c,0x20,0x31,0x75,0x2c,0x20,0x31,0x75,0x29,0x3b,0x0a,0x0a,0x6b,
+    0x65,0x72,0x6e,0x65,0x6c,0x20,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x30,
+    0x28,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x73,0x65,0x6c,0x65,0x63,0x74,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x26,0x20,0x5f,0x34,0x30,0x20,0x5b,0x5b,0x62,
+    0x75,0x66,0x66,0x65,0x72,0x28,0x30,0x29,0x5d,0x5d,0x2c,0x20,0x64,0x65,0x76,0x69,
+    0x63,0x65,0x20,0x73,0x65,0x6c,0x65,0x63,0x74,0x5f,0x73,0x74,0x61,0x74,0x65,0x26,
+    0x20,0x5f,0x33,0x35,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x38,0x29,
+    0x5d,0x5d,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x72,
+    0x65,0x6d,0x61,0x69,0x6e,0x69,0x6e,0x67,0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,0x28,
+    0x5f,0x34,0x30,0x2e,0x62,0x75,0x64,0x67,0x65,0x74,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x75,0x69,0x6e,0x74,0x20,0x74,0x68,0x72,0x65,0x73,0x68,0x6f,0x6c,0x64,0x5f,
+    0x62,0x69,0x6e,0x20,0x3d,0x20,0x30,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,
+    0x6f,0x6c,0x20,0x66,0x6f,0x75,0x6e,0x64,0x20,0x3d,0x20,0x66,0x61,0x6c,0x73,0x65,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x62,
+    0x20,0x3d,0x20,0x31,0x30,0x32,0x33,0x3b,0x20,0x62,0x20,0x3e,0x3d,0x20,0x30,0x3b,
+    0x20,0x62,0x2d,0x2d,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,0x34,0x38,0x20,0x3d,0x20,0x5f,
+    0x33,0x35,0x2e,0x73,0x74,0x61,0x74,0x65,0x5b,0x62,0x5d,0x2e,0x76,0x61,0x6c,0x75,
+    0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x33,0x35,0x2e,0x73,
+    0x74,0x61,0x74,0x65,0x5b,0x62,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,
+    0x30,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,
+    0x66,0x6f,0x75,0x6e,0x64,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6f,0x6e,
+    0x74,0x69,0x6e,0x75,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x34,0x38,
+    0x20,0x3e,0x3d,0x20,0x72,0x65,0x6d,0x61,0x69,0x6e,0x69,0x6e,0x67,0x29,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x72,0x65,0x73,0x68,0x6f,0x6c,0x64,0x5f,0x62,
+    0x69,0x6e,0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,0x28,0x62,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6f,0x75,0x6e,0x64,0x20,
+    0x3d,0x20,0x74,0x72,0x75,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x6d,0x61,0x69,0x6e,0x69,0x6e,0x67,0x20,0x2d,
+    0x3d,0x20,0x5f,0x34,0x38,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,
+    0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x5f,0x33,0x35,0x2e,0x73,
+    0x74,0x61,0x74,0x65,0x5b,0x31,0x30,0x32,0x34,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,
+    0x20,0x3d,0x20,0x74,0x68,0x72,0x65,0x73,0x68,0x6f,0x6c,0x64,0x5f,0x62,0x69,0x6e,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x5f,0x33,0x35,0x2e,0x73,0x74,0x61,0x74,0x65,0x5b,
+    0x31,0x30,0x32,0x35,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x72,0x65,
+    0x6d,0x61,0x69,0x6e,0x69,0x6e,0x67,0x3b,0x0a,0x20,0x20,0x20,0x20,0x5f,0x33,0x35,
+    0x2e,0x73,0x74,0x61,0x74,0x65,0x5b,0x31,0x30,0x32,0x36,0x5d,0x2e,0x76,0x61,0x6c,
+    0x75,0x65,0x20,0x3d,0x20,0x30,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x5f,0x33,0x35,
+    0x2e,0x73,0x74,0x61,0x74,0x65,0x5b,0x31,0x30,0x32,0x37,0x5d,0x2e,0x76,0x61,0x6c,
+    0x75,0x65,0x20,0x3d,0x20,0x30,0x75,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #include <metal_stdlib>
+    #include <simd/simd.h>
+    #include <metal_atomic>
+
+    using namespace metal;
+
+    struct select_params
+    {
+        float4 viewProj_row0;
+        float4 viewProj_row1;
+        float4 viewProj_row2;
+        float4 viewProj_row3;
+        packed_float3 camera_position;
+        float focal_px;
+        packed_float3 camera_forward;
+        float viewport_width;
+        float viewport_height;
+        int candidate_count;
+        int use_candidates;
+        int budget;
+        int texture_width;
+        int splats_per_layer;
+    };
+
+    struct SelectValue
+    {
+        uint value;
+    };
+
+    struct candidate_input
+    {
+        SelectValue candidates[1];
+    };
+
+    struct bin_buffer
+    {
+        SelectValue bins[1];
+    };
+
+    struct select_state
+    {
+        SelectValue state[1];
+    };
+
+    struct selected_output
+    {
+        SelectValue selected[1];
+    };
+
+    constant uint3 gl_WorkGroupSize [[maybe_unused]] = uint3(256u, 1u, 1u);
+
+    kernel void main0(constant select_params& _40 [[buffer(0)]], const device candidate_input& _250 [[buffer(8)]], device bin_buffer& _262 [[buffer(9)]], device select_state& _270 [[buffer(10)]], device selected_output& _290 [[buffer(11)]], uint3 gl_GlobalInvocationID [[thread_position_in_grid]])
+    {
+        if (int(gl_GlobalInvocationID.x) >= _40.candidate_count)
+        {
+            return;
+        }
+        uint _41 = _262.bins[gl_GlobalInvocationID.x].value;
+        uint _49 = _270.state[1024].value;
+        bool keep = _41 > _49;
+        if (_41 == _49)
+        {
+            uint _64 = atomic_fetch_add_explicit((device atomic_uint*)&_270.state[1027].value, 1u, memory_order_relaxed);
+            keep = _64 < _270.state[1025].value;
+        }
+        if (keep)
+        {
+            uint _77 = atomic_fetch_add_explicit((device atomic_uint*)&_270.state[1026].value, 1u, memory_order_relaxed);
+            _290.selected[_77].value = (_40.use_candidates != 0) ? _250.candidates[gl_GlobalInvocationID.x].value : gl_GlobalInvocationID.x;
+        }
+    }
+
+*/
+static const uint8_t compact_selected_source_metal_sim[1804] = {
+    0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,
+    0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+    0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x23,
+    0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,0x61,
+    0x74,0x6f,0x6d,0x69,0x63,0x3e,0x0a,0x0a,0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,0x61,
+    0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,0x0a,
+    0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x73,0x65,0x6c,0x65,0x63,0x74,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x20,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x30,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x69,0x65,0x77,
+    0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,
+    0x6f,0x77,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x76,0x69,0x65,0x77,0x50,0x72,0x6f,0x6a,0x5f,0x72,0x6f,0x77,0x33,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x70,0x61,0x63,0x6b,0x65,0x64,0x5f,0x66,0x6c,0x6f,0x61,0x74,0x33,
+    0x20,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x66,0x6f,0x63,0x61,
+    0x6c,0x5f,0x70,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x70,0x61,0x63,0x6b,0x65,0x64,
+    0x5f,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x63,0x61,0x6d,0x65,0x72,0x61,0x5f,0x66,
+    0x6f,0x72,0x77,0x61,0x72,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x76,0x69,0x65,0x77,0x70,0x6f,0x72,0x74,0x5f,0x77,0x69,0x64,0x74,0x68,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x69,0x65,0x77,
+    0x70,0x6f,0x72,0x74,0x5f,0x68,0x65,0x69,0x67,0x68,0x74,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x69,0x6e,0x74,0x20,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x5f,0x63,
+    0x6f,0x75,0x6e,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x75,0x73,
+    0x65,0x5f,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x73,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x6e,0x74,0x20,0x62,0x75,0x64,0x67,0x65,0x74,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x6e,0x74,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x77,0x69,
+    0x64,0x74,0x68,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x73,0x70,0x6c,
+    0x61,0x74,0x73,0x5f,0x70,0x65,0x72,0x5f,0x6c,0x61,0x79,0x65,0x72,0x3b,0x0a,0x7d,
+    0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x65,0x6c,0x65,0x63,0x74,
+    0x56,0x61,0x6c,0x75,0x65,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,
+    0x20,0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,
+    0x63,0x74,0x20,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x5f,0x69,0x6e,0x70,
+    0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x53,0x65,0x6c,0x65,0x63,0x74,0x56,
+    0x61,0x6c,0x75,0x65,0x20,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x73,0x5b,
+    0x31,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x62,
+    0x69,0x6e,0x5f,0x62,0x75,0x66,0x66,0x65,0x72,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x53,0x65,0x6c,0x65,0x63,0x74,0x56,0x61,0x6c,0x75,0x65,0x20,0x62,0x69,0x6e,0x73,
+    0x5b,0x31,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,
+    0x73,0x65,0x6c,0x65,0x63,0x74,0x5f,0x73,0x74,0x61,0x74,0x65,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x53,0x65,0x6c,0x65,0x63,0x74,0x56,0x61,0x6c,0x75,0x65,0x20,0x73,
+    0x74,0x61,0x74,0x65,0x5b,0x31,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,
+    0x75,0x63,0x74,0x20,0x73,0x65,0x6c,0x65,0x63,0x74,0x65,0x64,0x5f,0x6f,0x75,0x74,
+    0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x53,0x65,0x6c,0x65,0x63,0x74,
+    0x56,0x61,0x6c,0x75,0x65,0x20,0x73,0x65,0x6c,0x65,0x63,0x74,0x65,0x64,0x5b,0x31,
+    0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,
+    0x75,0x69,0x6e,0x74,0x33,0x20,0x67,0x6c,0x5f,0x57,0x6f,0x72,0x6b,0x47,0x72,0x6f,
+    0x75,0x70,0x53,0x69,0x7a,0x65,0x20,0x5b,0x5b,0x6d,0x61,0x79,0x62,0x65,0x5f,0x75,
+    0x6e,0x75,0x73,0x65,0x64,0x5d,0x5d,0x20,0x3d,0x20,0x75,0x69,0x6e,0x74,0x33,0x28,
+    0x32,0x35,0x36,0x75,0x2c,0x20,0x31,0x75,0x2c,0x20,0x31,0x75,0x29,0x3b,0x0a,0x0a,
+    0x6b,0x65,0x72,0x6e,0x65,0x6c,0x20,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,
+    0x30,0x28,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x73,0x65,0x6c,0x65,0x63,
+    0x74,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x26,0x20,0x5f,0x34,0x30,0x20,0x5b,0x5b,
+    0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x30,0x29,0x5d,0x5d,0x2c,0x20,0x63,0x6f,0x6e,
+    0x73,0x74,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x63,0x61,0x6e,0x64,0x69,0x64,
+    0x61,0x74,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x26,0x20,0x5f,0x32,0x35,0x30,0x20,
+    0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x38,0x29,0x5d,0x5d,0x2c,0x20,0x64,
+    0x65,0x76,0x69,0x63,0x65,0x20,0x62,0x69,0x6e,0x5f,0x62,0x75,0x66,0x66,0x65,0x72,
+    0x26,0x20,0x5f,0x32,0x36,0x32,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,
+    0x39,0x29,0x5d,0x5d,0x2c,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x73,0x65,0x6c,
+    0x65,0x63,0x74,0x5f,0x73,0x74,0x61,0x74,0x65,0x26,0x20,0x5f,0x32,0x37,0x30,0x20,
+    0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x31,0x30,0x29,0x5d,0x5d,0x2c,0x20,
+    0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x73,0x65,0x6c,0x65,0x63,0x74,0x65,0x64,0x5f,
+    0x6f,0x75,0x74,0x70,0x75,0x74,0x26,0x20,0x5f,0x32,0x39,0x30,0x20,0x5b,0x5b,0x62,
+    0x75,0x66,0x66,0x65,0x72,0x28,0x31,0x31,0x29,0x5d,0x5d,0x2c,0x20,0x75,0x69,0x6e,
+    0x74,0x33,0x20,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,
+    0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x20,0x5b,0x5b,0x74,0x68,0x72,0x65,0x61,
+    0x64,0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5f,0x69,0x6e,0x5f,0x67,0x72,
+    0x69,0x64,0x5d,0x5d,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,
+    0x69,0x6e,0x74,0x28,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,0x6c,0x49,0x6e,0x76,
+    0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x29,0x20,0x3e,0x3d,0x20,
+    0x5f,0x34,0x30,0x2e,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x5f,0x63,0x6f,
+    0x75,0x6e,0x74,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,
+    0x0a,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,0x5f,0x34,0x31,0x20,0x3d,0x20,
+    0x5f,0x32,0x36,0x32,0x2e,0x62,0x69,0x6e,0x73,0x5b,0x67,0x6c,0x5f,0x47,0x6c,0x6f,
+    0x62,0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,
+    0x78,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x69,
+    0x6e,0x74,0x20,0x5f,0x34,0x39,0x20,0x3d,0x20,0x5f,0x32,0x37,0x30,0x2e,0x73,0x74,
+    0x61,0x74,0x65,0x5b,0x31,0x30,0x32,0x34,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x6b,0x65,0x65,0x70,0x20,0x3d,
+    0x20,0x5f,0x34,0x31,0x20,0x3e,0x20,0x5f,0x34,0x39,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x69,0x66,0x20,0x28,0x5f,0x34,0x31,0x20,0x3d,0x3d,0x20,0x5f,0x34,0x39,0x29,0x0a,
+    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x75,0x69,
+    0x6e,0x74,0x20,0x5f,0x36,0x34,0x20,0x3d,0x20,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,
+    0x66,0x65,0x74,0x63,0x68,0x5f,0x61,0x64,0x64,0x5f,0x65,0x78,0x70,0x6c,0x69,0x63,
+    0x69,0x74,0x28,0x28,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x61,0x74,0x6f,0x6d,0x69,
+    0x63,0x5f,0x75,0x69,0x6e,0x74,0x2a,0x29,0x26,0x5f,0x32,0x37,0x30,0x2e,0x73,0x74,
+    0x61,0x74,0x65,0x5b,0x31,0x30,0x32,0x37,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x2c,
+    0x20,0x31,0x75,0x2c,0x20,0x6d,0x65,0x6d,0x6f,0x72,0x79,0x5f,0x6f,0x72,0x64,0x65,
+    0x72,0x5f,0x72,0x65,0x6c,0x61,0x78,0x65,0x64,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x6b,0x65,0x65,0x70,0x20,0x3d,0x20,0x5f,0x36,0x34,0x20,0x3c,
+    0x20,0x5f,0x32,0x37,0x30,0x2e,0x73,0x74,0x61,0x74,0x65,0x5b,0x31,0x30,0x32,0x35,
+    0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,
+    0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x6b,0x65,0x65,0x70,0x29,0x0a,0x20,0x20,0x20,
+    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x75,0x69,0x6e,0x74,0x20,
+    0x5f,0x37,0x37,0x20,0x3d,0x20,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x66,0x65,0x74,
+    0x63,0x68,0x5f,0x61,0x64,0x64,0x5f,0x65,0x78,0x70,0x6c,0x69,0x63,0x69,0x74,0x28,
+    0x28,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x61,0x74,0x6f,0x6d,0x69,0x63,0x5f,0x75,
+    0x69,0x6e,0x74,0x2a,0x29,0x26,0x5f,0x32,0x37,0x30,0x2e,0x73,0x74,0x61,0x74,0x65,
+    0x5b,0x31,0x30,0x32,0x36,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x2c,0x20,0x31,0x75,
+    0x2c,0x20,0x6d,0x65,0x6d,0x6f,0x72,0x79,0x5f,0x6f,0x72,0x64,0x65,0x72,0x5f,0x72,
+    0x65,0x6c,0x61,0x78,0x65,0x64,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x5f,0x32,0x39,0x30,0x2e,0x73,0x65,0x6c,0x65,0x63,0x74,0x65,0x64,0x5b,0x5f,
+    0x37,0x37,0x5d,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x28,0x5f,0x34,0x30,
+    0x2e,0x75,0x73,0x65,0x5f,0x63,0x61,0x6e,0x64,0x69,0x64,0x61,0x74,0x65,0x73,0x20,
+    0x21,0x3d,0x20,0x30,0x29,0x20,0x3f,0x20,0x5f,0x32,0x35,0x30,0x2e,0x63,0x61,0x6e,
+    0x64,0x69,0x64,0x61,0x74,0x65,0x73,0x5b,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,0x61,
+    0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,0x5d,
+    0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3a,0x20,0x67,0x6c,0x5f,0x47,0x6c,0x6f,0x62,
+    0x61,0x6c,0x49,0x6e,0x76,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x49,0x44,0x2e,0x78,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+static inline const sg_shader_desc* select_score_shader_desc(sg_backend backend) {
+    if (backend == SG_BACKEND_GLCORE) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.compute_func.source = (const char*)score_bins_source_glsl410;
+            desc.compute_func.entry = "main";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_COMPUTE;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 128;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "_40.viewProj_row0";
+            desc.uniform_blocks[0].glsl_uniforms[1].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[1].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[1].glsl_name = "_40.viewProj_row1";
+            desc.uniform_blocks[0].glsl_uniforms[2].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[2].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[2].glsl_name = "_40.viewProj_row2";
+            desc.uniform_blocks[0].glsl_uniforms[3].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[3].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[3].glsl_name = "_40.viewProj_row3";
+            desc.uniform_blocks[0].glsl_uniforms[4].type = SG_UNIFORMTYPE_FLOAT3;
+            desc.uniform_blocks[0].glsl_uniforms[4].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[4].glsl_name = "_40.camera_position";
+            desc.uniform_blocks[0].glsl_uniforms[5].type = SG_UNIFORMTYPE_FLOAT;
+            desc.uniform_blocks[0].glsl_uniforms[5].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[5].glsl_name = "_40.focal_px";
+            desc.uniform_blocks[0].glsl_uniforms[6].type = SG_UNIFORMTYPE_FLOAT3;
+            desc.uniform_blocks[0].glsl_uniforms[6].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[6].glsl_name = "_40.camera_forward";
+            desc.uniform_blocks[0].glsl_uniforms[7].type = SG_UNIFORMTYPE_FLOAT;
+            desc.uniform_blocks[0].glsl_uniforms[7].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[7].glsl_name = "_40.viewport_width";
+            desc.uniform_blocks[0].glsl_uniforms[8].type = SG_UNIFORMTYPE_FLOAT;
+            desc.uniform_blocks[0].glsl_uniforms[8].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[8].glsl_name = "_40.viewport_height";
+            desc.uniform_blocks[0].glsl_uniforms[9].type = SG_UNIFORMTYPE_INT;
+            desc.uniform_blocks[0].glsl_uniforms[9].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[9].glsl_name = "_40.candidate_count";
+            desc.uniform_blocks[0].glsl_uniforms[10].type = SG_UNIFORMTYPE_INT;
+            desc.uniform_blocks[0].glsl_uniforms[10].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[10].glsl_name = "_40.use_candidates";
+            desc.uniform_blocks[0].glsl_uniforms[11].type = SG_UNIFORMTYPE_INT;
+            desc.uniform_blocks[0].glsl_uniforms[11].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[11].glsl_name = "_40.budget";
+            desc.uniform_blocks[0].glsl_uniforms[12].type = SG_UNIFORMTYPE_INT;
+            desc.uniform_blocks[0].glsl_uniforms[12].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[12].glsl_name = "_40.texture_width";
+            desc.uniform_blocks[0].glsl_uniforms[13].type = SG_UNIFORMTYPE_INT;
+            desc.uniform_blocks[0].glsl_uniforms[13].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[13].glsl_name = "_40.splats_per_layer";
+            desc.views[1].texture.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[1].texture.image_type = SG_IMAGETYPE_ARRAY;
+            desc.views[1].texture.sample_type = SG_IMAGESAMPLETYPE_UINT;
+            desc.views[1].texture.multisampled = false;
+            desc.views[3].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[3].storage_buffer.readonly = true;
+            desc.views[3].storage_buffer.glsl_binding_n = 3;
+            desc.views[4].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[4].storage_buffer.readonly = false;
+            desc.views[4].storage_buffer.glsl_binding_n = 4;
+            desc.views[5].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[5].storage_buffer.readonly = false;
+            desc.views[5].storage_buffer.glsl_binding_n = 5;
+            desc.views[6].texture.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[6].texture.image_type = SG_IMAGETYPE_2D;
+            desc.views[6].texture.sample_type = SG_IMAGESAMPLETYPE_UNFILTERABLE_FLOAT;
+            desc.views[6].texture.multisampled = false;
+            desc.samplers[2].stage = SG_SHADERSTAGE_COMPUTE;
+            desc.samplers[2].sampler_type = SG_SAMPLERTYPE_NONFILTERING;
+            desc.texture_sampler_pairs[0].stage = SG_SHADERSTAGE_COMPUTE;
+            desc.texture_sampler_pairs[0].view_slot = 1;
+            desc.texture_sampler_pairs[0].sampler_slot = 2;
+            desc.texture_sampler_pairs[0].glsl_name = "splat_texture_splat_sampler";
+            desc.texture_sampler_pairs[1].stage = SG_SHADERSTAGE_COMPUTE;
+            desc.texture_sampler_pairs[1].view_slot = 6;
+            desc.texture_sampler_pairs[1].sampler_slot = 2;
+            desc.texture_sampler_pairs[1].glsl_name = "chunk_texture_splat_sampler";
+            desc.label = "select_score_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_GLES3) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.compute_func.source = (const char*)score_bins_source_glsl310es;
+            desc.compute_func.entry = "main";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_COMPUTE;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 128;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "_40.viewProj_row0";
+            desc.uniform_blocks[0].glsl_uniforms[1].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[1].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[1].glsl_name = "_40.viewProj_row1";
+            desc.uniform_blocks[0].glsl_uniforms[2].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[2].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[2].glsl_name = "_40.viewProj_row2";
+            desc.uniform_blocks[0].glsl_uniforms[3].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[3].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[3].glsl_name = "_40.viewProj_row3";
+            desc.uniform_blocks[0].glsl_uniforms[4].type = SG_UNIFORMTYPE_FLOAT3;
+            desc.uniform_blocks[0].glsl_uniforms[4].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[4].glsl_name = "_40.camera_position";
+            desc.uniform_blocks[0].glsl_uniforms[5].type = SG_UNIFORMTYPE_FLOAT;
+            desc.uniform_blocks[0].glsl_uniforms[5].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[5].glsl_name = "_40.focal_px";
+            desc.uniform_blocks[0].glsl_uniforms[6].type = SG_UNIFORMTYPE_FLOAT3;
+            desc.uniform_blocks[0].glsl_uniforms[6].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[6].glsl_name = "_40.camera_forward";
+            desc.uniform_blocks[0].glsl_uniforms[7].type = SG_UNIFORMTYPE_FLOAT;
+            desc.uniform_blocks[0].glsl_uniforms[7].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[7].glsl_name = "_40.viewport_width";
+            desc.uniform_blocks[0].glsl_uniforms[8].type = SG_UNIFORMTYPE_FLOAT;
+            desc.uniform_blocks[0].glsl_uniforms[8].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[8].glsl_name = "_40.viewport_height";
+            desc.uniform_blocks[0].glsl_uniforms[9].type = SG_UNIFORMTYPE_INT;
+            desc.uniform_blocks[0].glsl_uniforms[9].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[9].glsl_name = "_40.candidate_count";
+            desc.uniform_blocks[0].glsl_uniforms[10].type = SG_UNIFORMTYPE_INT;
+            desc.uniform_blocks[0].glsl_uniforms[10].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[10].glsl_name = "_40.use_candidates";
+            desc.uniform_blocks[0].glsl_uniforms[11].type = SG_UNIFORMTYPE_INT;
+            desc.uniform_blocks[0].glsl_uniforms[11].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[11].glsl_name = "_40.budget";
+            desc.uniform_blocks[0].glsl_uniforms[12].type = SG_UNIFORMTYPE_INT;
+            desc.uniform_blocks[0].glsl_uniforms[12].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[12].glsl_name = "_40.texture_width";
+            desc.uniform_blocks[0].glsl_uniforms[13].type = SG_UNIFORMTYPE_INT;
+            desc.uniform_blocks[0].glsl_uniforms[13].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[13].glsl_name = "_40.splats_per_layer";
+            desc.views[1].texture.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[1].texture.image_type = SG_IMAGETYPE_ARRAY;
+            desc.views[1].texture.sample_type = SG_IMAGESAMPLETYPE_UINT;
+            desc.views[1].texture.multisampled = false;
+            desc.views[3].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[3].storage_buffer.readonly = true;
+            desc.views[3].storage_buffer.glsl_binding_n = 3;
+            desc.views[4].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[4].storage_buffer.readonly = false;
+            desc.views[4].storage_buffer.glsl_binding_n = 4;
+            desc.views[5].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[5].storage_buffer.readonly = false;
+            desc.views[5].storage_buffer.glsl_binding_n = 5;
+            desc.views[6].texture.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[6].texture.image_type = SG_IMAGETYPE_2D;
+            desc.views[6].texture.sample_type = SG_IMAGESAMPLETYPE_UNFILTERABLE_FLOAT;
+            desc.views[6].texture.multisampled = false;
+            desc.samplers[2].stage = SG_SHADERSTAGE_COMPUTE;
+            desc.samplers[2].sampler_type = SG_SAMPLERTYPE_NONFILTERING;
+            desc.texture_sampler_pairs[0].stage = SG_SHADERSTAGE_COMPUTE;
+            desc.texture_sampler_pairs[0].view_slot = 1;
+            desc.texture_sampler_pairs[0].sampler_slot = 2;
+            desc.texture_sampler_pairs[0].glsl_name = "splat_texture_splat_sampler";
+            desc.texture_sampler_pairs[1].stage = SG_SHADERSTAGE_COMPUTE;
+            desc.texture_sampler_pairs[1].view_slot = 6;
+            desc.texture_sampler_pairs[1].sampler_slot = 2;
+            desc.texture_sampler_pairs[1].glsl_name = "chunk_texture_splat_sampler";
+            desc.label = "select_score_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_D3D11) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.compute_func.source = (const char*)score_bins_source_hlsl5;
+            desc.compute_func.d3d11_target = "cs_5_0";
+            desc.compute_func.entry = "main";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_COMPUTE;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 128;
+            desc.uniform_blocks[0].hlsl_register_b_n = 0;
+            desc.views[1].texture.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[1].texture.image_type = SG_IMAGETYPE_ARRAY;
+            desc.views[1].texture.sample_type = SG_IMAGESAMPLETYPE_UINT;
+            desc.views[1].texture.multisampled = false;
+            desc.views[1].texture.hlsl_register_t_n = 0;
+            desc.views[3].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[3].storage_buffer.readonly = true;
+            desc.views[3].storage_buffer.hlsl_register_t_n = 1;
+            desc.views[4].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[4].storage_buffer.readonly = false;
+            desc.views[4].storage_buffer.hlsl_register_u_n = 0;
+            desc.views[5].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[5].storage_buffer.readonly = false;
+            desc.views[5].storage_buffer.hlsl_register_u_n = 1;
+            desc.views[6].texture.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[6].texture.image_type = SG_IMAGETYPE_2D;
+            desc.views[6].texture.sample_type = SG_IMAGESAMPLETYPE_UNFILTERABLE_FLOAT;
+            desc.views[6].texture.multisampled = false;
+            desc.views[6].texture.hlsl_register_t_n = 2;
+            desc.samplers[2].stage = SG_SHADERSTAGE_COMPUTE;
+            desc.samplers[2].sampler_type = SG_SAMPLERTYPE_NONFILTERING;
+            desc.samplers[2].hlsl_register_s_n = 2;
+            desc.texture_sampler_pairs[0].stage = SG_SHADERSTAGE_COMPUTE;
+            desc.texture_sampler_pairs[0].view_slot = 1;
+            desc.texture_sampler_pairs[0].sampler_slot = 2;
+            desc.texture_sampler_pairs[1].stage = SG_SHADERSTAGE_COMPUTE;
+            desc.texture_sampler_pairs[1].view_slot = 6;
+            desc.texture_sampler_pairs[1].sampler_slot = 2;
+            desc.label = "select_score_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_METAL_MACOS) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.compute_func.source = (const char*)score_bins_source_metal_macos;
+            desc.compute_func.entry = "main0";
+            desc.mtl_threads_per_threadgroup.x = 256;
+            desc.mtl_threads_per_threadgroup.y = 1;
+            desc.mtl_threads_per_threadgroup.z = 1;
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_COMPUTE;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 128;
+            desc.uniform_blocks[0].msl_buffer_n = 0;
+            desc.views[1].texture.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[1].texture.image_type = SG_IMAGETYPE_ARRAY;
+            desc.views[1].texture.sample_type = SG_IMAGESAMPLETYPE_UINT;
+            desc.views[1].texture.multisampled = false;
+            desc.views[1].texture.msl_texture_n = 0;
+            desc.views[3].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[3].storage_buffer.readonly = true;
+            desc.views[3].storage_buffer.msl_buffer_n = 8;
+            desc.views[4].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[4].storage_buffer.readonly = false;
+            desc.views[4].storage_buffer.msl_buffer_n = 9;
+            desc.views[5].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[5].storage_buffer.readonly = false;
+            desc.views[5].storage_buffer.msl_buffer_n = 10;
+            desc.views[6].texture.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[6].texture.image_type = SG_IMAGETYPE_2D;
+            desc.views[6].texture.sample_type = SG_IMAGESAMPLETYPE_UNFILTERABLE_FLOAT;
+            desc.views[6].texture.multisampled = false;
+            desc.views[6].texture.msl_texture_n = 1;
+            desc.samplers[2].stage = SG_SHADERSTAGE_COMPUTE;
+            desc.samplers[2].sampler_type = SG_SAMPLERTYPE_NONFILTERING;
+            desc.samplers[2].msl_sampler_n = 2;
+            desc.texture_sampler_pairs[0].stage = SG_SHADERSTAGE_COMPUTE;
+            desc.texture_sampler_pairs[0].view_slot = 1;
+            desc.texture_sampler_pairs[0].sampler_slot = 2;
+            desc.texture_sampler_pairs[1].stage = SG_SHADERSTAGE_COMPUTE;
+            desc.texture_sampler_pairs[1].view_slot = 6;
+            desc.texture_sampler_pairs[1].sampler_slot = 2;
+            desc.label = "select_score_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_METAL_IOS) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.compute_func.source = (const char*)score_bins_source_metal_ios;
+            desc.compute_func.entry = "main0";
+            desc.mtl_threads_per_threadgroup.x = 256;
+            desc.mtl_threads_per_threadgroup.y = 1;
+            desc.mtl_threads_per_threadgroup.z = 1;
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_COMPUTE;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 128;
+            desc.uniform_blocks[0].msl_buffer_n = 0;
+            desc.views[1].texture.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[1].texture.image_type = SG_IMAGETYPE_ARRAY;
+            desc.views[1].texture.sample_type = SG_IMAGESAMPLETYPE_UINT;
+            desc.views[1].texture.multisampled = false;
+            desc.views[1].texture.msl_texture_n = 0;
+            desc.views[3].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[3].storage_buffer.readonly = true;
+            desc.views[3].storage_buffer.msl_buffer_n = 8;
+            desc.views[4].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[4].storage_buffer.readonly = false;
+            desc.views[4].storage_buffer.msl_buffer_n = 9;
+            desc.views[5].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[5].storage_buffer.readonly = false;
+            desc.views[5].storage_buffer.msl_buffer_n = 10;
+            desc.views[6].texture.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[6].texture.image_type = SG_IMAGETYPE_2D;
+            desc.views[6].texture.sample_type = SG_IMAGESAMPLETYPE_UNFILTERABLE_FLOAT;
+            desc.views[6].texture.multisampled = false;
+            desc.views[6].texture.msl_texture_n = 1;
+            desc.samplers[2].stage = SG_SHADERSTAGE_COMPUTE;
+            desc.samplers[2].sampler_type = SG_SAMPLERTYPE_NONFILTERING;
+            desc.samplers[2].msl_sampler_n = 2;
+            desc.texture_sampler_pairs[0].stage = SG_SHADERSTAGE_COMPUTE;
+            desc.texture_sampler_pairs[0].view_slot = 1;
+            desc.texture_sampler_pairs[0].sampler_slot = 2;
+            desc.texture_sampler_pairs[1].stage = SG_SHADERSTAGE_COMPUTE;
+            desc.texture_sampler_pairs[1].view_slot = 6;
+            desc.texture_sampler_pairs[1].sampler_slot = 2;
+            desc.label = "select_score_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_METAL_SIMULATOR) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.compute_func.source = (const char*)score_bins_source_metal_sim;
+            desc.compute_func.entry = "main0";
+            desc.mtl_threads_per_threadgroup.x = 256;
+            desc.mtl_threads_per_threadgroup.y = 1;
+            desc.mtl_threads_per_threadgroup.z = 1;
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_COMPUTE;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 128;
+            desc.uniform_blocks[0].msl_buffer_n = 0;
+            desc.views[1].texture.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[1].texture.image_type = SG_IMAGETYPE_ARRAY;
+            desc.views[1].texture.sample_type = SG_IMAGESAMPLETYPE_UINT;
+            desc.views[1].texture.multisampled = false;
+            desc.views[1].texture.msl_texture_n = 0;
+            desc.views[3].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[3].storage_buffer.readonly = true;
+            desc.views[3].storage_buffer.msl_buffer_n = 8;
+            desc.views[4].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[4].storage_buffer.readonly = false;
+            desc.views[4].storage_buffer.msl_buffer_n = 9;
+            desc.views[5].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[5].storage_buffer.readonly = false;
+            desc.views[5].storage_buffer.msl_buffer_n = 10;
+            desc.views[6].texture.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[6].texture.image_type = SG_IMAGETYPE_2D;
+            desc.views[6].texture.sample_type = SG_IMAGESAMPLETYPE_UNFILTERABLE_FLOAT;
+            desc.views[6].texture.multisampled = false;
+            desc.views[6].texture.msl_texture_n = 1;
+            desc.samplers[2].stage = SG_SHADERSTAGE_COMPUTE;
+            desc.samplers[2].sampler_type = SG_SAMPLERTYPE_NONFILTERING;
+            desc.samplers[2].msl_sampler_n = 2;
+            desc.texture_sampler_pairs[0].stage = SG_SHADERSTAGE_COMPUTE;
+            desc.texture_sampler_pairs[0].view_slot = 1;
+            desc.texture_sampler_pairs[0].sampler_slot = 2;
+            desc.texture_sampler_pairs[1].stage = SG_SHADERSTAGE_COMPUTE;
+            desc.texture_sampler_pairs[1].view_slot = 6;
+            desc.texture_sampler_pairs[1].sampler_slot = 2;
+            desc.label = "select_score_shader";
+        }
+        return &desc;
+    }
+    return 0;
+}
+static inline const sg_shader_desc* select_score_buffer_shader_desc(sg_backend backend) {
+    if (backend == SG_BACKEND_GLCORE) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.compute_func.source = (const char*)score_bins_buffer_source_glsl410;
+            desc.compute_func.entry = "main";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_COMPUTE;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 128;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "_40.viewProj_row0";
+            desc.uniform_blocks[0].glsl_uniforms[1].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[1].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[1].glsl_name = "_40.viewProj_row1";
+            desc.uniform_blocks[0].glsl_uniforms[2].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[2].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[2].glsl_name = "_40.viewProj_row2";
+            desc.uniform_blocks[0].glsl_uniforms[3].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[3].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[3].glsl_name = "_40.viewProj_row3";
+            desc.uniform_blocks[0].glsl_uniforms[4].type = SG_UNIFORMTYPE_FLOAT3;
+            desc.uniform_blocks[0].glsl_uniforms[4].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[4].glsl_name = "_40.camera_position";
+            desc.uniform_blocks[0].glsl_uniforms[5].type = SG_UNIFORMTYPE_FLOAT;
+            desc.uniform_blocks[0].glsl_uniforms[5].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[5].glsl_name = "_40.focal_px";
+            desc.uniform_blocks[0].glsl_uniforms[6].type = SG_UNIFORMTYPE_FLOAT3;
+            desc.uniform_blocks[0].glsl_uniforms[6].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[6].glsl_name = "_40.camera_forward";
+            desc.uniform_blocks[0].glsl_uniforms[7].type = SG_UNIFORMTYPE_FLOAT;
+            desc.uniform_blocks[0].glsl_uniforms[7].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[7].glsl_name = "_40.viewport_width";
+            desc.uniform_blocks[0].glsl_uniforms[8].type = SG_UNIFORMTYPE_FLOAT;
+            desc.uniform_blocks[0].glsl_uniforms[8].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[8].glsl_name = "_40.viewport_height";
+            desc.uniform_blocks[0].glsl_uniforms[9].type = SG_UNIFORMTYPE_INT;
+            desc.uniform_blocks[0].glsl_uniforms[9].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[9].glsl_name = "_40.candidate_count";
+            desc.uniform_blocks[0].glsl_uniforms[10].type = SG_UNIFORMTYPE_INT;
+            desc.uniform_blocks[0].glsl_uniforms[10].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[10].glsl_name = "_40.use_candidates";
+            desc.uniform_blocks[0].glsl_uniforms[11].type = SG_UNIFORMTYPE_INT;
+            desc.uniform_blocks[0].glsl_uniforms[11].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[11].glsl_name = "_40.budget";
+            desc.uniform_blocks[0].glsl_uniforms[12].type = SG_UNIFORMTYPE_INT;
+            desc.uniform_blocks[0].glsl_uniforms[12].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[12].glsl_name = "_40.texture_width";
+            desc.uniform_blocks[0].glsl_uniforms[13].type = SG_UNIFORMTYPE_INT;
+            desc.uniform_blocks[0].glsl_uniforms[13].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[13].glsl_name = "_40.splats_per_layer";
+            desc.views[3].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[3].storage_buffer.readonly = true;
+            desc.views[3].storage_buffer.glsl_binding_n = 0;
+            desc.views[4].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[4].storage_buffer.readonly = false;
+            desc.views[4].storage_buffer.glsl_binding_n = 1;
+            desc.views[5].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[5].storage_buffer.readonly = false;
+            desc.views[5].storage_buffer.glsl_binding_n = 2;
+            desc.views[6].texture.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[6].texture.image_type = SG_IMAGETYPE_2D;
+            desc.views[6].texture.sample_type = SG_IMAGESAMPLETYPE_UNFILTERABLE_FLOAT;
+            desc.views[6].texture.multisampled = false;
+            desc.views[8].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[8].storage_buffer.readonly = true;
+            desc.views[8].storage_buffer.glsl_binding_n = 3;
+            desc.samplers[2].stage = SG_SHADERSTAGE_COMPUTE;
+            desc.samplers[2].sampler_type = SG_SAMPLERTYPE_NONFILTERING;
+            desc.texture_sampler_pairs[0].stage = SG_SHADERSTAGE_COMPUTE;
+            desc.texture_sampler_pairs[0].view_slot = 6;
+            desc.texture_sampler_pairs[0].sampler_slot = 2;
+            desc.texture_sampler_pairs[0].glsl_name = "chunk_texture_splat_sampler";
+            desc.label = "select_score_buffer_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_GLES3) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.compute_func.source = (const char*)score_bins_buffer_source_glsl310es;
+            desc.compute_func.entry = "main";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_COMPUTE;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 128;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "_40.viewProj_row0";
+            desc.uniform_blocks[0].glsl_uniforms[1].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[1].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[1].glsl_name = "_40.viewProj_row1";
+            desc.uniform_blocks[0].glsl_uniforms[2].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[2].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[2].glsl_name = "_40.viewProj_row2";
+            desc.uniform_blocks[0].glsl_uniforms[3].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[3].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[3].glsl_name = "_40.viewProj_row3";
+            desc.uniform_blocks[0].glsl_uniforms[4].type = SG_UNIFORMTYPE_FLOAT3;
+            desc.uniform_blocks[0].glsl_uniforms[4].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[4].glsl_name = "_40.camera_position";
+            desc.uniform_blocks[0].glsl_uniforms[5].type = SG_UNIFORMTYPE_FLOAT;
+            desc.uniform_blocks[0].glsl_uniforms[5].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[5].glsl_name = "_40.focal_px";
+            desc.uniform_blocks[0].glsl_uniforms[6].type = SG_UNIFORMTYPE_FLOAT3;
+            desc.uniform_blocks[0].glsl_uniforms[6].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[6].glsl_name = "_40.camera_forward";
+            desc.uniform_blocks[0].glsl_uniforms[7].type = SG_UNIFORMTYPE_FLOAT;
+            desc.uniform_blocks[0].glsl_uniforms[7].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[7].glsl_name = "_40.viewport_width";
+            desc.uniform_blocks[0].glsl_uniforms[8].type = SG_UNIFORMTYPE_FLOAT;
+            desc.uniform_blocks[0].glsl_uniforms[8].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[8].glsl_name = "_40.viewport_height";
+            desc.uniform_blocks[0].glsl_uniforms[9].type = SG_UNIFORMTYPE_INT;
+            desc.uniform_blocks[0].glsl_uniforms[9].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[9].glsl_name = "_40.candidate_count";
+            desc.uniform_blocks[0].glsl_uniforms[10].type = SG_UNIFORMTYPE_INT;
+            desc.uniform_blocks[0].glsl_uniforms[10].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[10].glsl_name = "_40.use_candidates";
+            desc.uniform_blocks[0].glsl_uniforms[11].type = SG_UNIFORMTYPE_INT;
+            desc.uniform_blocks[0].glsl_uniforms[11].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[11].glsl_name = "_40.budget";
+            desc.uniform_blocks[0].glsl_uniforms[12].type = SG_UNIFORMTYPE_INT;
+            desc.uniform_blocks[0].glsl_uniforms[12].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[12].glsl_name = "_40.texture_width";
+            desc.uniform_blocks[0].glsl_uniforms[13].type = SG_UNIFORMTYPE_INT;
+            desc.uniform_blocks[0].glsl_uniforms[13].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[13].glsl_name = "_40.splats_per_layer";
+            desc.views[3].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[3].storage_buffer.readonly = true;
+            desc.views[3].storage_buffer.glsl_binding_n = 0;
+            desc.views[4].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[4].storage_buffer.readonly = false;
+            desc.views[4].storage_buffer.glsl_binding_n = 1;
+            desc.views[5].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[5].storage_buffer.readonly = false;
+            desc.views[5].storage_buffer.glsl_binding_n = 2;
+            desc.views[6].texture.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[6].texture.image_type = SG_IMAGETYPE_2D;
+            desc.views[6].texture.sample_type = SG_IMAGESAMPLETYPE_UNFILTERABLE_FLOAT;
+            desc.views[6].texture.multisampled = false;
+            desc.views[8].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[8].storage_buffer.readonly = true;
+            desc.views[8].storage_buffer.glsl_binding_n = 3;
+            desc.samplers[2].stage = SG_SHADERSTAGE_COMPUTE;
+            desc.samplers[2].sampler_type = SG_SAMPLERTYPE_NONFILTERING;
+            desc.texture_sampler_pairs[0].stage = SG_SHADERSTAGE_COMPUTE;
+            desc.texture_sampler_pairs[0].view_slot = 6;
+            desc.texture_sampler_pairs[0].sampler_slot = 2;
+            desc.texture_sampler_pairs[0].glsl_name = "chunk_texture_splat_sampler";
+            desc.label = "select_score_buffer_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_D3D11) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.compute_func.source = (const char*)score_bins_buffer_source_hlsl5;
+            desc.compute_func.d3d11_target = "cs_5_0";
+            desc.compute_func.entry = "main";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_COMPUTE;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 128;
+            desc.uniform_blocks[0].hlsl_register_b_n = 0;
+            desc.views[3].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[3].storage_buffer.readonly = true;
+            desc.views[3].storage_buffer.hlsl_register_t_n = 0;
+            desc.views[4].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[4].storage_buffer.readonly = false;
+            desc.views[4].storage_buffer.hlsl_register_u_n = 0;
+            desc.views[5].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[5].storage_buffer.readonly = false;
+            desc.views[5].storage_buffer.hlsl_register_u_n = 1;
+            desc.views[6].texture.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[6].texture.image_type = SG_IMAGETYPE_2D;
+            desc.views[6].texture.sample_type = SG_IMAGESAMPLETYPE_UNFILTERABLE_FLOAT;
+            desc.views[6].texture.multisampled = false;
+            desc.views[6].texture.hlsl_register_t_n = 1;
+            desc.views[8].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[8].storage_buffer.readonly = true;
+            desc.views[8].storage_buffer.hlsl_register_t_n = 2;
+            desc.samplers[2].stage = SG_SHADERSTAGE_COMPUTE;
+            desc.samplers[2].sampler_type = SG_SAMPLERTYPE_NONFILTERING;
+            desc.samplers[2].hlsl_register_s_n = 2;
+            desc.texture_sampler_pairs[0].stage = SG_SHADERSTAGE_COMPUTE;
+            desc.texture_sampler_pairs[0].view_slot = 6;
+            desc.texture_sampler_pairs[0].sampler_slot = 2;
+            desc.label = "select_score_buffer_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_METAL_MACOS) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.compute_func.source = (const char*)score_bins_buffer_source_metal_macos;
+            desc.compute_func.entry = "main0";
+            desc.mtl_threads_per_threadgroup.x = 256;
+            desc.mtl_threads_per_threadgroup.y = 1;
+            desc.mtl_threads_per_threadgroup.z = 1;
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_COMPUTE;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 128;
+            desc.uniform_blocks[0].msl_buffer_n = 0;
+            desc.views[3].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[3].storage_buffer.readonly = true;
+            desc.views[3].storage_buffer.msl_buffer_n = 8;
+            desc.views[4].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[4].storage_buffer.readonly = false;
+            desc.views[4].storage_buffer.msl_buffer_n = 9;
+            desc.views[5].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[5].storage_buffer.readonly = false;
+            desc.views[5].storage_buffer.msl_buffer_n = 10;
+            desc.views[6].texture.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[6].texture.image_type = SG_IMAGETYPE_2D;
+            desc.views[6].texture.sample_type = SG_IMAGESAMPLETYPE_UNFILTERABLE_FLOAT;
+            desc.views[6].texture.multisampled = false;
+            desc.views[6].texture.msl_texture_n = 0;
+            desc.views[8].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[8].storage_buffer.readonly = true;
+            desc.views[8].storage_buffer.msl_buffer_n = 11;
+            desc.samplers[2].stage = SG_SHADERSTAGE_COMPUTE;
+            desc.samplers[2].sampler_type = SG_SAMPLERTYPE_NONFILTERING;
+            desc.samplers[2].msl_sampler_n = 2;
+            desc.texture_sampler_pairs[0].stage = SG_SHADERSTAGE_COMPUTE;
+            desc.texture_sampler_pairs[0].view_slot = 6;
+            desc.texture_sampler_pairs[0].sampler_slot = 2;
+            desc.label = "select_score_buffer_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_METAL_IOS) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.compute_func.source = (const char*)score_bins_buffer_source_metal_ios;
+            desc.compute_func.entry = "main0";
+            desc.mtl_threads_per_threadgroup.x = 256;
+            desc.mtl_threads_per_threadgroup.y = 1;
+            desc.mtl_threads_per_threadgroup.z = 1;
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_COMPUTE;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 128;
+            desc.uniform_blocks[0].msl_buffer_n = 0;
+            desc.views[3].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[3].storage_buffer.readonly = true;
+            desc.views[3].storage_buffer.msl_buffer_n = 8;
+            desc.views[4].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[4].storage_buffer.readonly = false;
+            desc.views[4].storage_buffer.msl_buffer_n = 9;
+            desc.views[5].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[5].storage_buffer.readonly = false;
+            desc.views[5].storage_buffer.msl_buffer_n = 10;
+            desc.views[6].texture.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[6].texture.image_type = SG_IMAGETYPE_2D;
+            desc.views[6].texture.sample_type = SG_IMAGESAMPLETYPE_UNFILTERABLE_FLOAT;
+            desc.views[6].texture.multisampled = false;
+            desc.views[6].texture.msl_texture_n = 0;
+            desc.views[8].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[8].storage_buffer.readonly = true;
+            desc.views[8].storage_buffer.msl_buffer_n = 11;
+            desc.samplers[2].stage = SG_SHADERSTAGE_COMPUTE;
+            desc.samplers[2].sampler_type = SG_SAMPLERTYPE_NONFILTERING;
+            desc.samplers[2].msl_sampler_n = 2;
+            desc.texture_sampler_pairs[0].stage = SG_SHADERSTAGE_COMPUTE;
+            desc.texture_sampler_pairs[0].view_slot = 6;
+            desc.texture_sampler_pairs[0].sampler_slot = 2;
+            desc.label = "select_score_buffer_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_METAL_SIMULATOR) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.compute_func.source = (const char*)score_bins_buffer_source_metal_sim;
+            desc.compute_func.entry = "main0";
+            desc.mtl_threads_per_threadgroup.x = 256;
+            desc.mtl_threads_per_threadgroup.y = 1;
+            desc.mtl_threads_per_threadgroup.z = 1;
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_COMPUTE;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 128;
+            desc.uniform_blocks[0].msl_buffer_n = 0;
+            desc.views[3].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[3].storage_buffer.readonly = true;
+            desc.views[3].storage_buffer.msl_buffer_n = 8;
+            desc.views[4].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[4].storage_buffer.readonly = false;
+            desc.views[4].storage_buffer.msl_buffer_n = 9;
+            desc.views[5].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[5].storage_buffer.readonly = false;
+            desc.views[5].storage_buffer.msl_buffer_n = 10;
+            desc.views[6].texture.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[6].texture.image_type = SG_IMAGETYPE_2D;
+            desc.views[6].texture.sample_type = SG_IMAGESAMPLETYPE_UNFILTERABLE_FLOAT;
+            desc.views[6].texture.multisampled = false;
+            desc.views[6].texture.msl_texture_n = 0;
+            desc.views[8].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[8].storage_buffer.readonly = true;
+            desc.views[8].storage_buffer.msl_buffer_n = 11;
+            desc.samplers[2].stage = SG_SHADERSTAGE_COMPUTE;
+            desc.samplers[2].sampler_type = SG_SAMPLERTYPE_NONFILTERING;
+            desc.samplers[2].msl_sampler_n = 2;
+            desc.texture_sampler_pairs[0].stage = SG_SHADERSTAGE_COMPUTE;
+            desc.texture_sampler_pairs[0].view_slot = 6;
+            desc.texture_sampler_pairs[0].sampler_slot = 2;
+            desc.label = "select_score_buffer_shader";
+        }
+        return &desc;
+    }
+    return 0;
+}
+static inline const sg_shader_desc* select_threshold_shader_desc(sg_backend backend) {
+    if (backend == SG_BACKEND_GLCORE) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.compute_func.source = (const char*)find_threshold_source_glsl410;
+            desc.compute_func.entry = "main";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_COMPUTE;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 128;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "_40.viewProj_row0";
+            desc.uniform_blocks[0].glsl_uniforms[1].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[1].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[1].glsl_name = "_40.viewProj_row1";
+            desc.uniform_blocks[0].glsl_uniforms[2].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[2].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[2].glsl_name = "_40.viewProj_row2";
+            desc.uniform_blocks[0].glsl_uniforms[3].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[3].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[3].glsl_name = "_40.viewProj_row3";
+            desc.uniform_blocks[0].glsl_uniforms[4].type = SG_UNIFORMTYPE_FLOAT3;
+            desc.uniform_blocks[0].glsl_uniforms[4].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[4].glsl_name = "_40.camera_position";
+            desc.uniform_blocks[0].glsl_uniforms[5].type = SG_UNIFORMTYPE_FLOAT;
+            desc.uniform_blocks[0].glsl_uniforms[5].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[5].glsl_name = "_40.focal_px";
+            desc.uniform_blocks[0].glsl_uniforms[6].type = SG_UNIFORMTYPE_FLOAT3;
+            desc.uniform_blocks[0].glsl_uniforms[6].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[6].glsl_name = "_40.camera_forward";
+            desc.uniform_blocks[0].glsl_uniforms[7].type = SG_UNIFORMTYPE_FLOAT;
+            desc.uniform_blocks[0].glsl_uniforms[7].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[7].glsl_name = "_40.viewport_width";
+            desc.uniform_blocks[0].glsl_uniforms[8].type = SG_UNIFORMTYPE_FLOAT;
+            desc.uniform_blocks[0].glsl_uniforms[8].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[8].glsl_name = "_40.viewport_height";
+            desc.uniform_blocks[0].glsl_uniforms[9].type = SG_UNIFORMTYPE_INT;
+            desc.uniform_blocks[0].glsl_uniforms[9].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[9].glsl_name = "_40.candidate_count";
+            desc.uniform_blocks[0].glsl_uniforms[10].type = SG_UNIFORMTYPE_INT;
+            desc.uniform_blocks[0].glsl_uniforms[10].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[10].glsl_name = "_40.use_candidates";
+            desc.uniform_blocks[0].glsl_uniforms[11].type = SG_UNIFORMTYPE_INT;
+            desc.uniform_blocks[0].glsl_uniforms[11].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[11].glsl_name = "_40.budget";
+            desc.uniform_blocks[0].glsl_uniforms[12].type = SG_UNIFORMTYPE_INT;
+            desc.uniform_blocks[0].glsl_uniforms[12].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[12].glsl_name = "_40.texture_width";
+            desc.uniform_blocks[0].glsl_uniforms[13].type = SG_UNIFORMTYPE_INT;
+            desc.uniform_blocks[0].glsl_uniforms[13].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[13].glsl_name = "_40.splats_per_layer";
+            desc.views[5].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[5].storage_buffer.readonly = false;
+            desc.views[5].storage_buffer.glsl_binding_n = 5;
+            desc.label = "select_threshold_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_GLES3) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.compute_func.source = (const char*)find_threshold_source_glsl310es;
+            desc.compute_func.entry = "main";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_COMPUTE;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 128;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "_40.viewProj_row0";
+            desc.uniform_blocks[0].glsl_uniforms[1].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[1].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[1].glsl_name = "_40.viewProj_row1";
+            desc.uniform_blocks[0].glsl_uniforms[2].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[2].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[2].glsl_name = "_40.viewProj_row2";
+            desc.uniform_blocks[0].glsl_uniforms[3].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[3].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[3].glsl_name = "_40.viewProj_row3";
+            desc.uniform_blocks[0].glsl_uniforms[4].type = SG_UNIFORMTYPE_FLOAT3;
+            desc.uniform_blocks[0].glsl_uniforms[4].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[4].glsl_name = "_40.camera_position";
+            desc.uniform_blocks[0].glsl_uniforms[5].type = SG_UNIFORMTYPE_FLOAT;
+            desc.uniform_blocks[0].glsl_uniforms[5].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[5].glsl_name = "_40.focal_px";
+            desc.uniform_blocks[0].glsl_uniforms[6].type = SG_UNIFORMTYPE_FLOAT3;
+            desc.uniform_blocks[0].glsl_uniforms[6].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[6].glsl_name = "_40.camera_forward";
+            desc.uniform_blocks[0].glsl_uniforms[7].type = SG_UNIFORMTYPE_FLOAT;
+            desc.uniform_blocks[0].glsl_uniforms[7].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[7].glsl_name = "_40.viewport_width";
+            desc.uniform_blocks[0].glsl_uniforms[8].type = SG_UNIFORMTYPE_FLOAT;
+            desc.uniform_blocks[0].glsl_uniforms[8].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[8].glsl_name = "_40.viewport_height";
+            desc.uniform_blocks[0].glsl_uniforms[9].type = SG_UNIFORMTYPE_INT;
+            desc.uniform_blocks[0].glsl_uniforms[9].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[9].glsl_name = "_40.candidate_count";
+            desc.uniform_blocks[0].glsl_uniforms[10].type = SG_UNIFORMTYPE_INT;
+            desc.uniform_blocks[0].glsl_uniforms[10].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[10].glsl_name = "_40.use_candidates";
+            desc.uniform_blocks[0].glsl_uniforms[11].type = SG_UNIFORMTYPE_INT;
+            desc.uniform_blocks[0].glsl_uniforms[11].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[11].glsl_name = "_40.budget";
+            desc.uniform_blocks[0].glsl_uniforms[12].type = SG_UNIFORMTYPE_INT;
+            desc.uniform_blocks[0].glsl_uniforms[12].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[12].glsl_name = "_40.texture_width";
+            desc.uniform_blocks[0].glsl_uniforms[13].type = SG_UNIFORMTYPE_INT;
+            desc.uniform_blocks[0].glsl_uniforms[13].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[13].glsl_name = "_40.splats_per_layer";
+            desc.views[5].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[5].storage_buffer.readonly = false;
+            desc.views[5].storage_buffer.glsl_binding_n = 5;
+            desc.label = "select_threshold_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_D3D11) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.compute_func.source = (const char*)find_threshold_source_hlsl5;
+            desc.compute_func.d3d11_target = "cs_5_0";
+            desc.compute_func.entry = "main";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_COMPUTE;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 128;
+            desc.uniform_blocks[0].hlsl_register_b_n = 0;
+            desc.views[5].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[5].storage_buffer.readonly = false;
+            desc.views[5].storage_buffer.hlsl_register_u_n = 0;
+            desc.label = "select_threshold_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_METAL_MACOS) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.compute_func.source = (const char*)find_threshold_source_metal_macos;
+            desc.compute_func.entry = "main0";
+            desc.mtl_threads_per_threadgroup.x = 1;
+            desc.mtl_threads_per_threadgroup.y = 1;
+            desc.mtl_threads_per_threadgroup.z = 1;
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_COMPUTE;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 128;
+            desc.uniform_blocks[0].msl_buffer_n = 0;
+            desc.views[5].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[5].storage_buffer.readonly = false;
+            desc.views[5].storage_buffer.msl_buffer_n = 8;
+            desc.label = "select_threshold_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_METAL_IOS) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.compute_func.source = (const char*)find_threshold_source_metal_ios;
+            desc.compute_func.entry = "main0";
+            desc.mtl_threads_per_threadgroup.x = 1;
+            desc.mtl_threads_per_threadgroup.y = 1;
+            desc.mtl_threads_per_threadgroup.z = 1;
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_COMPUTE;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 128;
+            desc.uniform_blocks[0].msl_buffer_n = 0;
+            desc.views[5].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[5].storage_buffer.readonly = false;
+            desc.views[5].storage_buffer.msl_buffer_n = 8;
+            desc.label = "select_threshold_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_METAL_SIMULATOR) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.compute_func.source = (const char*)find_threshold_source_metal_sim;
+            desc.compute_func.entry = "main0";
+            desc.mtl_threads_per_threadgroup.x = 1;
+            desc.mtl_threads_per_threadgroup.y = 1;
+            desc.mtl_threads_per_threadgroup.z = 1;
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_COMPUTE;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 128;
+            desc.uniform_blocks[0].msl_buffer_n = 0;
+            desc.views[5].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[5].storage_buffer.readonly = false;
+            desc.views[5].storage_buffer.msl_buffer_n = 8;
+            desc.label = "select_threshold_shader";
+        }
+        return &desc;
+    }
+    return 0;
+}
+static inline const sg_shader_desc* select_compact_shader_desc(sg_backend backend) {
+    if (backend == SG_BACKEND_GLCORE) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.compute_func.source = (const char*)compact_selected_source_glsl410;
+            desc.compute_func.entry = "main";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_COMPUTE;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 128;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "_40.viewProj_row0";
+            desc.uniform_blocks[0].glsl_uniforms[1].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[1].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[1].glsl_name = "_40.viewProj_row1";
+            desc.uniform_blocks[0].glsl_uniforms[2].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[2].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[2].glsl_name = "_40.viewProj_row2";
+            desc.uniform_blocks[0].glsl_uniforms[3].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[3].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[3].glsl_name = "_40.viewProj_row3";
+            desc.uniform_blocks[0].glsl_uniforms[4].type = SG_UNIFORMTYPE_FLOAT3;
+            desc.uniform_blocks[0].glsl_uniforms[4].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[4].glsl_name = "_40.camera_position";
+            desc.uniform_blocks[0].glsl_uniforms[5].type = SG_UNIFORMTYPE_FLOAT;
+            desc.uniform_blocks[0].glsl_uniforms[5].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[5].glsl_name = "_40.focal_px";
+            desc.uniform_blocks[0].glsl_uniforms[6].type = SG_UNIFORMTYPE_FLOAT3;
+            desc.uniform_blocks[0].glsl_uniforms[6].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[6].glsl_name = "_40.camera_forward";
+            desc.uniform_blocks[0].glsl_uniforms[7].type = SG_UNIFORMTYPE_FLOAT;
+            desc.uniform_blocks[0].glsl_uniforms[7].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[7].glsl_name = "_40.viewport_width";
+            desc.uniform_blocks[0].glsl_uniforms[8].type = SG_UNIFORMTYPE_FLOAT;
+            desc.uniform_blocks[0].glsl_uniforms[8].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[8].glsl_name = "_40.viewport_height";
+            desc.uniform_blocks[0].glsl_uniforms[9].type = SG_UNIFORMTYPE_INT;
+            desc.uniform_blocks[0].glsl_uniforms[9].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[9].glsl_name = "_40.candidate_count";
+            desc.uniform_blocks[0].glsl_uniforms[10].type = SG_UNIFORMTYPE_INT;
+            desc.uniform_blocks[0].glsl_uniforms[10].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[10].glsl_name = "_40.use_candidates";
+            desc.uniform_blocks[0].glsl_uniforms[11].type = SG_UNIFORMTYPE_INT;
+            desc.uniform_blocks[0].glsl_uniforms[11].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[11].glsl_name = "_40.budget";
+            desc.uniform_blocks[0].glsl_uniforms[12].type = SG_UNIFORMTYPE_INT;
+            desc.uniform_blocks[0].glsl_uniforms[12].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[12].glsl_name = "_40.texture_width";
+            desc.uniform_blocks[0].glsl_uniforms[13].type = SG_UNIFORMTYPE_INT;
+            desc.uniform_blocks[0].glsl_uniforms[13].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[13].glsl_name = "_40.splats_per_layer";
+            desc.views[3].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[3].storage_buffer.readonly = true;
+            desc.views[3].storage_buffer.glsl_binding_n = 3;
+            desc.views[4].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[4].storage_buffer.readonly = false;
+            desc.views[4].storage_buffer.glsl_binding_n = 4;
+            desc.views[5].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[5].storage_buffer.readonly = false;
+            desc.views[5].storage_buffer.glsl_binding_n = 5;
+            desc.views[7].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[7].storage_buffer.readonly = false;
+            desc.views[7].storage_buffer.glsl_binding_n = 7;
+            desc.label = "select_compact_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_GLES3) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.compute_func.source = (const char*)compact_selected_source_glsl310es;
+            desc.compute_func.entry = "main";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_COMPUTE;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 128;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "_40.viewProj_row0";
+            desc.uniform_blocks[0].glsl_uniforms[1].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[1].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[1].glsl_name = "_40.viewProj_row1";
+            desc.uniform_blocks[0].glsl_uniforms[2].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[2].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[2].glsl_name = "_40.viewProj_row2";
+            desc.uniform_blocks[0].glsl_uniforms[3].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[3].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[3].glsl_name = "_40.viewProj_row3";
+            desc.uniform_blocks[0].glsl_uniforms[4].type = SG_UNIFORMTYPE_FLOAT3;
+            desc.uniform_blocks[0].glsl_uniforms[4].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[4].glsl_name = "_40.camera_position";
+            desc.uniform_blocks[0].glsl_uniforms[5].type = SG_UNIFORMTYPE_FLOAT;
+            desc.uniform_blocks[0].glsl_uniforms[5].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[5].glsl_name = "_40.focal_px";
+            desc.uniform_blocks[0].glsl_uniforms[6].type = SG_UNIFORMTYPE_FLOAT3;
+            desc.uniform_blocks[0].glsl_uniforms[6].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[6].glsl_name = "_40.camera_forward";
+            desc.uniform_blocks[0].glsl_uniforms[7].type = SG_UNIFORMTYPE_FLOAT;
+            desc.uniform_blocks[0].glsl_uniforms[7].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[7].glsl_name = "_40.viewport_width";
+            desc.uniform_blocks[0].glsl_uniforms[8].type = SG_UNIFORMTYPE_FLOAT;
+            desc.uniform_blocks[0].glsl_uniforms[8].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[8].glsl_name = "_40.viewport_height";
+            desc.uniform_blocks[0].glsl_uniforms[9].type = SG_UNIFORMTYPE_INT;
+            desc.uniform_blocks[0].glsl_uniforms[9].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[9].glsl_name = "_40.candidate_count";
+            desc.uniform_blocks[0].glsl_uniforms[10].type = SG_UNIFORMTYPE_INT;
+            desc.uniform_blocks[0].glsl_uniforms[10].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[10].glsl_name = "_40.use_candidates";
+            desc.uniform_blocks[0].glsl_uniforms[11].type = SG_UNIFORMTYPE_INT;
+            desc.uniform_blocks[0].glsl_uniforms[11].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[11].glsl_name = "_40.budget";
+            desc.uniform_blocks[0].glsl_uniforms[12].type = SG_UNIFORMTYPE_INT;
+            desc.uniform_blocks[0].glsl_uniforms[12].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[12].glsl_name = "_40.texture_width";
+            desc.uniform_blocks[0].glsl_uniforms[13].type = SG_UNIFORMTYPE_INT;
+            desc.uniform_blocks[0].glsl_uniforms[13].array_count = 0;
+            desc.uniform_blocks[0].glsl_uniforms[13].glsl_name = "_40.splats_per_layer";
+            desc.views[3].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[3].storage_buffer.readonly = true;
+            desc.views[3].storage_buffer.glsl_binding_n = 3;
+            desc.views[4].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[4].storage_buffer.readonly = false;
+            desc.views[4].storage_buffer.glsl_binding_n = 4;
+            desc.views[5].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[5].storage_buffer.readonly = false;
+            desc.views[5].storage_buffer.glsl_binding_n = 5;
+            desc.views[7].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[7].storage_buffer.readonly = false;
+            desc.views[7].storage_buffer.glsl_binding_n = 7;
+            desc.label = "select_compact_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_D3D11) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.compute_func.source = (const char*)compact_selected_source_hlsl5;
+            desc.compute_func.d3d11_target = "cs_5_0";
+            desc.compute_func.entry = "main";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_COMPUTE;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 128;
+            desc.uniform_blocks[0].hlsl_register_b_n = 0;
+            desc.views[3].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[3].storage_buffer.readonly = true;
+            desc.views[3].storage_buffer.hlsl_register_t_n = 0;
+            desc.views[4].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[4].storage_buffer.readonly = false;
+            desc.views[4].storage_buffer.hlsl_register_u_n = 0;
+            desc.views[5].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[5].storage_buffer.readonly = false;
+            desc.views[5].storage_buffer.hlsl_register_u_n = 1;
+            desc.views[7].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[7].storage_buffer.readonly = false;
+            desc.views[7].storage_buffer.hlsl_register_u_n = 2;
+            desc.label = "select_compact_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_METAL_MACOS) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.compute_func.source = (const char*)compact_selected_source_metal_macos;
+            desc.compute_func.entry = "main0";
+            desc.mtl_threads_per_threadgroup.x = 256;
+            desc.mtl_threads_per_threadgroup.y = 1;
+            desc.mtl_threads_per_threadgroup.z = 1;
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_COMPUTE;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 128;
+            desc.uniform_blocks[0].msl_buffer_n = 0;
+            desc.views[3].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[3].storage_buffer.readonly = true;
+            desc.views[3].storage_buffer.msl_buffer_n = 8;
+            desc.views[4].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[4].storage_buffer.readonly = false;
+            desc.views[4].storage_buffer.msl_buffer_n = 9;
+            desc.views[5].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[5].storage_buffer.readonly = false;
+            desc.views[5].storage_buffer.msl_buffer_n = 10;
+            desc.views[7].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[7].storage_buffer.readonly = false;
+            desc.views[7].storage_buffer.msl_buffer_n = 11;
+            desc.label = "select_compact_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_METAL_IOS) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.compute_func.source = (const char*)compact_selected_source_metal_ios;
+            desc.compute_func.entry = "main0";
+            desc.mtl_threads_per_threadgroup.x = 256;
+            desc.mtl_threads_per_threadgroup.y = 1;
+            desc.mtl_threads_per_threadgroup.z = 1;
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_COMPUTE;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 128;
+            desc.uniform_blocks[0].msl_buffer_n = 0;
+            desc.views[3].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[3].storage_buffer.readonly = true;
+            desc.views[3].storage_buffer.msl_buffer_n = 8;
+            desc.views[4].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[4].storage_buffer.readonly = false;
+            desc.views[4].storage_buffer.msl_buffer_n = 9;
+            desc.views[5].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[5].storage_buffer.readonly = false;
+            desc.views[5].storage_buffer.msl_buffer_n = 10;
+            desc.views[7].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[7].storage_buffer.readonly = false;
+            desc.views[7].storage_buffer.msl_buffer_n = 11;
+            desc.label = "select_compact_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_METAL_SIMULATOR) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.compute_func.source = (const char*)compact_selected_source_metal_sim;
+            desc.compute_func.entry = "main0";
+            desc.mtl_threads_per_threadgroup.x = 256;
+            desc.mtl_threads_per_threadgroup.y = 1;
+            desc.mtl_threads_per_threadgroup.z = 1;
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_COMPUTE;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 128;
+            desc.uniform_blocks[0].msl_buffer_n = 0;
+            desc.views[3].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[3].storage_buffer.readonly = true;
+            desc.views[3].storage_buffer.msl_buffer_n = 8;
+            desc.views[4].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[4].storage_buffer.readonly = false;
+            desc.views[4].storage_buffer.msl_buffer_n = 9;
+            desc.views[5].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[5].storage_buffer.readonly = false;
+            desc.views[5].storage_buffer.msl_buffer_n = 10;
+            desc.views[7].storage_buffer.stage = SG_SHADERSTAGE_COMPUTE;
+            desc.views[7].storage_buffer.readonly = false;
+            desc.views[7].storage_buffer.msl_buffer_n = 11;
+            desc.label = "select_compact_shader";
+        }
+        return &desc;
+    }
+    return 0;
+}
@@ -1,4 +1,6 @@
-@vs vs
+// Shared by the texture array (vs) and storage buffer (vs_buffer) vertex shaders, which only differ
+// in how fetch_splat and fetch_covariance read a splat
+@block vs_common
 in vec2 position;
 in uint sorted_index;  // Per-instance vertex attribute from sorted index buffer
 
@@ -8,19 +10,23 @@ out vec2 quad_coord;
 layout(binding = 0) uniform vs_params {
     mat4 viewMat;
     mat4 projMat;
-    vec3 bounds_min;
-    vec3 bounds_max;
-    vec3 bounds_size;
     int texture_width;
     int texture_height;
     int splats_per_layer;
+    int splat_layout; // splat_layout_t
+    int use_covariance;
 };
 
-@image_sample_type splat_texture uint
-layout(binding = 1) uniform utexture2DArray splat_texture;
 @sampler_type splat_sampler nonfiltering
 layout(binding = 2) uniform sampler splat_sampler;
 
+// Per-chunk position bounds, two texels (min, max) per chunk of 256 splats, see splat_chunk_t
+@image_sample_type chunk_texture unfilterable_float
+layout(binding = 6) uniform texture2D chunk_texture;
+
+const int CHUNK_SIZE = 256;
+const int CHUNKS_PER_ROW = 1024;
+
 vec3 octahedral_decode(vec2 f) {
     f = f * 2.0 - 1.0;
     vec3 n = vec3(f.x, f.y, 1.0 - abs(f.x) - abs(f.y));
@@ -29,6 +35,17 @@ vec3 octahedral_decode(vec2 f) {
     return normalize(n);
 }
 
+// Smallest-three quaternion, see quat_decode_smallest_three: the largest component is rebuilt with one sqrt
+vec4 decode_smallest_three(uint q) {
+    uint largest = q & 3u;
+    vec3 small = (vec3(uvec3(q >> 2u, q >> 12u, q >> 22u) & 0x3FFu) - 512.0) * (1.0 / 512.0);
+    float w = sqrt(max(0.0, 1.0 - dot(small, small)));
+    if (largest == 0u) return vec4(w, small);
+    if (largest == 1u) return vec4(small.x, w, small.yz);
+    if (largest == 2u) return vec4(small.xy, w, small.z);
+    return vec4(small, w);
+}
+
 mat3 quat_to_mat3(vec4 q) {
     // Pre-compute common terms
     float qxx = q.x * q.x;
@@ -47,23 +64,15 @@ mat3 quat_to_mat3(vec4 q) {
         2.0 * (qxz - qwy), 2.0 * (qyz + qwx), 1.0 - 2.0 * (qxx + qyy)
     );
 }
+@end
 
+@block vs_main
 void main() {
     // Use sorted index from vertex attribute (provided by index buffer as per-instance data)
     int splat_idx = int(sorted_index);
     
-    // Calculate texture coordinates - avoid modulo for better performance
-    int layer = splat_idx / splats_per_layer;
-    int pixel_in_layer = splat_idx - (layer * splats_per_layer);
-    int pixel_x = pixel_in_layer % texture_width;
-    int pixel_y = pixel_in_layer / texture_width;
-    
-    // Single texture fetch - all splat data in one RGBA32UI pixel
-    uvec4 packed = texelFetch(
-        usampler2DArray(splat_texture, splat_sampler), 
-        ivec3(pixel_x, pixel_y, layer), 
-        0
-    );
+    // Single fetch - all splat data in one RGBA32UI texel
+    uvec4 packed = fetch_splat(splat_idx);
     
     // Early alpha test - skip expensive unpacking for transparent splats
     uint alpha = packed.a & 0xFFu;
@@ -80,29 +89,53 @@ void main() {
         float((packed.g >> 16u) & 0xFFFFu)
     ) * inv_65535;
     
-    vec3 splat_pos = bounds_min + norm_pos * bounds_size;
+    // Dequantize with the bounds of the splat's chunk
+    int chunk = splat_idx / CHUNK_SIZE;
+    ivec2 chunk_texel = ivec2((chunk % CHUNKS_PER_ROW) * 2, chunk / CHUNKS_PER_ROW);
+    vec3 chunk_min = texelFetch(sampler2D(chunk_texture, splat_sampler), chunk_texel, 0).xyz;
+    vec3 chunk_max = texelFetch(sampler2D(chunk_texture, splat_sampler), chunk_texel + ivec2(1, 0), 0).xyz;
+    vec3 splat_pos = chunk_min + norm_pos * (chunk_max - chunk_min);
     
-    // Unpack rotation - octahedral encoded axis + angle
+    // Quad axes - precomputed, or decoded from rotation and scale (uniform branches)
     const float inv_255 = 1.0 / 255.0;
-    vec2 oct = vec2(
-        float((packed.g >> 8u) & 0xFFu),
-        float(packed.g & 0xFFu)
-    ) * inv_255;
-    
-    float angle = (float((packed.b >> 24u) & 0xFFu) * inv_255) * 3.14159265359;
-    vec3 axis = octahedral_decode(oct);
-    
-    // Build quaternion inline - avoid function call overhead
-    float half_angle = angle * 0.5;
-    float s = sin(half_angle);
-    vec4 quat = vec4(axis * s, cos(half_angle));
-    
-    // Unpack scale - log encoded
-    vec3 scale = exp(vec3(
-        float((packed.b >> 16u) & 0xFFu),
-        float((packed.b >> 8u) & 0xFFu),
-        float(packed.b & 0xFFu)
-    ) * (1.0 / 25.5) - 5.0);
+    vec3 offset;
+    if (use_covariance != 0) {
+        uvec4 axes = fetch_covariance(splat_idx);
+        vec2 h0 = unpackHalf2x16(axes.r);
+        vec2 h1 = unpackHalf2x16(axes.g);
+        vec2 h2 = unpackHalf2x16(axes.b);
+        offset = position.x * vec3(h0, h1.x) + position.y * vec3(h1.y, h2);
+    } else {
+        // Unpack rotation - uniform branch on the layout
+        vec4 quat;
+        if (splat_layout == 1) {
+            // Smallest-three quaternion, low half under pos_z, high half in the angle and z scale bytes
+            uint q = (packed.g & 0xFFFFu) | (((packed.b >> 24u) & 0xFFu) << 16u) | ((packed.b & 0xFFu) << 24u);
+            quat = decode_smallest_three(q);
+        } else {
+            // Octahedral encoded axis + angle
+            vec2 oct = vec2(
+                float((packed.g >> 8u) & 0xFFu),
+                float(packed.g & 0xFFu)
+            ) * inv_255;
+            
+            float angle = (float((packed.b >> 24u) & 0xFFu) * inv_255) * 3.14159265359;
+            vec3 axis = octahedral_decode(oct);
+            
+            // Build quaternion inline - avoid function call overhead
+            float half_angle = angle * 0.5;
+            float s = sin(half_angle);
+            quat = vec4(axis * s, cos(half_angle));
+        }
+        
+        // Unpack scale - log encoded, only x and y span the quad
+        vec2 scale = exp(vec2(
+            float((packed.b >> 16u) & 0xFFu),
+            float((packed.b >> 8u) & 0xFFu)
+        ) * (1.0 / 25.5) - 5.0);
+        
+        offset = quat_to_mat3(quat) * vec3(position * scale, 0.0);
+    }
     
     // Unpack color
     color = vec4(
@@ -112,8 +145,7 @@ void main() {
         float(alpha)
     ) * inv_255;
     
-    mat3 rot_mat = quat_to_mat3(quat);
-    vec3 world_pos = splat_pos + rot_mat * (vec3(position, 0.0) * scale);
+    vec3 world_pos = splat_pos + offset;
     
     vec4 view_pos = viewMat * vec4(world_pos, 1.0);
     gl_Position = projMat * view_pos;
@@ -122,6 +154,63 @@ void main() {
 }
 @end
 
+@vs vs
+@include_block vs_common
+
+// Texture array path (no storage buffers, e.g. WebGL2)
+@image_sample_type splat_texture uint
+layout(binding = 1) uniform utexture2DArray splat_texture;
+
+// Scaled quad axes as half floats, see convert_splats_to_covariance_data; a stub unless use_covariance
+@image_sample_type covariance_texture uint
+layout(binding = 7) uniform utexture2DArray covariance_texture;
+
+ivec3 splat_texel(int splat_idx) {
+    // Calculate texture coordinates - avoid modulo for better performance
+    int layer = splat_idx / splats_per_layer;
+    int pixel_in_layer = splat_idx - (layer * splats_per_layer);
+    return ivec3(pixel_in_layer % texture_width, pixel_in_layer / texture_width, layer);
+}
+
+uvec4 fetch_splat(int splat_idx) {
+    return texelFetch(usampler2DArray(splat_texture, splat_sampler), splat_texel(splat_idx), 0);
+}
+
+uvec4 fetch_covariance(int splat_idx) {
+    return texelFetch(usampler2DArray(covariance_texture, splat_sampler), splat_texel(splat_idx), 0);
+}
+
+@include_block vs_main
+@end
+
+@vs vs_buffer
+@include_block vs_common
+
+// Storage buffer path: one texel per splat, indexed directly by splat id
+struct SplatTexel {
+    uvec4 value;
+};
+
+layout(binding = 8) readonly buffer splat_buffer {
+    SplatTexel splats[];
+};
+
+// Same content as covariance_texture, a one-texel stub unless use_covariance
+layout(binding = 9) readonly buffer covariance_buffer {
+    SplatTexel covariance[];
+};
+
+uvec4 fetch_splat(int splat_idx) {
+    return splats[splat_idx].value;
+}
+
+uvec4 fetch_covariance(int splat_idx) {
+    return covariance[splat_idx].value;
+}
+
+@include_block vs_main
+@end
+
 
 @fs fs
 in vec4 color;
@@ -151,4 +240,5 @@ void main() {
 }
 @end
 
-@program quad vs fs
\ No newline at end of file
+@program quad vs fs
+@program quad_buffer vs_buffer fs
\ No newline at end of file
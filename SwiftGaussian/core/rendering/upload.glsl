@@ -0,0 +1,35 @@
+// Staged upload copy: one slice of the per-frame staging buffer into a splat storage buffer
+// The targets are immutable buffers created without data, so compute passes are the only way to fill them in parts.
+
+@cs upload_copy
+layout(local_size_x = 256, local_size_y = 1, local_size_z = 1) in;
+
+layout(binding=0) uniform upload_params {
+    int source_word; // word offsets
+    int target_word;
+    int word_count;
+    int _pad0;
+};
+
+struct UploadWord {
+    uint value;
+};
+
+layout(binding=14) readonly buffer upload_source {
+    UploadWord source_words[];
+};
+
+layout(binding=15) buffer upload_target {
+    UploadWord target_words[];
+};
+
+void main() {
+    uint i = gl_GlobalInvocationID.x;
+    if (i >= uint(word_count)) {
+        return;
+    }
+    target_words[uint(target_word) + i].value = source_words[uint(source_word) + i].value;
+}
+@end
+
+@program upload_copy upload_copy
@@ -3,21 +3,100 @@
 #include "rendering/splat.glsl.h"
 #include "rendering/depth.glsl.h"
 #include "rendering/sort.glsl.h"
+#include "rendering/select.glsl.h"
+#include "rendering/decode.glsl.h"
+#include "utils/core_memory.h"
 #include "utils/logger.h"
 #include "loader/spzloader.h"
+#include "loader/spzfile.h"
 #include "splat_texture.h"
+#include "cpu_renderer.h"
+#include "lod.h"
+#include "profiler.h"
+#include "splat_budget.h"
+#include "upload_queue.h"
 #include <assert.h>
 #include "utils/handmademath.h"
 #include "utils/quaternion.h"
+#include "utils/timer.h"
+#include "utils/trace.h"
 #include <memory.h>
 #include <stdlib.h>
 #include <stdint.h>
 #include <math.h>
 #include <float.h>
+#include <pthread.h>
+#include <stdatomic.h>
 
-#ifdef _OPENMP
-#include <omp.h>
-#endif
+// Splats per upload queue slice, the steps in which a budgeted upload becomes drawable
+#define UPLOAD_SLICE_SPLATS 65536
+
+// scene_load_progress_t.progress when inflating and decoding are done, the upload covers the rest
+#define LOAD_PROGRESS_INFLATED 0.4f
+#define LOAD_PROGRESS_DECODED 0.8f
+
+// Stack of the background load thread; secondary threads get 512 KB on iOS
+#define LOAD_THREAD_STACK_SIZE (8u << 20)
+
+// Where one part of a queued upload is converted to; covariance is NULL without a covariance texture
+typedef struct
+{
+    uint32_t *texels;
+    uint32_t *covariance;
+    uint32_t *positions;
+} staging_region_t;
+
+// decode.glsl and the SPZ planes it reads, kept across the batches of a progressive load
+typedef struct
+{
+    sg_buffer planes_buffer;
+    sg_buffer order_buffer;
+    sg_buffer chunk_buffer;
+    sg_view planes_view;
+    sg_view order_view;
+    sg_view chunk_view;
+    sg_shader shader;
+    sg_pipeline pipeline;
+} spz_gpu_decoder_t;
+
+// How a load turns SPZ data into GPU splats, chosen from the scene settings when it starts
+typedef enum
+{
+    SCENE_LOAD_PATH_CPU,         // parse to PackedSplat (and build LOD), upload texels
+    SCENE_LOAD_PATH_GPU,         // plan on the CPU, decode.glsl decodes every splat
+    SCENE_LOAD_PATH_PROGRESSIVE, // importance batches, one per frame, decoded on the CPU or the GPU
+} scene_load_path_t;
+
+// A load split at the thread boundary: prepare_scene_load does the CPU work on any thread,
+// apply_scene_load creates the GPU resources on the render thread
+typedef struct
+{
+    scene_load_path_t path;
+    spz_load_options_t options;
+    bool build_lod;
+    bool decode_on_gpu;
+
+    // SCENE_LOAD_PATH_CPU results; the progressive CPU path keeps zeroed storage for the scene in splats
+    PackedSplat *splats;
+    splat_chunk_t *chunks;
+    uint32_t splat_count;
+    BoundingBox bounds;
+    lod_tree_t lod_tree;
+    uint32_t *lod_indices;
+
+    // Decode plan of the GPU and progressive paths, planes is the progressive path's copy of the planes
+    // when the stream belongs to the caller
+    spz_decode_plan_t plan;
+    uint8_t *planes;
+    uint8_t *data; // inflated stream of a background load, the GPU and progressive plans point into it
+
+    // Transient buffers of the load: sort scratch while preparing, then upload staging once applied
+    arena_t arena;
+
+    spz_prune_stats_t prune_stats;
+    double prepare_ms;
+    double lod_ms;
+} scene_load_job_t;
 
 static struct
 {
@@ -29,34 +108,207 @@ static struct
 
     // Splat data as texture
     splat_texture_t splat_texture;
+    bool storage_buffer_splats; // splats in a storage buffer instead of a texture array, chosen by init_scene
 
     // Packed Gaussian splat data
     PackedSplat *packed_splats;
     uint32_t splat_count;
+    uint32_t splat_capacity; // splats the GPU buffers are sized for, above splat_count while a progressive load runs
     BoundingBox splat_bounds;
+    splat_chunk_t *splat_chunks; // quantization bounds, splat_chunk_count(splat_count) entries
+    splat_layout_t splat_layout; // rotation encoding of packed_splats
     bool splats_initialized;
 
+    // Texel copy of packed_splats for the CPU renderer, built on first use
+    uint32_t *cpu_texels;
+
+    // What is left of packed_splats once the load is complete; residency_applied once that happened
+    scene_splat_residency_t splat_residency;
+    bool residency_applied;
+
+    // x, y and z planes of splat_positions_count quantized positions: kept by the POSITIONS residency,
+    // or built from packed_splats on first use
+    uint16_t *splat_positions;
+    uint32_t splat_positions_count;
+
+    // The current load's arena, taken over from its job; freed once every splat is drawable
+    arena_t load_arena;
+
+    // Queued uploads convert splats [next, end) part by part into two staging regions of load_arena;
+    // a part is converted once less than a frame's budget is left in the queue
+    struct
+    {
+        uint32_t next;
+        uint32_t end;
+        uint32_t part_splats;
+        size_t part_bytes; // queued by the last part
+        uint32_t region;   // the one the next part goes into
+        staging_region_t regions[2];
+    } staging;
+
+    // Load-time pruning and ordering, applies to the next parse_spz_data
+    spz_load_options_t load_options;
+    spz_prune_stats_t prune_stats;
+    bool precompute_covariance; // applies to the next parse_spz_data
+    bool gpu_decode;            // applies to the next parse_spz_data
+    size_t upload_budget;       // bytes per frame through the upload queue, 0 uploads at load; applies to the next parse_spz_data
+    scene_load_stats_t load_stats;
+    double load_start_ms; // last parse_spz_data call, for first_frame_ms
+    bool first_frame_pending;
+
+    // Progressive load: importance batches, one per frame, into storage sized for the whole scene
+    struct
+    {
+        bool enabled; // applies to the next parse_spz_data
+        bool active;  // batches left to upload
+        bool on_gpu;  // decode.glsl writes each batch, otherwise the CPU decodes it
+        bool queued;  // CPU-decoded batches go through the upload queue, otherwise the prefix is re-uploaded
+        spz_decode_plan_t plan;
+        uint8_t *planes; // buffer the plan decodes from: its copy of the planes, or a background load's stream
+        uint32_t next_batch;
+        spz_gpu_decoder_t decoder;
+    } progressive;
+
+    // Background load (scene_load_async): the worker inflates and prepares job, render calls apply it
+    // once finished is set. Only the atomics are shared while the worker runs.
+    struct
+    {
+        bool running; // thread started and not joined
+        bool applied; // job applied, DONE is reported once every splat is drawable
+        pthread_t thread;
+        char *path;    // owned copies of the source
+        uint8_t *data;
+        size_t size;
+        scene_load_job_t job;
+        int result;
+        double start_ms;
+        scene_load_callback_t callback;
+        void *user_data;
+        atomic_bool finished;
+        atomic_bool cancelled;
+        atomic_int state;       // scene_load_state_t
+        _Atomic float progress; // while inflating and decoding
+    } async;
+
+    // Level of detail: merged parents are appended to packed_splats, each frame draws a cut
+    struct
+    {
+        bool enabled; // applies to the next parse_spz_data
+        lod_tree_t tree;
+        lod_select_params_t params;
+        lod_select_stats_t stats;
+    } lod;
+
+    // Frustum culling of whole chunks on the GPU path, when there is no LOD cut to do it
+    struct
+    {
+        bool enabled; // applies to the next parse_spz_data
+        uint32_t visible;
+    } chunk_culling;
+
+    // Splats keyed, sorted and drawn this frame (the LOD cut, the splats of visible chunks, or all splats)
+    uint32_t *active_indices; // NULL when every splat is active
+    uint32_t active_count;
+
+    // Global splat budget: above it only the highest scoring active splats are drawn
+    struct
+    {
+        uint32_t budget; // 0 for none
+        budget_stats_t stats;
+        uint32_t *cpu_indices; // CPU renderer survivors
+    } budget;
+    uint32_t draw_count; // active_count capped by the budget
+
     // Cached uniforms to avoid per-frame allocations
     vs_params_t vs_params;
     bool uniforms_dirty;
 
     struct
     {
-        sg_buffer depth_buffer;
+        sg_buffer depth_buffer; // indexed by splat id, plus one sentinel slot for sort padding
         sg_buffer index_buffer;
+        sg_buffer active_buffer; // active_indices when there are any, a stub otherwise
         uint32_t padded_splat_count;
 
         sg_view depth_buffer_view;
         sg_view index_buffer_view;
+        sg_view active_buffer_view;
+
+        // Budget selection: per-candidate bins, histogram + control words, survivors
+        sg_buffer bin_buffer;
+        sg_buffer select_state_buffer;
+        sg_buffer selected_buffer;
+        sg_view bin_buffer_view;
+        sg_view select_state_view;
+        sg_view selected_buffer_view;
+        sg_pipeline select_score_pip;
+        sg_pipeline select_threshold_pip;
+        sg_pipeline select_compact_pip;
+        sg_bindings select_score_bindings;
+        sg_bindings select_threshold_bindings;
+        sg_bindings select_compact_bindings;
+        sg_bindings depth_budget_bindings; // depth pass reading the survivors
 
         sg_bindings depth_bindings;
         sg_bindings sort_bindings;
 
         sg_pipeline compute_depth_pip;
         sg_pipeline compute_sort_pip;
+
+        // Pose of the last depth sort, reused while later cameras stay within sort_reuse_tolerance
+        bool sort_valid;
+        HMM_Vec3 sorted_position;
+        HMM_Vec3 sorted_forward;
+        float sort_reuse_tolerance;
+        scene_sort_stats_t sort_stats;
     } compute;
 
-} g_scene_state = {0};
+} g_scene_state = {.load_options = {.prune.min_opacity = SPZ_DEFAULT_MIN_OPACITY, .spatial_order = true},
+                 .lod.params.pixel_threshold = LOD_DEFAULT_PIXEL_THRESHOLD};
+
+// False when sokol is not set up or runs on the dummy backend (headless Linux);
+// the scene then keeps CPU data only and renders through cpu_render_splats.
+// SCENE_DUMMY_GPU (tools/profiler_test) keeps the GPU path on the dummy backend: sokol accepts and counts
+// every call and draws nothing.
+static bool gpu_available(void)
+{
+#ifdef SCENE_DUMMY_GPU
+    return sg_isvalid();
+#else
+    return sg_isvalid() && sg_query_backend() != SG_BACKEND_DUMMY;
+#endif
+}
+
+// Compute shaders and storage buffers; the dummy backend reports none, SCENE_DUMMY_GPU pretends it has them
+static bool compute_available(void)
+{
+#ifdef SCENE_DUMMY_GPU
+    if (sg_query_backend() == SG_BACKEND_DUMMY)
+    {
+        return true;
+    }
+#endif
+    return sg_query_features().compute;
+}
+
+// Backend to pick the generated shader descs for; the dummy backend has none and takes the GL ones
+static sg_backend shader_backend(void)
+{
+#ifdef SCENE_DUMMY_GPU
+    if (sg_query_backend() == SG_BACKEND_DUMMY)
+    {
+        return SG_BACKEND_GLCORE;
+    }
+#endif
+    return sg_query_backend();
+}
+
+// Defined with the SPZ loading below: render calls advance a progressive load by one batch
+// and copy the next part of the upload queue
+static void upload_next_progressive_batch(void);
+static void drain_splat_uploads(void);
+static void poll_async_scene_load(void);
+static void stop_async_scene_load(void);
 
 static uint32_t next_power_of_2(uint32_t n)
 {
@@ -71,19 +323,193 @@ static uint32_t next_power_of_2(uint32_t n)
     return n + 1;
 }
 
+// Binding slot of the packed splats: the texture array or the storage buffer variant of each shader
+static int splat_view_slot(void)
+{
+    return g_scene_state.storage_buffer_splats ? VIEW_splat_buffer : VIEW_splat_texture;
+}
+
+// Budget selection passes (select.glsl), created with the sort buffers since they share their size
+static void set_up_select_pipeline(void)
+{
+    uint32_t *zero_state = (uint32_t *)core_calloc(MEMORY_TAG_SORT, BUDGET_STATE_WORDS, sizeof(uint32_t));
+
+    g_scene_state.compute.bin_buffer = core_make_buffer(MEMORY_TAG_SORT, &(sg_buffer_desc){
+        .size = g_scene_state.splat_capacity * sizeof(uint32_t),
+        .usage = {.storage_buffer = true},
+        .label = "select-bin-buffer"});
+
+    // The threshold pass clears the histogram for the next frame, it only needs zeroing once
+    g_scene_state.compute.select_state_buffer = core_make_buffer(MEMORY_TAG_SORT, &(sg_buffer_desc){
+        .size = BUDGET_STATE_WORDS * sizeof(uint32_t),
+        .data = {.ptr = zero_state, .size = zero_state ? BUDGET_STATE_WORDS * sizeof(uint32_t) : 0},
+        .usage = {.storage_buffer = true},
+        .label = "select-state-buffer"});
+    core_free(zero_state);
+
+    g_scene_state.compute.selected_buffer = core_make_buffer(MEMORY_TAG_SORT, &(sg_buffer_desc){
+        .size = g_scene_state.splat_capacity * sizeof(uint32_t),
+        .usage = {.storage_buffer = true},
+        .label = "select-output-buffer"});
+
+    g_scene_state.compute.bin_buffer_view = sg_make_view(&(sg_view_desc){
+        .storage_buffer = {.buffer = g_scene_state.compute.bin_buffer},
+        .label = "select-bin-view"});
+    g_scene_state.compute.select_state_view = sg_make_view(&(sg_view_desc){
+        .storage_buffer = {.buffer = g_scene_state.compute.select_state_buffer},
+        .label = "select-state-view"});
+    g_scene_state.compute.selected_buffer_view = sg_make_view(&(sg_view_desc){
+        .storage_buffer = {.buffer = g_scene_state.compute.selected_buffer},
+        .label = "select-output-view"});
+
+    g_scene_state.compute.select_score_pip = sg_make_pipeline(&(sg_pipeline_desc){
+        .compute = true,
+        .shader = sg_make_shader(g_scene_state.storage_buffer_splats
+                                     ? select_score_buffer_shader_desc(shader_backend())
+                                     : select_score_shader_desc(shader_backend())),
+        .label = "select-score-pipeline"});
+    g_scene_state.compute.select_threshold_pip = sg_make_pipeline(&(sg_pipeline_desc){
+        .compute = true,
+        .shader = sg_make_shader(select_threshold_shader_desc(shader_backend())),
+        .label = "select-threshold-pipeline"});
+    g_scene_state.compute.select_compact_pip = sg_make_pipeline(&(sg_pipeline_desc){
+        .compute = true,
+        .shader = sg_make_shader(select_compact_shader_desc(shader_backend())),
+        .label = "select-compact-pipeline"});
+
+    // Candidates come from the active list when there is one, the stub is never read otherwise
+    g_scene_state.compute.select_score_bindings = (sg_bindings){
+        .views = {
+            [VIEW_chunk_texture] = g_scene_state.splat_texture.chunk_view,
+            [VIEW_candidate_input] = g_scene_state.compute.active_buffer_view,
+            [VIEW_bin_buffer] = g_scene_state.compute.bin_buffer_view,
+            [VIEW_select_state] = g_scene_state.compute.select_state_view},
+        .samplers = {[SMP_splat_sampler] = g_scene_state.splat_texture.sampler}};
+    g_scene_state.compute.select_score_bindings.views[splat_view_slot()] = g_scene_state.splat_texture.view;
+
+    g_scene_state.compute.select_threshold_bindings = (sg_bindings){
+        .views = {[VIEW_select_state] = g_scene_state.compute.select_state_view}};
+
+    g_scene_state.compute.select_compact_bindings = (sg_bindings){
+        .views = {
+            [VIEW_candidate_input] = g_scene_state.compute.active_buffer_view,
+            [VIEW_bin_buffer] = g_scene_state.compute.bin_buffer_view,
+            [VIEW_select_state] = g_scene_state.compute.select_state_view,
+            [VIEW_selected_output] = g_scene_state.compute.selected_buffer_view}};
+}
+
+// Score, threshold and compact the active splats down to the budget (inside the sort compute pass)
+static void dispatch_budget_select(Camera *camera, int width, int height)
+{
+    budget_view_t view;
+    budget_view_init(&view, camera, width, height);
+    const HMM_Mat4 *m = &view.view_proj;
+
+    select_params_t params = {
+        .viewProj_row0 = {m->Elements[0][0], m->Elements[1][0], m->Elements[2][0], m->Elements[3][0]},
+        .viewProj_row1 = {m->Elements[0][1], m->Elements[1][1], m->Elements[2][1], m->Elements[3][1]},
+        .viewProj_row2 = {m->Elements[0][2], m->Elements[1][2], m->Elements[2][2], m->Elements[3][2]},
+        .viewProj_row3 = {m->Elements[0][3], m->Elements[1][3], m->Elements[2][3], m->Elements[3][3]},
+        .camera_position = {view.camera_pos.X, view.camera_pos.Y, view.camera_pos.Z},
+        .focal_px = view.focal_px,
+        .camera_forward = {view.camera_forward.X, view.camera_forward.Y, view.camera_forward.Z},
+        .viewport_width = view.width,
+        .viewport_height = view.height,
+        .candidate_count = (int)g_scene_state.active_count,
+        .use_candidates = g_scene_state.active_indices ? 1 : 0,
+        .budget = (int)g_scene_state.budget.budget,
+        .texture_width = g_scene_state.splat_texture.width,
+        .splats_per_layer = g_scene_state.splat_texture.width * g_scene_state.splat_texture.height};
+
+    uint32_t num_work_groups = (g_scene_state.active_count + 255) / 256;
+
+    sg_apply_pipeline(g_scene_state.compute.select_score_pip);
+    sg_apply_uniforms(UB_select_params, &SG_RANGE(params));
+    sg_apply_bindings(&g_scene_state.compute.select_score_bindings);
+    sg_dispatch(num_work_groups, 1, 1);
+
+    sg_apply_pipeline(g_scene_state.compute.select_threshold_pip);
+    sg_apply_uniforms(UB_select_params, &SG_RANGE(params));
+    sg_apply_bindings(&g_scene_state.compute.select_threshold_bindings);
+    sg_dispatch(1, 1, 1);
+
+    sg_apply_pipeline(g_scene_state.compute.select_compact_pip);
+    sg_apply_uniforms(UB_select_params, &SG_RANGE(params));
+    sg_apply_bindings(&g_scene_state.compute.select_compact_bindings);
+    sg_dispatch(num_work_groups, 1, 1);
+
+    // Exactly budget candidates survive, the GPU does not report its threshold bin
+    g_scene_state.budget.stats = (budget_stats_t){
+        .candidates = g_scene_state.active_count,
+        .kept = g_scene_state.budget.budget,
+        .dropped = g_scene_state.active_count - g_scene_state.budget.budget};
+}
+
+// Destroy what set_up_compute_pipeline made for the previous scene; pipelines take their shaders along
+static void release_compute_resources(void)
+{
+    if (g_scene_state.compute.depth_buffer.id == SG_INVALID_ID)
+    {
+        return;
+    }
+    sg_pipeline pipelines[] = {g_scene_state.compute.compute_depth_pip, g_scene_state.compute.compute_sort_pip,
+                               g_scene_state.compute.select_score_pip, g_scene_state.compute.select_threshold_pip,
+                               g_scene_state.compute.select_compact_pip};
+    for (size_t i = 0; i < sizeof(pipelines) / sizeof(pipelines[0]); i++)
+    {
+        sg_shader shader = sg_query_pipeline_desc(pipelines[i]).shader;
+        sg_destroy_pipeline(pipelines[i]);
+        sg_destroy_shader(shader);
+    }
+    sg_view views[] = {g_scene_state.compute.depth_buffer_view, g_scene_state.compute.index_buffer_view,
+                       g_scene_state.compute.active_buffer_view, g_scene_state.compute.bin_buffer_view,
+                       g_scene_state.compute.select_state_view, g_scene_state.compute.selected_buffer_view};
+    for (size_t i = 0; i < sizeof(views) / sizeof(views[0]); i++)
+    {
+        sg_destroy_view(views[i]);
+    }
+    sg_buffer buffers[] = {g_scene_state.compute.depth_buffer, g_scene_state.compute.index_buffer,
+                           g_scene_state.compute.active_buffer, g_scene_state.compute.bin_buffer,
+                           g_scene_state.compute.select_state_buffer, g_scene_state.compute.selected_buffer};
+    for (size_t i = 0; i < sizeof(buffers) / sizeof(buffers[0]); i++)
+    {
+        core_destroy_buffer(MEMORY_TAG_SORT, buffers[i]);
+    }
+    g_scene_state.compute.depth_buffer.id = SG_INVALID_ID;
+}
+
+// Sort and budget buffers sized for splat_capacity, replacing those of the previous scene
 void set_up_compute_pipeline(void)
 {
-    g_scene_state.compute.padded_splat_count = next_power_of_2(g_scene_state.splat_count);
-    g_scene_state.compute.depth_buffer = sg_make_buffer(&(sg_buffer_desc){
-        .size = g_scene_state.compute.padded_splat_count * sizeof(float),
+    release_compute_resources();
+    g_scene_state.compute.padded_splat_count = next_power_of_2(g_scene_state.splat_capacity);
+    g_scene_state.compute.sort_valid = false;
+    g_scene_state.compute.depth_buffer = core_make_buffer(MEMORY_TAG_SORT, &(sg_buffer_desc){
+        .size = (g_scene_state.splat_capacity + 1) * sizeof(float),
         .usage = {.storage_buffer = true},
         .label = "depth-buffer"});
 
-    g_scene_state.compute.index_buffer = sg_make_buffer(&(sg_buffer_desc){
+    g_scene_state.compute.index_buffer = core_make_buffer(MEMORY_TAG_SORT, &(sg_buffer_desc){
         .size = g_scene_state.compute.padded_splat_count * sizeof(uint32_t),
         .usage = {.storage_buffer = true, .vertex_buffer = true},
         .label = "index-buffer"});
 
+    if (g_scene_state.active_indices)
+    {
+        g_scene_state.compute.active_buffer = core_make_buffer(MEMORY_TAG_SORT, &(sg_buffer_desc){
+            .size = g_scene_state.splat_capacity * sizeof(uint32_t),
+            .usage = {.storage_buffer = true, .stream_update = true},
+            .label = "active-index-buffer"});
+    }
+    else
+    {
+        static const uint32_t no_active_indices[4] = {0};
+        g_scene_state.compute.active_buffer = core_make_buffer(MEMORY_TAG_SORT, &(sg_buffer_desc){
+            .data = SG_RANGE(no_active_indices),
+            .usage = {.storage_buffer = true, .immutable = true},
+            .label = "active-index-stub"});
+    }
+
     g_scene_state.compute.depth_buffer_view = sg_make_view(&(sg_view_desc){
         .storage_buffer = {.buffer = g_scene_state.compute.depth_buffer},
         .label = "depth-buffer-view"});
@@ -92,24 +518,35 @@ void set_up_compute_pipeline(void)
         .storage_buffer = {.buffer = g_scene_state.compute.index_buffer},
         .label = "index-buffer-view"});
 
+    g_scene_state.compute.active_buffer_view = sg_make_view(&(sg_view_desc){
+        .storage_buffer = {.buffer = g_scene_state.compute.active_buffer},
+        .label = "active-index-buffer-view"});
+
+    set_up_select_pipeline();
+
     g_scene_state.compute.compute_depth_pip = sg_make_pipeline(&(sg_pipeline_desc){
         .compute = true,
-        .shader = sg_make_shader(depth_shader_desc(sg_query_backend())),
+        .shader = sg_make_shader(depth_shader_desc(shader_backend())),
         .label = "depth-pipeline"});
 
     g_scene_state.compute.compute_sort_pip = sg_make_pipeline(&(sg_pipeline_desc){
         .compute = true,
-        .shader = sg_make_shader(sort_shader_desc(sg_query_backend())),
+        .shader = sg_make_shader(sort_shader_desc(shader_backend())),
         .label = "sort-pipeline"});
 
     // bindings
     g_scene_state.compute.depth_bindings = (sg_bindings){
         .views = {
-            [VIEW_splat_texture] = g_scene_state.splat_texture.view,
+            [VIEW_position_buffer] = g_scene_state.splat_texture.position_view,
+            [VIEW_chunk_texture] = g_scene_state.splat_texture.chunk_view,
             [VIEW_depth_output] = g_scene_state.compute.depth_buffer_view,
-            [VIEW_index_output] = g_scene_state.compute.index_buffer_view},
+            [VIEW_index_output] = g_scene_state.compute.index_buffer_view,
+            [VIEW_active_input] = g_scene_state.compute.active_buffer_view},
         .samplers = {[SMP_splat_sampler] = g_scene_state.splat_texture.sampler}};
 
+    g_scene_state.compute.depth_budget_bindings = g_scene_state.compute.depth_bindings;
+    g_scene_state.compute.depth_budget_bindings.views[VIEW_active_input] = g_scene_state.compute.selected_buffer_view;
+
     g_scene_state.compute.sort_bindings = (sg_bindings){
         .views = {
             [VIEW_depth_input] = g_scene_state.compute.depth_buffer_view,
@@ -118,22 +555,144 @@ void set_up_compute_pipeline(void)
     print("compute pipeline is ready ");
 }
 
-void dispatch_compute_sort(void)
+// Point the compute bindings at splat resources created after set_up_compute_pipeline
+static void rebind_splat_views(void)
+{
+    const splat_texture_t *texture = &g_scene_state.splat_texture;
+    sg_bindings *depth_bindings[2] = {&g_scene_state.compute.depth_bindings, &g_scene_state.compute.depth_budget_bindings};
+    for (int i = 0; i < 2; i++)
+    {
+        depth_bindings[i]->views[VIEW_position_buffer] = texture->position_view;
+        depth_bindings[i]->views[VIEW_chunk_texture] = texture->chunk_view;
+        depth_bindings[i]->samplers[SMP_splat_sampler] = texture->sampler;
+    }
+
+    g_scene_state.compute.select_score_bindings.views[splat_view_slot()] = texture->view;
+    g_scene_state.compute.select_score_bindings.views[VIEW_chunk_texture] = texture->chunk_view;
+    g_scene_state.compute.select_score_bindings.samplers[SMP_splat_sampler] = texture->sampler;
+}
+
+// The sort key of a splat is its distance along the view direction. Between two poses it changes by at most
+// |delta position| + distance * |delta forward|, so below a small fraction of the scene extent the previous
+// back-to-front order is still (almost) correct.
+static bool can_reuse_sort(HMM_Vec3 position, HMM_Vec3 forward)
+{
+    if (!g_scene_state.compute.sort_valid || g_scene_state.compute.sort_reuse_tolerance <= 0.0f)
+    {
+        return false;
+    }
+
+    HMM_Vec3 bounds_size = HMM_Sub(g_scene_state.splat_bounds.max, g_scene_state.splat_bounds.min);
+    float extent = HMM_LenV3(bounds_size);
+    if (extent <= 0.0f)
+    {
+        return false;
+    }
+
+    HMM_Vec3 center = HMM_Add(g_scene_state.splat_bounds.min, HMM_MulV3F(bounds_size, 0.5f));
+    float max_distance = HMM_LenV3(HMM_Sub(center, position)) + extent * 0.5f;
+
+    float drift = HMM_LenV3(HMM_Sub(position, g_scene_state.compute.sorted_position)) +
+                  max_distance * HMM_LenV3(HMM_Sub(forward, g_scene_state.compute.sorted_forward));
+    return drift <= g_scene_state.compute.sort_reuse_tolerance * extent;
+}
+
+// Splats of the chunks that intersect the view frustum
+static uint32_t select_visible_chunks(Camera *camera, int width, int height, uint32_t *out_indices)
+{
+    HMM_Vec4 planes[5];
+    camera_get_frustum_planes(camera, (float)width / (float)height, planes);
+
+    uint32_t written = 0;
+    uint32_t visible = 0;
+    uint32_t chunk_count = splat_chunk_count(g_scene_state.splat_count);
+    for (uint32_t c = 0; c < chunk_count; c++)
+    {
+        if (!splat_chunk_visible(&g_scene_state.splat_chunks[c], planes, 5))
+        {
+            continue;
+        }
+        uint32_t begin = c * SPLAT_CHUNK_SIZE;
+        uint32_t end = begin + SPLAT_CHUNK_SIZE < g_scene_state.splat_count ? begin + SPLAT_CHUNK_SIZE : g_scene_state.splat_count;
+        for (uint32_t i = begin; i < end; i++)
+        {
+            out_indices[written++] = i;
+        }
+        visible++;
+    }
+    g_scene_state.chunk_culling.visible = visible;
+    return written;
+}
+
+// Pick this frame's splats; without LOD or chunk culling every splat is active
+static void select_active_splats(Camera *camera, int width, int height)
 {
-    if (!g_scene_state.initialized || !g_scene_state.camera)
+    if (!g_scene_state.active_indices)
+    {
+        g_scene_state.active_count = g_scene_state.splat_count;
+        return;
+    }
+
+    if (!g_scene_state.lod.tree.nodes)
     {
+        g_scene_state.active_count = select_visible_chunks(camera, width, height, g_scene_state.active_indices);
         return;
     }
-    const HMM_Vec3 *camera_pos = &g_scene_state.camera->position;
-    HMM_Mat4 view = camera_get_view_matrix(g_scene_state.camera);
+
+    g_scene_state.active_count = lod_select(&g_scene_state.lod.tree, camera, width, height,
+                                            &g_scene_state.lod.params, g_scene_state.active_indices,
+                                            &g_scene_state.lod.stats);
+}
+
+static void encode_compute_sort(Camera *camera, int width, int height)
+{
+    const HMM_Vec3 *camera_pos = &camera->position;
+    HMM_Mat4 view = camera_get_view_matrix(camera);
     HMM_Vec3 camera_forward = HMM_V3(-view.Elements[0][2], -view.Elements[1][2], -view.Elements[2][2]);
     camera_forward = HMM_NormV3(camera_forward);
+
+    if (can_reuse_sort(*camera_pos, camera_forward))
+    {
+        g_scene_state.compute.sort_stats.sorts_reused++;
+        return;
+    }
+    g_scene_state.compute.sorted_position = *camera_pos;
+    g_scene_state.compute.sorted_forward = camera_forward;
+    g_scene_state.compute.sort_valid = true;
+    g_scene_state.compute.sort_stats.sorts_dispatched++;
+
+    select_active_splats(camera, width, height);
+    bool over_budget = g_scene_state.budget.budget > 0 && g_scene_state.active_count > g_scene_state.budget.budget;
+    g_scene_state.draw_count = over_budget ? g_scene_state.budget.budget : g_scene_state.active_count;
+    if (!over_budget)
+    {
+        g_scene_state.budget.stats = (budget_stats_t){
+            .candidates = g_scene_state.active_count,
+            .kept = g_scene_state.active_count};
+    }
+    if (g_scene_state.draw_count == 0)
+    {
+        return;
+    }
+    if (g_scene_state.active_indices)
+    {
+        sg_range active_range = {
+            .ptr = g_scene_state.active_indices,
+            .size = g_scene_state.active_count * sizeof(uint32_t)};
+        sg_update_buffer(g_scene_state.compute.active_buffer, &active_range);
+    }
+
+    // Only the splats that will be drawn are sorted
+    uint32_t sort_count = next_power_of_2(g_scene_state.draw_count);
+
     sg_begin_pass(&(sg_pass){.compute = true, .label = "sort-compute-pass"});
-    // STEP 1: Calculate depths and initialize indices
+    if (over_budget)
     {
-        // Calculate bounds_size
-        HMM_Vec3 bounds_size = HMM_Sub(g_scene_state.splat_bounds.max, g_scene_state.splat_bounds.min);
+        dispatch_budget_select(camera, width, height);
+    }
 
+    // STEP 1: Calculate depths and initialize indices
+    {
         depth_params_t params = {
             .viewMat_row0 = {view.Elements[0][0], view.Elements[0][1], view.Elements[0][2], view.Elements[0][3]},
             .viewMat_row1 = {view.Elements[1][0], view.Elements[1][1], view.Elements[1][2], view.Elements[1][3]},
@@ -143,21 +702,18 @@ void dispatch_compute_sort(void)
             ._pad0 = 0.0f,
             .camera_forward = {camera_forward.X, camera_forward.Y, camera_forward.Z},
             ._pad1 = 0.0f,
-            .bounds_min = {g_scene_state.splat_bounds.min.X, g_scene_state.splat_bounds.min.Y, g_scene_state.splat_bounds.min.Z},
-            ._pad2 = 0.0f,
-            .bounds_size = {bounds_size.X, bounds_size.Y, bounds_size.Z},
-            .splat_count = (int)g_scene_state.splat_count,
-            .texture_width = g_scene_state.splat_texture.width,
-            .texture_height = g_scene_state.splat_texture.height,
-            .splats_per_layer = g_scene_state.splat_texture.width * g_scene_state.splat_texture.height,
-            ._pad3 = 0.0f};
+            .splat_count = (int)g_scene_state.draw_count,
+            .sort_count = (int)sort_count,
+            .use_active_indices = (over_budget || g_scene_state.active_indices) ? 1 : 0,
+            .sentinel_index = (int)g_scene_state.splat_capacity};
 
         sg_apply_pipeline(g_scene_state.compute.compute_depth_pip);
         sg_apply_uniforms(UB_depth_params, &SG_RANGE(params));
-        sg_apply_bindings(&g_scene_state.compute.depth_bindings);
+        sg_apply_bindings(over_budget ? &g_scene_state.compute.depth_budget_bindings
+                                      : &g_scene_state.compute.depth_bindings);
 
         // Dispatch with enough work groups to cover all splats (256 threads per work group)
-        uint32_t num_work_groups = (g_scene_state.compute.padded_splat_count + 255) / 256;
+        uint32_t num_work_groups = (sort_count + 255) / 256;
         sg_dispatch(num_work_groups, 1, 1);
     }
 
@@ -169,7 +725,7 @@ void dispatch_compute_sort(void)
         // Calculate number of stages for bitonic sort
         // For n elements (power of 2), we need log2(n) stages
         int num_stages = 0;
-        uint32_t temp = g_scene_state.compute.padded_splat_count;
+        uint32_t temp = sort_count;
         while (temp > 1)
         {
             temp >>= 1;
@@ -185,13 +741,13 @@ void dispatch_compute_sort(void)
                 sort_params_t sort_params = {
                     .stage = stage,
                     ._step = step,
-                    .count = (int)g_scene_state.compute.padded_splat_count,
+                    .count = (int)sort_count,
                     ._pad = 0};
 
                 sg_apply_uniforms(UB_sort_params, &SG_RANGE(sort_params));
 
                 // Number of compare-swap operations = padded_count / 2
-                uint32_t num_comparisons = g_scene_state.compute.padded_splat_count / 2;
+                uint32_t num_comparisons = sort_count / 2;
                 uint32_t num_work_groups = (num_comparisons + 255) / 256;
                 sg_dispatch(num_work_groups, 1, 1);
             }
@@ -201,6 +757,19 @@ void dispatch_compute_sort(void)
     sg_end_pass();
 }
 
+void dispatch_compute_sort(Camera *camera, int width, int height)
+{
+    if (!g_scene_state.initialized || !camera)
+    {
+        return;
+    }
+    profile_scope_t scope = profile_begin(PROFILE_STAGE_SORT);
+    TRACE_BEGIN("compute sort");
+    encode_compute_sort(camera, width, height);
+    TRACE_END();
+    profile_end(scope);
+}
+
 int init_scene(void)
 {
     if (g_scene_state.initialized)
@@ -208,6 +777,8 @@ int init_scene(void)
         return 1;
     }
 
+    TRACE_THREAD_NAME("render");
+
     // Initialize camera
     g_scene_state.camera = camera_create();
     camera_set_radius(g_scene_state.camera, 10.0f);
@@ -217,6 +788,13 @@ int init_scene(void)
         return 0;
     }
 
+    if (!gpu_available())
+    {
+        print("No GPU backend, scene will render on the CPU only\n");
+        g_scene_state.initialized = true;
+        return 1;
+    }
+
     float vertices[] = {
         -1.0f, -1.0f, // Bottom-left
         1.0f, -1.0f,  // Bottom-right
@@ -224,12 +802,23 @@ int init_scene(void)
         1.0f, 1.0f    // Top-right
     };
 
-    g_scene_state.bind.vertex_buffers[0] = sg_make_buffer(&(sg_buffer_desc){
+    g_scene_state.bind.vertex_buffers[0] = core_make_buffer(MEMORY_TAG_RENDER, &(sg_buffer_desc){
         .usage = {.vertex_buffer = true, .immutable = true},
         .data = SG_RANGE(vertices),
         .label = "quad-vertices"});
 
-    sg_shader shd = sg_make_shader(quad_shader_desc(sg_query_backend()));
+    if (profiler_enabled())
+    {
+        sg_enable_frame_stats();
+    }
+
+    // Storage buffers wherever compute shaders run; WebGL2 and other GLES3-only targets keep the texture array
+    g_scene_state.storage_buffer_splats = compute_available();
+    print("Splat storage: %s\n", g_scene_state.storage_buffer_splats ? "storage buffer" : "texture array");
+
+    sg_shader shd = sg_make_shader(g_scene_state.storage_buffer_splats
+                                       ? quad_buffer_shader_desc(shader_backend())
+                                       : quad_shader_desc(shader_backend()));
 
     //  pipeline
     g_scene_state.pip = sg_make_pipeline(&(sg_pipeline_desc){
@@ -260,189 +849,1528 @@ int init_scene(void)
     return 1;
 }
 
-void render_scene(sg_swapchain swapchain)
+static bool scene_ready_for_gpu(void)
 {
     // Early exits before expensive calculations
-    if (!g_scene_state.initialized || !g_scene_state.camera)
+    if (!g_scene_state.initialized || !g_scene_state.camera || !gpu_available())
     {
-        return;
+        return false;
     }
 
     if (g_scene_state.splat_texture.view.id == SG_INVALID_ID ||
+        g_scene_state.splat_texture.position_view.id == SG_INVALID_ID ||
         g_scene_state.splat_texture.sampler.id == SG_INVALID_ID)
     {
-        return;
+        return false;
     }
+    return true;
+}
+
+// Sort, then draw all splats into the given pass and commit the frame
+static void render_splats(Camera *camera, const sg_pass *pass, int width, int height)
+{
+    profile_scope_t uploads = profile_begin(PROFILE_STAGE_UPLOADS);
+    drain_splat_uploads();
+    profile_end(uploads);
 
     // Calculate matrices only after validation
-    HMM_Mat4 view = camera_get_view_matrix(g_scene_state.camera);
-    float aspect_ratio = (float)swapchain.width / (float)swapchain.height;
-    HMM_Mat4 projection = camera_get_projection_matrix(g_scene_state.camera, aspect_ratio);
+    profile_scope_t uniforms = profile_begin(PROFILE_STAGE_UNIFORMS);
+    HMM_Mat4 view = camera_get_view_matrix(camera);
+    float aspect_ratio = (float)width / (float)height;
+    HMM_Mat4 projection = camera_get_projection_matrix(camera, aspect_ratio);
 
     memcpy(g_scene_state.vs_params.viewMat, &view, sizeof(float) * 16);
     memcpy(g_scene_state.vs_params.projMat, &projection, sizeof(float) * 16);
 
     if (g_scene_state.uniforms_dirty)
     {
-        g_scene_state.vs_params.bounds_min[0] = g_scene_state.splat_bounds.min.X;
-        g_scene_state.vs_params.bounds_min[1] = g_scene_state.splat_bounds.min.Y;
-        g_scene_state.vs_params.bounds_min[2] = g_scene_state.splat_bounds.min.Z;
-
-        g_scene_state.vs_params.bounds_max[0] = g_scene_state.splat_bounds.max.X;
-        g_scene_state.vs_params.bounds_max[1] = g_scene_state.splat_bounds.max.Y;
-        g_scene_state.vs_params.bounds_max[2] = g_scene_state.splat_bounds.max.Z;
-
-        // Precompute bounds_size to avoid per-splat calculation in shader
-        HMM_Vec3 bounds_size = HMM_Sub(g_scene_state.splat_bounds.max, g_scene_state.splat_bounds.min);
-        g_scene_state.vs_params.bounds_size[0] = bounds_size.X;
-        g_scene_state.vs_params.bounds_size[1] = bounds_size.Y;
-        g_scene_state.vs_params.bounds_size[2] = bounds_size.Z;
-
         g_scene_state.vs_params.texture_width = g_scene_state.splat_texture.width;
         g_scene_state.vs_params.texture_height = g_scene_state.splat_texture.height;
         g_scene_state.vs_params.splats_per_layer = g_scene_state.splat_texture.width * g_scene_state.splat_texture.height;
+        g_scene_state.vs_params.splat_layout = (int)g_scene_state.splat_texture.layout;
+        g_scene_state.vs_params.use_covariance = g_scene_state.splat_texture.has_covariance ? 1 : 0;
 
         // Set bindings once when uniforms change (they're static)
-        g_scene_state.bind.views[VIEW_splat_texture] = g_scene_state.splat_texture.view;
+        int covariance_slot = g_scene_state.storage_buffer_splats ? VIEW_covariance_buffer : VIEW_covariance_texture;
+        g_scene_state.bind.views[splat_view_slot()] = g_scene_state.splat_texture.view;
+        g_scene_state.bind.views[VIEW_chunk_texture] = g_scene_state.splat_texture.chunk_view;
+        g_scene_state.bind.views[covariance_slot] = g_scene_state.splat_texture.covariance_view;
         g_scene_state.bind.samplers[SMP_splat_sampler] = g_scene_state.splat_texture.sampler;
 
         g_scene_state.uniforms_dirty = false;
     }
+    profile_end(uniforms);
 
-    dispatch_compute_sort();
+    dispatch_compute_sort(camera, width, height);
 
     // Bind sorted index buffer as vertex buffer (updated every frame by compute shader)
     g_scene_state.bind.vertex_buffers[1] = g_scene_state.compute.index_buffer;
 
     // Begin render pass
-    sg_begin_pass(&(sg_pass){
-        .action = g_scene_state.pass_action,
-        .swapchain = swapchain});
+    profile_scope_t draw = profile_begin(PROFILE_STAGE_DRAW);
+    TRACE_BEGIN("draw");
+    sg_begin_pass(pass);
 
-    sg_apply_pipeline(g_scene_state.pip);
-    sg_apply_bindings(&g_scene_state.bind);
-    sg_apply_uniforms(UB_vs_params, &SG_RANGE(g_scene_state.vs_params));
-    sg_draw(0, 4, g_scene_state.splat_count);
+    if (g_scene_state.draw_count > 0)
+    {
+        sg_apply_pipeline(g_scene_state.pip);
+        sg_apply_bindings(&g_scene_state.bind);
+        sg_apply_uniforms(UB_vs_params, &SG_RANGE(g_scene_state.vs_params));
+        sg_draw(0, 4, g_scene_state.draw_count);
+    }
 
     sg_end_pass();
     sg_commit();
+    TRACE_END();
+    profile_end(draw);
+
+    if (g_scene_state.first_frame_pending && g_scene_state.draw_count > 0)
+    {
+        g_scene_state.first_frame_pending = false;
+        g_scene_state.load_stats.first_frame_ms = time_now_ms() - g_scene_state.load_start_ms;
+        print("First frame drew %u splats %.1f ms after the load started\n",
+              g_scene_state.draw_count, g_scene_state.load_stats.first_frame_ms);
+    }
 }
 
-int parse_spz_data(const uint8_t *decompressed_data, size_t decompressed_size)
+// After the submit, so the decode does not delay the frame that is already prepared; then close the frame
+static void finish_frame(profile_scope_t frame, bool gpu)
 {
-    PackedSplat *parsed_splats = NULL;
-    uint32_t splat_count = 0;
-    BoundingBox bounds = {0};
-
-    int result = parse_spz_data_to_splats(decompressed_data, decompressed_size,
-                                          &parsed_splats, &splat_count, &bounds);
+    profile_scope_t uploads = profile_begin(PROFILE_STAGE_UPLOADS);
+    upload_next_progressive_batch();
+    profile_end(uploads);
+    profile_end(frame);
+    profiler_end_frame(gpu);
+}
 
-    if (result != 0)
+void render_scene(sg_swapchain swapchain)
+{
+    profile_scope_t frame = profile_begin(PROFILE_STAGE_FRAME);
+    poll_async_scene_load();
+    if (!scene_ready_for_gpu())
     {
-        print("ERROR: Failed to parse SPZ data (error %d)\n", result);
-        return result;
+        return;
     }
 
-    print("SPZ header indicates %u splats\n", splat_count);
-
-    initialize_gaussian_splats(splat_count);
+    render_splats(g_scene_state.camera,
+                  &(sg_pass){.action = g_scene_state.pass_action, .swapchain = swapchain},
+                  swapchain.width, swapchain.height);
+    finish_frame(frame, true);
+}
 
-    if (g_scene_state.packed_splats)
+bool render_scene_offscreen(Camera *camera, sg_attachments attachments, int width, int height)
+{
+    profile_scope_t frame = profile_begin(PROFILE_STAGE_FRAME);
+    poll_async_scene_load();
+    if (!scene_ready_for_gpu())
     {
-        free(g_scene_state.packed_splats);
+        return false;
     }
 
-    create_splat_texture_from_data(&g_scene_state.splat_texture, parsed_splats, splat_count);
+    render_splats(camera ? camera : g_scene_state.camera,
+                  &(sg_pass){.action = g_scene_state.pass_action, .attachments = attachments, .label = "offscreen-pass"},
+                  width, height);
+    finish_frame(frame, true);
+    return true;
+}
 
-    g_scene_state.packed_splats = parsed_splats;
-    g_scene_state.splat_count = splat_count;
-    g_scene_state.splat_bounds = bounds;
-    g_scene_state.splats_initialized = true;
+int render_scene_cpu(Camera *camera, int width, int height, uint8_t *out_rgba, cpu_render_stats_t *out_stats)
+{
+    profile_scope_t frame = profile_begin(PROFILE_STAGE_FRAME);
+    poll_async_scene_load();
+    if (!g_scene_state.initialized || !g_scene_state.splats_initialized)
+    {
+        return -1;
+    }
+    if (!g_scene_state.packed_splats)
+    {
+        // Released by the residency policy, or never built by GPU decode
+        print("ERROR: No CPU copy of the splats to render: %s\n",
+              g_scene_state.splat_residency != SCENE_SPLAT_RESIDENCY_KEEP
+                  ? "the splat residency policy released them, CPU rendering needs SCENE_SPLAT_RESIDENCY_KEEP"
+                  : "GPU decode keeps none, CPU rendering needs set_scene_gpu_decode(false)");
+        return -1;
+    }
 
-    mark_uniforms_dirty();
+    if (!g_scene_state.cpu_texels)
+    {
+        // One texel per splat, no layer padding
+        g_scene_state.cpu_texels = convert_splats_to_texture_data(
+            g_scene_state.packed_splats, g_scene_state.splat_count, g_scene_state.splat_layout,
+            (int)g_scene_state.splat_count, 1, 1);
+        if (!g_scene_state.cpu_texels)
+        {
+            return -1;
+        }
+    }
 
-    set_up_compute_pipeline();
+    Camera *view_camera = camera ? camera : g_scene_state.camera;
+    uint32_t active_count = g_scene_state.splat_count;
+    if (g_scene_state.lod.tree.nodes && g_scene_state.active_indices)
+    {
+        active_count = lod_select(&g_scene_state.lod.tree, view_camera, width, height,
+                                  &g_scene_state.lod.params, g_scene_state.active_indices,
+                                  &g_scene_state.lod.stats);
+    }
 
-    print("Loaded %u splats from SPZ data\n", splat_count);
-    return 0;
-}
+    cpu_splat_source_t source = {
+        .texels = g_scene_state.cpu_texels,
+        .splat_count = g_scene_state.splat_count,
+        .layout = g_scene_state.splat_layout,
+        .indices = g_scene_state.lod.tree.nodes ? g_scene_state.active_indices : NULL,
+        .index_count = active_count,
+        .chunks = g_scene_state.splat_chunks};
 
-void handle_input(float x, float y)
-{
-    if (g_scene_state.camera)
+    if (g_scene_state.budget.budget > 0 && active_count > g_scene_state.budget.budget)
     {
-        camera_handle_input(g_scene_state.camera, x, y);
+        if (!g_scene_state.budget.cpu_indices)
+        {
+            g_scene_state.budget.cpu_indices = (uint32_t *)core_malloc(MEMORY_TAG_SORT, (size_t)g_scene_state.budget.budget * sizeof(uint32_t));
+            if (!g_scene_state.budget.cpu_indices)
+            {
+                return -1;
+            }
+        }
+        source.index_count = budget_select(&source, view_camera, width, height, g_scene_state.budget.budget,
+                                           g_scene_state.budget.cpu_indices, &g_scene_state.budget.stats);
+        source.indices = g_scene_state.budget.cpu_indices;
     }
-}
-
-void handle_touch_down(float x, float y)
-{
-    if (g_scene_state.camera)
+    else
     {
-        camera_reset_touch_state(g_scene_state.camera);
-        camera_handle_input(g_scene_state.camera, x, y);
+        g_scene_state.budget.stats = (budget_stats_t){.candidates = active_count, .kept = active_count};
     }
-}
 
-void handle_pinch(float factor)
-{
-    if (g_scene_state.camera)
+    profile_scope_t render = profile_begin(PROFILE_STAGE_CPU_RENDER);
+    int result = cpu_render_splats(&source, view_camera, width, height, out_rgba, out_stats);
+    profile_end(render);
+    if (result == 0 && g_scene_state.first_frame_pending && source.index_count > 0)
     {
-        camera_handle_pinch(g_scene_state.camera, factor);
+        g_scene_state.first_frame_pending = false;
+        g_scene_state.load_stats.first_frame_ms = time_now_ms() - g_scene_state.load_start_ms;
     }
+    finish_frame(frame, false);
+    return result;
 }
 
-void handle_touch_up(void)
+// Build the LOD tree and append its merged splats and their chunks to the job's splats; on failure the
+// scene renders without LOD. Touches only the job, so it runs on the loading thread.
+static void build_scene_lod(scene_load_job_t *job)
 {
-    if (g_scene_state.camera)
+    lod_tree_t *tree = &job->lod_tree;
+    if (lod_build(job->splats, job->splat_count, job->chunks, job->options.layout, tree) != 0)
     {
-        camera_reset_touch_state(g_scene_state.camera);
+        return;
     }
-}
 
-void initialize_gaussian_splats(uint32_t capacity)
-{
-    if (g_scene_state.packed_splats)
+    uint32_t total = tree->merged_base + tree->merged_count;
+    PackedSplat *extended = (PackedSplat *)core_realloc(MEMORY_TAG_SPLATS, job->splats, (size_t)total * sizeof(PackedSplat));
+    splat_chunk_t *extended_chunks = (splat_chunk_t *)core_realloc(MEMORY_TAG_SPLATS, job->chunks, (size_t)splat_chunk_count(total) * sizeof(splat_chunk_t));
+    if (extended)
     {
-        free(g_scene_state.packed_splats);
+        job->splats = extended;
+    }
+    if (extended_chunks)
+    {
+        job->chunks = extended_chunks;
+    }
+    job->lod_indices = (uint32_t *)core_malloc(MEMORY_TAG_LOD, (size_t)lod_max_selection(tree) * sizeof(uint32_t));
+    if (!extended || !extended_chunks || !job->lod_indices)
+    {
+        print("ERROR: Failed to allocate LOD splats, rendering without LOD\n");
+        core_free(job->lod_indices);
+        job->lod_indices = NULL;
+        lod_free(tree);
+        return;
     }
 
-    g_scene_state.packed_splats = (PackedSplat *)malloc(capacity * sizeof(PackedSplat));
-    g_scene_state.splat_count = 0;
-    g_scene_state.splats_initialized = false;
+    // Transparent padding up to the first merged chunk, never part of a cut
+    memset(&extended[job->splat_count], 0, (size_t)(tree->merged_base - job->splat_count) * sizeof(PackedSplat));
+    memcpy(&extended[tree->merged_base], tree->merged_splats, (size_t)tree->merged_count * sizeof(PackedSplat));
+    memcpy(&extended_chunks[tree->merged_base / SPLAT_CHUNK_SIZE], tree->merged_chunks,
+           (size_t)splat_chunk_count(tree->merged_count) * sizeof(splat_chunk_t));
+    job->splat_count = total;
+}
 
-    if (!g_scene_state.packed_splats)
+// Upload the raw planes, order and chunk bounds of a decode plan and create decode.glsl
+static bool create_gpu_decoder(const spz_decode_plan_t *plan, spz_gpu_decoder_t *decoder)
+{
+    // Storage buffers are sized in whole words
+    size_t plane_words = (plan->planes_size + 3) / 4;
+    uint32_t *planes = (uint32_t *)core_malloc(MEMORY_TAG_LOAD, plane_words * sizeof(uint32_t));
+    if (!planes)
     {
-        print("ERROR: Failed to allocate splat buffer\n");
+        print("ERROR: Failed to allocate %zu bytes for SPZ planes\n", plane_words * sizeof(uint32_t));
+        return false;
     }
+    planes[plane_words - 1] = 0;
+    memcpy(planes, plan->planes, plan->planes_size);
+
+    static const uint32_t no_order[4] = {0};
+    decoder->planes_buffer = core_make_buffer(MEMORY_TAG_LOAD, &(sg_buffer_desc){
+        .data = {.ptr = planes, .size = plane_words * sizeof(uint32_t)},
+        .usage = {.storage_buffer = true, .immutable = true},
+        .label = "spz-planes"});
+    decoder->order_buffer = core_make_buffer(MEMORY_TAG_LOAD, &(sg_buffer_desc){
+        .data = plan->order ? (sg_range){.ptr = plan->order, .size = (size_t)plan->splat_count * sizeof(uint32_t)}
+                            : (sg_range)SG_RANGE(no_order),
+        .usage = {.storage_buffer = true, .immutable = true},
+        .label = "spz-order"});
+    decoder->chunk_buffer = core_make_buffer(MEMORY_TAG_LOAD, &(sg_buffer_desc){
+        .data = {.ptr = plan->chunk_fixed,
+                 .size = (size_t)splat_chunk_count(plan->splat_count) * SPZ_DECODE_CHUNK_WORDS * sizeof(int32_t)},
+        .usage = {.storage_buffer = true, .immutable = true},
+        .label = "spz-chunks"});
+    core_free(planes);
+
+    decoder->planes_view = sg_make_view(&(sg_view_desc){.storage_buffer = {.buffer = decoder->planes_buffer}});
+    decoder->order_view = sg_make_view(&(sg_view_desc){.storage_buffer = {.buffer = decoder->order_buffer}});
+    decoder->chunk_view = sg_make_view(&(sg_view_desc){.storage_buffer = {.buffer = decoder->chunk_buffer}});
+    decoder->shader = sg_make_shader(spz_decode_shader_desc(shader_backend()));
+    decoder->pipeline = sg_make_pipeline(&(sg_pipeline_desc){
+        .compute = true,
+        .shader = decoder->shader,
+        .label = "spz-decode-pipeline"});
+    return true;
 }
 
-bool is_scene_initialized(void)
+// Run decode.glsl over splats [first, end) of the plan into the splat texture's buffers; first is even
+static void dispatch_gpu_decoder(const spz_gpu_decoder_t *decoder, const spz_decode_plan_t *plan,
+                                 uint32_t first, uint32_t end)
 {
-    return g_scene_state.initialized;
+    decode_params_t params = {
+        .positions_offset = (int)plan->positions_offset,
+        .alphas_offset = (int)plan->alphas_offset,
+        .colors_offset = (int)plan->colors_offset,
+        .scales_offset = (int)plan->scales_offset,
+        .rotations_offset = (int)plan->rotations_offset,
+        .first_splat = (int)first,
+        .end_splat = (int)end,
+        .version = (int)plan->version,
+        .use_order = plan->order ? 1 : 0};
+
+    sg_begin_pass(&(sg_pass){.compute = true, .label = "spz-decode-pass"});
+    sg_apply_pipeline(decoder->pipeline);
+    sg_apply_uniforms(UB_decode_params, &SG_RANGE(params));
+    sg_apply_bindings(&(sg_bindings){
+        .views = {
+            [VIEW_spz_planes] = decoder->planes_view,
+            [VIEW_spz_order] = decoder->order_view,
+            [VIEW_spz_chunks] = decoder->chunk_view,
+            [VIEW_splat_buffer] = g_scene_state.splat_texture.view,
+            [VIEW_position_buffer] = g_scene_state.splat_texture.position_view}});
+
+    // One thread per pair of splats (256 threads per work group)
+    uint32_t pair_count = (end - first + 1) / 2;
+    sg_dispatch((pair_count + 255) / 256, 1, 1);
+    sg_end_pass();
 }
 
-void cleanup_scene(void)
+// Released once the GPU is done with the passes
+static void destroy_gpu_decoder(spz_gpu_decoder_t *decoder)
 {
-    if (!g_scene_state.initialized)
+    if (decoder->pipeline.id == SG_INVALID_ID)
     {
         return;
     }
+    sg_destroy_pipeline(decoder->pipeline);
+    sg_destroy_shader(decoder->shader);
+    sg_destroy_view(decoder->planes_view);
+    sg_destroy_view(decoder->order_view);
+    sg_destroy_view(decoder->chunk_view);
+    core_destroy_buffer(MEMORY_TAG_LOAD, decoder->planes_buffer);
+    core_destroy_buffer(MEMORY_TAG_LOAD, decoder->order_buffer);
+    core_destroy_buffer(MEMORY_TAG_LOAD, decoder->chunk_buffer);
+    *decoder = (spz_gpu_decoder_t){0};
+}
 
-    // Clean up camera
-    if (g_scene_state.camera)
-    {
-        camera_destroy(g_scene_state.camera);
-        g_scene_state.camera = NULL;
+// Stop a progressive load, keeping the batches uploaded so far
+static void end_progressive_load(void)
+{
+    destroy_gpu_decoder(&g_scene_state.progressive.decoder);
+    spz_free_decode_plan(&g_scene_state.progressive.plan);
+    core_free(g_scene_state.progressive.planes);
+    g_scene_state.progressive.planes = NULL;
+    g_scene_state.progressive.active = false;
+}
+
+// The next parse_spz_data uploads through the queue: storage buffers, a budget and no LOD cut
+// that could reach splats still on their way
+static bool use_upload_queue(void)
+{
+    return g_scene_state.upload_budget > 0 && g_scene_state.storage_buffer_splats && gpu_available() &&
+           !g_scene_state.lod.tree.nodes && upload_queue_init(g_scene_state.upload_budget);
+}
+
+// Drop the CPU copies derived from packed_splats, they are rebuilt on first use
+static void free_derived_splat_data(void)
+{
+    core_free(g_scene_state.cpu_texels);
+    g_scene_state.cpu_texels = NULL;
+    core_free(g_scene_state.splat_positions);
+    g_scene_state.splat_positions = NULL;
+    g_scene_state.splat_positions_count = 0;
+}
+
+// Split the quantized positions of the drawable splats out of packed_splats
+static bool build_splat_positions(void)
+{
+    uint32_t count = g_scene_state.splat_count;
+    uint16_t *positions = (uint16_t *)core_malloc(MEMORY_TAG_SPLATS, (size_t)count * 3 * sizeof(uint16_t));
+    if (!positions)
+    {
+        return false;
+    }
+    for (uint32_t i = 0; i < count; i++)
+    {
+        const PackedSplat *splat = &g_scene_state.packed_splats[i];
+        positions[i] = splat->pos_x;
+        positions[(size_t)count + i] = splat->pos_y;
+        positions[(size_t)count * 2 + i] = splat->pos_z;
+    }
+    g_scene_state.splat_positions = positions;
+    g_scene_state.splat_positions_count = count;
+    return true;
+}
+
+// Once the splats are all on the GPU, release what the residency policy does not keep of packed_splats
+static void apply_splat_residency(void)
+{
+    g_scene_state.residency_applied = true;
+    if (!gpu_available() || g_scene_state.splat_residency == SCENE_SPLAT_RESIDENCY_KEEP)
+    {
+        return;
+    }
+
+    if (g_scene_state.splat_residency == SCENE_SPLAT_RESIDENCY_DROP)
+    {
+        free_derived_splat_data();
+    }
+    else if (!g_scene_state.packed_splats)
+    {
+        return;
+    }
+    else
+    {
+        core_free(g_scene_state.cpu_texels);
+        g_scene_state.cpu_texels = NULL;
+        if (!g_scene_state.splat_positions && !build_splat_positions())
+        {
+            print("ERROR: Failed to allocate resident positions for %u splats, keeping the packed splats\n",
+                  g_scene_state.splat_count);
+            return;
+        }
+    }
+    if (g_scene_state.packed_splats)
+    {
+        print("Released %.1f MB of packed splats, %.1f MB of positions stay resident\n",
+              (size_t)g_scene_state.splat_count * sizeof(PackedSplat) / (1024.0f * 1024.0f),
+              (size_t)g_scene_state.splat_positions_count * 3 * sizeof(uint16_t) / (1024.0f * 1024.0f));
+        core_free(g_scene_state.packed_splats);
+        g_scene_state.packed_splats = NULL;
+    }
+}
+
+// Splats [0, count) can be drawn; the load is complete once all of them can
+static void set_drawable_splats(uint32_t count)
+{
+    g_scene_state.splat_count = count;
+    g_scene_state.compute.sort_valid = false;
+    free_derived_splat_data();
+    if (count == g_scene_state.splat_capacity && g_scene_state.load_stats.complete_ms == 0.0)
+    {
+        // Nothing is staged any more
+        g_scene_state.load_stats.complete_ms = time_now_ms() - g_scene_state.load_start_ms;
+        g_scene_state.load_stats.scratch_bytes = g_scene_state.load_arena.high_water;
+        memset(&g_scene_state.staging, 0, sizeof(g_scene_state.staging));
+        arena_free(&g_scene_state.load_arena);
+        print("Load complete: %u splats drawable after %.1f ms, %.1f MB of load scratch at most\n", count,
+              g_scene_state.load_stats.complete_ms, g_scene_state.load_stats.scratch_bytes / (1024.0f * 1024.0f));
+        apply_splat_residency();
+    }
+}
+
+// Convert splats [begin, end) (begin even) into region and queue them in slices of UPLOAD_SLICE_SPLATS;
+// each slice becomes drawable once its positions, queued last, are copied. Returns the bytes queued.
+static size_t queue_splat_part(uint32_t begin, uint32_t end, const staging_region_t *region)
+{
+    const splat_texture_t *texture = &g_scene_state.splat_texture;
+    const PackedSplat *splats = &g_scene_state.packed_splats[begin];
+    uint32_t count = end - begin;
+    convert_splats_into_texels(splats, count, texture->layout, region->texels);
+    if (region->covariance)
+    {
+        convert_splats_into_covariance(splats, count, texture->layout, region->covariance);
+    }
+    convert_splats_into_positions(splats, count, region->positions);
+
+    for (uint32_t first = 0; first < count; first += UPLOAD_SLICE_SPLATS)
+    {
+        uint32_t last = first + UPLOAD_SLICE_SPLATS < count ? first + UPLOAD_SLICE_SPLATS : count;
+        size_t texel_bytes = (size_t)(last - first) * 4 * sizeof(uint32_t);
+        size_t texel_offset = (size_t)(begin + first) * 4 * sizeof(uint32_t);
+        upload_queue_push(texture->view, &region->texels[(size_t)first * 4], texel_bytes, texel_offset, NULL, 0);
+        if (region->covariance)
+        {
+            upload_queue_push(texture->covariance_view, &region->covariance[(size_t)first * 4], texel_bytes,
+                              texel_offset, NULL, 0);
+        }
+        size_t word_first = splat_position_words(first);
+        upload_queue_push(texture->position_view, &region->positions[word_first],
+                          (splat_position_words(last) - word_first) * sizeof(uint32_t),
+                          splat_position_words(begin + first) * sizeof(uint32_t), NULL, begin + last);
+    }
+    return (size_t)count * 4 * sizeof(uint32_t) * (region->covariance ? 2 : 1) +
+           splat_position_words(count) * sizeof(uint32_t);
+}
+
+// Convert and queue further parts of the staged upload, two parts in flight: once no more than the last
+// part is left in the queue, the part before it, which used the other region, has been copied completely.
+// Parts hold at least a frame's budget, so every drain has a full frame's worth queued.
+static void stage_splat_uploads(void)
+{
+    while (g_scene_state.staging.next < g_scene_state.staging.end)
+    {
+        upload_progress_t progress = upload_queue_progress();
+        if (progress.queued_bytes - progress.uploaded_bytes > g_scene_state.staging.part_bytes)
+        {
+            return;
+        }
+        uint32_t begin = g_scene_state.staging.next;
+        uint32_t end = begin + g_scene_state.staging.part_splats < g_scene_state.staging.end
+                           ? begin + g_scene_state.staging.part_splats
+                           : g_scene_state.staging.end;
+        g_scene_state.staging.part_bytes =
+            queue_splat_part(begin, end, &g_scene_state.staging.regions[g_scene_state.staging.region]);
+        g_scene_state.staging.region ^= 1;
+        g_scene_state.staging.next = end;
+    }
+}
+
+// Upload splats [begin, end) (begin even) through the queue, staging the first part right away.
+// The two regions are taken from the load arena by the first call of a load and recycled after that.
+static bool start_staged_upload(uint32_t begin, uint32_t end)
+{
+    if (!g_scene_state.staging.regions[0].texels)
+    {
+        bool covariance = g_scene_state.splat_texture.has_covariance;
+
+        // At least a frame's budget per part, in whole slices
+        size_t splat_bytes = (covariance ? 2 : 1) * 4 * sizeof(uint32_t) + 3 * sizeof(uint16_t);
+        size_t part = (g_scene_state.upload_budget + splat_bytes - 1) / splat_bytes;
+        part = (part + UPLOAD_SLICE_SPLATS - 1) / UPLOAD_SLICE_SPLATS * UPLOAD_SLICE_SPLATS;
+        g_scene_state.staging.part_splats = (uint32_t)part;
+        for (int r = 0; r < 2; r++)
+        {
+            staging_region_t *region = &g_scene_state.staging.regions[r];
+            region->texels = (uint32_t *)arena_alloc(&g_scene_state.load_arena, part * 4 * sizeof(uint32_t));
+            region->covariance = covariance ? (uint32_t *)arena_alloc(&g_scene_state.load_arena,
+                                                                      part * 4 * sizeof(uint32_t))
+                                            : NULL;
+            region->positions = (uint32_t *)arena_alloc(&g_scene_state.load_arena,
+                                                        splat_position_words((uint32_t)part) * sizeof(uint32_t));
+            if (!region->texels || (covariance && !region->covariance) || !region->positions)
+            {
+                print("ERROR: Failed to allocate %zu splats of upload staging\n", part);
+                memset(&g_scene_state.staging, 0, sizeof(g_scene_state.staging));
+                return false;
+            }
+        }
+    }
+
+    g_scene_state.staging.next = begin;
+    g_scene_state.staging.end = end;
+    g_scene_state.staging.part_bytes = 0;
+    stage_splat_uploads();
+    return true;
+}
+
+// Once per frame before the sort: copy the next part of the queue, draw whatever has fully landed
+static void drain_splat_uploads(void)
+{
+    stage_splat_uploads();
+    if (upload_queue_drain() > 0)
+    {
+        uint32_t drawable = (uint32_t)upload_queue_completed_tag();
+        if (drawable > g_scene_state.splat_count)
+        {
+            set_drawable_splats(drawable);
+        }
+    }
+}
+
+// Decode and upload the next importance batch; frames draw the grown prefix from now on
+static void upload_next_progressive_batch(void)
+{
+    if (!g_scene_state.progressive.active)
+    {
+        return;
+    }
+    // Queued batches: decode the next one once the previous one is on the GPU
+    if (g_scene_state.progressive.queued &&
+        (upload_queue_progress().pending_jobs > 0 || g_scene_state.staging.next < g_scene_state.staging.end))
+    {
+        return;
+    }
+
+    const spz_decode_plan_t *plan = &g_scene_state.progressive.plan;
+    uint32_t begin = g_scene_state.progressive.next_batch > 0 ? plan->batch_ends[g_scene_state.progressive.next_batch - 1] : 0;
+    uint32_t end = plan->batch_ends[g_scene_state.progressive.next_batch++];
+    g_scene_state.load_stats.batches++;
+    if (g_scene_state.progressive.on_gpu)
+    {
+        dispatch_gpu_decoder(&g_scene_state.progressive.decoder, plan, begin, end);
+    }
+    else if (g_scene_state.progressive.queued)
+    {
+        spz_decode_splat_range(plan, begin, end - begin, &g_scene_state.packed_splats[begin]);
+        if (!start_staged_upload(begin, end))
+        {
+            print("ERROR: Failed to queue splats %u-%u, stopping the load\n", begin, end);
+            end_progressive_load();
+        }
+        else if (g_scene_state.progressive.next_batch == plan->batch_count)
+        {
+            end_progressive_load();
+        }
+        return;
+    }
+    else
+    {
+        spz_decode_splat_range(plan, begin, end - begin, &g_scene_state.packed_splats[begin]);
+        if (gpu_available())
+        {
+            // Immutable resources take no partial updates, so the grown prefix goes into new full-size storage
+            cleanup_splat_texture(&g_scene_state.splat_texture);
+            splat_upload_options_t upload = {
+                .layout = SPLAT_LAYOUT_QUATERNION,
+                .precompute_covariance = g_scene_state.precompute_covariance,
+                .storage_buffer = g_scene_state.storage_buffer_splats,
+                .position_stream = compute_available(),
+                .capacity = g_scene_state.splat_capacity};
+            create_splat_texture_from_data(&g_scene_state.splat_texture, g_scene_state.packed_splats, end,
+                                           g_scene_state.splat_chunks, &upload);
+            rebind_splat_views();
+        }
+    }
+
+    set_drawable_splats(end);
+    mark_uniforms_dirty();
+
+    if (g_scene_state.progressive.next_batch == plan->batch_count)
+    {
+        end_progressive_load();
+    }
+}
+
+// parse_spz_data with set_scene_gpu_decode: the CPU only plans, decode.glsl writes the splats
+// Settings of a load, taken when it starts so a background load is not affected by later setter calls
+static scene_load_job_t new_scene_load_job(void)
+{
+    scene_load_job_t job = {.options = g_scene_state.load_options};
+    arena_init(&job.arena, 0, MEMORY_TAG_LOAD);
+    bool gpu_decode = g_scene_state.gpu_decode && g_scene_state.storage_buffer_splats && gpu_available();
+    if (g_scene_state.progressive.enabled)
+    {
+        job.path = SCENE_LOAD_PATH_PROGRESSIVE;
+        job.options.importance_order = true;
+        job.decode_on_gpu = gpu_decode;
+    }
+    else if (gpu_decode)
+    {
+        job.path = SCENE_LOAD_PATH_GPU;
+        job.decode_on_gpu = true;
+    }
+    else
+    {
+        job.path = SCENE_LOAD_PATH_CPU;
+        job.build_lod = g_scene_state.lod.enabled;
+    }
+    return job;
+}
+
+static void free_scene_load_job(scene_load_job_t *job)
+{
+    core_free(job->splats);
+    core_free(job->chunks);
+    lod_free(&job->lod_tree);
+    core_free(job->lod_indices);
+    spz_free_decode_plan(&job->plan);
+    core_free(job->planes);
+    core_free(job->data);
+    arena_free(&job->arena);
+    *job = (scene_load_job_t){0};
+}
+
+// The CPU half of a load: parse, or plan a GPU decode. Writes only to the job, so it runs on any
+// thread; the decode plan may point into data, which must outlive apply_scene_load unless it is job->data.
+// The sort scratch comes from the job's arena; it is sized by the whole scene while the upload stages
+// only a few frames' worth, so the blocks are returned at the end instead of being held through the upload.
+static int prepare_scene_load(scene_load_job_t *job, const uint8_t *decompressed_data, size_t decompressed_size)
+{
+    double start_time = time_now_ms();
+    job->options.scratch = &job->arena;
+    if (job->path == SCENE_LOAD_PATH_CPU)
+    {
+        int result = parse_spz_data_to_splats_with_options(decompressed_data, decompressed_size, &job->options,
+                                                           &job->splats, &job->splat_count, &job->bounds,
+                                                           &job->chunks, &job->prune_stats);
+        arena_free(&job->arena);
+
+        // The splats are all there is to upload, an owned stream can go before the upload needs memory
+        core_free(job->data);
+        job->data = NULL;
+        if (result != 0)
+        {
+            print("ERROR: Failed to parse SPZ data (error %d)\n", result);
+            return result;
+        }
+        job->prepare_ms = time_now_ms() - start_time;
+        print("SPZ header indicates %u splats\n", job->splat_count);
+
+        if (job->build_lod)
+        {
+            build_scene_lod(job);
+        }
+        job->lod_ms = time_now_ms() - start_time - job->prepare_ms;
+        profile_record(PROFILE_STAGE_PREPARE, job->prepare_ms);
+        if (job->build_lod)
+        {
+            profile_record(PROFILE_STAGE_LOD, job->lod_ms);
+        }
+        return 0;
+    }
+
+    int result = spz_prepare_decode(decompressed_data, decompressed_size, &job->options, &job->plan,
+                                    &job->prune_stats);
+    arena_free(&job->arena);
+    if (result != 0)
+    {
+        print("ERROR: Failed to prepare SPZ data for %s\n",
+              job->path == SCENE_LOAD_PATH_GPU ? "GPU decoding" : "progressive loading");
+        return -1;
+    }
+    if (job->path == SCENE_LOAD_PATH_PROGRESSIVE)
+    {
+        // The later batches decode from the planes after this returns: a stream the job owns is kept as it
+        // is, the caller's data is copied
+        job->planes = job->data ? NULL : (uint8_t *)core_malloc(MEMORY_TAG_LOAD, job->plan.planes_size);
+        job->splats = job->decode_on_gpu ? NULL : (PackedSplat *)core_calloc(MEMORY_TAG_SPLATS, job->plan.splat_count, sizeof(PackedSplat));
+        if ((!job->data && !job->planes) || (!job->decode_on_gpu && !job->splats))
+        {
+            print("ERROR: Failed to allocate progressive load buffers for %u splats\n", job->plan.splat_count);
+            free_scene_load_job(job);
+            return -1;
+        }
+        if (job->planes)
+        {
+            memcpy(job->planes, job->plan.planes, job->plan.planes_size);
+            job->plan.planes = job->planes;
+        }
+    }
+    job->prepare_ms = time_now_ms() - start_time;
+    profile_record(PROFILE_STAGE_PREPARE, job->prepare_ms);
+    return 0;
+}
+
+// apply_scene_load for SCENE_LOAD_PATH_GPU: upload the planes and decode every splat with decode.glsl
+static int apply_scene_load_on_gpu(scene_load_job_t *job)
+{
+    double start_time = time_now_ms();
+    spz_decode_plan_t *plan = &job->plan;
+
+    core_free(g_scene_state.packed_splats);
+    g_scene_state.packed_splats = NULL;
+    free_derived_splat_data();
+
+    lod_free(&g_scene_state.lod.tree);
+    core_free(g_scene_state.active_indices);
+    g_scene_state.active_indices = NULL;
+    if (g_scene_state.lod.enabled)
+    {
+        print("LOD needs the splats on the CPU, drawing without it\n");
+    }
+    if (g_scene_state.chunk_culling.enabled)
+    {
+        g_scene_state.active_indices = (uint32_t *)core_malloc(MEMORY_TAG_SORT, (size_t)plan->splat_count * sizeof(uint32_t));
+        if (!g_scene_state.active_indices)
+        {
+            print("ERROR: Failed to allocate chunk culling indices, drawing all splats\n");
+        }
+    }
+
+    cleanup_splat_texture(&g_scene_state.splat_texture);
+    splat_upload_options_t upload = {.layout = SPLAT_LAYOUT_QUATERNION, .storage_buffer = true, .position_stream = true};
+    create_splat_texture_for_compute(&g_scene_state.splat_texture, plan->splat_count, plan->chunks, &upload);
+    spz_gpu_decoder_t decoder = {0};
+    if (create_gpu_decoder(plan, &decoder))
+    {
+        dispatch_gpu_decoder(&decoder, plan, 0, plan->splat_count);
+        destroy_gpu_decoder(&decoder);
+    }
+
+    core_free(g_scene_state.splat_chunks);
+    g_scene_state.splat_chunks = plan->chunks;
+    plan->chunks = NULL;
+    g_scene_state.splat_layout = SPLAT_LAYOUT_QUATERNION;
+    g_scene_state.splat_capacity = plan->splat_count;
+    g_scene_state.splat_bounds = plan->bounds;
+    g_scene_state.splats_initialized = true;
+
+    mark_uniforms_dirty();
+    set_up_compute_pipeline();
+
+    g_scene_state.load_stats = (scene_load_stats_t){
+        .gpu_decoded = true,
+        .batches = 1,
+        .prepare_ms = job->prepare_ms,
+        .upload_ms = time_now_ms() - start_time};
+    set_drawable_splats(g_scene_state.splat_capacity);
+    print("Loaded %u splats from SPZ data, decoded on the GPU (%.1f ms prepare, %.1f ms upload)\n",
+          g_scene_state.splat_count, g_scene_state.load_stats.prepare_ms, g_scene_state.load_stats.upload_ms);
+    return 0;
+}
+
+// apply_scene_load for SCENE_LOAD_PATH_PROGRESSIVE: storage for the whole scene, the first importance
+// batch now and one more per rendered frame
+static int apply_scene_load_progressively(scene_load_job_t *job)
+{
+    double start_time = time_now_ms();
+    bool on_gpu = job->decode_on_gpu;
+
+    core_free(g_scene_state.packed_splats);
+    g_scene_state.packed_splats = job->splats;
+    job->splats = NULL;
+    free_derived_splat_data();
+
+    lod_free(&g_scene_state.lod.tree);
+    core_free(g_scene_state.active_indices);
+    g_scene_state.active_indices = NULL;
+    if (g_scene_state.lod.enabled)
+    {
+        print("LOD needs the whole scene up front, loading progressively without it\n");
+    }
+    if (g_scene_state.chunk_culling.enabled)
+    {
+        g_scene_state.active_indices = (uint32_t *)core_malloc(MEMORY_TAG_SORT, (size_t)job->plan.splat_count * sizeof(uint32_t));
+        if (!g_scene_state.active_indices)
+        {
+            print("ERROR: Failed to allocate chunk culling indices, drawing all splats\n");
+        }
+    }
+
+    cleanup_splat_texture(&g_scene_state.splat_texture);
+    bool queued = !on_gpu && use_upload_queue();
+    if (on_gpu || queued)
+    {
+        splat_upload_options_t upload = {
+            .layout = SPLAT_LAYOUT_QUATERNION,
+            .precompute_covariance = queued && g_scene_state.precompute_covariance,
+            .storage_buffer = true,
+            .position_stream = true};
+        create_splat_texture_for_compute(&g_scene_state.splat_texture, job->plan.splat_count, job->plan.chunks,
+                                         &upload);
+    }
+    if (on_gpu && !create_gpu_decoder(&job->plan, &g_scene_state.progressive.decoder))
+    {
+        return -1;
+    }
+
+    spz_decode_plan_t plan = job->plan;
+    core_free(g_scene_state.splat_chunks);
+    g_scene_state.splat_chunks = plan.chunks;
+    plan.chunks = NULL;
+    g_scene_state.splat_layout = SPLAT_LAYOUT_QUATERNION;
+    g_scene_state.splat_count = 0;
+    g_scene_state.splat_capacity = plan.splat_count;
+    g_scene_state.splat_bounds = plan.bounds;
+    g_scene_state.splats_initialized = true;
+
+    g_scene_state.progressive.active = true;
+    g_scene_state.progressive.on_gpu = on_gpu;
+    g_scene_state.progressive.queued = queued;
+    g_scene_state.progressive.plan = plan;
+    g_scene_state.progressive.planes = job->planes ? job->planes : job->data;
+    g_scene_state.progressive.next_batch = 0;
+    job->plan = (spz_decode_plan_t){0};
+    job->planes = NULL;
+    job->data = NULL;
+
+    g_scene_state.load_stats = (scene_load_stats_t){
+        .gpu_decoded = on_gpu,
+        .progressive = true,
+        .prepare_ms = job->prepare_ms};
+    uint32_t batch_count = plan.batch_count;
+    upload_next_progressive_batch();
+    if (gpu_available())
+    {
+        set_up_compute_pipeline();
+    }
+    g_scene_state.load_stats.upload_ms = time_now_ms() - start_time;
+
+    print("Loading %u splats in %u importance batches, the first %u %s after %.1f ms\n",
+          g_scene_state.splat_capacity, batch_count, plan.batch_ends[0], queued ? "queued" : "ready",
+          g_scene_state.load_stats.prepare_ms + g_scene_state.load_stats.upload_ms);
+    return 0;
+}
+
+// apply_scene_load for SCENE_LOAD_PATH_CPU: upload the parsed splats, or queue them under the upload budget
+static int apply_scene_load_from_splats(scene_load_job_t *job)
+{
+    double start_time = time_now_ms();
+    uint32_t splat_count = job->splat_count;
+    splat_layout_t layout = job->options.layout;
+
+    // The job's splats replace the old ones; the old array goes before the upload needs memory
+    core_free(g_scene_state.packed_splats);
+    g_scene_state.packed_splats = NULL;
+
+    free_derived_splat_data();
+
+    lod_free(&g_scene_state.lod.tree);
+    core_free(g_scene_state.active_indices);
+    g_scene_state.active_indices = NULL;
+
+    if (job->lod_tree.nodes)
+    {
+        g_scene_state.lod.tree = job->lod_tree;
+        g_scene_state.active_indices = job->lod_indices;
+        job->lod_tree = (lod_tree_t){0};
+        job->lod_indices = NULL;
+    }
+    else if (g_scene_state.chunk_culling.enabled)
+    {
+        g_scene_state.active_indices = (uint32_t *)core_malloc(MEMORY_TAG_SORT, (size_t)splat_count * sizeof(uint32_t));
+        if (!g_scene_state.active_indices)
+        {
+            print("ERROR: Failed to allocate chunk culling indices, drawing all splats\n");
+        }
+    }
+
+    bool queued = use_upload_queue();
+    if (gpu_available())
+    {
+        cleanup_splat_texture(&g_scene_state.splat_texture);
+        splat_upload_options_t upload = {
+            .layout = layout,
+            .precompute_covariance = g_scene_state.precompute_covariance,
+            .storage_buffer = g_scene_state.storage_buffer_splats,
+            .position_stream = compute_available()};
+        if (queued)
+        {
+            create_splat_texture_for_compute(&g_scene_state.splat_texture, splat_count, job->chunks, &upload);
+        }
+        else
+        {
+            create_splat_texture_from_data(&g_scene_state.splat_texture, job->splats, splat_count, job->chunks,
+                                           &upload);
+        }
+    }
+
+    core_free(g_scene_state.splat_chunks);
+    g_scene_state.packed_splats = job->splats;
+    g_scene_state.splat_chunks = job->chunks;
+    job->splats = NULL;
+    job->chunks = NULL;
+    g_scene_state.splat_layout = layout;
+    g_scene_state.splat_count = 0;
+    g_scene_state.splat_capacity = splat_count;
+    g_scene_state.splat_bounds = job->bounds;
+    g_scene_state.splats_initialized = true;
+
+    mark_uniforms_dirty();
+
+    if (gpu_available())
+    {
+        set_up_compute_pipeline();
+    }
+
+    g_scene_state.load_stats = (scene_load_stats_t){
+        .batches = 1,
+        .prepare_ms = job->prepare_ms};
+    if (queued && start_staged_upload(0, splat_count))
+    {
+        print("Queued %u splats for upload, %.1f MB per frame\n", splat_count,
+              g_scene_state.upload_budget / (1024.0f * 1024.0f));
+    }
+    else
+    {
+        if (queued)
+        {
+            // Out of memory for the staging regions: nothing is uploaded, nothing gets drawn
+            print("ERROR: Failed to queue the splat upload\n");
+        }
+        set_drawable_splats(splat_count);
+    }
+    g_scene_state.load_stats.upload_ms = job->lod_ms + time_now_ms() - start_time;
+    print("Loaded %u splats from SPZ data (%.1f ms decode, %.1f ms upload)\n",
+          splat_count, g_scene_state.load_stats.prepare_ms, g_scene_state.load_stats.upload_ms);
+    return 0;
+}
+
+// The render thread half of a load: replace the current scene with the prepared one and start its upload
+static int apply_scene_load(scene_load_job_t *job)
+{
+    profile_scope_t scope = profile_begin(PROFILE_STAGE_APPLY);
+    TRACE_BEGIN("apply load");
+
+    // A new load replaces whatever is still streaming in, staging included; its arena takes over
+    end_progressive_load();
+    upload_queue_clear();
+    memset(&g_scene_state.staging, 0, sizeof(g_scene_state.staging));
+    arena_free(&g_scene_state.load_arena);
+    g_scene_state.load_arena = job->arena;
+    arena_init(&job->arena, 0, MEMORY_TAG_LOAD);
+    g_scene_state.first_frame_pending = true;
+    g_scene_state.prune_stats = job->prune_stats;
+    g_scene_state.residency_applied = false;
+
+    int result = job->path == SCENE_LOAD_PATH_PROGRESSIVE ? apply_scene_load_progressively(job)
+                 : job->path == SCENE_LOAD_PATH_GPU       ? apply_scene_load_on_gpu(job)
+                                                          : apply_scene_load_from_splats(job);
+    TRACE_END();
+    profile_end(scope);
+    return result;
+}
+
+int parse_spz_data(const uint8_t *decompressed_data, size_t decompressed_size)
+{
+    // A synchronous load wins over one still running in the background
+    stop_async_scene_load();
+    g_scene_state.load_start_ms = time_now_ms();
+
+    scene_load_job_t job = new_scene_load_job();
+    int result = prepare_scene_load(&job, decompressed_data, decompressed_size);
+    if (result == 0)
+    {
+        result = apply_scene_load(&job);
+    }
+    free_scene_load_job(&job);
+    return result;
+}
+
+static void notify_async_scene_load(scene_load_state_t state)
+{
+    atomic_store(&g_scene_state.async.state, state);
+    if (g_scene_state.async.callback)
+    {
+        g_scene_state.async.callback(get_scene_load_progress(), g_scene_state.async.user_data);
+    }
+}
+
+// spz_inflate progress of the worker, stops the inflate once the load is cancelled
+static bool report_inflate_progress(double fraction, void *user_data)
+{
+    (void)user_data;
+    atomic_store(&g_scene_state.async.progress, (float)fraction * LOAD_PROGRESS_INFLATED);
+    return !atomic_load(&g_scene_state.async.cancelled);
+}
+
+static void *scene_load_worker(void *arg)
+{
+    (void)arg;
+    TRACE_THREAD_NAME("scene loader");
+    uint8_t *data = NULL;
+    size_t size = 0;
+    profile_scope_t inflate = profile_begin(PROFILE_STAGE_INFLATE);
+    int result = g_scene_state.async.path
+                     ? spz_read_file(g_scene_state.async.path, &data, &size)
+                     : spz_inflate(g_scene_state.async.data, g_scene_state.async.size, &data, &size,
+                                   report_inflate_progress, NULL);
+    profile_end(inflate);
+    core_free(g_scene_state.async.data);
+    g_scene_state.async.data = NULL;
+
+    if (result == 0 && !atomic_load(&g_scene_state.async.cancelled))
+    {
+        atomic_store(&g_scene_state.async.state, SCENE_LOAD_DECODING);
+        atomic_store(&g_scene_state.async.progress, LOAD_PROGRESS_INFLATED);
+        // The job owns the stream: the GPU and progressive plans decode from it in place, the CPU parse
+        // frees it as soon as the splats are packed
+        scene_load_job_t *job = &g_scene_state.async.job;
+        job->data = data;
+        data = NULL;
+        result = prepare_scene_load(job, job->data, size);
+        atomic_store(&g_scene_state.async.progress, LOAD_PROGRESS_DECODED);
+    }
+    core_free(data);
+
+    g_scene_state.async.result = result;
+    atomic_store_explicit(&g_scene_state.async.finished, true, memory_order_release);
+    return NULL;
+}
+
+// Join the worker and drop its results without reporting
+static void join_scene_load_worker(void)
+{
+    pthread_join(g_scene_state.async.thread, NULL);
+    g_scene_state.async.running = false;
+    free_scene_load_job(&g_scene_state.async.job);
+    core_free(g_scene_state.async.path);
+    core_free(g_scene_state.async.data);
+    g_scene_state.async.path = NULL;
+    g_scene_state.async.data = NULL;
+}
+
+// Render thread, before each frame: apply a finished background load and report its progress
+static void poll_async_scene_load(void)
+{
+    if (g_scene_state.async.running &&
+        atomic_load_explicit(&g_scene_state.async.finished, memory_order_acquire))
+    {
+        pthread_join(g_scene_state.async.thread, NULL);
+        g_scene_state.async.running = false;
+        core_free(g_scene_state.async.path);
+        g_scene_state.async.path = NULL;
+
+        if (atomic_load(&g_scene_state.async.cancelled))
+        {
+            free_scene_load_job(&g_scene_state.async.job);
+            notify_async_scene_load(SCENE_LOAD_CANCELLED);
+            return;
+        }
+        int result = g_scene_state.async.result;
+        if (result == 0)
+        {
+            g_scene_state.load_start_ms = g_scene_state.async.start_ms;
+            result = apply_scene_load(&g_scene_state.async.job);
+        }
+        free_scene_load_job(&g_scene_state.async.job);
+        if (result != 0)
+        {
+            notify_async_scene_load(SCENE_LOAD_FAILED);
+            return;
+        }
+        g_scene_state.async.applied = true;
+        notify_async_scene_load(SCENE_LOAD_UPLOADING);
+    }
+
+    if (g_scene_state.async.applied && !g_scene_state.progressive.active &&
+        g_scene_state.splat_count == g_scene_state.splat_capacity)
+    {
+        g_scene_state.async.applied = false;
+        notify_async_scene_load(SCENE_LOAD_DONE);
+    }
+}
+
+// Before another load or cleanup: wait for the worker, the replaced load reports SCENE_LOAD_CANCELLED
+static void stop_async_scene_load(void)
+{
+    if (g_scene_state.async.running)
+    {
+        atomic_store(&g_scene_state.async.cancelled, true);
+        join_scene_load_worker();
+        notify_async_scene_load(SCENE_LOAD_CANCELLED);
+    }
+    else if (g_scene_state.async.applied)
+    {
+        g_scene_state.async.applied = false;
+        notify_async_scene_load(SCENE_LOAD_CANCELLED);
+    }
+}
+
+bool scene_load_async(scene_load_source_t source, scene_load_callback_t callback, void *user_data)
+{
+    stop_async_scene_load();
+    if (!source.path && !source.data)
+    {
+        return false;
+    }
+
+    // The worker gets its own copy of the source, the caller's may go away after this returns
+    char *path = NULL;
+    uint8_t *data = NULL;
+    if (source.path)
+    {
+        size_t length = strlen(source.path) + 1;
+        path = (char *)core_malloc(MEMORY_TAG_LOAD, length);
+        if (path)
+        {
+            memcpy(path, source.path, length);
+        }
+    }
+    else
+    {
+        data = (uint8_t *)core_malloc(MEMORY_TAG_LOAD, source.size ? source.size : 1);
+        if (data)
+        {
+            memcpy(data, source.data, source.size);
+        }
+    }
+    if (!path && !data)
+    {
+        print("ERROR: Failed to copy the scene source for loading\n");
+        return false;
+    }
+
+    g_scene_state.async.path = path;
+    g_scene_state.async.data = data;
+    g_scene_state.async.size = source.size;
+    g_scene_state.async.job = new_scene_load_job();
+    g_scene_state.async.result = -1;
+    g_scene_state.async.start_ms = time_now_ms();
+    g_scene_state.async.callback = callback;
+    g_scene_state.async.user_data = user_data;
+    g_scene_state.async.applied = false;
+    atomic_store(&g_scene_state.async.finished, false);
+    atomic_store(&g_scene_state.async.cancelled, false);
+    atomic_store(&g_scene_state.async.state, SCENE_LOAD_INFLATING);
+    atomic_store(&g_scene_state.async.progress, 0.0f);
+
+    pthread_attr_t attributes;
+    pthread_attr_init(&attributes);
+    pthread_attr_setstacksize(&attributes, LOAD_THREAD_STACK_SIZE);
+    int started = pthread_create(&g_scene_state.async.thread, &attributes, scene_load_worker, NULL);
+    pthread_attr_destroy(&attributes);
+    if (started != 0)
+    {
+        print("ERROR: Failed to start the scene load thread (%d)\n", started);
+        free_scene_load_job(&g_scene_state.async.job);
+        core_free(path);
+        core_free(data);
+        g_scene_state.async.path = NULL;
+        g_scene_state.async.data = NULL;
+        atomic_store(&g_scene_state.async.state, SCENE_LOAD_IDLE);
+        return false;
+    }
+    g_scene_state.async.running = true;
+    return true;
+}
+
+void scene_load_cancel(void)
+{
+    if (g_scene_state.async.running)
+    {
+        // Reported by the next render call once the worker stops; the decode itself runs to its end
+        atomic_store(&g_scene_state.async.cancelled, true);
+    }
+    else if (g_scene_state.async.applied)
+    {
+        // Keep what is drawable, drop the batches and uploads still pending
+        end_progressive_load();
+        upload_queue_clear();
+        g_scene_state.splat_capacity = g_scene_state.splat_count;
+        g_scene_state.async.applied = false;
+        notify_async_scene_load(SCENE_LOAD_CANCELLED);
+    }
+}
+
+scene_load_progress_t get_scene_load_progress(void)
+{
+    scene_load_progress_t progress = {
+        .state = (scene_load_state_t)atomic_load(&g_scene_state.async.state),
+        .progress = atomic_load(&g_scene_state.async.progress)};
+    if (progress.state == SCENE_LOAD_UPLOADING || progress.state == SCENE_LOAD_DONE)
+    {
+        progress.drawable_splats = g_scene_state.splat_count;
+        progress.total_splats = g_scene_state.splat_capacity;
+        float uploaded = progress.total_splats ? (float)progress.drawable_splats / (float)progress.total_splats : 1.0f;
+        progress.progress = LOAD_PROGRESS_DECODED + (1.0f - LOAD_PROGRESS_DECODED) * uploaded;
+    }
+    return progress;
+}
+
+void handle_input(float x, float y)
+{
+    if (g_scene_state.camera)
+    {
+        camera_handle_input(g_scene_state.camera, x, y);
+    }
+}
+
+void handle_touch_down(float x, float y)
+{
+    if (g_scene_state.camera)
+    {
+        camera_reset_touch_state(g_scene_state.camera);
+        camera_handle_input(g_scene_state.camera, x, y);
+    }
+}
+
+void handle_pinch(float factor)
+{
+    if (g_scene_state.camera)
+    {
+        camera_handle_pinch(g_scene_state.camera, factor);
+    }
+}
+
+void handle_touch_up(void)
+{
+    if (g_scene_state.camera)
+    {
+        camera_reset_touch_state(g_scene_state.camera);
+    }
+}
+
+void initialize_gaussian_splats(uint32_t capacity)
+{
+    if (g_scene_state.packed_splats)
+    {
+        core_free(g_scene_state.packed_splats);
+    }
+
+    g_scene_state.packed_splats = (PackedSplat *)core_malloc(MEMORY_TAG_SPLATS, capacity * sizeof(PackedSplat));
+    g_scene_state.splat_count = 0;
+    g_scene_state.splats_initialized = false;
+
+    if (!g_scene_state.packed_splats)
+    {
+        print("ERROR: Failed to allocate splat buffer\n");
+    }
+}
+
+bool is_scene_initialized(void)
+{
+    return g_scene_state.initialized;
+}
+
+bool is_scene_gpu_backed(void)
+{
+    return g_scene_state.initialized && gpu_available();
+}
+
+Camera *get_scene_camera(void)
+{
+    return g_scene_state.camera;
+}
+
+void set_scene_prune_options(float min_opacity, float min_scale)
+{
+    g_scene_state.load_options.prune.min_opacity = min_opacity > 0.0f ? min_opacity : 0.0f;
+    g_scene_state.load_options.prune.min_scale = min_scale > 0.0f ? min_scale : 0.0f;
+}
+
+spz_prune_stats_t get_scene_prune_stats(void)
+{
+    return g_scene_state.prune_stats;
+}
+
+void set_scene_lod_enabled(bool enabled)
+{
+    g_scene_state.lod.enabled = enabled;
+}
+
+void set_scene_lod_params(float pixel_threshold, uint32_t splat_budget)
+{
+    g_scene_state.lod.params.pixel_threshold = pixel_threshold;
+    g_scene_state.lod.params.splat_budget = splat_budget;
+    // A cached sort would keep the previous cut
+    g_scene_state.compute.sort_valid = false;
+}
+
+void set_scene_chunk_culling(bool enabled)
+{
+    g_scene_state.chunk_culling.enabled = enabled;
+}
+
+void set_scene_splat_layout(splat_layout_t layout)
+{
+    g_scene_state.load_options.layout = layout;
+}
+
+void set_scene_precomputed_covariance(bool enabled)
+{
+    g_scene_state.precompute_covariance = enabled;
+}
+
+void set_scene_gpu_decode(bool enabled)
+{
+    g_scene_state.gpu_decode = enabled;
+}
+
+void set_scene_upload_budget(size_t bytes_per_frame)
+{
+    g_scene_state.upload_budget = bytes_per_frame;
+    if (bytes_per_frame > 0)
+    {
+        upload_queue_set_budget(bytes_per_frame);
+    }
+}
+
+scene_upload_stats_t get_scene_upload_stats(void)
+{
+    upload_progress_t progress = upload_queue_progress();
+    return (scene_upload_stats_t){
+        .queued_bytes = progress.queued_bytes,
+        .uploaded_bytes = progress.uploaded_bytes,
+        .frames = progress.frames,
+        .last_frame_ms = progress.last_drain_ms,
+        .drawable_splats = g_scene_state.splat_count,
+        .total_splats = g_scene_state.splat_capacity};
+}
+
+void set_scene_progressive_load(bool enabled)
+{
+    g_scene_state.progressive.enabled = enabled;
+}
+
+bool is_scene_loading(void)
+{
+    return g_scene_state.async.running || g_scene_state.progressive.active ||
+           g_scene_state.splat_count < g_scene_state.splat_capacity;
+}
+
+scene_load_stats_t get_scene_load_stats(void)
+{
+    return g_scene_state.load_stats;
+}
+
+void set_scene_splat_residency(scene_splat_residency_t residency)
+{
+    g_scene_state.splat_residency = residency;
+    if (g_scene_state.residency_applied)
+    {
+        apply_splat_residency();
+    }
+}
+
+scene_residency_stats_t get_scene_residency_stats(void)
+{
+    size_t splat_count = g_scene_state.splats_initialized ? g_scene_state.splat_capacity : 0;
+    size_t resident = g_scene_state.splat_positions_count * 3 * sizeof(uint16_t);
+    if (g_scene_state.packed_splats)
+    {
+        resident += splat_count * sizeof(PackedSplat);
+    }
+    if (g_scene_state.cpu_texels)
+    {
+        resident += (size_t)g_scene_state.splat_count * 4 * sizeof(uint32_t);
+    }
+    return (scene_residency_stats_t){
+        .residency = g_scene_state.splat_residency,
+        .applied = g_scene_state.residency_applied,
+        .resident_bytes = resident,
+        .keep_bytes = splat_count * sizeof(PackedSplat),
+        .positions_bytes = splat_count * 3 * sizeof(uint16_t),
+        .chunk_bytes = g_scene_state.splat_chunks ? splat_chunk_count((uint32_t)splat_count) * sizeof(splat_chunk_t) : 0};
+}
+
+scene_splat_positions_t get_scene_splat_positions(void)
+{
+    if (!g_scene_state.splat_positions && (!g_scene_state.packed_splats || !build_splat_positions()))
+    {
+        return (scene_splat_positions_t){0};
+    }
+    size_t count = g_scene_state.splat_positions_count;
+    return (scene_splat_positions_t){
+        .x = g_scene_state.splat_positions,
+        .y = g_scene_state.splat_positions + count,
+        .z = g_scene_state.splat_positions + count * 2,
+        .chunks = g_scene_state.splat_chunks,
+        .count = (uint32_t)count};
+}
+
+bool scene_uses_storage_buffer_splats(void)
+{
+    return g_scene_state.storage_buffer_splats;
+}
+
+scene_covariance_stats_t get_scene_covariance_stats(void)
+{
+    const splat_texture_t *texture = &g_scene_state.splat_texture;
+    if (!texture->has_covariance)
+    {
+        return (scene_covariance_stats_t){.splat_texture_bytes = splat_texture_bytes(texture)};
+    }
+    return (scene_covariance_stats_t){
+        .enabled = true,
+        .texture_bytes = texture->covariance_bytes,
+        .splat_texture_bytes = splat_texture_bytes(texture),
+        .vertex_decodes_skipped = (uint64_t)g_scene_state.draw_count * 4};
+}
+
+scene_chunk_stats_t get_scene_chunk_stats(void)
+{
+    uint32_t chunk_count = splat_chunk_count(g_scene_state.splat_count);
+    bool culling = g_scene_state.active_indices && !g_scene_state.lod.tree.nodes;
+    return (scene_chunk_stats_t){
+        .chunk_count = chunk_count,
+        .chunks_visible = culling ? g_scene_state.chunk_culling.visible : chunk_count};
+}
+
+scene_lod_stats_t get_scene_lod_stats(void)
+{
+    return (scene_lod_stats_t){
+        .enabled = g_scene_state.lod.tree.nodes != NULL,
+        .node_count = g_scene_state.lod.tree.node_count,
+        .merged_count = g_scene_state.lod.tree.merged_count,
+        .selected = g_scene_state.lod.stats.selected,
+        .merged_selected = g_scene_state.lod.stats.merged_selected,
+        .select_ms = g_scene_state.lod.stats.select_ms};
+}
+
+void set_scene_splat_budget(uint32_t budget)
+{
+    if (budget == g_scene_state.budget.budget)
+    {
+        return;
+    }
+    g_scene_state.budget.budget = budget;
+
+    // Sized for the old budget
+    core_free(g_scene_state.budget.cpu_indices);
+    g_scene_state.budget.cpu_indices = NULL;
+    g_scene_state.compute.sort_valid = false;
+}
+
+uint32_t get_scene_splat_budget(void)
+{
+    return g_scene_state.budget.budget;
+}
+
+budget_stats_t get_scene_budget_stats(void)
+{
+    return g_scene_state.budget.stats;
+}
+
+void set_scene_sort_reuse_tolerance(float tolerance)
+{
+    g_scene_state.compute.sort_reuse_tolerance = tolerance > 0.0f ? tolerance : 0.0f;
+}
+
+scene_sort_stats_t get_scene_sort_stats(void)
+{
+    return g_scene_state.compute.sort_stats;
+}
+
+void cleanup_scene(void)
+{
+    if (!g_scene_state.initialized)
+    {
+        return;
+    }
+
+    stop_async_scene_load();
+
+    // Clean up camera
+    if (g_scene_state.camera)
+    {
+        camera_destroy(g_scene_state.camera);
+        g_scene_state.camera = NULL;
     }
 
     // Clean up splat data
     if (g_scene_state.packed_splats)
     {
-        free(g_scene_state.packed_splats);
+        core_free(g_scene_state.packed_splats);
         g_scene_state.packed_splats = NULL;
     }
 
+    free_derived_splat_data();
+
+    core_free(g_scene_state.splat_chunks);
+    g_scene_state.splat_chunks = NULL;
+    end_progressive_load();
+    upload_queue_shutdown();
+    memset(&g_scene_state.staging, 0, sizeof(g_scene_state.staging));
+    arena_free(&g_scene_state.load_arena);
+
+    lod_free(&g_scene_state.lod.tree);
+    core_free(g_scene_state.active_indices);
+    g_scene_state.active_indices = NULL;
+    core_free(g_scene_state.budget.cpu_indices);
+    g_scene_state.budget.cpu_indices = NULL;
+
     // Clean up GPU resources
     if (g_scene_state.pip.id != SG_INVALID_ID)
     {
@@ -452,7 +2380,7 @@ void cleanup_scene(void)
 
     if (g_scene_state.bind.vertex_buffers[0].id != SG_INVALID_ID)
     {
-        sg_destroy_buffer(g_scene_state.bind.vertex_buffers[0]);
+        core_destroy_buffer(MEMORY_TAG_RENDER, g_scene_state.bind.vertex_buffers[0]);
         g_scene_state.bind.vertex_buffers[0].id = SG_INVALID_ID;
     }
 
@@ -463,6 +2391,7 @@ void cleanup_scene(void)
     }
 
     cleanup_splat_texture(&g_scene_state.splat_texture);
+    release_compute_resources();
 
     g_scene_state.initialized = false;
 }
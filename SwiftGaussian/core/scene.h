@@ -6,7 +6,10 @@
 #include "sokol/sokol_gfx.h"
 #include "camera.h"
 #include "utils/handmademath.h"
+#include "utils/arena.h"
 #include "splat_texture.h"
+#include "cpu_renderer.h"
+#include "splat_budget.h"
 
 #ifdef __cplusplus
 extern "C"
@@ -19,6 +22,150 @@ extern "C"
         HMM_Vec3 max;
     } BoundingBox;
 
+// Opacity below which splat.glsl never draws a splat, pruning at this level is lossless
+#define SPZ_DEFAULT_MIN_OPACITY (3.0f / 255.0f)
+
+    // Load-time pruning thresholds, 0 disables a test
+    typedef struct
+    {
+        float min_opacity; // drop splats below this opacity (0-1)
+        float min_scale;   // drop splats whose larger quad axis is below this size (world units)
+    } spz_prune_options_t;
+
+    // Load-time processing for parse_spz_data_to_splats_with_options
+    typedef struct
+    {
+        spz_prune_options_t prune;
+        bool spatial_order;    // Morton-order the kept splats so every quantization chunk is spatially compact
+        bool importance_order; // opacity * quad area first, in growing batches each ordered spatially on its own
+        splat_layout_t layout; // rotation encoding of the packed splats
+        arena_t *scratch;      // sort keys and scratch, reset before returning; NULL allocates them per call
+    } spz_load_options_t;
+
+    typedef struct
+    {
+        uint32_t total;
+        uint32_t kept;
+        uint32_t removed_opacity;
+        uint32_t removed_scale;
+    } spz_prune_stats_t;
+
+    typedef struct
+    {
+        uint32_t sorts_dispatched; // depth + bitonic sort passes run on the GPU
+        uint32_t sorts_reused;     // frames that drew with the previous sort order
+    } scene_sort_stats_t;
+
+    typedef struct
+    {
+        bool enabled; // a LOD tree was built for the loaded splats
+        uint32_t node_count;
+        uint32_t merged_count;
+        uint32_t selected;        // splats in the last cut
+        uint32_t merged_selected; // of which merged parents
+        double select_ms;
+    } scene_lod_stats_t;
+
+    typedef struct
+    {
+        uint32_t chunk_count;    // quantization chunks of SPLAT_CHUNK_SIZE splats, see splat_chunk_t
+        uint32_t chunks_visible; // in the last GPU frame, all of them without chunk culling
+    } scene_chunk_stats_t;
+
+    // Cost and use of the precomputed covariance texture, to decide per device class
+    typedef struct
+    {
+        bool enabled;               // the loaded splats have a covariance texture
+        size_t texture_bytes;       // GPU memory of the covariance texture
+        size_t splat_texture_bytes; // GPU memory of the packed splat texture, for comparison
+        uint64_t vertex_decodes_skipped; // rotation + exp scale decodes saved in the last frame (4 per drawn splat)
+    } scene_covariance_stats_t;
+
+    // Where the last parse_spz_data spent its time, to compare CPU and GPU decoding
+    typedef struct
+    {
+        bool gpu_decoded;  // the splats were decoded by decode.glsl
+        double prepare_ms; // CPU decode, or only prune, order and chunk bounds before a GPU decode
+        double upload_ms;  // LOD build, texel packing and upload, or plane upload and decode dispatch
+        bool progressive;      // loaded in importance batches, prepare and upload cover the first one
+        uint32_t batches;      // batches uploaded so far
+        double first_frame_ms; // parse_spz_data start to the submit of the first frame that drew splats
+        double complete_ms;    // parse_spz_data start to the upload of the last batch
+        size_t scratch_bytes;  // high-water mark of the load's arena (sort scratch, upload staging), once complete
+    } scene_load_stats_t;
+
+    // Progress of a budgeted upload, see set_scene_upload_budget
+    typedef struct
+    {
+        uint64_t queued_bytes; // texels, covariance and positions queued since the queue was last empty
+        uint64_t uploaded_bytes;
+        uint32_t frames;        // frames that copied part of it
+        double last_frame_ms;   // CPU time of the last frame's copy
+        uint32_t drawable_splats;
+        uint32_t total_splats;
+    } scene_upload_stats_t;
+
+    // What the CPU keeps of the splats once they are all on the GPU, see set_scene_splat_residency
+    typedef enum
+    {
+        SCENE_SPLAT_RESIDENCY_KEEP,      // the packed splats, 16 bytes each; render_scene_cpu keeps working
+        SCENE_SPLAT_RESIDENCY_POSITIONS, // quantized positions only, 6 bytes each (get_scene_splat_positions); no CPU rendering
+        SCENE_SPLAT_RESIDENCY_DROP,      // nothing but the chunk bounds; no CPU rendering
+    } scene_splat_residency_t;
+
+    // Quantized positions of the loaded splats in three planes; splat_chunk_position with
+    // chunks[i / SPLAT_CHUNK_SIZE] gives the world position of splat i
+    typedef struct
+    {
+        const uint16_t *x;
+        const uint16_t *y;
+        const uint16_t *z;
+        const splat_chunk_t *chunks;
+        uint32_t count; // 0 when no positions are resident
+    } scene_splat_positions_t;
+
+    // CPU memory of the loaded splats, now and under each residency policy
+    typedef struct
+    {
+        scene_splat_residency_t residency; // the policy in effect
+        bool applied;                      // the current scene is complete and was trimmed to it
+        size_t resident_bytes;             // held now: packed splats, positions and CPU renderer texels
+        size_t keep_bytes;                 // what SCENE_SPLAT_RESIDENCY_KEEP holds for this scene
+        size_t positions_bytes;            // what SCENE_SPLAT_RESIDENCY_POSITIONS holds
+        size_t chunk_bytes;                // chunk bounds, kept under every policy and not in the above
+    } scene_residency_stats_t;
+
+    // Where scene_load_async takes the scene from: a file, or SPZ bytes in memory (gzip-compressed or
+    // not); either is copied before scene_load_async returns
+    typedef struct
+    {
+        const char *path;
+        const uint8_t *data;
+        size_t size;
+    } scene_load_source_t;
+
+    typedef enum
+    {
+        SCENE_LOAD_IDLE,      // no background load started
+        SCENE_LOAD_INFLATING, // reading and decompressing, on the load thread
+        SCENE_LOAD_DECODING,  // parsing and ordering (or planning a GPU decode), on the load thread
+        SCENE_LOAD_UPLOADING, // the scene replaced the previous one, its splats are on their way to the GPU
+        SCENE_LOAD_DONE,      // every splat is drawable
+        SCENE_LOAD_FAILED,
+        SCENE_LOAD_CANCELLED,
+    } scene_load_state_t;
+
+    typedef struct
+    {
+        scene_load_state_t state;
+        float progress;           // 0-1 over inflating, decoding and uploading
+        uint32_t drawable_splats; // once uploading
+        uint32_t total_splats;
+    } scene_load_progress_t;
+
+    // Called on the render thread, from a render call, when a background load changes state
+    typedef void (*scene_load_callback_t)(scene_load_progress_t progress, void *user_data);
+
     // Scene management functions
     int init_scene(void);
     void cleanup_scene(void);
@@ -26,9 +173,117 @@ extern "C"
 
     int parse_spz_data(const uint8_t *decompressed_data, size_t decompressed_size);
 
+    /**
+     * Load a scene in the background: a worker thread reads, inflates and decodes it (everything
+     * parse_spz_data does on the CPU), then the next render_scene, render_scene_offscreen or render_scene_cpu
+     * call creates its GPU resources and it replaces the current scene. Until then the current scene keeps
+     * drawing. Uses the load settings in effect when it is called. Starting another load, or parse_spz_data,
+     * cancels this one.
+     *
+     * @param source File or memory to load, copied
+     * @param callback Reports UPLOADING, then DONE, or FAILED or CANCELLED, on the render thread; may be NULL
+     * @param user_data Passed to callback
+     * @return true when the load thread started
+     */
+    bool scene_load_async(scene_load_source_t source, scene_load_callback_t callback, void *user_data);
+
+    // Cancel the background load: the worker stops after its current step (an inflate notices within a
+    // few MB, a decode runs to its end), or a load still uploading keeps the splats drawable so far
+    void scene_load_cancel(void);
+
+    // Render thread; the state and progress of the background load
+    scene_load_progress_t get_scene_load_progress(void);
+
     // Scene rendering function
     void render_scene(sg_swapchain swapchain);
 
+    // Render into caller-owned attachments instead of a swapchain; camera may be NULL for the scene camera
+    bool render_scene_offscreen(Camera *camera, sg_attachments attachments, int width, int height);
+
+    // Render on the CPU into an RGBA8 buffer (works without a GPU backend). Needs the packed splats: returns -1
+    // and logs why once a residency policy other than SCENE_SPLAT_RESIDENCY_KEEP released them or GPU decode
+    // loaded the scene. render_to_image without readback and render_batch with cpu_only go through here.
+    int render_scene_cpu(Camera *camera, int width, int height, uint8_t *out_rgba, cpu_render_stats_t *out_stats);
+
+    // False when running headless (no sokol setup or the dummy backend)
+    bool is_scene_gpu_backed(void);
+    Camera *get_scene_camera(void);
+
+    // Skip the depth sort while the camera moved less than tolerance * scene extent since the
+    // last sort (back-to-front order barely changes between close poses). 0 sorts every frame.
+    void set_scene_sort_reuse_tolerance(float tolerance);
+
+    // Drop splats below min_opacity (0-1) or whose larger axis is below min_scale before packing,
+    // applied by the next parse_spz_data. Defaults to SPZ_DEFAULT_MIN_OPACITY, no scale limit.
+    void set_scene_prune_options(float min_opacity, float min_scale);
+    spz_prune_stats_t get_scene_prune_stats(void);
+
+    // Build a LOD octree on the next parse_spz_data; every frame then draws a cut of it
+    void set_scene_lod_enabled(bool enabled);
+
+    // Refine nodes projecting larger than pixel_threshold, drawing at most splat_budget splats (0: no budget)
+    void set_scene_lod_params(float pixel_threshold, uint32_t splat_budget);
+    scene_lod_stats_t get_scene_lod_stats(void);
+
+    // Key, sort and draw only the splats of chunks inside the view frustum, applied by the next
+    // parse_spz_data when LOD is off (a LOD cut is already culled per node). The CPU renderer always culls chunks.
+    void set_scene_chunk_culling(bool enabled);
+    scene_chunk_stats_t get_scene_chunk_stats(void);
+
+    // Rotation encoding of the splat texture, applied by the next parse_spz_data. SPLAT_LAYOUT_QUATERNION
+    // keeps SPZ v3 rotations bit-exact and skips the axis-angle conversion; the default is SPLAT_LAYOUT_AXIS_ANGLE.
+    void set_scene_splat_layout(splat_layout_t layout);
+
+    // Precompute each splat's scaled quad axes (the covariance factor) at load, applied by the next
+    // parse_spz_data. Adds 16 bytes of GPU memory per splat; splat.glsl then reads the axes instead of
+    // decoding rotation and scale for every vertex. Off by default.
+    void set_scene_precomputed_covariance(bool enabled);
+    scene_covariance_stats_t get_scene_covariance_stats(void);
+
+    // True when init_scene put the splats in a storage buffer (any backend with compute shaders):
+    // no texture array padding or layer limit. WebGL2 and other GLES3-only targets keep the texture array.
+    bool scene_uses_storage_buffer_splats(void);
+
+    // Decode SPZ on the GPU, applied by the next parse_spz_data when the splats live in a storage
+    // buffer. The CPU only prunes, orders and bounds the splats; decode.glsl does the per-splat
+    // work. Forces SPLAT_LAYOUT_QUATERNION. No CPU copy is kept, so there is no LOD, no precomputed
+    // covariance and no render_scene_cpu. Off by default.
+    void set_scene_gpu_decode(bool enabled);
+
+    // Upload the splats of the next parse_spz_data over several frames, at most bytes_per_frame each (0, the
+    // default, uploads everything during the load). Needs storage buffer splats; texture arrays and LOD scenes
+    // still upload at once. Frames draw the splats that have fully arrived, in steps of 64K splats.
+    void set_scene_upload_budget(size_t bytes_per_frame);
+    scene_upload_stats_t get_scene_upload_stats(void);
+
+    // Load the next parse_spz_data progressively: splats are ordered by opacity * quad area and uploaded
+    // in growing batches (1/32 of the scene, then doubling), one per rendered frame, into storage sized
+    // for the whole scene. The first frame draws the most visible splats while the rest streams in.
+    // Forces SPLAT_LAYOUT_QUATERNION and disables LOD. Combines with set_scene_gpu_decode. Off by default.
+    void set_scene_progressive_load(bool enabled);
+    // True while splats of the last load are still on their way: a background load, progressive batches or a
+    // budgeted upload
+    bool is_scene_loading(void);
+    scene_load_stats_t get_scene_load_stats(void);
+
+    // What stays on the CPU once every splat of a load is on the GPU; SCENE_SPLAT_RESIDENCY_KEEP by default.
+    // Applies to the current scene right away when its load is complete (so it can answer a memory
+    // warning) and to later loads once they complete; splats that were dropped only come back with the
+    // next load. Without a GPU the packed splats are what render_scene_cpu draws and are always kept.
+    void set_scene_splat_residency(scene_splat_residency_t residency);
+    scene_residency_stats_t get_scene_residency_stats(void);
+
+    // Positions for picking or CPU-side sorting: those kept by SCENE_SPLAT_RESIDENCY_POSITIONS, or under
+    // KEEP extracted from the packed splats on first use. Valid until the next load or residency change.
+    scene_splat_positions_t get_scene_splat_positions(void);
+
+    // Never draw more than budget splats (0: no limit); the highest projected area * opacity win.
+    // Can change every frame, selection runs on the GPU or in the CPU renderer.
+    void set_scene_splat_budget(uint32_t budget);
+    uint32_t get_scene_splat_budget(void);
+    budget_stats_t get_scene_budget_stats(void);
+    scene_sort_stats_t get_scene_sort_stats(void);
+
     // Input handling functions
     void handle_input(float x, float y);
     void handle_touch_down(float x, float y);
@@ -0,0 +1,191 @@
+#include "splat_budget.h"
+#include "utils/core_memory.h"
+#include "utils/jobs.h"
+#include "utils/logger.h"
+#include "utils/timer.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Same alpha cut as splat.glsl, anything below is never drawn
+#define BUDGET_MIN_ALPHA_BYTE 3u
+#define BUDGET_MIN_DEPTH 1e-3f
+
+void budget_view_init(budget_view_t *view, Camera *camera, int width, int height)
+{
+    HMM_Mat4 view_mat = camera_get_view_matrix(camera);
+    HMM_Mat4 projection = camera_get_projection_matrix(camera, (float)width / (float)height);
+    view->view_proj = HMM_MulM4(projection, view_mat);
+    view->camera_pos = camera->position;
+    view->camera_forward = HMM_NormV3(HMM_V3(-view_mat.Elements[0][2], -view_mat.Elements[1][2], -view_mat.Elements[2][2]));
+    view->focal_px = 0.5f * (float)height * fabsf(projection.Elements[1][1]);
+    view->width = (float)width;
+    view->height = (float)height;
+}
+
+uint32_t budget_score_bin(const cpu_splat_source_t *source, uint32_t splat, const budget_view_t *view)
+{
+    const uint32_t *texel = &source->texels[(size_t)splat * 4];
+    uint32_t alpha = texel[3] & 0xFFu;
+    if (alpha < BUDGET_MIN_ALPHA_BYTE)
+    {
+        return 0;
+    }
+
+    HMM_Vec3 pos = splat_chunk_position(&source->chunks[splat / SPLAT_CHUNK_SIZE],
+                                        (texel[0] >> 16) & 0xFFFFu, texel[0] & 0xFFFFu, (texel[1] >> 16) & 0xFFFFu);
+
+    float depth = HMM_DotV3(HMM_Sub(pos, view->camera_pos), view->camera_forward);
+    if (depth < BUDGET_MIN_DEPTH)
+    {
+        return 0;
+    }
+
+    float scale_x = expf((float)((texel[2] >> 16) & 0xFFu) * (1.0f / 25.5f) - 5.0f);
+    float scale_y = expf((float)((texel[2] >> 8) & 0xFFu) * (1.0f / 25.5f) - 5.0f);
+    float px_per_unit = view->focal_px / depth;
+
+    // Off screen by more than the splat's own radius
+    HMM_Vec4 clip = HMM_MulM4V4(view->view_proj, HMM_V4(pos.X, pos.Y, pos.Z, 1.0f));
+    float radius_px = 0.5f * fmaxf(scale_x, scale_y) * px_per_unit;
+    float ndc_x = clip.X / clip.W;
+    float ndc_y = clip.Y / clip.W;
+    if (fabsf(ndc_x) > 1.0f + 2.0f * radius_px / view->width ||
+        fabsf(ndc_y) > 1.0f + 2.0f * radius_px / view->height)
+    {
+        return 0;
+    }
+
+    float score = scale_x * scale_y * px_per_unit * px_per_unit * (float)alpha * (1.0f / 255.0f);
+    if (!(score > 0.0f))
+    {
+        return 0;
+    }
+
+    float bin = (log2f(score) - BUDGET_LOG2_MIN) * ((float)(BUDGET_HISTOGRAM_BINS - 1) / (BUDGET_LOG2_MAX - BUDGET_LOG2_MIN)) + 1.0f;
+    return (uint32_t)fminf(fmaxf(bin, 1.0f), (float)(BUDGET_HISTOGRAM_BINS - 1));
+}
+
+typedef struct
+{
+    const cpu_splat_source_t *source;
+    const budget_view_t *view;
+    uint16_t *bins;
+    uint32_t *histogram;
+} budget_score_job_t;
+
+// Score a range into a local histogram, merged once per range
+static void score_budget_range(uint32_t begin, uint32_t end, uint32_t slot, void *context)
+{
+    (void)slot;
+    budget_score_job_t *job = (budget_score_job_t *)context;
+    uint32_t local[BUDGET_HISTOGRAM_BINS] = {0};
+    for (uint32_t i = begin; i < end; i++)
+    {
+        uint32_t splat = job->source->indices ? job->source->indices[i] : i;
+        uint32_t bin = budget_score_bin(job->source, splat, job->view);
+        job->bins[i] = (uint16_t)bin;
+        local[bin]++;
+    }
+    for (int b = 0; b < BUDGET_HISTOGRAM_BINS; b++)
+    {
+        if (local[b])
+        {
+            __atomic_fetch_add(&job->histogram[b], local[b], __ATOMIC_RELAXED);
+        }
+    }
+}
+
+uint32_t budget_select(const cpu_splat_source_t *source, Camera *camera, int width, int height,
+                       uint32_t budget, uint32_t *out_indices, budget_stats_t *out_stats)
+{
+    budget_stats_t stats = {0};
+    if (!source || !source->texels || !camera || !out_indices || width <= 0 || height <= 0)
+    {
+        if (out_stats)
+        {
+            *out_stats = stats;
+        }
+        return 0;
+    }
+
+    double start_time = time_now_ms();
+    uint32_t count = source->indices ? source->index_count : source->splat_count;
+    stats.candidates = count;
+
+    // Everything fits, nothing to rank
+    if (count <= budget)
+    {
+        for (uint32_t i = 0; i < count; i++)
+        {
+            out_indices[i] = source->indices ? source->indices[i] : i;
+        }
+        stats.kept = count;
+        stats.select_ms = time_now_ms() - start_time;
+        if (out_stats)
+        {
+            *out_stats = stats;
+        }
+        return count;
+    }
+
+    uint16_t *bins = (uint16_t *)core_malloc(MEMORY_TAG_SORT, (size_t)count * sizeof(uint16_t));
+    if (!bins)
+    {
+        print("ERROR: Failed to allocate budget scores for %u splats\n", count);
+        if (out_stats)
+        {
+            *out_stats = stats;
+        }
+        return 0;
+    }
+
+    budget_view_t view;
+    budget_view_init(&view, camera, width, height);
+
+    // STEP 1: Score and histogram
+    uint32_t histogram[BUDGET_HISTOGRAM_BINS] = {0};
+    budget_score_job_t score_job = {.source = source, .view = &view, .bins = bins, .histogram = histogram};
+    job_parallel_for(count, 16384, score_budget_range, &score_job);
+
+    // STEP 2: Threshold bin, walking down from the highest scores
+    uint32_t remaining = budget;
+    uint32_t threshold_bin = 0;
+    for (int b = BUDGET_HISTOGRAM_BINS - 1; b >= 0; b--)
+    {
+        if (histogram[b] >= remaining)
+        {
+            threshold_bin = (uint32_t)b;
+            break;
+        }
+        remaining -= histogram[b];
+    }
+
+    // STEP 3: Compact, ties in the threshold bin fill the remaining quota
+    uint32_t written = 0;
+    uint32_t quota = remaining;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        bool keep = bins[i] > threshold_bin;
+        if (bins[i] == threshold_bin && quota > 0)
+        {
+            keep = true;
+            quota--;
+        }
+        if (keep)
+        {
+            out_indices[written++] = source->indices ? source->indices[i] : i;
+        }
+    }
+    core_free(bins);
+
+    stats.kept = written;
+    stats.dropped = count - written;
+    stats.threshold_bin = threshold_bin;
+    stats.select_ms = time_now_ms() - start_time;
+    if (out_stats)
+    {
+        *out_stats = stats;
+    }
+    return written;
+}
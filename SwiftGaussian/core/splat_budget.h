@@ -0,0 +1,68 @@
+#ifndef SPLAT_BUDGET_H
+#define SPLAT_BUDGET_H
+
+#include <stdint.h>
+#include "camera.h"
+#include "cpu_renderer.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// Importance histogram, log2 of the score spread over [BUDGET_LOG2_MIN, BUDGET_LOG2_MAX];
+// bin 0 holds splats with no score. Keep in sync with rendering/select.glsl.
+#define BUDGET_HISTOGRAM_BINS 1024
+#define BUDGET_LOG2_MIN (-16.0f)
+#define BUDGET_LOG2_MAX 24.0f
+
+// GPU select state: histogram followed by threshold bin, quota, kept and tie counters
+#define BUDGET_STATE_WORDS (BUDGET_HISTOGRAM_BINS + 4)
+
+    typedef struct
+    {
+        uint32_t candidates; // splats entering the selection (all, or the LOD cut)
+        uint32_t kept;
+        uint32_t dropped;
+        uint32_t threshold_bin; // lowest histogram bin that was (partially) kept
+        double select_ms;
+    } budget_stats_t;
+
+    // Parameters shared by the CPU reference and the GPU select pass
+    typedef struct
+    {
+        HMM_Mat4 view_proj;
+        HMM_Vec3 camera_pos;
+        HMM_Vec3 camera_forward;
+        float focal_px; // pixels per unit at distance 1
+        float width;
+        float height;
+    } budget_view_t;
+
+    void budget_view_init(budget_view_t *view, Camera *camera, int width, int height);
+
+    // Histogram bin of a splat: projected area in pixels^2 * opacity, 0 when culled or transparent
+    uint32_t budget_score_bin(const cpu_splat_source_t *source, uint32_t splat, const budget_view_t *view);
+
+    /**
+     * CPU reference of the per-frame budget selection: keep the budget highest scoring splats
+     * Scores are binned into a log histogram, the threshold bin is found by walking it from the top
+     * and ties in that bin are kept first come first served, so no full sort is needed.
+     *
+     * @param source Texels and bounds; source->indices selects the candidates (NULL for all)
+     * @param camera View to score for
+     * @param width Viewport width in pixels
+     * @param height Viewport height in pixels
+     * @param budget Maximum splats to keep
+     * @param out_indices Kept splat indices in candidate order, needs min(candidates, budget) entries
+     * @param out_stats Optional, may be NULL
+     * @return Number of indices written
+     */
+    uint32_t budget_select(const cpu_splat_source_t *source, Camera *camera, int width, int height,
+                           uint32_t budget, uint32_t *out_indices, budget_stats_t *out_stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SPLAT_BUDGET_H
@@ -1,58 +1,273 @@
 #include "splat_texture.h"
+#include "utils/core_memory.h"
+#include "utils/jobs.h"
 #include "utils/logger.h"
+#include "utils/quaternion.h"
+#include "utils/trace.h"
 #include <stdlib.h>
 #include <memory.h>
 #include <stdint.h>
+#include <math.h>
 
-#ifdef _OPENMP
-#include <omp.h>
-#endif
+// Splats per parallel range of the CPU conversions
+#define CONVERT_GRAIN 4096
 
 #define TEXTURE_WIDTH 1024
 #define TEXTURE_HEIGHT 1024
 #define MAX_SPLATS_PER_LAYER (TEXTURE_WIDTH * TEXTURE_HEIGHT)
 
-static uint32_t *convert_splats_to_texture_data(PackedSplat *splats, uint32_t splat_count,
-                                                int texture_width, int texture_height, int num_layers)
+bool splat_chunk_visible(const splat_chunk_t *chunk, const HMM_Vec4 *planes, int plane_count)
 {
-    size_t pixels_per_layer = (size_t)texture_width * texture_height;
-    size_t total_pixels = pixels_per_layer * num_layers;
-    size_t total_bytes = total_pixels * 4 * sizeof(uint32_t);
-
-    uint32_t *texture_data = (uint32_t *)malloc(total_bytes);
-    if (!texture_data)
+    HMM_Vec3 center = HMM_MulV3F(HMM_Add(chunk->min, chunk->max), 0.5f);
+    HMM_Vec3 half = HMM_MulV3F(HMM_Sub(chunk->max, chunk->min), 0.5f);
+    for (int p = 0; p < plane_count; p++)
     {
-        print("ERROR: Failed to allocate %zu bytes for texture data\n", total_bytes);
-        return NULL;
+        HMM_Vec4 plane = planes[p];
+        // Box corner furthest along the plane normal, grown by the splats' own reach
+        float reach = fabsf(plane.X) * half.X + fabsf(plane.Y) * half.Y + fabsf(plane.Z) * half.Z + chunk->extent;
+        float d = plane.X * center.X + plane.Y * center.Y + plane.Z * center.Z + plane.W;
+        if (d < -reach)
+        {
+            return false;
+        }
     }
+    return true;
+}
 
-    memset(texture_data, 0, total_bytes);
+typedef struct
+{
+    const PackedSplat *splats;
+    splat_layout_t layout;
+    uint32_t *data;
+} convert_job_t;
 
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static, 1024) if (splat_count > 5000)
-#endif
-    for (uint32_t i = 0; i < splat_count; i++)
+static void convert_texels(uint32_t begin, uint32_t end, uint32_t slot, void *context)
+{
+    (void)slot;
+    TRACE_BEGIN("packing");
+    const convert_job_t *job = (const convert_job_t *)context;
+    const splat_layout_t layout = job->layout;
+    uint32_t *texture_data = job->data;
+    for (uint32_t i = begin; i < end; i++)
     {
-        PackedSplat *splat = &splats[i];
+        const PackedSplat *splat = &job->splats[i];
         size_t pixel_index = (size_t)i * 4;
 
         texture_data[pixel_index + 0] = ((uint32_t)splat->pos_x << 16) | splat->pos_y;
-        texture_data[pixel_index + 1] = ((uint32_t)splat->pos_z << 16) |
-                                        ((uint32_t)splat->rot_axis_u << 8) |
-                                        splat->rot_axis_v;
-        texture_data[pixel_index + 2] = ((uint32_t)splat->rot_angle << 24) |
-                                        ((uint32_t)splat->scale_x << 16) |
-                                        ((uint32_t)splat->scale_y << 8) |
-                                        splat->scale_z;
+        if (layout == SPLAT_LAYOUT_QUATERNION)
+        {
+            // Inverse of splat_texel_quaternion
+            texture_data[pixel_index + 1] = ((uint32_t)splat->pos_z << 16) | (splat->rot_quat & 0xFFFFu);
+            texture_data[pixel_index + 2] = (((splat->rot_quat >> 16) & 0xFFu) << 24) |
+                                            ((uint32_t)splat->scale_x << 16) |
+                                            ((uint32_t)splat->scale_y << 8) |
+                                            (splat->rot_quat >> 24);
+        }
+        else
+        {
+            texture_data[pixel_index + 1] = ((uint32_t)splat->pos_z << 16) |
+                                            ((uint32_t)splat->rot_axis_u << 8) |
+                                            splat->rot_axis_v;
+            texture_data[pixel_index + 2] = ((uint32_t)splat->rot_angle << 24) |
+                                            ((uint32_t)splat->scale_x << 16) |
+                                            ((uint32_t)splat->scale_y << 8) |
+                                            splat->scale_z;
+        }
         texture_data[pixel_index + 3] = ((uint32_t)splat->r << 24) |
                                         ((uint32_t)splat->g << 16) |
                                         ((uint32_t)splat->b << 8) |
                                         splat->a;
     }
+    TRACE_END();
+}
+
+uint32_t *convert_splats_to_texture_data(PackedSplat *splats, uint32_t splat_count, splat_layout_t layout,
+                                         int texture_width, int texture_height, int num_layers)
+{
+    size_t pixels_per_layer = (size_t)texture_width * texture_height;
+    size_t total_pixels = pixels_per_layer * num_layers;
+    size_t total_bytes = total_pixels * 4 * sizeof(uint32_t);
+
+    uint32_t *texture_data = (uint32_t *)core_malloc(MEMORY_TAG_UPLOAD, total_bytes);
+    if (!texture_data)
+    {
+        print("ERROR: Failed to allocate %zu bytes for texture data\n", total_bytes);
+        return NULL;
+    }
 
+    // Only the padding needs zeros, the splats' texels are all written
+    convert_splats_into_texels(splats, splat_count, layout, texture_data);
+    memset(&texture_data[(size_t)splat_count * 4], 0, total_bytes - (size_t)splat_count * 4 * sizeof(uint32_t));
     return texture_data;
 }
 
+void convert_splats_into_texels(const PackedSplat *splats, uint32_t splat_count, splat_layout_t layout,
+                                uint32_t *out_texels)
+{
+    convert_job_t job = {.splats = splats, .layout = layout, .data = out_texels};
+    job_parallel_for(splat_count, CONVERT_GRAIN, convert_texels, &job);
+}
+
+// IEEE 754 binary16, round to nearest even; values beyond the half range become infinity
+static inline uint16_t float_to_half(float value)
+{
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    uint32_t sign = (bits >> 16) & 0x8000u;
+    int32_t exponent = (int32_t)((bits >> 23) & 0xFFu) - 127 + 15;
+    uint32_t mantissa = bits & 0x7FFFFFu;
+
+    if (exponent >= 31)
+    {
+        return (uint16_t)(sign | 0x7C00u);
+    }
+    if (exponent <= 0)
+    {
+        // Subnormal half (or zero)
+        if (exponent < -10)
+        {
+            return (uint16_t)sign;
+        }
+        mantissa |= 0x800000u;
+        uint32_t shift = (uint32_t)(14 - exponent);
+        uint32_t half_mantissa = mantissa >> shift;
+        uint32_t remainder = mantissa & ((1u << shift) - 1u);
+        uint32_t halfway = 1u << (shift - 1u);
+        if (remainder > halfway || (remainder == halfway && (half_mantissa & 1u)))
+        {
+            half_mantissa++;
+        }
+        return (uint16_t)(sign | half_mantissa);
+    }
+
+    uint32_t half = sign | ((uint32_t)exponent << 10) | (mantissa >> 13);
+    uint32_t remainder = mantissa & 0x1FFFu;
+    if (remainder > 0x1000u || (remainder == 0x1000u && (half & 1u)))
+    {
+        half++; // may carry into the exponent, which is still correct rounding
+    }
+    return (uint16_t)half;
+}
+
+typedef struct
+{
+    const PackedSplat *splats;
+    uint32_t splat_count;
+    uint32_t *words;
+} position_job_t;
+
+// Two splats fill three words exactly, so pairs never share a word with their neighbours
+static void convert_position_pairs(uint32_t pair_begin, uint32_t pair_end, uint32_t slot, void *context)
+{
+    (void)slot;
+    TRACE_BEGIN("packing");
+    const position_job_t *job = (const position_job_t *)context;
+    const uint32_t splat_count = job->splat_count;
+    for (uint32_t pair = pair_begin; pair < pair_end; pair++)
+    {
+        const PackedSplat *a = &job->splats[pair * 2];
+        uint32_t *out = &job->words[(size_t)pair * 3];
+        out[0] = (uint32_t)a->pos_x | ((uint32_t)a->pos_y << 16);
+        if (pair * 2 + 1 < splat_count)
+        {
+            const PackedSplat *b = a + 1;
+            out[1] = (uint32_t)a->pos_z | ((uint32_t)b->pos_x << 16);
+            out[2] = (uint32_t)b->pos_y | ((uint32_t)b->pos_z << 16);
+        }
+        else
+        {
+            out[1] = a->pos_z;
+        }
+    }
+    TRACE_END();
+}
+
+uint32_t *convert_splats_to_position_data(const PackedSplat *splats, uint32_t splat_count)
+{
+    size_t word_count = splat_position_words(splat_count);
+    uint32_t *words = (uint32_t *)core_malloc(MEMORY_TAG_UPLOAD, word_count * sizeof(uint32_t) + 1);
+    if (!words)
+    {
+        print("ERROR: Failed to allocate %zu bytes for position data\n", word_count * sizeof(uint32_t));
+        return NULL;
+    }
+
+    convert_splats_into_positions(splats, splat_count, words);
+    return words;
+}
+
+void convert_splats_into_positions(const PackedSplat *splats, uint32_t splat_count, uint32_t *out_words)
+{
+    position_job_t job = {.splats = splats, .splat_count = splat_count, .words = out_words};
+    job_parallel_for((splat_count + 1) / 2, CONVERT_GRAIN / 2, convert_position_pairs, &job);
+}
+
+static void convert_covariances(uint32_t begin, uint32_t end, uint32_t slot, void *context)
+{
+    (void)slot;
+    TRACE_BEGIN("packing");
+    const convert_job_t *job = (const convert_job_t *)context;
+    const splat_layout_t layout = job->layout;
+    const float inv_255 = 1.0f / 255.0f;
+    for (uint32_t i = begin; i < end; i++)
+    {
+        const PackedSplat *splat = &job->splats[i];
+
+        // Same decode as splat.glsl
+        HMM_Quat q;
+        if (layout == SPLAT_LAYOUT_QUATERNION)
+        {
+            q = quat_decode_smallest_three(splat->rot_quat);
+        }
+        else
+        {
+            HMM_Vec3 axis = octahedral_decode(HMM_V2(splat->rot_axis_u * inv_255, splat->rot_axis_v * inv_255));
+            q = axis_angle_to_quat(axis, splat->rot_angle * inv_255 * HMM_PI32);
+        }
+        float scale_x = expf(splat->scale_x / 25.5f - 5.0f);
+        float scale_y = expf(splat->scale_y / 25.5f - 5.0f);
+
+        // First two columns of quat_to_mat3, scaled
+        float u[3] = {(1.0f - 2.0f * (q.Y * q.Y + q.Z * q.Z)) * scale_x,
+                      2.0f * (q.X * q.Y - q.W * q.Z) * scale_x,
+                      2.0f * (q.X * q.Z + q.W * q.Y) * scale_x};
+        float v[3] = {2.0f * (q.X * q.Y + q.W * q.Z) * scale_y,
+                      (1.0f - 2.0f * (q.X * q.X + q.Z * q.Z)) * scale_y,
+                      2.0f * (q.Y * q.Z - q.W * q.X) * scale_y};
+
+        // unpackHalf2x16 takes the first value from the low 16 bits
+        uint32_t *texel = &job->data[(size_t)i * 4];
+        texel[0] = float_to_half(u[0]) | ((uint32_t)float_to_half(u[1]) << 16);
+        texel[1] = float_to_half(u[2]) | ((uint32_t)float_to_half(v[0]) << 16);
+        texel[2] = float_to_half(v[1]) | ((uint32_t)float_to_half(v[2]) << 16);
+        texel[3] = 0;
+    }
+    TRACE_END();
+}
+
+uint32_t *convert_splats_to_covariance_data(const PackedSplat *splats, uint32_t splat_count, splat_layout_t layout,
+                                            int texture_width, int texture_height, int num_layers)
+{
+    size_t total_bytes = (size_t)texture_width * texture_height * num_layers * 4 * sizeof(uint32_t);
+    uint32_t *covariance_data = (uint32_t *)core_malloc(MEMORY_TAG_UPLOAD, total_bytes);
+    if (!covariance_data)
+    {
+        print("ERROR: Failed to allocate %zu bytes for covariance data\n", total_bytes);
+        return NULL;
+    }
+
+    convert_splats_into_covariance(splats, splat_count, layout, covariance_data);
+    memset(&covariance_data[(size_t)splat_count * 4], 0, total_bytes - (size_t)splat_count * 4 * sizeof(uint32_t));
+    return covariance_data;
+}
+
+void convert_splats_into_covariance(const PackedSplat *splats, uint32_t splat_count, splat_layout_t layout,
+                                    uint32_t *out_texels)
+{
+    convert_job_t job = {.splats = splats, .layout = layout, .data = out_texels};
+    job_parallel_for(splat_count, CONVERT_GRAIN, convert_covariances, &job);
+}
+
 static void calculate_texture_dimensions(uint32_t splat_count, int *width, int *height, int *num_layers)
 {
     uint32_t required_pixels = splat_count;
@@ -98,79 +313,321 @@ static void calculate_texture_dimensions(uint32_t splat_count, int *width, int *
     *num_layers = selected_layers;
 }
 
-void create_splat_texture_from_data(splat_texture_t *texture, PackedSplat *splats, uint32_t splat_count)
+// RGBA32UI texels as a texture array, or as a storage buffer when texture->storage_buffer is set
+static sg_view upload_texels(const splat_texture_t *texture, const uint32_t *data, int width, int height,
+                             int num_layers, const char *label, sg_image *out_image, sg_buffer *out_buffer)
 {
-    int width, height, num_layers;
-    calculate_texture_dimensions(splat_count, &width, &height, &num_layers);
-
-    texture->width = width;
-    texture->height = height;
-    texture->num_layers = num_layers;
-
-    size_t required_pixels = splat_count;
-    size_t allocated_pixels = (size_t)width * height * num_layers;
-    float efficiency = (float)required_pixels / allocated_pixels * 100.0f;
+    sg_range range = {
+        .ptr = data,
+        .size = (size_t)width * height * num_layers * 4 * sizeof(uint32_t)};
 
-    print("Texture: %u splats, %dx%d, %d layers, %.1f%% efficiency\n",
-          splat_count, width, height, num_layers, efficiency);
-
-    uint32_t *texture_data = convert_splats_to_texture_data(
-        splats, splat_count,
-        texture->width,
-        texture->height,
-        num_layers);
-
-    if (!texture_data)
+    if (texture->storage_buffer)
     {
-        print("ERROR: Failed to convert splat data\n");
-        return;
+        *out_buffer = core_make_buffer(MEMORY_TAG_SPLAT_TEXTURE, &(sg_buffer_desc){
+            .usage = {.storage_buffer = true, .immutable = true},
+            .data = range,
+            .label = label});
+        return sg_make_view(&(sg_view_desc){
+            .storage_buffer = {.buffer = *out_buffer},
+            .label = label});
     }
 
-    size_t total_size = (size_t)texture->width *
-                        texture->height *
-                        num_layers * sizeof(uint32_t) * 4;
-
     sg_image_data image_data = {0};
-    image_data.mip_levels[0] = (sg_range){
-        .ptr = texture_data,
-        .size = total_size};
-
-    texture->texture = sg_make_image(&(sg_image_desc){
+    image_data.mip_levels[0] = range;
+    *out_image = core_make_image(MEMORY_TAG_SPLAT_TEXTURE, &(sg_image_desc){
         .type = SG_IMAGETYPE_ARRAY,
-        .width = texture->width,
-        .height = texture->height,
+        .width = width,
+        .height = height,
         .num_slices = num_layers,
         .pixel_format = SG_PIXELFORMAT_RGBA32UI,
         .usage = {.immutable = true},
         .data = image_data,
-        .label = "splat-texture"});
+        .label = label});
+    return sg_make_view(&(sg_view_desc){
+        .texture = {
+            .image = *out_image,
+        },
+        .label = label});
+}
+
+static void create_position_buffer(splat_texture_t *texture, const PackedSplat *splats, uint32_t splat_count,
+                                   uint32_t capacity)
+{
+    uint32_t *position_data = convert_splats_to_position_data(splats, splat_count);
+    size_t words = splat_position_words(splat_count);
+    size_t capacity_words = splat_position_words(capacity);
+    if (position_data && capacity_words > words)
+    {
+        uint32_t *grown = (uint32_t *)core_realloc(MEMORY_TAG_UPLOAD, position_data, capacity_words * sizeof(uint32_t));
+        if (grown)
+        {
+            memset(grown + words, 0, (capacity_words - words) * sizeof(uint32_t));
+        }
+        else
+        {
+            core_free(position_data);
+        }
+        position_data = grown;
+    }
+    if (!position_data)
+    {
+        return;
+    }
+
+    texture->position_buffer = core_make_buffer(MEMORY_TAG_SPLAT_TEXTURE, &(sg_buffer_desc){
+        .usage = {.storage_buffer = true, .immutable = true},
+        .data = {.ptr = position_data, .size = capacity_words * sizeof(uint32_t)},
+        .label = "splat-positions"});
+    texture->position_view = sg_make_view(&(sg_view_desc){
+        .storage_buffer = {.buffer = texture->position_buffer},
+        .label = "splat-positions"});
+    core_free(position_data);
+}
 
-    texture->sampler = sg_make_sampler(&(sg_sampler_desc){
+static sg_sampler make_splat_sampler(void)
+{
+    return sg_make_sampler(&(sg_sampler_desc){
         .min_filter = SG_FILTER_NEAREST,
         .mag_filter = SG_FILTER_NEAREST,
         .mipmap_filter = SG_FILTER_NEAREST,
         .wrap_u = SG_WRAP_CLAMP_TO_EDGE,
         .wrap_v = SG_WRAP_CLAMP_TO_EDGE,
         .label = "splat-sampler"});
+}
 
-    texture->view = sg_make_view(&(sg_view_desc){
+// Full covariance data when requested, otherwise a one-texel stub that is bound but never read
+static void create_covariance_texture(splat_texture_t *texture, const PackedSplat *splats, uint32_t splat_count,
+                                      bool precompute)
+{
+    static const uint32_t stub_texel[4] = {0, 0, 0, 0};
+    uint32_t *covariance_data = NULL;
+    if (precompute)
+    {
+        covariance_data = convert_splats_to_covariance_data(splats, splat_count, texture->layout,
+                                                            texture->width, texture->height, texture->num_layers);
+    }
+
+    texture->has_covariance = covariance_data != NULL;
+    if (texture->has_covariance)
+    {
+        texture->covariance_view = upload_texels(texture, covariance_data, texture->width, texture->height,
+                                                 texture->num_layers, "splat-covariance",
+                                                 &texture->covariance_texture, &texture->covariance_buffer);
+        texture->covariance_bytes = splat_texture_bytes(texture);
+    }
+    else
+    {
+        texture->covariance_view = upload_texels(texture, stub_texel, 1, 1, 1, "splat-covariance-stub",
+                                                 &texture->covariance_texture, &texture->covariance_buffer);
+        texture->covariance_bytes = sizeof(stub_texel);
+    }
+    core_free(covariance_data);
+}
+
+// Chunk bounds as RGBA32F, rows padded to SPLAT_CHUNKS_PER_ROW chunks
+static void create_chunk_texture(splat_texture_t *texture, const splat_chunk_t *chunks, uint32_t chunk_count)
+{
+    int rows = (int)((chunk_count + SPLAT_CHUNKS_PER_ROW - 1) / SPLAT_CHUNKS_PER_ROW);
+    size_t total_size = (size_t)rows * SPLAT_CHUNKS_PER_ROW * sizeof(splat_chunk_t);
+    splat_chunk_t *chunk_data = (splat_chunk_t *)core_calloc(MEMORY_TAG_UPLOAD, 1, total_size);
+    if (!chunk_data)
+    {
+        print("ERROR: Failed to allocate %zu bytes for chunk data\n", total_size);
+        return;
+    }
+    memcpy(chunk_data, chunks, (size_t)chunk_count * sizeof(splat_chunk_t));
+
+    sg_image_data image_data = {0};
+    image_data.mip_levels[0] = (sg_range){
+        .ptr = chunk_data,
+        .size = total_size};
+
+    texture->chunk_texture = core_make_image(MEMORY_TAG_SPLAT_TEXTURE, &(sg_image_desc){
+        .width = SPLAT_CHUNKS_PER_ROW * 2,
+        .height = rows,
+        .pixel_format = SG_PIXELFORMAT_RGBA32F,
+        .usage = {.immutable = true},
+        .data = image_data,
+        .label = "splat-chunk-texture"});
+
+    texture->chunk_view = sg_make_view(&(sg_view_desc){
         .texture = {
-            .image = texture->texture,
+            .image = texture->chunk_texture,
         },
-        .label = "splat-texture-view"});
+        .label = "splat-chunk-texture-view"});
+    texture->chunk_count = chunk_count;
+
+    core_free(chunk_data);
+}
+
+void create_splat_texture_from_data(splat_texture_t *texture, PackedSplat *splats, uint32_t splat_count,
+                                    const splat_chunk_t *chunks, const splat_upload_options_t *options)
+{
+    // A progressive load fills a prefix of storage sized for the whole scene
+    uint32_t capacity = options->capacity > splat_count ? options->capacity : splat_count;
+
+    int width, height, num_layers;
+    if (options->storage_buffer)
+    {
+        // One texel per splat, no padding and no layer limits
+        width = (int)capacity;
+        height = 1;
+        num_layers = 1;
+    }
+    else
+    {
+        calculate_texture_dimensions(capacity, &width, &height, &num_layers);
+    }
+    TRACE_BEGIN("upload");
+
+    texture->width = width;
+    texture->height = height;
+    texture->num_layers = num_layers;
+    texture->layout = options->layout;
+    texture->storage_buffer = options->storage_buffer;
+
+    uint32_t *texture_data = convert_splats_to_texture_data(
+        splats, splat_count, options->layout,
+        texture->width,
+        texture->height,
+        num_layers);
+
+    if (!texture_data)
+    {
+        print("ERROR: Failed to convert splat data\n");
+        TRACE_END();
+        return;
+    }
+
+    texture->view = upload_texels(texture, texture_data, width, height, num_layers, "splat-texture",
+                                  &texture->texture, &texture->buffer);
 
-    free(texture_data);
+    texture->sampler = make_splat_sampler();
 
-    if (texture->texture.id == SG_INVALID_ID ||
-        texture->sampler.id == SG_INVALID_ID ||
-        texture->view.id == SG_INVALID_ID)
+    core_free(texture_data);
+
+    create_chunk_texture(texture, chunks, splat_chunk_count(capacity));
+    create_covariance_texture(texture, splats, splat_count, options->precompute_covariance);
+    if (options->position_stream)
+    {
+        create_position_buffer(texture, splats, splat_count, capacity);
+    }
+
+    if (texture->sampler.id == SG_INVALID_ID ||
+        texture->view.id == SG_INVALID_ID ||
+        texture->chunk_view.id == SG_INVALID_ID ||
+        texture->covariance_view.id == SG_INVALID_ID)
     {
         print("ERROR: Failed to create texture resources\n");
     }
+    TRACE_END();
+
+    // Once per scene; the batches of a progressive load only show up in the trace
+    if (splat_count == capacity)
+    {
+        print("%s: %u splats, %dx%d, %d layers, %.1f%% efficiency, %.1f MB%s, %u chunks\n",
+              options->storage_buffer ? "Splat buffer" : "Texture", capacity, width, height, num_layers,
+              (float)capacity / ((size_t)width * height * num_layers) * 100.0f,
+              splat_texture_bytes(texture) * (texture->has_covariance ? 2 : 1) / (1024.0f * 1024.0f),
+              texture->has_covariance ? " with covariance" : "", splat_chunk_count(capacity));
+    }
+}
+
+void create_splat_texture_for_compute(splat_texture_t *texture, uint32_t splat_count, const splat_chunk_t *chunks,
+                                      const splat_upload_options_t *options)
+{
+    texture->width = (int)splat_count;
+    texture->height = 1;
+    texture->num_layers = 1;
+    texture->layout = options->layout;
+    texture->storage_buffer = true;
+
+    // Immutable but without data: only compute passes write them
+    texture->buffer = core_make_buffer(MEMORY_TAG_SPLAT_TEXTURE, &(sg_buffer_desc){
+        .size = (size_t)splat_count * 4 * sizeof(uint32_t),
+        .usage = {.storage_buffer = true},
+        .label = "splat-texture"});
+    texture->view = sg_make_view(&(sg_view_desc){
+        .storage_buffer = {.buffer = texture->buffer},
+        .label = "splat-texture"});
+
+    texture->position_buffer = core_make_buffer(MEMORY_TAG_SPLAT_TEXTURE, &(sg_buffer_desc){
+        .size = splat_position_words(splat_count) * sizeof(uint32_t),
+        .usage = {.storage_buffer = true},
+        .label = "splat-positions"});
+    texture->position_view = sg_make_view(&(sg_view_desc){
+        .storage_buffer = {.buffer = texture->position_buffer},
+        .label = "splat-positions"});
+
+    texture->sampler = make_splat_sampler();
+    create_chunk_texture(texture, chunks, splat_chunk_count(splat_count));
+    if (options->precompute_covariance)
+    {
+        texture->covariance_buffer = core_make_buffer(MEMORY_TAG_SPLAT_TEXTURE, &(sg_buffer_desc){
+            .size = (size_t)splat_count * 4 * sizeof(uint32_t),
+            .usage = {.storage_buffer = true},
+            .label = "splat-covariance"});
+        texture->covariance_view = sg_make_view(&(sg_view_desc){
+            .storage_buffer = {.buffer = texture->covariance_buffer},
+            .label = "splat-covariance"});
+        texture->covariance_bytes = (size_t)splat_count * 4 * sizeof(uint32_t);
+        texture->has_covariance = true;
+    }
+    else
+    {
+        create_covariance_texture(texture, NULL, splat_count, false);
+    }
+
+    print("Splat buffer: %u splats, %.1f MB, %u chunks, filled by compute passes\n", splat_count,
+          splat_count * (texture->has_covariance ? 32 : 16) / (1024.0f * 1024.0f), splat_chunk_count(splat_count));
 }
 
 void cleanup_splat_texture(splat_texture_t *texture)
 {
+    if (texture->position_view.id != SG_INVALID_ID)
+    {
+        sg_destroy_view(texture->position_view);
+        texture->position_view.id = SG_INVALID_ID;
+    }
+
+    if (texture->position_buffer.id != SG_INVALID_ID)
+    {
+        core_destroy_buffer(MEMORY_TAG_SPLAT_TEXTURE, texture->position_buffer);
+        texture->position_buffer.id = SG_INVALID_ID;
+    }
+
+    if (texture->covariance_view.id != SG_INVALID_ID)
+    {
+        sg_destroy_view(texture->covariance_view);
+        texture->covariance_view.id = SG_INVALID_ID;
+    }
+
+    if (texture->covariance_texture.id != SG_INVALID_ID)
+    {
+        core_destroy_image(MEMORY_TAG_SPLAT_TEXTURE, texture->covariance_texture);
+        texture->covariance_texture.id = SG_INVALID_ID;
+    }
+
+    if (texture->covariance_buffer.id != SG_INVALID_ID)
+    {
+        core_destroy_buffer(MEMORY_TAG_SPLAT_TEXTURE, texture->covariance_buffer);
+        texture->covariance_buffer.id = SG_INVALID_ID;
+    }
+    texture->covariance_bytes = 0;
+    texture->has_covariance = false;
+
+    if (texture->chunk_view.id != SG_INVALID_ID)
+    {
+        sg_destroy_view(texture->chunk_view);
+        texture->chunk_view.id = SG_INVALID_ID;
+    }
+
+    if (texture->chunk_texture.id != SG_INVALID_ID)
+    {
+        core_destroy_image(MEMORY_TAG_SPLAT_TEXTURE, texture->chunk_texture);
+        texture->chunk_texture.id = SG_INVALID_ID;
+    }
+
     if (texture->view.id != SG_INVALID_ID)
     {
         sg_destroy_view(texture->view);
@@ -185,7 +642,13 @@ void cleanup_splat_texture(splat_texture_t *texture)
 
     if (texture->texture.id != SG_INVALID_ID)
     {
-        sg_destroy_image(texture->texture);
+        core_destroy_image(MEMORY_TAG_SPLAT_TEXTURE, texture->texture);
         texture->texture.id = SG_INVALID_ID;
     }
+
+    if (texture->buffer.id != SG_INVALID_ID)
+    {
+        core_destroy_buffer(MEMORY_TAG_SPLAT_TEXTURE, texture->buffer);
+        texture->buffer.id = SG_INVALID_ID;
+    }
 }
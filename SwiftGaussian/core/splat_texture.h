@@ -1,22 +1,81 @@
 #ifndef SPLAT_TEXTURE_H
 #define SPLAT_TEXTURE_H
 
+#include <stdbool.h>
 #include <stdint.h>
 #include "sokol/sokol_gfx.h"
+#include "utils/handmademath.h"
 
 #ifdef __cplusplus
 extern "C"
 {
 #endif
 
+// Positions are quantized relative to the bounds of their chunk of consecutive splats
+#define SPLAT_CHUNK_SIZE 256
+
+// Chunks per row of the chunk texture (two RGBA32F texels each), matches splat.glsl, depth.glsl and select.glsl
+#define SPLAT_CHUNKS_PER_ROW 1024
+
+    // Bounds of splats [i * SPLAT_CHUNK_SIZE, (i + 1) * SPLAT_CHUNK_SIZE), uploaded as-is
+    typedef struct
+    {
+        HMM_Vec3 min;
+        float extent; // largest drawn radius (half the larger quad axis) in the chunk, for culling
+        HMM_Vec3 max;
+        float _pad;
+    } splat_chunk_t;
+
+    // How the rotation is stored; both layouts keep position, x/y scale and color in the same texel bits
+    typedef enum
+    {
+        // Octahedral axis + angle, 8 bits each, plus the (undrawn) z scale
+        SPLAT_LAYOUT_AXIS_ANGLE = 0,
+        // Smallest-three quaternion (quat_encode_smallest_three) in place of the z scale and angle bytes
+        SPLAT_LAYOUT_QUATERNION = 1,
+    } splat_layout_t;
+
+    // How create_splat_texture_from_data uploads the splats
+    typedef struct
+    {
+        splat_layout_t layout;
+        bool precompute_covariance; // doubles GPU memory per splat, splat.glsl skips the rotation and scale decode
+        bool storage_buffer;        // flat buffer indexed by splat id instead of a padded texture array
+        bool position_stream;       // also upload the positions alone for depth.glsl, needs storage buffer support
+        uint32_t capacity;          // size everything for this many splats (0: splat_count), the rest stays zero
+    } splat_upload_options_t;
+
+    // Packed splats on the GPU: an RGBA32UI texture array, or with storage_buffer one
+    // unpadded buffer of the same texels (width = splat count, height = layers = 1)
     typedef struct
     {
         sg_image texture;
+        sg_buffer buffer;
         sg_sampler sampler;
-        sg_view view;
+        sg_view view; // texture or storage buffer view of the splat texels
         int width;
         int height;
         int num_layers;
+        splat_layout_t layout;
+        bool storage_buffer;
+
+        // splat_chunk_t table, RGBA32F with SPLAT_CHUNKS_PER_ROW chunks per row
+        sg_image chunk_texture;
+        sg_view chunk_view;
+        uint32_t chunk_count;
+
+        // Precomputed covariance factor, same size and kind as texture: the scaled quad axes U and V
+        // (Sigma = U U^T + V V^T) as six half floats. A one-texel stub when has_covariance is false.
+        sg_image covariance_texture;
+        sg_buffer covariance_buffer;
+        sg_view covariance_view;
+        size_t covariance_bytes; // GPU memory of covariance_texture or covariance_buffer as created, the stub included
+        bool has_covariance;
+
+        // Quantized positions alone, 6 bytes per splat (see convert_splats_to_position_data), so the
+        // depth pass reads 6 instead of 16 bytes. Invalid when position_stream was not requested.
+        sg_buffer position_buffer;
+        sg_view position_view;
     } splat_texture_t;
 
     typedef struct
@@ -24,13 +83,23 @@ extern "C"
         // Position: 3 * 16-bit normalized values
         uint16_t pos_x, pos_y, pos_z;
 
-        // Rotation: 3 bytes using axis-angle + octahedral encoding
-        uint8_t rot_axis_u; // Octahedral U coordinate (0-255)
-        uint8_t rot_axis_v; // Octahedral V coordinate (0-255)
-        uint8_t rot_angle;  // Angle in range [0, π] encoded as 0-255
+        // Scale: 8-bit log scale, x and y span the drawn quad
+        uint8_t scale_x, scale_y;
+
+        union
+        {
+            // SPLAT_LAYOUT_AXIS_ANGLE
+            struct
+            {
+                uint8_t scale_z;
+                uint8_t rot_axis_u; // Octahedral U coordinate (0-255)
+                uint8_t rot_axis_v; // Octahedral V coordinate (0-255)
+                uint8_t rot_angle;  // Angle in range [0, π] encoded as 0-255
+            };
 
-        // Scale: 3 * 8-bit values (log scale)
-        uint8_t scale_x, scale_y, scale_z;
+            // SPLAT_LAYOUT_QUATERNION: three 10-bit components above the 2-bit largest index
+            uint32_t rot_quat;
+        };
 
         // Color: 4 * 8-bit values for RGBA (alpha channel is opacity)
         uint8_t r, g, b, a;
@@ -38,8 +107,70 @@ extern "C"
         // Total: 16 bytes per splat (tightly packed)
     } PackedSplat;
 
+    // Quaternion layout rotation of a texel: the low 16 bits sit under pos_z in g, the high 16
+    // in the angle and z scale bytes of b
+    static inline uint32_t splat_texel_quaternion(const uint32_t *texel)
+    {
+        return (texel[1] & 0xFFFFu) | (((texel[2] >> 24) & 0xFFu) << 16) | ((texel[2] & 0xFFu) << 24);
+    }
+
+    static inline uint32_t splat_chunk_count(uint32_t splat_count)
+    {
+        return (splat_count + SPLAT_CHUNK_SIZE - 1) / SPLAT_CHUNK_SIZE;
+    }
+
+    // World position of a quantized splat position inside its chunk
+    static inline HMM_Vec3 splat_chunk_position(const splat_chunk_t *chunk, uint32_t x, uint32_t y, uint32_t z)
+    {
+        const float inv_65535 = 1.0f / 65535.0f;
+        return HMM_V3(chunk->min.X + (float)x * inv_65535 * (chunk->max.X - chunk->min.X),
+                      chunk->min.Y + (float)y * inv_65535 * (chunk->max.Y - chunk->min.Y),
+                      chunk->min.Z + (float)z * inv_65535 * (chunk->max.Z - chunk->min.Z));
+    }
+
+    // False when the chunk's splats all lie outside one of the planes (normalized, inside positive)
+    bool splat_chunk_visible(const splat_chunk_t *chunk, const HMM_Vec4 *planes, int plane_count);
+
+    // Pack splats into RGBA32UI texels (4 words per splat), zero-padded to width * height * num_layers
+    uint32_t *convert_splats_to_texture_data(PackedSplat *splats, uint32_t splat_count, splat_layout_t layout,
+                                             int texture_width, int texture_height, int num_layers);
+
+    // Pack the scaled quad axes of each splat as RGBA32UI texels: half2(u.x, u.y), half2(u.z, v.x),
+    // half2(v.y, v.z), 0. Zero-padded to width * height * num_layers like convert_splats_to_texture_data.
+    uint32_t *convert_splats_to_covariance_data(const PackedSplat *splats, uint32_t splat_count, splat_layout_t layout,
+                                                int texture_width, int texture_height, int num_layers);
+
+    // The conversions above into the caller's memory, exactly 4 words per splat (splat_position_words for
+    // positions) and no padding, for buffers that are recycled between uploads
+    void convert_splats_into_texels(const PackedSplat *splats, uint32_t splat_count, splat_layout_t layout,
+                                    uint32_t *out_texels);
+    void convert_splats_into_covariance(const PackedSplat *splats, uint32_t splat_count, splat_layout_t layout,
+                                        uint32_t *out_texels);
+
+    // 32-bit words holding three 16-bit positions per splat
+    static inline size_t splat_position_words(uint32_t splat_count)
+    {
+        return ((size_t)splat_count * 3 + 1) / 2;
+    }
+
+    // Chunk-relative positions (pos_x, pos_y, pos_z) of each splat packed back to back as 16-bit values,
+    // splat_position_words(splat_count) words with the first value of each word in its low half
+    uint32_t *convert_splats_to_position_data(const PackedSplat *splats, uint32_t splat_count);
+    void convert_splats_into_positions(const PackedSplat *splats, uint32_t splat_count, uint32_t *out_words);
+
+    // Size of one full texture of the given splat texture's dimensions (16 bytes per texel)
+    static inline size_t splat_texture_bytes(const splat_texture_t *texture)
+    {
+        return (size_t)texture->width * texture->height * texture->num_layers * 4 * sizeof(uint32_t);
+    }
+
     // Texture creation and management
-    void create_splat_texture_from_data(splat_texture_t *texture, PackedSplat *splats, uint32_t splat_count);
+    void create_splat_texture_from_data(splat_texture_t *texture, PackedSplat *splats, uint32_t splat_count,
+                                        const splat_chunk_t *chunks, const splat_upload_options_t *options);
+    // Storage buffer splats, position stream and (with precompute_covariance) covariance left for compute
+    // passes to fill: decode.glsl or the upload queue. The chunk texture and sampler are created as usual.
+    void create_splat_texture_for_compute(splat_texture_t *texture, uint32_t splat_count, const splat_chunk_t *chunks,
+                                          const splat_upload_options_t *options);
     void cleanup_splat_texture(splat_texture_t *texture);
 
 #ifdef __cplusplus
@@ -0,0 +1,281 @@
+#include "upload_queue.h"
+#include "rendering/upload.glsl.h"
+#include "utils/core_memory.h"
+#include "utils/logger.h"
+#include "utils/timer.h"
+#include "utils/trace.h"
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct
+{
+    sg_view target;
+    const uint8_t *data;
+    size_t size;
+    size_t done;
+    size_t target_offset;
+    void *owned;
+    uint64_t tag;
+} upload_job_t;
+
+typedef struct
+{
+    sg_view target;
+    upload_params_t params;
+} upload_slice_t;
+
+static struct
+{
+    bool ready;
+    size_t frame_budget;
+    sg_buffer staging_buffer; // stream buffer, updated once per drain
+    sg_view staging_view;
+    uint8_t *staging;         // CPU side of the next update
+    sg_shader shader;
+    sg_pipeline pipeline;
+
+    // FIFO of jobs, [head, count) pending
+    upload_job_t *jobs;
+    uint32_t head;
+    uint32_t count;
+    uint32_t capacity;
+
+    uint64_t completed_tag;
+    upload_progress_t progress;
+} g_upload_state;
+
+static void destroy_staging(void)
+{
+    if (g_upload_state.staging_view.id != SG_INVALID_ID)
+    {
+        sg_destroy_view(g_upload_state.staging_view);
+        g_upload_state.staging_view.id = SG_INVALID_ID;
+    }
+    if (g_upload_state.staging_buffer.id != SG_INVALID_ID)
+    {
+        core_destroy_buffer(MEMORY_TAG_UPLOAD, g_upload_state.staging_buffer);
+        g_upload_state.staging_buffer.id = SG_INVALID_ID;
+    }
+    core_free(g_upload_state.staging);
+    g_upload_state.staging = NULL;
+}
+
+static bool create_staging(size_t frame_budget)
+{
+    frame_budget &= ~(size_t)3;
+    if (frame_budget == 0)
+    {
+        return false;
+    }
+
+    g_upload_state.staging = (uint8_t *)core_malloc(MEMORY_TAG_UPLOAD, frame_budget);
+    if (!g_upload_state.staging)
+    {
+        print("ERROR: Failed to allocate %zu bytes of upload staging\n", frame_budget);
+        return false;
+    }
+    g_upload_state.staging_buffer = core_make_buffer(MEMORY_TAG_UPLOAD, &(sg_buffer_desc){
+        .size = frame_budget,
+        .usage = {.storage_buffer = true, .stream_update = true},
+        .label = "upload-staging"});
+    g_upload_state.staging_view = sg_make_view(&(sg_view_desc){
+        .storage_buffer = {.buffer = g_upload_state.staging_buffer},
+        .label = "upload-staging"});
+    g_upload_state.frame_budget = frame_budget;
+    return g_upload_state.staging_view.id != SG_INVALID_ID;
+}
+
+bool upload_queue_init(size_t frame_budget)
+{
+    if (g_upload_state.ready)
+    {
+        return true;
+    }
+    if (!sg_query_features().compute)
+    {
+        print("Upload queue needs compute shaders, splats upload at load time\n");
+        return false;
+    }
+
+    g_upload_state.shader = sg_make_shader(upload_copy_shader_desc(sg_query_backend()));
+    g_upload_state.pipeline = sg_make_pipeline(&(sg_pipeline_desc){
+        .compute = true,
+        .shader = g_upload_state.shader,
+        .label = "upload-copy-pipeline"});
+    if (!create_staging(frame_budget))
+    {
+        upload_queue_shutdown();
+        return false;
+    }
+
+    g_upload_state.ready = true;
+    print("Upload queue: %.1f MB per frame\n", g_upload_state.frame_budget / (1024.0f * 1024.0f));
+    return true;
+}
+
+void upload_queue_shutdown(void)
+{
+    upload_queue_clear();
+    destroy_staging();
+    if (g_upload_state.pipeline.id != SG_INVALID_ID)
+    {
+        sg_destroy_pipeline(g_upload_state.pipeline);
+        g_upload_state.pipeline.id = SG_INVALID_ID;
+    }
+    if (g_upload_state.shader.id != SG_INVALID_ID)
+    {
+        sg_destroy_shader(g_upload_state.shader);
+        g_upload_state.shader.id = SG_INVALID_ID;
+    }
+    core_free(g_upload_state.jobs);
+    g_upload_state.jobs = NULL;
+    g_upload_state.capacity = 0;
+    g_upload_state.ready = false;
+}
+
+bool upload_queue_ready(void)
+{
+    return g_upload_state.ready;
+}
+
+void upload_queue_set_budget(size_t frame_budget)
+{
+    if (!g_upload_state.ready || (frame_budget & ~(size_t)3) == g_upload_state.frame_budget)
+    {
+        return;
+    }
+    destroy_staging();
+    if (!create_staging(frame_budget))
+    {
+        print("ERROR: Failed to resize the upload staging buffer\n");
+        g_upload_state.ready = false;
+    }
+}
+
+void upload_queue_push(sg_view target, const void *data, size_t size, size_t target_offset, void *owned,
+                       uint64_t tag)
+{
+    if (g_upload_state.head == g_upload_state.count)
+    {
+        // Empty: reuse the array from the start and begin a new progress count
+        g_upload_state.head = 0;
+        g_upload_state.count = 0;
+        g_upload_state.progress = (upload_progress_t){0};
+    }
+    if (g_upload_state.count == g_upload_state.capacity)
+    {
+        uint32_t capacity = g_upload_state.capacity ? g_upload_state.capacity * 2 : 64;
+        upload_job_t *jobs = (upload_job_t *)core_realloc(MEMORY_TAG_UPLOAD, g_upload_state.jobs, capacity * sizeof(upload_job_t));
+        if (!jobs)
+        {
+            print("ERROR: Failed to grow the upload queue, dropping a %zu byte upload\n", size);
+            core_free(owned);
+            return;
+        }
+        g_upload_state.jobs = jobs;
+        g_upload_state.capacity = capacity;
+    }
+
+    g_upload_state.jobs[g_upload_state.count++] = (upload_job_t){
+        .target = target,
+        .data = (const uint8_t *)data,
+        .size = size,
+        .target_offset = target_offset,
+        .owned = owned,
+        .tag = tag};
+    g_upload_state.progress.queued_bytes += size;
+    g_upload_state.progress.pending_jobs++;
+}
+
+size_t upload_queue_drain(void)
+{
+    if (!g_upload_state.ready || g_upload_state.head == g_upload_state.count)
+    {
+        return 0;
+    }
+
+    TRACE_BEGIN("upload");
+    double start_time = time_now_ms();
+    upload_slice_t slices[UPLOAD_MAX_SLICES_PER_FRAME];
+    uint32_t slice_count = 0;
+    size_t staged = 0;
+    while (g_upload_state.head < g_upload_state.count && staged < g_upload_state.frame_budget &&
+           slice_count < UPLOAD_MAX_SLICES_PER_FRAME)
+    {
+        upload_job_t *job = &g_upload_state.jobs[g_upload_state.head];
+        size_t bytes = job->size - job->done;
+        bytes = bytes < g_upload_state.frame_budget - staged ? bytes : g_upload_state.frame_budget - staged;
+        if (bytes > 0)
+        {
+            memcpy(g_upload_state.staging + staged, job->data + job->done, bytes);
+            slices[slice_count++] = (upload_slice_t){
+                .target = job->target,
+                .params = {
+                    .source_word = (int)(staged / 4),
+                    .target_word = (int)((job->target_offset + job->done) / 4),
+                    .word_count = (int)(bytes / 4)}};
+            staged += bytes;
+        }
+        job->done += bytes;
+
+        if (job->done == job->size)
+        {
+            core_free(job->owned);
+            if (job->tag)
+            {
+                g_upload_state.completed_tag = job->tag;
+            }
+            g_upload_state.head++;
+            g_upload_state.progress.pending_jobs--;
+        }
+    }
+
+    if (staged == 0)
+    {
+        TRACE_END();
+        return 0;
+    }
+    sg_update_buffer(g_upload_state.staging_buffer, &(sg_range){.ptr = g_upload_state.staging, .size = staged});
+
+    // Encoded before this frame's render passes, so the copies land before anything draws from them
+    sg_begin_pass(&(sg_pass){.compute = true, .label = "upload-copy-pass"});
+    sg_apply_pipeline(g_upload_state.pipeline);
+    for (uint32_t i = 0; i < slice_count; i++)
+    {
+        sg_apply_bindings(&(sg_bindings){
+            .views = {
+                [VIEW_upload_source] = g_upload_state.staging_view,
+                [VIEW_upload_target] = slices[i].target}});
+        sg_apply_uniforms(UB_upload_params, &SG_RANGE(slices[i].params));
+        sg_dispatch(((uint32_t)slices[i].params.word_count + 255) / 256, 1, 1);
+    }
+    sg_end_pass();
+
+    g_upload_state.progress.uploaded_bytes += staged;
+    g_upload_state.progress.frames++;
+    g_upload_state.progress.last_drain_ms = time_now_ms() - start_time;
+    TRACE_END();
+    return staged;
+}
+
+void upload_queue_clear(void)
+{
+    for (uint32_t i = g_upload_state.head; i < g_upload_state.count; i++)
+    {
+        core_free(g_upload_state.jobs[i].owned);
+    }
+    g_upload_state.head = 0;
+    g_upload_state.count = 0;
+    g_upload_state.completed_tag = 0;
+    g_upload_state.progress = (upload_progress_t){0};
+}
+
+uint64_t upload_queue_completed_tag(void)
+{
+    return g_upload_state.completed_tag;
+}
+
+upload_progress_t upload_queue_progress(void)
+{
+    return g_upload_state.progress;
+}
@@ -0,0 +1,67 @@
+#ifndef UPLOAD_QUEUE_H
+#define UPLOAD_QUEUE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "sokol/sokol_gfx.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// Most separate copies one drain dispatches, further jobs wait for the next frame
+#define UPLOAD_MAX_SLICES_PER_FRAME 64
+
+    typedef struct
+    {
+        uint64_t queued_bytes; // since the queue was last empty
+        uint64_t uploaded_bytes;
+        uint32_t pending_jobs;
+        uint32_t frames;      // drains that uploaded something since the queue was last empty
+        double last_drain_ms; // CPU time of the last drain: staging copy, buffer update and dispatches
+    } upload_progress_t;
+
+    /**
+     * Create the staging buffer and the copy pipeline (rendering/upload.glsl)
+     * Immutable sokol resources take no partial updates, so each frame the queued data goes through one
+     * stream buffer of frame_budget bytes and a compute pass copies it into place. Needs compute support.
+     *
+     * @param frame_budget Bytes uploaded per drain at most, rounded down to whole words
+     * @return true when the queue is ready
+     */
+    bool upload_queue_init(size_t frame_budget);
+    void upload_queue_shutdown(void);
+    bool upload_queue_ready(void);
+
+    // Takes effect at the next drain; recreates the staging buffer
+    void upload_queue_set_budget(size_t frame_budget);
+
+    /**
+     * Queue a copy into a storage buffer written by compute passes (immutable, created without data)
+     *
+     * @param target Storage buffer view to write
+     * @param data Source bytes, valid until the job is done
+     * @param size Bytes to copy, a multiple of 4
+     * @param target_offset Byte offset into target, a multiple of 4
+     * @param owned core_malloc block freed once the job is done, may be NULL
+     * @param tag Reported by upload_queue_completed_tag once this and every earlier job are done, 0 for none
+     */
+    void upload_queue_push(sg_view target, const void *data, size_t size, size_t target_offset, void *owned,
+                           uint64_t tag);
+
+    // Copy up to the frame budget, outside of any pass and at most once per frame; returns the bytes copied
+    size_t upload_queue_drain(void);
+
+    // Drop pending jobs, freeing their owned memory, and reset the completed tag and progress
+    void upload_queue_clear(void);
+
+    uint64_t upload_queue_completed_tag(void);
+    upload_progress_t upload_queue_progress(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // UPLOAD_QUEUE_H
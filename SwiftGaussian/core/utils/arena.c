@@ -0,0 +1,131 @@
+#include "arena.h"
+
+struct arena_block
+{
+    arena_block_t *next;
+    size_t size;   // usable bytes after the header
+    size_t offset; // bytes handed out from this block
+    uint8_t *data;
+};
+
+static size_t align_up(size_t value)
+{
+    return (value + ARENA_ALIGNMENT - 1) & ~(size_t)(ARENA_ALIGNMENT - 1);
+}
+
+static arena_block_t *new_arena_block(size_t size, memory_tag_t tag)
+{
+    // The header and the data share one allocation; data starts on the next aligned address
+    uint8_t *memory = (uint8_t *)core_malloc(tag, sizeof(arena_block_t) + ARENA_ALIGNMENT + size);
+    if (!memory)
+    {
+        return NULL;
+    }
+    arena_block_t *block = (arena_block_t *)memory;
+    uintptr_t data = ((uintptr_t)(memory + sizeof(arena_block_t)) + ARENA_ALIGNMENT - 1) &
+                     ~(uintptr_t)(ARENA_ALIGNMENT - 1);
+    *block = (arena_block_t){.size = size, .data = (uint8_t *)data};
+    return block;
+}
+
+void arena_init(arena_t *arena, size_t block_size, memory_tag_t tag)
+{
+    *arena = (arena_t){.block_size = block_size ? align_up(block_size) : ARENA_DEFAULT_BLOCK_SIZE, .tag = tag};
+}
+
+void *arena_alloc(arena_t *arena, size_t size)
+{
+    size = align_up(size ? size : 1);
+
+    // The first block with room from the current one on; reserved blocks past the current one are free
+    arena_block_t *previous = NULL;
+    arena_block_t *block = arena->current;
+    if (!block && arena->first)
+    {
+        block = arena->first;
+        block->offset = 0;
+    }
+    while (block && block->size - block->offset < size)
+    {
+        // What is left of a block that is passed over counts as used, a reset gives it back
+        arena->used += block->size - block->offset;
+        previous = block;
+        block = block->next;
+        if (block)
+        {
+            block->offset = 0;
+        }
+    }
+    if (!block)
+    {
+        block = new_arena_block(size > arena->block_size ? size : arena->block_size, arena->tag);
+        if (!block)
+        {
+            return NULL;
+        }
+        arena->reserved += block->size;
+        if (previous)
+        {
+            previous->next = block;
+        }
+        else
+        {
+            arena->first = block;
+        }
+    }
+
+    void *memory = block->data + block->offset;
+    block->offset += size;
+    arena->current = block;
+    arena->used += size;
+    arena->high_water = arena->used > arena->high_water ? arena->used : arena->high_water;
+    return memory;
+}
+
+arena_mark_t arena_mark(const arena_t *arena)
+{
+    return (arena_mark_t){
+        .block = arena->current,
+        .offset = arena->current ? arena->current->offset : 0,
+        .used = arena->used};
+}
+
+void arena_reset(arena_t *arena, arena_mark_t mark)
+{
+    // Without a block the mark was taken before the first allocation, every block is free again
+    arena->current = mark.block;
+    if (mark.block)
+    {
+        mark.block->offset = mark.offset;
+    }
+    arena->used = mark.used;
+}
+
+void arena_trim(arena_t *arena)
+{
+    arena_block_t **link = arena->current ? &arena->current->next : &arena->first;
+    arena_block_t *block = *link;
+    *link = NULL;
+    while (block)
+    {
+        arena_block_t *next = block->next;
+        arena->reserved -= block->size;
+        core_free(block);
+        block = next;
+    }
+}
+
+void arena_free(arena_t *arena)
+{
+    arena_block_t *block = arena->first;
+    while (block)
+    {
+        arena_block_t *next = block->next;
+        core_free(block);
+        block = next;
+    }
+    arena->first = NULL;
+    arena->current = NULL;
+    arena->used = 0;
+    arena->reserved = 0;
+}
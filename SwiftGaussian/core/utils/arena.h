@@ -0,0 +1,73 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "core_memory.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// Every allocation starts on a cache line, so the parallel loops never share one between ranges
+#define ARENA_ALIGNMENT 64
+#define ARENA_DEFAULT_BLOCK_SIZE (4u << 20)
+
+    typedef struct arena_block arena_block_t;
+
+    /**
+     * Linear allocator for the transient buffers of one load. Allocations bump a pointer through a
+     * list of blocks and are never freed one by one: a phase takes a mark, allocates, and resets to the
+     * mark when its buffers are dead, so the next phase recycles the same pages in place. Not thread-safe;
+     * the parallel loops only write into buffers allocated before they start.
+     */
+    typedef struct
+    {
+        arena_block_t *first;
+        arena_block_t *current; // block the next allocation tries first
+        size_t block_size;      // smallest block; larger requests get a block of their own size
+        size_t used;            // bytes from the first block up to the current position, alignment included
+        size_t reserved;        // bytes of all blocks
+        size_t high_water;      // most bytes used at once since arena_init
+        memory_tag_t tag;       // the blocks are counted under it
+    } arena_t;
+
+    // Position to return to with arena_reset
+    typedef struct
+    {
+        arena_block_t *block;
+        size_t offset;
+        size_t used;
+    } arena_mark_t;
+
+    /**
+     * @param block_size Smallest block to allocate, 0 for ARENA_DEFAULT_BLOCK_SIZE
+     * @param tag What the blocks are counted as
+     */
+    void arena_init(arena_t *arena, size_t block_size, memory_tag_t tag);
+
+    /**
+     * Allocate size bytes aligned to ARENA_ALIGNMENT, valid until a reset to an earlier mark or arena_free.
+     * The memory is not cleared.
+     *
+     * @return The allocation, or NULL when no block could be allocated
+     */
+    void *arena_alloc(arena_t *arena, size_t size);
+
+    arena_mark_t arena_mark(const arena_t *arena);
+
+    // Release everything allocated after mark; the blocks stay reserved for the next allocations
+    void arena_reset(arena_t *arena, arena_mark_t mark);
+
+    // Return the blocks past the current position to the system, for when the next phase would not reuse them
+    void arena_trim(arena_t *arena);
+
+    // Return every block to the system; the high-water mark is kept
+    void arena_free(arena_t *arena);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ARENA_H
@@ -0,0 +1,257 @@
+#include "core_memory.h"
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+
+// In front of every block: what to count and hand back on core_free. 16 bytes keep malloc's alignment.
+typedef struct
+{
+    size_t size;
+    memory_tag_t tag;
+    uint32_t padding;
+} memory_header_t;
+
+_Static_assert(sizeof(memory_header_t) == 16, "the header must keep the 16-byte alignment of malloc");
+
+typedef struct
+{
+    _Atomic size_t current;
+    _Atomic size_t peak;
+} memory_counter_t;
+
+static struct
+{
+    core_allocator_t allocator; // alloc NULL: malloc and free
+    memory_counter_t cpu[MEMORY_TAG_COUNT];
+    memory_counter_t gpu[MEMORY_TAG_COUNT];
+    memory_counter_t cpu_total;
+    memory_counter_t gpu_total;
+} g_memory_state;
+
+static void raise_peak(memory_counter_t *counter, size_t current)
+{
+    size_t peak = atomic_load_explicit(&counter->peak, memory_order_relaxed);
+    while (current > peak &&
+           !atomic_compare_exchange_weak_explicit(&counter->peak, &peak, current, memory_order_relaxed,
+                                                  memory_order_relaxed))
+    {
+    }
+}
+
+static void count_bytes(memory_counter_t *counter, int64_t bytes)
+{
+    if (bytes >= 0)
+    {
+        size_t current = atomic_fetch_add_explicit(&counter->current, (size_t)bytes, memory_order_relaxed) +
+                         (size_t)bytes;
+        raise_peak(counter, current);
+    }
+    else
+    {
+        atomic_fetch_sub_explicit(&counter->current, (size_t)-bytes, memory_order_relaxed);
+    }
+}
+
+static void count_cpu(memory_tag_t tag, int64_t bytes)
+{
+    count_bytes(&g_memory_state.cpu[tag], bytes);
+    count_bytes(&g_memory_state.cpu_total, bytes);
+}
+
+void core_set_allocator(const core_allocator_t *allocator)
+{
+    g_memory_state.allocator = allocator ? *allocator : (core_allocator_t){0};
+}
+
+void *core_malloc(memory_tag_t tag, size_t size)
+{
+    size_t total = sizeof(memory_header_t) + size;
+    if (total < size)
+    {
+        return NULL;
+    }
+    memory_header_t *header = g_memory_state.allocator.alloc
+                                  ? (memory_header_t *)g_memory_state.allocator.alloc(
+                                        total, tag, g_memory_state.allocator.user_data)
+                                  : (memory_header_t *)malloc(total);
+    if (!header)
+    {
+        return NULL;
+    }
+    *header = (memory_header_t){.size = size, .tag = tag};
+    count_cpu(tag, (int64_t)size);
+    return header + 1;
+}
+
+void *core_calloc(memory_tag_t tag, size_t count, size_t size)
+{
+    if (size && count > SIZE_MAX / size)
+    {
+        return NULL;
+    }
+    void *memory = core_malloc(tag, count * size);
+    if (memory)
+    {
+        memset(memory, 0, count * size);
+    }
+    return memory;
+}
+
+void *core_realloc(memory_tag_t tag, void *ptr, size_t size)
+{
+    if (!ptr)
+    {
+        return core_malloc(tag, size);
+    }
+    memory_header_t *header = (memory_header_t *)ptr - 1;
+    memory_header_t old = *header;
+    if (g_memory_state.allocator.alloc)
+    {
+        // A replaced allocator has no realloc, the block moves
+        void *moved = core_malloc(tag, size);
+        if (moved)
+        {
+            memcpy(moved, ptr, old.size < size ? old.size : size);
+            core_free(ptr);
+        }
+        return moved;
+    }
+
+    size_t total = sizeof(memory_header_t) + size;
+    memory_header_t *grown = total < size ? NULL : (memory_header_t *)realloc(header, total);
+    if (!grown)
+    {
+        return NULL;
+    }
+    count_cpu(old.tag, -(int64_t)old.size);
+    *grown = (memory_header_t){.size = size, .tag = tag};
+    count_cpu(tag, (int64_t)size);
+    return grown + 1;
+}
+
+void core_free(void *ptr)
+{
+    if (!ptr)
+    {
+        return;
+    }
+    memory_header_t *header = (memory_header_t *)ptr - 1;
+    count_cpu(header->tag, -(int64_t)header->size);
+    if (g_memory_state.allocator.free)
+    {
+        g_memory_state.allocator.free(header, sizeof(memory_header_t) + header->size, header->tag,
+                                      g_memory_state.allocator.user_data);
+    }
+    else
+    {
+        free(header);
+    }
+}
+
+void core_memory_track_gpu(memory_tag_t tag, int64_t bytes)
+{
+    count_bytes(&g_memory_state.gpu[tag], bytes);
+    count_bytes(&g_memory_state.gpu_total, bytes);
+}
+
+// Backends that rename dynamic resources per frame in flight hold num_slots copies
+static int64_t buffer_bytes(sg_buffer buffer)
+{
+    return (int64_t)sg_query_buffer_size(buffer) * sg_query_buffer_info(buffer).num_slots;
+}
+
+static int64_t image_bytes(sg_image image)
+{
+    sg_image_desc desc = sg_query_image_desc(image);
+    int layers = desc.type == SG_IMAGETYPE_CUBE ? 6 : desc.num_slices;
+    int64_t bytes = 0;
+    for (int mip = 0; mip < desc.num_mipmaps; mip++)
+    {
+        int width = desc.width >> mip > 0 ? desc.width >> mip : 1;
+        int height = desc.height >> mip > 0 ? desc.height >> mip : 1;
+        bytes += (int64_t)sg_query_surface_pitch(desc.pixel_format, width, height, 1) * layers;
+    }
+    return bytes * desc.sample_count * sg_query_image_info(image).num_slots;
+}
+
+sg_buffer core_make_buffer(memory_tag_t tag, const sg_buffer_desc *desc)
+{
+    sg_buffer buffer = sg_make_buffer(desc);
+    if (sg_query_buffer_state(buffer) == SG_RESOURCESTATE_VALID)
+    {
+        core_memory_track_gpu(tag, buffer_bytes(buffer));
+    }
+    return buffer;
+}
+
+sg_image core_make_image(memory_tag_t tag, const sg_image_desc *desc)
+{
+    sg_image image = sg_make_image(desc);
+    if (sg_query_image_state(image) == SG_RESOURCESTATE_VALID)
+    {
+        core_memory_track_gpu(tag, image_bytes(image));
+    }
+    return image;
+}
+
+void core_destroy_buffer(memory_tag_t tag, sg_buffer buffer)
+{
+    if (sg_query_buffer_state(buffer) == SG_RESOURCESTATE_VALID)
+    {
+        core_memory_track_gpu(tag, -buffer_bytes(buffer));
+    }
+    sg_destroy_buffer(buffer);
+}
+
+void core_destroy_image(memory_tag_t tag, sg_image image)
+{
+    if (sg_query_image_state(image) == SG_RESOURCESTATE_VALID)
+    {
+        core_memory_track_gpu(tag, -image_bytes(image));
+    }
+    sg_destroy_image(image);
+}
+
+static memory_usage_t read_counter(memory_counter_t *counter)
+{
+    return (memory_usage_t){
+        .current = atomic_load_explicit(&counter->current, memory_order_relaxed),
+        .peak = atomic_load_explicit(&counter->peak, memory_order_relaxed)};
+}
+
+core_memory_stats_t core_memory_stats(void)
+{
+    core_memory_stats_t stats = {
+        .cpu_total = read_counter(&g_memory_state.cpu_total),
+        .gpu_total = read_counter(&g_memory_state.gpu_total)};
+    for (int tag = 0; tag < MEMORY_TAG_COUNT; tag++)
+    {
+        stats.cpu[tag] = read_counter(&g_memory_state.cpu[tag]);
+        stats.gpu[tag] = read_counter(&g_memory_state.gpu[tag]);
+    }
+    return stats;
+}
+
+static void reset_peak(memory_counter_t *counter)
+{
+    atomic_store_explicit(&counter->peak, atomic_load_explicit(&counter->current, memory_order_relaxed),
+                          memory_order_relaxed);
+}
+
+void core_memory_reset_peaks(void)
+{
+    reset_peak(&g_memory_state.cpu_total);
+    reset_peak(&g_memory_state.gpu_total);
+    for (int tag = 0; tag < MEMORY_TAG_COUNT; tag++)
+    {
+        reset_peak(&g_memory_state.cpu[tag]);
+        reset_peak(&g_memory_state.gpu[tag]);
+    }
+}
+
+const char *memory_tag_name(memory_tag_t tag)
+{
+    static const char *names[MEMORY_TAG_COUNT] = {"splats", "load", "upload", "splat texture",
+                                                  "sort", "lod", "render", "other"};
+    return tag < MEMORY_TAG_COUNT ? names[tag] : "unknown";
+}
@@ -0,0 +1,95 @@
+#ifndef CORE_MEMORY_H
+#define CORE_MEMORY_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "sokol/sokol_gfx.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    // What an allocation is for; CPU allocations and GPU resources are counted per tag
+    typedef enum
+    {
+        MEMORY_TAG_SPLATS,        // packed splats, their chunk bounds and resident positions
+        MEMORY_TAG_LOAD,          // streams, plane copies, decode plans and buffers, inflate state, the load arena
+                                  // (sort scratch, upload staging)
+        MEMORY_TAG_UPLOAD,        // texels converted from the splats (for the GPU or the CPU renderer), the upload
+                                  // queue and its staging buffer
+        MEMORY_TAG_SPLAT_TEXTURE, // GPU splat storage: texels, covariance, positions, chunk bounds
+        MEMORY_TAG_SORT,          // depth, index, active and budget buffers and their CPU indices
+        MEMORY_TAG_LOD,           // LOD tree and cut
+        MEMORY_TAG_RENDER,        // CPU renderer buffers, offscreen targets, quad geometry
+        MEMORY_TAG_OTHER,
+        MEMORY_TAG_COUNT
+    } memory_tag_t;
+
+    typedef struct
+    {
+        size_t current;
+        size_t peak;
+    } memory_usage_t;
+
+    typedef struct
+    {
+        memory_usage_t cpu[MEMORY_TAG_COUNT];
+        memory_usage_t gpu[MEMORY_TAG_COUNT];
+        memory_usage_t cpu_total; // peak of the sum, below the sum of the per-tag peaks
+        memory_usage_t gpu_total;
+    } core_memory_stats_t;
+
+    /**
+     * Where core_malloc and friends get their memory from. size and tag are those of the allocation;
+     * free receives the same size and tag the block was allocated with.
+     */
+    typedef struct
+    {
+        void *(*alloc)(size_t size, memory_tag_t tag, void *user_data);
+        void (*free)(void *ptr, size_t size, memory_tag_t tag, void *user_data);
+        void *user_data;
+    } core_allocator_t;
+
+    // Replace malloc and free, NULL restores them. Only before the first core allocation, blocks are
+    // always returned to the allocator that made them.
+    void core_set_allocator(const core_allocator_t *allocator);
+
+    /**
+     * Allocate and count size bytes under tag. Blocks carry a small header, so they must be released
+     * with core_free (or core_realloc), never free().
+     *
+     * @return The block, aligned like malloc, or NULL when out of memory
+     */
+    void *core_malloc(memory_tag_t tag, size_t size);
+    void *core_calloc(memory_tag_t tag, size_t count, size_t size);
+
+    // realloc for core blocks; the result is counted under tag. ptr is left alone when NULL is returned.
+    void *core_realloc(memory_tag_t tag, void *ptr, size_t size);
+
+    // Release a block of core_malloc, core_calloc or core_realloc; NULL is ignored
+    void core_free(void *ptr);
+
+    // Count GPU memory the core created (bytes > 0) or destroyed (bytes < 0) under tag
+    void core_memory_track_gpu(memory_tag_t tag, int64_t bytes);
+
+    // sg_make_buffer and sg_make_image counting the resource under tag, and their destroy counterparts;
+    // the size is taken from the resource itself, so a failed creation counts nothing
+    sg_buffer core_make_buffer(memory_tag_t tag, const sg_buffer_desc *desc);
+    sg_image core_make_image(memory_tag_t tag, const sg_image_desc *desc);
+    void core_destroy_buffer(memory_tag_t tag, sg_buffer buffer);
+    void core_destroy_image(memory_tag_t tag, sg_image image);
+
+    // Current and peak bytes per tag, CPU and GPU; safe on any thread
+    core_memory_stats_t core_memory_stats(void);
+
+    // Start the peaks over from the current bytes, e.g. before loading the next scene
+    void core_memory_reset_peaks(void);
+
+    const char *memory_tag_name(memory_tag_t tag);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CORE_MEMORY_H
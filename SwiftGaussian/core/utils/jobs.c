@@ -0,0 +1,426 @@
+#include "jobs.h"
+#include "logger.h"
+#include "trace.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#ifdef __APPLE__
+#include <sys/sysctl.h>
+#endif
+
+// Jobs one deque holds; a push to a full deque runs the job on the pushing thread instead
+#define JOB_DEQUE_CAPACITY 256
+
+typedef struct
+{
+    job_task_fn fn;
+    void *context;
+} job_t;
+
+// Owner pushes and pops at the tail, thieves take the oldest job at the head
+typedef struct
+{
+    pthread_mutex_t lock;
+    job_t jobs[JOB_DEQUE_CAPACITY];
+    uint32_t head;
+    uint32_t tail; // jobs [head, tail), indices modulo JOB_DEQUE_CAPACITY; stored atomically for the unlocked peek
+} job_deque_t;
+
+// One job_parallel_for call, on the caller's stack until every helper is done with it
+typedef struct
+{
+    job_range_fn fn;
+    void *context;
+    uint32_t count;
+    uint32_t grain;
+    uint32_t range_count;
+    uint32_t next_range;
+    uint32_t next_slot; // slot 0 is the caller's
+    uint32_t helpers;   // helper jobs pushed and not finished
+} job_loop_t;
+
+static struct
+{
+    pthread_mutex_t init_lock;
+    bool started;
+    uint32_t worker_count;
+    pthread_t threads[JOB_MAX_THREADS];
+    job_deque_t deques[JOB_MAX_THREADS];
+
+    // Workers sleep while no deque holds a job
+    pthread_mutex_t sleep_lock;
+    pthread_cond_t wake;
+    uint32_t pending; // jobs in all deques
+    bool stopping;
+
+    uint32_t next_deque; // round robin for pushes from threads outside the pool
+} g_jobs_state = {.init_lock = PTHREAD_MUTEX_INITIALIZER,
+                  .sleep_lock = PTHREAD_MUTEX_INITIALIZER,
+                  .wake = PTHREAD_COND_INITIALIZER};
+
+// Deque of the current thread, -1 outside the pool
+static _Thread_local int t_worker_index = -1;
+
+static uint32_t performance_core_count(void)
+{
+    int cores = 0;
+#ifdef __APPLE__
+    // Efficiency cores would hold back the static-length ranges of the others
+    size_t size = sizeof(cores);
+    if (sysctlbyname("hw.perflevel0.physicalcpu", &cores, &size, NULL, 0) != 0 || cores <= 0)
+    {
+        size = sizeof(cores);
+        if (sysctlbyname("hw.physicalcpu", &cores, &size, NULL, 0) != 0)
+        {
+            cores = 1;
+        }
+    }
+#else
+    cores = (int)sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+    return cores > 0 ? (uint32_t)cores : 1u;
+}
+
+static bool push_to_deque(job_deque_t *deque, job_t job)
+{
+    pthread_mutex_lock(&deque->lock);
+    bool pushed = deque->tail - deque->head < JOB_DEQUE_CAPACITY;
+    if (pushed)
+    {
+        deque->jobs[deque->tail % JOB_DEQUE_CAPACITY] = job;
+        __atomic_store_n(&deque->tail, deque->tail + 1, __ATOMIC_RELAXED);
+    }
+    pthread_mutex_unlock(&deque->lock);
+    return pushed;
+}
+
+static bool take_from_deque(job_deque_t *deque, bool own, job_t *out)
+{
+    // Unlocked peek first, so idle threads scanning for work do not contend on empty deques
+    if (__atomic_load_n(&deque->tail, __ATOMIC_RELAXED) == __atomic_load_n(&deque->head, __ATOMIC_RELAXED))
+    {
+        return false;
+    }
+    pthread_mutex_lock(&deque->lock);
+    bool taken = deque->tail != deque->head;
+    if (taken && own)
+    {
+        *out = deque->jobs[(deque->tail - 1) % JOB_DEQUE_CAPACITY];
+        __atomic_store_n(&deque->tail, deque->tail - 1, __ATOMIC_RELAXED);
+    }
+    else if (taken)
+    {
+        *out = deque->jobs[deque->head % JOB_DEQUE_CAPACITY];
+        __atomic_store_n(&deque->head, deque->head + 1, __ATOMIC_RELAXED);
+    }
+    pthread_mutex_unlock(&deque->lock);
+    if (taken)
+    {
+        __atomic_fetch_sub(&g_jobs_state.pending, 1, __ATOMIC_RELAXED);
+    }
+    return taken;
+}
+
+// Own deque newest first, then the oldest job of another
+static bool take_job(job_t *out)
+{
+    uint32_t count = __atomic_load_n(&g_jobs_state.worker_count, __ATOMIC_ACQUIRE);
+    int own = t_worker_index;
+    if (own >= 0 && take_from_deque(&g_jobs_state.deques[own], true, out))
+    {
+        return true;
+    }
+    uint32_t start = own >= 0 ? (uint32_t)own + 1 : 0;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        uint32_t victim = (start + i) % count;
+        if ((int)victim != own && take_from_deque(&g_jobs_state.deques[victim], false, out))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void push_job(job_task_fn fn, void *context)
+{
+    job_t job = {fn, context};
+    int own = t_worker_index;
+    uint32_t target = own >= 0 ? (uint32_t)own
+                               : __atomic_fetch_add(&g_jobs_state.next_deque, 1, __ATOMIC_RELAXED) %
+                                     g_jobs_state.worker_count;
+    if (!push_to_deque(&g_jobs_state.deques[target], job))
+    {
+        fn(context);
+        return;
+    }
+
+    __atomic_fetch_add(&g_jobs_state.pending, 1, __ATOMIC_RELAXED);
+    pthread_mutex_lock(&g_jobs_state.sleep_lock);
+    pthread_cond_signal(&g_jobs_state.wake);
+    pthread_mutex_unlock(&g_jobs_state.sleep_lock);
+}
+
+// Run other jobs (or yield) until counter drops to 0
+static void help_until_zero(const uint32_t *counter)
+{
+    while (__atomic_load_n(counter, __ATOMIC_ACQUIRE) != 0)
+    {
+        job_t job;
+        if (take_job(&job))
+        {
+            job.fn(job.context);
+        }
+        else
+        {
+            sched_yield();
+        }
+    }
+}
+
+static void *job_worker(void *arg)
+{
+    t_worker_index = (int)(intptr_t)arg;
+    TRACE_THREAD_NAME("job worker");
+    for (;;)
+    {
+        job_t job;
+        if (take_job(&job))
+        {
+            job.fn(job.context);
+            continue;
+        }
+
+        pthread_mutex_lock(&g_jobs_state.sleep_lock);
+        while (__atomic_load_n(&g_jobs_state.pending, __ATOMIC_RELAXED) == 0 && !g_jobs_state.stopping)
+        {
+            pthread_cond_wait(&g_jobs_state.wake, &g_jobs_state.sleep_lock);
+        }
+        bool stopping = g_jobs_state.stopping;
+        pthread_mutex_unlock(&g_jobs_state.sleep_lock);
+        if (stopping)
+        {
+            return NULL;
+        }
+    }
+}
+
+bool job_system_init(uint32_t worker_count)
+{
+    pthread_mutex_lock(&g_jobs_state.init_lock);
+    if (g_jobs_state.started)
+    {
+        pthread_mutex_unlock(&g_jobs_state.init_lock);
+        return true;
+    }
+
+    if (worker_count == JOB_DEFAULT_WORKERS)
+    {
+        worker_count = performance_core_count() - 1;
+    }
+    worker_count = worker_count < JOB_MAX_THREADS - 1 ? worker_count : JOB_MAX_THREADS - 1;
+
+    g_jobs_state.stopping = false;
+    g_jobs_state.pending = 0;
+    uint32_t started = 0;
+    for (; started < worker_count; started++)
+    {
+        job_deque_t *deque = &g_jobs_state.deques[started];
+        pthread_mutex_init(&deque->lock, NULL);
+        deque->head = deque->tail = 0;
+        // Published before the thread can steal: worker_count bounds every scan
+        __atomic_store_n(&g_jobs_state.worker_count, started + 1, __ATOMIC_RELEASE);
+        if (pthread_create(&g_jobs_state.threads[started], NULL, job_worker, (void *)(intptr_t)started) != 0)
+        {
+            print("ERROR: Failed to start job worker %u, running with %u\n", started, started);
+            pthread_mutex_destroy(&deque->lock);
+            break;
+        }
+    }
+    __atomic_store_n(&g_jobs_state.worker_count, started, __ATOMIC_RELEASE);
+    __atomic_store_n(&g_jobs_state.started, true, __ATOMIC_RELEASE);
+    print("Job system: %u workers + the calling thread\n", started);
+    pthread_mutex_unlock(&g_jobs_state.init_lock);
+    return started == worker_count;
+}
+
+void job_system_shutdown(void)
+{
+    pthread_mutex_lock(&g_jobs_state.init_lock);
+    if (!g_jobs_state.started)
+    {
+        pthread_mutex_unlock(&g_jobs_state.init_lock);
+        return;
+    }
+
+    pthread_mutex_lock(&g_jobs_state.sleep_lock);
+    g_jobs_state.stopping = true;
+    pthread_cond_broadcast(&g_jobs_state.wake);
+    pthread_mutex_unlock(&g_jobs_state.sleep_lock);
+    for (uint32_t i = 0; i < g_jobs_state.worker_count; i++)
+    {
+        pthread_join(g_jobs_state.threads[i], NULL);
+        pthread_mutex_destroy(&g_jobs_state.deques[i].lock);
+    }
+    g_jobs_state.worker_count = 0;
+    g_jobs_state.started = false;
+    pthread_mutex_unlock(&g_jobs_state.init_lock);
+}
+
+static void ensure_started(void)
+{
+    if (!__atomic_load_n(&g_jobs_state.started, __ATOMIC_ACQUIRE))
+    {
+        job_system_init(JOB_DEFAULT_WORKERS);
+    }
+}
+
+uint32_t job_thread_count(void)
+{
+    ensure_started();
+    return g_jobs_state.worker_count + 1;
+}
+
+static void run_loop_ranges(job_loop_t *loop, uint32_t slot)
+{
+    for (;;)
+    {
+        uint32_t range = __atomic_fetch_add(&loop->next_range, 1, __ATOMIC_RELAXED);
+        if (range >= loop->range_count)
+        {
+            return;
+        }
+        uint32_t begin = range * loop->grain;
+        uint32_t end = loop->count - begin > loop->grain ? begin + loop->grain : loop->count;
+        loop->fn(begin, end, slot, loop->context);
+    }
+}
+
+static void run_loop_helper(void *context)
+{
+    job_loop_t *loop = (job_loop_t *)context;
+    // Helpers that start after the last range was taken leave without a slot
+    if (__atomic_load_n(&loop->next_range, __ATOMIC_RELAXED) < loop->range_count)
+    {
+        run_loop_ranges(loop, __atomic_fetch_add(&loop->next_slot, 1, __ATOMIC_RELAXED));
+    }
+    __atomic_fetch_sub(&loop->helpers, 1, __ATOMIC_RELEASE);
+}
+
+void job_parallel_for(uint32_t count, uint32_t grain, job_range_fn fn, void *context)
+{
+    if (count == 0)
+    {
+        return;
+    }
+    grain = grain > 0 ? grain : 1;
+    uint32_t range_count = count / grain + (count % grain != 0);
+    uint32_t threads = job_thread_count();
+    uint32_t helpers = range_count - 1 < threads - 1 ? range_count - 1 : threads - 1;
+    if (helpers == 0)
+    {
+        for (uint32_t begin = 0; begin < count; begin += grain)
+        {
+            fn(begin, count - begin > grain ? begin + grain : count, 0, context);
+        }
+        return;
+    }
+
+    job_loop_t loop = {
+        .fn = fn,
+        .context = context,
+        .count = count,
+        .grain = grain,
+        .range_count = range_count,
+        .next_slot = 1,
+        .helpers = helpers};
+    for (uint32_t i = 0; i < helpers; i++)
+    {
+        push_job(run_loop_helper, &loop);
+    }
+    run_loop_ranges(&loop, 0);
+    help_until_zero(&loop.helpers);
+}
+
+void job_graph_init(job_graph_t *graph)
+{
+    graph->task_count = 0;
+    graph->remaining = 0;
+}
+
+uint32_t job_graph_add(job_graph_t *graph, job_task_fn fn, void *context, const uint32_t *after,
+                       uint32_t after_count)
+{
+    if (graph->task_count == JOB_GRAPH_MAX_TASKS)
+    {
+        return JOB_GRAPH_FULL;
+    }
+    uint32_t index = graph->task_count;
+    job_graph_task_t *task = &graph->tasks[index];
+    *task = (job_graph_task_t){.fn = fn, .context = context, .graph = graph};
+    for (uint32_t i = 0; i < after_count; i++)
+    {
+        // Only earlier tasks, which keeps the graph acyclic
+        if (after[i] < index)
+        {
+            task->after |= 1ull << after[i];
+        }
+    }
+    graph->task_count++;
+    return index;
+}
+
+static void run_graph_task(void *context)
+{
+    job_graph_task_t *task = (job_graph_task_t *)context;
+    job_graph_t *graph = task->graph;
+    task->fn(task->context);
+
+    uint64_t bit = 1ull << (uint32_t)(task - graph->tasks);
+    for (uint32_t i = 0; i < graph->task_count; i++)
+    {
+        job_graph_task_t *next = &graph->tasks[i];
+        if ((next->after & bit) && __atomic_sub_fetch(&next->waiting, 1, __ATOMIC_ACQ_REL) == 0)
+        {
+            push_job(run_graph_task, next);
+        }
+    }
+    __atomic_fetch_sub(&graph->remaining, 1, __ATOMIC_RELEASE);
+}
+
+void job_graph_run(job_graph_t *graph)
+{
+    if (graph->task_count == 0)
+    {
+        return;
+    }
+    ensure_started();
+    graph->remaining = graph->task_count;
+    for (uint32_t i = 0; i < graph->task_count; i++)
+    {
+        graph->tasks[i].waiting = (uint32_t)__builtin_popcountll(graph->tasks[i].after);
+    }
+
+    if (g_jobs_state.worker_count == 0)
+    {
+        // In order, which respects every dependency since they all point backwards
+        for (uint32_t i = 0; i < graph->task_count; i++)
+        {
+            graph->tasks[i].fn(graph->tasks[i].context);
+        }
+        graph->remaining = 0;
+        return;
+    }
+
+    // Roots by their dependencies: waiting already changes as the first ones finish
+    for (uint32_t i = 0; i < graph->task_count; i++)
+    {
+        if (graph->tasks[i].after == 0)
+        {
+            push_job(run_graph_task, &graph->tasks[i]);
+        }
+    }
+    help_until_zero(&graph->remaining);
+}
@@ -0,0 +1,86 @@
+#ifndef JOBS_H
+#define JOBS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// Workers plus the thread that starts the work
+#define JOB_MAX_THREADS 32
+#define JOB_GRAPH_MAX_TASKS 64
+#define JOB_GRAPH_FULL UINT32_MAX
+
+// job_system_init worker count: one per performance core, minus the calling thread
+#define JOB_DEFAULT_WORKERS UINT32_MAX
+
+    // One range [begin, end) of a parallel loop. slot is unique among the ranges running at the same time,
+    // below job_thread_count(), so per-slot partial results (sums, bounds, lists) need no locking.
+    typedef void (*job_range_fn)(uint32_t begin, uint32_t end, uint32_t slot, void *context);
+    typedef void (*job_task_fn)(void *context);
+
+    typedef struct job_graph job_graph_t;
+
+    typedef struct
+    {
+        job_task_fn fn;
+        void *context;
+        uint64_t after;   // bit i: runs once task i is done
+        uint32_t waiting; // unfinished tasks of after, updated atomically while the graph runs
+        job_graph_t *graph;
+    } job_graph_task_t;
+
+    // Tasks and their dependencies, run by job_graph_run; lives on the caller's stack
+    struct job_graph
+    {
+        job_graph_task_t tasks[JOB_GRAPH_MAX_TASKS];
+        uint32_t task_count;
+        uint32_t remaining; // updated atomically while the graph runs
+    };
+
+    /**
+     * Start the worker threads, each with its own deque; idle workers steal from the others.
+     * Parallel work starts them on first use with the default count, so calling this is only needed
+     * to choose the count; call it before any parallel work or after job_system_shutdown.
+     *
+     * @param worker_count Threads besides the caller, JOB_DEFAULT_WORKERS to match the performance cores;
+     *                     0 runs everything on the calling thread
+     * @return true when every worker asked for is running
+     */
+    bool job_system_init(uint32_t worker_count);
+    void job_system_shutdown(void);
+
+    // Threads a parallel loop runs on at most, the callers included; sizes per-slot arrays
+    uint32_t job_thread_count(void);
+
+    /**
+     * Run fn over [0, count) in ranges of grain items, on the workers and the calling thread, and
+     * return once every range is done. Ranges go to whichever thread asks next, so uneven work balances;
+     * range r is always [r * grain, min((r + 1) * grain, count)). Runs inline in slot 0 when there is one
+     * range or no worker. May be called from any thread, including from inside another job.
+     */
+    void job_parallel_for(uint32_t count, uint32_t grain, job_range_fn fn, void *context);
+
+    void job_graph_init(job_graph_t *graph);
+
+    /**
+     * Add a task that runs once the given earlier tasks are done
+     *
+     * @param after Indices returned by earlier job_graph_add calls, may be NULL
+     * @param after_count Number of indices in after
+     * @return Index of the task, or JOB_GRAPH_FULL past JOB_GRAPH_MAX_TASKS tasks
+     */
+    uint32_t job_graph_add(job_graph_t *graph, job_task_fn fn, void *context, const uint32_t *after,
+                           uint32_t after_count);
+
+    // Run every task in dependency order, independent ones in parallel; returns when all are done
+    void job_graph_run(job_graph_t *graph);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // JOBS_H
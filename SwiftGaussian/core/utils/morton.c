@@ -0,0 +1,118 @@
+#include "morton.h"
+#include "core_memory.h"
+#include "jobs.h"
+#include <stdlib.h>
+#include <string.h>
+
+// Keys per block; each block counts its own digits, then scatters them from its own offsets
+#define MORTON_SORT_BLOCK 16384
+
+typedef struct
+{
+    const uint64_t *keys;
+    const uint32_t *indices;
+    uint64_t *out_keys;
+    uint32_t *out_indices;
+    uint32_t count;
+    int shift;
+    uint32_t (*offsets)[256]; // per block: digit counts, then where each digit goes
+} morton_pass_t;
+
+static void count_morton_digits(uint32_t block_begin, uint32_t block_end, uint32_t slot, void *context)
+{
+    (void)slot;
+    morton_pass_t *pass = (morton_pass_t *)context;
+    for (uint32_t block = block_begin; block < block_end; block++)
+    {
+        uint32_t *counts = pass->offsets[block];
+        memset(counts, 0, 256 * sizeof(uint32_t));
+        uint32_t end = (block + 1) * MORTON_SORT_BLOCK < pass->count ? (block + 1) * MORTON_SORT_BLOCK : pass->count;
+        for (uint32_t i = block * MORTON_SORT_BLOCK; i < end; i++)
+        {
+            counts[(pass->keys[i] >> pass->shift) & 0xFF]++;
+        }
+    }
+}
+
+static void scatter_morton_keys(uint32_t block_begin, uint32_t block_end, uint32_t slot, void *context)
+{
+    (void)slot;
+    morton_pass_t *pass = (morton_pass_t *)context;
+    for (uint32_t block = block_begin; block < block_end; block++)
+    {
+        uint32_t *offsets = pass->offsets[block];
+        uint32_t end = (block + 1) * MORTON_SORT_BLOCK < pass->count ? (block + 1) * MORTON_SORT_BLOCK : pass->count;
+        for (uint32_t i = block * MORTON_SORT_BLOCK; i < end; i++)
+        {
+            uint32_t dst = offsets[(pass->keys[i] >> pass->shift) & 0xFF]++;
+            pass->out_keys[dst] = pass->keys[i];
+            pass->out_indices[dst] = pass->indices[i];
+        }
+    }
+}
+
+size_t morton_sort_scratch_size(uint32_t count)
+{
+    size_t block_count = (count + MORTON_SORT_BLOCK - 1) / MORTON_SORT_BLOCK;
+    return (size_t)count * (sizeof(uint64_t) + sizeof(uint32_t)) + block_count * 256 * sizeof(uint32_t);
+}
+
+int morton_sort(uint64_t *keys, uint32_t *indices, uint32_t count)
+{
+    void *scratch = core_malloc(MEMORY_TAG_LOAD, morton_sort_scratch_size(count) + 1);
+    if (!scratch)
+    {
+        return -1;
+    }
+    morton_sort_with_scratch(keys, indices, count, scratch);
+    core_free(scratch);
+    return 0;
+}
+
+void morton_sort_with_scratch(uint64_t *keys, uint32_t *indices, uint32_t count, void *scratch)
+{
+    // Keys first, so each array stays aligned
+    uint32_t block_count = (count + MORTON_SORT_BLOCK - 1) / MORTON_SORT_BLOCK;
+    uint64_t *tmp_keys = (uint64_t *)scratch;
+    uint32_t (*offsets)[256] = (uint32_t (*)[256])(tmp_keys + count);
+    uint32_t *tmp_indices = offsets[block_count];
+
+    morton_pass_t pass = {
+        .keys = keys,
+        .indices = indices,
+        .out_keys = tmp_keys,
+        .out_indices = tmp_indices,
+        .count = count,
+        .offsets = offsets};
+    for (pass.shift = 0; pass.shift < 3 * MORTON_BITS; pass.shift += 8)
+    {
+        job_parallel_for(block_count, 1, count_morton_digits, &pass);
+
+        // Digit-major, block-minor prefix sum keeps the sort stable
+        uint32_t sum = 0;
+        for (int b = 0; b < 256; b++)
+        {
+            for (uint32_t block = 0; block < block_count; block++)
+            {
+                uint32_t c = offsets[block][b];
+                offsets[block][b] = sum;
+                sum += c;
+            }
+        }
+        job_parallel_for(block_count, 1, scatter_morton_keys, &pass);
+
+        // The output of this pass is the input of the next
+        const uint64_t *sorted_keys = pass.out_keys;
+        const uint32_t *sorted_indices = pass.out_indices;
+        pass.out_keys = (uint64_t *)pass.keys;
+        pass.out_indices = (uint32_t *)pass.indices;
+        pass.keys = sorted_keys;
+        pass.indices = sorted_indices;
+    }
+
+    if (pass.keys != keys)
+    {
+        memcpy(keys, pass.keys, (size_t)count * sizeof(uint64_t));
+        memcpy(indices, pass.indices, (size_t)count * sizeof(uint32_t));
+    }
+}
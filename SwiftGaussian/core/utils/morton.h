@@ -0,0 +1,52 @@
+#ifndef MORTON_H
+#define MORTON_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// Morton codes interleave 16 bits per axis into 48-bit keys
+#define MORTON_BITS 16
+
+    // Spread the low 16 bits of v so there are two zero bits between each
+    static inline uint64_t morton_part1by2(uint64_t v)
+    {
+        v &= 0xFFFFull;
+        v = (v | (v << 16)) & 0x0000FF0000FFull;
+        v = (v | (v << 8)) & 0x00F00F00F00Full;
+        v = (v | (v << 4)) & 0x0C30C30C30C3ull;
+        v = (v | (v << 2)) & 0x249249249249ull;
+        return v;
+    }
+
+    // x in the highest bit of each triple, z in the lowest
+    static inline uint64_t morton_encode3(uint32_t x, uint32_t y, uint32_t z)
+    {
+        return (morton_part1by2(x) << 2) | (morton_part1by2(y) << 1) | morton_part1by2(z);
+    }
+
+    /**
+     * LSD radix sort of 48-bit Morton keys, indices follow their keys
+     *
+     * @param keys Keys to sort in place
+     * @param indices Payload permuted with the keys
+     * @param count Number of keys
+     * @return 0 on success, -1 if the scratch buffers could not be allocated
+     */
+    int morton_sort(uint64_t *keys, uint32_t *indices, uint32_t count);
+
+    // Bytes of scratch morton_sort_with_scratch needs for count keys
+    size_t morton_sort_scratch_size(uint32_t count);
+
+    // morton_sort in caller-provided scratch of morton_sort_scratch_size(count) bytes, aligned for uint64_t
+    void morton_sort_with_scratch(uint64_t *keys, uint32_t *indices, uint32_t count, void *scratch);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MORTON_H
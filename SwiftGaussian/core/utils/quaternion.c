@@ -54,3 +54,80 @@ void quat_to_axis_angle(HMM_Quat q, HMM_Vec3 *out_axis, float *out_angle)
         *out_axis = HMM_V3(q.X / s, q.Y / s, q.Z / s);
     }
 }
+
+HMM_Vec3 octahedral_decode(HMM_Vec2 f)
+{
+    // Map from [0, 1] back to [-1, 1]
+    f.X = f.X * 2.0f - 1.0f;
+    f.Y = f.Y * 2.0f - 1.0f;
+
+    HMM_Vec3 n = HMM_V3(f.X, f.Y, 1.0f - fabsf(f.X) - fabsf(f.Y));
+
+    // Unfold the lower hemisphere
+    float t = fmaxf(-n.Z, 0.0f);
+    n.X += n.X >= 0.0f ? -t : t;
+    n.Y += n.Y >= 0.0f ? -t : t;
+
+    return HMM_NormV3(n);
+}
+
+HMM_Quat axis_angle_to_quat(HMM_Vec3 axis, float angle)
+{
+    float half_angle = angle * 0.5f;
+    float s = sinf(half_angle);
+    return HMM_Q(axis.X * s, axis.Y * s, axis.Z * s, cosf(half_angle));
+}
+
+uint32_t quat_encode_smallest_three(HMM_Quat rotation)
+{
+    float q[4] = {rotation.X, rotation.Y, rotation.Z, rotation.W};
+    float length = sqrtf(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+    float inv_length = length > 0.0f ? 1.0f / length : 0.0f;
+
+    uint32_t largest = 0;
+    for (uint32_t j = 1; j < 4; j++)
+    {
+        if (fabsf(q[j]) > fabsf(q[largest]))
+        {
+            largest = j;
+        }
+    }
+
+    // The largest component is rebuilt as positive, so flip q (same rotation) when it is not
+    float sign = q[largest] < 0.0f ? -inv_length : inv_length;
+    uint32_t packed = largest;
+    int shift = 2;
+    for (uint32_t j = 0; j < 4; j++)
+    {
+        if (j != largest)
+        {
+            int32_t value = (int32_t)lrintf(q[j] * sign * 512.0f) + 512;
+            value = value < 0 ? 0 : (value > 1023 ? 1023 : value);
+            packed |= (uint32_t)value << shift;
+            shift += 10;
+        }
+    }
+    return packed;
+}
+
+HMM_Quat quat_decode_smallest_three(uint32_t packed)
+{
+    const float inv_512 = 1.0f / 512.0f;
+    uint32_t largest = packed & 0x3u;
+    uint32_t components = packed >> 2;
+
+    float q[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+    float sum_sq = 0.0f;
+    int shift = 0;
+    for (uint32_t j = 0; j < 4; j++)
+    {
+        if (j != largest)
+        {
+            q[j] = (float)((int32_t)((components >> shift) & 0x3FFu) - 512) * inv_512;
+            sum_sq += q[j] * q[j];
+            shift += 10;
+        }
+    }
+    q[largest] = sqrtf(fmaxf(0.0f, 1.0f - sum_sq));
+    return HMM_Q(q[0], q[1], q[2], q[3]);
+}
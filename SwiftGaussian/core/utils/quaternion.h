@@ -1,6 +1,7 @@
 #ifndef QUATERNION_H
 #define QUATERNION_H
 
+#include <stdint.h>
 #include "handmademath.h"
 
 #ifdef __cplusplus
@@ -26,6 +27,41 @@ extern "C"
      */
     void quat_to_axis_angle(HMM_Quat q, HMM_Vec3 *out_axis, float *out_angle);
 
+    /**
+     * Inverse of octahedral_encode, matches octahedral_decode in splat.glsl
+     *
+     * @param f 2D coordinates in range [0, 1]
+     * @return Normalized 3D vector
+     */
+    HMM_Vec3 octahedral_decode(HMM_Vec2 f);
+
+    /**
+     * Convert axis-angle representation back to a quaternion
+     *
+     * @param axis Normalized rotation axis
+     * @param angle Angle in radians
+     * @return Unit quaternion
+     */
+    HMM_Quat axis_angle_to_quat(HMM_Vec3 axis, float angle);
+
+    /**
+     * Smallest-three quaternion encoding as stored by SPZ version 3: index of the largest
+     * component in the low 2 bits, the other three as 10-bit offset binary scaled by 512
+     *
+     * @param q Input quaternion (will be normalized)
+     * @return Packed 32-bit rotation
+     */
+    uint32_t quat_encode_smallest_three(HMM_Quat q);
+
+    /**
+     * Inverse of quat_encode_smallest_three, the largest component is rebuilt as positive with one sqrt.
+     * Matches decode_smallest_three in splat.glsl
+     *
+     * @param packed Packed 32-bit rotation
+     * @return Unit quaternion (up to quantization)
+     */
+    HMM_Quat quat_decode_smallest_three(uint32_t packed);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,23 @@
+#ifndef TIMER_H
+#define TIMER_H
+
+#include <time.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    // Monotonic wall clock in milliseconds, used for load and render stage timings
+    static inline double time_now_ms(void)
+    {
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return (double)ts.tv_sec * 1000.0 + (double)ts.tv_nsec / 1000000.0;
+    }
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TIMER_H
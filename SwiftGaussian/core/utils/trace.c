@@ -0,0 +1,219 @@
+#include "trace.h"
+
+#ifndef USE_TRACE
+
+bool trace_dump(const char *path)
+{
+    (void)path;
+    return false;
+}
+
+void trace_clear(void)
+{
+}
+
+#else
+
+#include "core_memory.h"
+#include "logger.h"
+#include "timer.h"
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+
+// Spans deeper than this on one thread are not recorded, their ends still match up
+#define TRACE_MAX_DEPTH 32
+
+typedef struct
+{
+    const char *name;
+    double start_us;
+    double duration_us;
+    uint32_t tid; // of the thread that recorded it; rings are reused once their thread exits
+} trace_event_t;
+
+// One ring per thread: only its thread writes, trace_dump reads up to head
+typedef struct trace_ring
+{
+    struct trace_ring *next; // every ring ever made, they are never freed
+    atomic_bool owned;
+    uint32_t tid;
+    const char *name;
+    _Atomic uint64_t head; // spans written
+
+    // Open spans, owner only
+    uint32_t depth;
+    const char *open_names[TRACE_MAX_DEPTH];
+    double open_us[TRACE_MAX_DEPTH];
+
+    trace_event_t events[TRACE_RING_EVENTS];
+} trace_ring_t;
+
+static struct
+{
+    _Atomic(trace_ring_t *) rings;
+    atomic_uint next_tid;
+    _Atomic double cleared_us; // spans that started before it are not dumped
+    pthread_once_t once;
+    pthread_key_t exit_key;
+} g_trace_state = {.once = PTHREAD_ONCE_INIT};
+
+static _Thread_local trace_ring_t *t_ring;
+
+// Thread exit: the ring's spans stay for the dump, the next new thread writes over them
+static void release_ring(void *ring)
+{
+    atomic_store_explicit(&((trace_ring_t *)ring)->owned, false, memory_order_release);
+}
+
+static void create_exit_key(void)
+{
+    pthread_key_create(&g_trace_state.exit_key, release_ring);
+}
+
+static trace_ring_t *claim_ring(void)
+{
+    pthread_once(&g_trace_state.once, create_exit_key);
+
+    trace_ring_t *ring = atomic_load(&g_trace_state.rings);
+    for (; ring; ring = ring->next)
+    {
+        bool owned = false;
+        if (atomic_compare_exchange_strong(&ring->owned, &owned, true))
+        {
+            break;
+        }
+    }
+    if (!ring)
+    {
+        ring = (trace_ring_t *)core_calloc(MEMORY_TAG_OTHER, 1, sizeof(trace_ring_t));
+        if (!ring)
+        {
+            return NULL;
+        }
+        atomic_init(&ring->owned, true);
+        ring->next = atomic_load(&g_trace_state.rings);
+        while (!atomic_compare_exchange_weak(&g_trace_state.rings, &ring->next, ring))
+        {
+        }
+    }
+    ring->tid = atomic_fetch_add(&g_trace_state.next_tid, 1) + 1;
+    ring->name = NULL;
+    ring->depth = 0;
+    pthread_setspecific(g_trace_state.exit_key, ring);
+    return ring;
+}
+
+static trace_ring_t *thread_ring(void)
+{
+    if (!t_ring)
+    {
+        t_ring = claim_ring();
+    }
+    return t_ring;
+}
+
+void trace_begin(const char *name)
+{
+    trace_ring_t *ring = thread_ring();
+    if (!ring)
+    {
+        return;
+    }
+    if (ring->depth < TRACE_MAX_DEPTH)
+    {
+        ring->open_names[ring->depth] = name;
+        ring->open_us[ring->depth] = time_now_ms() * 1000.0;
+    }
+    ring->depth++;
+}
+
+void trace_end(void)
+{
+    trace_ring_t *ring = t_ring;
+    if (!ring || ring->depth == 0)
+    {
+        return;
+    }
+    ring->depth--;
+    if (ring->depth >= TRACE_MAX_DEPTH)
+    {
+        return;
+    }
+
+    uint64_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    double start_us = ring->open_us[ring->depth];
+    ring->events[head % TRACE_RING_EVENTS] = (trace_event_t){
+        .name = ring->open_names[ring->depth],
+        .start_us = start_us,
+        .duration_us = time_now_ms() * 1000.0 - start_us,
+        .tid = ring->tid};
+    atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+}
+
+void trace_set_thread_name(const char *name)
+{
+    trace_ring_t *ring = thread_ring();
+    if (ring)
+    {
+        ring->name = name;
+    }
+}
+
+void trace_clear(void)
+{
+    atomic_store(&g_trace_state.cleared_us, time_now_ms() * 1000.0);
+}
+
+bool trace_dump(const char *path)
+{
+    FILE *file = fopen(path, "w");
+    if (!file)
+    {
+        print("ERROR: Failed to create %s\n", path);
+        return false;
+    }
+
+    double cleared_us = atomic_load(&g_trace_state.cleared_us);
+    const char *separator = "";
+    fprintf(file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+    for (trace_ring_t *ring = atomic_load(&g_trace_state.rings); ring; ring = ring->next)
+    {
+        if (ring->name)
+        {
+            fprintf(file, "%s\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"%s\"}}",
+                    separator, ring->tid, ring->name);
+            separator = ",";
+        }
+
+        uint64_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+        uint64_t first = head > TRACE_RING_EVENTS ? head - TRACE_RING_EVENTS : 0;
+        for (uint64_t i = first; i < head; i++)
+        {
+            trace_event_t event = ring->events[i % TRACE_RING_EVENTS];
+
+            // The owner may have wrapped around onto this span while it was copied
+            atomic_thread_fence(memory_order_acquire);
+            if (i + TRACE_RING_EVENTS <= atomic_load_explicit(&ring->head, memory_order_relaxed) ||
+                event.start_us < cleared_us)
+            {
+                continue;
+            }
+            fprintf(file, "%s\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+                    separator, event.name, event.tid, event.start_us, event.duration_us);
+            separator = ",";
+        }
+    }
+    fprintf(file, "\n]}\n");
+
+    bool written = !ferror(file);
+    written = fclose(file) == 0 && written;
+    if (!written)
+    {
+        print("ERROR: Failed to write %s\n", path);
+    }
+    return written;
+}
+
+#endif // USE_TRACE
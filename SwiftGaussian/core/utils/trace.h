@@ -0,0 +1,55 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// Spans recorded per thread before the oldest ones are overwritten
+#ifndef TRACE_RING_EVENTS
+#define TRACE_RING_EVENTS 16384
+#endif
+
+// Timeline of the load and render stages for chrome://tracing or Perfetto, built with USE_TRACE defined.
+// Without it the span macros compile to nothing and trace_dump only reports that there is no trace.
+#ifdef USE_TRACE
+#define TRACE_BEGIN(name) trace_begin(name)
+#define TRACE_END() trace_end()
+#define TRACE_THREAD_NAME(name) trace_set_thread_name(name)
+
+    /**
+     * Open a span on the calling thread, closed by the next trace_end on the same thread; spans nest.
+     * Each thread writes its own ring of spans, no locks are taken.
+     *
+     * @param name String that outlives the trace, usually a literal
+     */
+    void trace_begin(const char *name);
+    void trace_end(void);
+
+    // Label the calling thread in the trace, name must outlive the trace
+    void trace_set_thread_name(const char *name);
+#else
+#define TRACE_BEGIN(name) ((void)0)
+#define TRACE_END() ((void)0)
+#define TRACE_THREAD_NAME(name) ((void)0)
+#endif
+
+    /**
+     * Write the spans of every thread as Chrome trace JSON. Best from a quiet moment: spans that threads
+     * overwrite while the dump runs are left out.
+     *
+     * @return false without USE_TRACE or when the file cannot be written
+     */
+    bool trace_dump(const char *path);
+
+    // Leave the spans recorded so far out of the next dump
+    void trace_clear(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TRACE_H
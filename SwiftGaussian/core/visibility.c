@@ -0,0 +1,94 @@
+#include "visibility.h"
+#include "utils/core_memory.h"
+#include "utils/logger.h"
+#include "utils/timer.h"
+#include <stdlib.h>
+#include <math.h>
+
+// Van der Corput radical inverse, one prime base per dimension
+static float halton(uint32_t index, uint32_t base)
+{
+    float result = 0.0f;
+    float fraction = 1.0f / (float)base;
+    while (index > 0)
+    {
+        result += fraction * (float)(index % base);
+        index /= base;
+        fraction /= (float)base;
+    }
+    return result;
+}
+
+void visibility_sample_poses(const Camera *base, const visibility_pose_params_t *params, uint32_t count,
+                             Camera *out_cameras)
+{
+    if (!base || !params || !out_cameras)
+    {
+        return;
+    }
+
+    float radius_min = fmaxf(params->radius_min, CAMERA_MIN_RADIUS);
+    float radius_max = fminf(fmaxf(params->radius_max, radius_min), CAMERA_MAX_RADIUS);
+    float log_min = logf(radius_min);
+    float log_range = logf(radius_max) - log_min;
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        // Index 0 maps every dimension to 0, start the sequence at 1
+        uint32_t sample = params->first_sample + i + 1;
+
+        Camera *camera = &out_cameras[i];
+        *camera = *base;
+        camera->yaw = 2.0f * HMM_PI32 * halton(sample, 2);
+        camera->pitch = CAMERA_MAX_PITCH * (2.0f * halton(sample, 3) - 1.0f);
+        camera->radius = expf(log_min + log_range * halton(sample, 5));
+        camera->firstTouch = true;
+        camera_update_position(camera);
+    }
+}
+
+int visibility_accumulate(const cpu_splat_source_t *source, const Camera *cameras, uint32_t count,
+                          int width, int height, float *max_contribution)
+{
+    if (!source || !cameras || !max_contribution || width <= 0 || height <= 0)
+    {
+        return -1;
+    }
+
+    uint8_t *scratch = (uint8_t *)core_malloc(MEMORY_TAG_OTHER, (size_t)width * height * 4);
+    if (!scratch)
+    {
+        print("ERROR: Failed to allocate %dx%d visibility render target\n", width, height);
+        return -1;
+    }
+
+    cpu_splat_source_t recording = *source;
+    recording.max_contribution = max_contribution;
+
+    double start_time = time_now_ms();
+    for (uint32_t i = 0; i < count; i++)
+    {
+        Camera camera = cameras[i];
+        if (cpu_render_splats(&recording, &camera, width, height, scratch, NULL) != 0)
+        {
+            core_free(scratch);
+            return -1;
+        }
+    }
+    print("Visibility: rendered %u views at %dx%d in %.1f ms\n", count, width, height, time_now_ms() - start_time);
+
+    core_free(scratch);
+    return 0;
+}
+
+uint32_t visibility_keep_mask(const float *max_contribution, uint32_t splat_count, float threshold,
+                              uint8_t *out_keep)
+{
+    uint32_t kept = 0;
+    for (uint32_t i = 0; i < splat_count; i++)
+    {
+        out_keep[i] = max_contribution[i] >= threshold ? 1 : 0;
+        kept += out_keep[i];
+    }
+    return kept;
+}
@@ -0,0 +1,58 @@
+#ifndef VISIBILITY_H
+#define VISIBILITY_H
+
+#include <stdint.h>
+#include "camera.h"
+#include "cpu_renderer.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// Splats whose largest blend weight stays below this never move an 8-bit pixel by a full step
+#define VISIBILITY_DEFAULT_THRESHOLD (1.0f / 255.0f)
+
+    typedef struct
+    {
+        float radius_min; // orbit radii to sample, clamped to the camera limits
+        float radius_max;
+        uint32_t first_sample; // offset into the sample sequence; disjoint ranges give disjoint poses
+    } visibility_pose_params_t;
+
+    /**
+     * Sample orbit poses from the space the interactive camera can reach
+     * Yaw covers the full circle, pitch +-CAMERA_MAX_PITCH and radius is log-uniform over
+     * [radius_min, radius_max], using a Halton sequence so few views still cover the space evenly.
+     *
+     * @param base Camera providing fov, clip planes and target
+     * @param params Radius range and sequence offset
+     * @param count Number of poses to generate
+     * @param out_cameras Array of count cameras
+     */
+    void visibility_sample_poses(const Camera *base, const visibility_pose_params_t *params, uint32_t count,
+                                 Camera *out_cameras);
+
+    /**
+     * Render every pose on the CPU and record each splat's largest contribution to any pixel
+     *
+     * @param source Splats to render; its max_contribution is ignored
+     * @param cameras Poses to render from
+     * @param count Number of poses
+     * @param width Render width in pixels
+     * @param height Render height in pixels
+     * @param max_contribution One float per source splat, zero it before the first call
+     * @return 0 on success, -1 on failure
+     */
+    int visibility_accumulate(const cpu_splat_source_t *source, const Camera *cameras, uint32_t count,
+                              int width, int height, float *max_contribution);
+
+    // Flag splats that reached threshold in some view; returns the number kept
+    uint32_t visibility_keep_mask(const float *max_contribution, uint32_t splat_count, float threshold,
+                                  uint8_t *out_keep);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // VISIBILITY_H
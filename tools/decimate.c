@@ -0,0 +1,207 @@
+// Decimation to a fixed splat count by iterative Gaussian merging
+//
+// usage: decimate input.spz output.spz (--target N | --ratio R) [--max-error E]
+//                 [--color-weight W] [--window N] [--compare VIEWS] [--size PIXELS]
+//
+// Decodes the input at full precision, merges nearby pairs with moment matching until
+// --target splats remain (or no merge is cheaper than --max-error) and writes a version 3 SPZ.
+// --compare renders orbit views of both files on the CPU and reports the image error.
+#include "tool_common.h"
+#include "decimate.h"
+#include "visibility.h"
+#include "loader/spzfile.h"
+#include "utils/core_memory.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct
+{
+    const char *input_path;
+    const char *output_path;
+    float ratio;
+    uint32_t compare_views;
+    int size;
+    decimate_params_t params;
+} decimate_args_t;
+
+static void print_usage(void)
+{
+    printf("usage: decimate input.spz output.spz (--target N | --ratio R) [--max-error E]\n"
+           "                [--color-weight W] [--window N] [--compare VIEWS] [--size PIXELS]\n");
+}
+
+static int parse_args(int argc, char **argv, decimate_args_t *args)
+{
+    *args = (decimate_args_t){
+        .compare_views = 8,
+        .size = 512,
+        .params = {.color_weight = DECIMATE_DEFAULT_COLOR_WEIGHT, .window = DECIMATE_DEFAULT_WINDOW}};
+
+    int positional = 0;
+    for (int i = 1; i < argc; i++)
+    {
+        const char *arg = argv[i];
+        const char *value = i + 1 < argc ? argv[i + 1] : NULL;
+        if (arg[0] != '-')
+        {
+            if (positional == 0)
+                args->input_path = arg;
+            else if (positional == 1)
+                args->output_path = arg;
+            else
+                return -1;
+            positional++;
+            continue;
+        }
+        if (!value)
+        {
+            return -1;
+        }
+        if (strcmp(arg, "--target") == 0)
+            args->params.target_count = (uint32_t)strtoul(value, NULL, 10);
+        else if (strcmp(arg, "--ratio") == 0)
+            args->ratio = strtof(value, NULL);
+        else if (strcmp(arg, "--max-error") == 0)
+            args->params.max_error = strtof(value, NULL);
+        else if (strcmp(arg, "--color-weight") == 0)
+            args->params.color_weight = strtof(value, NULL);
+        else if (strcmp(arg, "--window") == 0)
+            args->params.window = (uint32_t)strtoul(value, NULL, 10);
+        else if (strcmp(arg, "--compare") == 0)
+            args->compare_views = (uint32_t)strtoul(value, NULL, 10);
+        else if (strcmp(arg, "--size") == 0)
+            args->size = atoi(value);
+        else
+            return -1;
+        i++;
+    }
+
+    bool has_goal = args->params.target_count > 0 || args->ratio > 0.0f || args->params.max_error > 0.0f;
+    return (positional == 2 && has_goal && args->size > 0) ? 0 : -1;
+}
+
+// Orbit views around the original scene, rendered from both files
+static int compare_views(const tool_scene_t *original, const tool_scene_t *decimated, uint32_t count, int size)
+{
+    HMM_Vec3 extent = HMM_Sub(original->bounds.max, original->bounds.min);
+    float scene_radius = 0.5f * HMM_LenV3(extent);
+    Camera *base = camera_create();
+    Camera *cameras = (Camera *)malloc((size_t)count * sizeof(Camera));
+    uint8_t *reference = (uint8_t *)malloc((size_t)size * size * 4);
+    uint8_t *candidate = (uint8_t *)malloc((size_t)size * size * 4);
+    if (!base || !cameras || !reference || !candidate)
+    {
+        camera_destroy(base);
+        free(cameras);
+        free(reference);
+        free(candidate);
+        return -1;
+    }
+
+    visibility_pose_params_t poses = {.radius_min = 1.5f * scene_radius, .radius_max = 3.0f * scene_radius};
+    visibility_sample_poses(base, &poses, count, cameras);
+
+    cpu_splat_source_t original_source = tool_scene_source(original);
+    cpu_splat_source_t decimated_source = tool_scene_source(decimated);
+    double rmse_sum = 0.0;
+    double rmse_max = 0.0;
+    int result = 0;
+    for (uint32_t i = 0; i < count && result == 0; i++)
+    {
+        if (cpu_render_splats(&original_source, &cameras[i], size, size, reference, NULL) != 0 ||
+            cpu_render_splats(&decimated_source, &cameras[i], size, size, candidate, NULL) != 0)
+        {
+            result = -1;
+            break;
+        }
+        double rmse = tool_image_rmse(reference, candidate, size, size);
+        rmse_sum += rmse;
+        rmse_max = rmse > rmse_max ? rmse : rmse_max;
+    }
+
+    if (result == 0 && count > 0)
+    {
+        double rmse_mean = rmse_sum / count;
+        printf("Image error (%u views): mean RMSE %.3f (PSNR %.2f dB), worst RMSE %.3f (PSNR %.2f dB)\n",
+               count, rmse_mean, tool_psnr(rmse_mean), rmse_max, tool_psnr(rmse_max));
+    }
+
+    camera_destroy(base);
+    free(cameras);
+    free(reference);
+    free(candidate);
+    return result;
+}
+
+int main(int argc, char **argv)
+{
+    decimate_args_t args;
+    if (parse_args(argc, argv, &args) != 0)
+    {
+        print_usage();
+        return 1;
+    }
+
+    uint8_t *spz = NULL;
+    size_t spz_size = 0;
+    gaussian_t *gaussians = NULL;
+    uint32_t count = 0;
+    if (spz_read_file(args.input_path, &spz, &spz_size) != 0 ||
+        parse_spz_data_to_gaussians(spz, spz_size, &gaussians, &count) != 0)
+    {
+        return 1;
+    }
+
+    if (args.params.target_count == 0 && args.ratio > 0.0f)
+    {
+        args.params.target_count = (uint32_t)((double)count * args.ratio + 0.5);
+    }
+
+    // Keep the source's position precision
+    uint8_t fractional_bits = ((const PackedGaussiansHeader *)spz)->fractionalBits;
+
+    gaussian_t *merged = NULL;
+    uint32_t merged_count = 0;
+    decimate_stats_t stats;
+    uint8_t *output = NULL;
+    size_t output_size = 0;
+    if (decimate_gaussians(gaussians, count, &args.params, &merged, &merged_count, &stats) != 0 ||
+        spz_encode_gaussians(merged, merged_count, fractional_bits, &output, &output_size) != 0 ||
+        spz_write_file(args.output_path, output, output_size) != 0)
+    {
+        return 1;
+    }
+    core_free(gaussians);
+    core_free(merged);
+
+    printf("Kept %u of %u splats (%.2f%%), %u rounds, max merge error %.3f, %.2f s\n",
+           stats.output_count, stats.input_count, 100.0 * stats.output_count / stats.input_count,
+           stats.rounds, stats.max_merge_error, stats.total_ms / 1000.0);
+    printf("Wrote %s (%.2f MB decompressed, SH dropped)\n", args.output_path, output_size / (1024.0 * 1024.0));
+
+    int result = 0;
+    if (args.compare_views > 0)
+    {
+        tool_scene_t original;
+        tool_scene_t decimated;
+        if (tool_scene_from_spz(spz, spz_size, &original) != 0)
+        {
+            return 1;
+        }
+        if (tool_scene_from_spz(output, output_size, &decimated) != 0)
+        {
+            tool_scene_free(&original);
+            return 1;
+        }
+        result = compare_views(&original, &decimated, args.compare_views, args.size);
+        tool_scene_free(&original);
+        tool_scene_free(&decimated);
+    }
+    else
+    {
+        core_free(spz);
+        core_free(output);
+    }
+    return result == 0 ? 0 : 1;
+}
@@ -0,0 +1,225 @@
+// Load-time comparison of CPU decoding and the GPU decode path, and agreement of their output
+//
+// usage: decode_compare input.spz [--no-order] [--min-opacity A] [--runs N]
+//
+// Times the CPU parse (parse_spz_data_to_splats_with_options + texel and position packing) against
+// the CPU share of a GPU decode (spz_prepare_decode), and runs spz_decode_splats, the bit-exact CPU
+// version of decode.glsl, to compare its texels with the CPU parse: chunk bounds and rotations must
+// match exactly (both convert version 2 rotations with the same integer code), positions may differ by
+// one quantization step.
+#include "tool_common.h"
+#include "loader/spzfile.h"
+#include "utils/core_memory.h"
+#include "utils/quaternion.h"
+#include "utils/timer.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct
+{
+    const char *input_path;
+    spz_load_options_t options;
+    int runs;
+} compare_args_t;
+
+typedef struct
+{
+    uint32_t max_position_step;
+    uint32_t rotation_mismatches;
+    double max_rotation_degrees;
+    uint32_t other_mismatches; // scale, color or opacity, never expected
+} compare_result_t;
+
+static void print_usage(void)
+{
+    printf("usage: decode_compare input.spz [--no-order] [--min-opacity A] [--runs N]\n");
+}
+
+static int parse_args(int argc, char **argv, compare_args_t *args)
+{
+    *args = (compare_args_t){
+        .options = {.spatial_order = true, .layout = SPLAT_LAYOUT_QUATERNION},
+        .runs = 3};
+
+    for (int i = 1; i < argc; i++)
+    {
+        const char *arg = argv[i];
+        const char *value = i + 1 < argc ? argv[i + 1] : NULL;
+        if (arg[0] != '-')
+        {
+            if (args->input_path)
+                return -1;
+            args->input_path = arg;
+            continue;
+        }
+        if (strcmp(arg, "--no-order") == 0)
+        {
+            args->options.spatial_order = false;
+            continue;
+        }
+        if (!value)
+        {
+            return -1;
+        }
+        if (strcmp(arg, "--min-opacity") == 0)
+            args->options.prune.min_opacity = strtof(value, NULL);
+        else if (strcmp(arg, "--runs") == 0)
+            args->runs = atoi(value);
+        else
+            return -1;
+        i++;
+    }
+    return (args->input_path && args->runs > 0) ? 0 : -1;
+}
+
+static uint32_t step_difference(uint32_t a, uint32_t b)
+{
+    return a > b ? a - b : b - a;
+}
+
+static void compare_texels(const uint32_t *expected, const uint32_t *decoded, uint32_t count, compare_result_t *out)
+{
+    *out = (compare_result_t){0};
+    for (uint32_t i = 0; i < count; i++)
+    {
+        const uint32_t *a = &expected[(size_t)i * 4];
+        const uint32_t *b = &decoded[(size_t)i * 4];
+        uint32_t steps[3] = {step_difference(a[0] >> 16, b[0] >> 16), step_difference(a[0] & 0xFFFFu, b[0] & 0xFFFFu),
+                             step_difference(a[1] >> 16, b[1] >> 16)};
+        for (int k = 0; k < 3; k++)
+        {
+            out->max_position_step = steps[k] > out->max_position_step ? steps[k] : out->max_position_step;
+        }
+
+        uint32_t qa = splat_texel_quaternion(a);
+        uint32_t qb = splat_texel_quaternion(b);
+        if (qa != qb)
+        {
+            HMM_Quat ra = HMM_NormQ(quat_decode_smallest_three(qa));
+            HMM_Quat rb = HMM_NormQ(quat_decode_smallest_three(qb));
+            double dot = fmin(fabs((double)HMM_DotQ(ra, rb)), 1.0);
+            double degrees = 2.0 * acos(dot) * 180.0 / HMM_PI;
+            out->max_rotation_degrees = degrees > out->max_rotation_degrees ? degrees : out->max_rotation_degrees;
+            out->rotation_mismatches++;
+        }
+
+        // Scale bytes of b and the whole color word
+        if (((a[2] ^ b[2]) & 0x00FFFF00u) != 0 || a[3] != b[3])
+        {
+            out->other_mismatches++;
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    compare_args_t args;
+    if (parse_args(argc, argv, &args) != 0)
+    {
+        print_usage();
+        return 1;
+    }
+
+    uint8_t *spz = NULL;
+    size_t spz_size = 0;
+    if (spz_read_file(args.input_path, &spz, &spz_size) != 0)
+    {
+        return 1;
+    }
+
+    double cpu_ms = 0.0;
+    double prepare_ms = 0.0;
+    double kernel_ms = 0.0;
+    int result = 0;
+    for (int run = 0; run < args.runs && result == 0; run++)
+    {
+        // CPU path: everything up to the texels and position stream that would be uploaded
+        double start = time_now_ms();
+        PackedSplat *splats = NULL;
+        splat_chunk_t *chunks = NULL;
+        uint32_t count = 0;
+        BoundingBox bounds;
+        if (parse_spz_data_to_splats_with_options(spz, spz_size, &args.options, &splats, &count, &bounds,
+                                                  &chunks, NULL) != 0)
+        {
+            return 1;
+        }
+        uint32_t *texels = convert_splats_to_texture_data(splats, count, SPLAT_LAYOUT_QUATERNION, (int)count, 1, 1);
+        uint32_t *positions = convert_splats_to_position_data(splats, count);
+        double cpu_end = time_now_ms();
+
+        // GPU path: the CPU plans, the kernel (here its CPU version) decodes
+        spz_decode_plan_t plan;
+        if (!texels || !positions || spz_prepare_decode(spz, spz_size, &args.options, &plan, NULL) != 0)
+        {
+            return 1;
+        }
+        double prepare_end = time_now_ms();
+        uint32_t *decoded = (uint32_t *)malloc((size_t)count * 4 * sizeof(uint32_t));
+        uint32_t *decoded_positions = (uint32_t *)malloc(splat_position_words(count) * sizeof(uint32_t));
+        if (!decoded || !decoded_positions)
+        {
+            return 1;
+        }
+        spz_decode_splats(&plan, decoded, decoded_positions);
+        double kernel_end = time_now_ms();
+
+        cpu_ms += cpu_end - start;
+        prepare_ms += prepare_end - cpu_end;
+        kernel_ms += kernel_end - prepare_end;
+
+        if (run == 0)
+        {
+            bool same_chunks = plan.splat_count == count &&
+                               memcmp(plan.chunks, chunks, (size_t)splat_chunk_count(count) * sizeof(splat_chunk_t)) == 0;
+            compare_result_t compare;
+            compare_texels(texels, decoded, count, &compare);
+
+            // The stream must be the kernel's own positions, packed like convert_splats_to_position_data
+            uint32_t stream_mismatches = 0;
+            for (uint32_t i = 0; i < count; i++)
+            {
+                uint32_t first = (i * 3) >> 1;
+                uint32_t w0 = decoded_positions[first];
+                uint32_t w1 = decoded_positions[first + 1];
+                uint32_t x = (i & 1) ? w0 >> 16 : w0 & 0xFFFFu;
+                uint32_t y = (i & 1) ? w1 & 0xFFFFu : w0 >> 16;
+                uint32_t z = (i & 1) ? w1 >> 16 : w1 & 0xFFFFu;
+                const uint32_t *texel = &decoded[(size_t)i * 4];
+                if (x != texel[0] >> 16 || y != (texel[0] & 0xFFFFu) || z != texel[1] >> 16)
+                {
+                    stream_mismatches++;
+                }
+            }
+
+            printf("%u splats, SPZ version %u, %s order\n", count, plan.version,
+                   args.options.spatial_order ? "spatial" : "stream");
+            printf("Chunk bounds: %s\n", same_chunks ? "identical" : "DIFFERENT");
+            printf("Positions: max %u quantization step(s) from the CPU parse\n", compare.max_position_step);
+            printf("Rotations: %u differ (%.3f%%), max %.3f degrees\n", compare.rotation_mismatches,
+                   100.0 * compare.rotation_mismatches / count, compare.max_rotation_degrees);
+            printf("Scale, color, opacity: %u differ; position stream: %u mismatches\n",
+                   compare.other_mismatches, stream_mismatches);
+            if (!same_chunks || compare.max_position_step > 1 || compare.rotation_mismatches > 0 ||
+                compare.other_mismatches > 0 || stream_mismatches > 0)
+            {
+                result = -1;
+            }
+        }
+
+        spz_free_decode_plan(&plan);
+        core_free(splats);
+        core_free(chunks);
+        core_free(texels);
+        core_free(positions);
+        free(decoded);
+        free(decoded_positions);
+    }
+
+    printf("CPU decode %.1f ms | GPU decode, CPU share %.1f ms (%.1fx less) | kernel on the CPU %.1f ms (mean of %d)\n",
+           cpu_ms / args.runs, prepare_ms / args.runs, cpu_ms / fmax(prepare_ms, 1e-3), kernel_ms / args.runs, args.runs);
+    core_free(spz);
+    return result == 0 ? 0 : 1;
+}
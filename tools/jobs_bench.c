@@ -0,0 +1,247 @@
+// Job system against OpenMP on the loops the loader and the CPU renderer run
+//
+// usage: jobs_bench [--count N] [--threads T] [--runs R]
+//
+// Each loop runs over synthetic splats with the same grain under job_parallel_for and under
+// '#pragma omp parallel for' (static, and dynamic where the work is uneven), at 1 thread and at T.
+// pack and morton are the even, memory-bound loops of parse and sort; uneven gives each item
+// 0-63 units of work, like tiles of the CPU renderer, so it shows how well stealing balances.
+#include "utils/jobs.h"
+#include "utils/morton.h"
+#include "utils/timer.h"
+#include "splat_texture.h"
+#include <math.h>
+#include <omp.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BENCH_GRAIN 4096
+#define BENCH_UNEVEN_GRAIN 64
+
+typedef struct
+{
+    uint32_t count;
+    uint32_t threads;
+    int runs;
+} bench_args_t;
+
+typedef struct
+{
+    uint32_t count;
+    const PackedSplat *splats;
+    const float *positions; // xyz
+    uint32_t *texels;
+    uint64_t *codes;
+    float *results;
+} bench_data_t;
+
+static void print_usage(void)
+{
+    printf("usage: jobs_bench [--count N] [--threads T] [--runs R]\n");
+}
+
+static int parse_args(int argc, char **argv, bench_args_t *args)
+{
+    *args = (bench_args_t){.count = 4000000, .threads = (uint32_t)omp_get_num_procs(), .runs = 5};
+
+    for (int i = 1; i < argc; i++)
+    {
+        const char *arg = argv[i];
+        const char *value = i + 1 < argc ? argv[i + 1] : NULL;
+        if (!value)
+        {
+            return -1;
+        }
+        if (strcmp(arg, "--count") == 0)
+            args->count = (uint32_t)strtoul(value, NULL, 10);
+        else if (strcmp(arg, "--threads") == 0)
+            args->threads = (uint32_t)atoi(value);
+        else if (strcmp(arg, "--runs") == 0)
+            args->runs = atoi(value);
+        else
+            return -1;
+        i++;
+    }
+    return (args->count > 0 && args->threads > 0 && args->threads <= JOB_MAX_THREADS && args->runs > 0) ? 0 : -1;
+}
+
+// The texel words of convert_splats_to_texture_data, quaternion layout
+static inline void pack_item(const bench_data_t *data, uint32_t i)
+{
+    const PackedSplat *splat = &data->splats[i];
+    uint32_t *texel = &data->texels[(size_t)i * 4];
+    texel[0] = ((uint32_t)splat->pos_x << 16) | splat->pos_y;
+    texel[1] = ((uint32_t)splat->pos_z << 16) | (splat->rot_quat & 0xFFFFu);
+    texel[2] = (((splat->rot_quat >> 16) & 0xFFu) << 24) | ((uint32_t)splat->scale_x << 16) |
+               ((uint32_t)splat->scale_y << 8) | (splat->rot_quat >> 24);
+    texel[3] = ((uint32_t)splat->r << 24) | ((uint32_t)splat->g << 16) | ((uint32_t)splat->b << 8) | splat->a;
+}
+
+static inline void morton_item(const bench_data_t *data, uint32_t i)
+{
+    const float *p = &data->positions[(size_t)i * 3];
+    data->codes[i] = morton_encode3((uint32_t)(p[0] * 65535.0f), (uint32_t)(p[1] * 65535.0f),
+                                    (uint32_t)(p[2] * 65535.0f));
+}
+
+static inline void uneven_item(const bench_data_t *data, uint32_t i)
+{
+    float sum = 0.0f;
+    uint32_t work = (i * 2654435761u) >> 26;
+    for (uint32_t k = 0; k < work * 16; k++)
+    {
+        sum += sinf((float)(i + k));
+    }
+    data->results[i] = sum;
+}
+
+static void pack_range(uint32_t begin, uint32_t end, uint32_t slot, void *context)
+{
+    (void)slot;
+    for (uint32_t i = begin; i < end; i++)
+        pack_item((const bench_data_t *)context, i);
+}
+
+static void morton_range(uint32_t begin, uint32_t end, uint32_t slot, void *context)
+{
+    (void)slot;
+    for (uint32_t i = begin; i < end; i++)
+        morton_item((const bench_data_t *)context, i);
+}
+
+static void uneven_range(uint32_t begin, uint32_t end, uint32_t slot, void *context)
+{
+    (void)slot;
+    for (uint32_t i = begin; i < end; i++)
+        uneven_item((const bench_data_t *)context, i);
+}
+
+typedef enum
+{
+    BENCH_JOBS,
+    BENCH_OMP_STATIC,
+    BENCH_OMP_DYNAMIC,
+} bench_runner_t;
+
+typedef struct
+{
+    const char *name;
+    job_range_fn range;
+    void (*item)(const bench_data_t *data, uint32_t i);
+    uint32_t count_divisor; // uneven runs on fewer items so all loops take similar time
+    uint32_t grain;
+} bench_loop_t;
+
+static void run_loop(const bench_loop_t *loop, bench_runner_t runner, bench_data_t *data, int threads)
+{
+    int count = (int)(data->count / loop->count_divisor);
+    switch (runner)
+    {
+    case BENCH_JOBS:
+        job_parallel_for((uint32_t)count, loop->grain, loop->range, data);
+        break;
+    case BENCH_OMP_STATIC:
+#pragma omp parallel for schedule(static, loop->grain) num_threads(threads)
+        for (int i = 0; i < count; i++)
+            loop->item(data, (uint32_t)i);
+        break;
+    case BENCH_OMP_DYNAMIC:
+#pragma omp parallel for schedule(dynamic, loop->grain) num_threads(threads)
+        for (int i = 0; i < count; i++)
+            loop->item(data, (uint32_t)i);
+        break;
+    }
+}
+
+static int compare_double(const void *a, const void *b)
+{
+    double da = *(const double *)a;
+    double db = *(const double *)b;
+    return (da > db) - (da < db);
+}
+
+// Median of the timed runs, after one untimed warm-up
+static double time_loop(const bench_loop_t *loop, bench_runner_t runner, bench_data_t *data, int threads, int runs)
+{
+    double *times = (double *)malloc((size_t)runs * sizeof(double));
+    run_loop(loop, runner, data, threads);
+    for (int r = 0; r < runs; r++)
+    {
+        double start = time_now_ms();
+        run_loop(loop, runner, data, threads);
+        times[r] = time_now_ms() - start;
+    }
+    qsort(times, (size_t)runs, sizeof(double), compare_double);
+    double median = times[runs / 2];
+    free(times);
+    return median;
+}
+
+int main(int argc, char **argv)
+{
+    bench_args_t args;
+    if (parse_args(argc, argv, &args) != 0)
+    {
+        print_usage();
+        return 1;
+    }
+
+    PackedSplat *splats = (PackedSplat *)malloc((size_t)args.count * sizeof(PackedSplat));
+    float *positions = (float *)malloc((size_t)args.count * 3 * sizeof(float));
+    bench_data_t data = {
+        .count = args.count,
+        .splats = splats,
+        .positions = positions,
+        .texels = (uint32_t *)malloc((size_t)args.count * 4 * sizeof(uint32_t)),
+        .codes = (uint64_t *)malloc((size_t)args.count * sizeof(uint64_t)),
+        .results = (float *)malloc((size_t)args.count * sizeof(float))};
+    if (!splats || !positions || !data.texels || !data.codes || !data.results)
+    {
+        fprintf(stderr, "Failed to allocate %u synthetic splats\n", args.count);
+        return 1;
+    }
+
+    srand(1);
+    for (uint32_t i = 0; i < args.count; i++)
+    {
+        uint8_t *bytes = (uint8_t *)&splats[i];
+        for (size_t b = 0; b < sizeof(PackedSplat); b++)
+            bytes[b] = (uint8_t)rand();
+        for (int k = 0; k < 3; k++)
+            positions[(size_t)i * 3 + k] = (float)rand() / (float)RAND_MAX;
+    }
+
+    const bench_loop_t loops[] = {
+        {"pack", pack_range, pack_item, 1, BENCH_GRAIN},
+        {"morton", morton_range, morton_item, 1, BENCH_GRAIN},
+        {"uneven", uneven_range, uneven_item, 64, BENCH_UNEVEN_GRAIN},
+    };
+    uint32_t thread_counts[2] = {1, args.threads};
+
+    printf("%u splats, median of %d runs\n", args.count, args.runs);
+    printf("%-8s %8s %12s %12s %12s\n", "loop", "threads", "jobs ms", "omp static", "omp dynamic");
+    for (uint32_t t = 0; t < (args.threads > 1 ? 2u : 1u); t++)
+    {
+        uint32_t threads = thread_counts[t];
+        job_system_shutdown();
+        job_system_init(threads - 1);
+        for (size_t l = 0; l < sizeof(loops) / sizeof(loops[0]); l++)
+        {
+            double ms[3];
+            for (int r = 0; r < 3; r++)
+            {
+                ms[r] = time_loop(&loops[l], (bench_runner_t)r, &data, (int)threads, args.runs);
+            }
+            printf("%-8s %8u %12.2f %12.2f %12.2f\n", loops[l].name, threads, ms[0], ms[1], ms[2]);
+        }
+    }
+
+    job_system_shutdown();
+    free(splats);
+    free(positions);
+    free(data.texels);
+    free(data.codes);
+    free(data.results);
+    return 0;
+}
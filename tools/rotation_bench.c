@@ -0,0 +1,663 @@
+// Speed and accuracy of the rotation math run once per splat at load: quat_to_axis_angle, octahedral_encode
+// and the 8-bit axis + angle packing of SPLAT_LAYOUT_AXIS_ANGLE, against a double precision reference
+//
+// usage: rotation_bench [--count N] [--runs R] [--seed S]
+//
+// Functions: ns per call and largest error of the float results, including acos approximations.
+// Encoders: quaternion to the u, v, angle bytes the loader stores, one batch call per run so batched
+// and SIMD versions slot in as new rows. Bytes are checked against the double reference rounded to
+// nearest; axis bytes only where the angle does not round to 0 (any axis is right there). Rotation
+// error is measured after decoding the bytes the way cpu_renderer.c and splat.glsl do.
+// Inputs are uniform rotations at lengths within 2% of 1 (version 2 streams are not normalized) with
+// either sign of w, plus edge cases: identity, half turns, coordinate axes, octahedron edges, tiny angles.
+#include "utils/quaternion.h"
+#include "utils/timer.h"
+#include <float.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define EDGE_CASES 64
+
+// Angles that round to byte 0, their axis is never used
+#define AXIS_MIN_ANGLE (0.5 * HMM_PI / 255.0)
+
+typedef struct
+{
+    uint32_t count;
+    int runs;
+    uint32_t seed;
+} bench_args_t;
+
+// Double precision axis, angle and octahedral coordinates of one rotation, w >= 0
+typedef struct
+{
+    double axis[3];
+    double angle;
+    double u, v;
+    uint8_t bytes[3];
+} reference_t;
+
+typedef struct
+{
+    uint32_t count;
+    const HMM_Quat *rotations;
+    const reference_t *references;
+    float *results; // 4 floats per splat, scratch for the function rows
+    uint8_t *bytes; // 3 per splat: octahedral u, v and angle / pi, as PackedSplat stores them
+} bench_data_t;
+
+// A batch encoder: rotations (any length and sign) to 3 bytes each
+typedef void (*encode_fn)(const HMM_Quat *rotations, uint32_t count, uint8_t *out);
+
+static void print_usage(void)
+{
+    printf("usage: rotation_bench [--count N] [--runs R] [--seed S]\n");
+}
+
+static int parse_args(int argc, char **argv, bench_args_t *args)
+{
+    *args = (bench_args_t){.count = 1000000, .runs = 5, .seed = 1};
+
+    for (int i = 1; i < argc; i++)
+    {
+        const char *arg = argv[i];
+        const char *value = i + 1 < argc ? argv[i + 1] : NULL;
+        if (!value)
+        {
+            return -1;
+        }
+        if (strcmp(arg, "--count") == 0)
+            args->count = (uint32_t)strtoul(value, NULL, 10);
+        else if (strcmp(arg, "--runs") == 0)
+            args->runs = atoi(value);
+        else if (strcmp(arg, "--seed") == 0)
+            args->seed = (uint32_t)strtoul(value, NULL, 10);
+        else
+            return -1;
+        i++;
+    }
+    return (args->count >= EDGE_CASES && args->runs > 0) ? 0 : -1;
+}
+
+// ---------------------------------------------------------------------------------------------------------
+// Reference
+
+static void octahedral_encode_double(const double v[3], double *out_u, double *out_v)
+{
+    double l1 = fabs(v[0]) + fabs(v[1]) + fabs(v[2]);
+    double x = v[0] / l1;
+    double y = v[1] / l1;
+    if (v[2] < 0.0)
+    {
+        double fx = (1.0 - fabs(y)) * (x >= 0.0 ? 1.0 : -1.0);
+        double fy = (1.0 - fabs(x)) * (y >= 0.0 ? 1.0 : -1.0);
+        x = fx;
+        y = fy;
+    }
+    *out_u = x * 0.5 + 0.5;
+    *out_v = y * 0.5 + 0.5;
+}
+
+static uint8_t round_unorm8(double value)
+{
+    return (uint8_t)lround(fmin(fmax(value, 0.0), 1.0) * 255.0);
+}
+
+static reference_t reference_encode(HMM_Quat q)
+{
+    double c[4] = {q.X, q.Y, q.Z, q.W};
+    double length = sqrt(c[0] * c[0] + c[1] * c[1] + c[2] * c[2] + c[3] * c[3]);
+    double sign = c[3] < 0.0 ? -1.0 : 1.0;
+    for (int k = 0; k < 4; k++)
+    {
+        c[k] *= sign / length;
+    }
+
+    reference_t out = {.axis = {1.0, 0.0, 0.0}};
+    double s = sqrt(c[0] * c[0] + c[1] * c[1] + c[2] * c[2]);
+    out.angle = 2.0 * atan2(s, c[3]);
+    if (s > 0.0)
+    {
+        for (int k = 0; k < 3; k++)
+        {
+            out.axis[k] = c[k] / s;
+        }
+    }
+    octahedral_encode_double(out.axis, &out.u, &out.v);
+    out.bytes[0] = round_unorm8(out.u);
+    out.bytes[1] = round_unorm8(out.v);
+    out.bytes[2] = round_unorm8(out.angle / HMM_PI);
+    return out;
+}
+
+// Angle between the original rotation and the decoded bytes, as the renderers rebuild it
+static double rotation_error(HMM_Quat q, const uint8_t bytes[3])
+{
+    const float inv_255 = 1.0f / 255.0f;
+    HMM_Vec3 axis = octahedral_decode(HMM_V2(bytes[0] * inv_255, bytes[1] * inv_255));
+    HMM_Quat d = axis_angle_to_quat(axis, bytes[2] * inv_255 * HMM_PI32);
+
+    double a[4] = {q.X, q.Y, q.Z, q.W};
+    double b[4] = {d.X, d.Y, d.Z, d.W};
+    double dot = 0.0, la = 0.0, lb = 0.0;
+    for (int k = 0; k < 4; k++)
+    {
+        dot += a[k] * b[k];
+        la += a[k] * a[k];
+        lb += b[k] * b[k];
+    }
+    dot = fmin(fabs(dot) / sqrt(la * lb), 1.0);
+
+    // 2 acos(dot) loses the small errors; 2 atan2(|a x b|, a.b) over the 4D pair keeps them
+    double cross = sqrt(fmax(0.0, 1.0 - dot * dot));
+    return 2.0 * atan2(cross, dot) * 180.0 / HMM_PI;
+}
+
+// ---------------------------------------------------------------------------------------------------------
+// acos approximations for x in [0, 1], the range of w once it is made non-negative
+
+// Abramowitz and Stegun 4.4.45, |error| <= 6.7e-5 rad
+static inline float acos_poly4(float x)
+{
+    float p = ((-0.0187293f * x + 0.0742610f) * x - 0.2121144f) * x + 1.5707288f;
+    return sqrtf(1.0f - x) * p;
+}
+
+// Abramowitz and Stegun 4.4.46, |error| <= 2e-8 rad (float rounding dominates)
+static inline float acos_poly8(float x)
+{
+    float p = -0.0012624911f;
+    p = p * x + 0.0066700901f;
+    p = p * x - 0.0170881256f;
+    p = p * x + 0.0308918810f;
+    p = p * x - 0.0501743046f;
+    p = p * x + 0.0889789874f;
+    p = p * x - 0.2145988016f;
+    p = p * x + 1.5707963050f;
+    return sqrtf(1.0f - x) * p;
+}
+
+// Angle byte straight from w: entry k is the w below which the byte rounds to k or more, a branchless
+// 8-step search finds the byte. Exact against the double reference but for the float rounding of w.
+static float g_angle_thresholds[256];
+
+static void init_angle_thresholds(void)
+{
+    g_angle_thresholds[0] = 2.0f; // every w
+    for (int k = 1; k < 256; k++)
+    {
+        // byte >= k  <=>  2 acos(w) / pi * 255 >= k - 0.5  <=>  w <= cos((k - 0.5) pi / 510)
+        g_angle_thresholds[k] = (float)cos((k - 0.5) * HMM_PI / 510.0);
+    }
+}
+
+static inline uint8_t angle_byte_lut(float w)
+{
+    uint32_t k = 0;
+    for (uint32_t step = 128; step > 0; step >>= 1)
+    {
+        k += g_angle_thresholds[k + step] >= w ? step : 0;
+    }
+    return (uint8_t)k;
+}
+
+// ---------------------------------------------------------------------------------------------------------
+// Encoders
+
+static inline uint8_t truncate_unorm8(float value)
+{
+    return (uint8_t)(fminf(fmaxf(value, 0.0f), 1.0f) * 255.0f);
+}
+
+static inline uint8_t round_unorm8f(float value)
+{
+    return (uint8_t)(fminf(fmaxf(value, 0.0f), 1.0f) * 255.0f + 0.5f);
+}
+
+static inline HMM_Quat positive_w(HMM_Quat q)
+{
+    return q.W < 0.0f ? HMM_Q(-q.X, -q.Y, -q.Z, -q.W) : q;
+}
+
+// What pack_splat_chunks runs today: core functions, bytes truncated
+static void encode_loader(const HMM_Quat *rotations, uint32_t count, uint8_t *out)
+{
+    for (uint32_t i = 0; i < count; i++)
+    {
+        HMM_Vec3 axis;
+        float angle;
+        quat_to_axis_angle(positive_w(rotations[i]), &axis, &angle);
+        HMM_Vec2 oct = octahedral_encode(axis);
+        out[i * 3 + 0] = truncate_unorm8(oct.X);
+        out[i * 3 + 1] = truncate_unorm8(oct.Y);
+        out[i * 3 + 2] = truncate_unorm8(angle / HMM_PI32);
+    }
+}
+
+// Core functions, bytes rounded as gaussian.c does
+static void encode_core(const HMM_Quat *rotations, uint32_t count, uint8_t *out)
+{
+    for (uint32_t i = 0; i < count; i++)
+    {
+        HMM_Vec3 axis;
+        float angle;
+        quat_to_axis_angle(positive_w(rotations[i]), &axis, &angle);
+        HMM_Vec2 oct = octahedral_encode(axis);
+        out[i * 3 + 0] = round_unorm8f(oct.X);
+        out[i * 3 + 1] = round_unorm8f(oct.Y);
+        out[i * 3 + 2] = round_unorm8f(angle / HMM_PI32);
+    }
+}
+
+// The octahedral map only needs the direction of x, y, z: no axis normalize and no sin(angle / 2),
+// one sqrt and two divisions per splat. Returns w / |q| for the angle.
+static inline float fused_octahedral(HMM_Quat q, float *out_u, float *out_v)
+{
+    q = positive_w(q);
+    float l1 = fabsf(q.X) + fabsf(q.Y) + fabsf(q.Z);
+    float inv_l1 = l1 > 0.0f ? 1.0f / l1 : 0.0f;
+    float x = l1 > 0.0f ? q.X * inv_l1 : 1.0f;
+    float y = q.Y * inv_l1;
+    if (q.Z < 0.0f)
+    {
+        float fx = (1.0f - fabsf(y)) * (x >= 0.0f ? 1.0f : -1.0f);
+        float fy = (1.0f - fabsf(x)) * (y >= 0.0f ? 1.0f : -1.0f);
+        x = fx;
+        y = fy;
+    }
+    *out_u = x * 0.5f + 0.5f;
+    *out_v = y * 0.5f + 0.5f;
+    return fminf(q.W / sqrtf(q.X * q.X + q.Y * q.Y + q.Z * q.Z + q.W * q.W), 1.0f);
+}
+
+static void encode_fused(const HMM_Quat *rotations, uint32_t count, uint8_t *out)
+{
+    for (uint32_t i = 0; i < count; i++)
+    {
+        float u, v;
+        float w = fused_octahedral(rotations[i], &u, &v);
+        out[i * 3 + 0] = round_unorm8f(u);
+        out[i * 3 + 1] = round_unorm8f(v);
+        out[i * 3 + 2] = round_unorm8f(2.0f * acosf(w) / HMM_PI32);
+    }
+}
+
+static void encode_fused_poly4(const HMM_Quat *rotations, uint32_t count, uint8_t *out)
+{
+    for (uint32_t i = 0; i < count; i++)
+    {
+        float u, v;
+        float w = fused_octahedral(rotations[i], &u, &v);
+        out[i * 3 + 0] = round_unorm8f(u);
+        out[i * 3 + 1] = round_unorm8f(v);
+        out[i * 3 + 2] = round_unorm8f(2.0f * acos_poly4(w) / HMM_PI32);
+    }
+}
+
+static void encode_fused_lut(const HMM_Quat *rotations, uint32_t count, uint8_t *out)
+{
+    for (uint32_t i = 0; i < count; i++)
+    {
+        float u, v;
+        float w = fused_octahedral(rotations[i], &u, &v);
+        out[i * 3 + 0] = round_unorm8f(u);
+        out[i * 3 + 1] = round_unorm8f(v);
+        out[i * 3 + 2] = angle_byte_lut(w);
+    }
+}
+
+// Of the four codes around u, v keep the one whose decoded axis lies closest to the true one;
+// rounding each coordinate on its own is not the nearest code on the sphere
+static void encode_fused_lut_best(const HMM_Quat *rotations, uint32_t count, uint8_t *out)
+{
+    const float inv_255 = 1.0f / 255.0f;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        float u, v;
+        HMM_Quat q = positive_w(rotations[i]);
+        float w = fused_octahedral(q, &u, &v);
+        float fu = floorf(fminf(fmaxf(u, 0.0f), 1.0f) * 255.0f);
+        float fv = floorf(fminf(fmaxf(v, 0.0f), 1.0f) * 255.0f);
+
+        // Unnormalized x, y, z is fine, only the order of the dot products matters
+        float best_dot = -FLT_MAX;
+        uint8_t best[2] = {0, 0};
+        for (int c = 0; c < 4; c++)
+        {
+            float cu = fminf(fu + (float)(c & 1), 255.0f);
+            float cv = fminf(fv + (float)(c >> 1), 255.0f);
+            HMM_Vec3 axis = octahedral_decode(HMM_V2(cu * inv_255, cv * inv_255));
+            float dot = axis.X * q.X + axis.Y * q.Y + axis.Z * q.Z;
+            if (dot > best_dot)
+            {
+                best_dot = dot;
+                best[0] = (uint8_t)cu;
+                best[1] = (uint8_t)cv;
+            }
+        }
+        out[i * 3 + 0] = best[0];
+        out[i * 3 + 1] = best[1];
+        out[i * 3 + 2] = angle_byte_lut(w);
+    }
+}
+
+typedef struct
+{
+    const char *name;
+    encode_fn encode;
+} bench_encoder_t;
+
+// ---------------------------------------------------------------------------------------------------------
+// Functions: float results against the reference
+
+typedef enum
+{
+    FUNCTION_AXIS_ANGLE,
+    FUNCTION_OCTAHEDRAL,
+    FUNCTION_ACOSF,
+    FUNCTION_ACOS_POLY4,
+    FUNCTION_ACOS_POLY8,
+    FUNCTION_COUNT
+} bench_function_t;
+
+static const char *function_names[FUNCTION_COUNT] = {"quat_to_axis_angle", "octahedral_encode", "acosf",
+                                                     "acos poly4", "acos poly8"};
+
+// w / |q| >= 0 of splat i, the input of the acos rows
+static inline float unit_w(const bench_data_t *data, uint32_t i)
+{
+    return (float)cos(0.5 * data->references[i].angle);
+}
+
+static void run_function(bench_function_t function, bench_data_t *data)
+{
+    float *r = data->results;
+    for (uint32_t i = 0; i < data->count; i++)
+    {
+        switch (function)
+        {
+        case FUNCTION_AXIS_ANGLE:
+        {
+            HMM_Vec3 axis;
+            quat_to_axis_angle(positive_w(data->rotations[i]), &axis, &r[i * 4 + 3]);
+            r[i * 4 + 0] = axis.X;
+            r[i * 4 + 1] = axis.Y;
+            r[i * 4 + 2] = axis.Z;
+            break;
+        }
+        case FUNCTION_OCTAHEDRAL:
+        {
+            const double *axis = data->references[i].axis;
+            HMM_Vec2 oct = octahedral_encode(HMM_V3((float)axis[0], (float)axis[1], (float)axis[2]));
+            r[i * 4 + 0] = oct.X;
+            r[i * 4 + 1] = oct.Y;
+            break;
+        }
+        case FUNCTION_ACOSF:
+            r[i * 4] = acosf(unit_w(data, i));
+            break;
+        case FUNCTION_ACOS_POLY4:
+            r[i * 4] = acos_poly4(unit_w(data, i));
+            break;
+        case FUNCTION_ACOS_POLY8:
+            r[i * 4] = acos_poly8(unit_w(data, i));
+            break;
+        case FUNCTION_COUNT:
+            break;
+        }
+    }
+}
+
+// Largest error of the last run: radians for angles and acos, octahedral units (0-1) for octahedral_encode.
+// axis_error gets the largest axis error of quat_to_axis_angle in degrees.
+static double function_error(bench_function_t function, const bench_data_t *data, double *axis_error)
+{
+    double max_error = 0.0;
+    *axis_error = 0.0;
+    const float *r = data->results;
+    for (uint32_t i = 0; i < data->count; i++)
+    {
+        const reference_t *ref = &data->references[i];
+        double e = 0.0;
+        switch (function)
+        {
+        case FUNCTION_AXIS_ANGLE:
+            e = fabs(r[i * 4 + 3] - ref->angle);
+            if (ref->angle >= AXIS_MIN_ANGLE)
+            {
+                double dot = r[i * 4] * ref->axis[0] + r[i * 4 + 1] * ref->axis[1] + r[i * 4 + 2] * ref->axis[2];
+                double degrees = acos(fmin(dot, 1.0)) * 180.0 / HMM_PI;
+                *axis_error = fmax(*axis_error, degrees);
+            }
+            break;
+        case FUNCTION_OCTAHEDRAL:
+            e = fmax(fabs(r[i * 4] - ref->u), fabs(r[i * 4 + 1] - ref->v));
+            break;
+        default:
+            // acos of the float w the function saw, so only the function's own error counts
+            e = fabs(r[i * 4] - acos((double)unit_w(data, i)));
+            break;
+        }
+        max_error = fmax(max_error, e);
+    }
+    return max_error;
+}
+
+// ---------------------------------------------------------------------------------------------------------
+// Inputs
+
+static uint64_t next_random(uint64_t *state)
+{
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+    return *state * 2685821657736338717ull;
+}
+
+static double random_unit(uint64_t *state)
+{
+    return (double)(next_random(state) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+static HMM_Quat edge_case(uint32_t i)
+{
+    const float h = 0.70710678f;
+    static const HMM_Quat fixed[] = {
+        {0.0f, 0.0f, 0.0f, 1.0f},   // identity
+        {0.0f, 0.0f, 0.0f, -1.0f},  // identity, negative w
+        {1.0f, 0.0f, 0.0f, 0.0f},   // half turns about the coordinate axes
+        {0.0f, 1.0f, 0.0f, 0.0f},
+        {0.0f, 0.0f, 1.0f, 0.0f},
+        {0.0f, 0.0f, -1.0f, 0.0f},
+        {-1.0f, 0.0f, 0.0f, 0.0f},
+        {0.0f, -1.0f, 0.0f, 0.0f},
+        {h, h, 0.0f, 0.0f},         // octahedron edges, z = 0
+        {-h, h, 0.0f, 0.0f},
+        {h, -h, 0.0f, 0.0f},
+        {-h, -h, 0.0f, 0.0f},
+        {h, 0.0f, 0.0f, h},         // quarter turns
+        {0.0f, h, 0.0f, h},
+        {0.0f, 0.0f, -h, h},
+        {0.5f, 0.5f, 0.5f, 0.5f},
+        {-0.5f, 0.5f, -0.5f, 0.5f},
+    };
+    const uint32_t fixed_count = sizeof(fixed) / sizeof(fixed[0]);
+    if (i < fixed_count)
+    {
+        return fixed[i];
+    }
+
+    // Tiny angles about a tilted axis, 1e-6 rad up to a few byte steps
+    float angle = 1e-6f * powf(10.0f, 5.0f * (float)(i - fixed_count) / (float)(EDGE_CASES - fixed_count));
+    return axis_angle_to_quat(HMM_NormV3(HMM_V3(0.3f, -0.5f, 0.8f)), angle);
+}
+
+static void generate_rotations(HMM_Quat *rotations, uint32_t count, uint32_t seed)
+{
+    uint64_t state = 0x9E3779B97F4A7C15ull ^ ((uint64_t)seed * 0xBF58476D1CE4E5B9ull);
+    for (uint32_t i = 0; i < count; i++)
+    {
+        if (i < EDGE_CASES)
+        {
+            rotations[i] = edge_case(i);
+            continue;
+        }
+
+        // Shoemake's uniform rotation, both signs, length 0.98-1.02
+        double u1 = random_unit(&state);
+        double u2 = 2.0 * HMM_PI * random_unit(&state);
+        double u3 = 2.0 * HMM_PI * random_unit(&state);
+        double length = 0.98 + 0.04 * random_unit(&state);
+        double a = sqrt(1.0 - u1) * length;
+        double b = sqrt(u1) * length;
+        rotations[i] = HMM_Q((float)(a * sin(u2)), (float)(a * cos(u2)), (float)(b * sin(u3)), (float)(b * cos(u3)));
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------
+
+static int compare_double(const void *a, const void *b)
+{
+    double da = *(const double *)a;
+    double db = *(const double *)b;
+    return (da > db) - (da < db);
+}
+
+// Nanoseconds per splat, median of the timed runs after one untimed warm-up
+static double median_ns(double *times, int runs, uint32_t count)
+{
+    qsort(times, (size_t)runs, sizeof(double), compare_double);
+    return times[runs / 2] * 1e6 / count;
+}
+
+static double time_function(bench_function_t function, bench_data_t *data, double *times, int runs)
+{
+    run_function(function, data);
+    for (int r = 0; r < runs; r++)
+    {
+        double start = time_now_ms();
+        run_function(function, data);
+        times[r] = time_now_ms() - start;
+    }
+    return median_ns(times, runs, data->count);
+}
+
+static double time_encoder(encode_fn encode, bench_data_t *data, double *times, int runs)
+{
+    encode(data->rotations, data->count, data->bytes);
+    for (int r = 0; r < runs; r++)
+    {
+        double start = time_now_ms();
+        encode(data->rotations, data->count, data->bytes);
+        times[r] = time_now_ms() - start;
+    }
+    return median_ns(times, runs, data->count);
+}
+
+int main(int argc, char **argv)
+{
+    bench_args_t args;
+    if (parse_args(argc, argv, &args) != 0)
+    {
+        print_usage();
+        return 1;
+    }
+
+    HMM_Quat *rotations = (HMM_Quat *)malloc((size_t)args.count * sizeof(HMM_Quat));
+    reference_t *references = (reference_t *)malloc((size_t)args.count * sizeof(reference_t));
+    bench_data_t data = {
+        .count = args.count,
+        .rotations = rotations,
+        .references = references,
+        .results = (float *)malloc((size_t)args.count * 4 * sizeof(float)),
+        .bytes = (uint8_t *)malloc((size_t)args.count * 3)};
+    double *times = (double *)malloc((size_t)args.runs * sizeof(double));
+    if (!rotations || !references || !data.results || !data.bytes || !times)
+    {
+        fprintf(stderr, "Failed to allocate %u rotations\n", args.count);
+        return 1;
+    }
+
+    init_angle_thresholds();
+    generate_rotations(rotations, args.count, args.seed);
+    for (uint32_t i = 0; i < args.count; i++)
+    {
+        references[i] = reference_encode(rotations[i]);
+    }
+
+    printf("%u rotations (%d edge cases), median of %d runs\n\n", args.count, EDGE_CASES, args.runs);
+    printf("%-20s %10s %14s %14s\n", "function", "ns/call", "max error", "axis max deg");
+    for (int f = 0; f < FUNCTION_COUNT; f++)
+    {
+        double ns = time_function((bench_function_t)f, &data, times, args.runs);
+        double axis_error;
+        double max_error = function_error((bench_function_t)f, &data, &axis_error);
+        printf("%-20s %10.2f %14.3g ", function_names[f], ns, max_error);
+        if (f == FUNCTION_AXIS_ANGLE)
+            printf("%14.3g\n", axis_error);
+        else
+            printf("%14s\n", "-");
+    }
+
+    const bench_encoder_t encoders[] = {
+        {"loader (truncate)", encode_loader},
+        {"core (round)", encode_core},
+        {"fused", encode_fused},
+        {"fused poly4", encode_fused_poly4},
+        {"fused lut", encode_fused_lut},
+        {"fused lut best-of-4", encode_fused_lut_best},
+    };
+
+    // The reference bytes themselves, the floor every encoder is held to
+    double floor_max = 0.0, floor_sum = 0.0;
+    for (uint32_t i = 0; i < args.count; i++)
+    {
+        double e = rotation_error(rotations[i], references[i].bytes);
+        floor_max = fmax(floor_max, e);
+        floor_sum += e;
+    }
+
+    printf("\n%-20s %10s %12s %12s %10s %10s\n", "encoder", "ns/splat", "axis bytes", "angle bytes", "max deg",
+           "mean deg");
+    printf("%-20s %10s %12s %12s %10.3f %10.4f\n", "reference (double)", "-", "-", "-", floor_max,
+           floor_sum / args.count);
+    for (size_t e = 0; e < sizeof(encoders) / sizeof(encoders[0]); e++)
+    {
+        double ns = time_encoder(encoders[e].encode, &data, times, args.runs);
+
+        uint32_t axis_mismatches = 0, angle_mismatches = 0;
+        int axis_steps = 0, angle_steps = 0;
+        double max_degrees = 0.0, sum_degrees = 0.0;
+        for (uint32_t i = 0; i < args.count; i++)
+        {
+            const uint8_t *bytes = &data.bytes[i * 3];
+            const reference_t *ref = &references[i];
+            int angle_diff = abs((int)bytes[2] - ref->bytes[2]);
+            angle_mismatches += angle_diff != 0;
+            angle_steps = angle_diff > angle_steps ? angle_diff : angle_steps;
+            if (ref->angle >= AXIS_MIN_ANGLE)
+            {
+                int axis_diff = abs((int)bytes[0] - ref->bytes[0]);
+                int v_diff = abs((int)bytes[1] - ref->bytes[1]);
+                axis_diff = v_diff > axis_diff ? v_diff : axis_diff;
+                axis_mismatches += axis_diff != 0;
+                axis_steps = axis_diff > axis_steps ? axis_diff : axis_steps;
+            }
+            double degrees = rotation_error(rotations[i], bytes);
+            max_degrees = fmax(max_degrees, degrees);
+            sum_degrees += degrees;
+        }
+        printf("%-20s %10.2f %7u (%d) %7u (%d) %10.3f %10.4f\n", encoders[e].name, ns, axis_mismatches, axis_steps,
+               angle_mismatches, angle_steps, max_degrees, sum_degrees / args.count);
+    }
+    printf("\nbytes: splats differing from the rounded reference (largest difference in steps)\n");
+
+    free(rotations);
+    free(references);
+    free(data.results);
+    free(data.bytes);
+    free(times);
+    return 0;
+}
@@ -0,0 +1,5 @@
+// sokol_gfx implementation for the command line tools; they render on the CPU and
+// only need the symbols referenced by splat_texture.c to link
+#define SOKOL_IMPL
+#define SOKOL_DUMMY_BACKEND
+#include "sokol/sokol_gfx.h"
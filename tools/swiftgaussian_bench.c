@@ -0,0 +1,510 @@
+// Headless throughput of the CPU stages of a load and of a CPU-rendered frame, on a synthetic scene
+//
+// usage: swiftgaussian_bench [--count N] [--version 2|3] [--sh D] [--threads T] [--runs R] [--size WxH]
+//                            [--seed S] [--json out.json] [--write out.spz]
+//
+// The scene comes from tool_synthetic_spz and is gzip-compressed in memory, so every size from 100K to
+// 20M splats is measured the same way without files. Each stage is the median of R runs after a warm-up:
+//   inflate  spz_inflate of the compressed scene
+//   parse    parse_spz_data_to_splats, stream order
+//   load     parse_spz_data_to_splats_with_options with the scene defaults (opacity pruning, spatial order)
+//   convert  convert_splats_to_texture_data, the texels the CPU renderer reads and the GPU upload copies
+//   sort     cpu_render_splats setup, binning and per-tile depth sort
+//   raster   cpu_render_splats blending
+//   frame    the whole cpu_render_splats call
+// Peak is the most core memory (core_memory_stats) a stage held above what was live before it.
+// The loader logs to stdout, so the machine-readable results go to the --json file.
+#include "tool_common.h"
+#include "loader/spzfile.h"
+#include "utils/core_memory.h"
+#include "utils/jobs.h"
+#include "utils/timer.h"
+#include "visibility.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <zlib.h>
+
+typedef struct
+{
+    tool_synthetic_params_t scene;
+    uint32_t threads; // 0 leaves the job system at its default
+    int runs;
+    int width;
+    int height;
+    const char *json_path;
+    const char *write_path;
+} bench_args_t;
+
+typedef enum
+{
+    BENCH_INFLATE,
+    BENCH_PARSE,
+    BENCH_LOAD,
+    BENCH_CONVERT,
+    BENCH_SORT,
+    BENCH_RASTER,
+    BENCH_FRAME,
+    BENCH_STAGE_COUNT
+} bench_stage_t;
+
+static const char *stage_names[BENCH_STAGE_COUNT] = {"inflate", "parse", "load", "convert", "sort", "raster",
+                                                     "frame"};
+
+typedef struct
+{
+    double *ms; // one per run
+    double median_ms;
+    double min_ms;
+    uint64_t items; // splats the stage went through
+    uint64_t bytes; // bytes it read or wrote, 0 where a rate in MB/s means nothing
+    size_t peak_bytes;
+} bench_result_t;
+
+typedef struct
+{
+    bench_args_t args;
+    uint8_t *compressed;
+    size_t compressed_size;
+    size_t spz_size;
+
+    // Outputs of the last run of each stage, inputs of the next stages
+    uint8_t *spz;
+    PackedSplat *splats;
+    splat_chunk_t *chunks;
+    uint32_t splat_count;
+    BoundingBox bounds;
+    uint32_t load_count;
+    uint32_t *texels;
+    Camera *camera;
+    uint8_t *rgba;
+    cpu_render_stats_t render;
+
+    bench_result_t results[BENCH_STAGE_COUNT];
+} bench_t;
+
+static void print_usage(void)
+{
+    printf("usage: swiftgaussian_bench [--count N] [--version 2|3] [--sh D] [--threads T] [--runs R] [--size WxH]\n"
+           "                           [--seed S] [--json out.json] [--write out.spz]\n");
+}
+
+static int parse_args(int argc, char **argv, bench_args_t *args)
+{
+    *args = (bench_args_t){
+        .scene = {.count = 1000000, .version = 3, .sh_degree = 0, .seed = 1},
+        .runs = 5,
+        .width = 1280,
+        .height = 720};
+
+    for (int i = 1; i < argc; i++)
+    {
+        const char *arg = argv[i];
+        const char *value = i + 1 < argc ? argv[i + 1] : NULL;
+        if (!value)
+        {
+            return -1;
+        }
+        if (strcmp(arg, "--count") == 0)
+            args->scene.count = (uint32_t)strtoul(value, NULL, 10);
+        else if (strcmp(arg, "--version") == 0)
+            args->scene.version = (uint32_t)atoi(value);
+        else if (strcmp(arg, "--sh") == 0)
+            args->scene.sh_degree = (uint32_t)atoi(value);
+        else if (strcmp(arg, "--seed") == 0)
+            args->scene.seed = (uint32_t)strtoul(value, NULL, 10);
+        else if (strcmp(arg, "--threads") == 0)
+            args->threads = (uint32_t)atoi(value);
+        else if (strcmp(arg, "--runs") == 0)
+            args->runs = atoi(value);
+        else if (strcmp(arg, "--size") == 0)
+        {
+            if (sscanf(value, "%dx%d", &args->width, &args->height) != 2)
+                return -1;
+        }
+        else if (strcmp(arg, "--json") == 0)
+            args->json_path = value;
+        else if (strcmp(arg, "--write") == 0)
+            args->write_path = value;
+        else
+            return -1;
+        i++;
+    }
+    return (args->scene.count > 0 && (args->scene.version == 2 || args->scene.version == 3) &&
+            args->scene.sh_degree <= 3 && args->threads <= JOB_MAX_THREADS && args->runs > 0 &&
+            args->width > 0 && args->height > 0)
+               ? 0
+               : -1;
+}
+
+// gzip as the .spz files on disk, at the default level: inflate speed hardly depends on it and level 9
+// would take minutes on the largest scenes
+static int compress_spz(const uint8_t *data, size_t size, uint8_t **out_data, size_t *out_size)
+{
+    z_stream stream = {0};
+    if (deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 16 + MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+    {
+        return -1;
+    }
+    size_t capacity = deflateBound(&stream, (uLong)size);
+    uint8_t *compressed = (uint8_t *)malloc(capacity);
+    if (!compressed)
+    {
+        deflateEnd(&stream);
+        return -1;
+    }
+
+    // avail_in and avail_out are 32-bit, feed the stream in pieces
+    const size_t piece = 1u << 30;
+    size_t consumed = 0;
+    int status = Z_OK;
+    stream.next_out = compressed;
+    while (status == Z_OK)
+    {
+        size_t in = size - consumed < piece ? size - consumed : piece;
+        size_t room = capacity - stream.total_out < piece ? capacity - stream.total_out : piece;
+        stream.next_in = (Bytef *)(data + consumed);
+        stream.avail_in = (uInt)in;
+        stream.avail_out = (uInt)room;
+        status = deflate(&stream, consumed + in == size ? Z_FINISH : Z_NO_FLUSH);
+        consumed += in - stream.avail_in;
+    }
+    *out_size = stream.total_out;
+    deflateEnd(&stream);
+    if (status != Z_STREAM_END)
+    {
+        free(compressed);
+        return -1;
+    }
+    *out_data = compressed;
+    return 0;
+}
+
+// Memory held before a stage starts, the peak is measured from there
+static size_t begin_peak(void)
+{
+    core_memory_reset_peaks();
+    return core_memory_stats().cpu_total.current;
+}
+
+static void end_peak(bench_result_t *result, size_t base)
+{
+    size_t peak = core_memory_stats().cpu_total.peak - base;
+    result->peak_bytes = peak > result->peak_bytes ? peak : result->peak_bytes;
+}
+
+static int run_inflate(bench_t *bench, int run)
+{
+    core_free(bench->spz);
+    bench->spz = NULL;
+
+    bench_result_t *result = &bench->results[BENCH_INFLATE];
+    size_t base = begin_peak();
+    double start = time_now_ms();
+    int status = spz_inflate(bench->compressed, bench->compressed_size, &bench->spz, &bench->spz_size, NULL, NULL);
+    double ms = time_now_ms() - start;
+    end_peak(result, base);
+    if (run >= 0)
+    {
+        result->ms[run] = ms;
+    }
+    result->items = bench->args.scene.count;
+    result->bytes = bench->spz_size;
+    return status;
+}
+
+static int run_parse(bench_t *bench, int run)
+{
+    core_free(bench->splats);
+    core_free(bench->chunks);
+    bench->splats = NULL;
+    bench->chunks = NULL;
+
+    bench_result_t *result = &bench->results[BENCH_PARSE];
+    size_t base = begin_peak();
+    double start = time_now_ms();
+    int status = parse_spz_data_to_splats(bench->spz, bench->spz_size, &bench->splats, &bench->splat_count,
+                                          &bench->bounds, &bench->chunks);
+    double ms = time_now_ms() - start;
+    end_peak(result, base);
+    if (run >= 0)
+    {
+        result->ms[run] = ms;
+    }
+    result->items = bench->args.scene.count;
+    result->bytes = bench->spz_size;
+    return status;
+}
+
+// The parse a scene load runs; its splats are dropped, the renderer stages keep the stream order
+static int run_load(bench_t *bench, int run)
+{
+    const spz_load_options_t options = {.prune.min_opacity = SPZ_DEFAULT_MIN_OPACITY, .spatial_order = true};
+    PackedSplat *splats = NULL;
+    splat_chunk_t *chunks = NULL;
+    BoundingBox bounds;
+
+    bench_result_t *result = &bench->results[BENCH_LOAD];
+    size_t base = begin_peak();
+    double start = time_now_ms();
+    int status = parse_spz_data_to_splats_with_options(bench->spz, bench->spz_size, &options, &splats,
+                                                       &bench->load_count, &bounds, &chunks, NULL);
+    double ms = time_now_ms() - start;
+    end_peak(result, base);
+    core_free(splats);
+    core_free(chunks);
+    if (run >= 0)
+    {
+        result->ms[run] = ms;
+    }
+    result->items = bench->args.scene.count;
+    result->bytes = bench->spz_size;
+    return status;
+}
+
+static int run_convert(bench_t *bench, int run)
+{
+    core_free(bench->texels);
+
+    bench_result_t *result = &bench->results[BENCH_CONVERT];
+    size_t base = begin_peak();
+    double start = time_now_ms();
+    bench->texels = convert_splats_to_texture_data(bench->splats, bench->splat_count, SPLAT_LAYOUT_AXIS_ANGLE,
+                                                   (int)bench->splat_count, 1, 1);
+    double ms = time_now_ms() - start;
+    end_peak(result, base);
+    if (run >= 0)
+    {
+        result->ms[run] = ms;
+    }
+    result->items = bench->splat_count;
+    result->bytes = (uint64_t)bench->splat_count * 4 * sizeof(uint32_t);
+    return bench->texels ? 0 : -1;
+}
+
+static int run_render(bench_t *bench, int run)
+{
+    const cpu_splat_source_t source = {
+        .texels = bench->texels,
+        .splat_count = bench->splat_count,
+        .chunks = bench->chunks};
+
+    size_t base = begin_peak();
+    int status = cpu_render_splats(&source, bench->camera, bench->args.width, bench->args.height, bench->rgba,
+                                   &bench->render);
+    for (int stage = BENCH_SORT; stage <= BENCH_FRAME; stage++)
+    {
+        bench_result_t *result = &bench->results[stage];
+        end_peak(result, base);
+        result->items = bench->render.splats_in;
+        result->bytes = 0;
+    }
+    if (run >= 0)
+    {
+        bench->results[BENCH_SORT].ms[run] = bench->render.setup_ms + bench->render.bin_ms + bench->render.sort_ms;
+        bench->results[BENCH_RASTER].ms[run] = bench->render.blend_ms;
+        bench->results[BENCH_FRAME].ms[run] = bench->render.total_ms;
+    }
+    return status;
+}
+
+static int compare_double(const void *a, const void *b)
+{
+    double da = *(const double *)a;
+    double db = *(const double *)b;
+    return (da > db) - (da < db);
+}
+
+// One untimed warm-up, then the timed runs
+static int measure(bench_t *bench, int (*run_fn)(bench_t *bench, int run))
+{
+    for (int run = -1; run < bench->args.runs; run++)
+    {
+        if (run_fn(bench, run) != 0)
+        {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static void summarize(bench_result_t *result, int runs)
+{
+    qsort(result->ms, (size_t)runs, sizeof(double), compare_double);
+    result->median_ms = result->ms[runs / 2];
+    result->min_ms = result->ms[0];
+}
+
+static double per_second(uint64_t amount, double ms)
+{
+    return ms > 0.0 ? (double)amount * 1000.0 / ms : 0.0;
+}
+
+static long peak_rss_kb(void)
+{
+    struct rusage usage;
+    return getrusage(RUSAGE_SELF, &usage) == 0 ? usage.ru_maxrss : 0;
+}
+
+static int write_json(const bench_t *bench, const char *path)
+{
+    FILE *file = fopen(path, "w");
+    if (!file)
+    {
+        fprintf(stderr, "Failed to create %s\n", path);
+        return -1;
+    }
+
+    const bench_args_t *args = &bench->args;
+    fprintf(file, "{\n  \"scene\": {\"splats\": %u, \"version\": %u, \"sh_degree\": %u, \"seed\": %u, "
+                  "\"stream_bytes\": %zu, \"compressed_bytes\": %zu, \"loaded_splats\": %u},\n",
+            args->scene.count, args->scene.version, args->scene.sh_degree, args->scene.seed, bench->spz_size,
+            bench->compressed_size, bench->load_count);
+    fprintf(file, "  \"config\": {\"threads\": %u, \"runs\": %d, \"width\": %d, \"height\": %d},\n",
+            job_thread_count(), args->runs, args->width, args->height);
+    fprintf(file, "  \"render\": {\"splats_visible\": %u, \"tile_entries\": %llu, \"chunks_culled\": %u},\n",
+            bench->render.splats_visible, (unsigned long long)bench->render.tile_entries, bench->render.chunks_culled);
+    fprintf(file, "  \"stages\": {");
+    for (int stage = 0; stage < BENCH_STAGE_COUNT; stage++)
+    {
+        const bench_result_t *result = &bench->results[stage];
+        fprintf(file, "%s\n    \"%s\": {\"median_ms\": %.3f, \"min_ms\": %.3f, \"splats_per_second\": %.0f, ",
+                stage > 0 ? "," : "", stage_names[stage], result->median_ms, result->min_ms,
+                per_second(result->items, result->median_ms));
+        if (result->bytes > 0)
+            fprintf(file, "\"mb_per_second\": %.1f, ", per_second(result->bytes, result->median_ms) / 1e6);
+        else
+            fprintf(file, "\"mb_per_second\": null, ");
+        fprintf(file, "\"peak_bytes\": %zu}", result->peak_bytes);
+    }
+    fprintf(file, "\n  },\n  \"peak_rss_bytes\": %lld\n}\n", (long long)peak_rss_kb() * 1024);
+
+    bool written = !ferror(file);
+    written = fclose(file) == 0 && written;
+    if (!written)
+    {
+        fprintf(stderr, "Failed to write %s\n", path);
+    }
+    return written ? 0 : -1;
+}
+
+static void print_results(const bench_t *bench)
+{
+    const bench_args_t *args = &bench->args;
+    printf("\n%u splats, SPZ version %u, SH degree %u: %.1f MB stream, %.1f MB compressed; %u kept by the load\n",
+           args->scene.count, args->scene.version, args->scene.sh_degree, bench->spz_size / 1e6,
+           bench->compressed_size / 1e6, bench->load_count);
+    printf("%u threads, %dx%d frame, median of %d runs\n", job_thread_count(), args->width, args->height, args->runs);
+    printf("%-8s %10s %10s %12s %10s %10s\n", "stage", "median ms", "min ms", "Msplats/s", "MB/s", "peak MB");
+    for (int stage = 0; stage < BENCH_STAGE_COUNT; stage++)
+    {
+        const bench_result_t *result = &bench->results[stage];
+        printf("%-8s %10.2f %10.2f %12.2f ", stage_names[stage], result->median_ms, result->min_ms,
+               per_second(result->items, result->median_ms) / 1e6);
+        if (result->bytes > 0)
+            printf("%10.0f ", per_second(result->bytes, result->median_ms) / 1e6);
+        else
+            printf("%10s ", "-");
+        printf("%10.1f\n", result->peak_bytes / 1e6);
+    }
+    printf("peak RSS %.1f MB\n", peak_rss_kb() / 1024.0);
+}
+
+static void bench_free(bench_t *bench)
+{
+    free(bench->compressed);
+    core_free(bench->spz);
+    core_free(bench->splats);
+    core_free(bench->chunks);
+    core_free(bench->texels);
+    camera_destroy(bench->camera);
+    free(bench->rgba);
+    for (int stage = 0; stage < BENCH_STAGE_COUNT; stage++)
+    {
+        free(bench->results[stage].ms);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    bench_t bench = {0};
+    if (parse_args(argc, argv, &bench.args) != 0)
+    {
+        print_usage();
+        return 1;
+    }
+    const bench_args_t *args = &bench.args;
+    if (args->threads > 0)
+    {
+        job_system_init(args->threads - 1);
+    }
+
+    // The scene, compressed, is the only input left once it is generated
+    uint8_t *spz = NULL;
+    double start = time_now_ms();
+    if (tool_synthetic_spz(&args->scene, &spz, &bench.spz_size) != 0)
+    {
+        fprintf(stderr, "Failed to generate %u synthetic splats\n", args->scene.count);
+        return 1;
+    }
+    double generate_ms = time_now_ms() - start;
+    start = time_now_ms();
+    int status = compress_spz(spz, bench.spz_size, &bench.compressed, &bench.compressed_size);
+    printf("Generated %u splats in %.0f ms, compressed in %.0f ms\n", args->scene.count, generate_ms,
+           time_now_ms() - start);
+    if (status == 0 && args->write_path)
+    {
+        status = spz_write_file(args->write_path, spz, bench.spz_size);
+    }
+    core_free(spz);
+    if (status != 0)
+    {
+        fprintf(stderr, "Failed to compress the synthetic scene\n");
+        bench_free(&bench);
+        return 1;
+    }
+
+    for (int stage = 0; stage < BENCH_STAGE_COUNT; stage++)
+    {
+        bench.results[stage].ms = (double *)calloc((size_t)args->runs, sizeof(double));
+    }
+    bench.camera = camera_create();
+    bench.rgba = (uint8_t *)malloc((size_t)args->width * args->height * 4);
+    if (!bench.camera || !bench.rgba || !bench.results[BENCH_STAGE_COUNT - 1].ms)
+    {
+        bench_free(&bench);
+        return 1;
+    }
+
+    // One orbit pose, far enough out that the whole sphere is in view
+    visibility_pose_params_t pose = {.radius_min = 2.5f * TOOL_SYNTHETIC_RADIUS,
+                                     .radius_max = 2.5f * TOOL_SYNTHETIC_RADIUS};
+    Camera camera;
+    visibility_sample_poses(bench.camera, &pose, 1, &camera);
+    *bench.camera = camera;
+
+    int result = 0;
+    if (measure(&bench, run_inflate) != 0 || measure(&bench, run_parse) != 0 || measure(&bench, run_load) != 0 ||
+        measure(&bench, run_convert) != 0 || measure(&bench, run_render) != 0)
+    {
+        fprintf(stderr, "Benchmark failed\n");
+        result = 1;
+    }
+    else
+    {
+        for (int stage = 0; stage < BENCH_STAGE_COUNT; stage++)
+        {
+            summarize(&bench.results[stage], args->runs);
+        }
+        print_results(&bench);
+        if (args->json_path && write_json(&bench, args->json_path) != 0)
+        {
+            result = 1;
+        }
+    }
+
+    bench_free(&bench);
+    job_system_shutdown();
+    return result;
+}
@@ -0,0 +1,204 @@
+#include "tool_common.h"
+#include "loader/spzfile.h"
+#include "utils/core_memory.h"
+#include "splat_texture.h"
+#include "utils/quaternion.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+int tool_scene_from_spz(uint8_t *spz, size_t spz_size, tool_scene_t *out_scene)
+{
+    memset(out_scene, 0, sizeof(*out_scene));
+    out_scene->spz = spz;
+    out_scene->spz_size = spz_size;
+
+    if (parse_spz_data_to_splats(spz, spz_size, &out_scene->splats, &out_scene->splat_count,
+                                 &out_scene->bounds, &out_scene->chunks) != 0)
+    {
+        tool_scene_free(out_scene);
+        return -1;
+    }
+
+    out_scene->texels = convert_splats_to_texture_data(out_scene->splats, out_scene->splat_count,
+                                                       SPLAT_LAYOUT_AXIS_ANGLE, (int)out_scene->splat_count, 1, 1);
+    if (!out_scene->texels)
+    {
+        tool_scene_free(out_scene);
+        return -1;
+    }
+    return 0;
+}
+
+int tool_scene_load(const char *path, tool_scene_t *out_scene)
+{
+    uint8_t *spz = NULL;
+    size_t spz_size = 0;
+    if (spz_read_file(path, &spz, &spz_size) != 0)
+    {
+        return -1;
+    }
+    return tool_scene_from_spz(spz, spz_size, out_scene);
+}
+
+void tool_scene_free(tool_scene_t *scene)
+{
+    core_free(scene->spz);
+    core_free(scene->splats);
+    core_free(scene->texels);
+    core_free(scene->chunks);
+    memset(scene, 0, sizeof(*scene));
+}
+
+cpu_splat_source_t tool_scene_source(const tool_scene_t *scene)
+{
+    return (cpu_splat_source_t){
+        .texels = scene->texels,
+        .splat_count = scene->splat_count,
+        .chunks = scene->chunks};
+}
+
+// xorshift64*, deterministic for a seed on every platform unlike rand()
+static uint64_t next_random(uint64_t *state)
+{
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+    return *state * 2685821657736338717ull;
+}
+
+// Uniform in [0, 1)
+static float random_unit(uint64_t *state)
+{
+    return (float)(next_random(state) >> 40) * (1.0f / 16777216.0f);
+}
+
+static uint8_t clamp_byte(float value)
+{
+    return (uint8_t)fminf(fmaxf(roundf(value), 0.0f), 255.0f);
+}
+
+int tool_synthetic_spz(const tool_synthetic_params_t *params, uint8_t **out_data, size_t *out_size)
+{
+    static const size_t sh_dims[4] = {0, 3, 8, 15};
+    if (params->count == 0 || (params->version != 2 && params->version != 3) || params->sh_degree > 3)
+    {
+        return -1;
+    }
+
+    const uint32_t n = params->count;
+    const size_t rotation_bytes = params->version == 3 ? 4 : 3;
+    const size_t sh_bytes = sh_dims[params->sh_degree] * 3;
+    const size_t size = sizeof(PackedGaussiansHeader) + (size_t)n * (9 + 1 + 3 + 3 + rotation_bytes + sh_bytes);
+    uint8_t *data = (uint8_t *)core_malloc(MEMORY_TAG_LOAD, size);
+    if (!data)
+    {
+        return -1;
+    }
+
+    const uint8_t fractional_bits = 12;
+    *(PackedGaussiansHeader *)data = (PackedGaussiansHeader){
+        .magic = 0x5053474e,
+        .version = params->version,
+        .numPoints = n,
+        .shDegree = (uint8_t)params->sh_degree,
+        .fractionalBits = fractional_bits};
+    uint8_t *positions = data + sizeof(PackedGaussiansHeader);
+    uint8_t *alphas = positions + (size_t)n * 9;
+    uint8_t *colors = alphas + n;
+    uint8_t *scales = colors + (size_t)n * 3;
+    uint8_t *rotations = scales + (size_t)n * 3;
+    uint8_t *sh = rotations + (size_t)n * rotation_bytes;
+
+    // Spacing of the shell points; splats about half as wide overlap their neighbours a little
+    const float spacing = sqrtf(4.0f * HMM_PI32 / (0.8f * (float)n)) * TOOL_SYNTHETIC_RADIUS;
+    const float log_scale = logf(0.6f * spacing);
+
+    uint64_t state = 0x9E3779B97F4A7C15ull ^ ((uint64_t)params->seed * 0xBF58476D1CE4E5B9ull);
+    for (uint32_t i = 0; i < n; i++)
+    {
+        // Uniform direction from z and longitude; 80% on the shell, the rest uniform in the ball
+        float z = 2.0f * random_unit(&state) - 1.0f;
+        float longitude = 2.0f * HMM_PI32 * random_unit(&state);
+        float ring = sqrtf(fmaxf(0.0f, 1.0f - z * z));
+        float radius = random_unit(&state) < 0.8f ? 1.0f + 0.02f * (random_unit(&state) - 0.5f)
+                                                  : cbrtf(random_unit(&state));
+        float point[3] = {ring * cosf(longitude), ring * sinf(longitude), z};
+        for (int k = 0; k < 3; k++)
+        {
+            int32_t fixed = (int32_t)lroundf(point[k] * radius * TOOL_SYNTHETIC_RADIUS * (float)(1 << fractional_bits));
+            positions[(size_t)i * 9 + k * 3 + 0] = (uint8_t)(fixed & 0xFF);
+            positions[(size_t)i * 9 + k * 3 + 1] = (uint8_t)((fixed >> 8) & 0xFF);
+            positions[(size_t)i * 9 + k * 3 + 2] = (uint8_t)((fixed >> 16) & 0xFF);
+        }
+
+        // Squared so most splats are faint and a few percent fall below the default prune threshold
+        float opacity = random_unit(&state);
+        alphas[i] = clamp_byte(255.0f * opacity * opacity);
+        for (int k = 0; k < 3; k++)
+        {
+            colors[(size_t)i * 3 + k] = (uint8_t)(next_random(&state) >> 56);
+        }
+
+        // exp(b / 25.5 - 5) per axis, one axis flattened like most trained splats
+        for (int k = 0; k < 3; k++)
+        {
+            float jitter = random_unit(&state) - 0.5f - (k == 2 ? 1.0f : 0.0f);
+            scales[(size_t)i * 3 + k] = clamp_byte(25.5f * (log_scale + jitter + 5.0f));
+        }
+
+        // Uniform rotation (Shoemake)
+        float u1 = random_unit(&state);
+        float u2 = 2.0f * HMM_PI32 * random_unit(&state);
+        float u3 = 2.0f * HMM_PI32 * random_unit(&state);
+        float a = sqrtf(1.0f - u1);
+        float b = sqrtf(u1);
+        HMM_Quat q = HMM_Q(a * sinf(u2), a * cosf(u2), b * sinf(u3), b * cosf(u3));
+        uint8_t *rotation = rotations + (size_t)i * rotation_bytes;
+        if (params->version == 3)
+        {
+            uint32_t packed = quat_encode_smallest_three(q);
+            memcpy(rotation, &packed, 4);
+        }
+        else
+        {
+            // x, y, z of the rotation with w >= 0
+            float sign = q.W < 0.0f ? -1.0f : 1.0f;
+            float xyz[3] = {q.X * sign, q.Y * sign, q.Z * sign};
+            for (int k = 0; k < 3; k++)
+            {
+                rotation[k] = (uint8_t)(int8_t)fminf(fmaxf(roundf(xyz[k] * 128.0f), -127.0f), 127.0f);
+            }
+        }
+
+        // Small view-dependent terms around zero
+        for (size_t k = 0; k < sh_bytes; k++)
+        {
+            sh[(size_t)i * sh_bytes + k] = (uint8_t)(128 + (int)(next_random(&state) >> 60) - 8);
+        }
+    }
+
+    *out_data = data;
+    *out_size = size;
+    return 0;
+}
+
+double tool_image_rmse(const uint8_t *a, const uint8_t *b, int width, int height)
+{
+    double sum = 0.0;
+    size_t pixels = (size_t)width * height;
+    for (size_t p = 0; p < pixels; p++)
+    {
+        for (int c = 0; c < 3; c++)
+        {
+            double d = (double)a[p * 4 + c] - (double)b[p * 4 + c];
+            sum += d * d;
+        }
+    }
+    return sqrt(sum / (double)(pixels * 3));
+}
+
+double tool_psnr(double rmse)
+{
+    return rmse > 0.0 ? 20.0 * log10(255.0 / rmse) : INFINITY;
+}
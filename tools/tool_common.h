@@ -0,0 +1,50 @@
+#ifndef TOOL_COMMON_H
+#define TOOL_COMMON_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "cpu_renderer.h"
+#include "loader/spzloader.h"
+
+// An SPZ stream decoded into the texel layout the renderers use
+typedef struct
+{
+    uint8_t *spz;     // decompressed SPZ stream
+    size_t spz_size;
+    PackedSplat *splats;
+    uint32_t *texels;
+    uint32_t splat_count;
+    BoundingBox bounds;
+    splat_chunk_t *chunks;
+} tool_scene_t;
+
+// Decode an in-memory SPZ stream (takes ownership of spz, a core_malloc block); no load-time pruning so
+// splat i is point i of the stream
+int tool_scene_from_spz(uint8_t *spz, size_t spz_size, tool_scene_t *out_scene);
+int tool_scene_load(const char *path, tool_scene_t *out_scene);
+void tool_scene_free(tool_scene_t *scene);
+
+cpu_splat_source_t tool_scene_source(const tool_scene_t *scene);
+
+// Shape of the scene tool_synthetic_spz generates
+typedef struct
+{
+    uint32_t count;
+    uint32_t version;   // 2 or 3, the rotation encoding
+    uint32_t sh_degree; // 0-3
+    uint32_t seed;
+} tool_synthetic_params_t;
+
+// Radius of the synthetic scene in world units
+#define TOOL_SYNTHETIC_RADIUS 10.0f
+
+// Build a decompressed SPZ stream of random splats (core_free() when done): most on a noisy sphere shell,
+// the rest inside it, sized to the point spacing so the coverage per pixel stays similar at any count.
+// Opacities lean low like trained scenes, so load-time pruning has work to do.
+int tool_synthetic_spz(const tool_synthetic_params_t *params, uint8_t **out_data, size_t *out_size);
+
+// Root mean square error over RGB (0-255) and the matching PSNR in dB
+double tool_image_rmse(const uint8_t *a, const uint8_t *b, int width, int height);
+double tool_psnr(double rmse);
+
+#endif // TOOL_COMMON_H
@@ -0,0 +1,201 @@
+// Offline visibility pruning: drops splats that no reachable orbit pose ever shows
+//
+// usage: visibility_prune input.spz output.spz [--views N] [--holdout N] [--size PIXELS]
+//                         [--threshold WEIGHT] [--radius-min R] [--radius-max R]
+//
+// Renders --views poses sampled from the camera's reachable space (yaw, pitch +-1.5,
+// radius 0.1-300 by default) on the CPU, keeps every splat that reached --threshold blend
+// weight in at least one of them, and writes the survivors as a new SPZ. The pruned file is
+// then compared against the input on --holdout poses that were not used for pruning.
+#include "tool_common.h"
+#include "visibility.h"
+#include "loader/spzfile.h"
+#include "utils/core_memory.h"
+#include "utils/timer.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct
+{
+    const char *input_path;
+    const char *output_path;
+    uint32_t views;
+    uint32_t holdout_views;
+    int size;
+    float threshold;
+    visibility_pose_params_t poses;
+} prune_args_t;
+
+static void print_usage(void)
+{
+    printf("usage: visibility_prune input.spz output.spz [--views N] [--holdout N] [--size PIXELS]\n"
+           "                        [--threshold WEIGHT] [--radius-min R] [--radius-max R]\n");
+}
+
+static int parse_args(int argc, char **argv, prune_args_t *args)
+{
+    *args = (prune_args_t){
+        .views = 256,
+        .holdout_views = 16,
+        .size = 512,
+        .threshold = VISIBILITY_DEFAULT_THRESHOLD,
+        .poses = {.radius_min = CAMERA_MIN_RADIUS, .radius_max = CAMERA_MAX_RADIUS}};
+
+    int positional = 0;
+    for (int i = 1; i < argc; i++)
+    {
+        const char *arg = argv[i];
+        const char *value = i + 1 < argc ? argv[i + 1] : NULL;
+        if (arg[0] != '-')
+        {
+            if (positional == 0)
+                args->input_path = arg;
+            else if (positional == 1)
+                args->output_path = arg;
+            else
+                return -1;
+            positional++;
+            continue;
+        }
+        if (!value)
+        {
+            return -1;
+        }
+        if (strcmp(arg, "--views") == 0)
+            args->views = (uint32_t)strtoul(value, NULL, 10);
+        else if (strcmp(arg, "--holdout") == 0)
+            args->holdout_views = (uint32_t)strtoul(value, NULL, 10);
+        else if (strcmp(arg, "--size") == 0)
+            args->size = atoi(value);
+        else if (strcmp(arg, "--threshold") == 0)
+            args->threshold = strtof(value, NULL);
+        else if (strcmp(arg, "--radius-min") == 0)
+            args->poses.radius_min = strtof(value, NULL);
+        else if (strcmp(arg, "--radius-max") == 0)
+            args->poses.radius_max = strtof(value, NULL);
+        else
+            return -1;
+        i++;
+    }
+
+    return (positional == 2 && args->views > 0 && args->size > 0) ? 0 : -1;
+}
+
+// Render the held-out poses from both scenes and report the image error the pruning introduced
+static int compare_holdout(const tool_scene_t *original, const tool_scene_t *pruned, const Camera *cameras,
+                           uint32_t count, int size)
+{
+    size_t image_bytes = (size_t)size * size * 4;
+    uint8_t *reference = (uint8_t *)malloc(image_bytes);
+    uint8_t *candidate = (uint8_t *)malloc(image_bytes);
+    if (!reference || !candidate)
+    {
+        free(reference);
+        free(candidate);
+        return -1;
+    }
+
+    cpu_splat_source_t original_source = tool_scene_source(original);
+    cpu_splat_source_t pruned_source = tool_scene_source(pruned);
+    double rmse_sum = 0.0;
+    double rmse_max = 0.0;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        Camera camera = cameras[i];
+        if (cpu_render_splats(&original_source, &camera, size, size, reference, NULL) != 0 ||
+            cpu_render_splats(&pruned_source, &camera, size, size, candidate, NULL) != 0)
+        {
+            free(reference);
+            free(candidate);
+            return -1;
+        }
+        double rmse = tool_image_rmse(reference, candidate, size, size);
+        rmse_sum += rmse;
+        rmse_max = rmse > rmse_max ? rmse : rmse_max;
+    }
+
+    double rmse_mean = count > 0 ? rmse_sum / count : 0.0;
+    printf("Held-out error (%u views): mean RMSE %.3f (PSNR %.2f dB), worst RMSE %.3f (PSNR %.2f dB)\n",
+           count, rmse_mean, tool_psnr(rmse_mean), rmse_max, tool_psnr(rmse_max));
+
+    free(reference);
+    free(candidate);
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    prune_args_t args;
+    if (parse_args(argc, argv, &args) != 0)
+    {
+        print_usage();
+        return 1;
+    }
+
+    tool_scene_t original;
+    if (tool_scene_load(args.input_path, &original) != 0)
+    {
+        return 1;
+    }
+
+    Camera *base = camera_create();
+    uint32_t pose_count = args.views + args.holdout_views;
+    Camera *cameras = (Camera *)malloc((size_t)pose_count * sizeof(Camera));
+    float *max_contribution = (float *)calloc(original.splat_count, sizeof(float));
+    uint8_t *keep = (uint8_t *)malloc(original.splat_count);
+    if (!base || !cameras || !max_contribution || !keep)
+    {
+        fprintf(stderr, "Out of memory\n");
+        return 1;
+    }
+
+    // Held-out poses continue the sequence, so they never coincide with a pruning pose
+    visibility_pose_params_t holdout_params = args.poses;
+    holdout_params.first_sample += args.views;
+    visibility_sample_poses(base, &args.poses, args.views, cameras);
+    visibility_sample_poses(base, &holdout_params, args.holdout_views, cameras + args.views);
+
+    double start_time = time_now_ms();
+    cpu_splat_source_t source = tool_scene_source(&original);
+    if (visibility_accumulate(&source, cameras, args.views, args.size, args.size, max_contribution) != 0)
+    {
+        return 1;
+    }
+    uint32_t kept = visibility_keep_mask(max_contribution, original.splat_count, args.threshold, keep);
+
+    uint8_t *pruned_spz = NULL;
+    size_t pruned_size = 0;
+    if (spz_select_points(original.spz, original.spz_size, keep, &pruned_spz, &pruned_size, NULL) != 0 ||
+        spz_write_file(args.output_path, pruned_spz, pruned_size) != 0)
+    {
+        return 1;
+    }
+
+    printf("Kept %u of %u splats, pruned %.2f%% (threshold %.4f, %u views, %.1f s)\n",
+           kept, original.splat_count, 100.0 * (original.splat_count - kept) / original.splat_count,
+           args.threshold, args.views, (time_now_ms() - start_time) / 1000.0);
+    printf("Wrote %s (%.2f MB decompressed, was %.2f MB)\n", args.output_path,
+           pruned_size / (1024.0 * 1024.0), original.spz_size / (1024.0 * 1024.0));
+
+    int result = 0;
+    if (args.holdout_views > 0)
+    {
+        tool_scene_t pruned;
+        if (kept == 0 || tool_scene_from_spz(pruned_spz, pruned_size, &pruned) != 0)
+        {
+            return 1;
+        }
+        pruned_spz = NULL;
+        result = compare_holdout(&original, &pruned, cameras + args.views, args.holdout_views, args.size);
+        tool_scene_free(&pruned);
+    }
+
+    core_free(pruned_spz);
+    free(keep);
+    free(max_contribution);
+    free(cameras);
+    camera_destroy(base);
+    tool_scene_free(&original);
+    return result == 0 ? 0 : 1;
+}